@@ -0,0 +1,210 @@
+# Porkchop OUI database builder
+# Converts the IEEE MA-L registry (oui.csv from
+# https://standards-oui.ieee.org/oui/oui.csv) plus the curated
+# scripts/oui_seed.csv into src/core/oui_db.h: a sorted table of 24-bit
+# prefixes, a parallel vendor-id column and a deduplicated name pool, all
+# in flash and binary-searched by OUI::getVendor().
+#
+# pre_build.py runs this only when an IEEE list is present (scripts/oui.csv
+# or $PORKCHOP_OUI_CSV); otherwise the committed header is used as-is.
+# Standalone:
+#   python3 scripts/oui_db.py [path/to/oui.csv]
+
+import csv
+import os
+import re
+import sys
+
+SCRIPT_DIR = os.path.dirname(os.path.abspath(__file__))
+SEED = os.path.join(SCRIPT_DIR, "oui_seed.csv")
+DEFAULT_IEEE = os.path.join(SCRIPT_DIR, "oui.csv")
+OUTPUT = os.path.join("core", "oui_db.h")
+
+NAME_MAX = 9            # Display width in Spectrum's client list
+MAX_VENDORS = 0xFFFF    # 0xFFFF is reserved for "no vendor" in the cache
+
+# IEEE organisation name prefix (whole words) -> short name the UI has always shown
+ALIASES = [
+    ("hon hai", "HonHai"),
+    ("foxconn", "HonHai"),
+    ("raspberry pi", "RaspbPi"),
+    ("cisco-linksys", "Cisco"),
+    ("tp-link", "TP-Link"),
+    ("huawei", "Huawei"),
+    ("netgear", "Netgear"),
+    ("xiaomi", "Xiaomi"),
+    ("beijing xiaomi", "Xiaomi"),
+    ("samsung", "Samsung"),
+    ("lg electronics", "LG"),
+    ("lg innotek", "LG"),
+    ("espressif", "Espressif"),
+    ("amazon", "Amazon"),
+    ("google", "Google"),
+    ("nest labs", "Google"),
+    ("microsoft", "Microsoft"),
+    ("intel", "Intel"),
+    ("sony", "Sony"),
+    ("dell", "Dell"),
+    ("lenovo", "Lenovo"),
+    ("apple", "Apple"),
+]
+
+# Words that carry no brand information
+STOPWORDS = {
+    "inc", "incorporated", "corp", "corporation", "co", "company", "ltd",
+    "limited", "llc", "gmbh", "ag", "sa", "srl", "bv", "nv", "oy", "ab",
+    "as", "plc", "pte", "pty", "kg", "spa", "the", "group", "holdings",
+}
+
+
+def short_name(org):
+    """Reduce an IEEE organisation name to a <= NAME_MAX display name."""
+    # The display font is ASCII-only
+    org = org.encode("ascii", "ignore").decode("ascii").strip().strip('"')
+    low = org.lower()
+    for prefix, alias in ALIASES:
+        # Whole words only: "intel" must not swallow Intelbras or Intellian
+        if re.match(r"%s\b" % re.escape(prefix), low):
+            return alias
+    words = [w for w in re.split(r"[\s,.()]+", org) if w]
+    words = [w for w in words if w.lower() not in STOPWORDS]
+    if not words:
+        return org[:NAME_MAX] or "?"
+    name = words[0][:NAME_MAX]
+    for w in words[1:]:
+        if len(name) + 1 + len(w) > NAME_MAX:
+            break
+        name += " " + w
+    return name
+
+
+def parse_oui(text):
+    text = text.strip().replace("-", "").replace(":", "")
+    if not re.fullmatch(r"[0-9A-Fa-f]{6}", text):
+        return None
+    return int(text, 16)
+
+
+def load_ieee(path):
+    """IEEE MA-L CSV: Registry,Assignment,Organization Name,Organization Address"""
+    table = {}
+    with open(path, newline="", encoding="utf-8", errors="replace") as f:
+        for row in csv.reader(f):
+            if len(row) < 3 or row[0] != "MA-L":
+                continue
+            key = parse_oui(row[1])
+            if key is not None and key not in table:
+                table[key] = short_name(row[2])
+    return table
+
+
+def load_seed(path):
+    table = {}
+    with open(path, encoding="utf-8") as f:
+        for line in f:
+            line = line.strip()
+            if not line or line.startswith("#"):
+                continue
+            prefix, _, name = line.partition(",")
+            key = parse_oui(prefix)
+            if key is None or not name:
+                raise RuntimeError("oui_db: bad seed line: %r" % line)
+            if key not in table:
+                table[key] = name[:NAME_MAX]
+    return table
+
+
+def render_header(table, source):
+    names = sorted(set(table.values()))
+    if len(names) >= MAX_VENDORS:
+        raise RuntimeError("oui_db: %d vendor names exceed 16-bit ids" % len(names))
+    name_id = {n: i for i, n in enumerate(names)}
+
+    offsets = []
+    pool = []
+    pos = 0
+    for n in names:
+        offsets.append(pos)
+        pool.append(n)
+        pos += len(n.encode("utf-8")) + 1
+
+    keys = sorted(table)
+    out = [
+        "// Auto-generated by scripts/oui_db.py - do not edit",
+        "// Source: %s" % source,
+        "// OUI_DB_KEYS: big-endian 24-bit prefixes, strictly ascending",
+        "// OUI_DB_VENDOR: name id per key; OUI_DB_NAME_OFF: id -> offset in OUI_DB_NAMES",
+        "#pragma once",
+        "",
+        "#include <stdint.h>",
+        "",
+        "#define OUI_DB_COUNT %d" % len(keys),
+        "#define OUI_DB_NAME_COUNT %d" % len(names),
+        "",
+        "static const uint8_t OUI_DB_KEYS[OUI_DB_COUNT * 3] PROGMEM = {",
+    ]
+    for i in range(0, len(keys), 8):
+        out.append("    " + " ".join("0x%02X,0x%02X,0x%02X," % (k >> 16, (k >> 8) & 0xFF, k & 0xFF)
+                                     for k in keys[i:i + 8]))
+    out.append("};")
+    out.append("")
+    out.append("static const uint16_t OUI_DB_VENDOR[OUI_DB_COUNT] PROGMEM = {")
+    ids = [name_id[table[k]] for k in keys]
+    for i in range(0, len(ids), 16):
+        out.append("    " + " ".join("%d," % v for v in ids[i:i + 16]))
+    out.append("};")
+    out.append("")
+    out.append("static const uint32_t OUI_DB_NAME_OFF[OUI_DB_NAME_COUNT] PROGMEM = {")
+    for i in range(0, len(offsets), 16):
+        out.append("    " + " ".join("%d," % v for v in offsets[i:i + 16]))
+    out.append("};")
+    out.append("")
+    out.append("static const char OUI_DB_NAMES[] PROGMEM =")
+    for n in pool:
+        out.append('    "%s\\0"' % n.replace("\\", "\\\\").replace('"', '\\"'))
+    out.append("    ;")
+    out.append("")
+    return "\n".join(out)
+
+
+def ieee_source_path(explicit=None):
+    for path in (explicit, os.environ.get("PORKCHOP_OUI_CSV"), DEFAULT_IEEE):
+        if path and os.path.isfile(path):
+            return path
+    return None
+
+
+def generate_oui_db(src_dir, ieee_path=None, quiet=False):
+    """Write core/oui_db.h under src_dir. Returns True if the file changed."""
+    seed = load_seed(SEED)
+    table = {}
+    if ieee_path:
+        table = load_ieee(ieee_path)
+        source = "IEEE MA-L (%d prefixes) + oui_seed.csv" % len(table)
+    else:
+        source = "oui_seed.csv only (no IEEE oui.csv supplied)"
+    for key, name in seed.items():
+        table.setdefault(key, name)
+
+    header = render_header(table, source)
+    out_path = os.path.join(src_dir, OUTPUT)
+    try:
+        with open(out_path, "r", encoding="utf-8") as f:
+            if f.read() == header:
+                return False
+    except OSError:
+        pass
+    with open(out_path, "w", encoding="utf-8", newline="\n") as f:
+        f.write(header)
+    if not quiet:
+        print("oui_db: wrote %s (%d prefixes, %d names)" %
+              (out_path, len(table), len(set(table.values()))))
+    return True
+
+
+if __name__ == "__main__":
+    src = os.path.normpath(os.path.join(SCRIPT_DIR, "..", "src"))
+    arg = sys.argv[1] if len(sys.argv) > 1 else None
+    if arg and not os.path.isfile(arg):
+        sys.exit("oui_db: %s not found" % arg)
+    generate_oui_db(src, ieee_source_path(arg))
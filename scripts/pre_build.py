@@ -1,11 +1,17 @@
 # Porkchop pre-build script
-# Ensures model files exist and generates version info
+# Ensures model files exist, generates version info and packs web assets
 
 Import("env")
 import os
 import subprocess
+import sys
 from datetime import datetime
 
+# SCons scripts have no __file__; locate sibling modules via the project dir
+sys.path.insert(0, os.path.join(env.subst("$PROJECT_DIR"), "scripts"))
+from web_assets import generate_web_assets
+from oui_db import generate_oui_db, ieee_source_path
+
 def get_git_commit():
     """Get short git commit hash, or 'unknown' if not in a git repo"""
     try:
@@ -36,3 +42,13 @@ def pre_build_callback(source, target, env):
         f.write(f'#define BUILD_COMMIT "{build_info["commit"]}"\n')
 
 env.AddPreAction("buildprog", pre_build_callback)
+
+# Runs at load (not as a buildprog action) so the header exists before
+# fileserver.cpp compiles
+generate_web_assets(env.subst("$PROJECT_SRC_DIR"))
+
+# Only rebuild the OUI table when an IEEE list is supplied; the committed
+# oui_db.h is used otherwise
+oui_csv = ieee_source_path()
+if oui_csv:
+    generate_oui_db(env.subst("$PROJECT_SRC_DIR"), oui_csv)
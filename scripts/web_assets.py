@@ -0,0 +1,81 @@
+# Porkchop web asset packer
+# Gzips the web UI PROGMEM literals in src/web/fileserver.cpp into
+# src/web/web_assets_gz.h with a content-hash ETag per asset.
+# Run by pre_build.py on every build; also works standalone:
+#   python3 scripts/web_assets.py
+
+import gzip
+import hashlib
+import os
+import re
+
+# (literal name in fileserver.cpp) - order is the order in the header
+ASSETS = ["HTML_TEMPLATE", "HTML_STYLE", "HTML_SCRIPT"]
+
+SOURCE = os.path.join("web", "fileserver.cpp")
+OUTPUT = os.path.join("web", "web_assets_gz.h")
+
+LITERAL_RE = r'static const char {name}\[\] PROGMEM = R"rawliteral\((.*?)\)rawliteral";'
+
+
+def extract_literal(source, name):
+    match = re.search(LITERAL_RE.format(name=name), source, re.DOTALL)
+    if not match:
+        raise RuntimeError("web_assets: %s not found in %s" % (name, SOURCE))
+    return match.group(1).encode("utf-8")
+
+
+def to_c_array(data):
+    lines = []
+    for i in range(0, len(data), 16):
+        lines.append("    " + ", ".join("0x%02x" % b for b in data[i:i + 16]) + ",")
+    return "\n".join(lines)
+
+
+def render_header(blobs):
+    out = [
+        "// Auto-generated by scripts/web_assets.py - do not edit",
+        "// Gzipped web UI assets from fileserver.cpp; ETag is a hash of the plain text",
+        "#pragma once",
+        "",
+        "#include <stddef.h>",
+        "#include <stdint.h>",
+        "#include <pgmspace.h>",
+        "",
+    ]
+    for name, raw in blobs:
+        # mtime=0 keeps the output byte-identical between builds
+        packed = gzip.compress(raw, compresslevel=9, mtime=0)
+        etag = hashlib.sha256(raw).hexdigest()[:16]
+        out.append("// %s: %u -> %u bytes" % (name, len(raw), len(packed)))
+        out.append('#define %s_ETAG "\\"%s\\""' % (name, etag))
+        out.append("static const size_t %s_GZ_LEN = %u;" % (name, len(packed)))
+        out.append("static const uint8_t %s_GZ[] PROGMEM = {" % name)
+        out.append(to_c_array(packed))
+        out.append("};")
+        out.append("")
+    return "\n".join(out)
+
+
+def generate_web_assets(src_dir):
+    """Regenerate the header; only rewrites it when the content changed"""
+    with open(os.path.join(src_dir, SOURCE), "r", encoding="utf-8") as f:
+        source = f.read()
+    header = render_header([(name, extract_literal(source, name)) for name in ASSETS])
+
+    out_path = os.path.join(src_dir, OUTPUT)
+    try:
+        with open(out_path, "r", encoding="utf-8") as f:
+            if f.read() == header:
+                return False
+    except OSError:
+        pass
+    with open(out_path, "w", encoding="utf-8", newline="\n") as f:
+        f.write(header)
+    print("web_assets: regenerated %s" % OUTPUT)
+    return True
+
+
+if __name__ == "__main__":
+    project = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+    generate_web_assets(os.path.join(project, "src"))
@@ -0,0 +1,221 @@
+// BootProfile - Boot timeline records and fast-path boot decisions
+// setup() stamps the end of each boot phase with micros(). The timeline is
+// a fixed-size POD so it can live in RTC memory: it survives a crash or
+// soft reset, and the previous boot is still readable after the next one.
+// The fast path starts the SD clock ladder at the last clock that mounted
+// and skips heap conditioning when the heap already meets the TLS gate.
+// Header-only, no Arduino dependencies (unit tested on native).
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+namespace BootProfile {
+
+enum class Phase : uint8_t {
+    Start = 0,          // setup() entered
+    Hardware,           // M5 begin, pins
+    WiFiDriver,         // WiFi driver pre-init
+    Personality,        // SPIFFS + personality (splash theme)
+    Splash,             // First splash screen up
+    SdConfig,           // SD mount + main config
+    SdLog,
+    CoreDump,
+    Journal,            // Capture journal recovery
+    HeapCondition,
+    Gps,
+    Piglet,             // Avatar + mood
+    SplashDone,         // Last splash screen finished
+    Display,            // Sprites allocated
+    Modes,              // Mode init + porkchop.init
+    Ready,              // Interactive: first loop() next
+    Count
+};
+
+static const uint8_t kPhaseCount = (uint8_t)Phase::Count;
+static const uint8_t kMaxMarks = 24;
+static const uint32_t kMagic = 0x424F4F54;              // 'BOOT'
+
+// Time-to-interactive budget: splash (2.8 s, +1 s welcome) with the init
+// work hidden behind it
+static const uint32_t kTargetInteractiveMs = 4500;
+
+inline const char* phaseName(Phase p) {
+    static const char* const kNames[kPhaseCount] = {
+        "START", "HARDWARE", "WIFI_DRIVER", "PERSONALITY", "SPLASH",
+        "SD_CONFIG", "SDLOG", "COREDUMP", "JOURNAL", "HEAP_COND",
+        "GPS", "PIGLET", "SPLASH_DONE", "DISPLAY", "MODES", "READY"
+    };
+    uint8_t i = (uint8_t)p;
+    return i < kPhaseCount ? kNames[i] : "?";
+}
+
+// Fast-path decisions taken this boot
+enum Flag : uint8_t {
+    FLAG_SD_REMEMBERED = 0x01,      // Ladder started at the remembered clock
+    FLAG_SD_FIRST_TRY = 0x02,       // First clock tried mounted
+    FLAG_CONDITION_SKIPPED = 0x04,  // Heap already met the TLS gate
+    FLAG_SD_FAILED = 0x08,
+    FLAG_SD_PROBED = 0x10           // Fastest clock probed ahead of the remembered one
+};
+
+struct Timeline {
+    uint32_t magic;
+    uint16_t bootCount;
+    uint8_t count;
+    uint8_t flags;
+    uint32_t sdHz;                  // Clock the SD mounted at (0 = none)
+    uint8_t phase[kMaxMarks];
+    uint32_t us[kMaxMarks];         // micros() at the end of the phase
+
+    bool valid() const {
+        return magic == kMagic && count <= kMaxMarks;
+    }
+
+    void begin(uint16_t boot) {
+        memset(this, 0, sizeof(*this));
+        magic = kMagic;
+        bootCount = boot;
+    }
+
+    // Extra marks past kMaxMarks are dropped (READY is always kept)
+    void mark(Phase p, uint32_t nowUs) {
+        if (count >= kMaxMarks) {
+            if (p != Phase::Ready) return;
+            count = kMaxMarks - 1;
+        }
+        phase[count] = (uint8_t)p;
+        us[count] = nowUs;
+        count++;
+    }
+
+    // Length of mark i (since the previous mark; the first mark is since reset)
+    uint32_t durationUs(uint8_t i) const {
+        if (i >= count) return 0;
+        return i == 0 ? us[0] : us[i] - us[i - 1];
+    }
+
+    bool find(Phase p, uint32_t& outUs) const {
+        for (uint8_t i = 0; i < count; i++) {
+            if (phase[i] == (uint8_t)p) {
+                outUs = us[i];
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Reset to READY, or 0 if this boot never got there
+    uint32_t interactiveMs() const {
+        uint32_t t = 0;
+        return find(Phase::Ready, t) ? t / 1000 : 0;
+    }
+};
+
+/**
+ * Boot-time rotation of the RTC copies. A valid current timeline becomes
+ * the previous one; garbage (power-on, RTC memory random) is discarded.
+ */
+inline void rollover(Timeline& current, Timeline& previous) {
+    uint16_t boot = 0;
+    if (current.valid()) {
+        previous = current;
+        boot = current.bootCount;
+    }
+    current.begin((uint16_t)(boot + 1));
+}
+
+/**
+ * One line per mark: "  SD_CONFIG    +  142.3 ms  @    410.8 ms".
+ * @return characters written (snprintf semantics)
+ */
+inline int formatMark(const Timeline& t, uint8_t i, char* buf, size_t len) {
+    if (i >= t.count) return 0;
+    uint32_t d = t.durationUs(i);
+    uint32_t at = t.us[i];
+    return snprintf(buf, len, "  %-12s +%5lu.%lu ms  @ %6lu.%lu ms",
+                    phaseName((Phase)t.phase[i]),
+                    (unsigned long)(d / 1000), (unsigned long)(d % 1000 / 100),
+                    (unsigned long)(at / 1000), (unsigned long)(at % 1000 / 100));
+}
+
+// ============================================================================
+// SD clock ladder
+// ============================================================================
+
+static const uint8_t kSdClockCount = 6;
+static const uint32_t kSdClocks[kSdClockCount] = {
+    25000000, 20000000, 10000000, 8000000, 4000000, 1000000
+};
+
+inline bool sdClockKnown(uint32_t hz) {
+    for (uint8_t i = 0; i < kSdClockCount; i++) {
+        if (kSdClocks[i] == hz) return true;
+    }
+    return false;
+}
+
+/**
+ * Clocks to try, in order: probeHz (if given), the remembered clock (if it
+ * is one of ours), then the rest of the ladder fastest first.
+ * @return number of clocks written to out
+ */
+inline uint8_t sdLadder(uint32_t lastGoodHz, uint32_t out[kSdClockCount], uint32_t probeHz = 0) {
+    uint8_t n = 0;
+    bool probe = sdClockKnown(probeHz) && probeHz != lastGoodHz;
+    bool known = sdClockKnown(lastGoodHz);
+    if (probe) out[n++] = probeHz;
+    if (known) out[n++] = lastGoodHz;
+    for (uint8_t i = 0; i < kSdClockCount; i++) {
+        if (known && kSdClocks[i] == lastGoodHz) continue;
+        if (probe && kSdClocks[i] == probeHz) continue;
+        out[n++] = kSdClocks[i];
+    }
+    return n;
+}
+
+// Mounts below the fastest clock between probes of the fastest one
+static const uint8_t kSdReprobeMounts = 8;
+
+// What the ladder remembers across boots (NVS)
+struct SdClockMemory {
+    uint32_t hz;        // Clock the ladder starts at, 0 = none yet
+    uint32_t lowerHz;   // Slower clock seen once; remembered only if it repeats
+    uint8_t mounts;     // Mounts since the fastest clock was last tried
+};
+
+// Fastest clock to try ahead of the remembered one this mount, 0 for none
+inline uint32_t sdProbeClock(const SdClockMemory& m) {
+    if (!sdClockKnown(m.hz) || m.hz == kSdClocks[0]) return 0;
+    return m.mounts >= kSdReprobeMounts ? kSdClocks[0] : 0;
+}
+
+/**
+ * Fold in a successful mount. A clock at least as fast as the remembered
+ * one is kept at once; a slower one only when the next mount lands there
+ * too, so one flaky boot can't pin the card low. Below the fastest clock,
+ * every kSdReprobeMounts-th mount probes the fastest again.
+ * @return true if m changed (needs saving)
+ */
+inline bool sdNoteMount(SdClockMemory& m, uint32_t mountedHz) {
+    SdClockMemory before = m;
+    bool probed = sdProbeClock(m) != 0;
+    if (!sdClockKnown(m.hz) || mountedHz >= m.hz || m.lowerHz == mountedHz) {
+        m.hz = mountedHz;
+        m.lowerHz = 0;
+    } else {
+        m.lowerHz = mountedHz;
+    }
+    if (m.hz == kSdClocks[0] || probed) m.mounts = 0;
+    else if (m.mounts < 0xFF) m.mounts++;
+    return m.hz != before.hz || m.lowerHz != before.lowerHz || m.mounts != before.mounts;
+}
+
+// Boot conditioning only helps a heap that can't already hold a TLS session
+inline bool needsConditioning(size_t largestBlock, size_t minContigForTls) {
+    return largestBlock < minContigForTls;
+}
+
+}  // namespace BootProfile
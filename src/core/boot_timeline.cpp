@@ -0,0 +1,118 @@
+// Boot Timeline - RTC-resident boot phase timestamps
+
+#include "boot_timeline.h"
+#include "sd_layout.h"
+#include <Arduino.h>
+#include <SD.h>
+#include <esp_attr.h>
+#include <esp_system.h>
+
+namespace BootTimeline {
+
+using BootProfile::Phase;
+using BootProfile::Timeline;
+
+// Not cleared on reset; rollover() discards power-on garbage by magic
+RTC_NOINIT_ATTR static Timeline rtcCurrent;
+RTC_NOINIT_ATTR static Timeline rtcPrevious;
+
+// Start over rather than grow the log forever (~1 KB per boot)
+static const uint32_t kBootLogMaxBytes = 32 * 1024;
+
+void begin() {
+    BootProfile::rollover(rtcCurrent, rtcPrevious);
+}
+
+void mark(Phase phase) {
+    rtcCurrent.mark(phase, (uint32_t)micros());
+}
+
+void setFlag(uint8_t flag) {
+    rtcCurrent.flags |= flag;
+}
+
+void noteSd(uint32_t hz, uint8_t flags) {
+    rtcCurrent.sdHz = hz;
+    rtcCurrent.flags |= flags;
+}
+
+const Timeline& current() {
+    return rtcCurrent;
+}
+
+const Timeline& previous() {
+    return rtcPrevious;
+}
+
+static void formatHeader(const Timeline& t, char* buf, size_t len) {
+    // Reset reason is only known for the boot we're in
+    char reset[12];
+    if (&t == &rtcCurrent) snprintf(reset, sizeof(reset), "%d", (int)esp_reset_reason());
+    else strcpy(reset, "?");
+    snprintf(buf, len, "boot #%u reset=%s tti=%lums target=%lums sd=%luMHz%s%s%s%s",
+             t.bootCount, reset,
+             (unsigned long)t.interactiveMs(), (unsigned long)BootProfile::kTargetInteractiveMs,
+             (unsigned long)(t.sdHz / 1000000),
+             (t.flags & BootProfile::FLAG_SD_REMEMBERED) ? " sd_remembered" : "",
+             (t.flags & BootProfile::FLAG_SD_PROBED) ? " sd_probed" : "",
+             (t.flags & BootProfile::FLAG_SD_FIRST_TRY) ? " sd_first_try" : "",
+             (t.flags & BootProfile::FLAG_CONDITION_SKIPPED) ? " cond_skipped" : "");
+}
+
+void dumpSerial() {
+    char line[128];
+    formatHeader(rtcCurrent, line, sizeof(line));
+    Serial.printf("[BOOT] %s\n", line);
+    for (uint8_t i = 0; i < rtcCurrent.count; i++) {
+        BootProfile::formatMark(rtcCurrent, i, line, sizeof(line));
+        Serial.printf("[BOOT] %s\n", line);
+    }
+
+    uint32_t tti = rtcCurrent.interactiveMs();
+    if (tti > BootProfile::kTargetInteractiveMs) {
+        Serial.printf("[BOOT] Time to interactive %lums over %lums target\n",
+                      (unsigned long)tti, (unsigned long)BootProfile::kTargetInteractiveMs);
+    }
+    if (rtcPrevious.valid() && rtcPrevious.interactiveMs() == 0) {
+        Serial.printf("[BOOT] Previous boot #%u stopped after %s\n", rtcPrevious.bootCount,
+                      rtcPrevious.count ? BootProfile::phaseName((Phase)rtcPrevious.phase[rtcPrevious.count - 1]) : "START");
+    }
+}
+
+static void writeTimeline(File& f, const Timeline& t) {
+    char line[128];
+    formatHeader(t, line, sizeof(line));
+    f.println(line);
+    for (uint8_t i = 0; i < t.count; i++) {
+        BootProfile::formatMark(t, i, line, sizeof(line));
+        f.println(line);
+    }
+}
+
+bool dumpSD() {
+    if (!SD.exists("/")) return false;
+    const char* path = SDLayout::bootLogPath();
+    const char* diagDir = SDLayout::diagnosticsDir();
+    if (strcmp(diagDir, "/") != 0 && !SD.exists(diagDir)) {
+        SD.mkdir(diagDir);
+    }
+
+    File f = SD.open(path, FILE_APPEND);
+    if (!f) return false;
+    if (f.size() > kBootLogMaxBytes) {
+        f.close();
+        SD.remove(path);
+        f = SD.open(path, FILE_APPEND);
+        if (!f) return false;
+    }
+
+    // A boot that died before READY never got to write itself out
+    if (rtcPrevious.valid() && rtcPrevious.interactiveMs() == 0) {
+        writeTimeline(f, rtcPrevious);
+    }
+    writeTimeline(f, rtcCurrent);
+    f.close();
+    return true;
+}
+
+}  // namespace BootTimeline
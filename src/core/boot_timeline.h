@@ -0,0 +1,29 @@
+// Boot Timeline - per-phase boot timestamps kept in RTC memory
+// setup() calls begin() first, then mark() at the end of each phase. The
+// current and previous timelines survive crashes and soft resets, so a boot
+// that never reached READY can still be read back on the next one.
+#pragma once
+
+#include <cstdint>
+#include "boot_profile.h"
+
+namespace BootTimeline {
+    // Rotate the RTC copies and start this boot's timeline
+    void begin();
+
+    // Stamp the end of a phase with micros()
+    void mark(BootProfile::Phase phase);
+
+    // Fast-path outcomes (BootProfile::FLAG_*)
+    void setFlag(uint8_t flag);
+    void noteSd(uint32_t hz, uint8_t flags);
+
+    const BootProfile::Timeline& current();
+    const BootProfile::Timeline& previous();    // valid() false if none
+
+    // Print this boot's phases and the time-to-interactive verdict
+    void dumpSerial();
+
+    // Append this boot to SDLayout::bootLogPath() (bounded size)
+    bool dumpSD();
+}
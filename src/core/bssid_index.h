@@ -0,0 +1,160 @@
+// BssidIndex - Fixed-capacity open-addressing BSSID -> slot index
+// Kept alongside a flat network table so lookups don't linear-scan it.
+// Header-only, no heap, no Arduino dependencies (unit tested on native).
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+
+// Hash a 6-byte MAC. OUI bytes are low-entropy, so mix all 48 bits.
+static inline uint32_t bssidHash(const uint8_t* mac) {
+    uint32_t lo = (uint32_t)mac[2] | ((uint32_t)mac[3] << 8) |
+                  ((uint32_t)mac[4] << 16) | ((uint32_t)mac[5] << 24);
+    uint32_t hi = (uint32_t)mac[0] | ((uint32_t)mac[1] << 8);
+    uint32_t h = lo ^ (hi * 0x9E3779B1u);
+    h *= 0x85EBCA6Bu;
+    h ^= h >> 16;
+    return h;
+}
+
+/**
+ * Linear-probing hash table mapping BSSID -> table slot (uint16_t).
+ *
+ * Buckets hold the slot number plus a 16-bit hash tag, so the BSSID bytes
+ * themselves stay in the owning table. Key comparisons go through a
+ * caller-supplied accessor: keyAt(slot) -> const uint8_t* (6 bytes).
+ * Removal uses backward-shift deletion (no tombstones), so probe chains
+ * never degrade over long sessions.
+ *
+ * The owner reorders its table behind the index's back (sorts, swaps,
+ * erase + push_back at the same size): invalidate() after those, and
+ * check needsRebuild() before a lookup.
+ *
+ * SLOTS must be a power of two; keep load factor under ~50%.
+ * Not thread-safe - callers hold their own lock.
+ */
+template <uint16_t SLOTS>
+class BssidIndex {
+    static_assert(SLOTS >= 8 && SLOTS <= 32768 && (SLOTS & (SLOTS - 1)) == 0,
+                  "SLOTS must be a power of two (8..32768)");
+
+public:
+    static constexpr uint16_t kEmpty = 0xFFFF;
+    static constexpr uint16_t kMask = SLOTS - 1;
+
+    BssidIndex() { clear(); }
+
+    void clear() {
+        for (uint16_t i = 0; i < SLOTS; i++) {
+            buckets[i].slot = kEmpty;
+            buckets[i].tag = 0;
+        }
+        count = 0;
+        stale = false;
+    }
+
+    // Slot numbers no longer match the owning table
+    void invalidate() { stale = true; }
+
+    // True when the index can't be trusted for a table of n entries
+    bool needsRebuild(uint16_t n) const { return stale || count != n; }
+
+    uint16_t size() const { return count; }
+    static constexpr uint16_t capacity() { return SLOTS; }
+
+    // Returns slot for bssid, or -1 if not indexed.
+    template <typename KeyAt>
+    int find(const uint8_t* bssid, KeyAt keyAt) const {
+        uint16_t tag = tagOf(bssid);
+        uint16_t pos = (uint16_t)(tag & kMask);
+        for (uint16_t probes = 0; probes < SLOTS; probes++) {
+            const Bucket& b = buckets[pos];
+            if (b.slot == kEmpty) return -1;
+            if (b.tag == tag && memcmp(keyAt(b.slot), bssid, 6) == 0) {
+                return (int)b.slot;
+            }
+            pos = (uint16_t)((pos + 1) & kMask);
+        }
+        return -1;
+    }
+
+    // Index bssid at slot. Caller guarantees bssid is not already present.
+    // Returns false if the table is at its load limit.
+    bool insert(const uint8_t* bssid, uint16_t slot) {
+        if (slot == kEmpty || count >= maxEntries()) return false;
+        uint16_t tag = tagOf(bssid);
+        uint16_t pos = (uint16_t)(tag & kMask);
+        while (buckets[pos].slot != kEmpty) {
+            pos = (uint16_t)((pos + 1) & kMask);
+        }
+        buckets[pos].slot = slot;
+        buckets[pos].tag = tag;
+        count++;
+        return true;
+    }
+
+    // Drop the entry for bssid that points at slot. Returns false if absent.
+    bool remove(const uint8_t* bssid, uint16_t slot) {
+        uint16_t tag = tagOf(bssid);
+        uint16_t pos = (uint16_t)(tag & kMask);
+        for (uint16_t probes = 0; probes < SLOTS; probes++) {
+            const Bucket& b = buckets[pos];
+            if (b.slot == kEmpty) return false;
+            if (b.slot == slot && b.tag == tag) {
+                eraseAt(pos);
+                return true;
+            }
+            pos = (uint16_t)((pos + 1) & kMask);
+        }
+        return false;
+    }
+
+    // Re-index slots [0, n). Returns false if n exceeds the load limit
+    // (index is left empty; callers fall back to a linear scan).
+    template <typename KeyAt>
+    bool rebuild(uint16_t n, KeyAt keyAt) {
+        clear();
+        if (n > maxEntries()) return false;
+        for (uint16_t i = 0; i < n; i++) {
+            insert(keyAt(i), i);
+        }
+        return true;
+    }
+
+    // Load limit: half the buckets, keeps unsuccessful probes short.
+    static constexpr uint16_t maxEntries() { return SLOTS / 2; }
+
+private:
+    struct Bucket {
+        uint16_t slot;
+        uint16_t tag;   // Folded bssidHash; home bucket = tag & kMask
+    };
+
+    // Backward-shift deletion: pull later chain members into the hole
+    // unless their home bucket lies cyclically after it.
+    void eraseAt(uint16_t hole) {
+        uint16_t next = (uint16_t)((hole + 1) & kMask);
+        while (buckets[next].slot != kEmpty) {
+            uint16_t home = (uint16_t)(buckets[next].tag & kMask);
+            bool between = (hole <= next) ? (home > hole && home <= next)
+                                          : (home > hole || home <= next);
+            if (!between) {
+                buckets[hole] = buckets[next];
+                hole = next;
+            }
+            next = (uint16_t)((next + 1) & kMask);
+        }
+        buckets[hole].slot = kEmpty;
+        buckets[hole].tag = 0;
+        count--;
+    }
+
+    static uint16_t tagOf(const uint8_t* bssid) {
+        uint32_t h = bssidHash(bssid);
+        return (uint16_t)(h ^ (h >> 16));
+    }
+
+    Bucket buckets[SLOTS];
+    uint16_t count;
+    bool stale;
+};
@@ -0,0 +1,488 @@
+// CaptureCatalog - Persistent capture index implementation
+
+#include "capture_catalog.h"
+#include "config.h"
+#include "sd_layout.h"
+#include <SD.h>
+#include <vector>
+
+namespace CaptureCatalog {
+
+using CatalogRecord::kRecordLen;
+using CatalogRecord::kFileHeaderLen;
+
+// Records per sequential read in load()
+static const size_t LOAD_CHUNK_RECORDS = 16;
+
+// load() rewrites the file once dead records outnumber live ones
+static const size_t COMPACT_MIN_DEAD = 64;
+
+// ============================================================================
+// State
+// ============================================================================
+
+static std::vector<CatalogRecord::Slot> slots;
+static bool loaded = false;
+static File readFile;               // Opened lazily by get()
+
+static uint8_t recBuf[kRecordLen];
+static uint8_t loadBuf[kRecordLen * LOAD_CHUNK_RECORDS];
+
+// Uploaded/cracked keys, kept across release() so writers don't read the
+// catalog to carry a status forward. Filled by load() (or one scan on the
+// first write since boot) and updated by every append.
+static std::vector<CatalogRecord::StatusMark> statusMarks;
+static bool statusMarksValid = false;
+
+static bool rebuilding = false;
+static File rebuildDir;
+static std::vector<Entry> rebuildTable;
+
+// ============================================================================
+// File helpers
+// ============================================================================
+
+static void closeReader() {
+    if (readFile) readFile.close();
+}
+
+static bool writeHeader(File& f) {
+    uint8_t header[kFileHeaderLen];
+    CatalogRecord::encodeFileHeader(header);
+    return f.write(header, sizeof(header)) == sizeof(header);
+}
+
+/**
+ * Append one record. Only once the catalog exists: a capture written before
+ * the first rebuild is picked up by that rebuild instead.
+ */
+static bool appendRecord(uint8_t op, const Entry& e, uint32_t* offsetOut) {
+    const char* path = SDLayout::captureCatalogPath();
+    if (!SD.exists(path)) return false;
+    closeReader();
+    File f = SD.open(path, FILE_APPEND);
+    if (!f) return false;
+
+    // Realign after a torn record so load() keeps a fixed stride; the
+    // zero-padded remainder fails its CRC and is skipped
+    uint32_t offset = f.size();
+    if (offset < kFileHeaderLen) {
+        f.close();
+        return false;
+    }
+    uint32_t torn = (offset - kFileHeaderLen) % kRecordLen;
+    if (torn != 0) {
+        memset(recBuf, 0, sizeof(recBuf));
+        f.write(recBuf, kRecordLen - torn);
+        offset += kRecordLen - torn;
+    }
+
+    CatalogRecord::encode(recBuf, op, e);
+    bool ok = f.write(recBuf, kRecordLen) == kRecordLen;
+    f.close();
+    if (ok && statusMarksValid) CatalogRecord::foldStatus(statusMarks, op, e);
+    if (ok && offsetOut) *offsetOut = offset;
+    return ok;
+}
+
+static void capturePath(char* out, size_t len, const uint8_t* bssid, const char* suffix) {
+    snprintf(out, len, "%s/%02X%02X%02X%02X%02X%02X%s", SDLayout::handshakesDir(),
+             bssid[0], bssid[1], bssid[2], bssid[3], bssid[4], bssid[5], suffix);
+}
+
+static void statFile(const uint8_t* bssid, const char* suffix, uint8_t bit, Entry& e) {
+    char path[64];
+    capturePath(path, sizeof(path), bssid, suffix);
+    if (!SD.exists(path)) return;
+    File f = SD.open(path, FILE_READ);
+    if (!f) return;
+    if (!f.isDirectory()) {
+        CatalogRecord::mergeFile(e, bit, (uint32_t)f.size(), (uint32_t)f.getLastWrite());
+    }
+    f.close();
+}
+
+// Fill files/size/mtime from whatever capture files exist for the key
+static void statCapture(Entry& e) {
+    e.files = 0;
+    e.size = 0;
+    e.mtime = 0;
+    if (e.kind == CatalogRecord::kPmkid) {
+        statFile(e.bssid, ".22000", CatalogRecord::kFilePmkid22000, e);
+    } else {
+        statFile(e.bssid, ".pcap", CatalogRecord::kFilePcap, e);
+        statFile(e.bssid, "_hs.22000", CatalogRecord::kFileHs22000, e);
+    }
+}
+
+// First line of a companion .txt, without the line ending
+static void readSsidLine(File& f, Entry& e) {
+    char buf[CatalogRecord::kMaxSsid + 3];
+    int n = f.read((uint8_t*)buf, sizeof(buf) - 1);
+    if (n <= 0) return;
+    buf[n] = '\0';
+    size_t len = strcspn(buf, "\r\n");
+    if (len > CatalogRecord::kMaxSsid) len = CatalogRecord::kMaxSsid;
+    memcpy(e.ssid, buf, len);
+    e.ssid[len] = '\0';
+}
+
+static void readSsid(Entry& e) {
+    char path[64];
+    capturePath(path, sizeof(path), e.bssid,
+                e.kind == CatalogRecord::kPmkid ? "_pmkid.txt" : ".txt");
+    if (!SD.exists(path)) return;
+    File f = SD.open(path, FILE_READ);
+    if (!f) return;
+    readSsidLine(f, e);
+    f.close();
+}
+
+// Fold the whole catalog into statusMarks (first write since boot without
+// a load())
+static bool scanStatusMarks() {
+    const char* path = SDLayout::captureCatalogPath();
+    if (!SD.exists(path)) return false;
+    closeReader();
+    File f = SD.open(path, FILE_READ);
+    if (!f) return false;
+    statusMarks.clear();
+    bool ok = f.seek(kFileHeaderLen);
+    Entry e;
+    uint8_t op;
+    while (ok) {
+        int n = f.read(loadBuf, sizeof(loadBuf));
+        if (n <= 0) break;
+        size_t whole = (size_t)n / kRecordLen;
+        for (size_t i = 0; i < whole; i++) {
+            if (CatalogRecord::decode(loadBuf + i * kRecordLen, op, e)) {
+                CatalogRecord::foldStatus(statusMarks, op, e);
+            }
+        }
+        if ((size_t)n < sizeof(loadBuf)) break;
+        yield();
+    }
+    f.close();
+    statusMarksValid = ok;
+    return ok;
+}
+
+/**
+ * WPA-SEC status of the key's newest record, so a rewrite of its files
+ * (better handshake, PMKID added, file server upload) keeps it.
+ */
+static uint8_t currentStatus(const uint8_t* bssid, uint8_t kind) {
+    if (!statusMarksValid && !scanStatusMarks()) return CatalogRecord::kLocal;
+    return CatalogRecord::markedStatus(statusMarks, bssid, kind);
+}
+
+// ============================================================================
+// Writers
+// ============================================================================
+
+void noteSaved(const uint8_t* bssid, bool pmkid, const char* ssid) {
+    if (!bssid || !Config::isSDAvailable()) return;
+    Entry e = {};
+    memcpy(e.bssid, bssid, 6);
+    e.kind = pmkid ? CatalogRecord::kPmkid : CatalogRecord::kHandshake;
+    if (ssid) {
+        strncpy(e.ssid, ssid, CatalogRecord::kMaxSsid);
+        e.ssid[CatalogRecord::kMaxSsid] = '\0';
+    }
+    statCapture(e);
+    if (e.files) e.status = currentStatus(e.bssid, e.kind);
+    appendRecord(e.files ? CatalogRecord::kPut : CatalogRecord::kDelete, e, nullptr);
+}
+
+void notePathChanged(const char* path) {
+    if (!path || !path[0] || !Config::isSDAvailable()) return;
+    const char* dir = SDLayout::handshakesDir();
+    size_t dirLen = strlen(dir);
+    size_t pathLen = strlen(path);
+    while (pathLen > 1 && path[pathLen - 1] == '/') pathLen--;
+
+    // The handshakes dir itself or a parent of it: re-index from scratch
+    if (pathLen <= dirLen && strncmp(dir, path, pathLen) == 0 &&
+        (pathLen == dirLen || pathLen == 1 || dir[pathLen] == '/')) {
+        invalidate();
+        return;
+    }
+
+    // Only direct children of the handshakes dir are catalogued
+    if (pathLen <= dirLen + 1 || strncmp(path, dir, dirLen) != 0 || path[dirLen] != '/') return;
+    if (memchr(path + dirLen + 1, '/', pathLen - dirLen - 1) != nullptr) return;
+
+    Entry e = {};
+    uint8_t file;
+    if (!CatalogRecord::parseName(path, e.bssid, e.kind, file)) return;
+    readSsid(e);
+    statCapture(e);
+    if (e.files) e.status = currentStatus(e.bssid, e.kind);
+    appendRecord(e.files ? CatalogRecord::kPut : CatalogRecord::kDelete, e, nullptr);
+}
+
+void invalidate() {
+    abortRebuild();
+    release();
+    statusMarks.clear();
+    statusMarksValid = false;
+    if (!Config::isSDAvailable()) return;
+    const char* path = SDLayout::captureCatalogPath();
+    if (SD.exists(path)) SD.remove(path);
+}
+
+void clear() {
+    abortRebuild();
+    release();
+    statusMarks.clear();
+    statusMarksValid = false;
+    if (!Config::isSDAvailable()) return;
+    const char* path = SDLayout::captureCatalogPath();
+    if (SD.exists(path)) SD.remove(path);
+    File f = SD.open(path, FILE_WRITE);
+    if (!f) return;
+    statusMarksValid = writeHeader(f);
+    f.close();
+}
+
+// ============================================================================
+// Reader
+// ============================================================================
+
+// Rewrite just the live records, in index order
+static void compact() {
+    const char* path = SDLayout::captureCatalogPath();
+    char tmpPath[64];
+    snprintf(tmpPath, sizeof(tmpPath), "%s.tmp", path);
+    if (SD.exists(tmpPath)) SD.remove(tmpPath);
+
+    File in = SD.open(path, FILE_READ);
+    File out = SD.open(tmpPath, FILE_WRITE);
+    bool ok = in && out && writeHeader(out);
+    for (size_t i = 0; ok && i < slots.size(); i++) {
+        ok = in.seek(slots[i].offset) &&
+             in.read(recBuf, kRecordLen) == kRecordLen &&
+             out.write(recBuf, kRecordLen) == kRecordLen;
+        if ((i & 31) == 31) yield();
+    }
+    if (in) in.close();
+    if (out) out.close();
+    if (!ok) {
+        SD.remove(tmpPath);
+        return;
+    }
+    SD.remove(path);
+    if (!SD.rename(tmpPath, path)) {
+        // Catalog gone; the next listing rebuilds it
+        release();
+        return;
+    }
+    for (size_t i = 0; i < slots.size(); i++) {
+        slots[i].offset = kFileHeaderLen + (uint32_t)(i * kRecordLen);
+    }
+    Serial.printf("[CATALOG] Compacted to %u captures\n", (unsigned)slots.size());
+}
+
+bool load() {
+    release();
+    statusMarksValid = false;
+    if (!Config::isSDAvailable()) return false;
+    const char* path = SDLayout::captureCatalogPath();
+    if (!SD.exists(path)) return false;
+    File f = SD.open(path, FILE_READ);
+    if (!f) return false;
+
+    uint8_t header[kFileHeaderLen];
+    if (f.read(header, sizeof(header)) != sizeof(header) || !CatalogRecord::checkFileHeader(header)) {
+        f.close();
+        Serial.println("[CATALOG] Bad header, needs rebuild");
+        return false;
+    }
+
+    uint32_t fileSize = f.size();
+    slots.reserve((fileSize - kFileHeaderLen) / kRecordLen);
+
+    // One sequential pass; a torn tail record is simply not counted
+    statusMarks.clear();
+    uint32_t offset = kFileHeaderLen;
+    size_t bad = 0;
+    Entry e;
+    uint8_t op;
+    while (true) {
+        int n = f.read(loadBuf, sizeof(loadBuf));
+        if (n <= 0) break;
+        size_t whole = (size_t)n / kRecordLen;
+        for (size_t i = 0; i < whole; i++) {
+            if (CatalogRecord::decode(loadBuf + i * kRecordLen, op, e)) {
+                slots.push_back(CatalogRecord::makeSlot(op, e, offset));
+                CatalogRecord::foldStatus(statusMarks, op, e);
+            } else {
+                bad++;
+            }
+            offset += kRecordLen;
+        }
+        if ((size_t)n < sizeof(loadBuf)) break;
+        yield();
+    }
+    f.close();
+
+    size_t dead = CatalogRecord::finalize(slots) + bad;
+    loaded = true;
+    statusMarksValid = true;
+    Serial.printf("[CATALOG] Loaded %u captures (%u dead records)\n",
+                  (unsigned)slots.size(), (unsigned)dead);
+    if (dead >= COMPACT_MIN_DEAD && dead > slots.size()) {
+        compact();
+    }
+    return loaded;
+}
+
+static void finishRebuild() {
+    if (rebuildDir) rebuildDir.close();
+    rebuilding = false;
+
+    const char* path = SDLayout::captureCatalogPath();
+    char tmpPath[64];
+    snprintf(tmpPath, sizeof(tmpPath), "%s.tmp", path);
+    if (SD.exists(tmpPath)) SD.remove(tmpPath);
+
+    File out = SD.open(tmpPath, FILE_WRITE);
+    bool ok = out && writeHeader(out);
+    size_t written = 0;
+    for (size_t i = 0; ok && i < rebuildTable.size(); i++) {
+        const Entry& e = rebuildTable[i];
+        if (e.files == 0) continue;     // SSID file without a capture
+        CatalogRecord::encode(recBuf, CatalogRecord::kPut, e);
+        ok = out.write(recBuf, kRecordLen) == kRecordLen;
+        written++;
+    }
+    if (out) out.close();
+    rebuildTable.clear();
+    rebuildTable.shrink_to_fit();
+
+    if (!ok) {
+        SD.remove(tmpPath);
+        Serial.println("[CATALOG] Rebuild write failed");
+        return;
+    }
+    if (SD.exists(path)) SD.remove(path);
+    if (!SD.rename(tmpPath, path)) {
+        Serial.println("[CATALOG] Rebuild rename failed");
+        return;
+    }
+    Serial.printf("[CATALOG] Rebuilt from directory: %u captures\n", (unsigned)written);
+    load();
+}
+
+bool beginRebuild() {
+    abortRebuild();
+    release();
+    if (!Config::isSDAvailable()) return false;
+
+    const char* handshakesDir = SDLayout::handshakesDir();
+    if (!SD.exists(handshakesDir)) {
+        clear();
+        return load();
+    }
+    rebuildDir = SD.open(handshakesDir);
+    if (!rebuildDir || !rebuildDir.isDirectory()) {
+        if (rebuildDir) rebuildDir.close();
+        return false;
+    }
+    rebuildTable.clear();
+    rebuilding = true;
+    return true;
+}
+
+bool rebuildStep(size_t maxFiles) {
+    if (!rebuilding) return true;
+    for (size_t n = 0; n < maxFiles; n++) {
+        File file = rebuildDir.openNextFile();
+        if (!file) {
+            finishRebuild();
+            return true;
+        }
+        uint8_t bssid[6];
+        uint8_t kind;
+        uint8_t bit;
+        if (!file.isDirectory() && CatalogRecord::parseName(file.name(), bssid, kind, bit)) {
+            Entry& e = CatalogRecord::findOrInsert(rebuildTable, bssid, kind);
+            if (bit == CatalogRecord::kFileSsid) {
+                readSsidLine(file, e);
+            } else {
+                CatalogRecord::mergeFile(e, bit, (uint32_t)file.size(), (uint32_t)file.getLastWrite());
+            }
+        }
+        // Always close to avoid exhausting SD file descriptors
+        file.close();
+    }
+    return false;
+}
+
+bool isRebuilding() {
+    return rebuilding;
+}
+
+void abortRebuild() {
+    if (rebuildDir) rebuildDir.close();
+    rebuilding = false;
+    rebuildTable.clear();
+    rebuildTable.shrink_to_fit();
+}
+
+size_t count() {
+    return loaded ? slots.size() : 0;
+}
+
+bool peek(size_t index, uint8_t* bssid, uint8_t& kind, uint8_t& status) {
+    if (!loaded || index >= slots.size()) return false;
+    memcpy(bssid, slots[index].bssid, 6);
+    kind = slots[index].kind;
+    status = slots[index].status;
+    return true;
+}
+
+bool get(size_t index, Entry& out) {
+    if (!loaded || index >= slots.size()) return false;
+    if (!readFile) {
+        readFile = SD.open(SDLayout::captureCatalogPath(), FILE_READ);
+        if (!readFile) return false;
+    }
+    uint8_t op;
+    return readFile.seek(slots[index].offset) &&
+           readFile.read(recBuf, kRecordLen) == kRecordLen &&
+           CatalogRecord::decode(recBuf, op, out);
+}
+
+bool setStatus(size_t index, uint8_t status) {
+    Entry e;
+    if (!get(index, e)) return false;
+    if (e.status == status) return true;
+    e.status = status;
+    uint32_t offset;
+    if (!appendRecord(CatalogRecord::kPut, e, &offset)) return false;
+    slots[index].offset = offset;
+    slots[index].status = status;
+    return true;
+}
+
+void summary(Summary& out) {
+    memset(&out, 0, sizeof(out));
+    if (!loaded) return;
+    for (const auto& s : slots) {
+        out.total++;
+        if (s.kind == CatalogRecord::kPmkid) out.pmkids++;
+        else out.handshakes++;
+        if (s.status == CatalogRecord::kCracked) out.cracked++;
+        else if (s.status == CatalogRecord::kUploaded) out.uploaded++;
+    }
+}
+
+void release() {
+    closeReader();
+    slots.clear();
+    slots.shrink_to_fit();
+    loaded = false;
+}
+
+}  // namespace CaptureCatalog
@@ -0,0 +1,87 @@
+// CaptureCatalog - Persistent index of the handshakes directory
+// Every capture writer and the file server's delete/rename/move/upload
+// handlers append a record here, so the LOOT menu lists captures from one
+// sequential read instead of walking the directory and opening a .txt per
+// entry. A missing or unreadable catalog is rebuilt from the directory.
+#pragma once
+
+#include <Arduino.h>
+#include "catalog_record.h"
+
+namespace CaptureCatalog {
+
+using Entry = CatalogRecord::Entry;
+
+struct Summary {
+    uint16_t total;
+    uint16_t handshakes;
+    uint16_t pmkids;
+    uint16_t cracked;
+    uint16_t uploaded;
+};
+
+// ============================================================================
+// Writers - main loop, any mode
+// ============================================================================
+
+/**
+ * @brief Record a capture a mode just wrote (.pcap/_hs.22000 or .22000)
+ * Stats the capture files for size and time; the SSID is what the mode
+ * wrote to the companion .txt. No-op until the catalog has been built.
+ */
+void noteSaved(const uint8_t* bssid, bool pmkid, const char* ssid);
+
+/**
+ * @brief Re-stat whatever capture a changed path belongs to
+ * For the file server: call with every deleted, uploaded, renamed or moved
+ * path (both ends of a rename/move). A path that contains the handshakes
+ * directory drops the catalog so the next listing rebuilds it.
+ */
+void notePathChanged(const char* path);
+
+// Drop the catalog; the next load() reports it needs a rebuild
+void invalidate();
+
+// Replace the catalog with an empty one (loot nuked)
+void clear();
+
+// ============================================================================
+// Reader - LOOT menu
+// ============================================================================
+
+/**
+ * @brief Load the catalog into the RAM index (one sequential read)
+ * Compacts the file when superseded records outnumber live ones.
+ * @return false if there is no valid catalog - call beginRebuild()
+ */
+bool load();
+
+/**
+ * @brief Rebuild the catalog from the handshakes directory
+ * rebuildStep() handles up to maxFiles directory entries per call so the
+ * UI stays responsive; it returns true once the catalog is written and
+ * loaded (or the rebuild failed, leaving count() at 0).
+ */
+bool beginRebuild();
+bool rebuildStep(size_t maxFiles);
+bool isRebuilding();
+void abortRebuild();
+
+// Loaded captures, newest first
+size_t count();
+
+// Key and status from the RAM index (no SD access)
+bool peek(size_t index, uint8_t* bssid, uint8_t& kind, uint8_t& status);
+
+// Full record, read from SD by offset
+bool get(size_t index, Entry& out);
+
+// Persist a new WPA-SEC status for a loaded capture
+bool setStatus(size_t index, uint8_t status);
+
+void summary(Summary& out);
+
+// Free the RAM index and close the catalog file
+void release();
+
+}  // namespace CaptureCatalog
@@ -0,0 +1,595 @@
+// CaptureJournal - Append-only capture journal implementation
+
+#include "capture_journal.h"
+#include "journal_record.h"
+#include "journal_replay.h"
+#include "capture_catalog.h"
+#include "config.h"
+#include "sd_layout.h"
+#include "sdlog.h"
+#include "heap_policy.h"
+#include "log_ring.h"
+#include "network_recon.h"
+#include "../modes/oink.h"
+#include <SD.h>
+#include <esp_heap_caps.h>
+#include <esp_random.h>
+#include <time.h>
+#include <atomic>
+
+namespace CaptureJournal {
+
+// ============================================================================
+// Tuning
+// ============================================================================
+
+// A burst of four handshakes with beacons is ~10KB; the writer drains
+// every WRITER_POLL_MS so this only fills on a stalled card
+static const uint32_t RING_BYTES_INTERNAL = 16 * 1024;
+static const uint32_t RING_BYTES_PSRAM = 64 * 1024;
+
+static const uint32_t SECTOR_BYTES = 512;
+static const uint32_t WRITER_POLL_MS = 100;
+static const uint32_t SYNC_INTERVAL_MS = 1000;   // Bound on what a power cut can lose
+static const uint32_t WRITER_STOP_TIMEOUT_MS = 2000;
+
+// Records journaled per sweep() call (main loop budget)
+static const uint8_t SWEEP_RECORDS_PER_CALL = 8;
+
+// begin() replays + compacts first when the journal has grown past this
+static const uint32_t COMPACT_BYTES = 256UL * 1024UL;
+
+// ============================================================================
+// State
+// ============================================================================
+
+static bool active = false;
+static LogRing ring;
+static uint8_t* ringStorage = nullptr;
+static uint8_t sectorBuf[SECTOR_BYTES];
+
+// Main-loop producer scratch (sweep/markExported)
+static uint8_t record[JournalRecord::kMaxRecord];
+static HandshakeFrames frameCopy;
+
+static TaskHandle_t writerHandle = NULL;
+static std::atomic<bool> stopRequested{false};
+static std::atomic<bool> writerExited{true};
+
+static File journalFile;
+static uint32_t bytesWritten = 0;
+static uint32_t writeErrors = 0;
+static uint32_t deferred = 0;
+static Stats lastStats = {};  // Final counters of the previous session
+static Stats recoveryStats = {};
+
+// ============================================================================
+// Writer (low-priority task)
+// ============================================================================
+
+static bool writeChunk() {
+    uint32_t n = ring.copyOut(sectorBuf, SECTOR_BYTES);
+    if (n == 0) return false;
+    if (journalFile) {
+        size_t w = journalFile.write(sectorBuf, n);
+        if (w != n) writeErrors++;
+        bytesWritten += (uint32_t)w;
+    } else {
+        writeErrors++;
+    }
+    ring.consume(n);   // Consumed even on error: a dead card must not wedge producers
+    return true;
+}
+
+static void writerTask(void* param) {
+    (void)param;
+    uint32_t lastSyncMs = millis();
+    bool unsynced = false;
+
+    while (!stopRequested.load(std::memory_order_acquire)) {
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(WRITER_POLL_MS));
+        while (writeChunk()) {
+            unsynced = true;
+        }
+        uint32_t now = millis();
+        if (unsynced && now - lastSyncMs >= SYNC_INTERVAL_MS) {
+            if (journalFile) journalFile.flush();
+            lastSyncMs = now;
+            unsynced = false;
+        }
+    }
+
+    while (writeChunk()) {}
+    if (journalFile) journalFile.close();
+    writerExited.store(true, std::memory_order_release);
+    vTaskDelete(NULL);
+}
+
+static void freeRing() {
+    ring.attach(nullptr, 0);
+    if (ringStorage) {
+        heap_caps_free(ringStorage);
+        ringStorage = nullptr;
+    }
+}
+
+// Main loop only (single producer)
+static bool push(const uint8_t* data, size_t len) {
+    if (!active || len == 0) return false;
+    if (!ring.append((const char*)data, (uint32_t)len)) {
+        deferred++;
+        return false;
+    }
+    return true;
+}
+
+// ============================================================================
+// Sweep (main loop)
+// ============================================================================
+
+enum class SweepResult : uint8_t { NOTHING, WROTE, RING_FULL };
+
+// Journal the next outstanding frame/SSID/beacon of one handshake. The bit
+// is claimed under the lock; a storeFrame() racing in from the callback
+// clears it again so the newer copy is journaled on the next pass.
+static SweepResult sweepHandshake(CapturedHandshake& hs) {
+    uint8_t bssid[6];
+    uint8_t station[6];
+    char ssid[33] = {0};
+    uint8_t bit = 0;
+    uint8_t idx = 0;
+
+    NetworkRecon::enterCritical();
+    uint8_t pending = hs.capturedMask & ~hs.journaledMask & JOURNALED_FRAMES;
+    memcpy(bssid, hs.bssid, 6);
+    memcpy(station, hs.station, 6);
+    if (pending) {
+        while (!(pending & (1 << idx))) idx++;
+        bit = (uint8_t)(1 << idx);
+        frameCopy.clear();
+        frameCopy.copyFrom(hs.frames, idx);
+    } else if (hs.ssid[0] != 0 && !(hs.journaledMask & JOURNALED_SSID)) {
+        bit = JOURNALED_SSID;
+        memcpy(ssid, hs.ssid, 32);
+    } else if (hs.hasBeacon() && !(hs.journaledMask & JOURNALED_BEACON)) {
+        bit = JOURNALED_BEACON;
+    }
+    hs.journaledMask |= bit;
+    NetworkRecon::exitCritical();
+    if (bit == 0) return SweepResult::NOTHING;
+
+    size_t n;
+    if (bit == JOURNALED_SSID) {
+        n = JournalRecord::encodeSsid(record, sizeof(record), bssid, ssid);
+    } else if (bit == JOURNALED_BEACON) {
+        // beaconData is owned by the main loop, no lock needed
+        n = JournalRecord::encodeBeacon(record, sizeof(record), bssid, hs.beaconData, hs.beaconLen);
+    } else {
+        EapolFrameView f = frameCopy[idx];
+        n = JournalRecord::encodeEapol(record, sizeof(record), bssid, station, idx, f.rssi,
+                                       f.timestamp, f.data, f.len, f.fullFrame, f.fullFrameLen);
+    }
+    if (n == 0) return SweepResult::WROTE;   // Unencodable - leave it claimed
+    if (!push(record, n)) {
+        NetworkRecon::enterCritical();
+        hs.journaledMask &= (uint8_t)~bit;
+        NetworkRecon::exitCritical();
+        return SweepResult::RING_FULL;
+    }
+    return SweepResult::WROTE;
+}
+
+static bool isZeroPMKID(const uint8_t* pmkid) {
+    for (int i = 0; i < 16; i++) {
+        if (pmkid[i] != 0) return false;
+    }
+    return true;
+}
+
+static SweepResult sweepPMKID(CapturedPMKID& p) {
+    CapturedPMKID copy;
+    uint8_t bits = 0;
+
+    NetworkRecon::enterCritical();
+    if (!(p.journaled & JOURNALED_PMKID) && !isZeroPMKID(p.pmkid)) {
+        bits = JOURNALED_PMKID;
+        if (p.ssid[0] != 0) bits |= JOURNALED_PMKID_SSID;
+    } else if ((p.journaled & JOURNALED_PMKID) && p.ssid[0] != 0 &&
+               !(p.journaled & JOURNALED_PMKID_SSID)) {
+        bits = JOURNALED_PMKID_SSID;   // SSID backfilled after the PMKID
+    }
+    if (bits) {
+        copy = p;
+        copy.ssid[32] = 0;
+        p.journaled |= bits;
+    }
+    NetworkRecon::exitCritical();
+    if (bits == 0) return SweepResult::NOTHING;
+
+    size_t n = (bits & JOURNALED_PMKID)
+        ? JournalRecord::encodePmkid(record, sizeof(record), copy.bssid, copy.station,
+                                     copy.pmkid, copy.timestamp, copy.ssid)
+        : JournalRecord::encodeSsid(record, sizeof(record), copy.bssid, copy.ssid);
+    if (n == 0) return SweepResult::WROTE;
+    if (!push(record, n)) {
+        NetworkRecon::enterCritical();
+        p.journaled &= (uint8_t)~bits;
+        NetworkRecon::exitCritical();
+        return SweepResult::RING_FULL;
+    }
+    return SweepResult::WROTE;
+}
+
+bool sweep(std::vector<CapturedHandshake>& handshakes, std::vector<CapturedPMKID>& pmkids) {
+    if (!active) return true;
+    uint8_t budget = SWEEP_RECORDS_PER_CALL;
+
+    // Only the main loop resizes these vectors, so indexing is stable here
+    for (size_t i = 0; i < pmkids.size(); i++) {
+        if (budget == 0) return false;
+        SweepResult r = sweepPMKID(pmkids[i]);
+        if (r == SweepResult::RING_FULL) return false;
+        if (r == SweepResult::WROTE) budget--;
+    }
+    for (size_t i = 0; i < handshakes.size(); i++) {
+        SweepResult r;
+        do {
+            if (budget == 0) return false;
+            r = sweepHandshake(handshakes[i]);
+            if (r == SweepResult::RING_FULL) return false;
+            if (r == SweepResult::WROTE) budget--;
+        } while (r == SweepResult::WROTE);
+    }
+    return true;
+}
+
+void markExported(const uint8_t* bssid, const uint8_t* station, bool pmkid) {
+    if (!active) return;
+    size_t n = JournalRecord::encodeExported(record, sizeof(record), bssid, station,
+        pmkid ? JournalRecord::kKindPmkid : JournalRecord::kKindHandshake);
+    push(record, n);   // A lost marker only means recovery re-checks the files
+}
+
+int evictableHandshake(const std::vector<CapturedHandshake>& handshakes) {
+    if (!active) return -1;
+    int best = -1;
+    for (int i = 0; i < (int)handshakes.size(); i++) {
+        const CapturedHandshake& hs = handshakes[i];
+        if (!hs.saved) continue;
+        if (hs.capturedMask & ~hs.journaledMask & JOURNALED_FRAMES) continue;
+        if (best < 0 || (int32_t)(hs.lastSeen - handshakes[best].lastSeen) < 0) {
+            best = i;
+        }
+    }
+    return best;
+}
+
+// ============================================================================
+// Recovery (boot / begin, blocking)
+// ============================================================================
+
+// Stream every record of the journal through fn(record)
+template <typename Fn>
+static bool scanJournal(const char* path, uint8_t* window, size_t windowLen, Fn fn) {
+    File f = SD.open(path, FILE_READ);
+    if (!f) return false;
+    auto scanner = JournalRecord::makeScanner(window, windowLen,
+        [&f](uint8_t* dst, size_t max) -> size_t {
+            int n = f.read(dst, max);
+            return n > 0 ? (size_t)n : 0;
+        });
+    JournalRecord::Record r;
+    bool ok = true;
+    while (ok && scanner.next(r)) {
+        ok = fn(r);
+    }
+    recoveryStats.corruptBytes = scanner.skippedBytes() + scanner.tailBytes();
+    f.close();
+    return ok;
+}
+
+static void bssidPath(char* out, size_t len, const uint8_t* bssid, const char* suffix) {
+    snprintf(out, len, "%s/%02X%02X%02X%02X%02X%02X%s", SDLayout::handshakesDir(),
+             bssid[0], bssid[1], bssid[2], bssid[3], bssid[4], bssid[5], suffix);
+}
+
+static void writeSsidTxt(const uint8_t* bssid, const char* suffix, const char* ssid) {
+    char path[64];
+    bssidPath(path, sizeof(path), bssid, suffix);
+    if (SD.exists(path)) SD.remove(path);
+    File f = SD.open(path, FILE_WRITE);
+    if (f) {
+        f.println(ssid);
+        f.close();
+    }
+}
+
+// The OINK exporters take a CapturedHandshake; converted one at a time
+// into static storage rather than onto the stack
+static CapturedHandshake exportCopy;
+
+static const CapturedHandshake& toCaptured(const JournalReplay::Handshake& h) {
+    exportCopy = {};
+    memcpy(exportCopy.bssid, h.bssid, 6);
+    memcpy(exportCopy.station, h.station, 6);
+    memcpy(exportCopy.ssid, h.ssid, sizeof(exportCopy.ssid));
+    exportCopy.frames = h.frames;
+    exportCopy.capturedMask = h.frames.mask();
+    exportCopy.firstSeen = h.lastSeen;
+    exportCopy.lastSeen = h.lastSeen;
+    exportCopy.beaconData = h.beacon.empty() ? nullptr : const_cast<uint8_t*>(h.beacon.data());
+    exportCopy.beaconLen = (uint16_t)h.beacon.size();
+    return exportCopy;
+}
+
+// Same files autoSaveCheck() writes. A BSSID that already has its files
+// was saved by a later capture; don't overwrite it with an older one.
+static bool exportHandshake(const CapturedHandshake& hs, bool& written) {
+    char pcapPath[64];
+    char hsPath[64];
+    bssidPath(pcapPath, sizeof(pcapPath), hs.bssid, ".pcap");
+    bssidPath(hsPath, sizeof(hsPath), hs.bssid, "_hs.22000");
+    written = false;
+    if (SD.exists(hsPath) || SD.exists(pcapPath)) return true;
+
+    bool pcapOk = OinkMode::saveHandshakePCAP(hs, pcapPath);
+    bool hs22kOk = OinkMode::saveHandshake22000(hs, hsPath);
+    if (!pcapOk && !hs22kOk) return false;
+    writeSsidTxt(hs.bssid, ".txt", hs.ssid);
+    CaptureCatalog::noteSaved(hs.bssid, false, hs.ssid);
+    written = true;
+    return true;
+}
+
+// No crackable pair, but the MIC frames are still worth a PCAP for manual
+// work. Not catalogued; any real capture for the BSSID wins.
+static bool exportPartial(const CapturedHandshake& hs, bool& written) {
+    char pcapPath[64];
+    char partialPath[64];
+    char hsPath[64];
+    bssidPath(pcapPath, sizeof(pcapPath), hs.bssid, ".pcap");
+    bssidPath(partialPath, sizeof(partialPath), hs.bssid, "_partial.pcap");
+    bssidPath(hsPath, sizeof(hsPath), hs.bssid, "_hs.22000");
+    written = false;
+    if (SD.exists(hsPath) || SD.exists(pcapPath) || SD.exists(partialPath)) return true;
+    if (!OinkMode::saveHandshakePCAP(hs, partialPath)) return false;
+    written = true;
+    return true;
+}
+
+static bool exportPMKID(const CapturedPMKID& p, bool& written) {
+    char path[64];
+    bssidPath(path, sizeof(path), p.bssid, ".22000");
+    written = false;
+    if (SD.exists(path)) return true;
+    if (!OinkMode::savePMKID22000(p, path)) return false;
+    writeSsidTxt(p.bssid, "_pmkid.txt", p.ssid);
+    CaptureCatalog::noteSaved(p.bssid, true, p.ssid);
+    written = true;
+    return true;
+}
+
+void recover() {
+    if (!Config::isSDAvailable() || active) return;
+    const char* path = SDLayout::captureJournalPath();
+    if (!SD.exists(path)) return;
+
+    const size_t windowLen = 2 * JournalRecord::kMaxRecord;
+    uint8_t* window = (uint8_t*)malloc(windowLen);
+    if (!window) return;
+
+    recoveryStats = {};
+    JournalReplay::Replay replay;
+
+    // Pass 1: export markers, SSIDs and which frames every exchange has
+    scanJournal(path, window, windowLen, [&](const JournalRecord::Record& r) {
+        replay.index(r);
+        return true;
+    });
+    replay.decide();
+
+    // Pass 2: rebuild what this pass exports
+    scanJournal(path, window, windowLen, [&](const JournalRecord::Record& r) {
+        replay.collect(r, ESP.getFreeHeap() >= HeapPolicy::kMinHeapForHandshakeAdd);
+        return true;
+    });
+    replay.resolve();
+
+    const char* handshakesDir = SDLayout::handshakesDir();
+    if (!SD.exists(handshakesDir)) SD.mkdir(handshakesDir);
+
+    // Export, appending a marker per capture so an interrupted recovery
+    // never writes the same capture twice
+    File marks = SD.open(path, FILE_APPEND);
+    auto mark = [&](const uint8_t* bssid, const uint8_t* station, uint8_t kind) {
+        if (!marks) return;
+        size_t n = JournalRecord::encodeExported(record, sizeof(record), bssid, station, kind);
+        marks.write(record, n);
+    };
+
+    for (auto& h : replay.handshakes()) {
+        const CapturedHandshake& hs = toCaptured(h);
+        bool written;
+        bool ok = h.partial ? exportPartial(hs, written) : exportHandshake(hs, written);
+        replay.finished(h, ok);
+        if (!ok) continue;
+        if (written && h.partial) recoveryStats.recoveredPartial++;
+        else if (written) recoveryStats.recoveredHandshakes++;
+        mark(h.bssid, h.station, JournalRecord::kKindHandshake);
+        delay(1);
+    }
+
+    for (auto& rp : replay.pmkids()) {
+        CapturedPMKID p = {};
+        memcpy(p.bssid, rp.bssid, 6);
+        memcpy(p.station, rp.station, 6);
+        memcpy(p.pmkid, rp.pmkid, 16);
+        memcpy(p.ssid, rp.ssid, sizeof(p.ssid));
+        p.timestamp = rp.timestamp;
+        bool written;
+        bool ok = exportPMKID(p, written);
+        replay.finished(rp, ok);
+        if (!ok) continue;
+        if (written) recoveryStats.recoveredPMKIDs++;
+        mark(p.bssid, p.station, JournalRecord::kKindPmkid);
+        delay(1);
+    }
+    if (marks) marks.close();
+
+    // Pass 3: the journal keeps only what is still undecided (failed
+    // exports, PMKIDs waiting for an SSID, whatever didn't fit this pass)
+    char tmpPath[72];
+    snprintf(tmpPath, sizeof(tmpPath), "%s.tmp", path);
+    if (SD.exists(tmpPath)) SD.remove(tmpPath);
+    File out = SD.open(tmpPath, FILE_WRITE);
+    bool compacted = false;
+    if (out) {
+        auto write = [&out](const uint8_t* bytes, size_t len) {
+            return out.write(bytes, len) == len;
+        };
+        compacted = scanJournal(path, window, windowLen, [&](const JournalRecord::Record& r) {
+            return replay.compact(r, write);
+        });
+        out.close();
+    }
+    free(window);
+    if (!compacted) {
+        // The old journal (with its new markers) stays for the next pass
+        writeErrors++;
+        SD.remove(tmpPath);
+    } else if (replay.keptRecords() == 0) {
+        SD.remove(tmpPath);
+        SD.remove(path);
+    } else {
+        SD.remove(path);
+        SD.rename(tmpPath, path);
+    }
+
+    const JournalReplay::Counts& c = replay.getCounts();
+    recoveryStats.discardedPartial = c.droppedM1Only;
+    SDLog::log("JOURNAL", "Recovered %u handshakes, %u partial, %u PMKIDs (%u M1-only dropped, %u waiting for SSID, %u bad bytes)%s",
+               (unsigned)recoveryStats.recoveredHandshakes, (unsigned)recoveryStats.recoveredPartial,
+               (unsigned)recoveryStats.recoveredPMKIDs, (unsigned)c.droppedM1Only,
+               (unsigned)c.waitingPmkids, (unsigned)recoveryStats.corruptBytes,
+               replay.morePending() ? " - more pending" : "");
+}
+
+// ============================================================================
+// Public API
+// ============================================================================
+
+static void liveStats(Stats& out) {
+    out.records = ring.pushed();
+    out.dropped = deferred;
+    out.bytesWritten = bytesWritten;
+    out.writeErrors = writeErrors;
+    out.ringSize = ring.capacity();
+    out.ringHighWater = ring.highWater();
+}
+
+bool begin() {
+    if (active) return true;
+    if (!Config::isSDAvailable()) return false;
+
+    const char* path = SDLayout::captureJournalPath();
+    File existing = SD.open(path, FILE_READ);
+    if (existing) {
+        uint32_t size = (uint32_t)existing.size();
+        existing.close();
+        if (size >= COMPACT_BYTES) recover();
+    }
+
+    uint32_t ringBytes = 0;
+    if (psramFound()) {
+        ringStorage = (uint8_t*)heap_caps_malloc(RING_BYTES_PSRAM, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+        if (ringStorage) ringBytes = RING_BYTES_PSRAM;
+    }
+    if (!ringStorage && ESP.getFreeHeap() >= RING_BYTES_INTERNAL + HeapPolicy::kMinHeapForCaptureJournal) {
+        ringStorage = (uint8_t*)heap_caps_malloc(RING_BYTES_INTERNAL, MALLOC_CAP_8BIT);
+        if (ringStorage) ringBytes = RING_BYTES_INTERNAL;
+    }
+    if (!ringStorage) {
+        Serial.println("[JOURNAL] Ring allocation failed - journaling off");
+        return false;
+    }
+
+    journalFile = SD.open(path, FILE_APPEND);
+    if (!journalFile) {
+        Serial.printf("[JOURNAL] Failed to open: %s\n", path);
+        writeErrors++;
+        freeRing();
+        return false;
+    }
+
+    ring.attach(ringStorage, ringBytes);
+    bytesWritten = 0;
+    writeErrors = 0;
+    deferred = 0;
+    active = true;
+
+    size_t n = JournalRecord::encodeSession(record, sizeof(record), esp_random(), (uint32_t)time(nullptr));
+    push(record, n);
+
+    stopRequested.store(false, std::memory_order_release);
+    writerExited.store(false, std::memory_order_release);
+    xTaskCreatePinnedToCore(
+        writerTask,         // Function
+        "capJournal",       // Name
+        4096,               // Stack size
+        NULL,               // Parameters
+        1,                  // Priority (low)
+        &writerHandle,      // Task handle
+        0                   // Run on core 0 (main loop is on core 1)
+    );
+    if (writerHandle == NULL) {
+        Serial.println("[JOURNAL] Writer task creation failed");
+        active = false;
+        writerExited.store(true, std::memory_order_release);
+        journalFile.close();
+        freeRing();
+        return false;
+    }
+    Serial.printf("[JOURNAL] %s (ring %u bytes)\n", path, (unsigned)ringBytes);
+    return true;
+}
+
+void end() {
+    if (!active) return;
+    active = false;   // No new records
+
+    stopRequested.store(true, std::memory_order_release);
+    xTaskNotifyGive(writerHandle);
+    uint32_t waitStart = millis();
+    while (!writerExited.load(std::memory_order_acquire) &&
+           millis() - waitStart < WRITER_STOP_TIMEOUT_MS) {
+        vTaskDelay(pdMS_TO_TICKS(10));
+    }
+    if (!writerExited.load(std::memory_order_acquire)) {
+        Serial.println("[JOURNAL] Writer did not exit - forcing");
+        vTaskDelete(writerHandle);
+        if (journalFile) journalFile.close();
+    }
+    writerHandle = NULL;
+
+    liveStats(lastStats);
+    freeRing();
+}
+
+bool isActive() {
+    return active;
+}
+
+void getStats(Stats& out) {
+    if (active) {
+        liveStats(out);
+    } else {
+        out = lastStats;
+    }
+    out.recoveredHandshakes = recoveryStats.recoveredHandshakes;
+    out.recoveredPMKIDs = recoveryStats.recoveredPMKIDs;
+    out.recoveredPartial = recoveryStats.recoveredPartial;
+    out.discardedPartial = recoveryStats.discardedPartial;
+    out.corruptBytes = recoveryStats.corruptBytes;
+}
+
+}  // namespace CaptureJournal
@@ -0,0 +1,90 @@
+// CaptureJournal - Append-only, CRC-checked journal of captured EAPOL/PMKIDs
+// OINK and DNH journal every frame the moment it leaves the promiscuous
+// callback, so a crash or brownout no longer loses what was only in RAM and
+// saved handshakes can be evicted from RAM once their bytes are on SD.
+// A low-priority writer task drains a RAM ring to the journal file; boot-time
+// recovery exports anything never written as .22000/.pcap and compacts it.
+#pragma once
+
+#include <Arduino.h>
+#include <vector>
+
+struct CapturedHandshake;
+struct CapturedPMKID;
+
+namespace CaptureJournal {
+
+// CapturedHandshake::journaledMask bits (0-3 are the M1-M4 frames)
+static const uint8_t JOURNALED_FRAMES = 0x0F;
+static const uint8_t JOURNALED_SSID = 0x10;
+static const uint8_t JOURNALED_BEACON = 0x20;
+
+// CapturedPMKID::journaled bits
+static const uint8_t JOURNALED_PMKID = 0x01;
+static const uint8_t JOURNALED_PMKID_SSID = 0x02;
+
+struct Stats {
+    uint32_t records;       // Records accepted into the ring
+    uint32_t dropped;       // Records deferred by a full ring (retried)
+    uint32_t bytesWritten;  // Journal bytes written to SD
+    uint32_t writeErrors;   // Short writes / failed opens
+    uint32_t ringSize;
+    uint32_t ringHighWater;
+    // Last recovery pass
+    uint32_t recoveredHandshakes;   // Exported from the journal
+    uint32_t recoveredPMKIDs;
+    uint32_t recoveredPartial;      // No crackable pair, saved as _partial.pcap
+    uint32_t discardedPartial;      // M1-only exchanges dropped
+    uint32_t corruptBytes;          // Skipped or torn bytes
+};
+
+/**
+ * @brief Open the journal and start the writer (OINK/DNH start)
+ * Writes a session marker so frames only pair within one session.
+ * Compacts first if the previous sessions left a large journal.
+ * @return true if journaling is active
+ */
+bool begin();
+
+/**
+ * @brief Drain the ring, close the file, free buffers (OINK/DNH stop)
+ * Call after the mode's final saves so their export markers are kept.
+ */
+void end();
+
+bool isActive();
+
+/**
+ * @brief Journal frames, SSIDs, beacons and PMKIDs not yet on SD
+ * Main loop only. Does a bounded amount of work per call; whatever the
+ * ring can't take is retried on the next call.
+ * @return true when nothing is left to journal
+ */
+bool sweep(std::vector<CapturedHandshake>& handshakes, std::vector<CapturedPMKID>& pmkids);
+
+/**
+ * @brief Record that a capture reached its .22000/.pcap files
+ * @param pmkid true for a PMKID export, false for a handshake
+ */
+void markExported(const uint8_t* bssid, const uint8_t* station, bool pmkid);
+
+/**
+ * @brief Oldest saved handshake whose frames are all journaled, or -1
+ * Modes evict it at their RAM cap instead of refusing new captures.
+ */
+int evictableHandshake(const std::vector<CapturedHandshake>& handshakes);
+
+/**
+ * @brief Replay the journal: export unsaved captures, then compact
+ * Called at boot before any mode starts. Complete handshakes and PMKIDs
+ * that never reached their files are written with the OINK exporters;
+ * incomplete ones with a MIC frame go to <BSSID>_partial.pcap and M1-only
+ * exchanges are dropped. The journal is always compacted down to what is
+ * still undecided: PMKIDs missing an SSID, failed exports, and whatever
+ * didn't fit this pass's RAM bounds.
+ */
+void recover();
+
+void getStats(Stats& out);
+
+}  // namespace CaptureJournal
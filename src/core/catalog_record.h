@@ -0,0 +1,306 @@
+// CatalogRecord - Record format of the capture catalog
+// One fixed-size, CRC-checked record per capture (BSSID + handshake/PMKID),
+// appended whenever a writer or the file server touches the handshakes
+// directory. The newest record for a key wins; a delete record drops it.
+// The LOOT menu loads the whole file in one sequential read and keeps only
+// a small slot per capture in RAM, reading the visible rows by offset.
+// Header-only, no Arduino dependencies (unit tested on native).
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+#include "crc32.h"
+
+namespace CatalogRecord {
+
+// File header: "PCAT"(4) version(2 LE) recordLen(2 LE)
+static const uint8_t kFileMagic[4] = {'P', 'C', 'A', 'T'};
+static const uint16_t kVersion = 1;
+static const uint16_t kFileHeaderLen = 8;
+
+// Record: magic "PC"(2) op(1) kind(1) bssid(6) status(1) files(1)
+//         size(4 LE) mtime(4 LE) ssidLen(1) ssid(32) crc32(4 LE)
+// CRC covers everything between the magic and the CRC.
+static const uint8_t kMagic0 = 'P';
+static const uint8_t kMagic1 = 'C';
+static const uint16_t kRecordLen = 57;
+static const uint8_t kMaxSsid = 32;
+
+enum Op : uint8_t {
+    kPut = 1,
+    kDelete = 2
+};
+
+enum Kind : uint8_t {
+    kHandshake = 0,   // XXXXXXXXXXXX.pcap / XXXXXXXXXXXX_hs.22000
+    kPmkid = 1        // XXXXXXXXXXXX.22000
+};
+
+// Same order as CaptureStatus in the LOOT menu
+enum Status : uint8_t {
+    kLocal = 0,
+    kUploaded = 1,
+    kCracked = 2
+};
+
+// Entry::files bits
+static const uint8_t kFilePcap = 0x01;
+static const uint8_t kFileHs22000 = 0x02;
+static const uint8_t kFilePmkid22000 = 0x04;
+// parseName() only: the companion .txt / _pmkid.txt holding the SSID
+static const uint8_t kFileSsid = 0x80;
+
+struct Entry {
+    uint8_t bssid[6];
+    uint8_t kind;
+    uint8_t status;
+    uint8_t files;
+    char ssid[kMaxSsid + 1];
+    uint32_t size;      // Size of the file the menu lists (22000 over pcap)
+    uint32_t mtime;     // Its last write time
+};
+
+inline void put32(uint8_t* p, uint32_t v) {
+    p[0] = (uint8_t)v; p[1] = (uint8_t)(v >> 8); p[2] = (uint8_t)(v >> 16); p[3] = (uint8_t)(v >> 24);
+}
+inline uint32_t get32(const uint8_t* p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+inline void encodeFileHeader(uint8_t* out) {
+    memcpy(out, kFileMagic, 4);
+    out[4] = (uint8_t)kVersion;
+    out[5] = (uint8_t)(kVersion >> 8);
+    out[6] = (uint8_t)kRecordLen;
+    out[7] = (uint8_t)(kRecordLen >> 8);
+}
+
+inline bool checkFileHeader(const uint8_t* in) {
+    return memcmp(in, kFileMagic, 4) == 0 &&
+           (uint16_t)(in[4] | (in[5] << 8)) == kVersion &&
+           (uint16_t)(in[6] | (in[7] << 8)) == kRecordLen;
+}
+
+// out must hold kRecordLen bytes
+inline void encode(uint8_t* out, uint8_t op, const Entry& e) {
+    memset(out, 0, kRecordLen);
+    out[0] = kMagic0;
+    out[1] = kMagic1;
+    out[2] = op;
+    out[3] = e.kind;
+    memcpy(out + 4, e.bssid, 6);
+    out[10] = e.status;
+    out[11] = e.files;
+    put32(out + 12, e.size);
+    put32(out + 16, e.mtime);
+    size_t ssidLen = strnlen(e.ssid, kMaxSsid);
+    out[20] = (uint8_t)ssidLen;
+    memcpy(out + 21, e.ssid, ssidLen);
+    put32(out + 53, crc32Update(0, out + 2, 51));
+}
+
+// false on bad magic, bad CRC or out-of-range fields
+inline bool decode(const uint8_t* in, uint8_t& op, Entry& e) {
+    if (in[0] != kMagic0 || in[1] != kMagic1) return false;
+    if (get32(in + 53) != crc32Update(0, in + 2, 51)) return false;
+    op = in[2];
+    if ((op != kPut && op != kDelete) || in[3] > kPmkid || in[20] > kMaxSsid) return false;
+    e.kind = in[3];
+    memcpy(e.bssid, in + 4, 6);
+    e.status = in[10];
+    e.files = in[11];
+    e.size = get32(in + 12);
+    e.mtime = get32(in + 16);
+    memcpy(e.ssid, in + 21, in[20]);
+    e.ssid[in[20]] = '\0';
+    return true;
+}
+
+// ============================================================================
+// File names
+// ============================================================================
+
+inline int hexNibble(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    return -1;
+}
+
+/**
+ * Classify a handshakes directory entry by name (a leading path is ignored).
+ * @param file receives one kFile* bit
+ * @return false for anything that isn't a BSSID-named capture or SSID file
+ */
+inline bool parseName(const char* name, uint8_t* bssid, uint8_t& kind, uint8_t& file) {
+    if (!name) return false;
+    const char* slash = strrchr(name, '/');
+    if (slash) name = slash + 1;
+    for (int i = 0; i < 6; i++) {
+        int hi = hexNibble(name[i * 2]);
+        int lo = hi < 0 ? -1 : hexNibble(name[i * 2 + 1]);
+        if (lo < 0) return false;
+        bssid[i] = (uint8_t)((hi << 4) | lo);
+    }
+    const char* suffix = name + 12;
+    if (strcmp(suffix, ".pcap") == 0) { kind = kHandshake; file = kFilePcap; }
+    else if (strcmp(suffix, "_hs.22000") == 0) { kind = kHandshake; file = kFileHs22000; }
+    else if (strcmp(suffix, ".22000") == 0) { kind = kPmkid; file = kFilePmkid22000; }
+    else if (strcmp(suffix, ".txt") == 0) { kind = kHandshake; file = kFileSsid; }
+    else if (strcmp(suffix, "_pmkid.txt") == 0) { kind = kPmkid; file = kFileSsid; }
+    else return false;
+    return true;
+}
+
+// Name of the file the menu lists for an entry, e.g. "64EEB7208286_hs.22000"
+inline void listedName(const Entry& e, char* out, size_t len) {
+    const char* suffix = e.kind == kPmkid ? ".22000"
+                       : (e.files & kFileHs22000) ? "_hs.22000" : ".pcap";
+    snprintf(out, len, "%02X%02X%02X%02X%02X%02X%s",
+             e.bssid[0], e.bssid[1], e.bssid[2], e.bssid[3], e.bssid[4], e.bssid[5], suffix);
+}
+
+// ============================================================================
+// Rebuild - merge directory entries into a key-sorted table
+// ============================================================================
+
+inline int compareKey(const uint8_t* bssidA, uint8_t kindA, const uint8_t* bssidB, uint8_t kindB) {
+    int c = memcmp(bssidA, bssidB, 6);
+    if (c != 0) return c;
+    return (int)kindA - (int)kindB;
+}
+
+inline Entry& findOrInsert(std::vector<Entry>& table, const uint8_t* bssid, uint8_t kind) {
+    size_t lo = 0, hi = table.size();
+    while (lo < hi) {
+        size_t mid = (lo + hi) / 2;
+        int c = compareKey(table[mid].bssid, table[mid].kind, bssid, kind);
+        if (c == 0) return table[mid];
+        if (c < 0) lo = mid + 1;
+        else hi = mid;
+    }
+    Entry e = {};
+    memcpy(e.bssid, bssid, 6);
+    e.kind = kind;
+    return *table.insert(table.begin() + lo, e);
+}
+
+/**
+ * Fold one capture file into its entry. The listed size/mtime come from the
+ * 22000 file when there is one (same preference the menu always had).
+ */
+inline void mergeFile(Entry& e, uint8_t file, uint32_t size, uint32_t mtime) {
+    bool listed = file == kFileHs22000 || file == kFilePmkid22000 ||
+                  (file == kFilePcap && !(e.files & kFileHs22000));
+    e.files |= file;
+    if (listed) {
+        e.size = size;
+        e.mtime = mtime;
+    }
+}
+
+// ============================================================================
+// Status marks - WPA-SEC status per key, so writers carry it forward
+// ============================================================================
+
+// Only uploaded/cracked keys are kept; anything absent is kLocal
+struct StatusMark {
+    uint8_t bssid[6];
+    uint8_t kind;
+    uint8_t status;
+};
+
+inline size_t markLowerBound(const std::vector<StatusMark>& marks, const uint8_t* bssid, uint8_t kind) {
+    size_t lo = 0, hi = marks.size();
+    while (lo < hi) {
+        size_t mid = (lo + hi) / 2;
+        if (compareKey(marks[mid].bssid, marks[mid].kind, bssid, kind) < 0) lo = mid + 1;
+        else hi = mid;
+    }
+    return lo;
+}
+
+inline uint8_t markedStatus(const std::vector<StatusMark>& marks, const uint8_t* bssid, uint8_t kind) {
+    size_t i = markLowerBound(marks, bssid, kind);
+    if (i < marks.size() && compareKey(marks[i].bssid, marks[i].kind, bssid, kind) == 0) {
+        return marks[i].status;
+    }
+    return kLocal;
+}
+
+/**
+ * Apply one record, in file order: a put sets the key's status, a delete
+ * record resets it to kLocal.
+ */
+inline void foldStatus(std::vector<StatusMark>& marks, uint8_t op, const Entry& e) {
+    uint8_t status = op == kPut ? e.status : (uint8_t)kLocal;
+    size_t i = markLowerBound(marks, e.bssid, e.kind);
+    bool found = i < marks.size() && compareKey(marks[i].bssid, marks[i].kind, e.bssid, e.kind) == 0;
+    if (status == kLocal) {
+        if (found) marks.erase(marks.begin() + i);
+    } else if (found) {
+        marks[i].status = status;
+    } else {
+        StatusMark m;
+        memcpy(m.bssid, e.bssid, 6);
+        m.kind = e.kind;
+        m.status = status;
+        marks.insert(marks.begin() + i, m);
+    }
+}
+
+// ============================================================================
+// Index - what the menu keeps in RAM per capture
+// ============================================================================
+
+struct Slot {
+    uint32_t mtime;
+    uint32_t offset;    // Record offset in the catalog file
+    uint8_t bssid[6];
+    uint8_t kind;
+    uint8_t status;
+    uint8_t live;       // 0 for a delete record (dropped by finalize)
+};
+
+inline Slot makeSlot(uint8_t op, const Entry& e, uint32_t offset) {
+    Slot s;
+    s.mtime = e.mtime;
+    s.offset = offset;
+    memcpy(s.bssid, e.bssid, 6);
+    s.kind = e.kind;
+    s.status = e.status;
+    s.live = op == kPut && e.files != 0;
+    return s;
+}
+
+/**
+ * Reduce slots collected in file order to one per key (newest record wins),
+ * drop deleted keys and order the rest newest capture first.
+ * @return number of superseded or deleted records (compaction hint)
+ */
+inline size_t finalize(std::vector<Slot>& slots) {
+    size_t total = slots.size();
+    std::sort(slots.begin(), slots.end(), [](const Slot& a, const Slot& b) {
+        int c = compareKey(a.bssid, a.kind, b.bssid, b.kind);
+        if (c != 0) return c < 0;
+        return a.offset < b.offset;
+    });
+    size_t out = 0;
+    for (size_t i = 0; i < slots.size(); i++) {
+        bool last = i + 1 == slots.size() ||
+                    compareKey(slots[i].bssid, slots[i].kind, slots[i + 1].bssid, slots[i + 1].kind) != 0;
+        if (last && slots[i].live) slots[out++] = slots[i];
+    }
+    slots.resize(out);
+    std::sort(slots.begin(), slots.end(), [](const Slot& a, const Slot& b) {
+        if (a.mtime != b.mtime) return a.mtime > b.mtime;
+        return a.offset > b.offset;
+    });
+    return total - out;
+}
+
+}  // namespace CatalogRecord
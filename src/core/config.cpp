@@ -4,7 +4,10 @@
 #include "config.h"
 #include "sdlog.h"
 #include "sd_layout.h"
+#include "boot_profile.h"
+#include "boot_timeline.h"
 #include <M5Cardputer.h>
+#include <Preferences.h>
 #include <SD.h>
 #include <SPIFFS.h>
 #include <SPI.h>
@@ -36,6 +39,7 @@ BLEConfig Config::bleConfig;
 PersonalityConfig Config::personalityConfig;
 bool Config::initialized = false;
 static bool sdAvailable = false;
+static bool personalityLoaded = false;
 
 // ---- Binary config blob (zero heap allocation) ----
 static constexpr uint32_t CONFIG_MAGIC   = 0x504F524B;  // 'PORK'
@@ -96,6 +100,11 @@ struct __attribute__((packed)) ConfigBlob {
     float    mlVulnScorerThreshold;
     uint8_t  mlAutoUpdate;
     char     mlUpdateUrl[128];
+
+    // Appended after v1 shipped; shorter blobs read these as 0
+    uint8_t  captureMode;
+    uint8_t  gpsPassiveWardrive;
+    uint8_t  gpsInterpolateFix;
 };
 
 static void populateBlob(ConfigBlob& b, const GPSConfig& gps, const WiFiConfig& wifi,
@@ -144,6 +153,10 @@ static void populateBlob(ConfigBlob& b, const GPSConfig& gps, const WiFiConfig&
     b.mlVulnScorerThreshold  = ml.vulnScorerThreshold;
     b.mlAutoUpdate           = ml.autoUpdate ? 1 : 0;
     strncpy(b.mlUpdateUrl, ml.updateUrl, sizeof(b.mlUpdateUrl) - 1);
+
+    b.captureMode = static_cast<uint8_t>(wifi.captureMode);
+    b.gpsPassiveWardrive = gps.passiveWardrive ? 1 : 0;
+    b.gpsInterpolateFix  = gps.interpolateFix ? 1 : 0;
 }
 
 static bool writeBlobTo(fs::FS& fs, const char* path, const ConfigBlob& b) {
@@ -231,6 +244,10 @@ static void extractBlob(const ConfigBlob& b, GPSConfig& gps, WiFiConfig& wifi,
     ml.autoUpdate           = b.mlAutoUpdate != 0;
     strncpy(ml.updateUrl, b.mlUpdateUrl, sizeof(ml.updateUrl) - 1);
     ml.updateUrl[sizeof(ml.updateUrl) - 1] = '\0';
+
+    wifi.captureMode = static_cast<CaptureMode>(b.captureMode);
+    gps.passiveWardrive = b.gpsPassiveWardrive != 0;
+    gps.interpolateFix  = b.gpsInterpolateFix != 0;
 }
 
 static uint16_t clampU16(uint32_t value, uint16_t minVal, uint16_t maxVal) {
@@ -252,6 +269,7 @@ static void sanitizeWiFiConfig(WiFiConfig& cfg) {
     cfg.attackMinRssi = clampI8(cfg.attackMinRssi, -90, -50);
     if (cfg.spectrumTopN > 100) cfg.spectrumTopN = 100;
     cfg.spectrumStaleMs = clampU16(cfg.spectrumStaleMs, 1000, 20000);
+    if (static_cast<uint8_t>(cfg.captureMode) >= CAPTURE_MODE_COUNT) cfg.captureMode = CaptureMode::OFF;
 }
 
 static void ensureSdSpiReady() {
@@ -273,34 +291,52 @@ static void ensureSdSpiReady() {
     delay(20);
 }
 
-bool Config::init() {
-    // Initialize SPIFFS first (always available)
-    if (!SPIFFS.begin(false)) {
-        Serial.println("[CONFIG] SPIFFS mount failed (not formatting - data preserved)");
-    }
-
-    // Allow buses to stabilize after M5.begin()
-    delay(50);
+// ---- SD clock ladder ----
+// The clock the card last mounted at is kept in NVS so the next boot tries it
+// first instead of walking down from 25 MHz (every miss costs ~100 ms).
+// BootProfile::sdNoteMount() decides what sticks: slower clocks need two
+// mounts in a row, and the fastest clock is re-probed every few mounts.
+static const char* SD_PREFS_NS = "porkboot";
+static const char* SD_PREFS_HZ = "sdhz";
+static const char* SD_PREFS_LOWER = "sdlow";
+static const char* SD_PREFS_MOUNTS = "sdn";
+
+static BootProfile::SdClockMemory loadSdClockMemory() {
+    BootProfile::SdClockMemory m = {0, 0, 0};
+    Preferences prefs;
+    if (!prefs.begin(SD_PREFS_NS, true)) return m;  // Namespace not created yet
+    m.hz = prefs.getUInt(SD_PREFS_HZ, 0);
+    m.lowerHz = prefs.getUInt(SD_PREFS_LOWER, 0);
+    m.mounts = prefs.getUChar(SD_PREFS_MOUNTS, 0);
+    prefs.end();
+    return m;
+}
 
-    // Ensure SD has a proper SPI bus configured
-    ensureSdSpiReady();
+static void saveSdClockMemory(const BootProfile::SdClockMemory& m) {
+    Preferences prefs;
+    if (!prefs.begin(SD_PREFS_NS, false)) return;
+    prefs.putUInt(SD_PREFS_HZ, m.hz);
+    prefs.putUInt(SD_PREFS_LOWER, m.lowerHz);
+    prefs.putUChar(SD_PREFS_MOUNTS, m.mounts);
+    prefs.end();
+}
 
-    // Retry with progressive SPI speeds for reliability
-    sdAvailable = false;
-    const int maxRetries = 6;
-    const uint32_t speeds[] = {
-        25000000, // 25 MHz
-        20000000, // 20 MHz
-        10000000, // 10 MHz
-        8000000,  // 8 MHz
-        4000000,  // 4 MHz
-        1000000   // 1 MHz
-    };
-
-    for (int attempt = 0; attempt < maxRetries && !sdAvailable; attempt++) {
+// Try each clock until SD.begin() succeeds. The bus must already be set up
+// with ensureSdSpiReady(). flags receives BootProfile::FLAG_SD_* bits.
+// Returns the clock that mounted, 0 if none did.
+static uint32_t mountSdLadder(const char* what, uint8_t& flags) {
+    BootProfile::SdClockMemory memory = loadSdClockMemory();
+    uint32_t probe = BootProfile::sdProbeClock(memory);
+    uint32_t speeds[BootProfile::kSdClockCount];
+    uint8_t count = BootProfile::sdLadder(memory.hz, speeds, probe);
+    flags = 0;
+    if (probe) flags |= BootProfile::FLAG_SD_PROBED;
+    else if (speeds[0] == memory.hz) flags |= BootProfile::FLAG_SD_REMEMBERED;
+
+    for (uint8_t attempt = 0; attempt < count; attempt++) {
         uint32_t speed = speeds[attempt];
-        Serial.printf("[CONFIG] SD init attempt %d/%d at %luMHz\n",
-                      attempt + 1, maxRetries, speed / 1000000);
+        Serial.printf("[CONFIG] SD %s attempt %u/%u at %luMHz\n",
+                      what, attempt + 1, count, speed / 1000000);
 
         if (attempt > 0) {
             SD.end();     // Clean up previous failed attempt
@@ -311,17 +347,22 @@ bool Config::init() {
         // Use explicit CS + dedicated SPI + explicit speed
         if (SD.begin(SD_CS_PIN, sdSPI, speed)) {
             Serial.printf("[CONFIG] SD card mounted at %luMHz\n", speed / 1000000);
-            sdAvailable = true;
+            if (attempt == 0) flags |= BootProfile::FLAG_SD_FIRST_TRY;
+            if (BootProfile::sdNoteMount(memory, speed)) saveSdClockMemory(memory);
+            return speed;
         }
     }
 
-    if (!sdAvailable) {
-        SDLayout::setUseNewLayout(false);
-        Serial.println("[CONFIG] SD card init failed after retries, using SPIFFS");
-    } else {
-        SDLayout::migrateIfNeeded();
-        SDLayout::ensureDirs();
-        SDLog::log("CFG", "SD card mounted OK");
+    flags |= BootProfile::FLAG_SD_FAILED;
+    return 0;
+}
+
+bool Config::initEarly() {
+    if (personalityLoaded) return true;
+
+    // Initialize SPIFFS first (always available)
+    if (!SPIFFS.begin(false)) {
+        Serial.println("[CONFIG] SPIFFS mount failed (not formatting - data preserved)");
     }
 
     // Load personality from SPIFFS (always available)
@@ -331,6 +372,35 @@ bool Config::init() {
         savePersonalityToSPIFFS();
     }
 
+    personalityLoaded = true;
+    return true;
+}
+
+bool Config::init() {
+    // SPIFFS + personality (no-op if the boot splash already loaded them)
+    initEarly();
+
+    // Allow buses to stabilize after M5.begin()
+    delay(50);
+
+    // Ensure SD has a proper SPI bus configured
+    ensureSdSpiReady();
+
+    // Retry with progressive SPI speeds for reliability
+    uint8_t sdFlags = 0;
+    uint32_t sdHz = mountSdLadder("init", sdFlags);
+    sdAvailable = sdHz != 0;
+    BootTimeline::noteSd(sdHz, sdFlags);
+
+    if (!sdAvailable) {
+        SDLayout::setUseNewLayout(false);
+        Serial.println("[CONFIG] SD card init failed after retries, using SPIFFS");
+    } else {
+        SDLayout::migrateIfNeeded();
+        SDLayout::ensureDirs();
+        SDLog::log("CFG", "SD card mounted OK");
+    }
+
     // Load main config: SD primary, SPIFFS fallback
     Serial.printf("[CONFIG] Pre-load state: sdAvailable=%d, newLayout=%d\n",
                   sdAvailable, SDLayout::usingNewLayout());
@@ -417,33 +487,8 @@ bool Config::reinitSD() {
     ensureSdSpiReady();
 
     // Retry with progressive SPI speeds
-    sdAvailable = false;
-    const int maxRetries = 6;
-    const uint32_t speeds[] = {
-        25000000,
-        20000000,
-        10000000,
-        8000000,
-        4000000,
-        1000000
-    };
-
-    for (int attempt = 0; attempt < maxRetries && !sdAvailable; attempt++) {
-        uint32_t speed = speeds[attempt];
-        Serial.printf("[CONFIG] SD reinit attempt %d/%d at %luMHz\n",
-                      attempt + 1, maxRetries, speed / 1000000);
-
-        if (attempt > 0) {
-            SD.end();
-            delay(80);
-            ensureSdSpiReady();
-        }
-
-        if (SD.begin(SD_CS_PIN, sdSPI, speed)) {
-            Serial.printf("[CONFIG] SD card mounted at %luMHz\n", speed / 1000000);
-            sdAvailable = true;
-        }
-    }
+    uint8_t sdFlags = 0;
+    sdAvailable = mountSdLadder("reinit", sdFlags) != 0;
 
     if (sdAvailable) {
         // Success: verify layout by checking marker directly (no full migration)
@@ -510,6 +555,8 @@ bool Config::applyJson(const JsonDocument& doc) {
         gpsConfig.sleepTimeMs = doc["gps"]["sleepTimeMs"] | 5000;
         gpsConfig.powerSave = doc["gps"]["powerSave"] | true;
         gpsConfig.timezoneOffset = doc["gps"]["timezoneOffset"] | 0;
+        gpsConfig.passiveWardrive = doc["gps"]["passiveWardrive"] | false;
+        gpsConfig.interpolateFix = doc["gps"]["interpolateFix"] | false;
     }
 
     // ML config
@@ -557,6 +604,8 @@ bool Config::applyJson(const JsonDocument& doc) {
         wifiConfig.spectrumStaleMs = clampU16(staleMs, 1000, 20000);
         wifiConfig.spectrumCollapseSsid = doc["wifi"]["spectrumCollapseSsid"] | false;
         wifiConfig.spectrumTiltEnabled = doc["wifi"]["spectrumTiltEnabled"] | true;
+        int capMode = doc["wifi"]["captureMode"] | 0;
+        wifiConfig.captureMode = static_cast<CaptureMode>(capMode < 0 ? 0 : capMode);
         const char* ssid = doc["wifi"]["otaSSID"] | "";
         strncpy(wifiConfig.otaSSID, ssid, sizeof(wifiConfig.otaSSID) - 1);
         wifiConfig.otaSSID[sizeof(wifiConfig.otaSSID) - 1] = '\0';
@@ -684,6 +733,9 @@ bool Config::loadPersonality() {
     personalityConfig.dimLevel = doc["dimLevel"] | 20;
     personalityConfig.dimTimeout = doc["dimTimeout"] | 30;
     personalityConfig.themeIndex = doc["themeIndex"] | 0;
+    personalityConfig.avatarFps = doc["avatarFps"] | 8;
+    personalityConfig.spectrumFps = doc["spectrumFps"] | 0;
+    personalityConfig.menuFps = doc["menuFps"] | 20;
     uint8_t g0Action = doc["g0Action"] | static_cast<uint8_t>(G0Action::SCREEN_TOGGLE);
     if (g0Action >= G0_ACTION_COUNT) {
         g0Action = static_cast<uint8_t>(G0Action::SCREEN_TOGGLE);
@@ -719,6 +771,9 @@ void Config::savePersonalityToSPIFFS() {
     doc["dimLevel"] = personalityConfig.dimLevel;
     doc["dimTimeout"] = personalityConfig.dimTimeout;
     doc["themeIndex"] = personalityConfig.themeIndex;
+    doc["avatarFps"] = personalityConfig.avatarFps;
+    doc["spectrumFps"] = personalityConfig.spectrumFps;
+    doc["menuFps"] = personalityConfig.menuFps;
     doc["g0Action"] = static_cast<uint8_t>(personalityConfig.g0Action);
     doc["bootMode"] = static_cast<uint8_t>(personalityConfig.bootMode);
 
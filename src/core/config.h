@@ -40,6 +40,8 @@ struct GPSConfig {
     uint16_t sleepTimeMs = 5000;        // Sleep duration when stationary
     bool powerSave = true;
     int8_t timezoneOffset = 0;          // Hours offset from UTC (-12 to +14)
+    bool passiveWardrive = false;       // WARHOG: log NetworkRecon beacons instead of scanning
+    bool interpolateFix = false;        // WARHOG passive: interpolate position between fixes
 };
 
 // ML data collection mode
@@ -70,6 +72,16 @@ enum class BootMode : uint8_t {
 
 static constexpr uint8_t BOOT_MODE_COUNT = 4;
 
+// Session capture filter (continuous PCAPNG while NetworkRecon runs)
+enum class CaptureMode : uint8_t {
+    OFF = 0,
+    MGMT,           // Management frames only
+    EAPOL,          // EAPOL + probe resp/assoc (ESSID for crackers), no beacons
+    ALL             // Everything the radio hands us
+};
+
+static constexpr uint8_t CAPTURE_MODE_COUNT = 4;
+
 // ML settings
 struct MLConfig {
     bool enabled = true;
@@ -95,6 +107,7 @@ struct WiFiConfig {
     uint16_t spectrumStaleMs = 5000;    // Spectrum: stale timeout before drop (ms)
     bool spectrumCollapseSsid = false;  // Spectrum: merge same-SSID APs
     bool spectrumTiltEnabled = true;    // Spectrum: enable tilt-to-tune
+    CaptureMode captureMode = CaptureMode::OFF;  // Session PCAPNG capture filter
     char otaSSID[33];
     char otaPassword[65];
     bool autoConnect = false;
@@ -123,12 +136,16 @@ struct PersonalityConfig {
     uint8_t dimLevel = 20;              // Dimmed brightness 0-100% (0 = off)
     uint16_t dimTimeout = 30;           // Seconds before dimming (0 = never)
     uint8_t themeIndex = 0;             // Color theme (0-13, see THEMES array)
+    uint8_t avatarFps = 8;              // Frame cap on piglet/weather screens (0 = uncapped)
+    uint8_t spectrumFps = 0;            // Frame cap in SPECTRUM (0 = uncapped)
+    uint8_t menuFps = 20;               // Frame cap on menus and other screens (0 = uncapped)
     G0Action g0Action = G0Action::SCREEN_TOGGLE;
     BootMode bootMode = BootMode::IDLE;
 };
 
 class Config {
 public:
+    static bool initEarly();  // SPIFFS + personality only (boot splash theme)
     static bool init();
     static bool save();
     static bool load();
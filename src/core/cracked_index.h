@@ -0,0 +1,291 @@
+// CrackedIndex - Sorted on-SD index of the WPA-SEC potfile
+// Fixed-width entries (48-bit AP BSSID -> byte offset of its potfile line),
+// sorted by BSSID, so a cracked lookup is a binary search through a few
+// cached index pages and a password is one seek into the potfile. Nothing
+// in RAM grows with the number of cracked networks.
+// The index is built with a bounded external merge sort: sorted runs of a
+// fixed buffer, then streaming two-way merges.
+// Header-only, no Arduino dependencies (unit tested on native).
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <cctype>
+
+namespace CrackedIndex {
+
+// Header: "PWIX"(4) version(2) entryLen(2) count(4) potfileSize(4) potfileMtime(4)
+static const uint8_t kMagic[4] = {'P', 'W', 'I', 'X'};
+static const uint16_t kVersion = 1;
+static const uint16_t kHeaderLen = 20;
+static const uint16_t kEntryLen = 10;          // bssid(6) offset(4 LE)
+static const uint16_t kPageEntries = 32;       // Entries per cached page (320 bytes)
+static const uint16_t kMaxLineLen = 192;       // Longer potfile lines are not indexed
+
+struct Header {
+    uint32_t count;
+    uint32_t potfileSize;     // Index is stale if the potfile no longer matches
+    uint32_t potfileMtime;
+};
+
+struct Entry {
+    uint8_t key[6];           // AP BSSID, big-endian so memcmp orders it
+    uint32_t offset;          // Potfile offset of the line
+};
+
+inline void put32(uint8_t* p, uint32_t v) {
+    p[0] = (uint8_t)v; p[1] = (uint8_t)(v >> 8); p[2] = (uint8_t)(v >> 16); p[3] = (uint8_t)(v >> 24);
+}
+inline uint32_t get32(const uint8_t* p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+inline void encodeHeader(uint8_t* out, const Header& h) {
+    memcpy(out, kMagic, 4);
+    out[4] = (uint8_t)kVersion;
+    out[5] = (uint8_t)(kVersion >> 8);
+    out[6] = (uint8_t)kEntryLen;
+    out[7] = (uint8_t)(kEntryLen >> 8);
+    put32(out + 8, h.count);
+    put32(out + 12, h.potfileSize);
+    put32(out + 16, h.potfileMtime);
+}
+
+inline bool decodeHeader(const uint8_t* in, Header& h) {
+    if (memcmp(in, kMagic, 4) != 0) return false;
+    if ((uint16_t)(in[4] | (in[5] << 8)) != kVersion) return false;
+    if ((uint16_t)(in[6] | (in[7] << 8)) != kEntryLen) return false;
+    h.count = get32(in + 8);
+    h.potfileSize = get32(in + 12);
+    h.potfileMtime = get32(in + 16);
+    return true;
+}
+
+inline void encodeEntry(uint8_t* out, const Entry& e) {
+    memcpy(out, e.key, 6);
+    put32(out + 6, e.offset);
+}
+
+inline void decodeEntry(const uint8_t* in, Entry& e) {
+    memcpy(e.key, in, 6);
+    e.offset = get32(in + 6);
+}
+
+// Key order, then potfile order (so the last line for a BSSID sorts last)
+inline bool entryLess(const Entry& a, const Entry& b) {
+    int c = memcmp(a.key, b.key, 6);
+    if (c != 0) return c < 0;
+    return a.offset < b.offset;
+}
+
+// ============================================================================
+// Parsing
+// ============================================================================
+
+inline int hexNibble(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    return -1;
+}
+
+/**
+ * BSSID text to key. Accepts "64EEB7208286", "64:ee:b7:20:82:86" and
+ * "64-EE-..." (the separators normalizeBSSID() strips).
+ */
+inline bool parseKey(const char* s, uint8_t* key) {
+    if (!s) return false;
+    int digits = 0;
+    for (; *s; s++) {
+        if (*s == ':' || *s == '-') continue;
+        int v = hexNibble(*s);
+        if (v < 0 || digits >= 12) return false;
+        if ((digits & 1) == 0) key[digits / 2] = (uint8_t)(v << 4);
+        else key[digits / 2] |= (uint8_t)v;
+        digits++;
+    }
+    return digits == 12;
+}
+
+struct PotLine {
+    uint8_t key[6];
+    uint16_t ssidStart;
+    uint16_t ssidLen;
+    uint16_t passwordStart;
+    uint16_t passwordLen;
+};
+
+/**
+ * WPA-SEC potfile line: AP_BSSID(12):CLIENT_BSSID(12):SSID:password
+ * The password may contain colons, so it is everything after the third.
+ * Surrounding whitespace and the line ending are trimmed, as before.
+ */
+inline bool parsePotLine(const char* line, size_t len, PotLine& out) {
+    size_t start = 0;
+    while (start < len && isspace((unsigned char)line[start])) start++;
+    while (len > start && isspace((unsigned char)line[len - 1])) len--;
+    line += start;
+    len -= start;
+    if (len < 27 || line[12] != ':' || line[25] != ':') return false;
+    const char* third = (const char*)memchr(line + 26, ':', len - 26);
+    if (!third) return false;
+    for (int i = 0; i < 6; i++) {
+        int hi = hexNibble(line[i * 2]);
+        int lo = hexNibble(line[i * 2 + 1]);
+        if (hi < 0 || lo < 0) return false;
+        out.key[i] = (uint8_t)((hi << 4) | lo);
+    }
+    out.ssidStart = (uint16_t)(start + 26);
+    out.ssidLen = (uint16_t)(third - (line + 26));
+    out.passwordStart = (uint16_t)(start + (third - line) + 1);
+    out.passwordLen = (uint16_t)(len - (size_t)(third - line) - 1);
+    return true;
+}
+
+// ============================================================================
+// External sort - streaming two-way merge
+// ============================================================================
+
+/**
+ * Merge two sorted sources into sink. Src: bool next(Entry&).
+ * Sink: bool put(const Entry&). With dedupe only the last potfile line for
+ * each BSSID is kept (what the old map did by overwriting).
+ * @return entries written, or -1 if the sink failed
+ */
+template <class SrcA, class SrcB, class Sink>
+long mergeRuns(SrcA& a, SrcB& b, Sink& sink, bool dedupe) {
+    Entry ea, eb, pending;
+    bool hasA = a.next(ea);
+    bool hasB = b.next(eb);
+    bool hasPending = false;
+    long written = 0;
+    while (hasA || hasB) {
+        Entry e;
+        if (hasA && (!hasB || !entryLess(eb, ea))) {
+            e = ea;
+            hasA = a.next(ea);
+        } else {
+            e = eb;
+            hasB = b.next(eb);
+        }
+        if (!dedupe) {
+            if (!sink.put(e)) return -1;
+            written++;
+            continue;
+        }
+        if (hasPending && memcmp(pending.key, e.key, 6) != 0) {
+            if (!sink.put(pending)) return -1;
+            written++;
+        }
+        pending = e;
+        hasPending = true;
+    }
+    if (hasPending) {
+        if (!sink.put(pending)) return -1;
+        written++;
+    }
+    return written;
+}
+
+// ============================================================================
+// Lookup - binary search over index pages through a small page cache
+// ============================================================================
+
+/**
+ * Every lookup walks the same top of the search tree, so pages are kept by
+ * search depth: the deepest page is evicted first (oldest on a tie). Plain
+ * LRU would cycle through log2(pages) reads with a few slots and never hit.
+ */
+template <size_t Slots>
+struct PageCache {
+    uint8_t data[Slots][kPageEntries * kEntryLen];
+    uint32_t page[Slots];
+    uint16_t entries[Slots];
+    uint8_t depth[Slots];
+    uint32_t stamp[Slots];     // 0 = empty
+    uint32_t clock;
+    uint32_t hits;
+    uint32_t misses;
+
+    void reset() {
+        memset(stamp, 0, sizeof(stamp));
+        clock = 0;
+        hits = 0;
+        misses = 0;
+    }
+
+    /**
+     * ReadFn: size_t read(uint32_t pageNo, uint8_t* out, size_t maxEntries)
+     * @param level search depth the page was reached at (0 = root)
+     * @return page bytes, nullptr if the read failed
+     */
+    template <class ReadFn>
+    const uint8_t* get(uint32_t pageNo, uint16_t& n, ReadFn& read, uint8_t level) {
+        size_t victim = 0;
+        for (size_t i = 0; i < Slots; i++) {
+            if (stamp[i] != 0 && page[i] == pageNo) {
+                stamp[i] = ++clock;
+                if (level < depth[i]) depth[i] = level;
+                hits++;
+                n = entries[i];
+                return data[i];
+            }
+            if (stamp[victim] == 0) continue;
+            if (stamp[i] == 0 || depth[i] > depth[victim] ||
+                (depth[i] == depth[victim] && stamp[i] < stamp[victim])) {
+                victim = i;
+            }
+        }
+        misses++;
+        size_t got = read(pageNo, data[victim], kPageEntries);
+        if (got == 0) {
+            stamp[victim] = 0;
+            return nullptr;
+        }
+        page[victim] = pageNo;
+        entries[victim] = (uint16_t)got;
+        depth[victim] = level;
+        stamp[victim] = ++clock;
+        n = entries[victim];
+        return data[victim];
+    }
+};
+
+// Page-granular search: each page read either brackets the key or halves the range
+template <size_t Slots, class ReadFn>
+bool find(PageCache<Slots>& cache, ReadFn& read, uint32_t count, const uint8_t* key, Entry& out) {
+    uint32_t lo = 0;
+    uint32_t hi = (count + kPageEntries - 1) / kPageEntries;
+    uint8_t level = 0;
+    while (lo < hi) {
+        uint32_t mid = lo + (hi - lo) / 2;
+        uint16_t n = 0;
+        const uint8_t* p = cache.get(mid, n, read, level < 255 ? level++ : level);
+        if (!p || n == 0) return false;
+        if (memcmp(p, key, 6) > 0) {
+            hi = mid;
+            continue;
+        }
+        if (memcmp(p + (n - 1) * kEntryLen, key, 6) < 0) {
+            lo = mid + 1;
+            continue;
+        }
+        uint16_t a = 0;
+        uint16_t b = n;
+        while (a < b) {
+            uint16_t m = a + (b - a) / 2;
+            int c = memcmp(p + m * kEntryLen, key, 6);
+            if (c == 0) {
+                decodeEntry(p + m * kEntryLen, out);
+                return true;
+            }
+            if (c < 0) a = m + 1;
+            else b = m;
+        }
+        return false;
+    }
+    return false;
+}
+
+}  // namespace CrackedIndex
@@ -0,0 +1,116 @@
+// DirtyRegion - Changed-rectangle tracking for 8-bit sprites
+// Screens keep redrawing their canvas every frame; what goes over SPI is
+// only what differs from the last push. Each sprite row is split into tiles
+// whose hashes are kept from the previous push (a few bytes per tile instead
+// of a shadow copy of the frame). Changed rows are grouped into bands and
+// each band becomes one rectangle spanning its changed tiles.
+// Header-only, no Arduino dependencies (unit tested on native).
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace DirtyRegion {
+
+// Clean rows between two changed ones that are pushed anyway rather than
+// starting a new rectangle (a window setup costs more than a few rows)
+static const int kMergeGap = 2;
+
+struct Rect {
+    int16_t x;
+    int16_t y;
+    int16_t w;
+    int16_t h;
+};
+
+// Hash of one tile; n is a multiple of 4
+inline uint32_t hashSpan(const uint8_t* p, int n) {
+    uint32_t h = 0x811C9DC5u;
+    for (int i = 0; i < n; i += 4) {
+        uint32_t w;
+        memcpy(&w, p + i, 4);
+        h = (h ^ w) * 0x9E3779B1u;
+        h ^= h >> 15;
+    }
+    return h;
+}
+
+/**
+ * Tracks one W x H sprite (8 bits per pixel, rows W bytes apart).
+ * scan() hands out the rectangles that changed since the last scan.
+ */
+template <int W, int H, int TileW>
+class Tracker {
+    static_assert(W % TileW == 0 && TileW % 4 == 0, "tiles must split rows on word boundaries");
+    static const int kTiles = W / TileW;
+    static_assert(kTiles <= 32, "tile mask is 32 bits");
+
+public:
+    Tracker() : valid(false) {
+        memset(hashes, 0, sizeof(hashes));
+    }
+
+    // Next scan reports the whole sprite (panel content unknown)
+    void invalidate() { valid = false; }
+
+    /**
+     * Push: callable void(const Rect&), sprite-relative.
+     * @return number of rectangles handed to push
+     */
+    template <class Push>
+    uint16_t scan(const uint8_t* pixels, Push& push) {
+        uint16_t n = 0;
+        int top = -1;
+        int bottom = 0;
+        int lo = 0;
+        int hi = 0;
+        for (int y = 0; y < H; y++) {
+            const uint8_t* row = pixels + (size_t)y * W;
+            uint32_t mask = 0;
+            for (int t = 0; t < kTiles; t++) {
+                uint32_t h = hashSpan(row + t * TileW, TileW);
+                if (!valid || h != hashes[y][t]) {
+                    hashes[y][t] = h;
+                    mask |= 1u << t;
+                }
+            }
+            if (mask) {
+                int first = __builtin_ctz(mask);
+                int last = 31 - __builtin_clz(mask);
+                if (top < 0) {
+                    top = y;
+                    lo = first;
+                    hi = last;
+                } else {
+                    if (first < lo) lo = first;
+                    if (last > hi) hi = last;
+                }
+                bottom = y;
+            } else if (top >= 0 && y - bottom > kMergeGap) {
+                emit(push, top, bottom, lo, hi);
+                n++;
+                top = -1;
+            }
+        }
+        if (top >= 0) {
+            emit(push, top, bottom, lo, hi);
+            n++;
+        }
+        valid = true;
+        return n;
+    }
+
+private:
+    template <class Push>
+    static void emit(Push& push, int top, int bottom, int lo, int hi) {
+        Rect r = {(int16_t)(lo * TileW), (int16_t)top,
+                  (int16_t)((hi - lo + 1) * TileW), (int16_t)(bottom - top + 1)};
+        push(r);
+    }
+
+    uint32_t hashes[H][kTiles];
+    bool valid;
+};
+
+}  // namespace DirtyRegion
@@ -0,0 +1,109 @@
+// EapolParser - 802.11 data frame -> EAPOL-Key message decoding
+// Shared by OINK and DNH handshake/PMKID capture.
+// Header-only, no allocation, safe to call from the WiFi promiscuous callback.
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+
+namespace EapolParser {
+
+// EAPOL header: version(1) + type(1) + length(2); key frame fields follow
+static constexpr uint8_t kTypeKey = 3;
+static constexpr uint16_t kKeyDescriptorOffset = 4;
+static constexpr uint16_t kKeyInfoOffset = 5;
+static constexpr uint16_t kKeyDataLenOffset = 97;
+static constexpr uint16_t kKeyDataOffset = 99;
+static constexpr uint16_t kMinKeyLen = kKeyDataOffset;   // Key frame with empty key data
+static constexpr uint8_t kDescriptorRSN = 0x02;           // WPA2/WPA3 (0xFE = WPA1)
+
+// PMKID KDE: dd 14 00 0f ac 04 [16-byte PMKID]
+static constexpr uint16_t kPmkidKdeLen = 22;
+static constexpr uint16_t kPmkidLen = 16;
+
+// Key information bits
+static constexpr uint16_t kKeyInfoInstall = 1 << 6;
+static constexpr uint16_t kKeyInfoAck = 1 << 7;
+static constexpr uint16_t kKeyInfoMic = 1 << 8;
+static constexpr uint16_t kKeyInfoSecure = 1 << 9;
+
+/**
+ * Find the EAPOL payload of a data frame (after the LLC/SNAP 88 8E header).
+ * Handles address 4, QoS and HTC. Does not check the frame type; callers
+ * only pass data frames.
+ */
+inline bool locate(const uint8_t* frame, uint16_t len,
+                   const uint8_t*& eapol, uint16_t& eapolLen) {
+    if (!frame || len < 24) return false;
+    uint16_t offset = 24;
+    if ((frame[1] & 0x03) == 0x03) offset += 6;        // ToDS + FromDS: address 4
+    bool isQoS = (frame[0] & 0x80) != 0;               // Subtype bit 3
+    if (isQoS) {
+        offset += 2;                                   // QoS control
+        if (frame[1] & 0x80) offset += 4;              // HTC (Order bit)
+    }
+    if (offset + 8 > len) return false;
+
+    const uint8_t* llc = frame + offset;
+    if (llc[0] != 0xAA || llc[1] != 0xAA || llc[2] != 0x03 ||
+        llc[3] != 0x00 || llc[4] != 0x00 || llc[5] != 0x00 ||
+        llc[6] != 0x88 || llc[7] != 0x8E) {
+        return false;
+    }
+    eapol = llc + 8;
+    eapolLen = (uint16_t)(len - offset - 8);
+    return true;
+}
+
+// 4-way handshake message (1-4) from key information, 0 if unrecognised
+inline uint8_t messageNumber(uint16_t keyInfo) {
+    bool ack = keyInfo & kKeyInfoAck;
+    bool mic = keyInfo & kKeyInfoMic;
+    bool secure = keyInfo & kKeyInfoSecure;
+    bool install = keyInfo & kKeyInfoInstall;
+    if (ack && !mic) return 1;
+    if (!ack && mic && !secure) return 2;               // M4 is secure
+    if (ack && mic && install) return 3;
+    if (!ack && mic && secure) return 4;
+    return 0;
+}
+
+/**
+ * Message number of an EAPOL-Key frame, 0 if the payload is not a
+ * complete key frame or the message can't be identified.
+ */
+inline uint8_t keyMessage(const uint8_t* eapol, uint16_t eapolLen) {
+    if (!eapol || eapolLen < kMinKeyLen) return 0;
+    if (eapol[1] != kTypeKey) return 0;
+    uint16_t keyInfo = (uint16_t)((eapol[kKeyInfoOffset] << 8) | eapol[kKeyInfoOffset + 1]);
+    return messageNumber(keyInfo);
+}
+
+/**
+ * PMKID carried in the key data of an RSN M1.
+ * @return Pointer to the 16 PMKID bytes inside the frame, or nullptr if
+ *         absent, WPA1, truncated or all zeros (some APs send an empty KDE)
+ */
+inline const uint8_t* findPMKID(const uint8_t* eapol, uint16_t eapolLen) {
+    if (!eapol || eapolLen < kKeyDataOffset + kPmkidKdeLen) return nullptr;
+    if (eapol[kKeyDescriptorOffset] != kDescriptorRSN) return nullptr;
+
+    uint16_t keyDataLen = (uint16_t)((eapol[kKeyDataLenOffset] << 8) | eapol[kKeyDataLenOffset + 1]);
+    if (keyDataLen < kPmkidKdeLen || eapolLen < kKeyDataOffset + keyDataLen) return nullptr;
+
+    const uint8_t* keyData = eapol + kKeyDataOffset;
+    for (uint16_t i = 0; i + kPmkidKdeLen <= keyDataLen; i++) {
+        if (keyData[i] == 0xDD && keyData[i + 1] == 0x14 &&
+            keyData[i + 2] == 0x00 && keyData[i + 3] == 0x0F &&
+            keyData[i + 4] == 0xAC && keyData[i + 5] == 0x04) {
+            const uint8_t* pmkid = keyData + i + 6;
+            for (uint16_t z = 0; z < kPmkidLen; z++) {
+                if (pmkid[z] != 0) return pmkid;
+            }
+            return nullptr;
+        }
+    }
+    return nullptr;
+}
+
+}  // namespace EapolParser
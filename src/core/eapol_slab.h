@@ -0,0 +1,179 @@
+// EapolSlab - Packed storage for the M1-M4 frames of one handshake
+// Replaces four fixed 812-byte EAPOLFrame cells with one byte arena that
+// holds only what was captured. Shared by OINK, DNH and PigSync.
+// Header-only, no heap, no Arduino dependencies (unit tested on native).
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+
+// Read-only view of one stored frame. Pointers go into the slab and are
+// valid until the next store()/erase()/clear() on it.
+struct EapolFrameView {
+    const uint8_t* data;         // EAPOL payload (for hashcat 22000)
+    const uint8_t* fullFrame;    // Full 802.11 frame for PCAP, nullptr if not kept
+    uint16_t len;                // EAPOL payload length, 0 = not captured
+    uint16_t fullFrameLen;       // Full 802.11 frame length
+    uint8_t messageNum;          // 1-4
+    uint32_t timestamp;
+    int8_t rssi;                 // Signal strength for radiotap header
+};
+
+/**
+ * Fixed-size arena holding up to four EAPOL-Key frames (M1-M4).
+ *
+ * Each frame is a 16-byte header plus its bytes packed back to back.
+ * The EAPOL payload is normally the tail of the captured 802.11 frame
+ * (header + LLC/SNAP + EAPOL), so it is stored once and addressed inside
+ * the full frame. A truncated full frame stores both copies.
+ *
+ * Limits match the old fixed cells: EAPOL 512 bytes, full frame 300.
+ * When a frame doesn't fit, M4 is evicted first (never needed for
+ * cracking), then the full frame is dropped and only the EAPOL payload
+ * kept. Replacing a frame compacts the arena; a replacement that can't
+ * fit fails and leaves the previous copy in place.
+ *
+ * All-zero is a valid empty slab, so owners can memset / = {} it.
+ * Trivially copyable. Not thread-safe - callers hold their own lock.
+ */
+template <uint16_t BYTES>
+class EapolSlab {
+    static_assert(BYTES >= 128, "slab too small for an EAPOL-Key frame");
+
+public:
+    static constexpr uint8_t kFrames = 4;
+    static constexpr uint16_t kMaxEapolLen = 512;
+    static constexpr uint16_t kMaxFullFrameLen = 300;
+
+    void clear() { *this = EapolSlab(); }
+
+    bool has(uint8_t idx) const { return idx < kFrames && hdr[idx].eapolLen != 0; }
+
+    // Bits 0-3 for M1-M4
+    uint8_t mask() const {
+        uint8_t m = 0;
+        for (uint8_t i = 0; i < kFrames; i++) {
+            if (hdr[i].eapolLen) m |= (uint8_t)(1 << i);
+        }
+        return m;
+    }
+
+    uint16_t used() const { return usedBytes; }
+    static constexpr uint16_t capacity() { return BYTES; }
+    uint16_t available() const { return (uint16_t)(BYTES - usedBytes); }
+
+    EapolFrameView operator[](uint8_t idx) const {
+        EapolFrameView v = {};
+        if (!has(idx)) return v;
+        const Header& h = hdr[idx];
+        v.data = arena + h.offset + h.eapolAt;
+        v.len = h.eapolLen;
+        v.fullFrame = h.fullLen ? arena + h.offset : nullptr;
+        v.fullFrameLen = h.fullLen;
+        v.messageNum = (uint8_t)(idx + 1);
+        v.timestamp = h.timestamp;
+        v.rssi = h.rssi;
+        return v;
+    }
+
+    /**
+     * Store frame idx (0-3 for M1-M4), replacing any previous copy.
+     * fullFrame may be nullptr. Returns false if nothing could be stored.
+     */
+    bool store(uint8_t idx, const uint8_t* eapol, uint16_t eapolLen,
+               const uint8_t* fullFrame, uint16_t fullLen,
+               uint32_t timestamp, int8_t rssi) {
+        if (idx >= kFrames || !eapol || eapolLen == 0) return false;
+        if (eapolLen > kMaxEapolLen) eapolLen = kMaxEapolLen;
+        if (!fullFrame) fullLen = 0;
+        if (fullLen > kMaxFullFrameLen) fullLen = kMaxFullFrameLen;
+
+        bool shared = fullLen >= eapolLen &&
+                      memcmp(fullFrame + fullLen - eapolLen, eapol, eapolLen) == 0;
+        uint16_t need = shared ? fullLen : (uint16_t)(fullLen + eapolLen);
+
+        // Plan against the space left once the old copy (and maybe M4) is
+        // gone, but touch nothing until the new frame is known to fit: a
+        // failed replacement must not lose the frame it was replacing
+        uint16_t room = (uint16_t)(available() + frameBytes(idx));
+        bool evictM4 = false;
+        if (need > room && idx != 3 && has(3)) {
+            evictM4 = true;
+            room = (uint16_t)(room + frameBytes(3));
+        }
+        if (need > room && fullLen > 0) {
+            fullLen = 0;
+            shared = false;
+            need = eapolLen;
+        }
+        if (need > room) return false;
+
+        erase(idx);
+        if (evictM4) erase(3);
+
+        Header& h = hdr[idx];
+        h.offset = usedBytes;
+        h.fullLen = fullLen;
+        h.eapolLen = eapolLen;
+        h.eapolAt = shared ? (uint16_t)(fullLen - eapolLen) : fullLen;
+        h.timestamp = timestamp;
+        h.rssi = rssi;
+        if (fullLen) memcpy(arena + h.offset, fullFrame, fullLen);
+        if (!shared) memcpy(arena + h.offset + fullLen, eapol, eapolLen);
+        usedBytes = (uint16_t)(usedBytes + need);
+        return true;
+    }
+
+    // Copy frame idx from another slab (any size). False if src lacks it.
+    template <uint16_t N>
+    bool copyFrom(const EapolSlab<N>& src, uint8_t idx) {
+        EapolFrameView f = src[idx];
+        if (f.len == 0) return false;
+        return store(idx, f.data, f.len, f.fullFrame, f.fullFrameLen, f.timestamp, f.rssi);
+    }
+
+    // Drop frame idx and close the gap it leaves in the arena.
+    void erase(uint8_t idx) {
+        if (!has(idx)) return;
+        Header& h = hdr[idx];
+        uint16_t size = frameBytes(idx);
+        uint16_t end = (uint16_t)(h.offset + size);
+        memmove(arena + h.offset, arena + end, usedBytes - end);
+        for (uint8_t i = 0; i < kFrames; i++) {
+            if (i != idx && hdr[i].eapolLen && hdr[i].offset > h.offset) {
+                hdr[i].offset = (uint16_t)(hdr[i].offset - size);
+            }
+        }
+        usedBytes = (uint16_t)(usedBytes - size);
+        memset(&h, 0, sizeof(h));
+    }
+
+private:
+    // Arena bytes held by frame idx, 0 if empty
+    uint16_t frameBytes(uint8_t idx) const {
+        if (!has(idx)) return 0;
+        const Header& h = hdr[idx];
+        // eapolAt == fullLen means the payload was stored after the full frame
+        return (h.eapolAt == h.fullLen) ? (uint16_t)(h.fullLen + h.eapolLen) : h.fullLen;
+    }
+
+    struct Header {
+        uint32_t timestamp;
+        uint16_t offset;     // Start of this frame's bytes in arena
+        uint16_t fullLen;    // 0 = full frame not kept
+        uint16_t eapolLen;   // 0 = slot empty
+        uint16_t eapolAt;    // EAPOL start relative to offset
+        int8_t rssi;
+    };
+
+    uint16_t usedBytes;
+    Header hdr[kFrames];
+    uint8_t arena[BYTES];
+};
+
+// Per-handshake arena: fits a typical M1-M4 with full frames (~550-650 B)
+static constexpr uint16_t kHandshakeSlabBytes = 640;
+using HandshakeFrames = EapolSlab<kHandshakeSlabBytes>;
+
+// Single-frame queue cell: one shared full frame, or a lone max-size EAPOL
+using EapolFrameSlot = EapolSlab<HandshakeFrames::kMaxEapolLen>;
@@ -0,0 +1,145 @@
+// EventBus - Fixed-capacity event queue with per-type subscriber tables
+// post() is safe from any task (WiFi callback included): it is an MpscRing
+// push, no heap and no lock. dispatch() runs on the main loop and hands each
+// event to the handlers subscribed to its type, at most `budget` events per
+// call. Handlers are plain function pointers plus a context pointer.
+// Header-only, no Arduino dependencies (unit tested on native).
+#pragma once
+
+#include <cstdint>
+#include "mpsc_ring.h"
+
+namespace EventBus {
+
+// Dispatch-side counters (queue counters come from the ring's RingStats)
+struct Stats {
+    uint32_t dispatched;        // Events handed to handlers (or to none)
+    uint32_t unhandled;         // Events with no subscriber for their type
+    uint32_t badType;           // Events with a type outside the table
+    uint32_t deferred;          // dispatch() calls that hit the budget
+    uint16_t subscribeFull;     // subscribe() refused: table for that type full
+};
+
+/**
+ * E is the event enum (uint8_t-backed), TypeCount the number of values,
+ * MaxSubs the handlers per type, QueueN the ring capacity (power of two).
+ * subscribe()/unsubscribe() are main-loop only, like dispatch().
+ */
+template <typename E, uint8_t TypeCount, uint8_t MaxSubs, uint16_t QueueN>
+class Bus {
+public:
+    typedef void (*Handler)(E event, void* data, void* ctx);
+
+    Bus() { reset(); }
+
+    // Not safe while producers are active.
+    void reset() {
+        queue.reset();
+        for (uint8_t t = 0; t < TypeCount; t++) subCount[t] = 0;
+        stats.dispatched = 0;
+        stats.unhandled = 0;
+        stats.badType = 0;
+        stats.deferred = 0;
+        stats.subscribeFull = 0;
+    }
+
+    // Any task. A full queue drops the new event (counted in queueStats()).
+    bool post(E event, void* data = nullptr) {
+        Item item;
+        item.event = event;
+        item.data = data;
+        return queue.push(item);
+    }
+
+    // Same (handler, ctx) twice is one subscription
+    bool subscribe(E event, Handler fn, void* ctx = nullptr) {
+        uint8_t t = (uint8_t)event;
+        if (!fn || t >= TypeCount) return false;
+        for (uint8_t i = 0; i < subCount[t]; i++) {
+            if (subs[t][i].fn == fn && subs[t][i].ctx == ctx) return true;
+        }
+        if (subCount[t] >= MaxSubs) {
+            stats.subscribeFull++;
+            return false;
+        }
+        subs[t][subCount[t]].fn = fn;
+        subs[t][subCount[t]].ctx = ctx;
+        subCount[t]++;
+        return true;
+    }
+
+    bool unsubscribe(E event, Handler fn, void* ctx = nullptr) {
+        uint8_t t = (uint8_t)event;
+        if (t >= TypeCount) return false;
+        for (uint8_t i = 0; i < subCount[t]; i++) {
+            if (subs[t][i].fn == fn && subs[t][i].ctx == ctx) {
+                // Keep registration order for the rest
+                for (uint8_t j = i + 1; j < subCount[t]; j++) subs[t][j - 1] = subs[t][j];
+                subCount[t]--;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    uint8_t subscribers(E event) const {
+        uint8_t t = (uint8_t)event;
+        return t < TypeCount ? subCount[t] : 0;
+    }
+
+    /**
+     * Deliver up to budget queued events, oldest first. Events left over wait
+     * for the next call.
+     * @return events delivered
+     */
+    uint16_t dispatch(uint16_t budget) {
+        uint16_t n = 0;
+        Item item;
+        while (n < budget && queue.pop(item)) {
+            deliver(item);
+            n++;
+        }
+        if (n == budget && !queue.empty()) stats.deferred++;
+        return n;
+    }
+
+    uint16_t pending() const { return queue.size(); }
+    RingStats queueStats() const { return queue.stats(); }
+    const Stats& dispatchStats() const { return stats; }
+
+private:
+    struct Item {
+        E event;
+        void* data;
+    };
+
+    struct Sub {
+        Handler fn;
+        void* ctx;
+    };
+
+    void deliver(const Item& item) {
+        stats.dispatched++;
+        uint8_t t = (uint8_t)item.event;
+        if (t >= TypeCount) {
+            stats.badType++;
+            return;
+        }
+        uint8_t count = subCount[t];
+        if (count == 0) {
+            stats.unhandled++;
+            return;
+        }
+        // A handler may unsubscribe itself; re-read the count each step
+        for (uint8_t i = 0; i < count && i < subCount[t]; i++) {
+            subs[t][i].fn(item.event, item.data, subs[t][i].ctx);
+        }
+    }
+
+    MpscRing<Item, QueueN> queue;
+    Sub subs[TypeCount][MaxSubs];
+    uint8_t subCount[TypeCount];
+    Stats stats;
+};
+
+}  // namespace EventBus
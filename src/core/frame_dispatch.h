@@ -0,0 +1,237 @@
+// FrameDispatch - Promiscuous callback dispatch for recon / OINK / DNH / SPECTRUM
+// Each callback hands the driver packet to its function here: length
+// checks, frame type routing, beacon IE parsing and EAPOL-Key decoding
+// happen once, and the owner's Sink only does the bookkeeping (tables,
+// locks, event rings). test_replay drives the same functions with its own
+// sinks, so the benchmark measures the dispatch the firmware runs.
+// Header-only, no allocation, safe to call from the WiFi promiscuous callback.
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include "ie_parser.h"
+#include "eapol_parser.h"
+
+// wifi_promiscuous_pkt_t: ESP-IDF on device, mocks/mock_esp_wifi.h on native
+// (native tests include the mock before this header).
+#ifdef ARDUINO
+#include <esp_wifi_types.h>
+#endif
+
+namespace FrameDispatch {
+
+static constexpr uint16_t kGhostBytes = 4;       // sig_len counts the FCS
+static constexpr uint16_t kMinFrameLen = 24;     // 802.11 MAC header
+static constexpr uint16_t kMinDataLen = 28;      // Header + the start of LLC/SNAP
+static constexpr uint16_t kMaxFrameLen = 2346;   // 802.11 MPDU limit
+
+// Management subtypes
+static constexpr uint8_t kSubtypeAssocReq = 0x00;
+static constexpr uint8_t kSubtypeReassocReq = 0x02;
+static constexpr uint8_t kSubtypeProbeResp = 0x05;
+static constexpr uint8_t kSubtypeBeacon = 0x08;
+
+inline uint16_t frameLen(const wifi_promiscuous_pkt_t* pkt) {
+    uint16_t len = pkt->rx_ctrl.sig_len;
+    return len > kGhostBytes ? (uint16_t)(len - kGhostBytes) : len;
+}
+
+inline uint8_t subtype(const uint8_t* frame) {
+    return (frame[0] >> 4) & 0x0F;
+}
+
+/**
+ * AP and client of an infrastructure data frame (exactly one of ToDS /
+ * FromDS set). False for IBSS and WDS frames.
+ */
+inline bool dataLink(const uint8_t* frame, const uint8_t*& bssid, const uint8_t*& client) {
+    uint8_t ds = frame[1] & 0x03;
+    if (ds == 0x01) {            // Client -> AP: Addr1=BSSID, Addr2=client
+        bssid = frame + 4;
+        client = frame + 10;
+        return true;
+    }
+    if (ds == 0x02) {            // AP -> client: Addr1=client, Addr2=BSSID
+        bssid = frame + 10;
+        client = frame + 4;
+        return true;
+    }
+    return false;
+}
+
+// Beacon or probe response with its IEs parsed
+struct Beacon {
+    const uint8_t* frame;
+    uint16_t len;
+    const uint8_t* bssid;
+    bool probeResponse;
+    IEParser::BeaconInfo info;
+};
+
+inline bool decodeBeacon(const uint8_t* frame, uint16_t len, Beacon& out) {
+    if (len < IEParser::kBeaconIEOffset) return false;
+    out.frame = frame;
+    out.len = len;
+    out.bssid = frame + 16;
+    out.probeResponse = subtype(frame) == kSubtypeProbeResp;
+    IEParser::parse(frame, len, out.info);
+    return true;
+}
+
+// EAPOL-Key frame with its direction resolved
+struct EapolKey {
+    const uint8_t* eapol;
+    uint16_t eapolLen;
+    uint8_t messageNum;          // 1-4
+    uint8_t bssid[6];
+    uint8_t station[6];
+    const uint8_t* pmkid;        // RSN M1 PMKID KDE, else nullptr
+};
+
+inline bool decodeEapol(const uint8_t* frame, uint16_t len, EapolKey& out) {
+    if (!EapolParser::locate(frame, len, out.eapol, out.eapolLen)) return false;
+    out.messageNum = EapolParser::keyMessage(out.eapol, out.eapolLen);
+    if (out.messageNum == 0) return false;
+
+    // M1/M3 come from the AP (TA), M2/M4 go to it (RA)
+    const uint8_t* ta = frame + 10;
+    const uint8_t* ra = frame + 4;
+    bool fromAp = out.messageNum == 1 || out.messageNum == 3;
+    memcpy(out.bssid, fromAp ? ta : ra, 6);
+    memcpy(out.station, fromAp ? ra : ta, 6);
+    out.pmkid = out.messageNum == 1 ? EapolParser::findPMKID(out.eapol, out.eapolLen) : nullptr;
+    return true;
+}
+
+// ============================================================================
+// Per-mode dispatch
+// ============================================================================
+
+/**
+ * NetworkRecon. Sink:
+ *   beacon(const Beacon&, int8_t rssi)         beacons + probe responses
+ *   ssidSeen(const uint8_t* bssid, const IEParser::BeaconInfo&)
+ *                                               (re)assoc request SSID
+ *   dataActivity(const uint8_t* bssid, const uint8_t* client, int8_t rssi)
+ * @return false for a runt frame (not counted)
+ */
+template <typename Sink>
+inline bool recon(const wifi_promiscuous_pkt_t* pkt, wifi_promiscuous_pkt_type_t type, Sink& sink) {
+    uint16_t len = frameLen(pkt);
+    if (len < kMinFrameLen) return false;
+    const uint8_t* frame = pkt->payload;
+    int8_t rssi = pkt->rx_ctrl.rssi;
+
+    if (type == WIFI_PKT_MGMT) {
+        uint8_t st = subtype(frame);
+        if (st == kSubtypeBeacon || st == kSubtypeProbeResp) {
+            Beacon b;
+            if (decodeBeacon(frame, len, b)) sink.beacon(b, rssi);
+        } else if (st == kSubtypeAssocReq || st == kSubtypeReassocReq) {
+            if (len < IEParser::kBeaconIEOffset) return true;
+            uint16_t ieOffset = st == kSubtypeReassocReq ? IEParser::kReassocReqIEOffset
+                                                         : IEParser::kAssocReqIEOffset;
+            IEParser::BeaconInfo info;
+            if (IEParser::parse(frame, len, info, ieOffset) && info.ssidPresent && !info.hidden) {
+                sink.ssidSeen(frame + 16, info);
+            }
+        }
+    } else if (type == WIFI_PKT_DATA && len >= kMinDataLen) {
+        const uint8_t* bssid;
+        const uint8_t* client;
+        if (dataLink(frame, bssid, client) && (client[0] & 0x01) == 0) {
+            sink.dataActivity(bssid, client, rssi);
+        }
+    }
+    return true;
+}
+
+/**
+ * OINK. 4-address data frames are still searched for EAPOL. Sink:
+ *   beacon(const uint8_t* frame, uint16_t len, int8_t rssi)   raw, for PCAP
+ *   client(const uint8_t* bssid, const uint8_t* client, int8_t rssi)
+ *   eapol(const EapolKey&, const uint8_t* frame, uint16_t len, int8_t rssi)
+ */
+template <typename Sink>
+inline void oink(const wifi_promiscuous_pkt_t* pkt, wifi_promiscuous_pkt_type_t type, Sink& sink) {
+    uint16_t len = frameLen(pkt);
+    if (len < kMinFrameLen) return;
+    const uint8_t* frame = pkt->payload;
+    int8_t rssi = pkt->rx_ctrl.rssi;
+
+    if (type == WIFI_PKT_MGMT) {
+        if (subtype(frame) == kSubtypeBeacon && len >= IEParser::kBeaconIEOffset) {
+            sink.beacon(frame, len, rssi);
+        }
+        return;
+    }
+    if (type != WIFI_PKT_DATA || len < kMinDataLen) return;
+
+    const uint8_t* bssid;
+    const uint8_t* client;
+    if (dataLink(frame, bssid, client) && (client[0] & 0x01) == 0) {
+        sink.client(bssid, client, rssi);
+    }
+    EapolKey k;
+    if (decodeEapol(frame, len, k)) sink.eapol(k, frame, len, rssi);
+}
+
+/**
+ * DNH (passive). WDS frames skipped. Sink:
+ *   beacon(const Beacon&, int8_t rssi)
+ *   eapol(const EapolKey&, const uint8_t* frame, uint16_t len, int8_t rssi)
+ */
+template <typename Sink>
+inline void dnh(const wifi_promiscuous_pkt_t* pkt, wifi_promiscuous_pkt_type_t type, Sink& sink) {
+    uint16_t len = frameLen(pkt);
+    if (len < kMinFrameLen || len > kMaxFrameLen) return;
+    const uint8_t* frame = pkt->payload;
+    int8_t rssi = pkt->rx_ctrl.rssi;
+
+    if (type == WIFI_PKT_MGMT) {
+        // Beacon interval + capability included; probe responses are recon's
+        Beacon b;
+        if (subtype(frame) == kSubtypeBeacon && len >= IEParser::kBeaconIEOffset + 4 &&
+            decodeBeacon(frame, len, b)) {
+            sink.beacon(b, rssi);
+        }
+        return;
+    }
+    if (type != WIFI_PKT_DATA) return;
+    if ((frame[1] & 0x03) == 0x03) return;   // WDS
+
+    EapolKey k;
+    if (decodeEapol(frame, len, k)) sink.eapol(k, frame, len, rssi);
+}
+
+/**
+ * SPECTRUM. Uses the raw sig_len like the original callback; rxChannel is
+ * the driver's channel with the caller's fallback applied. Sink:
+ *   activity(uint8_t rxChannel, int8_t rssi)   every packet
+ *   data(const uint8_t* frame, uint16_t len, int8_t rssi)
+ *   beacon(const Beacon&, uint8_t channel, bool channelTrusted, int8_t rssi)
+ */
+template <typename Sink>
+inline void spectrum(const wifi_promiscuous_pkt_t* pkt, wifi_promiscuous_pkt_type_t type,
+                     uint8_t rxChannel, Sink& sink) {
+    const uint8_t* frame = pkt->payload;
+    uint16_t len = pkt->rx_ctrl.sig_len;
+    int8_t rssi = pkt->rx_ctrl.rssi;
+    sink.activity(rxChannel, rssi);
+
+    if (type == WIFI_PKT_DATA) {
+        sink.data(frame, len, rssi);
+        return;
+    }
+    if (type != WIFI_PKT_MGMT || len < IEParser::kBeaconIEOffset) return;
+    if (frame[0] != 0x80 && frame[0] != 0x50) return;   // Beacon / probe response, no flags
+
+    Beacon b;
+    decodeBeacon(frame, len, b);
+    bool channelTrusted = b.info.dsChannel >= 1 && b.info.dsChannel <= 13;
+    uint8_t channel = channelTrusted ? b.info.dsChannel : rxChannel;
+    if (channel < 1 || channel > 13) return;
+    sink.beacon(b, channel, channelTrusted, rssi);
+}
+
+}  // namespace FrameDispatch
@@ -0,0 +1,178 @@
+// FrameRing - Single-producer/single-consumer byte ring for raw 802.11 frames
+// Producer is the WiFi promiscuous callback, consumer is the SD writer task.
+// Variable-length records, no allocation after attach(), no locks.
+// Header-only, no Arduino dependencies (unit tested on native).
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+
+struct FrameRecordHeader {
+    uint32_t tsLo;      // Capture time (us), low word
+    uint32_t tsHi;      // Capture time (us), high word
+    uint16_t len;       // Bytes stored after this header
+    uint16_t origLen;   // Frame length on air
+    int8_t rssi;
+    uint8_t channel;
+    uint16_t reserved;
+
+    uint64_t timestampUs() const { return ((uint64_t)tsHi << 32) | tsLo; }
+};
+
+static_assert(sizeof(FrameRecordHeader) == 16, "FrameRecordHeader must stay 16 bytes");
+
+/**
+ * Records are [FrameRecordHeader][frame bytes], padded to 4 bytes and never
+ * split across the end of the buffer. When a record doesn't fit before the
+ * end, the producer leaves a wrap marker (len = kWrapMarker) if there is room
+ * for a header, otherwise the consumer wraps implicitly.
+ *
+ * A full ring drops the new frame and counts it; nothing ever blocks.
+ */
+class FrameRing {
+public:
+    static constexpr uint16_t kWrapMarker = 0xFFFF;
+    static constexpr uint32_t kHeaderLen = sizeof(FrameRecordHeader);
+
+    FrameRing() : buf(nullptr), size(0), head(0), tail(0), droppedCount(0),
+                  pushedCount(0), highWaterMark(0) {}
+
+    // Attach backing storage. size is rounded down to a multiple of 4.
+    // Not safe while producer/consumer are active.
+    void attach(uint8_t* storage, uint32_t bytes) {
+        buf = storage;
+        size = storage ? (bytes & ~3u) : 0;
+        reset();
+    }
+
+    void reset() {
+        head.store(0, std::memory_order_relaxed);
+        tail.store(0, std::memory_order_relaxed);
+        droppedCount.store(0, std::memory_order_relaxed);
+        pushedCount.store(0, std::memory_order_relaxed);
+        highWaterMark.store(0, std::memory_order_relaxed);
+    }
+
+    bool attached() const { return buf != nullptr && size > 0; }
+    uint32_t capacity() const { return size; }
+
+    static uint32_t recordSize(uint16_t len) {
+        return (kHeaderLen + len + 3u) & ~3u;
+    }
+
+    // Producer side. Returns false (and counts a drop) if there is no room.
+    bool push(uint64_t tsUs, int8_t rssi, uint8_t channel,
+              const uint8_t* frame, uint16_t len, uint16_t origLen) {
+        if (!attached() || len == kWrapMarker) {
+            droppedCount.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        uint32_t need = recordSize(len);
+        uint32_t h = head.load(std::memory_order_relaxed);
+        uint32_t t = tail.load(std::memory_order_acquire);
+        uint32_t at;
+
+        if (h >= t) {
+            uint32_t toEnd = size - h;
+            if (need < toEnd || (need == toEnd && t != 0)) {
+                at = h;
+            } else if (need < t) {
+                if (toEnd >= kHeaderLen) {
+                    FrameRecordHeader marker = {};
+                    marker.len = kWrapMarker;
+                    memcpy(buf + h, &marker, kHeaderLen);
+                }
+                at = 0;
+            } else {
+                droppedCount.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+        } else {
+            if (need >= t - h) {
+                droppedCount.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+            at = h;
+        }
+
+        FrameRecordHeader hdr;
+        hdr.tsLo = (uint32_t)tsUs;
+        hdr.tsHi = (uint32_t)(tsUs >> 32);
+        hdr.len = len;
+        hdr.origLen = origLen;
+        hdr.rssi = rssi;
+        hdr.channel = channel;
+        hdr.reserved = 0;
+        memcpy(buf + at, &hdr, kHeaderLen);
+        if (len) memcpy(buf + at + kHeaderLen, frame, len);
+
+        uint32_t next = at + need;
+        if (next == size) next = 0;
+        head.store(next, std::memory_order_release);
+        pushedCount.fetch_add(1, std::memory_order_relaxed);
+
+        uint32_t inUse = usedBetween(next, t);
+        if (inUse > highWaterMark.load(std::memory_order_relaxed)) {
+            highWaterMark.store(inUse, std::memory_order_relaxed);
+        }
+        return true;
+    }
+
+    // Consumer side. Returns the oldest record (header copied out, frame
+    // bytes pointed to in place) or false if empty. Call pop() when done.
+    bool peek(FrameRecordHeader& hdr, const uint8_t*& frame) {
+        if (!attached()) return false;
+        uint32_t t = tail.load(std::memory_order_relaxed);
+        uint32_t h = head.load(std::memory_order_acquire);
+        if (t == h) return false;
+
+        if (size - t < kHeaderLen) {
+            t = 0;
+        } else {
+            memcpy(&hdr, buf + t, kHeaderLen);
+            if (hdr.len == kWrapMarker) t = 0;
+        }
+        if (t != tail.load(std::memory_order_relaxed)) {
+            tail.store(t, std::memory_order_release);
+            if (t == h) return false;
+        }
+
+        memcpy(&hdr, buf + t, kHeaderLen);
+        frame = buf + t + kHeaderLen;
+        return true;
+    }
+
+    // Release the record returned by the last successful peek().
+    void pop(const FrameRecordHeader& hdr) {
+        uint32_t t = tail.load(std::memory_order_relaxed) + recordSize(hdr.len);
+        if (t >= size) t = 0;
+        tail.store(t, std::memory_order_release);
+    }
+
+    uint32_t used() const {
+        return usedBetween(head.load(std::memory_order_acquire),
+                           tail.load(std::memory_order_acquire));
+    }
+
+    bool empty() const {
+        return head.load(std::memory_order_acquire) == tail.load(std::memory_order_acquire);
+    }
+
+    uint32_t dropped() const { return droppedCount.load(std::memory_order_relaxed); }
+    uint32_t pushed() const { return pushedCount.load(std::memory_order_relaxed); }
+    uint32_t highWater() const { return highWaterMark.load(std::memory_order_relaxed); }
+
+private:
+    uint32_t usedBetween(uint32_t h, uint32_t t) const {
+        return (h >= t) ? (h - t) : (size - t + h);
+    }
+
+    uint8_t* buf;
+    uint32_t size;
+    std::atomic<uint32_t> head;   // Next write offset (producer owned)
+    std::atomic<uint32_t> tail;   // Next read offset (consumer owned)
+    std::atomic<uint32_t> droppedCount;
+    std::atomic<uint32_t> pushedCount;
+    std::atomic<uint32_t> highWaterMark;
+};
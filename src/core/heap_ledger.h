@@ -0,0 +1,233 @@
+// HeapLedger - Per-subsystem attribution of live heap blocks
+// Every tracked allocation is remembered by address (open-addressed table,
+// linear probing, backward-shift delete so there are no tombstones) with its
+// size and the tag of the subsystem that was running when it was made. A
+// free looks the block up and takes its bytes off the right tag. The table
+// lives in caller-provided storage and never allocates, so it can sit under
+// malloc itself. Also holds the free/largest fragmentation time series.
+// Header-only, no Arduino dependencies (unit tested on native).
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace HeapLedger {
+
+enum class Tag : uint8_t {
+    Other = 0,      // Untagged code, other tasks, allocations before tracing
+    Recon,
+    Oink,           // OINK and DO NO HAM capture modes
+    FileServer,
+    Tls,            // WPA-SEC / WiGLE HTTPS sessions
+    Ble,
+    Ui,
+    Count
+};
+
+static const uint8_t kTagCount = (uint8_t)Tag::Count;
+
+inline const char* tagName(Tag t) {
+    static const char* const kNames[kTagCount] = {
+        "OTHER", "RECON", "OINK", "FILESRV", "TLS", "BLE", "UI"
+    };
+    uint8_t i = (uint8_t)t;
+    return i < kTagCount ? kNames[i] : "?";
+}
+
+struct TagStats {
+    uint32_t liveBytes;     // Requested bytes still allocated
+    uint32_t peakBytes;     // High-water of liveBytes
+    uint32_t liveBlocks;
+    uint32_t allocs;        // Cumulative, including untracked (table full)
+    uint32_t frees;
+};
+
+// One live block; info packs size (24 bits, blocks up to 16 MB) and tag
+struct Slot {
+    uintptr_t ptr;          // 0 = empty
+    uint32_t info;
+};
+
+/**
+ * Live block table. Capacity must be a power of two; it refuses new
+ * blocks past 7/8 full to keep probe runs short.
+ */
+class Ledger {
+public:
+    // constexpr: a static Ledger is usable by allocations made before
+    // static constructors run
+    constexpr Ledger() : slots(nullptr), mask(0), cap(0), count(0), overflow(0), stray(0), tags() {}
+
+    void attach(Slot* storage, uint16_t n) {
+        slots = storage;
+        cap = (storage && n && (n & (n - 1)) == 0) ? n : 0;
+        mask = cap ? cap - 1 : 0;
+        reset();
+    }
+
+    void reset() {
+        for (uint16_t i = 0; i < cap; i++) slots[i].ptr = 0;
+        count = 0;
+        overflow = 0;
+        stray = 0;
+        memset(tags, 0, sizeof(tags));
+    }
+
+    /**
+     * Remember a new block.
+     * @return false if it could not be tracked (counted, its free will be stray)
+     */
+    bool record(const void* p, size_t size, Tag tag) {
+        if (!p) return false;
+        uint8_t t = (uint8_t)tag < kTagCount ? (uint8_t)tag : 0;
+        tags[t].allocs++;
+        if (cap == 0 || (uint32_t)(count + 1) * 8 > (uint32_t)cap * 7 || size > 0xFFFFFFu) {
+            overflow++;
+            return false;
+        }
+        uintptr_t key = (uintptr_t)p;
+        uint16_t i = home(key);
+        while (slots[i].ptr != 0) {
+            if (slots[i].ptr == key) {
+                // Reused address whose free we never saw: replace it
+                drop(slots[i]);
+                break;
+            }
+            i = (i + 1) & mask;
+        }
+        if (slots[i].ptr == 0) count++;
+        slots[i].ptr = key;
+        slots[i].info = ((uint32_t)size << 8) | t;
+        TagStats& s = tags[t];
+        s.liveBytes += (uint32_t)size;
+        s.liveBlocks++;
+        if (s.liveBytes > s.peakBytes) s.peakBytes = s.liveBytes;
+        return true;
+    }
+
+    /**
+     * Forget a freed block. size/tag receive what it was recorded with.
+     * @return false if the block was not tracked (stray free)
+     */
+    bool forget(const void* p, size_t* size = nullptr, Tag* tag = nullptr) {
+        if (!p) return false;
+        uintptr_t key = (uintptr_t)p;
+        if (cap) {
+            uint16_t i = home(key);
+            while (slots[i].ptr != 0) {
+                if (slots[i].ptr == key) {
+                    if (size) *size = slots[i].info >> 8;
+                    if (tag) *tag = (Tag)(slots[i].info & 0xFF);
+                    tags[slots[i].info & 0xFF].frees++;
+                    drop(slots[i]);
+                    erase(i);
+                    return true;
+                }
+                i = (i + 1) & mask;
+            }
+        }
+        stray++;
+        return false;
+    }
+
+    const TagStats& stats(Tag t) const {
+        uint8_t i = (uint8_t)t;
+        return tags[i < kTagCount ? i : 0];
+    }
+
+    uint32_t liveBytes() const {
+        uint32_t sum = 0;
+        for (uint8_t i = 0; i < kTagCount; i++) sum += tags[i].liveBytes;
+        return sum;
+    }
+
+    uint16_t blocks() const { return count; }
+    uint16_t capacity() const { return cap; }
+    uint32_t overflowed() const { return overflow; }    // Allocations not tracked
+    uint32_t strayFrees() const { return stray; }       // Frees of untracked blocks
+
+private:
+    uint16_t home(uintptr_t key) const {
+        // Blocks are at least 4-byte aligned; mix the rest
+        return (uint16_t)(((uint32_t)(key >> 2) * 0x9E3779B1u) >> 16) & mask;
+    }
+
+    void drop(const Slot& s) {
+        TagStats& t = tags[s.info & 0xFF];
+        t.liveBytes -= s.info >> 8;
+        t.liveBlocks--;
+    }
+
+    // Backward-shift delete: pull later entries of the probe run into the hole
+    void erase(uint16_t hole) {
+        uint16_t j = hole;
+        for (;;) {
+            j = (j + 1) & mask;
+            if (slots[j].ptr == 0) break;
+            uint16_t k = home(slots[j].ptr);
+            // Entry at j may move to hole only if its home is not in (hole, j]
+            bool between = (hole <= j) ? (k > hole && k <= j) : (k > hole || k <= j);
+            if (between) continue;
+            slots[hole] = slots[j];
+            hole = j;
+        }
+        slots[hole].ptr = 0;
+        count--;
+    }
+
+    Slot* slots;
+    uint16_t mask;
+    uint16_t cap;
+    uint16_t count;
+    uint32_t overflow;
+    uint32_t stray;
+    TagStats tags[kTagCount];
+};
+
+// ============================================================================
+// Fragmentation time series
+// ============================================================================
+
+struct Sample {
+    uint32_t ms;
+    uint32_t freeBytes;
+    uint32_t largest;       // Largest free block
+};
+
+// 0 = all free memory in one block, 1000 = shattered
+inline uint16_t fragPermille(const Sample& s) {
+    if (s.freeBytes == 0 || s.largest >= s.freeBytes) return 0;
+    return (uint16_t)(1000u - (uint32_t)((uint64_t)s.largest * 1000u / s.freeBytes));
+}
+
+// Last N samples, oldest first
+template <uint16_t N>
+class Series {
+public:
+    Series() : head(0), n(0) {}
+
+    void push(const Sample& s) {
+        buf[head] = s;
+        head = (uint16_t)((head + 1) % N);
+        if (n < N) n++;
+    }
+
+    uint16_t size() const { return n; }
+
+    const Sample& at(uint16_t i) const {
+        return buf[(uint16_t)((head + N - n + i) % N)];
+    }
+
+    void clear() {
+        head = 0;
+        n = 0;
+    }
+
+private:
+    Sample buf[N];
+    uint16_t head;
+    uint16_t n;
+};
+
+}  // namespace HeapLedger
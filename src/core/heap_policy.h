@@ -15,6 +15,10 @@ namespace HeapPolicy {
     static constexpr size_t kMinHeapForReconGrowth = 20000;
     static constexpr size_t kMinHeapForDnhGrowth = 40000;
     static constexpr size_t kMinHeapForSpectrumGrowth = 20000;
+    static constexpr size_t kMinHeapForSessionCapture = 50000;  // Headroom left after ring + batch
+    static constexpr size_t kMinHeapForSdLog = 40000;           // Headroom left after the 8KB log ring
+    static constexpr size_t kMinHeapForCaptureJournal = 50000;  // Headroom left after the 16KB journal ring
+    static constexpr size_t kMinHeapForSpriteCache = 60000;     // Headroom left after the ~11KB avatar sprite cache
 
     // Heap stabilization / recovery thresholds
     static constexpr size_t kHeapStableThreshold = 50000;
@@ -44,6 +48,11 @@ namespace HeapPolicy {
     static constexpr uint32_t kHealthConditionCooldownMs = 30000;
     static constexpr float kHealthFragPenaltyScale = 0.60f;
 
+    // Heap trace: fragmentation series, attribution table (trace builds only)
+    static constexpr uint32_t kTraceSampleIntervalMs = 5000;
+    static constexpr uint16_t kTraceSamples = 120;          // 10 minutes of samples
+    static constexpr uint16_t kTraceSlots = 2048;           // Power of two; 8 bytes per live block
+
     // Growth gating (fragmentation-aware)
     static constexpr float kMinFragRatioForGrowth = 0.40f;
 
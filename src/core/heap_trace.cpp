@@ -0,0 +1,177 @@
+// Heap Trace - fragmentation series and link-time allocator wrappers
+
+#include "heap_trace.h"
+#include "heap_policy.h"
+#include <Arduino.h>
+#include <esp_heap_caps.h>
+#include <esp_attr.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+namespace HeapTrace {
+
+static HeapLedger::Series<HeapPolicy::kTraceSamples> series;
+static uint32_t lastSampleMs = 0;
+static bool sampled = false;
+
+void update() {
+    uint32_t now = millis();
+    if (sampled && now - lastSampleMs < HeapPolicy::kTraceSampleIntervalMs) return;
+    sampled = true;
+    lastSampleMs = now;
+    HeapLedger::Sample s = {
+        now,
+        (uint32_t)ESP.getFreeHeap(),
+        (uint32_t)heap_caps_get_largest_free_block(MALLOC_CAP_8BIT)
+    };
+    series.push(s);
+}
+
+uint16_t sampleCount() {
+    return series.size();
+}
+
+HeapLedger::Sample getSample(uint16_t i) {
+    return series.at(i);
+}
+
+#if PORKCHOP_HEAP_TRACE
+
+// Everything below runs inside malloc/free: no allocation, no logging
+static HeapLedger::Slot slots[HeapPolicy::kTraceSlots];
+static HeapLedger::Ledger ledger;
+static bool attached = false;
+static portMUX_TYPE traceMux = portMUX_INITIALIZER_UNLOCKED;
+static volatile Tag scopeTag = Tag::Other;
+static void* volatile scopeTask = nullptr;
+
+static inline Tag currentTag() {
+    if (scopeTag == Tag::Other) return Tag::Other;
+    return ((void*)xTaskGetCurrentTaskHandle() == scopeTask) ? scopeTag : Tag::Other;
+}
+
+static inline void recordTagged(void* p, size_t size, Tag tag) {
+    portENTER_CRITICAL(&traceMux);
+    if (!attached) {
+        ledger.attach(slots, HeapPolicy::kTraceSlots);
+        attached = true;
+    }
+    ledger.record(p, size, tag);
+    portEXIT_CRITICAL(&traceMux);
+}
+
+static inline void recordBlock(void* p, size_t size) {
+    if (!p) return;
+    recordTagged(p, size, currentTag());
+}
+
+static inline bool forgetBlock(void* p, size_t* size = nullptr, Tag* tag = nullptr) {
+    if (!p) return false;
+    portENTER_CRITICAL(&traceMux);
+    bool found = ledger.forget(p, size, tag);
+    portEXIT_CRITICAL(&traceMux);
+    return found;
+}
+
+Scope::Scope(Tag tag) : prevTag(scopeTag), prevTask(scopeTask) {
+    scopeTask = (void*)xTaskGetCurrentTaskHandle();
+    scopeTag = tag;
+}
+
+Scope::~Scope() {
+    scopeTag = prevTag;
+    scopeTask = prevTask;
+}
+
+void getTagStats(Tag tag, HeapLedger::TagStats& out) {
+    portENTER_CRITICAL(&traceMux);
+    out = ledger.stats(tag);
+    portEXIT_CRITICAL(&traceMux);
+}
+
+void getTotals(Totals& out) {
+    portENTER_CRITICAL(&traceMux);
+    out.trackedBytes = ledger.liveBytes();
+    out.blocks = ledger.blocks();
+    out.capacity = ledger.capacity();
+    out.overflowed = ledger.overflowed();
+    out.strayFrees = ledger.strayFrees();
+    portEXIT_CRITICAL(&traceMux);
+}
+
+}  // namespace HeapTrace
+
+// Link-time wrappers (-Wl,--wrap=<symbol>, trace env only). free() goes
+// straight to the real heap_caps_free() so the block isn't forgotten twice
+// on its way through the wrapped heap_caps_free().
+extern "C" {
+void* __real_malloc(size_t size);
+void* __real_calloc(size_t n, size_t size);
+void* __real_realloc(void* ptr, size_t size);
+void* __real_heap_caps_malloc(size_t size, uint32_t caps);
+void* __real_heap_caps_calloc(size_t n, size_t size, uint32_t caps);
+void __real_heap_caps_free(void* ptr);
+
+void* IRAM_ATTR __wrap_malloc(size_t size) {
+    void* p = __real_malloc(size);
+    HeapTrace::recordBlock(p, size);
+    return p;
+}
+
+void* IRAM_ATTR __wrap_calloc(size_t n, size_t size) {
+    void* p = __real_calloc(n, size);
+    HeapTrace::recordBlock(p, n * size);
+    return p;
+}
+
+void* IRAM_ATTR __wrap_realloc(void* ptr, size_t size) {
+    // Forget first: once the old block is freed its address can be handed
+    // to another task before we get the lock back
+    size_t oldSize = 0;
+    HeapLedger::Tag oldTag = HeapLedger::Tag::Other;
+    bool tracked = HeapTrace::forgetBlock(ptr, &oldSize, &oldTag);
+    void* p = __real_realloc(ptr, size);
+    if (p) {
+        HeapTrace::recordBlock(p, size);
+    } else if (tracked && size > 0) {
+        HeapTrace::recordTagged(ptr, oldSize, oldTag);     // Failed: old block still live
+    }
+    return p;
+}
+
+void IRAM_ATTR __wrap_free(void* ptr) {
+    HeapTrace::forgetBlock(ptr);
+    __real_heap_caps_free(ptr);
+}
+
+void* IRAM_ATTR __wrap_heap_caps_malloc(size_t size, uint32_t caps) {
+    void* p = __real_heap_caps_malloc(size, caps);
+    HeapTrace::recordBlock(p, size);
+    return p;
+}
+
+void* IRAM_ATTR __wrap_heap_caps_calloc(size_t n, size_t size, uint32_t caps) {
+    void* p = __real_heap_caps_calloc(n, size, caps);
+    HeapTrace::recordBlock(p, n * size);
+    return p;
+}
+
+void IRAM_ATTR __wrap_heap_caps_free(void* ptr) {
+    HeapTrace::forgetBlock(ptr);
+    __real_heap_caps_free(ptr);
+}
+}  // extern "C"
+
+#else  // !PORKCHOP_HEAP_TRACE
+
+void getTagStats(Tag, HeapLedger::TagStats& out) {
+    out = HeapLedger::TagStats();
+}
+
+void getTotals(Totals& out) {
+    out = Totals();
+}
+
+}  // namespace HeapTrace
+
+#endif
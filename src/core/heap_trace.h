@@ -0,0 +1,59 @@
+// Heap Trace - who holds the heap
+// Always on: a fragmentation time series (free / largest block every few
+// seconds). Opt-in (build with -DPORKCHOP_HEAP_TRACE=1, see the
+// m5cardputer-heaptrace env): malloc/calloc/realloc/free and
+// heap_caps_malloc/calloc/free are wrapped at link time and every block is
+// attributed to the subsystem tag of the Scope it was allocated under.
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include "heap_ledger.h"
+
+#ifndef PORKCHOP_HEAP_TRACE
+#define PORKCHOP_HEAP_TRACE 0
+#endif
+
+namespace HeapTrace {
+    using Tag = HeapLedger::Tag;
+
+    struct Totals {
+        uint32_t trackedBytes;  // Live bytes across all tags
+        uint16_t blocks;        // Live blocks in the table
+        uint16_t capacity;      // Table slots (0 = tracing not compiled in)
+        uint32_t overflowed;    // Allocations the full table could not take
+        uint32_t strayFrees;    // Frees of blocks allocated before tracing / untracked
+    };
+
+    // Attribution compiled in (PORKCHOP_HEAP_TRACE)
+    constexpr bool isEnabled() { return PORKCHOP_HEAP_TRACE != 0; }
+
+    // Take a fragmentation sample (rate-limited, call every loop)
+    void update();
+
+    // Consistent copies (taken under the allocator lock)
+    void getTagStats(Tag tag, HeapLedger::TagStats& out);
+    void getTotals(Totals& out);
+
+    // Fragmentation series, oldest first
+    uint16_t sampleCount();
+    HeapLedger::Sample getSample(uint16_t i);
+
+#if PORKCHOP_HEAP_TRACE
+    // Allocations made by this task while the scope is open get `tag`.
+    // Scopes nest; other tasks' allocations stay OTHER.
+    class Scope {
+    public:
+        explicit Scope(Tag tag);
+        ~Scope();
+    private:
+        Tag prevTag;
+        void* prevTask;
+    };
+#else
+    class Scope {
+    public:
+        explicit Scope(Tag) {}
+    };
+#endif
+}
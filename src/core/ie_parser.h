@@ -0,0 +1,240 @@
+// IEParser - Single-pass, zero-copy 802.11 Information Element parser
+// Shared by NetworkRecon, OINK, DNH and SPECTRUM beacon/probe handling.
+// Header-only, no allocation, safe to call from the WiFi promiscuous callback.
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+
+// wifi_auth_mode_t: ESP-IDF on device, mocks/mock_esp_wifi.h on native
+// (native tests include the mock before this header).
+#ifdef ARDUINO
+#include <esp_wifi_types.h>
+#endif
+
+namespace IEParser {
+
+// Management frame layout
+static constexpr uint16_t kMgmtHeaderLen = 24;
+static constexpr uint16_t kBeaconFixedLen = 12;   // Timestamp(8) + Interval(2) + Capability(2)
+static constexpr uint16_t kBeaconIEOffset = kMgmtHeaderLen + kBeaconFixedLen;  // 36
+static constexpr uint16_t kAssocReqIEOffset = kMgmtHeaderLen + 4;     // Capability(2) + Listen(2)
+static constexpr uint16_t kReassocReqIEOffset = kMgmtHeaderLen + 10;  // + Current AP(6)
+
+// Element IDs
+static constexpr uint8_t kIdSSID = 0;
+static constexpr uint8_t kIdDSParams = 3;
+static constexpr uint8_t kIdRSN = 48;
+static constexpr uint8_t kIdVendor = 221;
+
+// RSN capability bits (IEEE 802.11-2016 9.4.2.25.4)
+static constexpr uint16_t kRsnCapMFPR = 0x0040;  // Bit 6: MFP required
+static constexpr uint16_t kRsnCapMFPC = 0x0080;  // Bit 7: MFP capable
+
+// AKM suite types (OUI 00:0F:AC)
+static constexpr uint8_t kAkm8021X = 1;
+static constexpr uint8_t kAkmPSK = 2;
+static constexpr uint8_t kAkmFT8021X = 3;
+static constexpr uint8_t kAkmFTPSK = 4;
+static constexpr uint8_t kAkm8021XSHA256 = 5;
+static constexpr uint8_t kAkmPSKSHA256 = 6;
+static constexpr uint8_t kAkmSAE = 8;
+static constexpr uint8_t kAkmFTSAE = 9;
+
+struct IE {
+    uint8_t id;
+    uint8_t len;
+    const uint8_t* data;  // Points into the frame, valid while frame is
+};
+
+/**
+ * Walks the IE list of a management frame without copying.
+ * Stops at the end of the frame or at the first IE whose length runs
+ * past it (truncated() then reports true).
+ */
+class Iterator {
+public:
+    Iterator(const uint8_t* frame, uint16_t len, uint16_t offset = kBeaconIEOffset)
+        : frame(frame), len(len), offset(offset), cut(false) {}
+
+    bool next(IE& out) {
+        if (!frame || offset + 2 > len) return false;
+        uint8_t ieLen = frame[offset + 1];
+        if (offset + 2 + ieLen > len) {
+            cut = true;
+            return false;
+        }
+        out.id = frame[offset];
+        out.len = ieLen;
+        out.data = frame + offset + 2;
+        offset = (uint16_t)(offset + 2 + ieLen);
+        return true;
+    }
+
+    bool truncated() const { return cut; }
+
+private:
+    const uint8_t* frame;
+    uint16_t len;
+    uint16_t offset;
+    bool cut;
+};
+
+struct RSNInfo {
+    bool present;
+    bool capsPresent;       // RSN capabilities field was inside the IE
+    uint16_t version;
+    uint16_t pairwiseCount;
+    uint16_t akmCount;
+    uint16_t capabilities;
+    bool mfpc;
+    bool mfpr;
+    bool akmPSK;            // PSK, FT-PSK, PSK-SHA256
+    bool akmSAE;            // SAE, FT-SAE
+    bool akm8021X;          // 802.1X variants (enterprise)
+};
+
+// Parse an RSN IE body (after id/len). Walks the real suite counts, so
+// APs advertising several pairwise ciphers or AKMs are handled.
+// Returns false if the body is malformed before the AKM list ends.
+inline bool parseRSN(const uint8_t* data, uint8_t len, RSNInfo& out) {
+    memset(&out, 0, sizeof(out));
+    out.present = true;
+    if (len < 2) return false;
+    out.version = (uint16_t)(data[0] | (data[1] << 8));
+
+    // Version(2) + Group cipher(4); everything after is optional per spec
+    uint16_t pos = 6;
+    if (pos + 2 > len) return len == 2 || len == 6;
+    out.pairwiseCount = (uint16_t)(data[pos] | (data[pos + 1] << 8));
+    // Widen before the multiply: a count of 0x4000 would wrap a uint16_t back
+    // inside the IE and parse pairwise bytes as the AKM list
+    uint32_t akmPos = (uint32_t)pos + 2 + (uint32_t)out.pairwiseCount * 4;
+    if (akmPos > len) return false;
+    pos = (uint16_t)akmPos;
+
+    if (pos + 2 > len) return pos == len;
+    out.akmCount = (uint16_t)(data[pos] | (data[pos + 1] << 8));
+    pos += 2;
+    if (pos + out.akmCount * 4 > len) return false;
+    for (uint16_t i = 0; i < out.akmCount; i++, pos += 4) {
+        const uint8_t* s = data + pos;
+        if (s[0] != 0x00 || s[1] != 0x0F || s[2] != 0xAC) continue;
+        switch (s[3]) {
+            case kAkmPSK:
+            case kAkmFTPSK:
+            case kAkmPSKSHA256:
+                out.akmPSK = true;
+                break;
+            case kAkmSAE:
+            case kAkmFTSAE:
+                out.akmSAE = true;
+                break;
+            case kAkm8021X:
+            case kAkmFT8021X:
+            case kAkm8021XSHA256:
+                out.akm8021X = true;
+                break;
+            default:
+                break;
+        }
+    }
+
+    if (pos + 2 <= len) {
+        out.capabilities = (uint16_t)(data[pos] | (data[pos + 1] << 8));
+        out.capsPresent = true;
+        out.mfpc = (out.capabilities & kRsnCapMFPC) != 0;
+        out.mfpr = (out.capabilities & kRsnCapMFPR) != 0;
+    }
+    return true;
+}
+
+// WPA1 vendor IE: OUI 00:50:F2, type 1
+inline bool isWPAVendorIE(const IE& ie) {
+    return ie.id == kIdVendor && ie.len >= 8 &&
+           ie.data[0] == 0x00 && ie.data[1] == 0x50 &&
+           ie.data[2] == 0xF2 && ie.data[3] == 0x01;
+}
+
+struct BeaconInfo {
+    const uint8_t* ssid;    // Points into the frame (not NUL-terminated)
+    uint8_t ssidLen;
+    bool ssidPresent;       // SSID IE seen with a valid length (0..32)
+    bool hidden;            // SSID IE zero-length or all NUL bytes
+    uint8_t dsChannel;      // DS Parameter Set channel, 0 if absent
+    bool hasWPA;            // WPA1 vendor IE
+    RSNInfo rsn;
+    bool truncated;         // IE list ran past the frame end
+
+    // PMF advertised (MFPC; MFPR implies MFPC per spec). Clients that
+    // support PMF will negotiate it, so deauth is unreliable.
+    bool hasPMF() const { return rsn.present && rsn.mfpc; }
+
+    // Copy SSID into a 33-byte buffer. Hidden SSIDs copy as "".
+    void copySSID(char* out) const {
+        uint8_t n = (ssidPresent && !hidden) ? ssidLen : 0;
+        if (n) memcpy(out, ssid, n);
+        out[n] = 0;
+    }
+};
+
+/**
+ * Single pass over the IE list extracting SSID, DS channel, RSN and WPA.
+ * @param frame Full 802.11 management frame (header included)
+ * @param ieOffset Start of tagged parameters (kBeaconIEOffset for beacons
+ *                 and probe responses)
+ * @return false if the frame is too short to hold any IEs
+ */
+inline bool parse(const uint8_t* frame, uint16_t len, BeaconInfo& out,
+                  uint16_t ieOffset = kBeaconIEOffset) {
+    memset(&out, 0, sizeof(out));
+    if (!frame || len < ieOffset) return false;
+
+    Iterator it(frame, len, ieOffset);
+    IE ie;
+    while (it.next(ie)) {
+        switch (ie.id) {
+            case kIdSSID:
+                if (!out.ssidPresent && ie.len <= 32) {
+                    out.ssidPresent = true;
+                    out.ssid = ie.data;
+                    out.ssidLen = ie.len;
+                    bool allNull = true;
+                    for (uint8_t i = 0; i < ie.len; i++) {
+                        if (ie.data[i] != 0) { allNull = false; break; }
+                    }
+                    out.hidden = allNull;  // Also true for zero length
+                }
+                break;
+            case kIdDSParams:
+                if (ie.len == 1) out.dsChannel = ie.data[0];
+                break;
+            case kIdRSN:
+                if (!out.rsn.present) parseRSN(ie.data, ie.len, out.rsn);
+                break;
+            case kIdVendor:
+                if (isWPAVendorIE(ie)) out.hasWPA = true;
+                break;
+            default:
+                break;
+        }
+    }
+    out.truncated = it.truncated();
+    return true;
+}
+
+// Map parsed security IEs to the driver's auth mode enum.
+inline wifi_auth_mode_t authMode(const BeaconInfo& info) {
+    if (info.rsn.present) {
+        const RSNInfo& r = info.rsn;
+        if (r.akmSAE && r.akmPSK) return WIFI_AUTH_WPA2_WPA3_PSK;
+        if (r.akmSAE) return WIFI_AUTH_WPA3_PSK;
+        if (r.akm8021X && !r.akmPSK) return WIFI_AUTH_WPA2_ENTERPRISE;
+        if (r.akmCount == 0 && r.mfpr) return WIFI_AUTH_WPA3_PSK;  // Truncated RSN, PMF required
+        return info.hasWPA ? WIFI_AUTH_WPA_WPA2_PSK : WIFI_AUTH_WPA2_PSK;
+    }
+    if (info.hasWPA) return WIFI_AUTH_WPA_PSK;
+    return WIFI_AUTH_OPEN;
+}
+
+}  // namespace IEParser
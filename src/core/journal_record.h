@@ -0,0 +1,377 @@
+// JournalRecord - Record format of the append-only capture journal
+// Every EAPOL frame, PMKID, SSID and beacon deferred out of the promiscuous
+// callback is appended as one CRC-checked record. The scanner resyncs on the
+// magic after torn or corrupt bytes, so a brownout mid-write costs at most
+// the record being written.
+// Header-only, no Arduino dependencies (unit tested on native).
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include "crc32.h"
+
+namespace JournalRecord {
+
+// Header: magic "PJ"(2) type(1) flags(1) payloadLen(2 LE) crc32(4 LE)
+// CRC covers type, flags, length and payload.
+static const uint8_t kMagic0 = 'P';
+static const uint8_t kMagic1 = 'J';
+static const uint16_t kHeaderLen = 10;
+static const uint16_t kMaxPayload = 1536;          // Largest beacon we keep + MAC
+static const uint16_t kMaxRecord = kHeaderLen + kMaxPayload;
+
+enum Type : uint8_t {
+    kSession = 1,    // sessionId(4) epoch(4): frames only pair within a session
+    kEapol = 2,      // One EAPOL-Key message (M1-M4)
+    kPmkid = 3,      // PMKID from an M1
+    kSsid = 4,       // SSID learned for a BSSID after its captures
+    kBeacon = 5,     // Beacon for the handshake PCAP
+    kExported = 6    // .22000/.pcap written for bssid/station
+};
+
+// kEapol flags
+static const uint8_t kFlagShared = 0x01;          // EAPOL is the tail of the full frame
+
+// kExported kinds
+static const uint8_t kKindHandshake = 1;
+static const uint8_t kKindPmkid = 2;
+
+static const uint16_t kEapolFixed = 22;            // bssid station msg rssi ts eapolLen fullLen
+static const uint16_t kMaxEapolLen = 512;
+static const uint16_t kMaxFullLen = 300;
+static const uint16_t kMaxBeaconLen = kMaxPayload - 6;
+
+inline void put16(uint8_t* p, uint16_t v) { p[0] = (uint8_t)v; p[1] = (uint8_t)(v >> 8); }
+inline void put32(uint8_t* p, uint32_t v) {
+    p[0] = (uint8_t)v; p[1] = (uint8_t)(v >> 8); p[2] = (uint8_t)(v >> 16); p[3] = (uint8_t)(v >> 24);
+}
+inline uint16_t get16(const uint8_t* p) { return (uint16_t)(p[0] | (p[1] << 8)); }
+inline uint32_t get32(const uint8_t* p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+// Fill in the header once the payload at out + kHeaderLen is in place
+inline size_t seal(uint8_t* out, uint8_t type, uint8_t flags, uint16_t payloadLen) {
+    out[0] = kMagic0;
+    out[1] = kMagic1;
+    out[2] = type;
+    out[3] = flags;
+    put16(out + 4, payloadLen);
+    uint32_t crc = crc32Update(0, out + 2, 4);
+    crc = crc32Update(crc, out + kHeaderLen, payloadLen);
+    put32(out + 6, crc);
+    return (size_t)kHeaderLen + payloadLen;
+}
+
+// ============================================================================
+// Encoders - return the record length, 0 if cap is too small
+// ============================================================================
+
+inline size_t encodeSession(uint8_t* out, size_t cap, uint32_t sessionId, uint32_t epoch) {
+    if (cap < kHeaderLen + 8u) return 0;
+    put32(out + kHeaderLen, sessionId);
+    put32(out + kHeaderLen + 4, epoch);
+    return seal(out, kSession, 0, 8);
+}
+
+/**
+ * fullFrame may be nullptr. Lengths clamp like the RAM slab (512/300).
+ * When the EAPOL payload is the tail of the full frame it is stored once.
+ */
+inline size_t encodeEapol(uint8_t* out, size_t cap,
+                          const uint8_t* bssid, const uint8_t* station,
+                          uint8_t msgIdx, int8_t rssi, uint32_t timestamp,
+                          const uint8_t* eapol, uint16_t eapolLen,
+                          const uint8_t* fullFrame, uint16_t fullLen) {
+    if (!eapol || eapolLen == 0 || msgIdx > 3) return 0;
+    if (eapolLen > kMaxEapolLen) eapolLen = kMaxEapolLen;
+    if (!fullFrame) fullLen = 0;
+    if (fullLen > kMaxFullLen) fullLen = kMaxFullLen;
+    bool shared = fullLen >= eapolLen &&
+                  memcmp(fullFrame + fullLen - eapolLen, eapol, eapolLen) == 0;
+    uint16_t payload = (uint16_t)(kEapolFixed + fullLen + (shared ? 0 : eapolLen));
+    if (cap < (size_t)kHeaderLen + payload) return 0;
+
+    uint8_t* p = out + kHeaderLen;
+    memcpy(p, bssid, 6);
+    memcpy(p + 6, station, 6);
+    p[12] = msgIdx;
+    p[13] = (uint8_t)rssi;
+    put32(p + 14, timestamp);
+    put16(p + 18, eapolLen);
+    put16(p + 20, fullLen);
+    if (fullLen) memcpy(p + kEapolFixed, fullFrame, fullLen);
+    if (!shared) memcpy(p + kEapolFixed + fullLen, eapol, eapolLen);
+    return seal(out, kEapol, shared ? kFlagShared : 0, payload);
+}
+
+inline size_t encodePmkid(uint8_t* out, size_t cap,
+                          const uint8_t* bssid, const uint8_t* station,
+                          const uint8_t* pmkid, uint32_t timestamp, const char* ssid) {
+    size_t ssidLen = ssid ? strnlen(ssid, 32) : 0;
+    uint16_t payload = (uint16_t)(6 + 6 + 16 + 4 + 1 + ssidLen);
+    if (cap < (size_t)kHeaderLen + payload) return 0;
+    uint8_t* p = out + kHeaderLen;
+    memcpy(p, bssid, 6);
+    memcpy(p + 6, station, 6);
+    memcpy(p + 12, pmkid, 16);
+    put32(p + 28, timestamp);
+    p[32] = (uint8_t)ssidLen;
+    if (ssidLen) memcpy(p + 33, ssid, ssidLen);
+    return seal(out, kPmkid, 0, payload);
+}
+
+inline size_t encodeSsid(uint8_t* out, size_t cap, const uint8_t* bssid, const char* ssid) {
+    size_t ssidLen = ssid ? strnlen(ssid, 32) : 0;
+    uint16_t payload = (uint16_t)(6 + 1 + ssidLen);
+    if (ssidLen == 0 || cap < (size_t)kHeaderLen + payload) return 0;
+    uint8_t* p = out + kHeaderLen;
+    memcpy(p, bssid, 6);
+    p[6] = (uint8_t)ssidLen;
+    memcpy(p + 7, ssid, ssidLen);
+    return seal(out, kSsid, 0, payload);
+}
+
+inline size_t encodeBeacon(uint8_t* out, size_t cap, const uint8_t* bssid,
+                           const uint8_t* frame, uint16_t len) {
+    if (!frame || len == 0 || len > kMaxBeaconLen) return 0;
+    uint16_t payload = (uint16_t)(6 + len);
+    if (cap < (size_t)kHeaderLen + payload) return 0;
+    memcpy(out + kHeaderLen, bssid, 6);
+    memcpy(out + kHeaderLen + 6, frame, len);
+    return seal(out, kBeacon, 0, payload);
+}
+
+inline size_t encodeExported(uint8_t* out, size_t cap, const uint8_t* bssid,
+                             const uint8_t* station, uint8_t kind) {
+    if (cap < kHeaderLen + 13u) return 0;
+    uint8_t* p = out + kHeaderLen;
+    memcpy(p, bssid, 6);
+    memcpy(p + 6, station, 6);
+    p[12] = kind;
+    return seal(out, kExported, 0, 13);
+}
+
+// ============================================================================
+// Decoders - views into the record payload
+// ============================================================================
+
+struct Record {
+    uint8_t type;
+    uint8_t flags;
+    uint16_t len;
+    const uint8_t* payload;
+};
+
+struct Eapol {
+    const uint8_t* bssid;
+    const uint8_t* station;
+    uint8_t msgIdx;              // 0-3 for M1-M4
+    int8_t rssi;
+    uint32_t timestamp;
+    const uint8_t* eapol;
+    uint16_t eapolLen;
+    const uint8_t* fullFrame;    // nullptr when not kept
+    uint16_t fullLen;
+};
+
+struct Pmkid {
+    const uint8_t* bssid;
+    const uint8_t* station;
+    const uint8_t* pmkid;
+    uint32_t timestamp;
+    char ssid[33];
+};
+
+inline bool decodeSession(const Record& r, uint32_t& sessionId, uint32_t& epoch) {
+    if (r.type != kSession || r.len < 8) return false;
+    sessionId = get32(r.payload);
+    epoch = get32(r.payload + 4);
+    return true;
+}
+
+inline bool decodeEapol(const Record& r, Eapol& out) {
+    if (r.type != kEapol || r.len < kEapolFixed) return false;
+    const uint8_t* p = r.payload;
+    out.bssid = p;
+    out.station = p + 6;
+    out.msgIdx = p[12];
+    out.rssi = (int8_t)p[13];
+    out.timestamp = get32(p + 14);
+    out.eapolLen = get16(p + 18);
+    out.fullLen = get16(p + 20);
+    bool shared = (r.flags & kFlagShared) != 0;
+    uint32_t need = (uint32_t)kEapolFixed + out.fullLen + (shared ? 0 : out.eapolLen);
+    if (out.msgIdx > 3 || out.eapolLen == 0 || need != r.len) return false;
+    if (shared && out.eapolLen > out.fullLen) return false;
+    out.fullFrame = out.fullLen ? p + kEapolFixed : nullptr;
+    out.eapol = shared ? p + kEapolFixed + out.fullLen - out.eapolLen
+                       : p + kEapolFixed + out.fullLen;
+    return true;
+}
+
+inline bool decodePmkid(const Record& r, Pmkid& out) {
+    if (r.type != kPmkid || r.len < 33) return false;
+    const uint8_t* p = r.payload;
+    uint8_t ssidLen = p[32];
+    if (ssidLen > 32 || r.len != 33u + ssidLen) return false;
+    out.bssid = p;
+    out.station = p + 6;
+    out.pmkid = p + 12;
+    out.timestamp = get32(p + 28);
+    memcpy(out.ssid, p + 33, ssidLen);
+    out.ssid[ssidLen] = '\0';
+    return true;
+}
+
+inline bool decodeSsid(const Record& r, const uint8_t*& bssid, char* ssid33) {
+    if (r.type != kSsid || r.len < 7) return false;
+    uint8_t ssidLen = r.payload[6];
+    if (ssidLen == 0 || ssidLen > 32 || r.len != 7u + ssidLen) return false;
+    bssid = r.payload;
+    memcpy(ssid33, r.payload + 7, ssidLen);
+    ssid33[ssidLen] = '\0';
+    return true;
+}
+
+inline bool decodeBeacon(const Record& r, const uint8_t*& bssid,
+                         const uint8_t*& frame, uint16_t& len) {
+    if (r.type != kBeacon || r.len <= 6) return false;
+    bssid = r.payload;
+    frame = r.payload + 6;
+    len = (uint16_t)(r.len - 6);
+    return true;
+}
+
+inline bool decodeExported(const Record& r, const uint8_t*& bssid,
+                           const uint8_t*& station, uint8_t& kind) {
+    if (r.type != kExported || r.len != 13) return false;
+    bssid = r.payload;
+    station = r.payload + 6;
+    kind = r.payload[12];
+    return true;
+}
+
+// ============================================================================
+// Scanner
+// ============================================================================
+
+/**
+ * Pulls records out of a byte stream through a caller-owned window of at
+ * least 2 * kMaxRecord bytes. ReadFn: size_t(uint8_t* dst, size_t max),
+ * returning 0 at end of stream.
+ *
+ * Bytes that don't start a valid record (bad magic, oversize length, CRC
+ * mismatch) are skipped one at a time until the next good header, so one
+ * bad record never hides the ones after it. An incomplete record at the end
+ * of the stream is a torn append and is reported as tailBytes.
+ * Record payload pointers stay valid until the next call to next().
+ */
+template <typename ReadFn>
+class Scanner {
+public:
+    Scanner(uint8_t* window, size_t windowLen, ReadFn read)
+        : buf(window), cap(windowLen), readFn(read), start(0), end(0), eof(false),
+          records(0), skipped(0), tail(0) {}
+
+    bool next(Record& out) {
+        while (true) {
+            refill();
+            size_t avail = end - start;
+            if (avail == 0) return false;
+            const uint8_t* p = buf + start;
+
+            if (p[0] != kMagic0 || (avail > 1 && p[1] != kMagic1)) {
+                skip(1);
+                continue;
+            }
+            if (avail < kHeaderLen) {
+                // Only reachable at end of stream (window holds >= kMaxRecord)
+                tail += (uint32_t)avail;
+                start = end;
+                return false;
+            }
+            uint16_t len = get16(p + 4);
+            if (len > kMaxPayload) {
+                skip(1);
+                continue;
+            }
+            if (avail < (size_t)kHeaderLen + len) {
+                // Torn last record - or a corrupt length; resync past it
+                // in case whole records follow.
+                if (resyncFrom(1)) {
+                    skipped += 1;
+                    start += 1;
+                    continue;
+                }
+                tail += (uint32_t)avail;
+                start = end;
+                return false;
+            }
+            uint32_t crc = crc32Update(0, p + 2, 4);
+            crc = crc32Update(crc, p + kHeaderLen, len);
+            if (crc != get32(p + 6)) {
+                skip(1);
+                continue;
+            }
+            out.type = p[2];
+            out.flags = p[3];
+            out.len = len;
+            out.payload = p + kHeaderLen;
+            start += (size_t)kHeaderLen + len;
+            records++;
+            return true;
+        }
+    }
+
+    uint32_t recordCount() const { return records; }
+    uint32_t skippedBytes() const { return skipped; }   // Corrupt bytes stepped over
+    uint32_t tailBytes() const { return tail; }         // Incomplete record at the end
+
+private:
+    void skip(size_t n) {
+        start += n;
+        skipped += (uint32_t)n;
+    }
+
+    // Keep at least kMaxRecord bytes in the window until the stream ends
+    void refill() {
+        if (eof || end - start >= kMaxRecord) return;
+        if (start > 0) {
+            memmove(buf, buf + start, end - start);
+            end -= start;
+            start = 0;
+        }
+        while (!eof && end < cap) {
+            size_t n = readFn(buf + end, cap - end);
+            if (n == 0) eof = true;
+            end += n;
+        }
+    }
+
+    // Is there another magic after offset `from` in what's buffered?
+    bool resyncFrom(size_t from) const {
+        for (size_t i = start + from; i + 1 < end; i++) {
+            if (buf[i] == kMagic0 && buf[i + 1] == kMagic1) return true;
+        }
+        return false;
+    }
+
+    uint8_t* buf;
+    size_t cap;
+    ReadFn readFn;
+    size_t start;
+    size_t end;
+    bool eof;
+    uint32_t records;
+    uint32_t skipped;
+    uint32_t tail;
+};
+
+template <typename ReadFn>
+Scanner<ReadFn> makeScanner(uint8_t* window, size_t windowLen, ReadFn read) {
+    return Scanner<ReadFn>(window, windowLen, read);
+}
+
+}  // namespace JournalRecord
@@ -0,0 +1,439 @@
+// JournalReplay - What a capture journal recovery pass exports and keeps
+// Recovery reads the journal three times: index() learns the export
+// markers, SSIDs and which M1-M4 frames every (session, AP, station) has;
+// collect() rebuilds the captures to export this pass in bounded slots;
+// compact() copies only what is still undecided into the new journal.
+// Every key is decided once - exported, exported as a partial PCAP, or
+// dropped when it holds nothing but an M1 - so leftovers can't starve the
+// slots of later passes and the journal shrinks on every pass.
+// Header-only, no Arduino dependencies (unit tested on native).
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+#include "eapol_slab.h"
+#include "journal_record.h"
+
+namespace JournalReplay {
+
+using JournalRecord::Record;
+
+// Handshake keys tracked per pass (M1-only exchanges included)
+static const size_t kMaxKeys = 512;
+// Captures rebuilt with their frames per pass
+static const size_t kMaxHandshakes = 32;
+static const size_t kMaxPmkids = 64;
+
+// M1+M2 or M2+M3, same rule as CapturedHandshake::hasValidPair()
+inline bool validPair(uint8_t mask) {
+    return ((mask & 0x03) == 0x03) || ((mask & 0x06) == 0x06);
+}
+
+// Anything past M1 carries a MIC; an M1 alone has nothing to crack
+inline bool hasMic(uint8_t mask) {
+    return (mask & 0x0E) != 0;
+}
+
+struct Handshake {
+    uint32_t session;
+    uint8_t bssid[6];
+    uint8_t station[6];
+    uint32_t lastSeen;
+    bool partial;                 // No crackable pair: PCAP only
+    char ssid[33];
+    std::vector<uint8_t> beacon;
+    HandshakeFrames frames;
+};
+
+struct Pmkid {
+    uint32_t session;
+    uint8_t bssid[6];
+    uint8_t station[6];
+    uint8_t pmkid[16];
+    uint32_t timestamp;
+    char ssid[33];
+    bool done;
+};
+
+struct Counts {
+    uint32_t droppedM1Only;       // Decided this pass: nothing to export
+    uint32_t waitingPmkids;       // Kept until an SSID turns up
+    uint32_t deferred;            // Over this pass's limits, next pass
+};
+
+class Replay {
+public:
+    Replay() : session(0), writtenSession(0), sessionLen(0), kept(0), keysFull(false),
+               pmkidsFull(false) {
+        hs.reserve(kMaxHandshakes);
+        memset(&counts, 0, sizeof(counts));
+    }
+
+    // ---- Pass 1 ----------------------------------------------------------
+
+    void index(const Record& r) {
+        if (trackSession(r)) return;
+        const uint8_t* bssid;
+        const uint8_t* station;
+        uint8_t kind;
+        char ssid[33];
+        JournalRecord::Eapol e;
+        JournalRecord::Pmkid pm;
+        if (JournalRecord::decodeEapol(r, e)) {
+            Key* k = keyFor(e.bssid, e.station, true);
+            if (k) k->mask |= (uint8_t)(1 << e.msgIdx);
+        } else if (JournalRecord::decodeExported(r, bssid, station, kind)) {
+            if (kind == JournalRecord::kKindHandshake) {
+                Key* k = keyFor(bssid, station, true);
+                if (k) k->state = kDone;
+            } else if (pmkidDone.size() < kMaxKeys) {
+                pmkidDone.push_back(makeKey(bssid, station));
+            }
+        } else if (JournalRecord::decodeSsid(r, bssid, ssid)) {
+            setSsid(bssid, ssid);
+        } else if (JournalRecord::decodePmkid(r, pm) && pm.ssid[0] != 0) {
+            setSsid(pm.bssid, pm.ssid);
+        }
+    }
+
+    // Between passes: M1-only exchanges are settled without a slot
+    void decide() {
+        for (auto& k : keys) {
+            if (k.state != kPending || hasMic(k.mask)) continue;
+            k.state = kDone;
+            counts.droppedM1Only++;
+        }
+        session = 0;
+    }
+
+    // ---- Pass 2 ----------------------------------------------------------
+
+    /**
+     * Rebuild the captures exported this pass.
+     * @param slotOk false when another handshake slot can't be afforded (heap)
+     */
+    void collect(const Record& r, bool slotOk) {
+        if (trackSession(r)) return;
+        JournalRecord::Eapol e;
+        JournalRecord::Pmkid pm;
+        const uint8_t* bssid;
+        const uint8_t* frame;
+        uint16_t frameLen;
+        if (JournalRecord::decodeEapol(r, e)) {
+            Key* k = keyFor(e.bssid, e.station, false);
+            if (!k || k->state != kPending) return;
+            Handshake* h = slotFor(*k, slotOk);
+            if (!h) return;
+            h->frames.store(e.msgIdx, e.eapol, e.eapolLen, e.fullFrame, e.fullLen, e.timestamp, e.rssi);
+            h->lastSeen = e.timestamp;
+        } else if (JournalRecord::decodeBeacon(r, bssid, frame, frameLen)) {
+            for (auto& h : hs) {
+                if (h.session != session || !h.beacon.empty() || memcmp(h.bssid, bssid, 6) != 0) continue;
+                h.beacon.assign(frame, frame + frameLen);
+            }
+        } else if (JournalRecord::decodePmkid(r, pm)) {
+            collectPmkid(pm);
+        }
+    }
+
+    // Finish pass 2: SSIDs for everything rebuilt
+    void resolve() {
+        for (auto& h : hs) {
+            if (h.ssid[0] == 0) copySsid(h.ssid, ssidFor(h.bssid));
+        }
+        session = 0;
+    }
+
+    std::vector<Handshake>& handshakes() { return hs; }
+    std::vector<Pmkid>& pmkids() { return pm; }
+
+    // Export outcome; a failed one stays in the journal for the next pass
+    void finished(const Handshake& h, bool ok) {
+        if (!ok) return;
+        Key* k = find(h.session, h.bssid, h.station);
+        if (k) k->state = kDone;
+    }
+
+    void finished(Pmkid& p, bool ok) {
+        p.done = ok;
+    }
+
+    // ---- Pass 3 ----------------------------------------------------------
+
+    /**
+     * Copy r into the new journal if it is still needed. Session markers
+     * are copied lazily, ahead of the first kept record of their session,
+     * so sessions with nothing left vanish.
+     * Write: bool(const uint8_t* bytes, size_t len)
+     * @return false on a write failure
+     */
+    template <typename Write>
+    bool compact(const Record& r, Write& write) {
+        const uint8_t* raw = r.payload - JournalRecord::kHeaderLen;
+        size_t rawLen = (size_t)JournalRecord::kHeaderLen + r.len;
+        if (r.type == JournalRecord::kSession) {
+            uint32_t epoch;
+            if (!JournalRecord::decodeSession(r, session, epoch)) return true;
+            if (rawLen <= sizeof(sessionRec)) {
+                memcpy(sessionRec, raw, rawLen);
+                sessionLen = rawLen;
+            }
+            return true;
+        }
+        if (!keep(r)) return true;
+        if (sessionLen && writtenSession != session) {
+            if (!write(sessionRec, sessionLen)) return false;
+            writtenSession = session;
+        }
+        if (!write(raw, rawLen)) return false;
+        kept++;
+        return true;
+    }
+
+    // Records pass 3 kept (0: the journal can go)
+    size_t keptRecords() const { return kept; }
+
+    // Undecided captures left after this pass
+    bool morePending() const {
+        if (keysFull || pmkidsFull) return true;
+        for (const auto& k : keys) {
+            if (k.state == kPending) return true;
+        }
+        return false;
+    }
+
+    const Counts& getCounts() const { return counts; }
+
+private:
+    enum KeyState : uint8_t {
+        kPending = 0,
+        kDone = 1
+    };
+
+    static const int16_t kDeferred = -2;
+
+    struct Key {
+        uint32_t session;
+        uint8_t bssid[6];
+        uint8_t station[6];
+        uint8_t mask;       // M1-M4 seen in the journal
+        uint8_t state;
+        int16_t slot;       // Index into hs, -1 while not rebuilt, kDeferred
+    };
+
+    struct SsidEntry {
+        uint8_t bssid[6];
+        char ssid[33];
+    };
+
+    static void copySsid(char* dst, const char* src) {
+        size_t n = strnlen(src, 32);
+        memcpy(dst, src, n);
+        dst[n] = '\0';
+    }
+
+    bool trackSession(const Record& r) {
+        uint32_t epoch;
+        return JournalRecord::decodeSession(r, session, epoch);
+    }
+
+    Key makeKey(const uint8_t* bssid, const uint8_t* station) const {
+        Key k;
+        memset(&k, 0, sizeof(k));
+        k.session = session;
+        memcpy(k.bssid, bssid, 6);
+        memcpy(k.station, station, 6);
+        k.slot = -1;
+        return k;
+    }
+
+    Key* find(uint32_t s, const uint8_t* bssid, const uint8_t* station) {
+        for (auto& k : keys) {
+            if (k.session == s && memcmp(k.bssid, bssid, 6) == 0 && memcmp(k.station, station, 6) == 0) {
+                return &k;
+            }
+        }
+        return nullptr;
+    }
+
+    const Key* find(uint32_t s, const uint8_t* bssid, const uint8_t* station) const {
+        return const_cast<Replay*>(this)->find(s, bssid, station);
+    }
+
+    Key* keyFor(const uint8_t* bssid, const uint8_t* station, bool create) {
+        Key* k = find(session, bssid, station);
+        if (k || !create) return k;
+        if (keys.size() >= kMaxKeys) {
+            keysFull = true;   // Its records stay in the journal for the next pass
+            return nullptr;
+        }
+        keys.push_back(makeKey(bssid, station));
+        return &keys.back();
+    }
+
+    Handshake* slotFor(Key& k, bool slotOk) {
+        if (k.slot >= 0) return &hs[k.slot];
+        if (k.slot == kDeferred) return nullptr;
+        if (hs.size() >= kMaxHandshakes || !slotOk) {
+            counts.deferred++;
+            k.slot = kDeferred;    // Stays pending for the next pass
+            return nullptr;
+        }
+        hs.emplace_back();
+        Handshake& h = hs.back();
+        h.session = k.session;
+        memcpy(h.bssid, k.bssid, 6);
+        memcpy(h.station, k.station, 6);
+        h.lastSeen = 0;
+        h.partial = !validPair(k.mask);
+        h.ssid[0] = '\0';
+        h.frames.clear();
+        k.slot = (int16_t)(hs.size() - 1);
+        return &h;
+    }
+
+    bool pmkidMarked(uint32_t s, const uint8_t* bssid, const uint8_t* station) const {
+        for (const auto& k : pmkidDone) {
+            if (k.session == s && memcmp(k.bssid, bssid, 6) == 0 && memcmp(k.station, station, 6) == 0) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    Pmkid* findPmkid(uint32_t s, const uint8_t* bssid, const uint8_t* station) {
+        for (auto& p : pm) {
+            if (p.session == s && memcmp(p.bssid, bssid, 6) == 0 && memcmp(p.station, station, 6) == 0) {
+                return &p;
+            }
+        }
+        return nullptr;
+    }
+
+    const Pmkid* findPmkid(uint32_t s, const uint8_t* bssid, const uint8_t* station) const {
+        return const_cast<Replay*>(this)->findPmkid(s, bssid, station);
+    }
+
+    static bool zeroPmkid(const uint8_t* p) {
+        for (int i = 0; i < 16; i++) {
+            if (p[i] != 0) return false;
+        }
+        return true;
+    }
+
+    void collectPmkid(const JournalRecord::Pmkid& r) {
+        if (pmkidMarked(session, r.bssid, r.station) || zeroPmkid(r.pmkid)) return;
+        Pmkid* p = findPmkid(session, r.bssid, r.station);
+        if (p) {
+            memcpy(p->pmkid, r.pmkid, 16);
+            return;
+        }
+        const char* ssid = r.ssid[0] ? r.ssid : ssidFor(r.bssid);
+        if (ssid[0] == 0) {
+            counts.waitingPmkids++;    // Uncrackable without the SSID salt - keep
+            return;
+        }
+        if (pm.size() >= kMaxPmkids) {
+            pmkidsFull = true;
+            counts.deferred++;
+            return;
+        }
+        Pmkid n;
+        memset(&n, 0, sizeof(n));
+        n.session = session;
+        memcpy(n.bssid, r.bssid, 6);
+        memcpy(n.station, r.station, 6);
+        memcpy(n.pmkid, r.pmkid, 16);
+        n.timestamp = r.timestamp;
+        copySsid(n.ssid, ssid);
+        pm.push_back(n);
+    }
+
+    void setSsid(const uint8_t* bssid, const char* ssid) {
+        for (auto& s : ssids) {
+            if (memcmp(s.bssid, bssid, 6) == 0) {
+                copySsid(s.ssid, ssid);
+                return;
+            }
+        }
+        if (ssids.size() >= kMaxKeys) return;
+        SsidEntry e;
+        memcpy(e.bssid, bssid, 6);
+        copySsid(e.ssid, ssid);
+        ssids.push_back(e);
+    }
+
+    const char* ssidFor(const uint8_t* bssid) const {
+        for (const auto& s : ssids) {
+            if (memcmp(s.bssid, bssid, 6) == 0) return s.ssid;
+        }
+        return "";
+    }
+
+    bool pendingBssid(uint32_t s, const uint8_t* bssid, bool anySession) const {
+        for (const auto& k : keys) {
+            if (k.state == kPending && (anySession || k.session == s) &&
+                memcmp(k.bssid, bssid, 6) == 0) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // A PMKID whose export failed still needs its SSID next pass
+    bool unexportedPmkid(const uint8_t* bssid) const {
+        for (const auto& p : pm) {
+            if (!p.done && memcmp(p.bssid, bssid, 6) == 0) return true;
+        }
+        return false;
+    }
+
+    bool keep(const Record& r) const {
+        JournalRecord::Eapol e;
+        JournalRecord::Pmkid p;
+        const uint8_t* bssid;
+        const uint8_t* station;
+        const uint8_t* frame;
+        uint16_t frameLen;
+        uint8_t kind;
+        char ssid[33];
+        if (JournalRecord::decodeEapol(r, e)) {
+            const Key* k = find(session, e.bssid, e.station);
+            return k ? k->state == kPending : true;     // Unknown: table was full
+        }
+        if (JournalRecord::decodeBeacon(r, bssid, frame, frameLen)) {
+            return keysFull || pendingBssid(session, bssid, false);
+        }
+        if (JournalRecord::decodeSsid(r, bssid, ssid)) {
+            return keysFull || pmkidsFull || pendingBssid(session, bssid, true) ||
+                   unexportedPmkid(bssid);
+        }
+        if (JournalRecord::decodePmkid(r, p)) {
+            if (pmkidMarked(session, p.bssid, p.station) || zeroPmkid(p.pmkid)) return false;
+            const Pmkid* got = findPmkid(session, p.bssid, p.station);
+            return !got || !got->done;
+        }
+        if (JournalRecord::decodeExported(r, bssid, station, kind)) {
+            return false;   // Its capture is gone from the journal too
+        }
+        return false;       // Unknown record types don't survive compaction
+    }
+
+    uint32_t session;
+    uint32_t writtenSession;
+    uint8_t sessionRec[JournalRecord::kHeaderLen + 8];
+    size_t sessionLen;
+    size_t kept;
+    bool keysFull;
+    bool pmkidsFull;
+    Counts counts;
+    std::vector<Key> keys;
+    std::vector<Key> pmkidDone;
+    std::vector<SsidEntry> ssids;
+    std::vector<Handshake> hs;
+    std::vector<Pmkid> pm;
+};
+
+}  // namespace JournalReplay
@@ -0,0 +1,119 @@
+// LogRing - Single-producer/single-consumer byte ring for text log lines
+// Producer side is SDLog::log() (serialised by SDLog's spinlock), consumer
+// is the SD log writer task. Lines are all-or-nothing: a line that doesn't
+// fit is dropped and counted, never truncated. Lines may wrap the buffer
+// end, so the consumer reads in up to two contiguous spans.
+// Header-only, no Arduino dependencies (unit tested on native).
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+class LogRing {
+public:
+    LogRing() : buf(nullptr), size(0), head(0), tail(0), droppedLines(0),
+                pushedLines(0), highWaterMark(0) {}
+
+    // Attach backing storage. size is rounded down to a power of two so the
+    // free-running indices stay consistent across 2^32 wrap.
+    // Not safe while producer/consumer are active.
+    void attach(uint8_t* storage, uint32_t bytes) {
+        uint32_t pow2 = 0;
+        if (storage && bytes) {
+            pow2 = 1;
+            while (pow2 <= bytes / 2) pow2 <<= 1;
+        }
+        buf = storage;
+        size = pow2;
+        reset();
+    }
+
+    void reset() {
+        head.store(0, std::memory_order_relaxed);
+        tail.store(0, std::memory_order_relaxed);
+        droppedLines.store(0, std::memory_order_relaxed);
+        pushedLines.store(0, std::memory_order_relaxed);
+        highWaterMark.store(0, std::memory_order_relaxed);
+    }
+
+    bool attached() const { return buf != nullptr && size > 0; }
+    uint32_t capacity() const { return size; }
+
+    // Bytes waiting for the consumer. head/tail are free-running counters.
+    uint32_t used() const {
+        return head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire);
+    }
+
+    // Producer side. Returns false (and counts a drop) if the line doesn't fit.
+    bool append(const char* line, uint32_t len) {
+        if (!attached() || len == 0 || len > size) {
+            droppedLines.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        uint32_t h = head.load(std::memory_order_relaxed);
+        uint32_t t = tail.load(std::memory_order_acquire);
+        if (size - (h - t) < len) {
+            droppedLines.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        uint32_t at = h & (size - 1);
+        uint32_t first = size - at;
+        if (first > len) first = len;
+        memcpy(buf + at, line, first);
+        if (first < len) memcpy(buf, line + first, len - first);
+        head.store(h + len, std::memory_order_release);
+
+        pushedLines.fetch_add(1, std::memory_order_relaxed);
+        uint32_t fill = h + len - t;
+        if (fill > highWaterMark.load(std::memory_order_relaxed)) {
+            highWaterMark.store(fill, std::memory_order_relaxed);
+        }
+        return true;
+    }
+
+    // Consumer side: longest contiguous readable span (0 when empty)
+    uint32_t peek(const uint8_t*& data) const {
+        uint32_t t = tail.load(std::memory_order_relaxed);
+        uint32_t avail = head.load(std::memory_order_acquire) - t;
+        if (avail == 0) return 0;
+        uint32_t at = t & (size - 1);
+        uint32_t toEnd = size - at;
+        data = buf + at;
+        return avail < toEnd ? avail : toEnd;
+    }
+
+    // Copy up to maxLen queued bytes (across the wrap) without consuming
+    uint32_t copyOut(uint8_t* out, uint32_t maxLen) const {
+        uint32_t t = tail.load(std::memory_order_relaxed);
+        uint32_t avail = head.load(std::memory_order_acquire) - t;
+        uint32_t n = avail < maxLen ? avail : maxLen;
+        if (n == 0) return 0;
+        uint32_t at = t & (size - 1);
+        uint32_t first = size - at;
+        if (first > n) first = n;
+        memcpy(out, buf + at, first);
+        if (first < n) memcpy(out + first, buf, n - first);
+        return n;
+    }
+
+    void consume(uint32_t len) {
+        uint32_t avail = used();
+        if (len > avail) len = avail;
+        tail.store(tail.load(std::memory_order_relaxed) + len, std::memory_order_release);
+    }
+
+    uint32_t dropped() const { return droppedLines.load(std::memory_order_relaxed); }
+    uint32_t pushed() const { return pushedLines.load(std::memory_order_relaxed); }
+    uint32_t highWater() const { return highWaterMark.load(std::memory_order_relaxed); }
+
+private:
+    uint8_t* buf;
+    uint32_t size;
+    std::atomic<uint32_t> head;   // Total bytes ever appended
+    std::atomic<uint32_t> tail;   // Total bytes ever consumed
+    std::atomic<uint32_t> droppedLines;
+    std::atomic<uint32_t> pushedLines;
+    std::atomic<uint32_t> highWaterMark;
+};
@@ -0,0 +1,262 @@
+// MembershipFile - Text tracking list on SD with a hashed sidecar
+
+#include "membership_file.h"
+#include <SD.h>
+
+// Longest line kept as a key; longer lines are not entries
+static const size_t MEMBERSHIP_MAX_LINE = 192;
+// Hashes per sidecar read/write
+static const size_t MEMBERSHIP_IO_HASHES = 32;
+
+// Streams a text file line by line into a fixed buffer (no String)
+struct LineReader {
+    File& f;
+    uint8_t chunk[128];
+    int n;
+    int i;
+
+    explicit LineReader(File& file) : f(file), n(0), i(0) {}
+
+    // line gets the raw line (no '\n'); overlong lines come back flagged
+    bool next(char* line, size_t cap, size_t& len, bool& overlong) {
+        len = 0;
+        overlong = false;
+        bool any = false;
+        while (true) {
+            if (i >= n) {
+                n = f.read(chunk, sizeof(chunk));
+                i = 0;
+                if (n <= 0) return any;
+            }
+            any = true;
+            char c = (char)chunk[i++];
+            if (c == '\n') return true;
+            if (len < cap - 1) line[len++] = c;
+            else overlong = true;
+        }
+    }
+};
+
+MembershipFile::MembershipFile(KeyFn fn)
+    : keyFn(fn), loaded(false), dirty(false) {
+    path[0] = '\0';
+}
+
+bool MembershipFile::lineKey(const char* line, size_t len, char* out, size_t outLen) const {
+    const char* s = MembershipSet::trim(line, len);
+    if (len == 0) return false;
+    if (keyFn) return keyFn(s, len, out, outLen);
+    if (len >= outLen) return false;
+    memcpy(out, s, len);
+    out[len] = '\0';
+    return true;
+}
+
+void MembershipFile::indexPath(char* out, size_t len) const {
+    snprintf(out, len, "%s.set", path);
+}
+
+static bool statText(const char* path, uint32_t& size, uint32_t& mtime) {
+    File f = SD.open(path, FILE_READ);
+    if (!f) return false;
+    size = (uint32_t)f.size();
+    mtime = (uint32_t)f.getLastWrite();
+    f.close();
+    return true;
+}
+
+bool MembershipFile::load(const char* listPath) {
+    if (!listPath || !listPath[0]) {
+        // No list configured: empty, and add() refuses
+        release();
+        loaded = true;
+        return true;
+    }
+    if (loaded && strcmp(listPath, path) == 0) return true;
+
+    set.release();
+    strncpy(path, listPath, sizeof(path) - 1);
+    path[sizeof(path) - 1] = '\0';
+    dirty = false;
+    loaded = false;
+
+    if (!SD.exists(path)) {
+        loaded = true;
+        return true;
+    }
+    uint32_t textSize = 0;
+    uint32_t textMtime = 0;
+    if (!statText(path, textSize, textMtime)) return false;
+
+    if (!loadIndex(textSize, textMtime) && !rebuild()) {
+        set.release();
+        return false;
+    }
+    loaded = true;
+    return true;
+}
+
+bool MembershipFile::loadIndex(uint32_t textSize, uint32_t textMtime) {
+    char idx[sizeof(path) + 8];
+    indexPath(idx, sizeof(idx));
+    if (!SD.exists(idx)) return false;
+    File f = SD.open(idx, FILE_READ);
+    if (!f) return false;
+
+    uint8_t hdr[MembershipSet::kHeaderLen];
+    MembershipSet::Header h;
+    bool ok = f.read(hdr, sizeof(hdr)) == sizeof(hdr) &&
+              MembershipSet::decodeHeader(hdr, h) &&
+              h.textSize == textSize && h.textMtime == textMtime &&
+              f.size() == MembershipSet::kHeaderLen + (size_t)h.count * MembershipSet::kHashLen;
+    if (ok) {
+        set.clear();
+        set.reserve(h.count);
+        uint8_t buf[MEMBERSHIP_IO_HASHES * MembershipSet::kHashLen];
+        uint32_t left = h.count;
+        while (ok && left > 0) {
+            size_t n = left < MEMBERSHIP_IO_HASHES ? left : MEMBERSHIP_IO_HASHES;
+            size_t bytes = n * MembershipSet::kHashLen;
+            ok = f.read(buf, bytes) == bytes;
+            for (size_t i = 0; ok && i < n; i++) {
+                ok = set.appendSorted(MembershipSet::get64(buf + i * MembershipSet::kHashLen));
+            }
+            left -= n;
+        }
+    }
+    f.close();
+    if (!ok) set.clear();
+    return ok;
+}
+
+bool MembershipFile::rebuild() {
+    File f = SD.open(path, FILE_READ);
+    if (!f) return false;
+
+    set.clear();
+    static char line[MEMBERSHIP_MAX_LINE];
+    char key[MEMBERSHIP_MAX_LINE];
+    size_t len;
+    bool overlong;
+    uint32_t lines = 0;
+    LineReader reader(f);
+    while (reader.next(line, sizeof(line), len, overlong)) {
+        if (!overlong && lineKey(line, len, key, sizeof(key))) {
+            set.append(MembershipSet::hash(key));
+        }
+        if ((++lines & 63) == 0) yield();
+    }
+    f.close();
+    set.finish();
+
+    // A sidecar that can't be written only costs a rebuild next time
+    writeIndex();
+    Serial.printf("[MSET] Rebuilt %s: %u entries\n", path, (unsigned int)set.size());
+    return true;
+}
+
+bool MembershipFile::writeIndex() {
+    char idx[sizeof(path) + 8];
+    indexPath(idx, sizeof(idx));
+
+    MembershipSet::Header h;
+    h.count = (uint32_t)set.size();
+    if (!statText(path, h.textSize, h.textMtime)) {
+        if (SD.exists(idx)) SD.remove(idx);
+        return false;
+    }
+
+    File f = SD.open(idx, FILE_WRITE);
+    if (!f) return false;
+    uint8_t buf[MEMBERSHIP_IO_HASHES * MembershipSet::kHashLen];
+    MembershipSet::encodeHeader(buf, h);
+    bool ok = f.write(buf, MembershipSet::kHeaderLen) == MembershipSet::kHeaderLen;
+    const uint64_t* keys = set.data();
+    for (size_t i = 0; ok && i < h.count; i += MEMBERSHIP_IO_HASHES) {
+        size_t n = h.count - i < MEMBERSHIP_IO_HASHES ? h.count - i : MEMBERSHIP_IO_HASHES;
+        for (size_t j = 0; j < n; j++) {
+            MembershipSet::put64(buf + j * MembershipSet::kHashLen, keys[i + j]);
+        }
+        ok = f.write(buf, n * MembershipSet::kHashLen) == n * MembershipSet::kHashLen;
+    }
+    f.close();
+    // A short sidecar fails the size check on load
+    if (ok) dirty = false;
+    return ok;
+}
+
+bool MembershipFile::contains(const char* key) const {
+    if (!key || !key[0]) return false;
+    return set.contains(MembershipSet::hash(key));
+}
+
+bool MembershipFile::add(const char* key, bool saveNow) {
+    if (!loaded || !path[0] || !key || !key[0]) return false;
+    uint64_t h = MembershipSet::hash(key);
+    if (set.contains(h)) return false;
+
+    File f = SD.open(path, FILE_APPEND);
+    if (!f) return false;
+    f.println(key);
+    f.close();
+
+    set.insert(h);
+    dirty = true;
+    if (saveNow) saveIndex();
+    return true;
+}
+
+bool MembershipFile::remove(const char* key) {
+    if (!loaded || !path[0] || !key || !key[0]) return false;
+    uint64_t h = MembershipSet::hash(key);
+    if (!set.contains(h)) return false;
+
+    char tmp[sizeof(path) + 8];
+    snprintf(tmp, sizeof(tmp), "%s.tmp", path);
+    File in = SD.open(path, FILE_READ);
+    if (SD.exists(tmp)) SD.remove(tmp);
+    File out = SD.open(tmp, FILE_WRITE);
+    bool ok = in && out;
+    if (ok) {
+        // Overlong lines were never entries and are dropped with the key
+        static char line[MEMBERSHIP_MAX_LINE];
+        char lkey[MEMBERSHIP_MAX_LINE];
+        size_t len;
+        bool overlong;
+        LineReader reader(in);
+        while (ok && reader.next(line, sizeof(line), len, overlong)) {
+            if (overlong) continue;
+            if (lineKey(line, len, lkey, sizeof(lkey)) && MembershipSet::hash(lkey) == h) continue;
+            if (len > 0 && line[len - 1] == '\r') len--;
+            if (len == 0) continue;
+            ok = out.write((const uint8_t*)line, len) == len && out.write((const uint8_t*)"\n", 1) == 1;
+        }
+    }
+    if (in) in.close();
+    if (out) out.close();
+    if (ok) {
+        SD.remove(path);
+        ok = SD.rename(tmp, path);
+    }
+    if (!ok) {
+        if (SD.exists(tmp)) SD.remove(tmp);
+        return false;
+    }
+
+    set.remove(h);
+    dirty = true;
+    return saveIndex();
+}
+
+bool MembershipFile::saveIndex() {
+    if (!dirty || !path[0]) return true;
+    return writeIndex();
+}
+
+void MembershipFile::release() {
+    if (loaded) saveIndex();
+    set.release();
+    path[0] = '\0';
+    loaded = false;
+    dirty = false;
+}
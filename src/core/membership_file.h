@@ -0,0 +1,60 @@
+// MembershipFile - Text tracking list on SD with a hashed sidecar
+// The text list (one entry per line) stays the source of truth and what
+// users see in the file browser. "<list>.set" next to it holds the sorted
+// hashes plus the list's size/mtime when written; a missing or stale
+// sidecar is rebuilt from the text in one streaming pass. No entry cap.
+#pragma once
+
+#include <Arduino.h>
+#include "membership_set.h"
+
+class MembershipFile {
+public:
+    // Turn a trimmed list line into its key (NUL-terminated in out).
+    // Return false to skip the line. nullptr = the trimmed line as-is.
+    typedef bool (*KeyFn)(const char* line, size_t len, char* out, size_t outLen);
+
+    explicit MembershipFile(KeyFn keyFn = nullptr);
+
+    /**
+     * @brief Load the set for a list (sidecar, or rebuilt from the text)
+     * No-op if already loaded for the same path. A missing list is empty.
+     */
+    bool load(const char* path);
+    bool isLoaded() const { return loaded; }
+
+    // Keys are compared as given; callers pass them already normalized
+    bool contains(const char* key) const;
+
+    /**
+     * @brief Append key to the text list and the set
+     * @param saveNow write the sidecar now; batch callers pass false and
+     *        call saveIndex() once at the end
+     * @return false if already present or the append failed
+     */
+    bool add(const char* key, bool saveNow = true);
+
+    // Drop every line with this key (rewrites the text list)
+    bool remove(const char* key);
+
+    // Write the sidecar if entries were added since the last write
+    bool saveIndex();
+
+    size_t size() const { return set.size(); }
+
+    // Free the set (before TLS work); the next load() reads the sidecar
+    void release();
+
+private:
+    bool loadIndex(uint32_t textSize, uint32_t textMtime);
+    bool rebuild();
+    bool writeIndex();
+    bool lineKey(const char* line, size_t len, char* out, size_t outLen) const;
+    void indexPath(char* out, size_t len) const;
+
+    KeyFn keyFn;
+    MembershipSet::Set set;
+    char path[96];
+    bool loaded;
+    bool dirty;
+};
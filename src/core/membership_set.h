@@ -0,0 +1,139 @@
+// MembershipSet - Compact string set kept as sorted 64-bit hashes
+// Backs the "already uploaded / already awarded" lists (WPA-SEC, WiGLE,
+// XP awards). A membership test is a binary search over 8 bytes per entry
+// with no String allocation, and the sorted array is also the on-SD sidecar
+// format, so loading a list is one sequential read. At 64 bits a false
+// positive needs billions of entries before it becomes likely.
+// Header-only, no Arduino dependencies (unit tested on native).
+#pragma once
+
+#include <algorithm>
+#include <cctype>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace MembershipSet {
+
+// Sidecar: "MSET"(4) version(2) reserved(2) count(4) textSize(4) textMtime(4)
+//          then count hashes (8 bytes LE each), strictly ascending
+static const uint8_t kMagic[4] = {'M', 'S', 'E', 'T'};
+static const uint16_t kVersion = 1;
+static const uint16_t kHeaderLen = 20;
+static const uint16_t kHashLen = 8;
+
+struct Header {
+    uint32_t count;
+    uint32_t textSize;      // Sidecar is stale if the text list no longer matches
+    uint32_t textMtime;
+};
+
+inline void put32(uint8_t* p, uint32_t v) {
+    p[0] = (uint8_t)v; p[1] = (uint8_t)(v >> 8); p[2] = (uint8_t)(v >> 16); p[3] = (uint8_t)(v >> 24);
+}
+inline uint32_t get32(const uint8_t* p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+inline void put64(uint8_t* p, uint64_t v) {
+    put32(p, (uint32_t)v);
+    put32(p + 4, (uint32_t)(v >> 32));
+}
+inline uint64_t get64(const uint8_t* p) {
+    return (uint64_t)get32(p) | ((uint64_t)get32(p + 4) << 32);
+}
+
+inline void encodeHeader(uint8_t* out, const Header& h) {
+    memcpy(out, kMagic, 4);
+    out[4] = (uint8_t)kVersion;
+    out[5] = (uint8_t)(kVersion >> 8);
+    out[6] = 0;
+    out[7] = 0;
+    put32(out + 8, h.count);
+    put32(out + 12, h.textSize);
+    put32(out + 16, h.textMtime);
+}
+
+inline bool decodeHeader(const uint8_t* in, Header& h) {
+    if (memcmp(in, kMagic, 4) != 0) return false;
+    if ((uint16_t)(in[4] | (in[5] << 8)) != kVersion) return false;
+    h.count = get32(in + 8);
+    h.textSize = get32(in + 12);
+    h.textMtime = get32(in + 16);
+    return true;
+}
+
+// FNV-1a, 64-bit
+inline uint64_t hash(const char* s, size_t len) {
+    uint64_t h = 0xCBF29CE484222325ULL;
+    for (size_t i = 0; i < len; i++) {
+        h ^= (uint8_t)s[i];
+        h *= 0x100000001B3ULL;
+    }
+    return h;
+}
+
+inline uint64_t hash(const char* s) {
+    return s ? hash(s, strlen(s)) : hash("", 0);
+}
+
+// Trim surrounding whitespace (what String::trim() did to each list line)
+inline const char* trim(const char* s, size_t& len) {
+    while (len > 0 && isspace((unsigned char)*s)) { s++; len--; }
+    while (len > 0 && isspace((unsigned char)s[len - 1])) len--;
+    return s;
+}
+
+class Set {
+public:
+    bool contains(uint64_t h) const {
+        return std::binary_search(keys.begin(), keys.end(), h);
+    }
+
+    // false if already present
+    bool insert(uint64_t h) {
+        auto it = std::lower_bound(keys.begin(), keys.end(), h);
+        if (it != keys.end() && *it == h) return false;
+        keys.insert(it, h);
+        return true;
+    }
+
+    bool remove(uint64_t h) {
+        auto it = std::lower_bound(keys.begin(), keys.end(), h);
+        if (it == keys.end() || *it != h) return false;
+        keys.erase(it);
+        return true;
+    }
+
+    size_t size() const { return keys.size(); }
+    const uint64_t* data() const { return keys.data(); }
+
+    void clear() { keys.clear(); }
+
+    // Return the heap (before TLS work)
+    void release() {
+        keys.clear();
+        keys.shrink_to_fit();
+    }
+
+    void reserve(size_t n) { keys.reserve(n); }
+
+    // Bulk load: append in any order, then finish() once
+    void append(uint64_t h) { keys.push_back(h); }
+    void finish() {
+        std::sort(keys.begin(), keys.end());
+        keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+    }
+
+    // Sidecar load: hashes must arrive strictly ascending
+    bool appendSorted(uint64_t h) {
+        if (!keys.empty() && keys.back() >= h) return false;
+        keys.push_back(h);
+        return true;
+    }
+
+private:
+    std::vector<uint64_t> keys;
+};
+
+}  // namespace MembershipSet
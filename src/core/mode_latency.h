@@ -0,0 +1,167 @@
+// ModeLatency - Mode transition timing and deferred start steps
+// Porkchop::setMode() times every stop()/start() (wall time, free heap and
+// largest block before vs after) into a fixed ring the diagnostics screen
+// reads. Expensive start work is queued as steps that run one frame at a
+// time, so the new mode's screen is up before WiFi/SD work blocks.
+// Header-only, no Arduino dependencies (unit tested on native).
+#pragma once
+
+#include <cstdint>
+
+namespace ModeLatency {
+
+// One transition blocking longer than this is a visible hang
+static const uint32_t kTransitionBudgetUs = 100000;
+// Deferred steps keep running within a frame until this is spent
+static const uint32_t kStepBudgetUs = 8000;
+
+enum class Kind : uint8_t {
+    Stop = 0,       // Old mode teardown
+    Start,          // New mode inline start
+    Step,           // One deferred start step
+    Count
+};
+
+inline const char* kindName(Kind k) {
+    switch (k) {
+        case Kind::Stop: return "STOP";
+        case Kind::Start: return "START";
+        case Kind::Step: return "STEP";
+        default: return "?";
+    }
+}
+
+struct Sample {
+    uint32_t atMs;          // millis() when it finished
+    uint32_t us;            // Elapsed
+    int32_t freeDelta;      // Free heap after - before
+    int32_t largestDelta;   // Largest free block after - before
+    uint8_t mode;           // PorkchopMode
+    Kind kind;
+
+    bool overBudget() const { return us > kTransitionBudgetUs; }
+};
+
+// Heap/clock snapshot taken before the work; finish() turns it into a Sample
+struct Probe {
+    uint32_t startUs;
+    uint32_t freeBytes;
+    uint32_t largest;
+
+    void begin(uint32_t nowUs, uint32_t freeNow, uint32_t largestNow) {
+        startUs = nowUs;
+        freeBytes = freeNow;
+        largest = largestNow;
+    }
+
+    Sample finish(uint32_t nowUs, uint32_t nowMs, uint32_t freeNow, uint32_t largestNow,
+                  uint8_t mode, Kind kind) const {
+        Sample s;
+        s.atMs = nowMs;
+        s.us = nowUs - startUs;
+        s.freeDelta = (int32_t)(freeNow - freeBytes);
+        s.largestDelta = (int32_t)(largestNow - largest);
+        s.mode = mode;
+        s.kind = kind;
+        return s;
+    }
+};
+
+// Last N samples, oldest first; worst per kind since clear()
+template <uint8_t N>
+class Ring {
+public:
+    Ring() { clear(); }
+
+    void push(const Sample& s) {
+        buf[head] = s;
+        head = (uint8_t)((head + 1) % N);
+        if (n < N) n++;
+        uint8_t k = (uint8_t)s.kind;
+        if (k < (uint8_t)Kind::Count && s.us > worst[k]) worst[k] = s.us;
+        if (s.overBudget()) over++;
+    }
+
+    uint8_t size() const { return n; }
+
+    const Sample& at(uint8_t i) const {
+        return buf[(uint8_t)((head + N - n + i) % N)];
+    }
+
+    uint32_t worstUs(Kind k) const {
+        return (uint8_t)k < (uint8_t)Kind::Count ? worst[(uint8_t)k] : 0;
+    }
+
+    uint32_t overBudget() const { return over; }
+
+    void clear() {
+        head = 0;
+        n = 0;
+        over = 0;
+        for (uint8_t i = 0; i < (uint8_t)Kind::Count; i++) worst[i] = 0;
+    }
+
+private:
+    Sample buf[N];
+    uint8_t head;
+    uint8_t n;
+    uint32_t over;
+    uint32_t worst[(uint8_t)Kind::Count];
+};
+
+/**
+ * Deferred start steps for one mode. A step returns true when it is done;
+ * false keeps it at the front to be called again next time. Queuing a new
+ * mode's steps drops whatever the previous mode had left.
+ */
+typedef bool (*Step)();
+
+class StepQueue {
+public:
+    static const uint8_t kMaxSteps = 6;
+
+    StepQueue() : count(0), next(0), mode(0), generation(0) {}
+
+    void begin(uint8_t forMode) {
+        count = 0;
+        next = 0;
+        mode = forMode;
+        generation++;
+    }
+
+    bool add(Step step) {
+        if (!step || count >= kMaxSteps) return false;
+        steps[count++] = step;
+        return true;
+    }
+
+    void cancel() {
+        count = 0;
+        next = 0;
+        generation++;
+    }
+
+    bool pending() const { return next < count; }
+    uint8_t remaining() const { return (uint8_t)(count - next); }
+    uint8_t owner() const { return mode; }
+
+    // Call the front step once. Returns true if that step finished. A step
+    // may change mode itself (start failed): the queue it replaced is gone.
+    bool runOne() {
+        if (!pending()) return false;
+        uint8_t gen = generation;
+        bool done = steps[next]();
+        if (gen != generation) return done;
+        if (done) next++;
+        return done;
+    }
+
+private:
+    Step steps[kMaxSteps];
+    uint8_t count;
+    uint8_t next;
+    uint8_t mode;
+    uint8_t generation;
+};
+
+}  // namespace ModeLatency
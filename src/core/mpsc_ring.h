@@ -0,0 +1,154 @@
+// MpscRing - Bounded lock-free multi-producer/single-consumer event ring
+// Carries fixed-size events from the WiFi promiscuous callback (or any other
+// task) to the main loop. Fixed capacity, no heap, never blocks producers.
+// Header-only, no Arduino dependencies (unit tested on native).
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+// Data cache line: 32 bytes on ESP32-S3, 64 on typical hosts
+#ifdef ARDUINO
+static constexpr size_t kRingCacheLine = 32;
+#else
+static constexpr size_t kRingCacheLine = 64;
+#endif
+
+// Snapshot of a ring's counters (for diagnostics)
+struct RingStats {
+    uint32_t pushed;      // Events accepted
+    uint32_t dropped;     // Events rejected because the ring was full
+    uint16_t highWater;   // Most events ever queued at once
+    uint16_t capacity;
+};
+
+/**
+ * Bounded queue after Vyukov's MPMC design, specialised for one consumer.
+ *
+ * Each cell carries a sequence number: producers claim a position with a
+ * CAS on the enqueue counter, fill the cell in place, then publish it by
+ * bumping the cell's sequence. The consumer owns the dequeue counter
+ * outright. Producer and consumer counters sit on separate cache lines so
+ * the WiFi core and the main-loop core don't bounce one line between them.
+ *
+ * N must be a power of two (2..32768). A full ring drops the new event and
+ * counts it; nothing is overwritten.
+ */
+template <typename T, uint16_t N>
+class MpscRing {
+    static_assert(N >= 2 && N <= 32768 && (N & (N - 1)) == 0,
+                  "N must be a power of two (2..32768)");
+
+public:
+    MpscRing() { reset(); }
+
+    // Not safe while producers are active.
+    void reset() {
+        for (uint32_t i = 0; i < N; i++) {
+            cells[i].seq.store(i, std::memory_order_relaxed);
+        }
+        enqueuePos.store(0, std::memory_order_relaxed);
+        dequeuePos.store(0, std::memory_order_relaxed);
+        pushedCount.store(0, std::memory_order_relaxed);
+        droppedCount.store(0, std::memory_order_relaxed);
+        highWaterMark.store(0, std::memory_order_relaxed);
+    }
+
+    static constexpr uint16_t capacity() { return N; }
+
+    // Producer: fill(T&) writes the event directly into the claimed cell,
+    // so large events never touch the (small) WiFi task stack.
+    template <typename Fill>
+    bool emplace(Fill fill) {
+        uint32_t pos = enqueuePos.load(std::memory_order_relaxed);
+        Cell* cell;
+        for (;;) {
+            cell = &cells[pos & kMask];
+            uint32_t seq = cell->seq.load(std::memory_order_acquire);
+            int32_t diff = (int32_t)(seq - pos);
+            if (diff == 0) {
+                if (enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                droppedCount.fetch_add(1, std::memory_order_relaxed);
+                return false;  // Full
+            } else {
+                pos = enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+
+        fill(cell->value);
+        cell->seq.store(pos + 1, std::memory_order_release);
+        pushedCount.fetch_add(1, std::memory_order_relaxed);
+
+        uint32_t depth = pos + 1 - dequeuePos.load(std::memory_order_relaxed);
+        if (depth > N) depth = N;
+        uint32_t hw = highWaterMark.load(std::memory_order_relaxed);
+        while (depth > hw &&
+               !highWaterMark.compare_exchange_weak(hw, depth, std::memory_order_relaxed)) {
+        }
+        return true;
+    }
+
+    bool push(const T& item) {
+        return emplace([&item](T& slot) { slot = item; });
+    }
+
+    // Consumer: hands the oldest event to fn(const T&) in place, then frees
+    // the cell. Returns false if nothing is ready.
+    template <typename Fn>
+    bool consume(Fn fn) {
+        uint32_t pos = dequeuePos.load(std::memory_order_relaxed);
+        Cell& cell = cells[pos & kMask];
+        uint32_t seq = cell.seq.load(std::memory_order_acquire);
+        if ((int32_t)(seq - (pos + 1)) < 0) return false;  // Empty or still being filled
+
+        fn(static_cast<const T&>(cell.value));
+        cell.seq.store(pos + N, std::memory_order_release);
+        dequeuePos.store(pos + 1, std::memory_order_relaxed);
+        return true;
+    }
+
+    bool pop(T& out) {
+        return consume([&out](const T& v) { out = v; });
+    }
+
+    // Approximate (exact when called from the consumer with producers idle)
+    uint16_t size() const {
+        uint32_t n = enqueuePos.load(std::memory_order_relaxed) -
+                     dequeuePos.load(std::memory_order_relaxed);
+        return (uint16_t)(n > N ? N : n);
+    }
+
+    bool empty() const { return size() == 0; }
+
+    uint32_t pushed() const { return pushedCount.load(std::memory_order_relaxed); }
+    uint32_t dropped() const { return droppedCount.load(std::memory_order_relaxed); }
+    uint16_t highWater() const { return (uint16_t)highWaterMark.load(std::memory_order_relaxed); }
+
+    RingStats stats() const {
+        RingStats s;
+        s.pushed = pushed();
+        s.dropped = dropped();
+        s.highWater = highWater();
+        s.capacity = N;
+        return s;
+    }
+
+private:
+    static constexpr uint32_t kMask = N - 1;
+
+    struct Cell {
+        std::atomic<uint32_t> seq;
+        T value;
+    };
+
+    alignas(kRingCacheLine) std::atomic<uint32_t> enqueuePos;   // Producers
+    std::atomic<uint32_t> pushedCount;
+    std::atomic<uint32_t> droppedCount;
+    std::atomic<uint32_t> highWaterMark;
+    alignas(kRingCacheLine) std::atomic<uint32_t> dequeuePos;   // Consumer
+    alignas(kRingCacheLine) Cell cells[N];
+};
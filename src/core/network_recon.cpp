@@ -8,6 +8,12 @@
 #include "wifi_utils.h"
 #include "heap_gates.h"
 #include "heap_policy.h"
+#include "heap_trace.h"
+#include "bssid_index.h"
+#include "mpsc_ring.h"
+#include "ie_parser.h"
+#include "frame_dispatch.h"
+#include "session_capture.h"
 #include <WiFi.h>
 #include <esp_wifi.h>
 #include <esp_heap_caps.h>
@@ -74,14 +80,39 @@ static portMUX_TYPE vectorMux = portMUX_INITIALIZER_UNLOCKED;
 
 static std::vector<DetectedNetwork> networks;
 
+// BSSID -> vector slot index (512 buckets = 2KB, load <= 40% at MAX_RECON_NETWORKS)
+// Maintained by processDeferredEvents(), eviction and cleanupStaleNetworks().
+// Modes that reorder, erase or push through getNetworks() call
+// invalidateIndex(), which forces a rebuild on the next lookup.
+// All access under vectorMux.
+static const uint16_t BSSID_INDEX_SLOTS = 512;
+static_assert(MAX_RECON_NETWORKS <= BSSID_INDEX_SLOTS / 2, "BSSID index too small for MAX_RECON_NETWORKS");
+static BssidIndex<BSSID_INDEX_SLOTS> bssidIndex;
+static bool bssidIndexValid = false;  // false = too many entries, linear scan
+
 // ============================================================================
 // Deferred Event Processing (avoid allocations in callback)
 // ============================================================================
 
-static const uint8_t PENDING_NET_SLOTS = 4;
-static DetectedNetwork pendingNetworks[PENDING_NET_SLOTS];
-static std::atomic<uint8_t> pendingNetWrite{0};
-static std::atomic<uint8_t> pendingNetRead{0};
+// New-network events from the callback. 32 slots absorbs a full hop dwell on
+// a crowded channel; drops and peak depth show up in the diagnostics menu.
+static const uint16_t PENDING_NET_SLOTS = 32;
+static MpscRing<DetectedNetwork, PENDING_NET_SLOTS> pendingNetworks;
+
+// Main-loop drain budget per update() (adds are cheap, evictions scan the table)
+static const uint8_t MAX_ADDS_PER_UPDATE = PENDING_NET_SLOTS;
+static const uint32_t DEFERRED_BUDGET_US = 3000;
+
+// Beacon sightings for the sighting callback (passive WARHOG). Throttled per
+// network by reportedRssi, so this carries a few events per AP per window.
+struct Sighting {
+    uint8_t bssid[6];
+    int8_t rssi;
+    uint32_t ms;
+};
+static const uint16_t SIGHTING_SLOTS = 64;
+static MpscRing<Sighting, SIGHTING_SLOTS> sightings;
+static const uint8_t MAX_SIGHTINGS_PER_UPDATE = SIGHTING_SLOTS;
 
 // Pending SSID reveal cache (best-effort for hidden networks)
 static const uint8_t PENDING_SSID_SLOTS = 4;
@@ -99,6 +130,7 @@ static std::atomic<uint8_t> pendingSsidWrite{0};
 
 static PacketCallback modeCallback = nullptr;
 static NewNetworkCallback newNetworkCallback = nullptr;
+static SightingCallback sightingCallback = nullptr;
 
 // ============================================================================
 // Internal Functions
@@ -122,7 +154,24 @@ static void hopChannel() {
     esp_wifi_set_channel(currentChannel, WIFI_SECOND_CHAN_NONE);
 }
 
+static inline const uint8_t* networkKeyAt(uint16_t slot) {
+    return networks[slot].bssid;
+}
+
+// Caller must hold vectorMux
+static void rebuildIndexInternal() {
+    bssidIndexValid = networks.size() <= BssidIndex<BSSID_INDEX_SLOTS>::maxEntries() &&
+                      bssidIndex.rebuild((uint16_t)networks.size(), networkKeyAt);
+}
+
+// Caller must hold vectorMux
 static int findNetworkInternal(const uint8_t* bssid) {
+    if (!bssidIndexValid || bssidIndex.needsRebuild((uint16_t)networks.size())) {
+        rebuildIndexInternal();
+    }
+    if (bssidIndexValid) {
+        return bssidIndex.find(bssid, networkKeyAt);
+    }
     for (size_t i = 0; i < networks.size(); i++) {
         if (memcmp(networks[i].bssid, bssid, 6) == 0) {
             return (int)i;
@@ -137,29 +186,6 @@ static inline int8_t updateRssiAvg(int8_t prev, int8_t sample) {
     return (int8_t)(blended / 8);
 }
 
-static bool enqueuePendingNetwork(const DetectedNetwork& net) {
-    uint8_t write = pendingNetWrite.load(std::memory_order_relaxed);
-    uint8_t next = (uint8_t)((write + 1) % PENDING_NET_SLOTS);
-    uint8_t read = pendingNetRead.load(std::memory_order_acquire);
-    if (next == read) {
-        return false;  // Queue full, drop
-    }
-    pendingNetworks[write] = net;
-    pendingNetWrite.store(next, std::memory_order_release);
-    return true;
-}
-
-static bool dequeuePendingNetwork(DetectedNetwork& out) {
-    uint8_t read = pendingNetRead.load(std::memory_order_relaxed);
-    uint8_t write = pendingNetWrite.load(std::memory_order_acquire);
-    if (read == write) {
-        return false;
-    }
-    out = pendingNetworks[read];
-    pendingNetRead.store((uint8_t)((read + 1) % PENDING_NET_SLOTS), std::memory_order_release);
-    return true;
-}
-
 static void storePendingSsid(const uint8_t* bssid, const char* ssid) {
     if (!bssid || !ssid || ssid[0] == 0) return;
     uint8_t slot = pendingSsidWrite.fetch_add(1, std::memory_order_relaxed) % PENDING_SSID_SLOTS;
@@ -249,47 +275,10 @@ static int computeRetentionScore(const DetectedNetwork& net, uint32_t now) {
     return score;
 }
 
-static bool detectPMF(const uint8_t* payload, uint16_t len) {
-    // Look for RSN IE (0x30) and check RSN Capabilities for MFPC/MFPR bits
-    uint16_t offset = 36;
-    while (offset + 2 < len) {
-        uint8_t id = payload[offset];
-        uint8_t ieLen = payload[offset + 1];
-        
-        if (offset + 2 + ieLen > len) break;
-        
-        if (id == 0x30 && ieLen >= 8) {  // RSN IE
-            // RSN capabilities are at fixed offset from RSN IE start
-            // Version (2) + Group Cipher Suite (4) + Pairwise Count (2) + Pairwise Suites (n*4)
-            // + AKM Count (2) + AKM Suites (m*4) + RSN Capabilities (2)
-            // For simplicity, scan for capabilities at expected position
-            uint16_t rsnOffset = offset + 2;
-            uint16_t version = payload[rsnOffset] | (payload[rsnOffset + 1] << 8);
-            if (version != 1) {
-                offset += 2 + ieLen;
-                continue;
-            }
-            
-            // Skip to RSN capabilities (simplified - assumes minimal suites)
-            // In practice, need to parse suite counts
-            uint16_t capOffset = rsnOffset + 8;  // Minimum offset
-            if (capOffset + 2 <= offset + 2 + ieLen) {
-                uint16_t caps = payload[capOffset] | (payload[capOffset + 1] << 8);
-                // MFPC = bit 7, MFPR = bit 6
-                if (caps & 0x0080) return true;  // MFPC set
-            }
-        }
-        
-        offset += 2 + ieLen;
-    }
-    return false;
-}
-
-static void processBeacon(const uint8_t* payload, uint16_t len, int8_t rssi) {
-    if (len < 36) return;
-    
-    const uint8_t* bssid = payload + 16;
-    bool hasPMF = detectPMF(payload, len);
+static void processBeacon(const FrameDispatch::Beacon& b, int8_t rssi) {
+    const uint8_t* bssid = b.bssid;
+    const IEParser::BeaconInfo& info = b.info;
+    bool hasPMF = info.hasPMF();
     uint32_t now = millis();
     
     // [BUG1 FIX] Lookup under spinlock - vector can be modified by cleanupStaleNetworks()
@@ -303,8 +292,8 @@ static void processBeacon(const uint8_t* payload, uint16_t len, int8_t rssi) {
         memcpy(net.bssid, bssid, 6);
         net.rssi = rssi;
         net.rssiAvg = rssi;
-        net.channel = currentChannel;
-        net.authmode = WIFI_AUTH_OPEN;
+        net.channel = info.dsChannel ? info.dsChannel : currentChannel;
+        net.authmode = IEParser::authMode(info);
         net.firstSeen = now;
         net.lastSeen = now;
         net.lastBeaconSeen = now;
@@ -314,94 +303,25 @@ static void processBeacon(const uint8_t* payload, uint16_t len, int8_t rssi) {
         net.hasPMF = hasPMF;
         net.hasHandshake = false;
         net.attackAttempts = 0;
-        net.isHidden = false;
+        net.isHidden = info.ssidPresent && info.hidden;
         net.lastDataSeen = 0;
         net.cooldownUntil = 0;
         net.clientBitset = 0;
-            
-        // Parse SSID from IE
-        uint16_t offset = 36;
-        while (offset + 2 < len) {
-            uint8_t id = payload[offset];
-            uint8_t ieLen = payload[offset + 1];
-            
-            if (offset + 2 + ieLen > len) break;
-            
-            if (id == 0) {
-                if (ieLen > 0 && ieLen <= 32) {
-                    memcpy(net.ssid, payload + offset + 2, ieLen);
-                    net.ssid[ieLen] = 0;
-                    
-                    // Check for all-null SSID (hidden)
-                    bool allNull = true;
-                    for (uint8_t i = 0; i < ieLen; i++) {
-                        if (net.ssid[i] != 0) { allNull = false; break; }
-                    }
-                    if (allNull) {
-                        net.isHidden = true;
-                    }
-                } else if (ieLen == 0) {
-                    net.isHidden = true;
-                }
-                break;
-            }
-            
-            offset += 2 + ieLen;
-        }
+        net.reportedRssi = rssi;  // Reported as new when the add is drained
+        info.copySSID(net.ssid);
         
-        // Get channel from DS Parameter Set IE
-        offset = 36;
-        while (offset + 2 < len) {
-            uint8_t id = payload[offset];
-            uint8_t ieLen = payload[offset + 1];
-            
-            if (id == 3 && ieLen == 1) {
-                net.channel = payload[offset + 2];
-                break;
-            }
-            
-            offset += 2 + ieLen;
-        }
-        
-        // Parse auth mode
-        offset = 36;
-        while (offset + 2 < len) {
-            uint8_t id = payload[offset];
-            uint8_t ieLen = payload[offset + 1];
-            
-            if (offset + 2 + ieLen > len) break;
-            
-            if (id == 0x30 && ieLen >= 2) {  // RSN IE = WPA2/WPA3
-                if (net.hasPMF) {
-                    net.authmode = WIFI_AUTH_WPA3_PSK;
-                } else {
-                    net.authmode = WIFI_AUTH_WPA2_PSK;
-                }
-            } else if (id == 0xDD && ieLen >= 8) {  // Vendor specific
-                if (payload[offset + 2] == 0x00 && payload[offset + 3] == 0x50 &&
-                    payload[offset + 4] == 0xF2 && payload[offset + 5] == 0x01) {
-                    if (net.authmode == WIFI_AUTH_OPEN) {
-                        net.authmode = WIFI_AUTH_WPA_PSK;
-                    } else if (net.authmode == WIFI_AUTH_WPA2_PSK) {
-                        net.authmode = WIFI_AUTH_WPA_WPA2_PSK;
-                    }
-                }
-            }
-            
-            offset += 2 + ieLen;
-        }
-        
-        if (net.channel == 0) {
-            net.channel = currentChannel;
-        }
-        
-        // Queue for deferred add
-        enqueuePendingNetwork(net);
+        // Queue for deferred add (full ring drops and counts)
+        pendingNetworks.push(net);
     } else {
         // Update existing network
+        bool report = false;
         taskENTER_CRITICAL(&vectorMux);
         if (idx >= 0 && idx < (int)networks.size()) {
             DetectedNetwork& net = networks[idx];
+            if (sightingCallback && rssi > net.reportedRssi) {
+                net.reportedRssi = rssi;
+                report = true;
+            }
             net.rssi = rssi;
             net.rssiAvg = updateRssiAvg(net.rssiAvg, rssi);
             net.lastSeen = now;
@@ -421,39 +341,28 @@ static void processBeacon(const uint8_t* payload, uint16_t len, int8_t rssi) {
             net.hasPMF |= hasPMF;
         }
         taskEXIT_CRITICAL(&vectorMux);
+
+        // Full ring drops and counts; the AP is reported again next window
+        if (report) {
+            sightings.emplace([&](Sighting& s) {
+                memcpy(s.bssid, bssid, 6);
+                s.rssi = rssi;
+                s.ms = now;
+            });
+        }
     }
 }
 
-static void processProbeResponse(const uint8_t* payload, uint16_t len, int8_t rssi) {
-    if (len < 36) return;
-    
-    const uint8_t* bssid = payload + 16;
+static void processProbeResponse(const FrameDispatch::Beacon& b, int8_t rssi) {
+    const uint8_t* bssid = b.bssid;
+    const IEParser::BeaconInfo& info = b.info;
     uint32_t now = millis();
 
-    // Parse SSID from IE (probe responses can reveal hidden SSIDs)
-    char ssidBuf[33] = {0};
-    bool ssidFound = false;
-    bool ssidAllNull = true;
-    uint16_t offset = 36;
-    while (offset + 2 < len) {
-        uint8_t id = payload[offset];
-        uint8_t ieLen = payload[offset + 1];
-        
-        if (offset + 2 + ieLen > len) break;
-        
-        if (id == 0 && ieLen > 0 && ieLen <= 32) {
-            memcpy(ssidBuf, payload + offset + 2, ieLen);
-            ssidBuf[ieLen] = 0;
-            ssidFound = true;
-            
-            for (uint8_t i = 0; i < ieLen; i++) {
-                if (ssidBuf[i] != 0) { ssidAllNull = false; break; }
-            }
-            break;
-        }
-        
-        offset += 2 + ieLen;
-    }
+    // Probe responses can reveal hidden SSIDs
+    char ssidBuf[33];
+    info.copySSID(ssidBuf);
+    bool ssidFound = info.ssidPresent && info.ssidLen > 0;
+    bool ssidAllNull = info.hidden;
     
     // [BUG5 FIX] Do lookup inside critical section to prevent TOCTOU race
     // cleanupStaleNetworks() can modify vector between lookup and use
@@ -480,40 +389,6 @@ static void processProbeResponse(const uint8_t* payload, uint16_t len, int8_t rs
     taskEXIT_CRITICAL(&vectorMux);
 }
 
-static void processAssocRequest(const uint8_t* payload, uint16_t len, bool isReassoc) {
-    if (len < 36) return;
-    
-    const uint8_t* bssid = payload + 16;
-    uint16_t fixedLen = isReassoc ? 10 : 4;
-    uint16_t offset = 24 + fixedLen;
-    if (offset + 2 > len) return;
-    
-    // Parse SSID IE from tagged parameters
-    char ssidBuf[33] = {0};
-    bool ssidFound = false;
-    bool ssidAllNull = true;
-    while (offset + 2 < len) {
-        uint8_t id = payload[offset];
-        uint8_t ieLen = payload[offset + 1];
-        if (offset + 2 + ieLen > len) break;
-        
-        if (id == 0 && ieLen > 0 && ieLen <= 32) {
-            memcpy(ssidBuf, payload + offset + 2, ieLen);
-            ssidBuf[ieLen] = 0;
-            ssidFound = true;
-            for (uint8_t i = 0; i < ieLen; i++) {
-                if (ssidBuf[i] != 0) { ssidAllNull = false; break; }
-            }
-            break;
-        }
-        offset += 2 + ieLen;
-    }
-    
-    if (ssidFound && !ssidAllNull) {
-        revealSsidIfKnown(bssid, ssidBuf);
-    }
-}
-
 static void markDataActivity(const uint8_t* bssid, const uint8_t* clientMac) {
     taskENTER_CRITICAL(&vectorMux);
 
@@ -530,75 +405,43 @@ static void markDataActivity(const uint8_t* bssid, const uint8_t* clientMac) {
     taskEXIT_CRITICAL(&vectorMux);
 }
 
-static void processDataFrame(const uint8_t* payload, uint16_t len, int8_t rssi) {
-    (void)rssi;
-    if (len < 28) return;
-    
-    uint8_t toDs = (payload[1] & 0x01);
-    uint8_t fromDs = (payload[1] & 0x02) >> 1;
-    
-    const uint8_t* bssid = nullptr;
-    const uint8_t* clientMac = nullptr;
-    
-    if (!toDs && fromDs) {
-        bssid = payload + 10;
-        clientMac = payload + 4;
-    } else if (toDs && !fromDs) {
-        bssid = payload + 4;
-        clientMac = payload + 10;
+// Frame handlers for FrameDispatch::recon()
+struct ReconSink {
+    void beacon(const FrameDispatch::Beacon& b, int8_t rssi) {
+        if (b.probeResponse) processProbeResponse(b, rssi);
+        else processBeacon(b, rssi);
     }
-    
-    if (bssid && clientMac) {
-        if ((clientMac[0] & 0x01) == 0) {
-            markDataActivity(bssid, clientMac);
-        }
+    void ssidSeen(const uint8_t* bssid, const IEParser::BeaconInfo& info) {
+        char ssidBuf[33];
+        info.copySSID(ssidBuf);
+        revealSsidIfKnown(bssid, ssidBuf);
     }
-}
+    void dataActivity(const uint8_t* bssid, const uint8_t* client, int8_t rssi) {
+        (void)rssi;
+        markDataActivity(bssid, client);
+    }
+};
 
 static void promiscuousCallback(void* buf, wifi_promiscuous_pkt_type_t type) {
     if (!buf) return;
     if (!running || paused) return;
+    
+    wifi_promiscuous_pkt_t* pkt = (wifi_promiscuous_pkt_t*)buf;
+    
+    // Session capture sees every frame, even while the network table is busy
+    SessionCapture::onFrame(pkt, type, FrameDispatch::frameLen(pkt));
+    
     if (busy) {
         if (modeCallback) {
-            modeCallback((wifi_promiscuous_pkt_t*)buf, type);
+            modeCallback(pkt, type);
         }
         return;
     }
     
-    wifi_promiscuous_pkt_t* pkt = (wifi_promiscuous_pkt_t*)buf;
-    uint16_t len = pkt->rx_ctrl.sig_len;
-    int8_t rssi = pkt->rx_ctrl.rssi;
-    
-    // ESP32 adds 4 ghost bytes
-    if (len > 4) len -= 4;
-    if (len < 24) return;
-    
-    packetCount++;
-    
-    const uint8_t* payload = pkt->payload;
-    uint8_t frameSubtype = (payload[0] >> 4) & 0x0F;
-    
     // Basic network tracking (always happens)
-    switch (type) {
-        case WIFI_PKT_MGMT:
-            if (frameSubtype == 0x08) {  // Beacon
-                processBeacon(payload, len, rssi);
-            } else if (frameSubtype == 0x05) {  // Probe Response
-                processProbeResponse(payload, len, rssi);
-            } else if (frameSubtype == 0x00) {  // Assoc Request
-                processAssocRequest(payload, len, false);
-            } else if (frameSubtype == 0x02) {  // Reassoc Request
-                processAssocRequest(payload, len, true);
-            }
-            break;
-            
-        case WIFI_PKT_DATA:
-            processDataFrame(payload, len, rssi);
-            break;
-            
-        default:
-            break;
-    }
+    ReconSink sink;
+    if (!FrameDispatch::recon(pkt, type, sink)) return;
+    packetCount++;
     
     // Mode-specific callback (for EAPOL capture, PCAP logging, etc.)
     if (modeCallback) {
@@ -607,11 +450,13 @@ static void promiscuousCallback(void* buf, wifi_promiscuous_pkt_type_t type) {
 }
 
 static void processDeferredEvents() {
-    const uint8_t kMaxAddsPerUpdate = 4;
     uint8_t processed = 0;
+    uint32_t startUs = micros();
     DetectedNetwork pending = {};
     
-    while (processed < kMaxAddsPerUpdate && dequeuePendingNetwork(pending)) {
+    while (processed < MAX_ADDS_PER_UPDATE &&
+           micros() - startUs < DEFERRED_BUDGET_US &&
+           pendingNetworks.pop(pending)) {
         // Apply any deferred SSID reveal before adding
         applyPendingSsid(pending);
         
@@ -645,9 +490,15 @@ static void processDeferredEvents() {
         bool replaced = false;
         if (shouldAdd) {
             taskENTER_CRITICAL(&vectorMux);
-            networks.push_back(pending);  // Safe: capacity pre-reserved
+            // Burst of beacons can queue the same BSSID more than once
+            if (findNetworkInternal(pending.bssid) < 0) {
+                networks.push_back(pending);  // Safe: capacity pre-reserved
+                if (bssidIndexValid) {
+                    bssidIndexValid = bssidIndex.insert(pending.bssid, (uint16_t)(networks.size() - 1));
+                }
+                inserted = true;
+            }
             taskEXIT_CRITICAL(&vectorMux);
-            inserted = true;
         } else if (!belowMax) {
             // Vector is full - evict a low-value entry if the new one is better
             uint32_t now = millis();
@@ -656,7 +507,9 @@ static void processDeferredEvents() {
             int worstIdx = -1;
             
             taskENTER_CRITICAL(&vectorMux);
-            for (size_t i = 0; i < networks.size(); i++) {
+            // Skip duplicate queue entries for an already-tracked BSSID
+            bool alreadyTracked = findNetworkInternal(pending.bssid) >= 0;
+            for (size_t i = 0; !alreadyTracked && i < networks.size(); i++) {
                 if (networks[i].isTarget) continue;
                 int score = computeRetentionScore(networks[i], now);
                 if (score < worstScore) {
@@ -665,7 +518,13 @@ static void processDeferredEvents() {
                 }
             }
             if (worstIdx >= 0 && pendingScore > worstScore) {
+                if (bssidIndexValid) {
+                    bssidIndex.remove(networks[worstIdx].bssid, (uint16_t)worstIdx);
+                }
                 networks[worstIdx] = pending;
+                if (bssidIndexValid) {
+                    bssidIndexValid = bssidIndex.insert(pending.bssid, (uint16_t)worstIdx);
+                }
                 replaced = true;
             }
             taskEXIT_CRITICAL(&vectorMux);
@@ -683,12 +542,32 @@ static void processDeferredEvents() {
                     pending.channel
                 );
             }
+            if (sightingCallback) {
+                sightingCallback(pending, pending.rssi, pending.firstSeen);
+            }
         }
         
         processed++;
     }
 }
 
+static void processSightings() {
+    uint8_t processed = 0;
+    uint32_t startUs = micros();
+    Sighting s;
+    DetectedNetwork net;
+
+    while (processed < MAX_SIGHTINGS_PER_UPDATE &&
+           micros() - startUs < DEFERRED_BUDGET_US &&
+           sightings.pop(s)) {
+        processed++;
+        // Evicted since the beacon arrived - nothing to attach it to
+        if (!findNetwork(s.bssid, &net)) continue;
+        SightingCallback cb = sightingCallback;
+        if (cb) cb(net, s.rssi, s.ms);
+    }
+}
+
 static void cleanupStaleNetworks() {
     uint32_t now = millis();
     
@@ -706,6 +585,8 @@ static void cleanupStaleNetworks() {
             now - networks[i].lastDataSeen > CLIENT_BITMAP_RESET_MS) {
             networks[i].clientBitset = 0;
         }
+        // New sighting window: the next beacon from each AP is reported
+        networks[i].reportedRssi = INT8_MIN;
         if (now - networks[i].lastSeen > STALE_TIMEOUT_MS) {
             staleIndices[staleCount++] = i;
         }
@@ -717,6 +598,11 @@ static void cleanupStaleNetworks() {
         networks.erase(networks.begin() + staleIndices[i]);
     }
     
+    // Erase shifts every later slot - cheaper to re-index than patch
+    if (staleCount > 0) {
+        rebuildIndexInternal();
+    }
+    
     taskEXIT_CRITICAL(&vectorMux);
 }
 
@@ -731,6 +617,8 @@ void init() {
     
     networks.clear();
     networks.reserve(50);  // Initial reserve, will grow as needed
+    bssidIndex.clear();
+    bssidIndexValid = true;
     
     packetCount = 0;
     currentChannel = 1;
@@ -741,8 +629,8 @@ void init() {
     paused = false;
     channelLocked.store(false, std::memory_order_relaxed);
     busy = false;
-    pendingNetWrite = 0;
-    pendingNetRead = 0;
+    pendingNetworks.reset();
+    sightings.reset();
     pendingSsidWrite = 0;
     for (uint8_t i = 0; i < PENDING_SSID_SLOTS; i++) {
         pendingSsids[i].ready.store(false, std::memory_order_relaxed);
@@ -755,6 +643,7 @@ void init() {
 }
 
 void start() {
+    HeapTrace::Scope heapTag(HeapTrace::Tag::Recon);
     if (!initialized) init();
     if (running) {
         if (paused) {
@@ -769,8 +658,8 @@ void start() {
     heapLargestAtStart = heap_caps_get_largest_free_block(MALLOC_CAP_8BIT);
     heapStabilized = false;
     startTime = millis();
-    pendingNetWrite = 0;
-    pendingNetRead = 0;
+    pendingNetworks.reset();
+    sightings.reset();
     pendingSsidWrite = 0;
     for (uint8_t i = 0; i < PENDING_SSID_SLOTS; i++) {
         pendingSsids[i].ready.store(false, std::memory_order_relaxed);
@@ -825,6 +714,9 @@ void start() {
     lastCleanupTime = millis();
     
     Serial.printf("[RECON] Started on channel %d\n", currentChannel);
+    
+    // Optional full-session PCAPNG (no-op when capture mode is OFF)
+    SessionCapture::start();
 }
 
 void stop() {
@@ -836,6 +728,7 @@ void stop() {
     paused = false;
     
     WiFiUtils::stopPromiscuous();
+    SessionCapture::stop();
     
     // Don't clear networks - they persist for mode reuse
     
@@ -900,6 +793,7 @@ void update() {
     
     // Process deferred events from callback
     processDeferredEvents();
+    processSightings();
     
     // Channel hopping
     uint32_t hopInterval = getHopIntervalMsInternal();
@@ -963,6 +857,14 @@ uint32_t getPacketCount() {
     return packetCount;
 }
 
+RingStats getPendingQueueStats() {
+    return pendingNetworks.stats();
+}
+
+RingStats getSightingQueueStats() {
+    return sightings.stats();
+}
+
 uint8_t estimateClientCount(const DetectedNetwork& net) {
     return (uint8_t)__builtin_popcountll(net.clientBitset);
 }
@@ -1072,6 +974,14 @@ void setNewNetworkCallback(NewNetworkCallback callback) {
     newNetworkCallback = callback;
 }
 
+void setSightingCallback(SightingCallback callback) {
+    // Stale sightings from a previous session are never delivered
+    sightingCallback = nullptr;
+    Sighting drop;
+    while (sightings.pop(drop)) {}
+    sightingCallback = callback;
+}
+
 void enterCritical() {
     taskENTER_CRITICAL(&vectorMux);
 }
@@ -1080,4 +990,8 @@ void exitCritical() {
     taskEXIT_CRITICAL(&vectorMux);
 }
 
+void invalidateIndex() {
+    bssidIndex.invalidate();
+}
+
 } // namespace NetworkRecon
@@ -6,6 +6,7 @@
 #include <Arduino.h>
 #include <esp_wifi.h>
 #include <vector>
+#include "mpsc_ring.h"
 
 // Maximum networks to track
 #define MAX_RECON_NETWORKS 200
@@ -101,6 +102,18 @@ void clearHopIntervalOverride();
  */
 uint32_t getPacketCount();
 
+/**
+ * @brief Counters for the callback -> main loop new-network queue
+ * Dropped > 0 means beacons arrived faster than update() drained them.
+ */
+RingStats getPendingQueueStats();
+
+/**
+ * @brief Counters for the callback -> main loop sighting queue
+ * Only fed while a sighting callback is registered.
+ */
+RingStats getSightingQueueStats();
+
 // ============================================================================
 // Quality + Client Estimates
 // ============================================================================
@@ -213,6 +226,23 @@ using NewNetworkCallback = void(*)(wifi_auth_mode_t authmode, bool isHidden,
  */
 void setNewNetworkCallback(NewNetworkCallback callback);
 
+/**
+ * @brief Beacon sighting callback type (passive wardriving)
+ * Called from update() for every new network, and for a known network when
+ * a beacon beats the strongest one reported in the current cleanup window
+ * (so each AP in range is reported at least every few seconds)
+ * @param net Copy of the network's table entry (SSID, auth, channel)
+ * @param rssi Signal strength of this beacon
+ * @param seenMs millis() when the beacon arrived
+ */
+using SightingCallback = void(*)(const DetectedNetwork& net, int8_t rssi, uint32_t seenMs);
+
+/**
+ * @brief Register callback for beacon sightings
+ * Called from main loop context. Pass nullptr to clear (and stop queueing)
+ */
+void setSightingCallback(SightingCallback callback);
+
 // ============================================================================
 // Thread Safety
 // ============================================================================
@@ -228,6 +258,13 @@ void enterCritical();
  */
 void exitCritical();
 
+/**
+ * @brief Drop the BSSID index after changing getNetworks() in place
+ * (sort, swap, erase, push_back). Rebuilt on the next lookup.
+ * @warning Call between enterCritical() and exitCritical()
+ */
+void invalidateIndex();
+
 /**
  * @brief RAII wrapper for critical section
  */
@@ -5,7 +5,8 @@
 #include <Arduino.h>
 
 namespace OUI {
-    // Get vendor name for MAC address (returns "Unknown" if not found)
+    // Get vendor name for MAC address ("UNKNOWN" if not found, "RANDOM" for
+    // locally administered). Pointer is to flash and stays valid forever.
     const char* getVendor(const uint8_t* mac);
     
     // Self-test: verify table integrity at startup [P7]
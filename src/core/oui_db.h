@@ -0,0 +1,128 @@
+// Auto-generated by scripts/oui_db.py - do not edit
+// Source: oui_seed.csv only (no IEEE oui.csv supplied)
+// OUI_DB_KEYS: big-endian 24-bit prefixes, strictly ascending
+// OUI_DB_VENDOR: name id per key; OUI_DB_NAME_OFF: id -> offset in OUI_DB_NAMES
+#pragma once
+
+#include <stdint.h>
+
+#define OUI_DB_COUNT 454
+#define OUI_DB_NAME_COUNT 18
+
+static const uint8_t OUI_DB_KEYS[OUI_DB_COUNT * 3] PROGMEM = {
+    0x00,0x00,0x0C, 0x00,0x00,0xF0, 0x00,0x01,0x42, 0x00,0x01,0x43, 0x00,0x01,0x4A, 0x00,0x01,0x63, 0x00,0x01,0x64, 0x00,0x01,0x6C,
+    0x00,0x01,0x96, 0x00,0x01,0x97, 0x00,0x01,0xC7, 0x00,0x01,0xC9, 0x00,0x02,0x16, 0x00,0x02,0x17, 0x00,0x02,0x3D, 0x00,0x02,0x4A,
+    0x00,0x02,0x4B, 0x00,0x02,0x78, 0x00,0x02,0x7D, 0x00,0x02,0x7E, 0x00,0x02,0xB3, 0x00,0x02,0xB9, 0x00,0x02,0xBA, 0x00,0x02,0xFC,
+    0x00,0x02,0xFD, 0x00,0x03,0x47, 0x00,0x03,0x93, 0x00,0x03,0xFF, 0x00,0x04,0x1F, 0x00,0x04,0x23, 0x00,0x05,0xC9, 0x00,0x06,0x1B,
+    0x00,0x06,0x5B, 0x00,0x07,0xAB, 0x00,0x07,0xE9, 0x00,0x08,0x74, 0x00,0x09,0x18, 0x00,0x09,0x2D, 0x00,0x09,0x5B, 0x00,0x0A,0x27,
+    0x00,0x0A,0x95, 0x00,0x0A,0xE4, 0x00,0x0B,0xDB, 0x00,0x0C,0xF1, 0x00,0x0D,0x3A, 0x00,0x0D,0x56, 0x00,0x0D,0x93, 0x00,0x0D,0xAE,
+    0x00,0x0D,0xE5, 0x00,0x0E,0x0C, 0x00,0x0E,0x35, 0x00,0x0F,0x1F, 0x00,0x0F,0xB5, 0x00,0x0F,0xE2, 0x00,0x10,0xFA, 0x00,0x11,0x11,
+    0x00,0x11,0x24, 0x00,0x11,0x43, 0x00,0x12,0x3F, 0x00,0x12,0x47, 0x00,0x12,0x5A, 0x00,0x12,0xF0, 0x00,0x12,0xFB, 0x00,0x12,0xFE,
+    0x00,0x13,0x02, 0x00,0x13,0x20, 0x00,0x13,0x72, 0x00,0x13,0x77, 0x00,0x13,0xA9, 0x00,0x13,0xCE, 0x00,0x13,0xE8, 0x00,0x14,0x22,
+    0x00,0x14,0x51, 0x00,0x14,0x6C, 0x00,0x15,0x00, 0x00,0x15,0x17, 0x00,0x15,0x5D, 0x00,0x15,0x99, 0x00,0x15,0xB9, 0x00,0x15,0xC1,
+    0x00,0x15,0xC5, 0x00,0x16,0x32, 0x00,0x16,0x41, 0x00,0x16,0x6B, 0x00,0x16,0x6C, 0x00,0x16,0x6F, 0x00,0x16,0x76, 0x00,0x16,0xCB,
+    0x00,0x16,0xDB, 0x00,0x16,0xEA, 0x00,0x16,0xEB, 0x00,0x16,0xF0, 0x00,0x17,0xC9, 0x00,0x17,0xD5, 0x00,0x17,0xF2, 0x00,0x17,0xFA,
+    0x00,0x18,0x4D, 0x00,0x18,0x82, 0x00,0x18,0x8B, 0x00,0x18,0xAF, 0x00,0x18,0xDE, 0x00,0x19,0x63, 0x00,0x19,0x7D, 0x00,0x19,0x7E,
+    0x00,0x19,0xB9, 0x00,0x19,0xC5, 0x00,0x19,0xD1, 0x00,0x19,0xD2, 0x00,0x19,0xE3, 0x00,0x1A,0x11, 0x00,0x1A,0x6B, 0x00,0x1A,0x80,
+    0x00,0x1A,0x8A, 0x00,0x1A,0xA0, 0x00,0x1B,0x21, 0x00,0x1B,0x2F, 0x00,0x1B,0x63, 0x00,0x1B,0x77, 0x00,0x1B,0x98, 0x00,0x1C,0x23,
+    0x00,0x1C,0x26, 0x00,0x1C,0x43, 0x00,0x1C,0x62, 0x00,0x1C,0xB3, 0x00,0x1C,0xBF, 0x00,0x1C,0xC0, 0x00,0x1D,0x09, 0x00,0x1D,0x0D,
+    0x00,0x1D,0x0F, 0x00,0x1D,0x25, 0x00,0x1D,0x4F, 0x00,0x1D,0xBA, 0x00,0x1D,0xD8, 0x00,0x1D,0xE0, 0x00,0x1D,0xE1, 0x00,0x1D,0xF6,
+    0x00,0x1E,0x10, 0x00,0x1E,0x2A, 0x00,0x1E,0x37, 0x00,0x1E,0x4F, 0x00,0x1E,0x52, 0x00,0x1E,0x64, 0x00,0x1E,0x65, 0x00,0x1E,0x67,
+    0x00,0x1E,0x75, 0x00,0x1E,0x7D, 0x00,0x1E,0xA4, 0x00,0x1E,0xC2, 0x00,0x1E,0xC9, 0x00,0x1E,0xE1, 0x00,0x1E,0xE2, 0x00,0x1F,0x16,
+    0x00,0x1F,0x33, 0x00,0x1F,0x3A, 0x00,0x1F,0x3B, 0x00,0x1F,0x3C, 0x00,0x1F,0x5B, 0x00,0x1F,0x6B, 0x00,0x1F,0xCC, 0x00,0x1F,0xCD,
+    0x00,0x1F,0xE3, 0x00,0x1F,0xF3, 0x00,0x20,0xA6, 0x00,0x21,0x19, 0x00,0x21,0x4C, 0x00,0x21,0x5C, 0x00,0x21,0x5D, 0x00,0x21,0x5E,
+    0x00,0x21,0x6A, 0x00,0x21,0x6B, 0x00,0x21,0x70, 0x00,0x21,0x9B, 0x00,0x21,0xD1, 0x00,0x21,0xD2, 0x00,0x21,0xE9, 0x00,0x22,0x19,
+    0x00,0x22,0x3F, 0x00,0x22,0x41, 0x00,0x22,0x48, 0x00,0x22,0x68, 0x00,0x22,0xA1, 0x00,0x22,0xA9, 0x00,0x22,0xFA, 0x00,0x22,0xFB,
+    0x00,0x23,0x12, 0x00,0x23,0x32, 0x00,0x23,0x39, 0x00,0x23,0x4D, 0x00,0x23,0x6C, 0x00,0x23,0x99, 0x00,0x23,0xAE, 0x00,0x23,0xD6,
+    0x00,0x23,0xD7, 0x00,0x23,0xDF, 0x00,0x24,0x2B, 0x00,0x24,0x2C, 0x00,0x24,0x36, 0x00,0x24,0x54, 0x00,0x24,0x7E, 0x00,0x24,0x83,
+    0x00,0x24,0x90, 0x00,0x24,0x91, 0x00,0x24,0xB2, 0x00,0x24,0xBE, 0x00,0x24,0xD6, 0x00,0x24,0xD7, 0x00,0x24,0xE8, 0x00,0x25,0x00,
+    0x00,0x25,0x4B, 0x00,0x25,0x64, 0x00,0x25,0x66, 0x00,0x25,0x67, 0x00,0x25,0x68, 0x00,0x25,0x9E, 0x00,0x25,0xAE, 0x00,0x25,0xBC,
+    0x00,0x25,0xE5, 0x00,0x26,0x08, 0x00,0x26,0x37, 0x00,0x26,0x43, 0x00,0x26,0x4A, 0x00,0x26,0x5D, 0x00,0x26,0x5F, 0x00,0x26,0x6C,
+    0x00,0x26,0xB0, 0x00,0x26,0xB9, 0x00,0x26,0xBB, 0x00,0x26,0xC6, 0x00,0x26,0xC7, 0x00,0x26,0xE2, 0x00,0x26,0xF2, 0x00,0x27,0x19,
+    0x00,0x34,0xFE, 0x00,0x46,0x4B, 0x00,0x50,0xF2, 0x00,0x66,0x4B, 0x00,0x9A,0xCD, 0x00,0x9E,0xC8, 0x00,0xE0,0xFC, 0x00,0xFC,0x8B,
+    0x04,0x02,0x1F, 0x04,0x4B,0xED, 0x04,0xB0,0xE7, 0x04,0xC0,0x6F, 0x04,0xCF,0x8C, 0x04,0xF9,0x38, 0x08,0x19,0xA6, 0x08,0x63,0x61,
+    0x08,0x7A,0x4C, 0x08,0xE8,0x4F, 0x0C,0x1D,0xAF, 0x0C,0x47,0xC9, 0x10,0x2A,0xB3, 0x10,0x68,0x3F, 0x10,0xCE,0xA9, 0x10,0xFE,0xED,
+    0x14,0xC9,0x13, 0x14,0xCC,0x20, 0x14,0xCF,0x92, 0x14,0xF6,0x5A, 0x18,0x59,0x36, 0x18,0x74,0x2E, 0x18,0xA6,0xF7, 0x18,0xD6,0xC7,
+    0x1C,0x3B,0xF3, 0x1C,0xF2,0x9A, 0x20,0x21,0xA5, 0x20,0x34,0xFB, 0x20,0x4E,0x7F, 0x20,0xDF,0xB9, 0x24,0x0A,0xC4, 0x24,0x62,0xAB,
+    0x24,0x6F,0x28, 0x24,0xB2,0xDE, 0x28,0x0D,0xFC, 0x28,0x18,0x78, 0x28,0x6C,0x07, 0x28,0xC6,0x8E, 0x28,0xD2,0x44, 0x2C,0x59,0xE5,
+    0x2C,0xCC,0x44, 0x30,0x46,0x9A, 0x30,0x59,0xB7, 0x30,0x76,0x6F, 0x30,0xAE,0xA4, 0x30,0xB4,0x9E, 0x30,0xEB,0x25, 0x30,0xFD,0x38,
+    0x34,0x4D,0xF7, 0x34,0x80,0xB3, 0x34,0xD2,0x70, 0x38,0x8C,0x50, 0x38,0xA4,0xED, 0x38,0xF7,0x3D, 0x3C,0x5A,0xB4, 0x3C,0x61,0x05,
+    0x3C,0x71,0xBF, 0x3C,0xBD,0x3E, 0x40,0x1C,0x83, 0x40,0xB0,0xFA, 0x40,0xB4,0xCD, 0x40,0xB8,0x37, 0x44,0x65,0x0D, 0x44,0x94,0xFC,
+    0x48,0x5D,0x60, 0x4C,0x11,0xAE, 0x4C,0x60,0xDE, 0x4C,0x75,0x25, 0x4C,0xBB,0x58, 0x4C,0xEF,0xC0, 0x50,0x1A,0xC5, 0x50,0x64,0x2B,
+    0x50,0xC7,0xBF, 0x50,0xDC,0xE7, 0x54,0x60,0x09, 0x54,0xC8,0x0F, 0x54,0xE1,0xAD, 0x58,0x3F,0x54, 0x58,0x44,0x98, 0x58,0xCB,0x52,
+    0x5C,0x41,0x5A, 0x5C,0x89,0x9A, 0x5C,0xCF,0x7F, 0x60,0x01,0x94, 0x60,0x02,0x92, 0x60,0x45,0xBD, 0x60,0xD8,0x19, 0x60,0xE3,0x27,
+    0x64,0x09,0x80, 0x64,0x56,0x01, 0x64,0x70,0x02, 0x64,0x99,0x5D, 0x64,0xB4,0x73, 0x64,0xD9,0x54, 0x68,0x37,0xE9, 0x68,0x54,0xFD,
+    0x68,0x94,0x23, 0x68,0xC6,0x3A, 0x68,0xDF,0xDD, 0x6C,0x0B,0x84, 0x6C,0xB0,0xCE, 0x6C,0xDC,0x6A, 0x70,0xF1,0xA1, 0x74,0x23,0x44,
+    0x74,0x2F,0x68, 0x74,0xC2,0x46, 0x78,0x02,0xF8, 0x78,0x11,0xDC, 0x78,0x44,0x76, 0x78,0x5D,0xC8, 0x78,0x84,0x3C, 0x78,0xE1,0x03,
+    0x7C,0x1D,0xD9, 0x7C,0x1E,0x52, 0x7C,0xED,0x8D, 0x80,0x7D,0x3A, 0x84,0x0D,0x8E, 0x84,0x1B,0x5E, 0x84,0x24,0x8D, 0x84,0x7B,0xEB,
+    0x84,0xCC,0xA8, 0x84,0xD6,0xD0, 0x84,0xF3,0xEB, 0x88,0xC9,0xD0, 0x8C,0xAA,0xB5, 0x8C,0xBE,0xBE, 0x90,0xF6,0x52, 0x94,0xB9,0x7E,
+    0x94,0xEB,0x2C, 0x98,0xCD,0xAC, 0x98,0xDE,0xD0, 0x98,0xFA,0x9B, 0x98,0xFA,0xE3, 0x9C,0x3D,0xCF, 0x9C,0xD2,0x1E, 0xA0,0x02,0xDC,
+    0xA0,0x04,0x60, 0xA0,0x20,0xA6, 0xA0,0x39,0xF7, 0xA0,0xC5,0x89, 0xA4,0x2B,0x8C, 0xA4,0x2B,0xB0, 0xA4,0x77,0x33, 0xA4,0x7B,0x9D,
+    0xA4,0xCF,0x12, 0xA8,0x9C,0xED, 0xA8,0xE3,0xEE, 0xAC,0x63,0xBE, 0xAC,0x67,0xB2, 0xAC,0x84,0xC6, 0xAC,0x89,0x95, 0xAC,0xF7,0xF3,
+    0xB0,0x4E,0x26, 0xB0,0xBE,0x76, 0xB0,0xE2,0x35, 0xB4,0x7C,0x9C, 0xB4,0xB6,0x76, 0xB4,0xE6,0x2D, 0xB8,0x27,0xEB, 0xB8,0x6C,0xE4,
+    0xB8,0x70,0xF4, 0xBC,0xDD,0xC2, 0xBC,0xEE,0x7B, 0xBC,0xF5,0xAC, 0xC0,0x25,0xE9, 0xC0,0x3F,0x0E, 0xC4,0x04,0x15, 0xC4,0x0B,0xCB,
+    0xC4,0x34,0x6B, 0xC4,0x36,0x6C, 0xC4,0x4F,0x33, 0xC4,0xE9,0x84, 0xC8,0x02,0x8F, 0xC8,0x2B,0x96, 0xCC,0x2D,0x8C, 0xCC,0x50,0xE3,
+    0xD4,0x97,0x0B, 0xD8,0x07,0xB6, 0xD8,0x6C,0x63, 0xD8,0xA0,0x1D, 0xD8,0xBF,0xC0, 0xD8,0xD3,0x85, 0xDC,0x4F,0x22, 0xDC,0x85,0xDE,
+    0xDC,0xA6,0x32, 0xE0,0x46,0x9A, 0xE0,0x98,0x06, 0xE4,0x46,0xDA, 0xE4,0x5F,0x01, 0xE4,0xF4,0xC6, 0xE8,0x2A,0xEA, 0xE8,0x40,0xF2,
+    0xE8,0x5B,0x5B, 0xE8,0x94,0xF6, 0xE8,0xDB,0x84, 0xEC,0x08,0x6B, 0xEC,0x94,0xCB, 0xEC,0xFA,0xBC, 0xF0,0x27,0x2D, 0xF0,0x4D,0xA2,
+    0xF0,0xB4,0x29, 0xF4,0x8C,0x50, 0xF4,0xCF,0xA2, 0xF4,0xEC,0x38, 0xF4,0xF5,0xD8, 0xF4,0xF5,0xE8, 0xF8,0x0D,0xAC, 0xF8,0x1A,0x67,
+    0xF8,0x46,0x1C, 0xF8,0xA4,0x5F, 0xFC,0x0F,0xE6, 0xFC,0x64,0xBA, 0xFC,0x65,0xDE, 0xFC,0xF5,0xC4,
+};
+
+static const uint16_t OUI_DB_VENDOR[OUI_DB_COUNT] PROGMEM = {
+    2, 14, 2, 2, 15, 2, 2, 6, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 14, 2, 2, 8, 2, 2, 2, 2, 8, 1, 11, 15, 8, 9, 10,
+    3, 14, 8, 3, 14, 10, 12, 1, 1, 10, 3, 8, 11, 3, 1, 14,
+    14, 8, 8, 3, 12, 7, 1, 8, 1, 3, 3, 14, 11, 8, 14, 10,
+    8, 8, 3, 14, 15, 8, 8, 3, 1, 12, 8, 8, 11, 14, 14, 15,
+    3, 14, 10, 14, 14, 8, 8, 1, 14, 8, 8, 3, 14, 14, 1, 11,
+    12, 7, 3, 14, 8, 15, 6, 6, 3, 15, 8, 8, 1, 5, 10, 15,
+    14, 3, 8, 12, 1, 8, 14, 3, 6, 14, 9, 1, 8, 8, 3, 15,
+    16, 14, 1, 15, 11, 8, 8, 14, 7, 12, 10, 3, 1, 8, 8, 8,
+    9, 14, 15, 1, 3, 14, 14, 10, 12, 6, 8, 8, 1, 9, 14, 14,
+    9, 1, 8, 14, 14, 8, 8, 10, 8, 8, 3, 3, 14, 14, 1, 3,
+    12, 1, 11, 10, 7, 9, 8, 8, 1, 1, 14, 6, 1, 14, 3, 14,
+    14, 1, 6, 6, 1, 14, 10, 9, 14, 14, 12, 15, 8, 8, 3, 1,
+    1, 3, 14, 14, 7, 7, 11, 1, 9, 1, 14, 15, 1, 14, 14, 10,
+    1, 3, 1, 8, 8, 9, 12, 16, 7, 7, 11, 7, 7, 17, 7, 0,
+    7, 6, 7, 7, 17, 7, 7, 7, 7, 7, 17, 0, 17, 9, 0, 16,
+    9, 16, 16, 17, 17, 0, 16, 5, 16, 5, 9, 17, 12, 5, 4, 4,
+    4, 4, 15, 11, 17, 12, 10, 10, 15, 12, 11, 9, 4, 16, 15, 5,
+    9, 17, 0, 9, 17, 0, 5, 4, 4, 17, 10, 9, 0, 15, 0, 12,
+    6, 4, 12, 4, 6, 0, 11, 17, 16, 0, 5, 16, 10, 9, 17, 5,
+    0, 16, 4, 4, 10, 11, 6, 16, 17, 16, 16, 9, 17, 6, 0, 0,
+    6, 4, 17, 10, 16, 9, 10, 17, 6, 0, 17, 17, 16, 9, 15, 0,
+    17, 11, 11, 4, 4, 12, 17, 10, 4, 0, 4, 9, 4, 17, 16, 4,
+    5, 4, 16, 10, 17, 12, 6, 0, 12, 4, 9, 6, 12, 16, 5, 4,
+    4, 17, 15, 0, 4, 16, 15, 17, 16, 16, 17, 0, 6, 4, 13, 0,
+    10, 4, 6, 9, 16, 12, 12, 17, 10, 9, 4, 16, 17, 4, 9, 4,
+    17, 16, 5, 4, 4, 10, 4, 6, 13, 12, 4, 17, 13, 12, 6, 10,
+    9, 16, 4, 16, 4, 4, 0, 10, 17, 6, 4, 16, 5, 5, 9, 16,
+    15, 17, 15, 17, 0, 4,
+};
+
+static const uint32_t OUI_DB_NAME_OFF[OUI_DB_NAME_COUNT] PROGMEM = {
+    0, 7, 13, 19, 24, 34, 41, 48, 55, 61, 64, 71, 81, 89, 97, 105,
+    110, 118,
+};
+
+static const char OUI_DB_NAMES[] PROGMEM =
+    "Amazon\0"
+    "Apple\0"
+    "Cisco\0"
+    "Dell\0"
+    "Espressif\0"
+    "Google\0"
+    "HonHai\0"
+    "Huawei\0"
+    "Intel\0"
+    "LG\0"
+    "Lenovo\0"
+    "Microsoft\0"
+    "Netgear\0"
+    "RaspbPi\0"
+    "Samsung\0"
+    "Sony\0"
+    "TP-Link\0"
+    "Xiaomi\0"
+    ;
@@ -0,0 +1,103 @@
+// OUI lookup primitives - binary search over the generated prefix table
+// and a tiny move-to-front cache for recently seen prefixes.
+// Header-only, no Arduino dependencies (unit tested on native).
+#pragma once
+
+#include <stdint.h>
+
+namespace OuiLookup {
+
+// Vendor id used for prefixes that aren't in the table
+static const uint16_t kNoVendor = 0xFFFF;
+
+inline uint32_t keyFromMac(const uint8_t* mac) {
+    return ((uint32_t)mac[0] << 16) | ((uint32_t)mac[1] << 8) | mac[2];
+}
+
+// keys: count big-endian 3-byte prefixes, strictly ascending
+inline uint32_t keyAt(const uint8_t* keys, uint32_t i) {
+    const uint8_t* k = keys + i * 3;
+    return ((uint32_t)k[0] << 16) | ((uint32_t)k[1] << 8) | k[2];
+}
+
+// Index of key in the table, or -1
+inline int32_t find(const uint8_t* keys, uint32_t count, uint32_t key) {
+    uint32_t lo = 0;
+    uint32_t hi = count;
+    while (lo < hi) {
+        uint32_t mid = lo + (hi - lo) / 2;
+        uint32_t k = keyAt(keys, mid);
+        if (k < key) {
+            lo = mid + 1;
+        } else if (k > key) {
+            hi = mid;
+        } else {
+            return (int32_t)mid;
+        }
+    }
+    return -1;
+}
+
+// True if keys are strictly ascending (binary search precondition)
+inline bool isSorted(const uint8_t* keys, uint32_t count) {
+    for (uint32_t i = 1; i < count; i++) {
+        if (keyAt(keys, i - 1) >= keyAt(keys, i)) return false;
+    }
+    return true;
+}
+
+// N most recently used prefix -> vendor id pairs, most recent first.
+// Misses are cached too (as kNoVendor) so unknown clients stay cheap.
+// Not thread-safe; callers hold their own lock (OUI::getVendor is reached
+// from the WiFi callback as well as the main loop).
+template <uint8_t N>
+class LruCache {
+public:
+    LruCache() : used(0), hitCount(0), missCount(0) {}
+
+    bool lookup(uint32_t key, uint16_t& vendor) {
+        for (uint8_t i = 0; i < used; i++) {
+            if (keys[i] == key) {
+                vendor = vendors[i];
+                promote(i);
+                hitCount++;
+                return true;
+            }
+        }
+        missCount++;
+        return false;
+    }
+
+    // Insert as most recent, evicting the least recent when full
+    void insert(uint32_t key, uint16_t vendor) {
+        uint8_t slot = used < N ? used++ : (uint8_t)(N - 1);
+        keys[slot] = key;
+        vendors[slot] = vendor;
+        promote(slot);
+    }
+
+    void clear() { used = 0; hitCount = 0; missCount = 0; }
+    uint8_t size() const { return used; }
+    uint32_t hits() const { return hitCount; }
+    uint32_t misses() const { return missCount; }
+
+private:
+    void promote(uint8_t i) {
+        uint32_t k = keys[i];
+        uint16_t v = vendors[i];
+        for (; i > 0; i--) {
+            keys[i] = keys[i - 1];
+            vendors[i] = vendors[i - 1];
+        }
+        keys[0] = k;
+        vendors[0] = v;
+    }
+
+    uint32_t keys[N];
+    uint16_t vendors[N];
+    uint8_t used;
+    uint32_t hitCount;
+    uint32_t missCount;
+};
+
+}  // namespace OuiLookup
@@ -0,0 +1,147 @@
+// Pcapng - PCAPNG block + radiotap encoders for session capture
+// Writes into caller-owned buffers (little-endian, 4-byte aligned blocks).
+// Header-only, no allocation, no Arduino dependencies (unit tested on native).
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace Pcapng {
+
+// Block types (draft-ietf-opsawg-pcapng)
+static constexpr uint32_t kBlockSHB = 0x0A0D0D0A;
+static constexpr uint32_t kBlockIDB = 0x00000001;
+static constexpr uint32_t kBlockEPB = 0x00000006;
+static constexpr uint32_t kByteOrderMagic = 0x1A2B3C4D;
+
+static constexpr uint16_t kLinkTypeRadiotap = 127;  // LINKTYPE_IEEE802_11_RADIOTAP
+static constexpr uint32_t kSnapLen = 65535;
+
+// Radiotap: header(8) + Channel(4, 2-aligned) + dBm antenna signal(1) + pad(3)
+static constexpr uint16_t kRadiotapLen = 16;
+static constexpr uint32_t kRadiotapPresent = (1u << 3) | (1u << 5);  // CHANNEL | DBM_ANTSIGNAL
+static constexpr uint16_t kChan2GHz = 0x0080;
+
+static constexpr uint32_t kEPBOverhead = 32;  // type, len, ifid, ts(8), caplen, origlen, trailing len
+
+inline uint32_t pad4(uint32_t n) { return (n + 3u) & ~3u; }
+
+inline void put16(uint8_t* p, uint16_t v) {
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+}
+
+inline void put32(uint8_t* p, uint32_t v) {
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+    p[2] = (uint8_t)(v >> 16);
+    p[3] = (uint8_t)(v >> 24);
+}
+
+// 2.4 GHz channel -> centre frequency (MHz). 0 for out-of-band.
+inline uint16_t channelToFreq(uint8_t channel) {
+    if (channel >= 1 && channel <= 13) return (uint16_t)(2407 + channel * 5);
+    if (channel == 14) return 2484;
+    return 0;
+}
+
+// Section header with shb_userappl so tools can tell where the file came from.
+// Returns bytes written, 0 if cap is too small.
+inline size_t writeSHB(uint8_t* out, size_t cap, const char* userAppl = "M5PORKCHOP") {
+    uint32_t applLen = userAppl ? (uint32_t)strlen(userAppl) : 0;
+    uint32_t optLen = applLen ? 4 + pad4(applLen) + 4 : 0;  // option + opt_endofopt
+    uint32_t total = 28 + optLen;
+    if (!out || cap < total) return 0;
+
+    memset(out, 0, total);
+    put32(out, kBlockSHB);
+    put32(out + 4, total);
+    put32(out + 8, kByteOrderMagic);
+    put16(out + 12, 1);  // Major
+    put16(out + 14, 0);  // Minor
+    memset(out + 16, 0xFF, 8);  // Section length unknown (-1)
+    if (applLen) {
+        put16(out + 24, 4);  // shb_userappl
+        put16(out + 26, (uint16_t)applLen);
+        memcpy(out + 28, userAppl, applLen);
+        // opt_endofopt already zeroed
+    }
+    put32(out + total - 4, total);
+    return total;
+}
+
+// Interface description: radiotap link type, microsecond timestamps (default).
+inline size_t writeIDB(uint8_t* out, size_t cap) {
+    const uint32_t total = 20;
+    if (!out || cap < total) return 0;
+    put32(out, kBlockIDB);
+    put32(out + 4, total);
+    put16(out + 8, kLinkTypeRadiotap);
+    put16(out + 10, 0);
+    put32(out + 12, kSnapLen);
+    put32(out + 16, total);
+    return total;
+}
+
+// Size of the EPB for an 802.11 frame of frameLen bytes.
+inline uint32_t epbSize(uint16_t frameLen) {
+    return kEPBOverhead + pad4((uint32_t)kRadiotapLen + frameLen);
+}
+
+inline void writeRadiotap(uint8_t* out, int8_t rssi, uint8_t channel) {
+    memset(out, 0, kRadiotapLen);
+    put16(out + 2, kRadiotapLen);
+    put32(out + 4, kRadiotapPresent);
+    put16(out + 8, channelToFreq(channel));
+    put16(out + 10, kChan2GHz);
+    out[12] = (uint8_t)rssi;
+}
+
+/**
+ * Enhanced packet block: radiotap (real RSSI/channel) + 802.11 frame.
+ * @param tsUs Timestamp in microseconds (epoch if known, else since boot)
+ * @param origLen Frame length on air (>= frameLen if snapped)
+ * @return bytes written, 0 if cap is too small
+ */
+inline size_t writeEPB(uint8_t* out, size_t cap, uint64_t tsUs,
+                       int8_t rssi, uint8_t channel,
+                       const uint8_t* frame, uint16_t frameLen, uint16_t origLen) {
+    uint32_t total = epbSize(frameLen);
+    if (!out || cap < total) return 0;
+    uint32_t capLen = (uint32_t)kRadiotapLen + frameLen;
+
+    put32(out, kBlockEPB);
+    put32(out + 4, total);
+    put32(out + 8, 0);  // Interface 0
+    put32(out + 12, (uint32_t)(tsUs >> 32));
+    put32(out + 16, (uint32_t)tsUs);
+    put32(out + 20, capLen);
+    put32(out + 24, (uint32_t)kRadiotapLen + (origLen > frameLen ? origLen : frameLen));
+    writeRadiotap(out + 28, rssi, channel);
+    if (frameLen) memcpy(out + 28 + kRadiotapLen, frame, frameLen);
+    uint32_t padded = pad4(capLen);
+    if (padded > capLen) memset(out + 28 + capLen, 0, padded - capLen);
+    put32(out + total - 4, total);
+    return total;
+}
+
+// EAPOL (LLC/SNAP 0x888E) inside a data frame; handles 4-address, QoS and HTC.
+inline bool isEapolFrame(const uint8_t* frame, uint16_t len) {
+    if (!frame || len < 24) return false;
+    if (((frame[0] >> 2) & 0x03) != 2) return false;  // Not a data frame
+    uint16_t offset = 24;
+    if ((frame[1] & 0x03) == 0x03) offset += 6;        // Address 4
+    bool isQoS = (frame[0] & 0x80) != 0;
+    if (isQoS) {
+        offset += 2;
+        if (frame[1] & 0x80) offset += 4;              // HTC
+    }
+    if (offset + 8 > len) return false;
+    const uint8_t* llc = frame + offset;
+    return llc[0] == 0xAA && llc[1] == 0xAA && llc[2] == 0x03 &&
+           llc[3] == 0x00 && llc[4] == 0x00 && llc[5] == 0x00 &&
+           llc[6] == 0x88 && llc[7] == 0x8E;
+}
+
+}  // namespace Pcapng
@@ -30,6 +30,7 @@
 #include "../audio/sfx.h"
 #include "config.h"
 #include "heap_health.h"
+#include "heap_trace.h"
 #include "xp.h"
 #include "sdlog.h"
 #include "sd_format.h"
@@ -71,6 +72,10 @@ static const char* modeToString(PorkchopMode mode) {
     }
 }
 
+const char* Porkchop::modeName(PorkchopMode mode) {
+    return modeToString(mode);
+}
+
 // Crash-loop guard: count early reboots using RTC memory (survives soft resets).
 RTC_DATA_ATTR static uint8_t bootGuardStreak = 0;
 static uint32_t bootGuardStartMs = 0;
@@ -186,17 +191,9 @@ void Porkchop::init() {
     });
     
     // Register default event handlers
-    registerCallback(PorkchopEvent::HANDSHAKE_CAPTURED, [this](PorkchopEvent, void*) {
-        handshakeCount++;
-    });
-    
-    registerCallback(PorkchopEvent::NETWORK_FOUND, [this](PorkchopEvent, void*) {
-        networkCount++;
-    });
-    
-    registerCallback(PorkchopEvent::DEAUTH_SENT, [this](PorkchopEvent, void*) {
-        deauthCount++;
-    });
+    registerCallback(PorkchopEvent::HANDSHAKE_CAPTURED, onCountEvent, this);
+    registerCallback(PorkchopEvent::NETWORK_FOUND, onCountEvent, this);
+    registerCallback(PorkchopEvent::DEAUTH_SENT, onCountEvent, this);
     
     // Menu selection handler - items now defined in menu.cpp as static arrays
     Menu::setCallback([this](uint8_t actionId) {
@@ -265,7 +262,14 @@ void Porkchop::init() {
 
 void Porkchop::update() {
     // Update background network reconnaissance (channel hopping, cleanup)
-    NetworkRecon::update();
+    {
+        HeapTrace::Scope heapTag(HeapTrace::Tag::Recon);
+        NetworkRecon::update();
+    }
+    
+    // Deferred start work queued by last frame's setMode(); that frame has
+    // already drawn the new mode's screen
+    runStartSteps();
     
     processEvents();
     yield(); // Allow other tasks to run between operations
@@ -302,10 +306,111 @@ void Porkchop::update() {
     // Check for session time XP bonuses
     XP::updateSessionTime();
     yield(); // Allow other tasks to run between operations
+    
+    // Coalesced XP save; SD backup only in modes without capture traffic
+    XP::update(isAutoConditionSafe(currentMode));
+}
+
+// Heap trace attribution for a mode's start/update work
+static HeapTrace::Tag heapTagForMode(PorkchopMode mode) {
+    switch (mode) {
+        case PorkchopMode::OINK_MODE:
+        case PorkchopMode::DNH_MODE:
+            return HeapTrace::Tag::Oink;
+        case PorkchopMode::FILE_TRANSFER:
+            return HeapTrace::Tag::FileServer;
+        case PorkchopMode::PIGGYBLUES_MODE:
+            return HeapTrace::Tag::Ble;
+        case PorkchopMode::IDLE:
+        case PorkchopMode::WARHOG_MODE:
+        case PorkchopMode::SPECTRUM_MODE:
+        case PorkchopMode::BACON_MODE:
+        case PorkchopMode::PIGSYNC_DEVICE_SELECT:
+        case PorkchopMode::PIGSYNC_CALL:
+        case PorkchopMode::CHARGING:
+            return HeapTrace::Tag::Other;
+        default:
+            return HeapTrace::Tag::Ui;     // Menus and viewers
+    }
+}
+
+static void beginProbe(ModeLatency::Probe& probe) {
+    probe.begin((uint32_t)micros(), (uint32_t)esp_get_free_heap_size(),
+                (uint32_t)heap_caps_get_largest_free_block(MALLOC_CAP_8BIT));
+}
+
+void Porkchop::recordTransition(const ModeLatency::Probe& probe, PorkchopMode mode, ModeLatency::Kind kind) {
+    ModeLatency::Sample s = probe.finish((uint32_t)micros(), millis(),
+        (uint32_t)esp_get_free_heap_size(),
+        (uint32_t)heap_caps_get_largest_free_block(MALLOC_CAP_8BIT),
+        (uint8_t)mode, kind);
+    transitions.push(s);
+    Serial.printf("[MODE] %s %s %lu.%lums free%+ld largest%+ld%s\n",
+        modeToString(mode), ModeLatency::kindName(kind),
+        (unsigned long)(s.us / 1000), (unsigned long)(s.us % 1000 / 100),
+        (long)s.freeDelta, (long)s.largestDelta,
+        s.overBudget() ? " OVER BUDGET" : "");
+}
+
+// Deferred start steps: WiFi reconfiguration and mode start() each get a
+// frame of their own instead of blocking the keypress that asked for them
+static bool stepEnsureRecon() {
+    if (!NetworkRecon::isRunning()) {
+        NetworkRecon::start();
+    }
+    return true;
+}
+
+static bool stepStopRecon() {
+    NetworkRecon::stop();
+    return true;
+}
+
+// OINK and SPECTRUM start in phases: false until running
+static bool stepStartOink() {
+    return OinkMode::startStep();
+}
+
+static bool stepStartDnh() {
+    DoNoHamMode::start();
+    return true;
+}
+
+static bool stepStartSpectrum() {
+    return SpectrumMode::startStep();
+}
+
+static bool stepStartWarhog() {
+    WarhogMode::start();
+    return true;
+}
+
+static bool stepStartFileServer() {
+    FileServer::start(Config::wifi().otaSSID, Config::wifi().otaPassword);
+    return true;
+}
+
+void Porkchop::runStartSteps() {
+    if (!startSteps.pending()) return;
+    PorkchopMode owner = (PorkchopMode)startSteps.owner();
+    HeapTrace::Scope heapTag(heapTagForMode(owner));
+    uint32_t frameStart = micros();
+    do {
+        ModeLatency::Probe probe;
+        beginProbe(probe);
+        startSteps.runOne();
+        recordTransition(probe, owner, ModeLatency::Kind::Step);
+        yield();
+    } while (startSteps.pending() && currentMode == owner &&
+             micros() - frameStart < ModeLatency::kStepBudgetUs);
 }
 
 void Porkchop::setMode(PorkchopMode mode) {
     if (mode == currentMode) return;
+    HeapTrace::Scope heapTag(heapTagForMode(mode));
+    
+    // Steps the old mode never got to are moot now
+    startSteps.cancel();
     
     // Store the mode we're leaving for cleanup
     PorkchopMode oldMode = currentMode;
@@ -345,6 +450,8 @@ void Porkchop::setMode(PorkchopMode mode) {
         (unsigned)heap_caps_get_largest_free_block(MALLOC_CAP_8BIT));
     
     // Cleanup the mode we're actually leaving (oldMode), not previousMode
+    ModeLatency::Probe probe;
+    beginProbe(probe);
     switch (oldMode) {
         case PorkchopMode::OINK_MODE:
             OinkMode::stop();
@@ -415,8 +522,12 @@ void Porkchop::setMode(PorkchopMode mode) {
         default:
             break;
     }
+    recordTransition(probe, oldMode, ModeLatency::Kind::Stop);
     
-    // Init new mode
+    // Init new mode. Modes that reconfigure WiFi or start capture queue
+    // that work in startSteps; it runs from the next update().
+    beginProbe(probe);
+    startSteps.begin((uint8_t)mode);
     switch (currentMode) {
         case PorkchopMode::IDLE:
             Avatar::setState(AvatarState::NEUTRAL);
@@ -428,12 +539,14 @@ void Porkchop::setMode(PorkchopMode mode) {
             Avatar::setState(AvatarState::HUNTING);
             Display::notify(NoticeKind::STATUS, "PROPER MAD ONE INNIT", 5000, NoticeChannel::TOP_BAR);
             SDLog::log("PORK", "Mode: OINK");
-            OinkMode::start();
+            startSteps.add(stepEnsureRecon);
+            startSteps.add(stepStartOink);
             break;
         case PorkchopMode::DNH_MODE:
             Avatar::setState(AvatarState::NEUTRAL);  // Calm, passive state
             SDLog::log("PORK", "Mode: DO NO HAM");
-            DoNoHamMode::start();
+            startSteps.add(stepEnsureRecon);
+            startSteps.add(stepStartDnh);
             break;
         case PorkchopMode::WARHOG_MODE:
             Avatar::setState(AvatarState::EXCITED);
@@ -446,7 +559,7 @@ void Porkchop::setMode(PorkchopMode mode) {
                 mlCfg.collectionMode = MLCollectionMode::BASIC;
                 Config::setML(mlCfg);
             }
-            WarhogMode::start();
+            startSteps.add(stepStartWarhog);
             break;
         case PorkchopMode::PIGGYBLUES_MODE:
             Avatar::setState(AvatarState::ANGRY);
@@ -461,7 +574,8 @@ void Porkchop::setMode(PorkchopMode mode) {
         case PorkchopMode::SPECTRUM_MODE:
             Avatar::setState(AvatarState::HUNTING);
             SDLog::log("PORK", "Mode: SPECTRUM");
-            SpectrumMode::start();
+            startSteps.add(stepEnsureRecon);
+            startSteps.add(stepStartSpectrum);
             break;
         case PorkchopMode::MENU:
             Menu::show();
@@ -478,9 +592,9 @@ void Porkchop::setMode(PorkchopMode mode) {
         case PorkchopMode::FILE_TRANSFER:
             // Stop NetworkRecon to prevent heap fragmentation during FILE_TRANSFER
             // (promiscuous callbacks interleaved with WebServer allocs cause fragmentation)
-            NetworkRecon::stop();
             Avatar::setState(AvatarState::HAPPY);
-            FileServer::start(Config::wifi().otaSSID, Config::wifi().otaPassword);
+            startSteps.add(stepStopRecon);
+            startSteps.add(stepStartFileServer);
             break;
         case PorkchopMode::CRASH_VIEWER:
             CrashViewer::show();
@@ -528,66 +642,43 @@ void Porkchop::setMode(PorkchopMode mode) {
         default:
             break;
     }
+    recordTransition(probe, mode, ModeLatency::Kind::Start);
     
     postEvent(PorkchopEvent::MODE_CHANGE, nullptr);
 }
 
-void Porkchop::postEvent(PorkchopEvent event, void* data) {
-    // Prevent event queue overflow that could cause heap fragmentation
-    if (eventQueue.size() >= MAX_EVENT_QUEUE_SIZE) {
-        // Drop oldest event to maintain queue size
-        eventQueue.erase(eventQueue.begin());
-    }
-    eventQueue.push_back({event, data});
+bool Porkchop::postEvent(PorkchopEvent event, void* data) {
+    // Full queue drops the new event; counted in getEventQueueStats()
+    return events.post(event, data);
 }
 
-void Porkchop::registerCallback(PorkchopEvent event, EventCallback callback) {
-    // Prevent duplicate callbacks for the same event to avoid multiple executions
-    // Note: We can't reliably compare std::function objects, so we just ensure each event
-    // type has only one callback by replacing any existing one
-    for (auto& pair : callbacks) {
-        if (pair.first == event) {
-            pair.second = callback; // Replace existing callback
-            return;
-        }
-    }
-    // Add bounds checking to prevent unlimited growth
-    if (callbacks.size() >= MAX_EVENT_QUEUE_SIZE) {
-        // Remove the oldest callback if we're at capacity
-        callbacks.erase(callbacks.begin());
+bool Porkchop::registerCallback(PorkchopEvent event, EventCallback callback, void* ctx) {
+    // Several callbacks per event type; the same (callback, ctx) twice is one
+    if (!events.subscribe(event, callback, ctx)) {
+        Serial.printf("[PORK] Event %u callback table full\n", (unsigned int)event);
+        return false;
     }
-    callbacks.push_back({event, callback});
+    return true;
 }
 
-void Porkchop::processEvents() {
-    // Process events with bounds checking and yield for WDT safety
-    // NOTE: All postEvent() callers pass nullptr for data — no ownership to track.
-    size_t processed = 0;
-    const size_t MAX_EVENTS_PER_UPDATE = 16; // Limit events processed per update to prevent WDT
-
-    // Index-based loop to avoid iterator invalidation from erase()
-    size_t i = 0;
-    while (i < eventQueue.size() && processed < MAX_EVENTS_PER_UPDATE) {
-        const auto& item = eventQueue[i];
-
-        for (const auto& cb : callbacks) {
-            if (cb.first == item.event) {
-                cb.second(item.event, item.data);
+bool Porkchop::unregisterCallback(PorkchopEvent event, EventCallback callback, void* ctx) {
+    return events.unsubscribe(event, callback, ctx);
+}
 
-                if (++processed % 4 == 0) {
-                    yield();
-                }
-            }
-        }
-        i++;
+void Porkchop::onCountEvent(PorkchopEvent event, void*, void* ctx) {
+    Porkchop* self = static_cast<Porkchop*>(ctx);
+    switch (event) {
+        case PorkchopEvent::HANDSHAKE_CAPTURED: self->handshakeCount++; break;
+        case PorkchopEvent::NETWORK_FOUND: self->networkCount++; break;
+        case PorkchopEvent::DEAUTH_SENT: self->deauthCount++; break;
+        default: break;
     }
+}
 
-    // Erase all processed events in one operation after the loop
-    if (i >= eventQueue.size()) {
-        eventQueue.clear();
-    } else {
-        eventQueue.erase(eventQueue.begin(), eventQueue.begin() + i);
-    }
+void Porkchop::processEvents() {
+    // Bounded per loop for WDT safety; the rest waits for the next update()
+    // NOTE: All postEvent() callers pass nullptr for data — no ownership to track.
+    events.dispatch(EVENTS_PER_UPDATE);
 }
 
 void Porkchop::handleInput() {
@@ -813,9 +904,8 @@ void Porkchop::handleInput() {
             SessionStats& sess = const_cast<SessionStats&>(XP::getSession());
             sess.passiveTimeStart = millis();
             
-            // Show toast before mode switch (loading screen)
+            // Toast shows on this frame; the new mode starts on the next
             Display::notify(NoticeKind::STATUS, "IRIE VIBES ONLY NOW", 0, NoticeChannel::TOP_BAR);
-            delay(800);
             
             // Seamless switch to DNH mode
             setMode(PorkchopMode::DNH_MODE);
@@ -834,9 +924,8 @@ void Porkchop::handleInput() {
             SessionStats& sess = const_cast<SessionStats&>(XP::getSession());
             sess.passiveTimeStart = 0;
             
-            // Show toast before mode switch (loading screen)
+            // Toast shows on this frame; the new mode starts on the next
             Display::notify(NoticeKind::STATUS, "PROPER MAD ONE INNIT", 0, NoticeChannel::TOP_BAR);
-            delay(800);
             
             // Seamless switch to OINK mode
             setMode(PorkchopMode::OINK_MODE);
@@ -871,6 +960,7 @@ void Porkchop::handleInput() {
 }
 
 void Porkchop::updateMode() {
+    HeapTrace::Scope heapTag(heapTagForMode(currentMode));
     switch (currentMode) {
         case PorkchopMode::OINK_MODE:
             OinkMode::update();
@@ -2,8 +2,8 @@
 #pragma once
 
 #include <Arduino.h>
-#include <functional>
-#include <vector>
+#include "mode_latency.h"
+#include "event_bus.h"
 
 // Operating modes
 enum class PorkchopMode : uint8_t {
@@ -48,8 +48,10 @@ enum class PorkchopEvent : uint8_t {
     LOW_BATTERY
 };
 
-// Event callback type
-using EventCallback = std::function<void(PorkchopEvent, void*)>;
+static const uint8_t PORKCHOP_EVENT_TYPES = (uint8_t)PorkchopEvent::LOW_BATTERY + 1;
+
+// Event callback type: plain function + context pointer (no captures, no heap)
+typedef void (*EventCallback)(PorkchopEvent event, void* data, void* ctx);
 
 class Porkchop {
 public:
@@ -62,9 +64,13 @@ public:
     void setMode(PorkchopMode mode);
     PorkchopMode getMode() const { return currentMode; }
     
-    // Event system
-    void postEvent(PorkchopEvent event, void* data = nullptr);
-    void registerCallback(PorkchopEvent event, EventCallback callback);
+    // Event system. postEvent() is safe from any task; callbacks run from
+    // update() on the main loop.
+    bool postEvent(PorkchopEvent event, void* data = nullptr);
+    bool registerCallback(PorkchopEvent event, EventCallback callback, void* ctx = nullptr);
+    bool unregisterCallback(PorkchopEvent event, EventCallback callback, void* ctx = nullptr);
+    RingStats getEventQueueStats() const { return events.queueStats(); }
+    const EventBus::Stats& getEventDispatchStats() const { return events.dispatchStats(); }
     
     // Stats
     uint32_t getUptime() const;
@@ -72,6 +78,12 @@ public:
     uint16_t getNetworkCount() const;     // Gets from OinkMode
     uint16_t getDeauthCount() const;      // Gets from OinkMode
     
+    // Mode transition timings (oldest first) and deferred start progress
+    static const uint8_t TRANSITION_HISTORY = 16;
+    const ModeLatency::Ring<TRANSITION_HISTORY>& getTransitions() const { return transitions; }
+    bool isModeStarting() const { return startSteps.pending(); }
+    static const char* modeName(PorkchopMode mode);
+    
 private:
     PorkchopMode currentMode;
     PorkchopMode previousMode;
@@ -86,16 +98,20 @@ private:
     PorkchopMode bootModeTarget = PorkchopMode::IDLE;
     uint32_t bootModeStartMs = 0;
     
-    // Event queue with max capacity to prevent memory exhaustion
-    static constexpr size_t MAX_EVENT_QUEUE_SIZE = 32;  // Prevent runaway allocations
-    struct EventItem {
-        PorkchopEvent event;
-        void* data;
-    };
-    std::vector<EventItem> eventQueue;
-    std::vector<std::pair<PorkchopEvent, EventCallback>> callbacks;
+    // Fixed-capacity event queue + per-type callback tables (no heap)
+    static constexpr uint16_t EVENT_QUEUE_SIZE = 32;        // Power of two
+    static constexpr uint8_t EVENT_CALLBACKS_PER_TYPE = 4;
+    static constexpr uint16_t EVENTS_PER_UPDATE = 16;       // Dispatch budget per loop
+    EventBus::Bus<PorkchopEvent, PORKCHOP_EVENT_TYPES, EVENT_CALLBACKS_PER_TYPE, EVENT_QUEUE_SIZE> events;
+    
+    // Transition timing ring and the current mode's deferred start steps
+    ModeLatency::Ring<TRANSITION_HISTORY> transitions;
+    ModeLatency::StepQueue startSteps;
     
     void processEvents();
+    static void onCountEvent(PorkchopEvent event, void* data, void* ctx);
     void handleInput();
     void updateMode();
+    void runStartSteps();
+    void recordTransition(const ModeLatency::Probe& probe, PorkchopMode mode, ModeLatency::Kind kind);
 };
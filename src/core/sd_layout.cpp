@@ -16,6 +16,7 @@ static constexpr const char* kLegacyModels = "/models";
 static constexpr const char* kLegacyLogs = "/logs";
 static constexpr const char* kLegacyCrash = "/crash";
 static constexpr const char* kLegacyScreenshots = "/screenshots";
+static constexpr const char* kLegacyCaptures = "/captures";
 
 static constexpr const char* kNewHandshakes = "/m5porkchop/handshakes";
 static constexpr const char* kNewWardriving = "/m5porkchop/wardriving";
@@ -23,6 +24,7 @@ static constexpr const char* kNewModels = "/m5porkchop/models";
 static constexpr const char* kNewLogs = "/m5porkchop/logs";
 static constexpr const char* kNewCrash = "/m5porkchop/crash";
 static constexpr const char* kNewScreenshots = "/m5porkchop/screenshots";
+static constexpr const char* kNewCaptures = "/m5porkchop/captures";
 static constexpr const char* kNewDiagnostics = "/m5porkchop/diagnostics";
 static constexpr const char* kNewWpaSec = "/m5porkchop/wpa-sec";
 static constexpr const char* kNewWigle = "/m5porkchop/wigle";
@@ -33,6 +35,7 @@ static constexpr const char* kNewMeta = "/m5porkchop/meta";
 
 static constexpr const char* kLegacyConfig = "/porkchop.conf";
 static constexpr const char* kLegacyPersonality = "/personality.json";
+static constexpr const char* kLegacyWpasecIndex = "/wpasec_results.idx";
 static constexpr const char* kLegacyWpasecResults = "/wpasec_results.txt";
 static constexpr const char* kLegacyWpasecUploaded = "/wpasec_uploaded.txt";
 static constexpr const char* kLegacyWpasecSent = "/wpasec_sent.txt";
@@ -45,9 +48,13 @@ static constexpr const char* kLegacyBoarBros = "/boar_bros.txt";
 static constexpr const char* kLegacyHeapLog = "/heap_log.txt";
 static constexpr const char* kLegacyWpasecKey = "/wpasec_key.txt";
 static constexpr const char* kLegacyWigleKey = "/wigle_key.txt";
+static constexpr const char* kLegacyCaptureJournal = "/capture_journal.bin";
+static constexpr const char* kLegacyCaptureCatalog = "/capture_catalog.bin";
+static constexpr const char* kLegacyBootLog = "/boot_log.txt";
 
 static constexpr const char* kNewConfigPath = "/m5porkchop/config/porkchop.conf";
 static constexpr const char* kNewPersonalityPath = "/m5porkchop/config/personality.json";
+static constexpr const char* kNewWpasecIndex = "/m5porkchop/wpa-sec/wpasec_results.idx";
 static constexpr const char* kNewWpasecResults = "/m5porkchop/wpa-sec/wpasec_results.txt";
 static constexpr const char* kNewWpasecUploaded = "/m5porkchop/wpa-sec/wpasec_uploaded.txt";
 static constexpr const char* kNewWpasecSent = "/m5porkchop/wpa-sec/wpasec_sent.txt";
@@ -60,6 +67,9 @@ static constexpr const char* kNewBoarBros = "/m5porkchop/misc/boar_bros.txt";
 static constexpr const char* kNewHeapLog = "/m5porkchop/diagnostics/heap_log.txt";
 static constexpr const char* kNewWpasecKey = "/m5porkchop/wpa-sec/wpasec_key.txt";
 static constexpr const char* kNewWigleKey = "/m5porkchop/wigle/wigle_key.txt";
+static constexpr const char* kNewCaptureJournal = "/m5porkchop/meta/capture_journal.bin";
+static constexpr const char* kNewCaptureCatalog = "/m5porkchop/meta/capture_catalog.bin";
+static constexpr const char* kNewBootLog = "/m5porkchop/diagnostics/boot_log.txt";
 
 // Use mutex to protect shared state
 static portMUX_TYPE layoutMutex = portMUX_INITIALIZER_UNLOCKED;
@@ -400,6 +410,7 @@ const char* modelsDir() { return usingNewLayout() ? kNewModels : kLegacyModels;
 const char* logsDir() { return usingNewLayout() ? kNewLogs : kLegacyLogs; }
 const char* crashDir() { return usingNewLayout() ? kNewCrash : kLegacyCrash; }
 const char* screenshotsDir() { return usingNewLayout() ? kNewScreenshots : kLegacyScreenshots; }
+const char* capturesDir() { return usingNewLayout() ? kNewCaptures : kLegacyCaptures; }
 const char* diagnosticsDir() { return usingNewLayout() ? kNewDiagnostics : "/"; }
 const char* wpaSecDir() { return usingNewLayout() ? kNewWpaSec : "/"; }
 const char* wigleDir() { return usingNewLayout() ? kNewWigle : "/"; }
@@ -411,6 +422,7 @@ const char* metaDir() { return usingNewLayout() ? kNewMeta : "/"; }
 const char* configPathSD() { return usingNewLayout() ? kNewConfigPath : kLegacyConfig; }
 const char* personalityPathSD() { return usingNewLayout() ? kNewPersonalityPath : kLegacyPersonality; }
 const char* wpasecResultsPath() { return usingNewLayout() ? kNewWpasecResults : kLegacyWpasecResults; }
+const char* wpasecIndexPath() { return usingNewLayout() ? kNewWpasecIndex : kLegacyWpasecIndex; }
 const char* wpasecUploadedPath() { return usingNewLayout() ? kNewWpasecUploaded : kLegacyWpasecUploaded; }
 const char* wpasecSentPath() { return usingNewLayout() ? kNewWpasecSent : kLegacyWpasecSent; }
 const char* wigleUploadedPath() { return usingNewLayout() ? kNewWigleUploaded : kLegacyWigleUploaded; }
@@ -422,6 +434,9 @@ const char* boarBrosPath() { return usingNewLayout() ? kNewBoarBros : kLegacyBoa
 const char* heapLogPath() { return usingNewLayout() ? kNewHeapLog : kLegacyHeapLog; }
 const char* wpasecKeyPath() { return usingNewLayout() ? kNewWpasecKey : kLegacyWpasecKey; }
 const char* wigleKeyPath() { return usingNewLayout() ? kNewWigleKey : kLegacyWigleKey; }
+const char* captureJournalPath() { return usingNewLayout() ? kNewCaptureJournal : kLegacyCaptureJournal; }
+const char* captureCatalogPath() { return usingNewLayout() ? kNewCaptureCatalog : kLegacyCaptureCatalog; }
+const char* bootLogPath() { return usingNewLayout() ? kNewBootLog : kLegacyBootLog; }
 
 const char* legacyConfigPath() { return kLegacyConfig; }
 const char* legacyPersonalityPath() { return kLegacyPersonality; }
@@ -445,6 +460,7 @@ void ensureDirs() {
     ensureDir(kNewLogs);
     ensureDir(kNewCrash);
     ensureDir(kNewScreenshots);
+    ensureDir(kNewCaptures);
     ensureDir(kNewDiagnostics);
     ensureDir(kNewWpaSec);
     ensureDir(kNewWigle);
@@ -622,6 +638,7 @@ bool migrateIfNeeded() {
     if (!movePath(kLegacyConfig, kNewConfigPath, moved)) { rollbackMoves(moved); setUseNewLayout(false); return false; }
     if (!movePath(kLegacyPersonality, kNewPersonalityPath, moved)) { rollbackMoves(moved); setUseNewLayout(false); return false; }
     if (!movePath(kLegacyWpasecResults, kNewWpasecResults, moved)) { rollbackMoves(moved); setUseNewLayout(false); return false; }
+    if (!movePath(kLegacyWpasecIndex, kNewWpasecIndex, moved)) { rollbackMoves(moved); setUseNewLayout(false); return false; }
     if (!movePath(kLegacyWpasecUploaded, kNewWpasecUploaded, moved)) { rollbackMoves(moved); setUseNewLayout(false); return false; }
     if (!movePath(kLegacyWpasecSent, kNewWpasecSent, moved)) { rollbackMoves(moved); setUseNewLayout(false); return false; }
     if (!movePath(kLegacyWigleUploaded, kNewWigleUploaded, moved)) { rollbackMoves(moved); setUseNewLayout(false); return false; }
@@ -633,6 +650,9 @@ bool migrateIfNeeded() {
     if (!movePath(kLegacyHeapLog, kNewHeapLog, moved)) { rollbackMoves(moved); setUseNewLayout(false); return false; }
     if (!movePath(kLegacyWpasecKey, kNewWpasecKey, moved)) { rollbackMoves(moved); setUseNewLayout(false); return false; }
     if (!movePath(kLegacyWigleKey, kNewWigleKey, moved)) { rollbackMoves(moved); setUseNewLayout(false); return false; }
+    if (!movePath(kLegacyCaptureJournal, kNewCaptureJournal, moved)) { rollbackMoves(moved); setUseNewLayout(false); return false; }
+    if (!movePath(kLegacyCaptureCatalog, kNewCaptureCatalog, moved)) { rollbackMoves(moved); setUseNewLayout(false); return false; }
+    if (!movePath(kLegacyBootLog, kNewBootLog, moved)) { rollbackMoves(moved); setUseNewLayout(false); return false; }
 
     std::vector<String> diag2;
     diag2.reserve(10);
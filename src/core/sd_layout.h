@@ -19,6 +19,7 @@ namespace SDLayout {
     const char* logsDir();
     const char* crashDir();
     const char* screenshotsDir();
+    const char* capturesDir();           // Session PCAPNG captures
     const char* diagnosticsDir();
     const char* wpaSecDir();
     const char* wigleDir();
@@ -31,6 +32,7 @@ namespace SDLayout {
     const char* configPathSD();
     const char* personalityPathSD();
     const char* wpasecResultsPath();
+    const char* wpasecIndexPath();       // Sorted BSSID index of the potfile
     const char* wpasecUploadedPath();
     const char* wpasecSentPath();
     const char* wigleUploadedPath();
@@ -42,6 +44,9 @@ namespace SDLayout {
     const char* heapLogPath();
     const char* wpasecKeyPath();
     const char* wigleKeyPath();
+    const char* captureJournalPath();    // Append-only EAPOL/PMKID journal
+    const char* captureCatalogPath();    // LOOT menu index of the handshakes dir
+    const char* bootLogPath();           // Boot phase timings, one block per boot
 
     // Legacy paths (explicit, for fallback imports)
     const char* legacyConfigPath();
@@ -3,61 +3,308 @@
 #include "sdlog.h"
 #include "config.h"
 #include "sd_layout.h"
+#include "heap_policy.h"
+#include "log_ring.h"
 #include <SD.h>
+#include <esp_heap_caps.h>
 #include <stdarg.h>
+#include <atomic>
 
 bool SDLog::logEnabled = false;
 bool SDLog::initialized = false;
-String SDLog::currentLogFile = "";
+
+// ============================================================================
+// Tuning
+// ============================================================================
+
+// A busy OINK burst logs ~100 lines/s; 8KB covers a few seconds of SD stall
+static const uint32_t RING_BYTES_INTERNAL = 8 * 1024;
+static const uint32_t RING_BYTES_PSRAM = 32 * 1024;
+static const uint32_t RING_BYTES_LOW_HEAP = 2 * 1024;
+
+// Writes go out in whole sectors; a partial sector waits at most IDLE_FLUSH_MS
+static const uint32_t SECTOR_BYTES = 512;
+static const uint32_t IDLE_FLUSH_MS = 1000;
+static const uint32_t SYNC_INTERVAL_MS = 5000;   // Directory entry (size) update
+static const uint32_t WRITER_POLL_MS = 250;
+
+// porkchop.log rolls to porkchop.1.log at this size (one old file kept)
+static const uint32_t ROTATE_BYTES = 512UL * 1024UL;
+
+static const uint32_t FLUSH_WAIT_MS = 1000;
+static const uint32_t WRITER_STOP_TIMEOUT_MS = 2000;
+
+// ============================================================================
+// State
+// ============================================================================
+
+static LogRing ring;
+static uint8_t* ringStorage = nullptr;
+static uint8_t sectorBuf[SECTOR_BYTES];
+
+// Producers can be any task; the ring itself is single-producer
+static portMUX_TYPE producerMux = portMUX_INITIALIZER_UNLOCKED;
+
+static TaskHandle_t writerHandle = NULL;
+static std::atomic<bool> stopRequested{false};
+static std::atomic<bool> writerExited{true};
+static std::atomic<uint32_t> flushRequested{0};
+static std::atomic<uint32_t> flushCompleted{0};
+
+static File logFile;
+static char logPath[64] = "";
+static char rotatedPath[64] = "";
+static uint32_t fileBytes = 0;
+
+static uint32_t bytesWritten = 0;
+static uint32_t batches = 0;
+static uint32_t rotations = 0;
+static uint32_t writeErrors = 0;
+static SDLog::Stats lastStats = {};  // Final counters of the previous session
+
+// ============================================================================
+// Writer (low-priority task)
+// ============================================================================
+
+static bool openLogFile() {
+    logFile = SD.open(logPath, FILE_APPEND);
+    if (!logFile) {
+        Serial.printf("[SDLOG] Failed to open: %s\n", logPath);
+        writeErrors++;
+        return false;
+    }
+    fileBytes = (uint32_t)logFile.size();
+    if (fileBytes == 0) {
+        char header[96];
+        int n = snprintf(header, sizeof(header),
+                         "=== PORKCHOP LOG ===\nStarted at millis: %lu\n====================\n",
+                         millis());
+        fileBytes += (uint32_t)logFile.write((const uint8_t*)header, (size_t)n);
+    }
+    return true;
+}
+
+// Keep one previous file; the live log always starts empty after this
+static void rotateLog() {
+    if (logFile) logFile.close();
+    if (SD.exists(rotatedPath)) SD.remove(rotatedPath);
+    SD.rename(logPath, rotatedPath);
+    rotations++;
+    openLogFile();
+}
+
+// Write one batch, ending on a sector boundary of the file when possible
+static bool writeBatch(bool partialOk) {
+    uint32_t want = SECTOR_BYTES - (fileBytes % SECTOR_BYTES);
+    uint32_t avail = ring.used();
+    if (avail < want) {
+        if (!partialOk || avail == 0) return false;
+        want = avail;
+    }
+    uint32_t n = ring.copyOut(sectorBuf, want);
+    if (logFile) {
+        size_t w = logFile.write(sectorBuf, n);
+        if (w != n) writeErrors++;
+        fileBytes += (uint32_t)w;
+        bytesWritten += (uint32_t)w;
+        batches++;
+    } else {
+        writeErrors++;
+    }
+    ring.consume(n);   // Consumed even on error: a dead card must not wedge producers
+
+    if (fileBytes >= ROTATE_BYTES) {
+        rotateLog();
+    }
+    return true;
+}
+
+static void drain(bool all) {
+    while (writeBatch(all)) {}
+}
+
+static void writerTask(void* param) {
+    (void)param;
+    uint32_t pendingSince = 0;   // When the oldest unwritten partial sector was first seen
+    uint32_t lastSyncMs = millis();
+    bool unsynced = false;
+
+    while (!stopRequested.load(std::memory_order_acquire)) {
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(WRITER_POLL_MS));
+        uint32_t now = millis();
+
+        uint32_t request = flushRequested.load(std::memory_order_acquire);
+        bool flushWanted = request != flushCompleted.load(std::memory_order_relaxed);
+        if (ring.used() > 0 && pendingSince == 0) pendingSince = now | 1;
+        bool stale = pendingSince != 0 && now - pendingSince >= IDLE_FLUSH_MS;
+
+        uint32_t before = batches;
+        drain(flushWanted || stale);
+        if (batches != before) {
+            unsynced = true;
+        }
+        if (ring.used() == 0 || flushWanted || stale) {
+            pendingSince = ring.used() > 0 ? (now | 1) : 0;
+        }
+
+        if (unsynced && (flushWanted || now - lastSyncMs >= SYNC_INTERVAL_MS)) {
+            if (logFile) logFile.flush();
+            lastSyncMs = now;
+            unsynced = false;
+        }
+        if (flushWanted) {
+            flushCompleted.store(request, std::memory_order_release);
+        }
+    }
+
+    drain(true);
+    if (logFile) logFile.close();
+    writerExited.store(true, std::memory_order_release);
+    vTaskDelete(NULL);
+}
+
+static void freeRing() {
+    taskENTER_CRITICAL(&producerMux);
+    ring.attach(nullptr, 0);
+    taskEXIT_CRITICAL(&producerMux);
+    if (ringStorage) {
+        heap_caps_free(ringStorage);
+        ringStorage = nullptr;
+    }
+}
+
+// ============================================================================
+// Public API
+// ============================================================================
 
 void SDLog::init() {
     initialized = true;
     // Logging starts disabled, user enables via settings
 }
 
+bool SDLog::startWriter() {
+    if (writerHandle != NULL) return true;
+
+    const char* logsDir = SDLayout::logsDir();
+    if (!SD.exists(logsDir)) {
+        SD.mkdir(logsDir);
+    }
+
+    // Use fixed filename - easier to find and read
+    snprintf(logPath, sizeof(logPath), "%s/porkchop.log", logsDir);
+    snprintf(rotatedPath, sizeof(rotatedPath), "%s/porkchop.1.log", logsDir);
+
+    uint32_t ringBytes = 0;
+    if (psramFound()) {
+        ringStorage = (uint8_t*)heap_caps_malloc(RING_BYTES_PSRAM, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+        if (ringStorage) ringBytes = RING_BYTES_PSRAM;
+    }
+    if (!ringStorage) {
+        ringBytes = (ESP.getFreeHeap() >= RING_BYTES_INTERNAL + HeapPolicy::kMinHeapForSdLog)
+                    ? RING_BYTES_INTERNAL : RING_BYTES_LOW_HEAP;
+        ringStorage = (uint8_t*)heap_caps_malloc(ringBytes, MALLOC_CAP_8BIT);
+    }
+    if (!ringStorage) {
+        Serial.println("[SDLOG] Ring allocation failed");
+        return false;
+    }
+
+    // Previous session's log becomes porkchop.1.log
+    if (SD.exists(logPath)) {
+        if (SD.exists(rotatedPath)) SD.remove(rotatedPath);
+        SD.rename(logPath, rotatedPath);
+    }
+    bytesWritten = 0;
+    batches = 0;
+    rotations = 0;
+    writeErrors = 0;
+    if (!openLogFile()) {
+        freeRing();
+        return false;
+    }
+
+    taskENTER_CRITICAL(&producerMux);
+    ring.attach(ringStorage, ringBytes);
+    taskEXIT_CRITICAL(&producerMux);
+
+    stopRequested.store(false, std::memory_order_release);
+    writerExited.store(false, std::memory_order_release);
+    flushCompleted.store(flushRequested.load());
+    xTaskCreatePinnedToCore(
+        writerTask,         // Function
+        "sdLog",            // Name
+        4096,               // Stack size
+        NULL,               // Parameters
+        1,                  // Priority (low)
+        &writerHandle,      // Task handle
+        0                   // Run on core 0 (main loop is on core 1)
+    );
+    if (writerHandle == NULL) {
+        Serial.println("[SDLOG] Writer task creation failed");
+        writerExited.store(true, std::memory_order_release);
+        logFile.close();
+        freeRing();
+        return false;
+    }
+    Serial.printf("[SDLOG] Log file: %s (ring %u bytes)\n", logPath, (unsigned)ringBytes);
+    return true;
+}
+
+void SDLog::stopWriter() {
+    if (writerHandle == NULL) return;
+
+    stopRequested.store(true, std::memory_order_release);
+    xTaskNotifyGive(writerHandle);
+    uint32_t waitStart = millis();
+    while (!writerExited.load(std::memory_order_acquire) &&
+           millis() - waitStart < WRITER_STOP_TIMEOUT_MS) {
+        vTaskDelay(pdMS_TO_TICKS(10));
+    }
+    if (!writerExited.load(std::memory_order_acquire)) {
+        Serial.println("[SDLOG] Writer did not exit - forcing");
+        vTaskDelete(writerHandle);
+        if (logFile) logFile.close();
+    }
+    writerHandle = NULL;
+
+    getStats(lastStats);
+    freeRing();
+}
+
 void SDLog::setEnabled(bool enabled) {
-    Serial.printf("[SDLOG] setEnabled(%s), SD available: %s\n", 
-                  enabled ? "true" : "false", 
+    Serial.printf("[SDLOG] setEnabled(%s), SD available: %s\n",
+                  enabled ? "true" : "false",
                   Config::isSDAvailable() ? "true" : "false");
-    
+
     logEnabled = enabled && Config::isSDAvailable();
-    
-    if (logEnabled && currentLogFile.length() == 0) {
-        ensureLogFile();
+
+    if (logEnabled && !startWriter()) {
+        logEnabled = false;
     }
-    
+
     if (logEnabled) {
-        Serial.printf("[SDLOG] Logging now ENABLED to: %s\n", currentLogFile.c_str());
+        Serial.printf("[SDLOG] Logging now ENABLED to: %s\n", logPath);
         log("SDLOG", "SD logging enabled");
     } else {
+        stopWriter();
         Serial.printf("[SDLOG] Logging DISABLED\n");
     }
 }
 
-void SDLog::ensureLogFile() {
-    if (currentLogFile.length() > 0) return;
-    if (!Config::isSDAvailable()) return;
-    
-    // Create logs directory if needed
-    const char* logsDir = SDLayout::logsDir();
-    if (!SD.exists(logsDir)) {
-        SD.mkdir(logsDir);
+void SDLog::enqueue(const char* line, size_t len) {
+    bool ok = false;
+    uint32_t used = 0;
+    taskENTER_CRITICAL(&producerMux);
+    if (ring.attached()) {
+        ok = ring.append(line, (uint32_t)len);
+        used = ring.used();
     }
-    
-    // Use fixed filename - easier to find and read
-    currentLogFile = String(logsDir) + "/porkchop.log";
-    
-    // Create file with header
-    File f = SD.open(currentLogFile.c_str(), FILE_WRITE);
-    if (f) {
-        f.println("=== PORKCHOP LOG ===");
-        f.printf("Started at millis: %lu\n", millis());
-        f.println("====================");
-        f.close();
-        Serial.printf("[SDLOG] Log file: %s\n", currentLogFile.c_str());
-    } else {
-        Serial.printf("[SDLOG] Failed to create: %s\n", currentLogFile.c_str());
-        currentLogFile = "";
+    taskEXIT_CRITICAL(&producerMux);
+
+    // Wake the writer once a full sector is waiting
+    TaskHandle_t writer = writerHandle;
+    if (ok && used >= SECTOR_BYTES && writer != NULL) {
+        xTaskNotifyGive(writer);
     }
 }
 
@@ -66,71 +313,69 @@ void SDLog::log(const char* tag, const char* format, ...) {
     if (!logEnabled) {
         return;
     }
-    if (currentLogFile.length() == 0) {
-        // Try to create log file if it doesn't exist
-        ensureLogFile();
-        if (currentLogFile.length() == 0) {
-            Serial.printf("[SDLOG] ERROR: Could not create log file\n");
-            return;
-        }
-    }
-    
+
     // Format the message first (before SD operations)
     char buffer[256];
     va_list args;
     va_start(args, format);
     vsnprintf(buffer, sizeof(buffer), format, args);
     va_end(args);
-    
-    // Debug: show what we're logging
-    Serial.printf("[SDLOG->SD] [%s] %s\n", tag, buffer);
-    
-    // Try to open file with retry on failure (SD can be busy with other operations)
-    File f;
-    for (int retry = 0; retry < 3; retry++) {
-        f = SD.open(currentLogFile.c_str(), FILE_APPEND);
-        if (f) break;
-        delay(5);  // Brief delay before retry
-    }
-    
-    if (!f) {
-        Serial.printf("[SDLOG] Failed to open log file for append\n");
-        return;
+
+    char line[320];
+    int n = snprintf(line, sizeof(line), "[%lu][%s] %s\n", millis(), tag, buffer);
+    if (n <= 0) return;
+    if ((size_t)n >= sizeof(line)) {
+        n = sizeof(line) - 1;
+        line[n - 1] = '\n';
     }
-    
-    // Write timestamp, tag, and message
-    f.printf("[%lu][%s] %s\n", millis(), tag, buffer);
-    f.close();
+    enqueue(line, (size_t)n);
 }
 
 void SDLog::logRaw(const char* message) {
-    if (!logEnabled) return;
-    if (currentLogFile.length() == 0) {
-        ensureLogFile();
-        if (currentLogFile.length() == 0) return;
-    }
-    
-    // Try to open file with retry on failure
-    File f;
-    for (int retry = 0; retry < 3; retry++) {
-        f = SD.open(currentLogFile.c_str(), FILE_APPEND);
-        if (f) break;
-        delay(5);
-    }
-    
-    if (f) {
-        f.println(message);
-        f.close();
+    if (!logEnabled || !message) return;
+
+    char line[320];
+    int n = snprintf(line, sizeof(line), "%s\n", message);
+    if (n <= 0) return;
+    if ((size_t)n >= sizeof(line)) {
+        n = sizeof(line) - 1;
+        line[n - 1] = '\n';
     }
+    enqueue(line, (size_t)n);
 }
 
 void SDLog::flush() {
-    // Files are closed after each write, so nothing to flush
+    TaskHandle_t writer = writerHandle;
+    if (writer == NULL) return;
+
+    uint32_t request = flushRequested.fetch_add(1, std::memory_order_acq_rel) + 1;
+    xTaskNotifyGive(writer);
+    uint32_t waitStart = millis();
+    while ((int32_t)(flushCompleted.load(std::memory_order_acquire) - request) < 0 &&
+           millis() - waitStart < FLUSH_WAIT_MS) {
+        vTaskDelay(pdMS_TO_TICKS(5));
+    }
 }
 
 void SDLog::close() {
-    if (logEnabled && currentLogFile.length() > 0) {
+    if (logEnabled) {
         log("SDLOG", "Log closed");
     }
-    currentLogFile = "";
+    logEnabled = false;
+    stopWriter();  // Drains the ring and closes the handle
+}
+
+void SDLog::getStats(Stats& out) {
+    if (writerHandle == NULL) {
+        out = lastStats;
+        return;
+    }
+    out.lines = ring.pushed();
+    out.dropped = ring.dropped();
+    out.bytesWritten = bytesWritten;
+    out.batches = batches;
+    out.rotations = rotations;
+    out.writeErrors = writeErrors;
+    out.ringSize = ring.capacity();
+    out.ringHighWater = ring.highWater();
 }
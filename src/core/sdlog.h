@@ -1,30 +1,47 @@
 // SD Card Logger
+// log() formats into a RAM ring and returns; a low-priority writer task
+// drains it to one open file in sector-sized batches and rotates by size.
 #pragma once
 
 #include <Arduino.h>
 
 class SDLog {
 public:
+    struct Stats {
+        uint32_t lines;         // Lines accepted into the ring
+        uint32_t dropped;       // Lines lost to a full ring
+        uint32_t bytesWritten;  // Bytes written to SD (all files)
+        uint32_t batches;       // SD write calls
+        uint32_t rotations;     // Size-triggered file rotations
+        uint32_t writeErrors;   // Short writes / failed opens
+        uint32_t ringSize;
+        uint32_t ringHighWater;
+    };
+
     static void init();
     static void setEnabled(bool enabled);
     static bool isEnabled() { return logEnabled; }
-    
+
     // Log functions - mirror Serial.printf behavior
     static void log(const char* tag, const char* format, ...);
     static void logRaw(const char* message);
-    
-    // Flush to ensure data is written
+
+    // Block (bounded) until everything logged so far is written and synced
     static void flush();
-    
-    // Close current log file (call on shutdown)
+
+    // Flush, stop the writer and close the file (call on shutdown / before SD format)
     static void close();
-    
+
+    // Counters survive close() for the diagnostics snapshot
+    static void getStats(Stats& out);
+
 private:
     static bool logEnabled;
     static bool initialized;
-    static String currentLogFile;
-    
-    static void ensureLogFile();
+
+    static bool startWriter();
+    static void stopWriter();
+    static void enqueue(const char* line, size_t len);
 };
 
 // Convenience macro - logs to both Serial and SD if enabled
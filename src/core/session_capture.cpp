@@ -0,0 +1,376 @@
+// SessionCapture - Continuous PCAPNG capture implementation
+
+#include "session_capture.h"
+#include "config.h"
+#include "sd_layout.h"
+#include "heap_policy.h"
+#include "frame_ring.h"
+#include "pcapng.h"
+#include <SD.h>
+#include <esp_heap_caps.h>
+#include <esp_timer.h>
+#include <sys/time.h>
+#include <time.h>
+#include <atomic>
+
+namespace SessionCapture {
+
+// ============================================================================
+// Tuning
+// ============================================================================
+
+// Ring: ~100ms of busy-channel mgmt traffic without PSRAM, far more with it
+static const uint32_t RING_BYTES_INTERNAL = 24 * 1024;
+static const uint32_t RING_BYTES_PSRAM = 128 * 1024;
+
+// SD writes go out in whole 4KB chunks (FAT cluster/sector aligned)
+static const uint32_t BATCH_BYTES = 4096;
+
+// Longest frame kept per record; origLen still reports the on-air size
+static const uint16_t SNAP_LEN = 2500;
+static const uint32_t BATCH_SLACK = 32 + ((16 + SNAP_LEN + 3) & ~3u);
+
+// New file every 8MB so a pulled card or crash costs at most one file
+static const uint32_t ROTATE_BYTES = 8UL * 1024UL * 1024UL;
+
+static const uint32_t WRITER_IDLE_MS = 50;
+static const uint32_t WRITER_MAX_FRAMES_PER_PASS = 256;
+static const uint32_t WRITER_STOP_TIMEOUT_MS = 3000;
+
+// ============================================================================
+// State
+// ============================================================================
+
+static bool active = false;
+static CaptureMode activeMode = CaptureMode::OFF;
+
+static uint8_t* ringStorage = nullptr;
+static uint8_t* batch = nullptr;
+static uint32_t batchFill = 0;
+static FrameRing ring;
+
+// Producer handshake with stop(): callback raises inCallback before reading
+// capturing, stop() clears capturing before waiting on inCallback.
+static std::atomic<bool> capturing{false};
+static std::atomic<bool> inCallback{false};
+
+static TaskHandle_t writerHandle = NULL;
+static std::atomic<bool> stopRequested{false};
+static std::atomic<bool> writerExited{true};
+
+static File captureFile;
+static char filePath[96] = "";
+static char sessionTag[24] = "";
+static uint16_t fileIndex = 0;
+static uint32_t fileBytes = 0;
+static uint64_t epochOffsetUs = 0;  // 0 = clock not set, timestamps since boot
+
+static uint32_t writtenFrames = 0;
+static uint32_t totalBytes = 0;
+static uint32_t filesOpened = 0;
+static uint32_t writeErrors = 0;
+static Stats lastStats = {};  // Final counters of the previous session
+
+// ============================================================================
+// Filter (WiFi task)
+// ============================================================================
+
+static bool wanted(wifi_promiscuous_pkt_type_t type, const uint8_t* frame, uint16_t len) {
+    switch (activeMode) {
+        case CaptureMode::MGMT:
+            return type == WIFI_PKT_MGMT;
+        case CaptureMode::EAPOL:
+            if (type == WIFI_PKT_MGMT) {
+                // Probe resp / assoc / reassoc carry the ESSID crackers need;
+                // beacons are skipped to keep the file small.
+                uint8_t subtype = (frame[0] >> 4) & 0x0F;
+                return subtype == 0x00 || subtype == 0x02 || subtype == 0x05;
+            }
+            return type == WIFI_PKT_DATA && Pcapng::isEapolFrame(frame, len);
+        case CaptureMode::ALL:
+            return type != WIFI_PKT_MISC;
+        default:
+            return false;
+    }
+}
+
+// ============================================================================
+// Writer (low-priority task)
+// ============================================================================
+
+static void refreshEpochOffset() {
+    struct timeval tv;
+    gettimeofday(&tv, nullptr);
+    if (tv.tv_sec > 1700000000) {  // Valid time (after 2023)
+        uint64_t nowUs = (uint64_t)tv.tv_sec * 1000000ULL + (uint64_t)tv.tv_usec;
+        epochOffsetUs = nowUs - (uint64_t)esp_timer_get_time();
+    } else {
+        epochOffsetUs = 0;
+    }
+}
+
+static void writeOut(const uint8_t* data, uint32_t len) {
+    if (!captureFile) {
+        writeErrors++;
+        return;
+    }
+    size_t n = captureFile.write(data, len);
+    if (n != len) writeErrors++;
+    fileBytes += (uint32_t)n;
+    totalBytes += (uint32_t)n;
+}
+
+// Write whole chunks only; remainder stays buffered for the next batch.
+static void writeFullChunks() {
+    while (batchFill >= BATCH_BYTES) {
+        writeOut(batch, BATCH_BYTES);
+        batchFill -= BATCH_BYTES;
+        if (batchFill > 0) memmove(batch, batch + BATCH_BYTES, batchFill);
+    }
+}
+
+static void flushPartial() {
+    if (batchFill > 0) {
+        writeOut(batch, batchFill);
+        batchFill = 0;
+    }
+    if (captureFile) captureFile.flush();
+}
+
+static void closeFile() {
+    flushPartial();
+    if (captureFile) captureFile.close();
+}
+
+static bool openNextFile() {
+    const char* dir = SDLayout::capturesDir();
+    if (!SD.exists(dir)) SD.mkdir(dir);
+
+    fileIndex++;
+    snprintf(filePath, sizeof(filePath), "%s/session_%s_%03u.pcapng",
+             dir, sessionTag, (unsigned)fileIndex);
+
+    captureFile = SD.open(filePath, FILE_WRITE);
+    fileBytes = 0;
+    if (!captureFile) {
+        Serial.printf("[SESSCAP] Failed to open %s\n", filePath);
+        writeErrors++;
+        return false;
+    }
+    filesOpened++;
+    refreshEpochOffset();
+
+    // SHB + IDB go through the batch so every later write stays chunk aligned
+    batchFill += Pcapng::writeSHB(batch + batchFill, BATCH_BYTES + BATCH_SLACK - batchFill);
+    batchFill += Pcapng::writeIDB(batch + batchFill, BATCH_BYTES + BATCH_SLACK - batchFill);
+    Serial.printf("[SESSCAP] Writing %s\n", filePath);
+    return true;
+}
+
+static uint32_t drainRing() {
+    FrameRecordHeader hdr;
+    const uint8_t* frame = nullptr;
+    uint32_t drained = 0;
+
+    while (drained < WRITER_MAX_FRAMES_PER_PASS && ring.peek(hdr, frame)) {
+        uint64_t ts = hdr.timestampUs() + epochOffsetUs;
+        batchFill += Pcapng::writeEPB(batch + batchFill, BATCH_BYTES + BATCH_SLACK - batchFill,
+                                      ts, hdr.rssi, hdr.channel, frame, hdr.len, hdr.origLen);
+        ring.pop(hdr);
+        drained++;
+        writtenFrames++;
+        writeFullChunks();
+
+        if (fileBytes >= ROTATE_BYTES) {
+            closeFile();
+            openNextFile();
+        }
+    }
+    return drained;
+}
+
+static void writerTask(void* param) {
+    (void)param;
+    while (!stopRequested.load(std::memory_order_acquire)) {
+        if (drainRing() == 0) {
+            vTaskDelay(pdMS_TO_TICKS(WRITER_IDLE_MS));
+        } else {
+            vTaskDelay(1);  // Give the main loop a turn at the SD bus between bursts
+        }
+    }
+    while (drainRing() > 0) {}
+    closeFile();
+    writerExited.store(true, std::memory_order_release);
+    vTaskDelete(NULL);
+}
+
+static void freeBuffers() {
+    ring.attach(nullptr, 0);
+    if (ringStorage) {
+        heap_caps_free(ringStorage);
+        ringStorage = nullptr;
+    }
+    if (batch) {
+        heap_caps_free(batch);
+        batch = nullptr;
+    }
+    batchFill = 0;
+}
+
+static void makeSessionTag() {
+    time_t now = time(nullptr);
+    if (now > 1700000000) {
+        struct tm* t = localtime(&now);
+        snprintf(sessionTag, sizeof(sessionTag), "%04d%02d%02d_%02d%02d%02d",
+                 t->tm_year + 1900, t->tm_mon + 1, t->tm_mday,
+                 t->tm_hour, t->tm_min, t->tm_sec);
+    } else {
+        snprintf(sessionTag, sizeof(sessionTag), "boot%08lu", (unsigned long)millis());
+    }
+}
+
+// ============================================================================
+// Public API
+// ============================================================================
+
+bool start() {
+    if (active) return true;
+
+    CaptureMode mode = Config::wifi().captureMode;
+    if (mode == CaptureMode::OFF) return false;
+    if (!Config::isSDAvailable()) {
+        Serial.println("[SESSCAP] No SD card - capture disabled");
+        return false;
+    }
+
+    uint32_t ringBytes = RING_BYTES_INTERNAL;
+    if (psramFound()) {
+        ringStorage = (uint8_t*)heap_caps_malloc(RING_BYTES_PSRAM, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+        if (ringStorage) ringBytes = RING_BYTES_PSRAM;
+    }
+    if (!ringStorage) {
+        if (ESP.getFreeHeap() < RING_BYTES_INTERNAL + BATCH_BYTES + HeapPolicy::kMinHeapForSessionCapture) {
+            Serial.printf("[SESSCAP] Not enough heap for capture ring (free=%u)\n", ESP.getFreeHeap());
+            return false;
+        }
+        ringStorage = (uint8_t*)heap_caps_malloc(RING_BYTES_INTERNAL, MALLOC_CAP_8BIT);
+    }
+    batch = (uint8_t*)heap_caps_malloc(BATCH_BYTES + BATCH_SLACK, MALLOC_CAP_8BIT);
+    if (!ringStorage || !batch) {
+        Serial.println("[SESSCAP] Buffer allocation failed");
+        freeBuffers();
+        return false;
+    }
+    ring.attach(ringStorage, ringBytes);
+    batchFill = 0;
+
+    activeMode = mode;
+    writtenFrames = 0;
+    totalBytes = 0;
+    filesOpened = 0;
+    writeErrors = 0;
+    fileIndex = 0;
+    makeSessionTag();
+    if (!openNextFile()) {
+        freeBuffers();
+        return false;
+    }
+
+    stopRequested.store(false, std::memory_order_release);
+    writerExited.store(false, std::memory_order_release);
+    xTaskCreatePinnedToCore(
+        writerTask,         // Function
+        "sessCap",          // Name
+        4096,               // Stack size
+        NULL,               // Parameters
+        1,                  // Priority (low)
+        &writerHandle,      // Task handle
+        0                   // Run on core 0 (WiFi core)
+    );
+    if (writerHandle == NULL) {
+        Serial.println("[SESSCAP] Writer task creation failed");
+        writerExited.store(true, std::memory_order_release);
+        captureFile.close();
+        freeBuffers();
+        return false;
+    }
+
+    active = true;
+    capturing.store(true);
+    Serial.printf("[SESSCAP] Started: filter=%u ring=%u bytes\n",
+                  (unsigned)activeMode, (unsigned)ringBytes);
+    return true;
+}
+
+void stop() {
+    if (!active) return;
+
+    // No new frames, and wait out any callback already inside onFrame()
+    capturing.store(false);
+    while (inCallback.load()) {
+        vTaskDelay(1);
+    }
+
+    stopRequested.store(true, std::memory_order_release);
+    uint32_t waitStart = millis();
+    while (!writerExited.load(std::memory_order_acquire) &&
+           millis() - waitStart < WRITER_STOP_TIMEOUT_MS) {
+        vTaskDelay(pdMS_TO_TICKS(10));
+    }
+    if (!writerExited.load(std::memory_order_acquire)) {
+        Serial.println("[SESSCAP] Writer did not exit - forcing");
+        vTaskDelete(writerHandle);
+        closeFile();
+    }
+    writerHandle = NULL;
+
+    Serial.printf("[SESSCAP] Stopped: frames=%u dropped=%u bytes=%u files=%u errors=%u hiwater=%u/%u\n",
+                  (unsigned)writtenFrames, (unsigned)ring.dropped(), (unsigned)totalBytes,
+                  (unsigned)filesOpened, (unsigned)writeErrors,
+                  (unsigned)ring.highWater(), (unsigned)ring.capacity());
+
+    // Stats survive stop() for the diagnostics snapshot; buffers don't
+    getStats(lastStats);
+    freeBuffers();
+    filePath[0] = '\0';
+    active = false;
+}
+
+bool isActive() {
+    return active;
+}
+
+void onFrame(const wifi_promiscuous_pkt_t* pkt, wifi_promiscuous_pkt_type_t type, uint16_t len) {
+    inCallback.store(true);
+    if (!capturing.load()) {
+        inCallback.store(false);
+        return;
+    }
+    if (len >= 24 && wanted(type, pkt->payload, len)) {
+        uint16_t keep = len > SNAP_LEN ? SNAP_LEN : len;
+        ring.push((uint64_t)esp_timer_get_time(), pkt->rx_ctrl.rssi, pkt->rx_ctrl.channel,
+                  pkt->payload, keep, len);
+    }
+    inCallback.store(false);
+}
+
+void getStats(Stats& out) {
+    if (!active) {
+        out = lastStats;
+        return;
+    }
+    out.captured = ring.pushed();
+    out.dropped = ring.dropped();
+    out.written = writtenFrames;
+    out.bytesWritten = totalBytes;
+    out.files = filesOpened;
+    out.writeErrors = writeErrors;
+    out.ringSize = ring.capacity();
+    out.ringHighWater = ring.highWater();
+}
+
+const char* currentFile() {
+    return filePath;
+}
+
+}  // namespace SessionCapture
@@ -0,0 +1,51 @@
+// SessionCapture - Continuous PCAPNG capture of the NetworkRecon session
+// Promiscuous callback copies frames into a preallocated byte ring; a
+// low-priority writer task drains it to rotating PCAPNG files on SD.
+// No SD I/O or allocation ever happens in the WiFi task.
+#pragma once
+
+#include <Arduino.h>
+#include <esp_wifi.h>
+
+namespace SessionCapture {
+
+struct Stats {
+    uint32_t captured;      // Frames accepted into the ring
+    uint32_t dropped;       // Frames lost to a full ring
+    uint32_t written;       // Frames written to SD
+    uint32_t bytesWritten;  // PCAPNG bytes written (all files)
+    uint32_t files;         // Files opened this session
+    uint32_t writeErrors;   // Short writes / failed opens
+    uint32_t ringSize;
+    uint32_t ringHighWater;
+};
+
+/**
+ * @brief Start capturing if Config::wifi().captureMode != OFF
+ * Allocates the ring, opens the first file and spawns the writer task.
+ * Called by NetworkRecon::start(); safe to call when already active.
+ * @return true if capture is active
+ */
+bool start();
+
+/**
+ * @brief Stop capturing: flush the ring, close the file, free buffers
+ * Call after the promiscuous callback has been detached.
+ */
+void stop();
+
+bool isActive();
+
+/**
+ * @brief Offer a frame from the promiscuous callback (WiFi task)
+ * Applies the configured filter and copies into the ring. Never blocks.
+ * @param len 802.11 frame length without the trailing FCS
+ */
+void onFrame(const wifi_promiscuous_pkt_t* pkt, wifi_promiscuous_pkt_type_t type, uint16_t len);
+
+void getStats(Stats& out);
+
+// Path of the file currently being written ("" when inactive)
+const char* currentFile();
+
+}  // namespace SessionCapture
@@ -0,0 +1,208 @@
+// SpectrumLobe - Precomputed integer lobe shapes and waterfall dithering
+// The sinc carrier shape only depends on the view's MHz-per-pixel, so it is
+// sampled once per zoom level into a Q8 template (4 sub-pixel phases) that
+// both the spectrum buffer fill and the lobe drawing index by column. The
+// waterfall stores a dither level per pixel and is written a row at a time
+// from per-row bit masks instead of per-pixel threshold/modulo tests.
+// Header-only, no Arduino dependencies (unit tested on native).
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace SpectrumLobe {
+
+static const int kSubPx = 4;            // Sub-pixel center phases
+static const int kMaxHalf = 96;         // Columns each side of center (>= 22 MHz at 60 MHz/218 px)
+static const int kSpan = 2 * kMaxHalf + 1;
+static const uint8_t kOne = 255;        // Q8 amplitude of 1.0
+static const uint8_t kSkipQ = 13;       // < 0.05: too small to lift the noise floor
+static const float kHalfWidthMHz = 22.0f;
+
+// |sinc| carrier shape, -22..+22 MHz in 1 MHz steps: main lobe, first nulls
+// at +-11 MHz and two side lobes each side
+static const float kSinc[45] = {
+    0.0000f, 0.0650f, 0.1100f, 0.1300f, 0.1100f,     // -22 to -18
+    0.0650f, 0.0000f, 0.0900f, 0.1500f, 0.1800f,     // -17 to -13
+    0.1500f, 0.0000f, 0.1700f, 0.2700f, 0.3300f,     // -12 to -8
+    0.3700f, 0.5000f, 0.6500f, 0.8000f, 0.9100f,     // -7 to -3
+    0.9700f, 0.9950f, 1.0000f,                       // -2 to 0
+    0.9950f, 0.9700f, 0.9100f, 0.8000f, 0.6500f,     // 1 to 5
+    0.5000f, 0.3700f, 0.3300f, 0.2700f, 0.1700f,     // 6 to 10
+    0.0000f, 0.1500f, 0.1800f, 0.1500f, 0.0900f,     // 11 to 15
+    0.0000f, 0.0650f, 0.1100f, 0.1300f, 0.1100f,     // 16 to 20
+    0.0650f, 0.0000f                                 // 21 to 22
+};
+
+// Linear interpolation in kSinc (template build only)
+inline float sincAmplitude(float distMHz) {
+    float pos = distMHz + kHalfWidthMHz;
+    if (pos < 0.0f || pos > 44.0f) return 0.0f;
+    int idx = (int)pos;
+    if (idx >= 44) return kSinc[44];
+    float frac = pos - idx;
+    return kSinc[idx] + frac * (kSinc[idx + 1] - kSinc[idx]);
+}
+
+// Where a lobe lands: amp[col - first] for col in [first, first + kSpan)
+struct Placement {
+    const uint8_t* amp;
+    int first;
+
+    uint8_t at(int col) const {
+        int i = col - first;
+        return (i >= 0 && i < kSpan) ? amp[i] : 0;
+    }
+};
+
+/**
+ * Lobe shape for one zoom level. Rebuilt only when the view width or
+ * column count changes; sampling costs ~800 float LUT reads.
+ */
+class Template {
+public:
+    Template() : widthMHz(0.0f), cols(0), pxPerMHz(0.0f) {
+        memset(amp, 0, sizeof(amp));
+    }
+
+    bool matches(float viewWidthMHz, int columns) const {
+        return cols == columns && widthMHz == viewWidthMHz;
+    }
+
+    void build(float viewWidthMHz, int columns) {
+        widthMHz = viewWidthMHz;
+        cols = columns;
+        pxPerMHz = (viewWidthMHz > 0.0f) ? (float)columns / viewWidthMHz : 0.0f;
+        float mhzPerPx = (pxPerMHz > 0.0f) ? 1.0f / pxPerMHz : 0.0f;
+        for (int p = 0; p < kSubPx; p++) {
+            for (int i = 0; i < kSpan; i++) {
+                float px = (float)(i - kMaxHalf) - (float)p / kSubPx;
+                float a = sincAmplitude(px * mhzPerPx);
+                amp[p][i] = (uint8_t)(a * kOne + 0.5f);
+            }
+        }
+    }
+
+    // Lobe center in view columns (Q2: quarter pixels), leftMHz = column 0
+    int32_t centerQ(float centerMHz, float leftMHz) const {
+        return (int32_t)floorf((centerMHz - leftMHz) * pxPerMHz * kSubPx + 0.5f);
+    }
+
+    Placement place(int32_t cq) const {
+        int32_t phase = cq & (kSubPx - 1);
+        int32_t col = (cq - phase) / kSubPx;
+        Placement out = {amp[phase], (int)col - kMaxHalf};
+        return out;
+    }
+
+private:
+    float widthMHz;
+    int cols;
+    float pxPerMHz;
+    uint8_t amp[kSubPx][kSpan];
+};
+
+// Height of a lobe sample for a peak of `height` (0..height)
+inline int scale(int height, uint8_t q) {
+    return height * q / kOne;
+}
+
+/**
+ * Max-accumulate one lobe into an int8 dB row:
+ * cols[x] = max(cols[x], floorDb + (rssi - floorDb) * amp(x)).
+ * Branchless over a contiguous column range (vectorizes on targets with
+ * SIMD; a tight loop without per-column float work on Xtensa).
+ */
+inline void accumulate(const Placement& pl, int8_t floorDb, int8_t rssi, int8_t* cols, int n) {
+    int delta = rssi - floorDb;
+    if (delta <= 0) return;
+    int lo = pl.first < 0 ? 0 : pl.first;
+    int hi = pl.first + kSpan;
+    if (hi > n) hi = n;
+    const uint8_t* a = pl.amp + (lo - pl.first);
+    int8_t* out = cols + lo;
+    for (int i = 0; i < hi - lo; i++) {
+        int q = a[i];
+        int v = (q >= kSkipQ) ? floorDb + delta * q / kOne : -128;
+        out[i] = (int8_t)(v > out[i] ? v : out[i]);
+    }
+}
+
+// Integer sine: phase 0..255 is one period, result -127..127
+inline int sin8(uint8_t phase) {
+    static const uint8_t kQuarter[65] = {
+          0,   3,   6,   9,  12,  16,  19,  22,  25,  28,  31,  34,  37,  40,  43,  46,
+         49,  51,  54,  57,  60,  63,  65,  68,  71,  73,  76,  78,  81,  83,  85,  88,
+         90,  92,  94,  96,  98, 100, 102, 104, 106, 107, 109, 111, 112, 113, 115, 116,
+        117, 118, 120, 121, 122, 122, 123, 124, 125, 125, 126, 126, 126, 127, 127, 127,
+        127
+    };
+    uint8_t i = phase & 63;
+    switch (phase >> 6) {
+        case 0:  return kQuarter[i];
+        case 1:  return kQuarter[64 - i];
+        case 2:  return -kQuarter[i];
+        default: return -kQuarter[64 - i];
+    }
+}
+
+// ============================================================================
+// Waterfall dithering
+// ============================================================================
+
+static const uint8_t kLevels = 6;       // 0 = dark .. 5 = solid
+
+// Intensity 0-255 to dither level (thresholds of the old per-pixel test)
+inline uint8_t ditherLevel(uint8_t intensity) {
+    if (intensity > 200) return 5;
+    if (intensity > 150) return 4;
+    if (intensity > 100) return 3;
+    if (intensity > 50) return 2;
+    if (intensity > 20) return 1;
+    return 0;
+}
+
+/**
+ * Lit-pixel masks for one screen row: bit (x % 12) of masks[level].
+ * Every pattern repeats within 12 columns (lcm of the 2/3/4 grids).
+ */
+inline void rowMasks(int row, uint16_t masks[kLevels]) {
+    for (uint8_t lvl = 0; lvl < kLevels; lvl++) {
+        uint16_t m = 0;
+        for (int x = 0; x < 12; x++) {
+            bool on;
+            switch (lvl) {
+                case 5:  on = true; break;                               // Solid
+                case 4:  on = ((x + row) % 2) == 0; break;               // 50% checkerboard
+                case 3:  on = (x % 2) == 0 && (row % 2) == 0; break;     // 25% grid
+                case 2:  on = (x % 3) == 0 && (row % 2) == 0; break;     // ~16% sparse
+                case 1:  on = (x % 4) == 0 && (row % 3) == 0; break;     // ~8% very sparse
+                default: on = false; break;
+            }
+            if (on) m |= (uint16_t)(1u << x);
+        }
+        masks[lvl] = m;
+    }
+}
+
+/**
+ * One waterfall row into an 8-bit pixel row: lit pixels get ink, the
+ * rest keep what is already there.
+ */
+inline void blitRow(uint8_t* dst, const uint8_t* levels, int n, int row, uint8_t ink) {
+    uint16_t masks[kLevels];
+    rowMasks(row, masks);
+    // 12-column blocks: the bit index is the offset in the block (no modulo)
+    for (int x = 0; x < n; x += 12) {
+        int end = (x + 12 < n) ? 12 : n - x;
+        const uint8_t* lv = levels + x;
+        uint8_t* out = dst + x;
+        for (int b = 0; b < end; b++) {
+            if ((masks[lv[b]] >> b) & 1) out[b] = ink;
+        }
+    }
+}
+
+}  // namespace SpectrumLobe
@@ -0,0 +1,257 @@
+// SpriteCache - Pre-rendered 1-bpp sprites with a fixed slot budget
+// Text art that rarely changes (avatar frames, grass and cloud strips) is
+// rasterised once into a 1-bpp bitmap and blitted as filled rects in
+// whatever colour the frame needs, instead of re-rasterising the font every
+// frame. Slots are equal-sized and live in caller-provided storage; when
+// all are in use the least recently used one is recycled.
+// Header-only, no Arduino dependencies (unit tested on native).
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace SpriteCache {
+
+// Bitmap rows are byte-aligned, MSB = leftmost pixel (LGFX 1-bit sprite layout)
+inline uint16_t strideBytes(uint16_t w) {
+    return (uint16_t)((w + 7) / 8);
+}
+
+inline size_t bitmapBytes(uint16_t w, uint16_t h) {
+    return (size_t)strideBytes(w) * h;
+}
+
+inline bool getPixel(const uint8_t* bits, uint16_t w, int x, int y) {
+    return (bits[(size_t)y * strideBytes(w) + (x >> 3)] & (0x80 >> (x & 7))) != 0;
+}
+
+inline void setPixel(uint8_t* bits, uint16_t w, int x, int y) {
+    bits[(size_t)y * strideBytes(w) + (x >> 3)] |= (uint8_t)(0x80 >> (x & 7));
+}
+
+// ============================================================================
+// Keys
+// ============================================================================
+
+enum class Kind : uint8_t {
+    Avatar = 1,
+    Grass,
+    Clouds
+};
+
+/**
+ * One avatar frame variant. sniffFrame: 0 = no sniff, 1..3 = nose shape.
+ * Everything that changes the pixels is in the key; position and colour
+ * are applied at blit time.
+ */
+inline uint32_t avatarKey(uint8_t state, bool faceRight, bool blink, uint8_t sniffFrame, bool tailLeft) {
+    return ((uint32_t)Kind::Avatar << 24) |
+           ((uint32_t)state << 8) |
+           ((uint32_t)(sniffFrame & 0x3) << 3) |
+           ((faceRight ? 1u : 0u) << 2) |
+           ((blink ? 1u : 0u) << 1) |
+           (tailLeft ? 1u : 0u);
+}
+
+// Text strip (FNV-1a of the pattern, tagged with its kind)
+inline uint32_t textKey(Kind kind, const char* text) {
+    uint32_t h = 2166136261u;
+    for (const char* p = text; p && *p; p++) {
+        h ^= (uint8_t)*p;
+        h *= 16777619u;
+    }
+    return ((uint32_t)kind << 24) ^ (h & 0x00FFFFFFu) ^ (h >> 24);
+}
+
+// ============================================================================
+// Slot cache
+// ============================================================================
+
+struct Stats {
+    uint32_t hits;
+    uint32_t misses;        // Each one is a rasterisation
+    uint32_t evictions;
+    uint16_t slots;
+    uint16_t slotBytes;
+};
+
+class Cache {
+public:
+    static const uint8_t kMaxSlots = 16;
+
+    Cache() : storage(nullptr), slotBytes(0), slots(0), tick(0) { resetStats(); }
+
+    /**
+     * Carve storage into bytes / slotBytes slots (at most kMaxSlots).
+     * @return slots available, 0 if storage can't hold one
+     */
+    uint8_t attach(uint8_t* buf, size_t bytes, uint16_t perSlot) {
+        storage = buf;
+        slotBytes = perSlot;
+        size_t n = (buf && perSlot) ? bytes / perSlot : 0;
+        slots = (uint8_t)(n > kMaxSlots ? kMaxSlots : n);
+        clear();
+        resetStats();
+        return slots;
+    }
+
+    void detach() {
+        storage = nullptr;
+        slots = 0;
+        clear();
+    }
+
+    bool ready() const { return slots > 0; }
+
+    // Drop every entry (storage stays attached)
+    void clear() {
+        for (uint8_t i = 0; i < kMaxSlots; i++) {
+            used[i] = false;
+            keys[i] = 0;
+            lastUse[i] = 0;
+        }
+        tick = 0;
+    }
+
+    // Cached bitmap for key, or nullptr. A hit marks the slot recently used.
+    const uint8_t* find(uint32_t key) {
+        for (uint8_t i = 0; i < slots; i++) {
+            if (used[i] && keys[i] == key) {
+                lastUse[i] = ++tick;
+                stats.hits++;
+                return slot(i);
+            }
+        }
+        stats.misses++;
+        return nullptr;
+    }
+
+    // Zeroed slot now owned by key (the caller rasterises into it).
+    // Recycles the least recently used slot when all are taken.
+    uint8_t* insert(uint32_t key) {
+        if (!ready()) return nullptr;
+        uint8_t victim = 0;
+        bool found = false;
+        for (uint8_t i = 0; i < slots; i++) {
+            if (used[i] && keys[i] == key) {
+                victim = i;
+                found = true;
+                break;
+            }
+        }
+        if (!found) {
+            for (uint8_t i = 0; i < slots; i++) {
+                if (!used[i]) {
+                    victim = i;
+                    found = true;
+                    break;
+                }
+            }
+        }
+        if (!found) {
+            for (uint8_t i = 1; i < slots; i++) {
+                if (lastUse[i] < lastUse[victim]) victim = i;
+            }
+            stats.evictions++;
+        }
+        used[victim] = true;
+        keys[victim] = key;
+        lastUse[victim] = ++tick;
+        uint8_t* p = slot(victim);
+        memset(p, 0, slotBytes);
+        return p;
+    }
+
+    uint8_t entries() const {
+        uint8_t n = 0;
+        for (uint8_t i = 0; i < slots; i++) {
+            if (used[i]) n++;
+        }
+        return n;
+    }
+
+    Stats getStats() const {
+        Stats s = stats;
+        s.slots = slots;
+        s.slotBytes = slotBytes;
+        return s;
+    }
+
+    void resetStats() {
+        stats.hits = 0;
+        stats.misses = 0;
+        stats.evictions = 0;
+        stats.slots = 0;
+        stats.slotBytes = 0;
+    }
+
+private:
+    uint8_t* slot(uint8_t i) const { return storage + (size_t)i * slotBytes; }
+
+    uint8_t* storage;
+    uint16_t slotBytes;
+    uint8_t slots;
+    uint32_t tick;
+    bool used[kMaxSlots];
+    uint32_t keys[kMaxSlots];
+    uint32_t lastUse[kMaxSlots];
+    Stats stats;
+};
+
+// ============================================================================
+// Blit
+// ============================================================================
+
+/**
+ * Emit the set pixels as rects sink(x, y, w, h), offset by (x0, y0). Each
+ * horizontal run becomes one rect, and identical consecutive rows (scaled
+ * text repeats every row textSize times) share it. Rects are clipped to
+ * [0, clipW) x [0, clipH).
+ * @return rects emitted
+ */
+template <typename Sink>
+uint32_t blitRuns(const uint8_t* bits, uint16_t w, uint16_t h, int x0, int y0,
+                  int clipW, int clipH, Sink& sink) {
+    uint32_t rects = 0;
+    uint16_t stride = strideBytes(w);
+    uint16_t y = 0;
+    while (y < h) {
+        const uint8_t* row = bits + (size_t)y * stride;
+        uint16_t rows = 1;
+        while (y + rows < h && memcmp(row, row + (size_t)rows * stride, stride) == 0) rows++;
+
+        int sy = y0 + y;
+        int ey = sy + rows;
+        if (sy < 0) sy = 0;
+        if (ey > clipH) ey = clipH;
+        y = (uint16_t)(y + rows);
+        if (ey <= sy) continue;
+
+        int x = 0;
+        while (x < w) {
+            // Skip empty bytes whole
+            if ((x & 7) == 0 && row[x >> 3] == 0) {
+                x += 8;
+                continue;
+            }
+            if (!(row[x >> 3] & (0x80 >> (x & 7)))) {
+                x++;
+                continue;
+            }
+            int start = x;
+            while (x < w && (row[x >> 3] & (0x80 >> (x & 7)))) x++;
+            int sx = x0 + start;
+            int ex = x0 + x;
+            if (sx < 0) sx = 0;
+            if (ex > clipW) ex = clipW;
+            if (ex > sx) {
+                sink(sx, sy, ex - sx, ey - sy);
+                rects++;
+            }
+        }
+    }
+    return rects;
+}
+
+}  // namespace SpriteCache
@@ -0,0 +1,143 @@
+// WardriveRows - Row formatting and sector batching for WARHOG output
+// WARHOG keeps its session CSV and WiGLE files open and queues rows in a
+// small RAM buffer per file. Rows are formatted on the stack; the buffer
+// goes to SD only in whole 512-byte sectors of the file (plus a full flush
+// on a timer, low battery and stop), and tracks the file size so WiGLE
+// rotation needs no extra open.
+// Header-only, no Arduino dependencies (unit tested on native).
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+namespace WardriveRows {
+
+static const size_t kSector = 512;
+static const size_t kMaxRow = 256;     // Longest formatted row (escaped 32-byte SSID)
+
+/**
+ * Quoted CSV SSID: at most 32 bytes of input, '"' doubled, control
+ * characters dropped (what writeCSVField() printed field by field).
+ * @return bytes written (out always NUL-terminated)
+ */
+inline size_t csvField(char* out, size_t cap, const char* ssid) {
+    size_t n = 0;
+    if (cap < 3) {
+        if (cap) out[0] = '\0';
+        return 0;
+    }
+    out[n++] = '"';
+    for (int i = 0; i < 32 && ssid && ssid[i]; i++) {
+        char c = ssid[i];
+        if (c == '"') {
+            if (n + 3 >= cap) break;
+            out[n++] = '"';
+            out[n++] = '"';
+        } else if (c >= 32) {
+            if (n + 2 >= cap) break;
+            out[n++] = c;
+        }
+    }
+    out[n++] = '"';
+    out[n] = '\0';
+    return n;
+}
+
+/**
+ * Session CSV row:
+ * BSSID,SSID,RSSI,Channel,AuthMode,Latitude,Longitude,Altitude,Timestamp
+ * @return row length (0 if it didn't fit)
+ */
+inline size_t formatCsvRow(char* out, size_t cap, const uint8_t* bssid, const char* ssid,
+                           int rssi, int channel, const char* auth,
+                           double lat, double lon, double alt, unsigned long ms) {
+    char field[72];
+    csvField(field, sizeof(field), ssid);
+    int r = snprintf(out, cap, "%02X:%02X:%02X:%02X:%02X:%02X,%s,%d,%d,%s,%.6f,%.6f,%.1f,%lu\n",
+                     bssid[0], bssid[1], bssid[2], bssid[3], bssid[4], bssid[5],
+                     field, rssi, channel, auth, lat, lon, alt, ms);
+    return (r > 0 && (size_t)r < cap) ? (size_t)r : 0;
+}
+
+/**
+ * WiGLE 1.6 row: MAC,SSID,AuthMode,FirstSeen,Channel,Frequency,RSSI,
+ * CurrentLatitude,CurrentLongitude,AltitudeMeters,AccuracyMeters,RCOIs,MfgrId,Type
+ * @return row length (0 if it didn't fit)
+ */
+inline size_t formatWigleRow(char* out, size_t cap, const uint8_t* bssid, const char* ssid,
+                             const char* auth, const char* firstSeen, int channel, int freq,
+                             int rssi, double lat, double lon, double alt, double accuracy) {
+    char field[72];
+    csvField(field, sizeof(field), ssid);
+    int r = snprintf(out, cap, "%02X:%02X:%02X:%02X:%02X:%02X,%s,%s,%s,%d,%d,%d,%.6f,%.6f,%.1f,%.1f,,,WIFI\r\n",
+                     bssid[0], bssid[1], bssid[2], bssid[3], bssid[4], bssid[5],
+                     field, auth, firstSeen, channel, freq, rssi, lat, lon, alt,
+                     accuracy > 0 ? accuracy : 10.0);
+    return (r > 0 && (size_t)r < cap) ? (size_t)r : 0;
+}
+
+/**
+ * RAM buffer in front of one open file.
+ * Sink: callable bool(const uint8_t* data, size_t len), false on a short write.
+ * Writes issued by append() always end on a sector boundary of the file,
+ * so FAT sees whole-sector writes instead of one small write per row.
+ */
+template <size_t N>
+class SectorBuffer {
+    static_assert(N % kSector == 0 && N >= 2 * kSector, "N must be a multiple of two sectors or more");
+    static_assert(N - kSector >= kMaxRow, "a row must fit after a sector flush");
+
+public:
+    SectorBuffer() : used(0), written(0) {}
+
+    // Start tracking a file that already holds fileSize bytes
+    void reset(uint32_t fileSize) {
+        used = 0;
+        written = fileSize;
+    }
+
+    uint32_t size() const { return written + (uint32_t)used; }   // File size incl. queued bytes
+    size_t pending() const { return used; }
+
+    template <class Sink>
+    bool append(const char* data, size_t len, Sink& sink) {
+        if (len > N - kSector) return false;
+        if (used + len > N && !flushSectors(sink)) return false;
+        memcpy(buf + used, data, len);
+        used += len;
+        return true;
+    }
+
+    // Write the queued bytes up to the last whole sector of the file
+    template <class Sink>
+    bool flushSectors(Sink& sink) {
+        uint32_t end = written + (uint32_t)used;
+        uint32_t boundary = end - end % kSector;
+        if (boundary <= written) return true;   // Nothing reaches a boundary yet
+        size_t n = boundary - written;
+        if (!sink(buf, n)) return false;
+        memmove(buf, buf + n, used - n);
+        used -= n;
+        written += (uint32_t)n;
+        return true;
+    }
+
+    // Write everything (timer, low battery, stop, rotation)
+    template <class Sink>
+    bool flushAll(Sink& sink) {
+        if (used == 0) return true;
+        if (!sink(buf, used)) return false;
+        written += (uint32_t)used;
+        used = 0;
+        return true;
+    }
+
+private:
+    uint8_t buf[N];
+    size_t used;
+    uint32_t written;
+};
+
+}  // namespace WardriveRows
@@ -0,0 +1,232 @@
+// WardriveSightings - Best-RSSI position per BSSID for passive WARHOG
+// Passive WARHOG is fed beacon sightings by NetworkRecon instead of running
+// blocking scans. Each BSSID in range keeps only its strongest sighting and
+// the GPS position at that moment (optionally interpolated between the fixes
+// either side of it). Once an AP has gone quiet the entry is handed out as
+// one row and its slot is reused; a later pass past the same AP is a new
+// entry, so only the entry opened by the BSSID's first sighting is flagged
+// first. Slots live in caller-provided storage (allocated for the session).
+// Header-only, no Arduino dependencies (unit tested on native).
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace WardriveSightings {
+
+struct Fix {
+    uint32_t ms;            // millis() the fix was taken
+    int32_t latE7;          // Degrees * 1e7 (1 cm resolution, fits int32)
+    int32_t lonE7;
+    float alt;              // Meters
+    float accuracy;         // Meters
+    uint32_t date;          // GPS DDMMYY
+    uint32_t time;          // GPS HHMMSSCC
+};
+
+inline int32_t toE7(double deg) {
+    return (int32_t)(deg * 1e7 + (deg < 0 ? -0.5 : 0.5));
+}
+
+inline double fromE7(int32_t v) {
+    return v / 1e7;
+}
+
+/**
+ * Position at time t, from fix a (earlier) and fix b (later).
+ * Linear between the two; if t is outside a..b or the fixes are more than
+ * maxGapMs apart, the nearer fix is returned unchanged.
+ */
+inline Fix interpolate(const Fix& a, const Fix& b, uint32_t t, uint32_t maxGapMs) {
+    int32_t span = (int32_t)(b.ms - a.ms);
+    int32_t off = (int32_t)(t - a.ms);
+    if (span <= 0 || off >= span) return b;
+    if (off <= 0) return a;
+    if ((uint32_t)span > maxGapMs) return (off * 2 < span) ? a : b;
+
+    Fix out = (off * 2 < span) ? a : b;     // Date/time/accuracy of the nearer fix
+    out.ms = t;
+    out.latE7 = a.latE7 + (int32_t)((int64_t)(b.latE7 - a.latE7) * off / span);
+    out.lonE7 = a.lonE7 + (int32_t)((int64_t)(b.lonE7 - a.lonE7) * off / span);
+    out.alt = a.alt + (b.alt - a.alt) * (float)off / (float)span;
+    return out;
+}
+
+struct Sighting {
+    const uint8_t* bssid;
+    const char* ssid;       // May be empty (hidden)
+    uint8_t auth;           // wifi_auth_mode_t
+    uint8_t channel;
+    int8_t rssi;
+    uint32_t ms;            // millis() the frame arrived
+    bool first;             // First sighting of this BSSID this session
+};
+
+struct Entry {
+    uint8_t bssid[6];
+    int8_t rssi;            // Strongest sighting this pass
+    uint8_t channel;
+    uint8_t auth;
+    bool used;
+    bool pending;           // Position waits for the next fix (interpolation)
+    bool first;             // First row for this BSSID this session (award once)
+    char ssid[33];
+    uint32_t bestMs;        // When the strongest sighting arrived
+    uint32_t heardMs;       // Last sighting of any strength
+    Fix pos;
+};
+
+/**
+ * Open table of in-range APs. Emit: callable void(const Entry&), called for
+ * entries leaving the table (quiet, evicted to make room, or flushed).
+ */
+class BestTable {
+public:
+    BestTable() : slots(nullptr), cap(0), count(0), interpolateFixes(false),
+                  maxGapMs(0), haveFix(false) {
+        memset(&last, 0, sizeof(last));
+    }
+
+    // maxGap: fixes older than this don't geotag, and aren't interpolated across
+    void attach(Entry* storage, uint16_t n, bool interpolate, uint32_t maxGap) {
+        slots = storage;
+        cap = storage ? n : 0;
+        interpolateFixes = interpolate;
+        maxGapMs = maxGap;
+        clear();
+    }
+
+    void detach() {
+        slots = nullptr;
+        cap = 0;
+        count = 0;
+        haveFix = false;
+    }
+
+    void clear() {
+        for (uint16_t i = 0; i < cap; i++) slots[i].used = false;
+        count = 0;
+        haveFix = false;
+    }
+
+    uint16_t size() const { return count; }
+    uint16_t capacity() const { return cap; }
+
+    bool fixLive(uint32_t now) const {
+        return haveFix && (uint32_t)(now - last.ms) <= maxGapMs;
+    }
+
+    // New GPS fix: entries waiting on it get their interpolated position
+    void onFix(const Fix& fix) {
+        for (uint16_t i = 0; i < cap; i++) {
+            Entry& e = slots[i];
+            if (!e.used || !e.pending) continue;
+            // pos still holds the fix that was current when the sighting arrived
+            e.pos = interpolate(e.pos, fix, e.bestMs, maxGapMs);
+            e.pending = false;
+        }
+        last = fix;
+        haveFix = true;
+    }
+
+    /**
+     * Record a sighting. Without a live fix nothing new is geotagged.
+     * @return true if it became the strongest sighting for its BSSID
+     */
+    template <class Emit>
+    bool observe(const Sighting& s, uint32_t now, Emit& emit) {
+        if (cap == 0) return false;
+        Entry* e = find(s.bssid);
+        if (e) e->heardMs = s.ms;
+        if (!fixLive(now)) return false;
+
+        if (!e) {
+            e = freeSlot(emit);
+            memcpy(e->bssid, s.bssid, 6);
+            e->used = true;
+            e->first = s.first;
+            e->ssid[0] = '\0';
+            e->heardMs = s.ms;
+            count++;
+        } else if (s.rssi <= e->rssi) {
+            return false;
+        }
+
+        e->rssi = s.rssi;
+        e->channel = s.channel;
+        e->auth = s.auth;
+        if (s.ssid && s.ssid[0]) {
+            strncpy(e->ssid, s.ssid, sizeof(e->ssid) - 1);
+            e->ssid[sizeof(e->ssid) - 1] = '\0';
+        }
+        e->bestMs = s.ms;
+        e->pos = last;
+        // A sighting older than the latest fix has no later fix to wait for
+        e->pending = interpolateFixes && (int32_t)(s.ms - last.ms) > 0;
+        return true;
+    }
+
+    // Hand out APs not heard for quietMs
+    template <class Emit>
+    uint16_t emitQuiet(uint32_t now, uint32_t quietMs, Emit& emit) {
+        uint16_t n = 0;
+        for (uint16_t i = 0; i < cap; i++) {
+            Entry& e = slots[i];
+            if (!e.used || (uint32_t)(now - e.heardMs) < quietMs) continue;
+            release(e, emit);
+            n++;
+        }
+        return n;
+    }
+
+    // Stop: everything goes out (pending entries keep their last fix)
+    template <class Emit>
+    uint16_t emitAll(Emit& emit) {
+        uint16_t n = 0;
+        for (uint16_t i = 0; i < cap; i++) {
+            if (!slots[i].used) continue;
+            release(slots[i], emit);
+            n++;
+        }
+        return n;
+    }
+
+private:
+    Entry* find(const uint8_t* bssid) {
+        for (uint16_t i = 0; i < cap; i++) {
+            if (slots[i].used && memcmp(slots[i].bssid, bssid, 6) == 0) return &slots[i];
+        }
+        return nullptr;
+    }
+
+    // Full table: the longest-quiet AP goes out early to make room
+    template <class Emit>
+    Entry* freeSlot(Emit& emit) {
+        Entry* oldest = nullptr;
+        for (uint16_t i = 0; i < cap; i++) {
+            if (!slots[i].used) return &slots[i];
+            if (!oldest || (int32_t)(slots[i].heardMs - oldest->heardMs) < 0) oldest = &slots[i];
+        }
+        release(*oldest, emit);
+        return oldest;
+    }
+
+    template <class Emit>
+    void release(Entry& e, Emit& emit) {
+        e.pending = false;
+        emit(e);
+        e.used = false;
+        count--;
+    }
+
+    Entry* slots;
+    uint16_t cap;
+    uint16_t count;
+    bool interpolateFixes;
+    uint32_t maxGapMs;
+    bool haveFix;
+    Fix last;
+};
+
+}  // namespace WardriveSightings
@@ -5,6 +5,7 @@
 #include "config.h"
 #include "sd_layout.h"
 #include "challenges.h"
+#include "xp_store.h"
 #include "../ui/display.h"
 #include "../ui/swine_stats.h"
 #include "../audio/sfx.h"
@@ -38,6 +39,27 @@ static bool pendingSaveFlag = false;
 // Mutex for protecting achievement queue operations AND pendingSaveFlag
 static SemaphoreHandle_t achQueueMutex = nullptr;
 
+// NVS blob persistence: save() only marks dirty, update() writes at most once
+// per XPStore::kMinSaveIntervalMs and only if the payload CRC changed. The SD
+// backup trails the NVS commit by XPStore::kBackupDelayMs.
+static XPStore::SavePolicy savePolicy;
+static uint32_t committedCrc = 0;       // Payload CRC of the blob in NVS
+static bool committedValid = false;
+static uint32_t backedUpCrc = 0;        // Payload CRC of the last SD backup
+static bool backedUpValid = false;
+static bool backupPending = false;
+static uint32_t commitMs = 0;
+static bool legacyKeysPresent = false;  // Pre-blob per-field keys still in NVS
+
+// Per-field keys used before the blob; removed once the blob is written
+static const char* const LEGACY_KEYS[] = {
+    "totalxp", "achieve", "achievehi", "networks", "hs", "pmkid", "deauths",
+    "distance", "ble", "hidden", "wpa3", "gpsnet", "open", "android", "samsung",
+    "windows", "roulette", "sessions", "wep", "passnet", "passpmk", "passtime",
+    "brosadd", "mercy", "titleo", "unlock"
+};
+static const uint8_t LEGACY_KEY_COUNT = sizeof(LEGACY_KEYS) / sizeof(LEGACY_KEYS[0]);
+
 // Achievement queue - prevents cascade of sounds/toasts when multiple unlock at once
 // Achievements are queued and processed one per frame via processAchievementQueue()
 static const uint8_t ACH_QUEUE_SIZE = 8;
@@ -303,6 +325,12 @@ bool XP::backupToSD() {
         return false;
     }
     
+    // Nothing changed since the last backup: skip the rewrite
+    uint32_t crc = XPStore::payloadCrc(&data, sizeof(PorkXPData));
+    if (backedUpValid && crc == backedUpCrc) {
+        return true;
+    }
+    
     const char* backupPath = SDLayout::xpBackupPath();
     File f = SD.open(backupPath, FILE_WRITE);
     if (!f) {
@@ -321,6 +349,8 @@ bool XP::backupToSD() {
     size_t expectedSize = sizeof(PorkXPData) + sizeof(uint32_t);
     if (written == expectedSize) {
         Serial.printf("[XP] SD backup: saved %d bytes (sig: %08X)\n", written, signature);
+        backedUpCrc = crc;
+        backedUpValid = true;
         return true;
     }
     
@@ -398,7 +428,7 @@ bool XP::restoreFromSD() {
         Serial.printf("[XP] SD restore: migrated legacy LV%d (%lu XP)\n",
                       data.cachedLevel, data.totalXP);
         f.close();
-        save();  // This will write the new signed format
+        flush();  // This will write the new signed format
         return true;
     }
     
@@ -418,7 +448,7 @@ bool XP::restoreFromSD() {
                   data.cachedLevel, data.totalXP, data.lifetimeNetworks);
     
     // Save restored data back to NVS so future boots don't need SD
-    save();
+    flush();
     
     return true;
 }
@@ -448,8 +478,10 @@ void XP::init() {
         }
     } else {
         // Existing data in NVS - proactively backup to SD
-        // This ensures users upgrading to v0.1.6 get their progress backed up immediately
-        backupToSD();
+        // This ensures users upgrading to v0.1.6 get their progress backed up.
+        // Runs from update() once boot is over rather than inline here.
+        backupPending = true;
+        commitMs = millis();
     }
     
     startSession();
@@ -462,6 +494,33 @@ void XP::init() {
 void XP::load() {
     prefs.begin("porkxp", true);  // Read-only
     
+    XPStore::Status st = XPStore::readBlob(prefs, &data, sizeof(PorkXPData));
+    if (XPStore::usable(st)) {
+        committedCrc = XPStore::payloadCrc(&data, sizeof(PorkXPData));
+        committedValid = true;
+        // Older firmware's shorter blob: rewrite at the current size
+        if (st == XPStore::Status::Upgraded) savePolicy.markDirty();
+    } else {
+        if (st != XPStore::Status::Missing) {
+            Serial.printf("[XP] NVS blob rejected (%s), trying per-field keys\n",
+                          XPStore::statusName(st));
+        }
+        loadLegacyKeys();
+    }
+    // Legacy keys linger after a blob exists only if their removal was cut short
+    legacyKeysPresent = prefs.isKey("totalxp");
+    data.cachedLevel = calculateLevel(data.totalXP);
+    
+    prefs.end();
+    
+    if (legacyKeysPresent) {
+        Serial.println("[XP] Migrating per-field keys to NVS blob");
+        savePolicy.markDirty();
+    }
+}
+
+void XP::loadLegacyKeys() {
+    // Pre-blob layout: one key per field (prefs already open)
     data.totalXP = prefs.getUInt("totalxp", 0);
     // Read achievements as two 32-bit values for uint64_t
     uint32_t achLow = prefs.getUInt("achieve", 0);
@@ -491,49 +550,81 @@ void XP::load() {
     data.mercyCount = prefs.getUInt("mercy", 0);
     data.titleOverride = static_cast<TitleOverride>(prefs.getUChar("titleo", 0));
     data.unlockables = prefs.getUInt("unlock", 0);  // Unlockables v0.1.8
-    data.cachedLevel = calculateLevel(data.totalXP);
-    
-    prefs.end();
 }
 
 void XP::save() {
-    prefs.begin("porkxp", false);  // Read-write
-    
-    prefs.putUInt("totalxp", data.totalXP);
-    // Store achievements as two 32-bit values for uint64_t
-    prefs.putUInt("achieve", (uint32_t)(data.achievements & 0xFFFFFFFF));
-    prefs.putUInt("achievehi", (uint32_t)(data.achievements >> 32));
-    prefs.putUInt("networks", data.lifetimeNetworks);
-    prefs.putUInt("hs", data.lifetimeHS);
-    prefs.putUInt("pmkid", data.lifetimePMKID);
-    prefs.putUInt("deauths", data.lifetimeDeauths);
-    prefs.putUInt("distance", data.lifetimeDistance);
-    prefs.putUInt("ble", data.lifetimeBLE);
-    prefs.putUInt("hidden", data.hiddenNetworks);
-    prefs.putUInt("wpa3", data.wpa3Networks);
-    prefs.putUInt("gpsnet", data.gpsNetworks);
-    prefs.putUInt("open", data.openNetworks);
-    prefs.putUInt("android", data.androidBLE);
-    prefs.putUInt("samsung", data.samsungBLE);
-    prefs.putUInt("windows", data.windowsBLE);
-    prefs.putUInt("roulette", data.rouletteWins);
-    prefs.putUShort("sessions", data.sessions);
-    prefs.putBool("wep", data.wepFound);
-    // DO NO HAM / BOAR BROS persistent counters (v0.1.4+)
-    prefs.putUInt("passnet", data.passiveNetworks);
-    prefs.putUInt("passpmk", data.passivePMKIDs);
-    prefs.putUInt("passtime", data.passiveTimeS);
-    prefs.putUInt("brosadd", data.boarBrosAdded);
-    prefs.putUInt("mercy", data.mercyCount);
-    prefs.putUChar("titleo", static_cast<uint8_t>(data.titleOverride));
-    prefs.putUInt("unlock", data.unlockables);  // Unlockables v0.1.8
+    // Coalesced: update() writes once the save interval allows
+    savePolicy.markDirty();
+}
+
+int8_t XP::commit() {
+    uint32_t crc = XPStore::payloadCrc(&data, sizeof(PorkXPData));
+    if (committedValid && crc == committedCrc && !legacyKeysPresent) {
+        return 0;  // Blob already holds this
+    }
     
+    prefs.begin("porkxp", false);  // Read-write
+    bool ok = XPStore::writeBlob(prefs, &data, sizeof(PorkXPData));
+    if (ok && legacyKeysPresent) {
+        for (uint8_t i = 0; i < LEGACY_KEY_COUNT; i++) {
+            prefs.remove(LEGACY_KEYS[i]);
+        }
+        legacyKeysPresent = false;
+        Serial.println("[XP] Per-field keys migrated to NVS blob");
+    }
     prefs.end();
     
+    if (!ok) {
+        Serial.println("[XP] Save failed - NVS blob write");
+        return -1;
+    }
+    
+    committedCrc = crc;
+    committedValid = true;
     Serial.printf("[XP] Saved - LV%d (%lu XP)\n", getLevel(), data.totalXP);
+    return 1;
+}
+
+void XP::update(bool sdSafe) {
+    uint32_t now = millis();
+    
+    // Achievement/unlockable saves wait for a mode without SD bus contention
+    if (sdSafe) {
+        processPendingSave();
+    }
+    
+    if (savePolicy.due(now)) {
+        int8_t r = commit();
+        if (r < 0) {
+            savePolicy.failed(now);
+        } else {
+            savePolicy.saved(now, r > 0);
+            if (r > 0) {
+                backupPending = true;
+                commitMs = now;
+            }
+        }
+    }
     
     // Backup to SD - pig survives M5Burner / NVS wipes
-    backupToSD();
+    if (backupPending && sdSafe && now - commitMs >= XPStore::kBackupDelayMs) {
+        backupPending = false;
+        backupToSD();
+    }
+}
+
+void XP::flush() {
+    // Shutdown/reboot paths: skip the interval and the backup delay
+    int8_t r = commit();
+    if (r < 0) {
+        savePolicy.failed(millis());
+        return;
+    }
+    savePolicy.saved(millis(), r > 0);
+    if (r > 0 || backupPending) {
+        backupPending = false;
+        backupToSD();
+    }
 }
 
 void XP::processPendingSave() {
@@ -552,7 +643,7 @@ void XP::processPendingSave() {
     
     if (needsSave) {
         save();
-        Serial.println("[XP] Deferred save completed");
+        Serial.println("[XP] Deferred save requested");
     }
 }
 
@@ -607,7 +698,7 @@ void XP::startSession() {
 }
 
 void XP::endSession() {
-    save();
+    flush();
     Serial.printf("[XP] Session ended - +%lu XP this session\n", session.xp);
 }
 
@@ -217,7 +217,9 @@ struct SessionStats {
 class XP {
 public:
     static void init();
-    static void save();
+    static void save();  // Coalesced: marks dirty, update() writes
+    static void update(bool sdSafe);  // Commit due saves, trailing SD backup (main loop)
+    static void flush();  // Write now, before reboot/power-off
     static void processPendingSave();  // Process deferred saves (call from safe context)
     static void processAchievementQueue();  // Process one queued achievement celebration
     
@@ -295,6 +297,8 @@ private:
     static void (*levelUpCallback)(uint8_t, uint8_t);
     
     static void load();
+    static void loadLegacyKeys();
+    static int8_t commit();  // 1 = wrote, 0 = unchanged, -1 = failed
     static void checkAchievements();
     static uint8_t calculateLevel(uint32_t xp);
     
@@ -0,0 +1,177 @@
+// XPStore - Versioned XP blob and save coalescing
+// XP state lives in NVS as one blob key: a small header (magic, version,
+// payload size, CRC-32) followed by the PorkXPData bytes. One putBytes()
+// replaces ~27 per-field puts. Fields are only ever appended to PorkXPData,
+// so a shorter (older) payload loads with the new tail zeroed.
+// SavePolicy turns bursts of save requests into one write per interval.
+// Header-only, no Arduino dependencies (unit tested on native).
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include "crc32.h"
+
+namespace XPStore {
+
+static const uint32_t kMagic = 0x31505850;     // 'PXP1'
+static const uint16_t kVersion = 1;
+static const char* const kBlobKey = "blob";
+
+// Bursts of XP events inside this window share one NVS write
+static const uint32_t kMinSaveIntervalMs = 15000;
+// SD backup trails the NVS commit so it never lands in the same frame
+static const uint32_t kBackupDelayMs = 2000;
+
+struct Header {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t size;          // Payload bytes that follow
+    uint32_t crc;           // CRC-32 of the payload
+};
+
+static const size_t kHeaderSize = sizeof(Header);
+
+inline size_t blobSize(size_t payloadLen) {
+    return kHeaderSize + payloadLen;
+}
+
+/**
+ * Header + payload into out.
+ * @return bytes written, 0 if out is too small
+ */
+inline size_t encode(const void* payload, uint16_t len, uint8_t* out, size_t outLen) {
+    if (!payload || !out || outLen < blobSize(len)) return 0;
+    Header h;
+    h.magic = kMagic;
+    h.version = kVersion;
+    h.size = len;
+    h.crc = crc32Update(0, (const uint8_t*)payload, len);
+    memcpy(out, &h, kHeaderSize);
+    memcpy(out + kHeaderSize, payload, len);
+    return blobSize(len);
+}
+
+enum class Status : uint8_t {
+    Ok = 0,
+    Upgraded,       // Older, shorter payload; new fields zeroed
+    Missing,        // Nothing stored (or shorter than a header)
+    BadMagic,
+    BadSize,        // Header size disagrees with the stored length
+    BadCrc
+};
+
+inline const char* statusName(Status s) {
+    switch (s) {
+        case Status::Ok: return "OK";
+        case Status::Upgraded: return "UPGRADED";
+        case Status::Missing: return "MISSING";
+        case Status::BadMagic: return "BAD_MAGIC";
+        case Status::BadSize: return "BAD_SIZE";
+        case Status::BadCrc: return "BAD_CRC";
+        default: return "?";
+    }
+}
+
+inline bool usable(Status s) {
+    return s == Status::Ok || s == Status::Upgraded;
+}
+
+/**
+ * Validate a stored blob and copy its payload into payload (len bytes).
+ * payload is left untouched unless the result is usable(). A longer payload
+ * (written by newer firmware) loads its first len bytes.
+ */
+inline Status decode(const uint8_t* in, size_t inLen, void* payload, uint16_t len) {
+    if (!in || inLen < kHeaderSize) return Status::Missing;
+    Header h;
+    memcpy(&h, in, kHeaderSize);
+    if (h.magic != kMagic) return Status::BadMagic;
+    if (h.size == 0 || blobSize(h.size) != inLen) return Status::BadSize;
+    const uint8_t* body = in + kHeaderSize;
+    if (crc32Update(0, body, h.size) != h.crc) return Status::BadCrc;
+    if (h.size >= len) {
+        memcpy(payload, body, len);
+        return Status::Ok;
+    }
+    memcpy(payload, body, h.size);
+    memset((uint8_t*)payload + h.size, 0, len - h.size);
+    return Status::Upgraded;
+}
+
+// CRC of what a blob would hold: equal CRCs mean nothing to write
+inline uint32_t payloadCrc(const void* payload, uint16_t len) {
+    return crc32Update(0, (const uint8_t*)payload, len);
+}
+
+// Largest blob read back (a newer firmware's longer payload still fits)
+static const size_t kMaxBlob = 512;
+
+/**
+ * Read and validate the blob from an open Preferences namespace. Prefs is
+ * the Arduino Preferences class (or the native mock).
+ */
+template <typename Prefs>
+Status readBlob(Prefs& prefs, void* payload, uint16_t len) {
+    if (!prefs.isKey(kBlobKey)) return Status::Missing;
+    size_t n = prefs.getBytesLength(kBlobKey);
+    if (n > kMaxBlob) return Status::BadSize;
+    uint8_t buf[kMaxBlob];
+    if (prefs.getBytes(kBlobKey, buf, n) != n) return Status::Missing;
+    return decode(buf, n, payload, len);
+}
+
+// One putBytes() for the whole state. Returns false on a short write.
+template <typename Prefs>
+bool writeBlob(Prefs& prefs, const void* payload, uint16_t len) {
+    uint8_t buf[kMaxBlob];
+    size_t n = encode(payload, len, buf, sizeof(buf));
+    return n != 0 && prefs.putBytes(kBlobKey, buf, n) == n;
+}
+
+/**
+ * Dirty flag + minimum interval. The first request after a quiet spell is
+ * due at once; requests inside the interval wait for it to run out.
+ */
+class SavePolicy {
+public:
+    SavePolicy() : dirty(false), everSaved(false), lastSaveMs(0), requests(0), writes(0) {}
+
+    void markDirty() {
+        dirty = true;
+        requests++;
+    }
+
+    bool isDirty() const { return dirty; }
+
+    bool due(uint32_t nowMs) const {
+        if (!dirty) return false;
+        return !everSaved || nowMs - lastSaveMs >= kMinSaveIntervalMs;
+    }
+
+    // A write happened (or was found unnecessary) at nowMs
+    void saved(uint32_t nowMs, bool wrote) {
+        dirty = false;
+        everSaved = true;
+        lastSaveMs = nowMs;
+        if (wrote) writes++;
+    }
+
+    // Write failed: stay dirty, retry after the interval
+    void failed(uint32_t nowMs) {
+        everSaved = true;
+        lastSaveMs = nowMs;
+    }
+
+    uint32_t requestCount() const { return requests; }
+    uint32_t writeCount() const { return writes; }
+
+private:
+    bool dirty;
+    bool everSaved;
+    uint32_t lastSaveMs;
+    uint32_t requests;
+    uint32_t writes;
+};
+
+}  // namespace XPStore
@@ -15,8 +15,10 @@
 #include "core/xp.h"
 #include "core/sd_layout.h"
 #include "core/sdlog.h"
+#include "core/capture_journal.h"
 #include "core/wifi_utils.h"
 #include "core/heap_policy.h"
+#include "core/boot_timeline.h"
 #include "core/network_recon.h"
 #include "ui/display.h"
 #include "gps/gps.h"
@@ -28,6 +30,8 @@
 
 Porkchop porkchop;
 
+using BootPhase = BootProfile::Phase;
+
 // --- PATCH: Pre-init WiFi driver early to avoid later esp_wifi_init() failures
 // Some reconnect flows (and some Arduino/M5 stacks) end up deinit/reinit WiFi later.
 // If heap is fragmented by display sprites / big allocations, esp_wifi_init() may fail with:
@@ -279,9 +283,12 @@ void performBootHeapConditioning() {
 }
 
 void setup() {
+    BootTimeline::begin();
+
     Serial.begin(115200);
     delay(100);
     Serial.println("\n=== PORKCHOP STARTING ===");
+    BootTimeline::mark(BootPhase::Start);
 
     // Deassert CapLoRa SX1262 CS BEFORE SD init. The SX1262 shares
     // MOSI(G14)/MISO(G39)/SCK(G40) with the SD card. If its CS floats low
@@ -297,44 +304,64 @@ void setup() {
 
     // Configure G0 button (GPIO0) as input with pullup
     pinMode(0, INPUT_PULLUP);
+    BootTimeline::mark(BootPhase::Hardware);
 
     // --- PATCH: Initialize WiFi driver BEFORE config/display allocate big chunks
     // This dramatically reduces "esp_wifi_init 257" failures on reconnect later.
     preInitWiFiDriverEarly();
+    BootTimeline::mark(BootPhase::WiFiDriver);
+
+    // Personality only (SPIFFS): enough for the splash theme and callsign
+    Config::initEarly();
+    M5.Display.setBrightness(Config::personality().brightness * 255 / 100);
+    BootTimeline::mark(BootPhase::Personality);
+
+    // Init audio early so boot sound plays
+    SFX::init();
+
+    // Show boot splash (3 screens: OINK OINK, MY NAME IS, PORKCHOP). It keeps
+    // running while the rest of init happens; serviceBootSplash() between
+    // steps advances it.
+    Display::beginBootSplash();
+    BootTimeline::mark(BootPhase::Splash);
 
     // Load configuration from SD
     if (!Config::init()) {
         Serial.println("[MAIN] Config init failed, using defaults");
     }
+    BootTimeline::mark(BootPhase::SdConfig);
+    Display::serviceBootSplash();
 
     // Init SD logging (will be enabled via settings if user wants)
     SDLog::init();
+    BootTimeline::mark(BootPhase::SdLog);
 
     // Export any stored core dump to SD (if present)
     exportCoreDumpToSD();
+    BootTimeline::mark(BootPhase::CoreDump);
+    Display::serviceBootSplash();
+
+    // Export captures a crash or power cut left only in the journal
+    CaptureJournal::recover();
+    BootTimeline::mark(BootPhase::Journal);
+    Display::serviceBootSplash();
 
     // Perform heap conditioning to consolidate memory (like Oink mode does)
-    // This creates larger contiguous blocks needed for TLS operations
-    performBootHeapConditioning();
+    // This creates larger contiguous blocks needed for TLS operations.
+    // Skipped when the heap already has a TLS-sized block: it only costs time.
+    size_t largest = heap_caps_get_largest_free_block(MALLOC_CAP_8BIT);
+    if (BootProfile::needsConditioning(largest, HeapPolicy::kMinContigForTls)) {
+        performBootHeapConditioning();
+    } else {
+        Serial.printf("[BOOT] Heap conditioning skipped: largest=%u (gate %u)\n",
+                      (unsigned)largest, (unsigned)HeapPolicy::kMinContigForTls);
+        BootTimeline::setFlag(BootProfile::FLAG_CONDITION_SKIPPED);
+    }
+    BootTimeline::mark(BootPhase::HeapCondition);
+    Display::serviceBootSplash();
 
     // TLS reserve disabled: browser handles TLS, keep heap for UI/file transfer.
 
-    // Init display system
-    Display::init();
-
-    // Init audio early so boot sound plays
-    SFX::init();
-
-    // Show boot splash (3 screens: OINK OINK, MY NAME IS, PORKCHOP)
-    Display::showBootSplash();
-
-    // Apply saved brightness
-    M5.Display.setBrightness(Config::personality().brightness * 255 / 100);
-
-    // Initialize piglet personality
-    Avatar::init();
-    Mood::init();
-
     // Initialize GPS (if enabled)
     if (Config::gps().enabled) {
         // Hardware detection: warn if Cap LoRa GPS selected on non-ADV hardware
@@ -358,14 +385,33 @@ void setup() {
             }
         }
     }
+    BootTimeline::mark(BootPhase::Gps);
+    Display::serviceBootSplash();
+
+    // Initialize piglet personality
+    Avatar::init();
+    Mood::init();
+    BootTimeline::mark(BootPhase::Piglet);
+
+    // Whatever is left of the splash
+    Display::finishBootSplash();
+    BootTimeline::mark(BootPhase::SplashDone);
+
+    // Init display system (sprites; clears the splash)
+    Display::init();
+    BootTimeline::mark(BootPhase::Display);
 
     // Initialize modes
     OinkMode::init();
     WarhogMode::init();
     porkchop.init();
+    BootTimeline::mark(BootPhase::Modes);
 
     Serial.println("=== PORKCHOP READY ===");
     Serial.printf("Piglet: %s\n", Config::personality().name);
+    BootTimeline::mark(BootPhase::Ready);
+    BootTimeline::dumpSerial();
+    BootTimeline::dumpSD();
     
     // #region agent log
     // [DEBUG] H1: Log heap after init to check static pool impact (~13KB expected reduction)
@@ -15,6 +15,12 @@
 #include "../core/wifi_utils.h"
 #include "../core/heap_gates.h"
 #include "../core/heap_policy.h"
+#include "../core/ie_parser.h"
+#include "../core/eapol_parser.h"
+#include "../core/frame_dispatch.h"
+#include "../core/mpsc_ring.h"
+#include "../core/capture_journal.h"
+#include "../core/capture_catalog.h"
 #include "../ui/display.h"
 #include "../piglet/mood.h"
 #include "../piglet/avatar.h"
@@ -86,11 +92,8 @@ static portMUX_TYPE pendingPMKIDMux = portMUX_INITIALIZER_UNLOCKED;
 static portMUX_TYPE pendingBeaconMux = portMUX_INITIALIZER_UNLOCKED;
 static portMUX_TYPE pendingIncompleteMux = portMUX_INITIALIZER_UNLOCKED;
 
-// Ring-buffered deferred PMKID create (small, static)
-static const uint8_t PENDING_PMKID_SLOTS = 4;
-static uint8_t pendingPMKIDWrite = 0;
-static uint8_t pendingPMKIDRead = 0;
-static uint8_t pendingPMKIDCount = 0;
+// Ring-buffered deferred PMKID create (small, static, lock-free)
+static const uint16_t PENDING_PMKID_SLOTS = 8;
 struct PendingPMKIDCreate {
     uint8_t bssid[6];
     uint8_t station[6];
@@ -98,7 +101,12 @@ struct PendingPMKIDCreate {
     char ssid[33];
     uint8_t channel;
 };
-static PendingPMKIDCreate pendingPMKIDRing[PENDING_PMKID_SLOTS];
+static MpscRing<PendingPMKIDCreate, PENDING_PMKID_SLOTS> pendingPMKIDs;
+
+// PMKID popped from the ring and waiting on a dwell for its SSID.
+// Beacon handler fills the SSID in place (guarded by pendingPMKIDMux).
+static PendingPMKIDCreate dwellPMKID;
+static bool dwellPMKIDValid = false;
 
 static void onNewNetworkDiscovered(wifi_auth_mode_t authmode, bool isHidden,
                                    const char* ssid, int8_t rssi, uint8_t channel) {
@@ -113,9 +121,7 @@ static void onNewNetworkDiscovered(wifi_auth_mode_t authmode, bool isHidden,
 struct PendingHandshakeFrame {
     uint8_t bssid[6];
     uint8_t station[6];
-    uint8_t messageNum;  // DEPRECATED - kept for compatibility
-    EAPOLFrame frames[4];  // Store all 4 EAPOL frames (M1-M4)
-    uint8_t capturedMask;  // Bitmask: bit0=M1, bit1=M2, bit2=M3, bit3=M4
+    HandshakeFrames frames;  // Accumulated M1-M4; frames.mask() = captured set
 };
 // Ring-buffered deferred handshake frame add (heap allocated on start)
 static const uint8_t PENDING_HS_SLOTS = 2;
@@ -205,6 +211,9 @@ void DoNoHamMode::start() {
         incompleteHandshakes.reserve(8);
     }
     
+    // Journal captures to SD as they arrive
+    CaptureJournal::begin();
+    
     // Initialize channel stats
     for (int i = 0; i < 13; i++) {
         channelStats[i].channel = CHANNEL_ORDER[i];
@@ -233,9 +242,8 @@ void DoNoHamMode::start() {
     dwellResolved = false;
     
     // Reset deferred flags
-    pendingPMKIDWrite = 0;
-    pendingPMKIDRead = 0;
-    pendingPMKIDCount = 0;
+    pendingPMKIDs.reset();
+    dwellPMKIDValid = false;
     pendingHandshakeCapture = false;
     pendingBeaconStore = false;
     pendingIncompleteWrite = 0;
@@ -324,6 +332,10 @@ void DoNoHamMode::stop() {
     pendingSaveFlag = false;
     saveAllPMKIDs();
     saveAllHandshakes();
+    for (int i = 0; i < 32 && !CaptureJournal::sweep(handshakes, pmkids); i++) {
+        delay(5);  // Let the writer drain the ring
+    }
+    CaptureJournal::end();
     if (pausedByUs) {
         NetworkRecon::resume();
     }
@@ -343,9 +355,8 @@ void DoNoHamMode::stop() {
     handshakes.shrink_to_fit();
     
     // Reset deferred flags
-    pendingPMKIDWrite = 0;
-    pendingPMKIDRead = 0;
-    pendingPMKIDCount = 0;
+    pendingPMKIDs.reset();
+    dwellPMKIDValid = false;
     pendingHandshakeCapture = false;
     pendingBeaconStore = false;
     pendingIncompleteWrite = 0;
@@ -413,15 +424,24 @@ void DoNoHamMode::update() {
         }
     }
     
-    // Process deferred PMKID create (ring buffer, head-only)
+    // Process deferred PMKID create (stage one entry at a time for dwell)
     PendingPMKIDCreate pendingPMKIDLocal = {};
     bool hasPendingPMKID = false;
     taskENTER_CRITICAL(&pendingPMKIDMux);
-    if (pendingPMKIDCount > 0) {
-        pendingPMKIDLocal = pendingPMKIDRing[pendingPMKIDRead];
+    hasPendingPMKID = dwellPMKIDValid;
+    taskEXIT_CRITICAL(&pendingPMKIDMux);
+    if (!hasPendingPMKID && pendingPMKIDs.pop(pendingPMKIDLocal)) {
+        taskENTER_CRITICAL(&pendingPMKIDMux);
+        dwellPMKID = pendingPMKIDLocal;
+        dwellPMKIDValid = true;
+        taskEXIT_CRITICAL(&pendingPMKIDMux);
         hasPendingPMKID = true;
     }
-    taskEXIT_CRITICAL(&pendingPMKIDMux);
+    if (hasPendingPMKID) {
+        taskENTER_CRITICAL(&pendingPMKIDMux);
+        pendingPMKIDLocal = dwellPMKID;
+        taskEXIT_CRITICAL(&pendingPMKIDMux);
+    }
 
     if (hasPendingPMKID) {
         // Check if dwell is complete (if we needed one)
@@ -437,15 +457,10 @@ void DoNoHamMode::update() {
         }
 
         if (canProcess) {
-            // Pop the head entry now that we can process it
+            // Release the staged entry now that we can process it
             taskENTER_CRITICAL(&pendingPMKIDMux);
-            if (pendingPMKIDCount > 0) {
-                pendingPMKIDLocal = pendingPMKIDRing[pendingPMKIDRead];
-                pendingPMKIDRead = (pendingPMKIDRead + 1) % PENDING_PMKID_SLOTS;
-                pendingPMKIDCount--;
-            } else {
-                canProcess = false;
-            }
+            pendingPMKIDLocal = dwellPMKID;
+            dwellPMKIDValid = false;
             taskEXIT_CRITICAL(&pendingPMKIDMux);
         }
 
@@ -470,6 +485,7 @@ void DoNoHamMode::update() {
                     strncpy(pmkids[idx].ssid, pendingPMKIDLocal.ssid, 32);
                     pmkids[idx].ssid[32] = 0;
                     pmkids[idx].timestamp = now;
+                    pmkids[idx].journaled = 0;
                     
                     // Announce capture + immediate safe save
                     if (pendingPMKIDLocal.ssid[0] != 0) {
@@ -537,7 +553,7 @@ void DoNoHamMode::update() {
         if (slot >= 0) {
             pendingHandshakeLocal = pendingHandshakePool[slot];
             pendingHandshakeUsed[slot] = false;
-            pendingHandshakePool[slot].capturedMask = 0;
+            pendingHandshakePool[slot].frames.clear();
             hasPendingHandshake = true;
         }
         taskEXIT_CRITICAL(&pendingHandshakeMux);
@@ -551,31 +567,11 @@ void DoNoHamMode::update() {
         if (hsIdx >= 0) {
             CapturedHandshake& hs = handshakes[hsIdx];
             
-            // Process ALL queued frames (M1-M4) from capturedMask
-            for (int msgIdx = 0; msgIdx < 4; msgIdx++) {
-                if (pendingHandshakeLocal.capturedMask & (1 << msgIdx)) {
-                    // Frame is present in the queued data
-                    if (hs.frames[msgIdx].len == 0) {  // Not already captured
-                        uint16_t copyLen = pendingHandshakeLocal.frames[msgIdx].len;
-                        if (copyLen > 0 && copyLen <= 512) {
-                            // EAPOL payload for hashcat 22000
-                            memcpy(hs.frames[msgIdx].data, pendingHandshakeLocal.frames[msgIdx].data, copyLen);
-                            hs.frames[msgIdx].len = copyLen;
-                            hs.frames[msgIdx].messageNum = msgIdx + 1;
-                            hs.frames[msgIdx].timestamp = now;
-                            
-                            // Full 802.11 frame for PCAP export (radiotap + WPA-SEC)
-                            uint16_t fullCopyLen = pendingHandshakeLocal.frames[msgIdx].fullFrameLen;
-                            if (fullCopyLen > 0 && fullCopyLen <= 300) {
-                                memcpy(hs.frames[msgIdx].fullFrame, pendingHandshakeLocal.frames[msgIdx].fullFrame, fullCopyLen);
-                                hs.frames[msgIdx].fullFrameLen = fullCopyLen;
-                                hs.frames[msgIdx].rssi = pendingHandshakeLocal.frames[msgIdx].rssi;
-                            }
-                            
-                            hs.capturedMask |= (1 << msgIdx);
-                            hs.lastSeen = now;
-                        }
-                    }
+            // Process ALL queued frames (M1-M4): EAPOL payload for hashcat
+            // 22000 plus full 802.11 frame for PCAP export (radiotap + WPA-SEC)
+            for (uint8_t msgIdx = 0; msgIdx < 4; msgIdx++) {
+                if (hs.mergeFrame(pendingHandshakeLocal.frames, msgIdx)) {  // Skips already captured
+                    hs.lastSeen = now;
                 }
             }
             
@@ -599,6 +595,9 @@ void DoNoHamMode::update() {
         }
     }
     
+    // Journal new frames/PMKIDs before anything else can lose them
+    CaptureJournal::sweep(handshakes, pmkids);
+    
     // Process handshake capture event (UI update + immediate safe save)
     if (pendingHandshakeCapture) {
         Display::showToast("NATURAL HANDSHAKE BLESSED - RESPECT DI HERB");
@@ -780,6 +779,10 @@ void DoNoHamMode::update() {
 }
 
 // Check if channel is primary (1, 6, or 11)
+RingStats DoNoHamMode::getPendingPMKIDStats() {
+    return pendingPMKIDs.stats();
+}
+
 bool DoNoHamMode::isPrimaryChannel(uint8_t ch) {
     return (ch == 1 || ch == 6 || ch == 11);
 }
@@ -1040,6 +1043,8 @@ void DoNoHamMode::saveAllPMKIDs() {
         }
         
         p.saved = true;
+        CaptureJournal::markExported(p.bssid, p.station, true);
+        CaptureCatalog::noteSaved(p.bssid, true, p.ssid);
         SDLog::log("DNH", "PMKID saved: %s (%s)", p.ssid, filename);
     }
 }
@@ -1099,20 +1104,12 @@ void DoNoHamMode::saveAllHandshakes() {
         uint8_t msgPair = hs.getMessagePair();
         if (msgPair == 0xFF) continue;
         
-        // Get frames
-        const EAPOLFrame* nonceFrame = nullptr;
-        const EAPOLFrame* eapolFrame = nullptr;
-        
-        if (msgPair == 0x00) {
-            nonceFrame = &hs.frames[0];  // M1
-            eapolFrame = &hs.frames[1];  // M2
-        } else {
-            nonceFrame = &hs.frames[2];  // M3
-            eapolFrame = &hs.frames[1];  // M2
-        }
+        // Get frames: ANonce from M1 (pair 0x00) or M3 (pair 0x02), EAPOL from M2
+        EapolFrameView nonceFrame = hs.frames[msgPair == 0x00 ? 0 : 2];
+        EapolFrameView eapolFrame = hs.frames[1];
         
         // Frame length validation (don't count as attempt if malformed)
-        if (nonceFrame->len < 51 || eapolFrame->len < 97) continue;
+        if (nonceFrame.len < 51 || eapolFrame.len < 97) continue;
         
         // Now we actually attempt to save - increment counter
         hs.saveAttempts++;
@@ -1139,7 +1136,7 @@ void DoNoHamMode::saveAllHandshakes() {
         // Extract MIC from M2 (offset 81, 16 bytes)
         char micHex[33];
         for (int i = 0; i < 16; i++) {
-            sprintf(micHex + i*2, "%02x", eapolFrame->data[81 + i]);
+            sprintf(micHex + i*2, "%02x", eapolFrame.data[81 + i]);
         }
         
         // MAC_AP
@@ -1166,13 +1163,13 @@ void DoNoHamMode::saveAllHandshakes() {
         // ANonce from M1 or M3 (offset 17, 32 bytes)
         char nonceHex[65];
         for (int i = 0; i < 32; i++) {
-            sprintf(nonceHex + i*2, "%02x", nonceFrame->data[17 + i]);
+            sprintf(nonceHex + i*2, "%02x", nonceFrame.data[17 + i]);
         }
         
         // EAPOL frame with MIC zeroed
-        uint16_t eapolLen = (eapolFrame->data[2] << 8) | eapolFrame->data[3];
+        uint16_t eapolLen = (eapolFrame.data[2] << 8) | eapolFrame.data[3];
         eapolLen += 4;
-        if (eapolLen > eapolFrame->len) eapolLen = eapolFrame->len;
+        if (eapolLen > eapolFrame.len) eapolLen = eapolFrame.len;
         
         char* eapolHex = (char*)malloc(eapolLen * 2 + 1);
         if (!eapolHex) {
@@ -1182,7 +1179,7 @@ void DoNoHamMode::saveAllHandshakes() {
         
         // Copy and zero MIC
         uint8_t eapolCopy[512];
-        memcpy(eapolCopy, eapolFrame->data, eapolLen);
+        memcpy(eapolCopy, eapolFrame.data, eapolLen);
         memset(eapolCopy + 81, 0, 16);
         
         for (int i = 0; i < eapolLen; i++) {
@@ -1251,11 +1248,11 @@ void DoNoHamMode::saveAllHandshakes() {
             // Write EAPOL frames
             for (int i = 0; i < 4; i++) {
                 if (!(hs.capturedMask & (1 << i))) continue;
-                const EAPOLFrame& frame = hs.frames[i];
+                EapolFrameView frame = hs.frames[i];
                 if (frame.len == 0) continue;
                 
                 // Prefer fullFrame if available
-                if (frame.fullFrameLen > 0 && frame.fullFrameLen <= 300) {
+                if (frame.fullFrameLen > 0) {
                     uint32_t totalLen = sizeof(DNH_RADIOTAP_HEADER) + frame.fullFrameLen;
                     DNH_PCAPPacketHeader pkt = {
                         .ts_sec = frame.timestamp / 1000,
@@ -1274,6 +1271,8 @@ void DoNoHamMode::saveAllHandshakes() {
         }
         
         hs.saved = true;
+        CaptureJournal::markExported(hs.bssid, hs.station, false);
+        CaptureCatalog::noteSaved(hs.bssid, false, hs.ssid);
         SDLog::log("DNH", "Handshake saved: %s (%s)", hs.ssid, filename);
     }
 }
@@ -1333,6 +1332,16 @@ int DoNoHamMode::findOrCreateHandshake(const uint8_t* bssid, const uint8_t* stat
             return i;
         }
     }
+    // At the cap, drop the oldest saved + journaled handshake (already on SD)
+    if (handshakes.size() >= DNH_MAX_HANDSHAKES) {
+        int victim = CaptureJournal::evictableHandshake(handshakes);
+        if (victim >= 0) {
+            if (handshakes[victim].beaconData) {
+                free(handshakes[victim].beaconData);
+            }
+            handshakes.erase(handshakes.begin() + victim);
+        }
+    }
     // Create new
     if (handshakes.size() < DNH_MAX_HANDSHAKES) {
         // Check free heap before attempting allocation
@@ -1433,6 +1442,7 @@ void DoNoHamMode::injectTestNetwork(const uint8_t* bssid, const char* ssid, uint
         net.lastDataSeen = 0;
         
         networks().push_back(net);
+        NetworkRecon::invalidateIndex();
     } catch (...) {
         // OOM during push_back - silently ignore
         Serial.println("[DNH] OOM in injectTestNetwork - dropping");
@@ -1444,73 +1454,35 @@ void DoNoHamMode::injectTestNetwork(const uint8_t* bssid, const char* ssid, uint
 void DoNoHamMode::promiscuousCallback(const wifi_promiscuous_pkt_t* pkt, wifi_promiscuous_pkt_type_t type) {
     if (!pkt || !running || dnhBusy) return;
     
-    uint16_t len = pkt->rx_ctrl.sig_len;
-    // ESP32 adds 4 ghost bytes to sig_len
-    if (len > 4) len -= 4;
-    if (len < 24) return;
-    
-    const uint8_t* payload = pkt->payload;
-    uint8_t frameSubtype = (payload[0] >> 4) & 0x0F;
-    int8_t rssi = pkt->rx_ctrl.rssi;
-    
-    switch (type) {
-        case WIFI_PKT_MGMT:
-            if (frameSubtype == 0x08) {  // Beacon
-                handleBeacon(payload, len, rssi);
-            } else if (frameSubtype == 0x05) {  // Probe Response
-                handleProbeResponse(payload, len, rssi);
-            }
-            break;
-        case WIFI_PKT_DATA:
-            handleEAPOL(payload, len, rssi);
-            break;
-        default:
-            break;
-    }
+    // Beacons (PMKID dwell resolution, handshake beacons, channel stats) and
+    // EAPOL-Key frames; probe responses are NetworkRecon's
+    struct DnhSink {
+        void beacon(const FrameDispatch::Beacon& b, int8_t rssi) { handleBeacon(b, rssi); }
+        void eapol(const FrameDispatch::EapolKey& key, const uint8_t* frame, uint16_t len, int8_t rssi) {
+            handleEAPOL(key, frame, len, rssi);
+        }
+    } sink;
+    FrameDispatch::dnh(pkt, type, sink);
 }
 
 // Frame handlers - called from promiscuousCallback
-void DoNoHamMode::handleBeacon(const uint8_t* frame, uint16_t len, int8_t rssi) {
+void DoNoHamMode::handleBeacon(const FrameDispatch::Beacon& b, int8_t rssi) {
     if (!running) return;
     if (dnhBusy) return;  // Skip if update() is processing vectors
     
-    // Beacon frame structure:
-    // [0-1] Frame Control, [2-3] Duration, [4-9] DA, [10-15] SA (BSSID), [16-21] BSSID
-    // [22-23] Seq, [24-35] Timestamp, [36-37] Beacon Interval, [38-39] Capability
-    // [40+] IEs
-    
-    if (len < 40 || len > 2346) return; // Basic validation: IEEE 802.11 beacon frame limits
-    
-    const uint8_t* bssid = frame + 16;
-    
-    // Parse SSID from IE 0
-    char ssid[33] = {0};
-    uint16_t offset = 36;  // Start of IEs (24-byte header + 12-byte fixed params)
-    
-    while (offset + 2 < len) {
-        if (offset + 2 >= len) break; // Extra bounds check
-        uint8_t ieType = frame[offset];
-        uint8_t ieLen = frame[offset + 1];
-        if (offset + 2 + ieLen > len) break;
-        
-        if (ieType == 0 && ieLen > 0 && ieLen <= 32) {
-            memcpy(ssid, frame + offset + 2, ieLen);
-            ssid[ieLen] = 0;
-            break;
-        }
-        offset += 2 + ieLen;
-    }
+    const uint8_t* frame = b.frame;
+    uint16_t len = b.len;
+    const uint8_t* bssid = b.bssid;
+    char ssid[33];
+    b.info.copySSID(ssid);
     
     // Check if this resolves a pending PMKID dwell
     if (state == DNHState::DWELLING && ssid[0] != 0) {
         taskENTER_CRITICAL(&pendingPMKIDMux);
-        if (pendingPMKIDCount > 0) {
-            PendingPMKIDCreate& slot = pendingPMKIDRing[pendingPMKIDRead];
-            if (memcmp(bssid, slot.bssid, 6) == 0) {
-                strncpy(slot.ssid, ssid, 32);
-                slot.ssid[32] = 0;
-                dwellResolved = true;
-            }
+        if (dwellPMKIDValid && memcmp(bssid, dwellPMKID.bssid, 6) == 0) {
+            strncpy(dwellPMKID.ssid, ssid, 32);
+            dwellPMKID.ssid[32] = 0;
+            dwellResolved = true;
         }
         taskEXIT_CRITICAL(&pendingPMKIDMux);
     }
@@ -1540,164 +1512,36 @@ void DoNoHamMode::handleBeacon(const uint8_t* frame, uint16_t len, int8_t rssi)
     }
 }
 
-void DoNoHamMode::handleProbeResponse(const uint8_t* frame, uint16_t len, int8_t rssi) {
-    (void)frame;
-    (void)len;
-    (void)rssi;
-    // NetworkRecon handles probe responses and SSID backfill.
-}
-
-void DoNoHamMode::handleEAPOL(const uint8_t* frame, uint16_t len, int8_t rssi) {
+void DoNoHamMode::handleEAPOL(const FrameDispatch::EapolKey& key, const uint8_t* frame, uint16_t len, int8_t rssi) {
     if (!running) return;
     if (dnhBusy) return;  // Skip if update() is processing vectors
     // No RSSI filter here: M2/M4 frames (client→AP) are often 10-15 dB weaker
     // than M1/M3 (AP→client). Filtering by frame RSSI drops half the handshake.
     // DNH is passive — capture everything audible.
     
-    // Parse 802.11 data frame to find EAPOL
-    // Frame: FC(2) + Duration(2) + Addr1(6) + Addr2(6) + Addr3(6) + Seq(2) = 24 bytes
-    // Then QoS(2) if present, then LLC/SNAP(8), then EAPOL payload
-    
-    if (len < 24 || len > 2346) return; // Basic validation: IEEE 802.11 frame limits
-    
-    // Check To/From DS flags
-    uint8_t toDs = (frame[1] & 0x01);
-    uint8_t fromDs = (frame[1] & 0x02) >> 1;
-    
-    // Extract MACs based on To/From DS
-    const uint8_t* srcMac;
-    const uint8_t* dstMac;
-    const uint8_t* bssid;
-    
-    if (toDs && !fromDs) {
-        // To DS: RA=BSSID, TA=SA
-        dstMac = frame + 4;
-        srcMac = frame + 10;
-        bssid = frame + 4;
-    } else if (!toDs && fromDs) {
-        // From DS: RA=DA, TA=BSSID
-        dstMac = frame + 4;
-        srcMac = frame + 10;
-        bssid = frame + 10;
-    } else if (!toDs && !fromDs) {
-        // IBSS or Direct Link
-        dstMac = frame + 4;
-        srcMac = frame + 10;
-        bssid = frame + 16;
-    } else {
-        // WDS (both set) - skip
-        return;
-    }
-    
-    // Calculate data offset (after 802.11 header)
-    uint16_t offset = 24;
-    
-    // Check for QoS Data (subtype bit 3 set)
-    uint8_t subtype = (frame[0] >> 4) & 0x0F;
-    bool isQoS = (subtype & 0x08) != 0;
-    if (isQoS) offset += 2;
-    
-    // Check for HTC (QoS + Order bit)
-    if (isQoS && (frame[1] & 0x80)) offset += 4;
-    
-    if (offset + 8 > len) return;
-    
-    // Check LLC/SNAP for EAPOL: AA AA 03 00 00 00 88 8E
-    if (frame[offset] != 0xAA || frame[offset+1] != 0xAA ||
-        frame[offset+2] != 0x03 || frame[offset+3] != 0x00 ||
-        frame[offset+4] != 0x00 || frame[offset+5] != 0x00 ||
-        frame[offset+6] != 0x88 || frame[offset+7] != 0x8E) {
-        return;  // Not EAPOL
-    }
-    
-    // EAPOL payload starts after LLC/SNAP
-    const uint8_t* eapol = frame + offset + 8;
-    uint16_t eapolLen = len - offset - 8;
-    
-    if (eapolLen < 4) return;
-    
-    // EAPOL: version(1) + type(1) + length(2)
-    uint8_t eapolType = eapol[1];
-    if (eapolType != 3) return;  // EAPOL-Key only
-    
-    if (eapolLen < 99) return;  // Minimum for key frame
-    
-    // EAPOL-Key: descriptor_type(1) @ 4, key_info(2) @ 5-6
-    uint16_t keyInfo = (eapol[5] << 8) | eapol[6];
-    uint8_t install = (keyInfo >> 6) & 0x01;
-    uint8_t keyAck = (keyInfo >> 7) & 0x01;
-    uint8_t keyMic = (keyInfo >> 8) & 0x01;
-    uint8_t secure = (keyInfo >> 9) & 0x01;
-    
-    // Identify message: M1 = KeyAck, no MIC; M2 = MIC, not secure; M3 = KeyAck+MIC+Install; M4 = MIC+Secure
-    uint8_t messageNum = 0;
-    if (keyAck && !keyMic) messageNum = 1;
-    else if (!keyAck && keyMic && !secure) messageNum = 2;
-    else if (keyAck && keyMic && install) messageNum = 3;
-    else if (!keyAck && keyMic && secure) messageNum = 4;
-    
-    if (messageNum == 0) return;  // Unknown message type
-    
-    // Determine BSSID and station based on message direction
-    // M1/M3 = AP->Station, M2/M4 = Station->AP
-    uint8_t apBssid[6], station[6];
-    if (messageNum == 1 || messageNum == 3) {
-        memcpy(apBssid, srcMac, 6);
-        memcpy(station, dstMac, 6);
-    } else {
-        memcpy(apBssid, dstMac, 6);
-        memcpy(station, srcMac, 6);
-    }
+    // M1/M3 = AP->Station, M2/M4 = Station->AP (resolved by FrameDispatch)
+    uint8_t messageNum = key.messageNum;
+    const uint8_t* eapol = key.eapol;
+    uint16_t eapolLen = key.eapolLen;
+    const uint8_t* apBssid = key.bssid;
+    const uint8_t* station = key.station;
     
     // ========== PMKID EXTRACTION FROM M1 ==========
-    if (messageNum == 1) {
-        // Descriptor type 0x02 = RSN (WPA2/WPA3), 0xFE = WPA1
-        uint8_t descriptorType = eapol[4];
-        if (descriptorType == 0x02 && eapolLen >= 121) {  // WPA2/3 only
-            uint16_t keyDataLen = (eapol[97] << 8) | eapol[98];
-            if (keyDataLen >= 22 && eapolLen >= 99 + keyDataLen) {
-                const uint8_t* keyData = eapol + 99;
-                
-                // Search for PMKID KDE: dd 14 00 0f ac 04 [16-byte PMKID]
-                for (uint16_t i = 0; i + 22 <= keyDataLen; i++) {
-                    if (keyData[i] == 0xdd && keyData[i+1] == 0x14 &&
-                        keyData[i+2] == 0x00 && keyData[i+3] == 0x0f &&
-                        keyData[i+4] == 0xac && keyData[i+5] == 0x04) {
-                        
-                        const uint8_t* pmkidData = keyData + i + 6;
-                        
-                        // Skip all-zero PMKIDs (invalid)
-                        bool allZeros = true;
-                        for (int z = 0; z < 16; z++) {
-                            if (pmkidData[z] != 0) { allZeros = false; break; }
-                        }
-                        if (allZeros) {
-                            break;
-                        }
-                        
-                        // Queue PMKID for creation in main thread (ring buffer)
-                        taskENTER_CRITICAL(&pendingPMKIDMux);
-                        if (pendingPMKIDCount < PENDING_PMKID_SLOTS) {
-                            PendingPMKIDCreate& slot = pendingPMKIDRing[pendingPMKIDWrite];
-                            memcpy(slot.bssid, apBssid, 6);
-                            memcpy(slot.station, station, 6);
-                            memcpy(slot.pmkid, pmkidData, 16);
-                            slot.channel = currentChannel;
-                            
-                            // BUG FIX: Don't call findNetwork() from callback - race condition!
-                            // SSID lookup deferred to update() where it's safe
-                            // Clear SSID to trigger dwell/lookup in update()
-                            slot.ssid[0] = 0;
-                            
-                            pendingPMKIDWrite = (pendingPMKIDWrite + 1) % PENDING_PMKID_SLOTS;
-                            pendingPMKIDCount++;
-                        }
-                        taskEXIT_CRITICAL(&pendingPMKIDMux);
-                        break;  // Found PMKID, stop searching
-                    }
-                }
-            }
-        }
+    // RSN (WPA2/WPA3) M1 only; all-zero PMKIDs are skipped by the parser
+    const uint8_t* pmkidData = key.pmkid;
+    if (pmkidData) {
+        // Queue PMKID for creation in main thread (full ring drops + counts)
+        pendingPMKIDs.emplace([&](PendingPMKIDCreate& slot) {
+            memcpy(slot.bssid, apBssid, 6);
+            memcpy(slot.station, station, 6);
+            memcpy(slot.pmkid, pmkidData, 16);
+            slot.channel = currentChannel;
+            
+            // BUG FIX: Don't call findNetwork() from callback - race condition!
+            // SSID lookup deferred to update() where it's safe
+            // Clear SSID to trigger dwell/lookup in update()
+            slot.ssid[0] = 0;
+        });
     }
     
     // ========== HANDSHAKE FRAME CAPTURE (M1-M4) ==========
@@ -1724,12 +1568,7 @@ void DoNoHamMode::handleEAPOL(const uint8_t* frame, uint16_t len, int8_t rssi) {
                 // Init the slot for this handshake
                 memcpy(pendingHandshakePool[idx].bssid, apBssid, 6);
                 memcpy(pendingHandshakePool[idx].station, station, 6);
-                pendingHandshakePool[idx].messageNum = messageNum;  // DEPRECATED
-                pendingHandshakePool[idx].capturedMask = 0;
-                for (int f = 0; f < 4; f++) {
-                    pendingHandshakePool[idx].frames[f].len = 0;
-                    pendingHandshakePool[idx].frames[f].fullFrameLen = 0;
-                }
+                pendingHandshakePool[idx].frames.clear();
                 break;
             }
         }
@@ -1740,19 +1579,11 @@ void DoNoHamMode::handleEAPOL(const uint8_t* frame, uint16_t len, int8_t rssi) {
         uint8_t frameIdx = messageNum - 1;
         if (frameIdx < 4) {
             PendingHandshakeFrame& slotRef = pendingHandshakePool[slot];
-            // EAPOL payload for hashcat 22000
-            uint16_t copyLen = min((uint16_t)512, eapolLen);
-            memcpy(slotRef.frames[frameIdx].data, eapol, copyLen);
-            slotRef.frames[frameIdx].len = copyLen;
-            
-            // Full 802.11 frame for PCAP export (radiotap + WPA-SEC compatibility)
-            uint16_t fullCopyLen = min((uint16_t)300, len);
-            memcpy(slotRef.frames[frameIdx].fullFrame, frame, fullCopyLen);
-            slotRef.frames[frameIdx].fullFrameLen = fullCopyLen;
-            slotRef.frames[frameIdx].rssi = rssi;
-            
-            slotRef.capturedMask |= (1 << frameIdx);
-            pendingHandshakeUsed[slot] = true;
+            // EAPOL payload for hashcat 22000 + full 802.11 frame for PCAP
+            // export (radiotap + WPA-SEC compatibility)
+            if (slotRef.frames.store(frameIdx, eapol, eapolLen, frame, len, millis(), rssi)) {
+                pendingHandshakeUsed[slot] = true;
+            }
         }
     }
     taskEXIT_CRITICAL(&pendingHandshakeMux);
@@ -8,10 +8,12 @@
 #include "oink.h"  // Reuse DetectedNetwork, CapturedPMKID, CapturedHandshake
 #include "../core/network_recon.h"
 
+namespace FrameDispatch { struct Beacon; struct EapolKey; }
+
 // DNH-specific constants
 static const size_t DNH_MAX_NETWORKS = 100;
 static const size_t DNH_MAX_PMKIDS = 50;
-static const size_t DNH_MAX_HANDSHAKES = 25;
+static const size_t DNH_MAX_HANDSHAKES = 100;  // ~790 bytes each (packed frames)
 static const uint32_t DNH_STALE_TIMEOUT = 30000;  // 30s
 static const uint16_t DNH_HOP_INTERVAL = 200;     // Legacy default (now adaptive)
 static const uint16_t DNH_DWELL_TIME = 300;       // 300ms dwell for SSID
@@ -71,14 +73,14 @@ public:
     static size_t getNetworkCount() { return NetworkRecon::getNetworkCount(); }
     static size_t getPMKIDCount() { return pmkids.size(); }
     static size_t getHandshakeCount() { return handshakes.size(); }
+    static RingStats getPendingPMKIDStats();  // Callback -> update() PMKID queue
     
     // Packet callback for NetworkRecon
     static void promiscuousCallback(const wifi_promiscuous_pkt_t* pkt, wifi_promiscuous_pkt_type_t type);
     
     // Frame handlers (called from promiscuousCallback)
-    static void handleBeacon(const uint8_t* frame, uint16_t len, int8_t rssi);
-    static void handleProbeResponse(const uint8_t* frame, uint16_t len, int8_t rssi);
-    static void handleEAPOL(const uint8_t* frame, uint16_t len, int8_t rssi);
+    static void handleBeacon(const FrameDispatch::Beacon& b, int8_t rssi);
+    static void handleEAPOL(const FrameDispatch::EapolKey& key, const uint8_t* frame, uint16_t len, int8_t rssi);
     
     // Stress test injection (no RF)
     static void injectTestNetwork(const uint8_t* bssid, const char* ssid, uint8_t channel, int8_t rssi, wifi_auth_mode_t authmode, bool hasPMF);
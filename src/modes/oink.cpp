@@ -12,6 +12,12 @@
 #include "../core/sd_layout.h"
 #include "../core/xp.h"
 #include "../core/heap_policy.h"
+#include "../core/ie_parser.h"
+#include "../core/eapol_parser.h"
+#include "../core/frame_dispatch.h"
+#include "../core/mpsc_ring.h"
+#include "../core/capture_journal.h"
+#include "../core/capture_catalog.h"
 #include "../ui/display.h"
 #include "../piglet/mood.h"
 #include "../piglet/avatar.h"
@@ -80,43 +86,20 @@ static void onNewNetworkDiscovered(wifi_auth_mode_t authmode, bool isHidden,
     }
 }
 
-// Pending handshake/PMKID creation (callback queues, update() does push_back)
-// This avoids vector reallocation in callback context
-struct PendingHandshakeFrame {
+// Pending handshake creation (callback queues, update() does push_back)
+// This avoids vector reallocation in callback context.
+// One event per EAPOL frame for a handshake not yet in the vector; update()
+// merges them. Cells are filled in place so the frame never lands on the
+// WiFi task stack. 8 events (~4.8KB .bss) covers two full M1-M4 bursts.
+struct PendingEapolFrame {
     uint8_t bssid[6];
     uint8_t station[6];
-    uint8_t messageNum;        // DEPRECATED - used only for logging now
-    EAPOLFrame frames[4];      // Store all 4 EAPOL frames (M1-M4)
-    uint8_t capturedMask;      // Bitmask: bit0=M1, bit1=M2, bit2=M3, bit3=M4
-    uint8_t pmkid[16];         // If M1, may contain PMKID
-    bool hasPMKID;
+    uint8_t frameIdx;          // 0-3 for M1-M4
+    EapolFrameSlot frame;      // Holds frameIdx only
 };
 
-// Circular buffer for pending handshake frames (4 slots to handle rapid EAPOL bursts)
-// STATIC POOL: Pre-allocated to avoid malloc in WiFi callback context (heap fragmentation risk)
-// WARNING: Each PendingHandshakeFrame is ~3.3KB (contains 4x EAPOLFrame @ 822 bytes each)
-// Total static pool: 4 * 3.3KB = ~13KB permanently in .bss - reduces heap even when idle!
-static const uint8_t PENDING_HS_SLOTS = 4;
-static PendingHandshakeFrame pendingHsPool[PENDING_HS_SLOTS];  // Static pool - no heap ops in callback
-// #region agent log
-// [DEBUG] H1: This static pool uses ~13KB of RAM - logged at compile time in .bss
-// Size info logged in init() below
-// #endregion
-static PendingHandshakeFrame* pendingHandshakes[PENDING_HS_SLOTS] = {nullptr, nullptr, nullptr, nullptr};
-static std::atomic<uint8_t> pendingHsWrite{0};
-static std::atomic<uint8_t> pendingHsRead{0};
-static std::atomic<bool> pendingHsBusy[PENDING_HS_SLOTS] = {
-    ATOMIC_VAR_INIT(false),
-    ATOMIC_VAR_INIT(false),
-    ATOMIC_VAR_INIT(false),
-    ATOMIC_VAR_INIT(false)
-};
-static std::atomic<bool> pendingHsAllocated[PENDING_HS_SLOTS] = {  // Track which pool slots are in use
-    ATOMIC_VAR_INIT(false),
-    ATOMIC_VAR_INIT(false),
-    ATOMIC_VAR_INIT(false),
-    ATOMIC_VAR_INIT(false)
-};
+static const uint16_t PENDING_HS_SLOTS = 8;
+static MpscRing<PendingEapolFrame, PENDING_HS_SLOTS> pendingHsFrames;
 
 struct PendingPMKIDCreate {
     uint8_t bssid[6];
@@ -132,6 +115,7 @@ static PendingPMKIDCreate pendingPMKIDCreate;
 
 // Static members
 bool OinkMode::running = false;
+uint8_t OinkMode::startPhase = 0;
 bool OinkMode::scanning = false;
 bool OinkMode::deauthing = false;
 bool OinkMode::channelHopping = true;
@@ -165,7 +149,7 @@ uint8_t OinkMode::filteredCacheIndex = 0;
 
 // Memory limits to prevent OOM
 const size_t MAX_NETWORKS = 200;       // Max tracked networks
-const size_t MAX_HANDSHAKES = 50;      // Max handshakes (each can be large)
+const size_t MAX_HANDSHAKES = 200;     // Max handshakes (~790 bytes each, packed frames)
 const size_t MAX_PMKIDS = 50;          // Max PMKIDs (smaller than handshakes)
 const uint16_t MAX_BEACON_SIZE = 1500; // IEEE 802.11 practical limit (protect against oversized/malformed frames)
 
@@ -292,11 +276,11 @@ static char lastPwnedSSID[33] = "";
 void OinkMode::init() {
     // #region agent log
     // [DEBUG] H1: Log static pool size to confirm ~13KB allocation
-    Serial.printf("[DBG-OINK] pendingHsPool size: %u bytes (%u slots x %u each)\n",
-                  (unsigned)(sizeof(pendingHsPool)), 
+    Serial.printf("[DBG-OINK] pendingHsFrames size: %u bytes (%u slots x %u each)\n",
+                  (unsigned)(sizeof(pendingHsFrames)),
                   (unsigned)PENDING_HS_SLOTS,
-                  (unsigned)sizeof(PendingHandshakeFrame));
-    Serial.printf("[DBG-OINK] EAPOLFrame size: %u bytes\n", (unsigned)sizeof(EAPOLFrame));
+                  (unsigned)sizeof(PendingEapolFrame));
+    Serial.printf("[DBG-OINK] CapturedHandshake size: %u bytes\n", (unsigned)sizeof(CapturedHandshake));
     Serial.printf("[DBG-OINK] Heap before init: free=%u largest=%u\n",
                   (unsigned)ESP.getFreeHeap(),
                   (unsigned)heap_caps_get_largest_free_block(MALLOC_CAP_8BIT));
@@ -316,14 +300,8 @@ void OinkMode::init() {
     lastBoredUpdate = 0;
     boredStateReset = true;
     
-    // Reset static pool tracking (no heap ops - pool is pre-allocated)
-    for (int i = 0; i < PENDING_HS_SLOTS; i++) {
-        pendingHandshakes[i] = nullptr;
-        pendingHsBusy[i] = false;
-        pendingHsAllocated[i] = false;
-    }
-    pendingHsWrite = 0;
-    pendingHsRead = 0;
+    // Reset pending EAPOL queue (callback not attached yet)
+    pendingHsFrames.reset();
     
     // Free per-handshake beacon memory
     for (auto& hs : handshakes) {
@@ -372,19 +350,40 @@ void OinkMode::init() {
 }
 
 void OinkMode::start() {
-    if (running) return;
-    
-    Serial.printf("[OINK] Starting... free=%u largest=%u\n",
-                  ESP.getFreeHeap(), heap_caps_get_largest_free_block(MALLOC_CAP_8BIT));
+    while (!startStep()) {}
+}
+
+// Phases: recon + WSL bypasser, then the capture journal (SD open, and a
+// replay/compaction when the last sessions left a large one), then the
+// callbacks. Each gets a frame of its own when called from the mode switcher.
+bool OinkMode::startStep() {
+    if (running) return true;
     
-    // Ensure NetworkRecon is running (handles WiFi promiscuous mode)
-    if (!NetworkRecon::isRunning()) {
-        NetworkRecon::start();
+    switch (startPhase) {
+        case 0:
+            Serial.printf("[OINK] Starting... free=%u largest=%u\n",
+                          ESP.getFreeHeap(), heap_caps_get_largest_free_block(MALLOC_CAP_8BIT));
+            
+            // Ensure NetworkRecon is running (handles WiFi promiscuous mode)
+            if (!NetworkRecon::isRunning()) {
+                NetworkRecon::start();
+            }
+            
+            // Initialize WSL bypasser for deauth frame injection
+            WSLBypasser::init();
+            startPhase = 1;
+            return false;
+            
+        case 1:
+            // Journal captures to SD as they arrive (before the callback can queue any)
+            CaptureJournal::begin();
+            startPhase = 2;
+            return false;
+            
+        default:
+            break;
     }
     
-    // Initialize WSL bypasser for deauth frame injection
-    WSLBypasser::init();
-    
     // Register our packet callback for EAPOL/handshake capture
     NetworkRecon::setPacketCallback(promiscuousCallback);
     
@@ -392,6 +391,7 @@ void OinkMode::start() {
     NetworkRecon::setNewNetworkCallback(onNewNetworkDiscovered);
     
     running = true;
+    startPhase = 0;
     scanning = true;
     channelHopping = true;
     lastHopTime = millis();
@@ -412,10 +412,16 @@ void OinkMode::start() {
     Display::setWiFiStatus(true);
     
     Serial.printf("[OINK] Started. Networks available: %d\n", NetworkRecon::getNetworkCount());
+    return true;
 }
 
 void OinkMode::stop() {
-    if (!running) return;
+    if (!running) {
+        // Start cut short by a mode switch: the journal may already be open
+        if (startPhase > 1) CaptureJournal::end();
+        startPhase = 0;
+        return;
+    }
     
     Serial.println("[OINK] Stopping...");
     
@@ -443,6 +449,12 @@ void OinkMode::stop() {
     beaconCaptured = false;
     clearTargetClients();
     
+    // Journal whatever the last updates didn't get to, then close it
+    for (int i = 0; i < 32 && !CaptureJournal::sweep(handshakes, pmkids); i++) {
+        delay(5);  // Let the writer drain the ring
+    }
+    CaptureJournal::end();
+    
     // Free per-handshake beacon memory to prevent leaks on repeated start/stop
     for (auto& hs : handshakes) {
         if (hs.beaconData) {
@@ -457,14 +469,8 @@ void OinkMode::stop() {
     pmkids.clear();
     pmkids.shrink_to_fit();
     
-    // Reset static pool tracking (no heap ops - pool is pre-allocated)
-    for (int i = 0; i < PENDING_HS_SLOTS; i++) {
-        pendingHandshakes[i] = nullptr;
-        pendingHsBusy[i] = false;
-        pendingHsAllocated[i] = false;
-    }
-    pendingHsWrite = 0;
-    pendingHsRead = 0;
+    // Discard queued EAPOL frames (callback already detached)
+    while (pendingHsFrames.consume([](const PendingEapolFrame&) {})) {}
     
     running = false;
     Mood::setDialogueLock(false);
@@ -595,89 +601,40 @@ void OinkMode::update() {
         autoSaveCheck();
     }
     
-    // Process pending handshake creation from circular buffer (callback queued, we do push_back here)
-    while (pendingHsRead != pendingHsWrite) {
-        // Get slot from circular buffer
-        uint8_t slot = pendingHsRead;
-        if (pendingHsBusy[slot] || !pendingHandshakes[slot]) {
-            break;  // Slot still being written by callback or not allocated, wait for next cycle
+    // Process pending handshake frames (callback queued, we do push_back here)
+    while (pendingHsFrames.consume([](const PendingEapolFrame& ev) {
+        // Create or find handshake entry in main thread context
+        int idx = findOrCreateHandshakeSafe(ev.bssid, ev.station);
+        if (idx < 0) return;
+        CapturedHandshake& hs = handshakes[idx];
+        
+        // EAPOL payload + full 802.11 frame, unless already captured
+        if (hs.mergeFrame(ev.frame, ev.frameIdx)) {
+            hs.lastSeen = millis();
         }
         
-        // Create or find handshake entry in main thread context
-        int idx = findOrCreateHandshakeSafe(pendingHandshakes[slot]->bssid, pendingHandshakes[slot]->station);
-        if (idx >= 0) {
-            CapturedHandshake& hs = handshakes[idx];
-            
-            // Process ALL queued frames (M1-M4) from capturedMask
-            for (int msgIdx = 0; msgIdx < 4; msgIdx++) {
-                if (pendingHandshakes[slot]->capturedMask & (1 << msgIdx)) {
-                    // Frame is present in the queued data
-                    if (hs.frames[msgIdx].len == 0) {  // Not already captured
-                        uint16_t copyLen = pendingHandshakes[slot]->frames[msgIdx].len;
-                        if (copyLen > 0 && copyLen <= 512) {
-                            // EAPOL payload
-                            memcpy(hs.frames[msgIdx].data, pendingHandshakes[slot]->frames[msgIdx].data, copyLen);
-                            hs.frames[msgIdx].len = copyLen;
-                            hs.frames[msgIdx].messageNum = msgIdx + 1;
-                            hs.frames[msgIdx].timestamp = millis();
-                            
-                            // Full 802.11 frame for PCAP
-                            uint16_t fullLen = pendingHandshakes[slot]->frames[msgIdx].fullFrameLen;
-                            if (fullLen > 0 && fullLen <= 300) {
-                                memcpy(hs.frames[msgIdx].fullFrame, pendingHandshakes[slot]->frames[msgIdx].fullFrame, fullLen);
-                                hs.frames[msgIdx].fullFrameLen = fullLen;
-                                hs.frames[msgIdx].rssi = pendingHandshakes[slot]->frames[msgIdx].rssi;
-                            }
-                            
-                            hs.capturedMask |= (1 << msgIdx);
-                            hs.lastSeen = millis();
-                        }
-                    }
-                }
-            }
-            
-            // Get SSID for this BSSID
+        // Get SSID for this BSSID
+        if (hs.ssid[0] == 0) {
             for (const auto& net : networks()) {
-                if (memcmp(net.bssid, pendingHandshakes[slot]->bssid, 6) == 0) {
+                if (memcmp(net.bssid, ev.bssid, 6) == 0) {
                     strncpy(hs.ssid, net.ssid, 32);
                     hs.ssid[32] = 0;
                     break;
                 }
             }
-            
-            // Check if handshake is now complete
-            if (hs.isComplete() && !hs.saved) {
-                pendingHandshakeComplete = true;
-                strncpy(pendingHandshakeSSID, hs.ssid, 32);
-                pendingHandshakeSSID[32] = 0;
-                WarhogMode::markCaptured(hs.bssid);
-                
-                // Auto-save complete handshake (safe here - main thread context)
-                autoSaveCheck();
-            }
-            
-            // Handle PMKID from M1 if present
-            if (pendingHandshakes[slot]->hasPMKID) {
-                int pIdx = findOrCreatePMKIDSafe(pendingHandshakes[slot]->bssid, pendingHandshakes[slot]->station);
-                if (pIdx >= 0 && !pmkids[pIdx].saved) {
-                    memcpy(pmkids[pIdx].pmkid, pendingHandshakes[slot]->pmkid, 16);
-                    // Get SSID
-                    for (const auto& net : networks()) {
-                        if (memcmp(net.bssid, pendingHandshakes[slot]->bssid, 6) == 0) {
-                            strncpy(pmkids[pIdx].ssid, net.ssid, 32);
-                            pmkids[pIdx].ssid[32] = 0;
-                            break;
-                        }
-                    }
-                }
-            }
         }
         
-        // Release slot back to static pool (no heap ops), advance read pointer
-        pendingHandshakes[slot] = nullptr;
-        pendingHsAllocated[slot] = false;
-        pendingHsRead = (pendingHsRead + 1) % PENDING_HS_SLOTS;
-    }
+        // Check if handshake is now complete
+        if (hs.isComplete() && !hs.saved) {
+            pendingHandshakeComplete = true;
+            strncpy(pendingHandshakeSSID, hs.ssid, 32);
+            pendingHandshakeSSID[32] = 0;
+            WarhogMode::markCaptured(hs.bssid);
+            
+            // Auto-save complete handshake (safe here - main thread context)
+            autoSaveCheck();
+        }
+    })) {}
     
     // Process pending PMKID creation (callback queued, we do push_back here)
     if (pendingPMKIDCreateReady && !pendingPMKIDCreateBusy) {
@@ -688,6 +645,7 @@ void OinkMode::update() {
         if (idx >= 0 && !pmkids[idx].saved) {
             memcpy(pmkids[idx].pmkid, pendingPMKIDCreate.pmkid, 16);
             pmkids[idx].timestamp = millis();
+            pmkids[idx].journaled = 0;
             
             // SSID lookup: try callback value first, then lookup from networks
             if (pendingPMKIDCreate.ssid[0] != 0) {
@@ -710,6 +668,9 @@ void OinkMode::update() {
         pendingPMKIDCreateBusy = false;
     }
     
+    // Journal what just left the callback before anything else can lose it
+    CaptureJournal::sweep(handshakes, pmkids);
+    
     // ============ End Deferred Event Processing ============
     
     // RELEASE LOCK EARLY - state machine doesn't need exclusive vector access
@@ -1333,6 +1294,7 @@ void OinkMode::update() {
             networks().erase(networks().begin());
             emergencyErased++;
         }
+        if (emergencyErased > 0) NetworkRecon::invalidateIndex();
         
         // Revalidate target by BSSID instead of blanket reset
         if (emergencyErased > 0 && targetIndex >= 0) {
@@ -1485,12 +1447,7 @@ void OinkMode::promiscuousCallback(const wifi_promiscuous_pkt_t* pkt, wifi_promi
     if (!running) return;
     if (oinkBusy) return;
     
-    uint16_t len = pkt->rx_ctrl.sig_len;
-    int8_t rssi = pkt->rx_ctrl.rssi;
-    
-    // ESP32 adds 4 ghost bytes to sig_len
-    if (len > 4) len -= 4;
-    if (len < 24) return;
+    if (FrameDispatch::frameLen(pkt) < FrameDispatch::kMinFrameLen) return;
     
     packetCount++;
     
@@ -1507,34 +1464,26 @@ void OinkMode::promiscuousCallback(const wifi_promiscuous_pkt_t* pkt, wifi_promi
     }
     // #endregion
     
-    const uint8_t* payload = pkt->payload;
-    uint8_t frameSubtype = (payload[0] >> 4) & 0x0F;
-    
-    switch (type) {
-        case WIFI_PKT_MGMT:
-            if (frameSubtype == 0x08) {  // Beacon
-                // Only capture beacon for target AP (PCAP needs it)
-                processBeacon(payload, len, rssi);
-            }
-            // Note: Probe responses handled by NetworkRecon for SSID reveal
-            break;
-            
-        case WIFI_PKT_DATA:
-            // EAPOL/handshake capture (OINK's main job)
-            processDataFrame(payload, len, rssi);
-            break;
-            
-        default:
-            break;
-    }
+    // Beacons: only the target AP's (PCAP needs it); probe responses are
+    // NetworkRecon's. Data frames: client tracking + EAPOL/handshake capture.
+    struct OinkSink {
+        void beacon(const uint8_t* frame, uint16_t len, int8_t rssi) {
+            processBeacon(frame, len, rssi);
+        }
+        void client(const uint8_t* bssid, const uint8_t* clientMac, int8_t rssi) {
+            trackTargetClient(bssid, clientMac, rssi);
+        }
+        void eapol(const FrameDispatch::EapolKey& key, const uint8_t* frame, uint16_t len, int8_t rssi) {
+            processEAPOL(key, frame, len, rssi);
+        }
+    } sink;
+    FrameDispatch::oink(pkt, type, sink);
 }
 
 void OinkMode::processBeacon(const uint8_t* payload, uint16_t len, int8_t rssi) {
     // NOTE: Network discovery is now handled by NetworkRecon
     // This function only captures beacon for target AP (needed for PCAP/hashcat)
     
-    if (len < 36) return;
-    
     const uint8_t* bssid = payload + 16;
     
     // Capture beacon for target AP only
@@ -1589,30 +1538,21 @@ void OinkMode::processProbeResponse(const uint8_t* payload, uint16_t len, int8_t
     
     // If network has hidden SSID, try to extract from probe response
     if (networks()[idx].ssid[0] == 0 || networks()[idx].isHidden) {
-        uint16_t offset = 36;
-        while (offset + 2 < len) {
-            uint8_t id = payload[offset];
-            uint8_t ieLen = payload[offset + 1];
-            
-            if (offset + 2 + ieLen > len) break;
+        IEParser::BeaconInfo info;
+        IEParser::parse(payload, len, info);
+        if (info.ssidPresent && !info.hidden) {
+            memcpy(networks()[idx].ssid, info.ssid, info.ssidLen);
+            networks()[idx].ssid[info.ssidLen] = 0;
+            networks()[idx].isHidden = false;
             
-            if (id == 0 && ieLen > 0 && ieLen <= 32) {
-                memcpy(networks()[idx].ssid, payload + offset + 2, ieLen);
-                networks()[idx].ssid[ieLen] = 0;
-                networks()[idx].isHidden = false;
-                
-                // DEFERRED: Queue mood event for main thread
-                if (!pendingNewNetwork) {
-                    strncpy(pendingNetworkSSID, networks()[idx].ssid, 32);
-                    pendingNetworkSSID[32] = 0;
-                    pendingNetworkRSSI = rssi;
-                    pendingNetworkChannel = networks()[idx].channel;
-                    pendingNewNetwork = true;
-                }
-                break;
+            // DEFERRED: Queue mood event for main thread
+            if (!pendingNewNetwork) {
+                strncpy(pendingNetworkSSID, networks()[idx].ssid, 32);
+                pendingNetworkSSID[32] = 0;
+                pendingNetworkRSSI = rssi;
+                pendingNetworkChannel = networks()[idx].channel;
+                pendingNewNetwork = true;
             }
-            
-            offset += 2 + ieLen;
         }
     }
     
@@ -1620,112 +1560,14 @@ void OinkMode::processProbeResponse(const uint8_t* payload, uint16_t len, int8_t
     NetworkRecon::exitCritical();
 }
 
-void OinkMode::processDataFrame(const uint8_t* payload, uint16_t len, int8_t rssi) {
-    if (len < 28) return;
-    
-    // Extract addresses based on ToDS/FromDS flags
-    uint8_t toDs = (payload[1] & 0x01);
-    uint8_t fromDs = (payload[1] & 0x02) >> 1;
-    
-    const uint8_t* bssid = nullptr;
-    const uint8_t* clientMac = nullptr;
-    
-    // Address layout depends on ToDS/FromDS:
-    // ToDS=0, FromDS=1: Addr1=DA(client), Addr2=BSSID, Addr3=SA
-    // ToDS=1, FromDS=0: Addr1=BSSID, Addr2=SA(client), Addr3=DA
-    if (!toDs && fromDs) {
-        // From AP to client
-        bssid = payload + 10;      // Addr2
-        clientMac = payload + 4;   // Addr1 (destination = client)
-    } else if (toDs && !fromDs) {
-        // From client to AP
-        bssid = payload + 4;       // Addr1
-        clientMac = payload + 10;  // Addr2 (source = client)
-    }
-    
-    // Track client if we identified both
-    if (bssid && clientMac) {
-        // Don't track broadcast/multicast
-        if ((clientMac[0] & 0x01) == 0) {
-            trackTargetClient(bssid, clientMac, rssi);
-        }
-    }
-    
-    // Check for EAPOL (LLC/SNAP header: AA AA 03 00 00 00 88 8E)
-    // Data starts after 802.11 header (24 bytes for data frames)
-    // May have QoS (2 bytes) and/or HTC (4 bytes)
-    
-    uint16_t offset = 24;
-    
-    // Adjust offset for address 4 if needed
-    if (toDs && fromDs) offset += 6;
-    
-    // Check for QoS Data frame (subtype has bit 3 set = 0x08, 0x09, etc.)
-    // Frame control byte 0: bits 4-7 = subtype, bit 3 of subtype = QoS
-    uint8_t subtype = (payload[0] >> 4) & 0x0F;
-    bool isQoS = (subtype & 0x08) != 0;
-    if (isQoS) {
-        offset += 2;  // QoS control field
-    }
-    
-    // Check for HTC field (High Throughput Control, +HTC/Order bit)
-    // Only present in QoS data frames when Order bit (bit 7 of FC byte 1) is set
-    if (isQoS && (payload[1] & 0x80)) {
-        offset += 4;  // HTC field
-    }
-    
-    if (offset + 8 > len) return;
-    
-    // Check LLC/SNAP header for EAPOL
-    if (payload[offset] == 0xAA && payload[offset+1] == 0xAA &&
-        payload[offset+2] == 0x03 && payload[offset+3] == 0x00 &&
-        payload[offset+4] == 0x00 && payload[offset+5] == 0x00 &&
-        payload[offset+6] == 0x88 && payload[offset+7] == 0x8E) {
-        
-        // This is EAPOL!
-        const uint8_t* srcMac = payload + 10;  // TA
-        const uint8_t* dstMac = payload + 4;   // RA
-        
-        processEAPOL(payload + offset + 8, len - offset - 8, srcMac, dstMac, payload, len, rssi);
-    }
-}
-
-void OinkMode::processEAPOL(const uint8_t* payload, uint16_t len, 
-                             const uint8_t* srcMac, const uint8_t* dstMac,
+void OinkMode::processEAPOL(const FrameDispatch::EapolKey& key,
                              const uint8_t* fullFrame, uint16_t fullFrameLen, int8_t rssi) {
-    if (len < 4) return;
-    
-    // EAPOL: version(1) + type(1) + length(2) + descriptor(...)
-    uint8_t type = payload[1];
-    
-    if (type != 3) return;  // Only interested in EAPOL-Key
-    
-    if (len < 99) return;  // Minimum EAPOL-Key frame
-    
-    // Key info at offset 5-6
-    uint16_t keyInfo = (payload[5] << 8) | payload[6];
-    uint8_t install = (keyInfo >> 6) & 0x01;
-    uint8_t keyAck = (keyInfo >> 7) & 0x01;
-    uint8_t keyMic = (keyInfo >> 8) & 0x01;
-    uint8_t secure = (keyInfo >> 9) & 0x01;
-    
-    uint8_t messageNum = 0;
-    if (keyAck && !keyMic) messageNum = 1;
-    else if (!keyAck && keyMic && !secure) messageNum = 2;  // M2: has MIC, not secure (M4 is secure)
-    else if (keyAck && keyMic && install) messageNum = 3;
-    else if (!keyAck && keyMic && secure) messageNum = 4;
-    
-    if (messageNum == 0) return;
-    
-    // Determine which is AP (sender of M1/M3) and station
-    uint8_t bssid[6], station[6];
-    if (messageNum == 1 || messageNum == 3) {
-        memcpy(bssid, srcMac, 6);
-        memcpy(station, dstMac, 6);
-    } else {
-        memcpy(bssid, dstMac, 6);
-        memcpy(station, srcMac, 6);
-    }
+    // EAPOL-Key M1-M4, AP (sender of M1/M3) and station already resolved
+    uint8_t messageNum = key.messageNum;
+    const uint8_t* payload = key.eapol;
+    uint16_t len = key.eapolLen;
+    const uint8_t* bssid = key.bssid;
+    const uint8_t* station = key.station;
     
     // M1 = AP initiating handshake = client reconnected after deauth!
     // If we're deauthing this target, our deauth worked!
@@ -1743,110 +1585,77 @@ void OinkMode::processEAPOL(const uint8_t* payload, uint16_t len,
     }
     
     // ========== PMKID EXTRACTION FROM M1 ==========
-    // PMKID is in Key Data field of M1 when AP supports it (WPA2/WPA3 only)
-    // EAPOL-Key frame: descriptor_type(1) @ offset 4, key_data_length(2) @ offset 97-98, key_data @ offset 99
-    // Key Data contains RSN IE with PMKID: dd 14 00 0f ac 04 [16-byte PMKID]
-    // Only RSN (descriptor type 0x02) has PMKID - WPA1 (0xFE) does not
-    uint8_t descriptorType = payload[4];
-    if (messageNum == 1 && descriptorType == 0x02 && len >= 121) {  // RSN + 99 + 22 bytes minimum
-        uint16_t keyDataLen = (payload[97] << 8) | payload[98];
-        
-        // PMKID Key Data is exactly 22 bytes: dd(1) + len(1) + OUI(3) + type(1) + PMKID(16)
-        if (keyDataLen >= 22 && len >= 99 + keyDataLen) {
-            const uint8_t* keyData = payload + 99;
+    // PMKID KDE in the Key Data of an RSN M1 (WPA1 descriptors never carry one)
+    const uint8_t* pmkidData = key.pmkid;
+    if (pmkidData) {
+        // Check if we already have this PMKID (lookup only - no push_back)
+        int pmkIdx = findOrCreatePMKID(bssid, station);
+        if (pmkIdx >= 0) {
+            // Protect PMKID vector access with spinlock
+            NetworkRecon::enterCritical();
             
-            // Look for PMKID KDE: dd 14 00 0f ac 04 (vendor IE, IEEE OUI, PMKID type)
-            // Can appear at start or within Key Data
-            for (uint16_t i = 0; i + 22 < keyDataLen; i++) {  // Strict < ensures 22 bytes remain
-                if (keyData[i] == 0xdd && keyData[i+1] == 0x14 &&
-                    keyData[i+2] == 0x00 && keyData[i+3] == 0x0f &&
-                    keyData[i+4] == 0xac && keyData[i+5] == 0x04) {
-                    
-                    // Double-check we have 22 bytes: tag(1) + len(1) + OUI(3) + type(1) + PMKID(16)
-                    if (i + 22 > keyDataLen) break;  // Defensive bounds check
-                    
-                    // Found PMKID KDE! Extract the 16 bytes
-                    const uint8_t* pmkidData = keyData + i + 6;
-                    
-                    // Check if PMKID is all zeros (some APs send empty PMKID KDE)
-                    bool allZeros = true;
-                    for (int z = 0; z < 16; z++) {
-                        if (pmkidData[z] != 0) { allZeros = false; break; }
-                    }
-                    if (allZeros) {
-                        break;  // Skip invalid PMKID
-                    }
-                    
-                    // Check if we already have this PMKID (lookup only - no push_back)
-                    int pmkIdx = findOrCreatePMKID(bssid, station);
-                    if (pmkIdx >= 0) {
-                        // Protect PMKID vector access with spinlock
-                        NetworkRecon::enterCritical();
-                        
-                        // Revalidate index
-                        if (pmkIdx >= (int)pmkids.size() || pmkids[pmkIdx].saved) {
-                            NetworkRecon::exitCritical();
+            // Revalidate index (the main loop may have evicted entries)
+            if (pmkIdx < (int)pmkids.size() && !pmkids[pmkIdx].saved &&
+                memcmp(pmkids[pmkIdx].bssid, bssid, 6) == 0 &&
+                memcmp(pmkids[pmkIdx].station, station, 6) == 0) {
+                CapturedPMKID& p = pmkids[pmkIdx];
+                memcpy(p.pmkid, pmkidData, 16);
+                p.timestamp = millis();
+                p.journaled = 0;
+                
+                // Look up SSID (already holding lock)
+                if (p.ssid[0] == 0) {
+                    for (int ni = 0; ni < (int)networks().size(); ni++) {
+                        if (memcmp(networks()[ni].bssid, bssid, 6) == 0) {
+                            strncpy(p.ssid, networks()[ni].ssid, 32);
+                            p.ssid[32] = 0;
                             break;
                         }
-                        
-                        CapturedPMKID& p = pmkids[pmkIdx];
-                        memcpy(p.pmkid, pmkidData, 16);
-                        p.timestamp = millis();
-                        
-                        // Look up SSID (already holding lock)
-                        if (p.ssid[0] == 0) {
-                            for (int ni = 0; ni < (int)networks().size(); ni++) {
-                                if (memcmp(networks()[ni].bssid, bssid, 6) == 0) {
-                                    strncpy(p.ssid, networks()[ni].ssid, 32);
-                                    p.ssid[32] = 0;
-                                    break;
-                                }
-                            }
-                        }
-                        
-                        char ssidCopy[33] = {0};
-                        strncpy(ssidCopy, p.ssid, 32);
-                        NetworkRecon::exitCritical();
-                        
-                        // Queue mood event outside critical section
-                        if (!pendingPMKIDCapture) {
-                            strncpy(pendingPMKIDSSID, ssidCopy, 32);
-                            pendingPMKIDSSID[32] = 0;
-                            pendingPMKIDCapture = true;
-                        }
-                    } else if (pmkIdx < 0) {
-                        // New PMKID - queue for creation in main thread
-                        if (!pendingPMKIDCreateBusy && !pendingPMKIDCreateReady) {
-                            memcpy(pendingPMKIDCreate.bssid, bssid, 6);
-                            memcpy(pendingPMKIDCreate.station, station, 6);
-                            memcpy(pendingPMKIDCreate.pmkid, pmkidData, 16);
-                            
-                            // Get SSID from networks if available (with spinlock)
-                            NetworkRecon::enterCritical();
-                            pendingPMKIDCreate.ssid[0] = 0;
-                            for (int ni = 0; ni < (int)networks().size(); ni++) {
-                                if (memcmp(networks()[ni].bssid, bssid, 6) == 0) {
-                                    strncpy(pendingPMKIDCreate.ssid, networks()[ni].ssid, 32);
-                                    pendingPMKIDCreate.ssid[32] = 0;
-                                    break;
-                                }
-                            }
-                            NetworkRecon::exitCritical();
-                            
-                            pendingPMKIDCreateReady = true;
-                            
-                            // Trigger auto-save for PMKID (with backfill retry)
-                            pendingAutoSave = true;
-                            
-                            // Queue the mood event
-                            if (!pendingPMKIDCapture) {
-                                strncpy(pendingPMKIDSSID, pendingPMKIDCreate.ssid, 32);
-                                pendingPMKIDSSID[32] = 0;
-                                pendingPMKIDCapture = true;
-                            }
-                        }
                     }
-                    break;  // Found it, stop searching
+                }
+                
+                char ssidCopy[33] = {0};
+                strncpy(ssidCopy, p.ssid, 32);
+                NetworkRecon::exitCritical();
+                
+                // Queue mood event outside critical section
+                if (!pendingPMKIDCapture) {
+                    strncpy(pendingPMKIDSSID, ssidCopy, 32);
+                    pendingPMKIDSSID[32] = 0;
+                    pendingPMKIDCapture = true;
+                }
+            } else {
+                NetworkRecon::exitCritical();
+            }
+        } else if (pmkIdx < 0) {
+            // New PMKID - queue for creation in main thread
+            if (!pendingPMKIDCreateBusy && !pendingPMKIDCreateReady) {
+                memcpy(pendingPMKIDCreate.bssid, bssid, 6);
+                memcpy(pendingPMKIDCreate.station, station, 6);
+                memcpy(pendingPMKIDCreate.pmkid, pmkidData, 16);
+                
+                // Get SSID from networks if available (with spinlock)
+                NetworkRecon::enterCritical();
+                pendingPMKIDCreate.ssid[0] = 0;
+                for (int ni = 0; ni < (int)networks().size(); ni++) {
+                    if (memcmp(networks()[ni].bssid, bssid, 6) == 0) {
+                        strncpy(pendingPMKIDCreate.ssid, networks()[ni].ssid, 32);
+                        pendingPMKIDCreate.ssid[32] = 0;
+                        break;
+                    }
+                }
+                NetworkRecon::exitCritical();
+                
+                pendingPMKIDCreateReady = true;
+                
+                // Trigger auto-save for PMKID (with backfill retry)
+                pendingAutoSave = true;
+                
+                // Queue the mood event
+                if (!pendingPMKIDCapture) {
+                    strncpy(pendingPMKIDSSID, pendingPMKIDCreate.ssid, 32);
+                    pendingPMKIDSSID[32] = 0;
+                    pendingPMKIDCapture = true;
                 }
             }
         }
@@ -1859,30 +1668,21 @@ void OinkMode::processEAPOL(const uint8_t* payload, uint16_t len,
         // Protect handshake vector access with spinlock
         NetworkRecon::enterCritical();
         
-        // Revalidate index after acquiring lock
-        if (hsIdx >= (int)handshakes.size()) {
+        // Revalidate index after acquiring lock (the main loop evicts
+        // journaled handshakes at the cap, shifting indices)
+        if (hsIdx >= (int)handshakes.size() ||
+            memcmp(handshakes[hsIdx].bssid, bssid, 6) != 0 ||
+            memcmp(handshakes[hsIdx].station, station, 6) != 0) {
             NetworkRecon::exitCritical();
             return;
         }
         
         CapturedHandshake& hs = handshakes[hsIdx];
         
-        // Store this frame (EAPOL payload for hashcat 22000)
+        // Store this frame: EAPOL payload for hashcat 22000 plus the full
+        // 802.11 frame for PCAP export (radiotap + WPA-SEC compatibility)
         uint8_t frameIdx = messageNum - 1;
-        uint16_t copyLen = min((uint16_t)512, len);
-        memcpy(hs.frames[frameIdx].data, payload, copyLen);
-        hs.frames[frameIdx].len = copyLen;
-        hs.frames[frameIdx].messageNum = messageNum;
-        hs.frames[frameIdx].timestamp = millis();
-        hs.frames[frameIdx].rssi = rssi;
-        
-        // Store full 802.11 frame for PCAP export (radiotap + WPA-SEC compatibility)
-        uint16_t fullCopyLen = min((uint16_t)300, fullFrameLen);
-        memcpy(hs.frames[frameIdx].fullFrame, fullFrame, fullCopyLen);
-        hs.frames[frameIdx].fullFrameLen = fullCopyLen;
-        
-        // Update mask
-        hs.capturedMask |= (1 << frameIdx);
+        hs.storeFrame(frameIdx, payload, len, fullFrame, fullFrameLen, millis(), rssi);
         hs.lastSeen = millis();
         
         // Look up SSID from networks if not set (already holding NetworkRecon critical section)
@@ -1916,74 +1716,20 @@ void OinkMode::processEAPOL(const uint8_t* payload, uint16_t len,
             pendingAutoSave = true;
         }
     } else {
-        // New handshake - enqueue to circular buffer for main thread
-        // Circular buffer allows queueing multiple rapid EAPOL frames (M1-M4 within ms)
-        
-        // Find or update existing slot for this handshake in the buffer
-        uint8_t targetSlot = PENDING_HS_SLOTS;  // Invalid slot marker
-        uint8_t writePos = pendingHsWrite;
-        
-        // Check if we already have a slot for this handshake (scan from read to write)
-        uint8_t scanPos = pendingHsRead;
-        while (scanPos != writePos) {
-            if (pendingHandshakes[scanPos] &&
-                memcmp(pendingHandshakes[scanPos]->bssid, bssid, 6) == 0 &&
-                memcmp(pendingHandshakes[scanPos]->station, station, 6) == 0) {
-                targetSlot = scanPos;
-                break;
-            }
-            scanPos = (scanPos + 1) % PENDING_HS_SLOTS;
-        }
-        
-        // If not found, try to allocate a new slot from static pool
-        if (targetSlot >= PENDING_HS_SLOTS) {
-            // Check if buffer is full (write pointer would catch read pointer)
-            uint8_t nextWrite = (writePos + 1) % PENDING_HS_SLOTS;
-            if (nextWrite != pendingHsRead && !pendingHsBusy[writePos] && !pendingHsAllocated[writePos]) {
-                // Slot is available - acquire from static pool (no heap ops)
-                targetSlot = writePos;
-                
-                // STATIC POOL: Point to pre-allocated slot (no malloc in callback context)
-                pendingHsAllocated[targetSlot] = true;
-                pendingHandshakes[targetSlot] = &pendingHsPool[targetSlot];
-                
-                pendingHsBusy[targetSlot] = true;  // Lock slot during init
-                
-                memcpy(pendingHandshakes[targetSlot]->bssid, bssid, 6);
-                memcpy(pendingHandshakes[targetSlot]->station, station, 6);
-                pendingHandshakes[targetSlot]->messageNum = 0;  // Deprecated field
-                pendingHandshakes[targetSlot]->capturedMask = 0;
-                pendingHandshakes[targetSlot]->hasPMKID = false;
-                
-                // Advance write pointer
-                pendingHsWrite = nextWrite;
-                
-                pendingHsBusy[targetSlot] = false;  // Unlock after init
-            }
-            // else: buffer full, drop this frame (extremely rare with 4 slots)
-        }
-        
-        // Store frame in target slot if we have one
-        if (targetSlot < PENDING_HS_SLOTS && pendingHandshakes[targetSlot] && !pendingHsBusy[targetSlot]) {
-            uint8_t frameIdx = messageNum - 1;
-            if (frameIdx < 4) {
-                pendingHsBusy[targetSlot] = true;  // Lock slot during update
-                
-                // EAPOL payload for hashcat 22000
-                uint16_t copyLen = min((uint16_t)512, len);
-                memcpy(pendingHandshakes[targetSlot]->frames[frameIdx].data, payload, copyLen);
-                pendingHandshakes[targetSlot]->frames[frameIdx].len = copyLen;
-                
-                // Full 802.11 frame for PCAP export
-                uint16_t fullCopyLen = min((uint16_t)300, fullFrameLen);
-                memcpy(pendingHandshakes[targetSlot]->frames[frameIdx].fullFrame, fullFrame, fullCopyLen);
-                pendingHandshakes[targetSlot]->frames[frameIdx].fullFrameLen = fullCopyLen;
-                pendingHandshakes[targetSlot]->frames[frameIdx].rssi = rssi;
-                
-                pendingHandshakes[targetSlot]->capturedMask |= (1 << frameIdx);
+        // New handshake - queue this frame for the main thread to create
+        // the entry. A full ring drops the frame (counted in diagnostics).
+        uint8_t frameIdx = messageNum - 1;
+        if (frameIdx < 4) {
+            uint32_t now = millis();
+            pendingHsFrames.emplace([&](PendingEapolFrame& ev) {
+                memcpy(ev.bssid, bssid, 6);
+                memcpy(ev.station, station, 6);
+                ev.frameIdx = frameIdx;
                 
-                pendingHsBusy[targetSlot] = false;  // Unlock after update
-            }
+                // EAPOL payload for hashcat 22000 + full frame for PCAP export
+                ev.frame.clear();
+                ev.frame.store(frameIdx, payload, len, fullFrame, fullFrameLen, now, rssi);
+            });
         }
     }
 }
@@ -2021,6 +1767,10 @@ int OinkMode::findOrCreatePMKID(const uint8_t* bssid, const uint8_t* station) {
 }
 
 // Safe versions for main thread use (does vector operations safely)
+RingStats OinkMode::getPendingHsStats() {
+    return pendingHsFrames.stats();
+}
+
 int OinkMode::findOrCreateHandshakeSafe(const uint8_t* bssid, const uint8_t* station) {
     // This version is ONLY called from update() in main loop context
     // Still need spinlock to prevent race with callback reads
@@ -2036,10 +1786,18 @@ int OinkMode::findOrCreateHandshakeSafe(const uint8_t* bssid, const uint8_t* sta
         }
     }
     
-    // Limit check
+    // At the cap, make room by dropping the oldest handshake that is both
+    // saved and fully journaled - its bytes are already on SD
     if (handshakes.size() >= MAX_HANDSHAKES) {
-        NetworkRecon::exitCritical();
-        return -1;
+        int victim = CaptureJournal::evictableHandshake(handshakes);
+        if (victim < 0) {
+            NetworkRecon::exitCritical();
+            return -1;
+        }
+        if (handshakes[victim].beaconData) {
+            free(handshakes[victim].beaconData);
+        }
+        handshakes.erase(handshakes.begin() + victim);
     }
     if (ESP.getFreeHeap() < HeapPolicy::kMinHeapForHandshakeAdd) {
         NetworkRecon::exitCritical();
@@ -2245,6 +2003,7 @@ void OinkMode::autoSaveCheck() {
             
             if (pcapOk || hs22kOk) {
                 hs.saved = true;
+                CaptureJournal::markExported(hs.bssid, hs.station, false);
                 SDLog::log("OINK", "Handshake saved: %s (pcap:%s 22000:%s)", 
                            hs.ssid, pcapOk ? "OK" : "FAIL", hs22kOk ? "OK" : "FAIL");
                 
@@ -2266,6 +2025,7 @@ void OinkMode::autoSaveCheck() {
                     }
                     txtFile.close();
                 }
+                CaptureCatalog::noteSaved(hs.bssid, false, hs.ssid);
             } else {
                 // Failed - increment attempt counter
                 hs.saveAttempts++;
@@ -2378,11 +2138,11 @@ bool OinkMode::saveHandshakePCAP(const CapturedHandshake& hs, const char* path)
     for (int i = 0; i < 4; i++) {
         if (!(hs.capturedMask & (1 << i))) continue;
         
-        const EAPOLFrame& frame = hs.frames[i];
+        EapolFrameView frame = hs.frames[i];
         if (frame.len == 0) continue;
         
         // Prefer stored fullFrame (real 802.11 capture) over reconstruction
-        if (frame.fullFrameLen > 0 && frame.fullFrameLen <= 300) {
+        if (frame.fullFrameLen > 0) {
             // Use the actual captured 802.11 frame (best quality)
             writePCAPPacket(f, frame.fullFrame, frame.fullFrameLen, frame.timestamp);
             packetCount++;
@@ -2505,21 +2265,13 @@ bool OinkMode::saveHandshake22000(const CapturedHandshake& hs, const char* path)
     }
     
     // Determine which frames to use
-    const EAPOLFrame* nonceFrame = nullptr;  // M1 or M3 (contains ANonce)
-    const EAPOLFrame* eapolFrame = nullptr;  // M2 (contains MIC + full EAPOL)
-    
-    if (msgPair == 0x00) {
-        // M1+M2: ANonce from M1, EAPOL from M2
-        nonceFrame = &hs.frames[0];  // M1
-        eapolFrame = &hs.frames[1];  // M2
-    } else {
-        // M2+M3: ANonce from M3, EAPOL from M2
-        nonceFrame = &hs.frames[2];  // M3
-        eapolFrame = &hs.frames[1];  // M2
-    }
+    // M1+M2: ANonce from M1, EAPOL from M2
+    // M2+M3: ANonce from M3, EAPOL from M2
+    EapolFrameView nonceFrame = hs.frames[msgPair == 0x00 ? 0 : 2];  // Contains ANonce
+    EapolFrameView eapolFrame = hs.frames[1];  // M2 (contains MIC + full EAPOL)
     
     // MIC field is at offset 81-96 (16 bytes), so we need len >= 97 to read it safely
-    if (nonceFrame->len < 51 || eapolFrame->len < 97) {
+    if (nonceFrame.len < 51 || eapolFrame.len < 97) {
         return false;
     }
     
@@ -2533,7 +2285,7 @@ bool OinkMode::saveHandshake22000(const CapturedHandshake& hs, const char* path)
     // Offsets: 0-3=EAPOL hdr, 4=desc, 5-6=keyinfo, 7-8=keylen, 9-16=replay, 17-48=nonce, 49-64=iv, 65-72=rsc, 73-80=reserved, 81-96=MIC
     char micHex[33];
     for (int i = 0; i < 16; i++) {
-        sprintf(micHex + i*2, "%02x", eapolFrame->data[81 + i]);
+        sprintf(micHex + i*2, "%02x", eapolFrame.data[81 + i]);
     }
     
     // MAC_AP (6 bytes as 12 hex chars)
@@ -2560,14 +2312,14 @@ bool OinkMode::saveHandshake22000(const CapturedHandshake& hs, const char* path)
     // ANonce from M1 or M3 (offset 17, 32 bytes)
     char nonceHex[65];
     for (int i = 0; i < 32; i++) {
-        sprintf(nonceHex + i*2, "%02x", nonceFrame->data[17 + i]);
+        sprintf(nonceHex + i*2, "%02x", nonceFrame.data[17 + i]);
     }
     
     // Full EAPOL frame from M2 (hex-encoded)
     // The EAPOL frame length is in bytes 2-3 (big-endian) + 4 bytes header
-    uint16_t eapolLen = (eapolFrame->data[2] << 8) | eapolFrame->data[3];
+    uint16_t eapolLen = (eapolFrame.data[2] << 8) | eapolFrame.data[3];
     eapolLen += 4;  // Add EAPOL header (version + type + length)
-    if (eapolLen > eapolFrame->len) eapolLen = eapolFrame->len;
+    if (eapolLen > eapolFrame.len) eapolLen = eapolFrame.len;
     
     // Allocate buffer for hex-encoded EAPOL (2 chars per byte)
     // Max EAPOL is 512 bytes = 1024 hex chars + null
@@ -2580,7 +2332,7 @@ bool OinkMode::saveHandshake22000(const CapturedHandshake& hs, const char* path)
     // Zero the MIC in EAPOL copy for hashcat (MIC at offset 81)
     // Work on a copy to avoid modifying original
     uint8_t eapolCopy[512];
-    memcpy(eapolCopy, eapolFrame->data, eapolLen);
+    memcpy(eapolCopy, eapolFrame.data, eapolLen);
     memset(eapolCopy + 81, 0, 16);  // Zero MIC field
     
     for (int i = 0; i < eapolLen; i++) {
@@ -2654,6 +2406,7 @@ bool OinkMode::saveAllPMKIDs() {
             
             if (savePMKID22000(p, filename)) {
                 p.saved = true;
+                CaptureJournal::markExported(p.bssid, p.station, true);
                 SDLog::log("OINK", "PMKID saved: %s", p.ssid);
                 
                 // Save SSID to companion .txt file (same pattern as handshakes)
@@ -2675,6 +2428,7 @@ bool OinkMode::saveAllPMKIDs() {
                     }
                     txtFile.close();
                 }
+                CaptureCatalog::noteSaved(p.bssid, true, p.ssid);
             } else {
                 // Failed - increment attempt counter
                 p.saveAttempts++;
@@ -2887,56 +2641,6 @@ void OinkMode::trackTargetClient(const uint8_t* bssid, const uint8_t* clientMac,
     }
 }
 
-bool OinkMode::detectPMF(const uint8_t* payload, uint16_t len) {
-    // Parse RSN IE to detect PMF (Protected Management Frames)
-    // RSN IE starts with tag 0x30
-    uint16_t offset = 36;  // After fixed beacon fields
-    
-    while (offset + 2 < len) {
-        uint8_t tag = payload[offset];
-        uint8_t tagLen = payload[offset + 1];
-        
-        if (offset + 2 + tagLen > len) break;
-        
-        if (tag == 0x30 && tagLen >= 8) {  // RSN IE
-            // RSN IE structure: version(2) + group cipher(4) + pairwise count(2) + ...
-            // RSN capabilities are at the end, look for MFPC/MFPR bits
-            uint16_t rsnOffset = offset + 2;
-            uint16_t rsnEnd = rsnOffset + tagLen;
-            
-            // Skip version (2), group cipher (4)
-            rsnOffset += 6;
-            if (rsnOffset + 2 > rsnEnd) break;
-            
-            // Pairwise cipher count and suites
-            uint16_t pairwiseCount = payload[rsnOffset] | (payload[rsnOffset + 1] << 8);
-            rsnOffset += 2 + (pairwiseCount * 4);
-            if (rsnOffset + 2 > rsnEnd) break;
-            
-            // AKM count and suites
-            uint16_t akmCount = payload[rsnOffset] | (payload[rsnOffset + 1] << 8);
-            rsnOffset += 2 + (akmCount * 4);
-            if (rsnOffset + 2 > rsnEnd) break;
-            
-            // RSN Capabilities (2 bytes)
-            uint16_t rsnCaps = payload[rsnOffset] | (payload[rsnOffset + 1] << 8);
-            
-            // IEEE 802.11-2016 standard:
-            // Bit 6: MFPC (Management Frame Protection Capable)
-            // Bit 7: MFPR (Management Frame Protection Required)
-            bool mfpr = (rsnCaps >> 7) & 0x01;
-            
-            if (mfpr) {
-                return true;  // PMF required - deauth won't work
-            }
-        }
-        
-        offset += 2 + tagLen;
-    }
-    
-    return false;
-}
-
 int OinkMode::findNetwork(const uint8_t* bssid) {
     return NetworkRecon::findNetworkIndex(bssid);
 }
@@ -3013,6 +2717,7 @@ void OinkMode::sortNetworksByPriority() {
 
     NetworkRecon::enterCritical();
     networks().swap(sorted);
+    NetworkRecon::invalidateIndex();
 
     // Revalidate target index after reordering
     if (targetIndex >= 0) {
@@ -3410,6 +3115,7 @@ void OinkMode::injectTestNetwork(const uint8_t* bssid, const char* ssid, uint8_t
         SDLog::log("OINK", "Failed to inject test network: out of memory");
         return;
     }
+    NetworkRecon::invalidateIndex();
     NetworkRecon::exitCritical();
 }
 
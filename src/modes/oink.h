@@ -7,6 +7,9 @@
 #include <set>
 #include <FS.h>
 #include "../core/network_recon.h"
+#include "../core/eapol_slab.h"
+
+namespace FrameDispatch { struct EapolKey; }
 
 // Maximum clients to track for the current target (dense environments)
 #define MAX_CLIENTS_PER_NETWORK 20
@@ -34,34 +37,25 @@ struct DetectedNetwork {
     bool hasHandshake;  // Already captured handshake for this network
     uint8_t attackAttempts;  // Number of attack attempts (for retry logic)
     bool isHidden;  // Hidden SSID (needs probe response)
+    int8_t reportedRssi;       // Strongest beacon reported as a sighting this window
     uint32_t lastDataSeen;     // millis() of most recent client data frame
     uint32_t cooldownUntil;    // millis() until eligible for auto-target
     uint64_t clientBitset;     // Approximate unique client tracker (bitset)
 };
 
-// Frame storage for PCAP export - stores full 802.11 frame with headers
-struct EAPOLFrame {
-    uint8_t data[512];       // EAPOL payload only (for hashcat 22000)
-    uint8_t fullFrame[300];  // Full 802.11 frame for PCAP (header + LLC + EAPOL)
-    uint16_t len;            // EAPOL payload length
-    uint16_t fullFrameLen;   // Full 802.11 frame length
-    uint8_t messageNum;      // 1-4
-    uint32_t timestamp;
-    int8_t rssi;             // Signal strength for radiotap header
-};
-
 struct CapturedHandshake {
     uint8_t bssid[6];
     uint8_t station[6];
     char ssid[33];
-    EAPOLFrame frames[4];  // M1, M2, M3, M4
-    uint8_t capturedMask;  // Bits 0-3 for M1-M4
+    HandshakeFrames frames;  // M1, M2, M3, M4 packed (see eapol_slab.h)
+    uint8_t capturedMask;  // Bits 0-3 for M1-M4 (mirrors frames.mask())
     uint32_t firstSeen;
     uint32_t lastSeen;
     bool saved;  // Already saved to SD
     uint8_t saveAttempts;  // Number of save attempts (0-3, then give up)
     uint8_t* beaconData;   // Beacon frame for this AP
     uint16_t beaconLen;    // Beacon frame length
+    uint8_t journaledMask; // What the capture journal holds (CaptureJournal::JOURNALED_*)
     
     bool hasM1() const { return capturedMask & 0x01; }
     bool hasM2() const { return capturedMask & 0x02; }
@@ -81,6 +75,26 @@ struct CapturedHandshake {
         if (hasM2() && hasM3()) return 0x02;  // M2+M3: EAPOL from M2 (authorized)
         return 0xFF;  // Invalid
     }
+    
+    // Frame writes go through these so capturedMask follows the slab
+    // (storing M1-M3 into a full slab may evict M4) and the new copy is
+    // journaled again
+    bool storeFrame(uint8_t idx, const uint8_t* eapol, uint16_t eapolLen,
+                    const uint8_t* fullFrame, uint16_t fullLen,
+                    uint32_t timestamp, int8_t rssi) {
+        bool ok = frames.store(idx, eapol, eapolLen, fullFrame, fullLen, timestamp, rssi);
+        capturedMask = frames.mask();
+        journaledMask &= (uint8_t)~(1 << idx);
+        return ok;
+    }
+    template <uint16_t N>
+    bool mergeFrame(const EapolSlab<N>& src, uint8_t idx) {
+        if (frames.has(idx)) return false;  // Keep the first copy
+        bool ok = frames.copyFrom(src, idx);
+        capturedMask = frames.mask();
+        journaledMask &= (uint8_t)~(1 << idx);
+        return ok;
+    }
 };
 
 // PMKID capture - clientless attack, extracted from EAPOL M1
@@ -92,12 +106,15 @@ struct CapturedPMKID {
     uint32_t timestamp;
     bool saved;
     uint8_t saveAttempts;  // Number of save attempts (0-3, then give up)
+    uint8_t journaled;     // CaptureJournal::JOURNALED_PMKID* bits
 };
 
 class OinkMode {
 public:
     static void init();
     static void start();
+    // start() one phase per call (mode switcher); true once running
+    static bool startStep();
     static void stop();
     static void update();
     static bool isRunning() { return running; }
@@ -123,6 +140,7 @@ public:
     static bool saveHandshakePCAP(const CapturedHandshake& hs, const char* path);
     static bool saveAllHandshakes();
     static void autoSaveCheck();
+    static RingStats getPendingHsStats();  // Callback -> update() EAPOL queue
     
     // PMKID capture (clientless attack)
     static const std::vector<CapturedPMKID>& getPMKIDs() { return pmkids; }
@@ -179,6 +197,7 @@ public:
     
 private:
     static bool running;
+    static uint8_t startPhase;  // Next startStep() phase, 0 when idle
     static bool scanning;
     static bool deauthing;
     static bool channelHopping;
@@ -210,8 +229,7 @@ private:
     // Private processing functions (callback dispatches here)
     static void processBeacon(const uint8_t* payload, uint16_t len, int8_t rssi);
     static void processProbeResponse(const uint8_t* payload, uint16_t len, int8_t rssi);
-    static void processDataFrame(const uint8_t* payload, uint16_t len, int8_t rssi);
-    static void processEAPOL(const uint8_t* payload, uint16_t len, const uint8_t* srcMac, const uint8_t* dstMac,
+    static void processEAPOL(const FrameDispatch::EapolKey& key,
                              const uint8_t* fullFrame, uint16_t fullFrameLen, int8_t rssi);
     
     static void sendDeauthFrame(const uint8_t* bssid, const uint8_t* station, uint8_t reason);
@@ -221,7 +239,6 @@ private:
     static void hopChannel();
     static void trackTargetClient(const uint8_t* bssid, const uint8_t* clientMac, int8_t rssi);
     static void clearTargetClients();
-    static bool detectPMF(const uint8_t* payload, uint16_t len);
 
     static int findNetwork(const uint8_t* bssid);
     static int findOrCreateHandshake(const uint8_t* bssid, const uint8_t* station);
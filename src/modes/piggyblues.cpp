@@ -674,6 +674,7 @@ void PiggyBluesMode::stop() {
             delay(10);
         }
         
+        XP::flush();  // Coalesced XP save still pending
         ESP.restart();
         return;
     }
@@ -15,6 +15,7 @@
 #include "../core/config.h"
 #include "../core/sdlog.h"
 #include "../core/sd_layout.h"
+#include "../core/capture_catalog.h"
 #include "../core/wifi_utils.h"
 #include "../core/heap_gates.h"
 #include "../core/heap_policy.h"
@@ -336,23 +337,9 @@ static bool parseSirloinHandshake(const uint8_t* data, uint16_t len, CapturedHan
             continue;
         }
 
-        EAPOLFrame& frame = out.frames[msgNum - 1];
-        uint16_t copyLen = frameLen;
-        if (copyLen > sizeof(frame.data)) copyLen = sizeof(frame.data);
-        memcpy(frame.data, frameData, copyLen);
-        frame.len = copyLen;
-
-        uint16_t fullCopyLen = fullLen;
-        if (fullCopyLen > sizeof(frame.fullFrame)) fullCopyLen = sizeof(frame.fullFrame);
-        if (fullCopyLen > 0) {
-            memcpy(frame.fullFrame, fullFrame, fullCopyLen);
-        }
-        frame.fullFrameLen = fullCopyLen;
-        frame.messageNum = msgNum;
-        frame.rssi = rssi;
-        frame.timestamp = (ts < 1000000000) ? ts : millis();
-
-        out.capturedMask |= (1 << (msgNum - 1));
+        // Packed into the slab (EAPOL clamps to 512, full frame to 300)
+        out.storeFrame(msgNum - 1, frameData, frameLen, fullFrame, fullLen,
+                       (ts < 1000000000) ? ts : millis(), rssi);
     }
 
     out.firstSeen = millis();
@@ -2228,6 +2215,7 @@ bool PigSyncMode::savePMKID(const uint8_t* data, uint16_t len) {
             txtFile.println(pmkid.ssid);
             txtFile.close();
         }
+        CaptureCatalog::noteSaved(pmkid.bssid, true, pmkid.ssid);
     }
 
     return ok;
@@ -2282,6 +2270,7 @@ bool PigSyncMode::saveHandshake(const uint8_t* data, uint16_t len) {
             txtFile.println(hs.ssid);
             txtFile.close();
         }
+        CaptureCatalog::noteSaved(hs.bssid, false, hs.ssid);
     }
 
     if (hs.beaconData) {
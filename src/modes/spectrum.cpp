@@ -5,6 +5,8 @@
 #include "../core/config.h"
 #include "../audio/sfx.h"
 #include "../core/network_recon.h"
+#include "../core/ie_parser.h"
+#include "../core/frame_dispatch.h"
 #include "../core/oui.h"
 #include "../core/stress_test.h"
 #include "../core/wsl_bypasser.h"
@@ -12,6 +14,7 @@
 #include "../core/heap_gates.h"
 #include "../core/heap_policy.h"
 #include "../core/xp.h"
+#include "../core/spectrum_lobe.h"
 #include "../ui/display.h"
 #include <M5Cardputer.h>
 #include <WiFi.h>
@@ -67,39 +70,11 @@ static const float GAUSSIAN_LUT[31] = {
     0.2493f, 0.1914f, 0.1437f, 0.1052f, 0.0756f   // +11 to +15
 };
 
-// NEW: Sinc LUT for realistic RF carrier wave shape with side lobes
-// Formula: |sin(π * d / BW) / (π * d / BW)| where BW = 11 (WiFi channel half-bandwidth)
-// Side lobes naturally decay: main lobe at 0, first nulls at ±11 MHz, side lobes between
-// Extended range to ±22 MHz to show 2 side lobes per side
-// Index 0-44 maps to distance -22 to +22 MHz
-static const float SINC_LUT[45] = {
-    // d = -22 to -18 (2nd side lobe region, left)
-    0.0000f, 0.0650f, 0.1100f, 0.1300f, 0.1100f,
-    // d = -17 to -13 (approaching 2nd null)
-    0.0650f, 0.0000f, 0.0900f, 0.1500f, 0.1800f,
-    // d = -12 to -8 (1st side lobe, left - peaks around -16)
-    0.1500f, 0.0000f, 0.1700f, 0.2700f, 0.3300f,
-    // d = -7 to -3 (main lobe rising)
-    0.3700f, 0.5000f, 0.6500f, 0.8000f, 0.9100f,
-    // d = -2 to 0 (main lobe peak)
-    0.9700f, 0.9950f, 1.0000f,
-    // d = 1 to 5 (main lobe falling)
-    0.9950f, 0.9700f, 0.9100f, 0.8000f, 0.6500f,
-    // d = 6 to 10 (main lobe edge to 1st null)
-    0.5000f, 0.3700f, 0.3300f, 0.2700f, 0.1700f,
-    // d = 11 to 15 (1st null and 1st side lobe, right)
-    0.0000f, 0.1500f, 0.1800f, 0.1500f, 0.0900f,
-    // d = 16 to 20 (2nd null region)
-    0.0000f, 0.0650f, 0.1100f, 0.1300f, 0.1100f,
-    // d = 21 to 22 (2nd side lobe tail)
-    0.0650f, 0.0000f
-};
-
 // Spectrum analyzer buffers (static allocation - no heap)
 static int8_t spectrumBuffer[SPECTRUM_WIDTH];           // Current frame RSSI per column
 static int8_t spectrumPersist[SPECTRUM_WIDTH];          // Persistence (rolling average)
 static int8_t spectrumPeak[SPECTRUM_WIDTH];             // Peak hold per column
-static uint8_t waterfallBuffer[WATERFALL_ROWS][SPECTRUM_WIDTH];  // History (0-255 intensity)
+static uint8_t waterfallBuffer[WATERFALL_ROWS][SPECTRUM_WIDTH];  // History (dither level 0-5)
 static uint8_t waterfallWriteRow = 0;                   // Current write position (circular)
 static uint32_t lastWaterfallUpdate = 0;
 static const uint32_t WATERFALL_UPDATE_MS = 100;        // 10 FPS waterfall scroll
@@ -115,13 +90,19 @@ static inline uint8_t fastNoise() {
     return (uint8_t)(noiseState & 0x07);  // 0-7 range for subtle jitter
 }
 
-// Forward declaration for sinc amplitude helper
-static float getSincAmplitude(float dist);
+// Sinc lobe shape for the current zoom (shared by buffer fill and drawing)
+static SpectrumLobe::Template lobeTemplate;
+
+static const SpectrumLobe::Template& lobeShape(float widthMHz) {
+    if (!lobeTemplate.matches(widthMHz, SPECTRUM_WIDTH)) {
+        lobeTemplate.build(widthMHz, SPECTRUM_WIDTH);
+    }
+    return lobeTemplate;
+}
 
 constexpr uint8_t CHANNEL_SLOTS = 14;  // index 1-13 used
 const int8_t RSSI_NO_SIGNAL = -100;
 const uint32_t ACTIVITY_INTERVAL_MS = 200;
-const float TWO_PI_F = 6.2831853f;
 
 // Per-channel activity + peak/avg stats (no heap)
 static volatile uint32_t channelActivity[CHANNEL_SLOTS] = {};
@@ -141,6 +122,7 @@ const int8_t MERGE_HYSTERESIS_DB = 6;
 
 // Static members
 bool SpectrumMode::running = false;
+uint8_t SpectrumMode::startPhase = 0;
 std::atomic<bool> SpectrumMode::busy{false};  // [BUG7 FIX] Atomic for cross-core visibility
 std::vector<SpectrumNetwork> SpectrumMode::networks;
 SpectrumRenderNet SpectrumMode::renderNets[MAX_SPECTRUM_NETWORKS] = {};
@@ -293,35 +275,70 @@ void SpectrumMode::init() {
 }
 
 void SpectrumMode::start() {
-    if (running) return;
-    
-    Serial.println("[SPECTRUM] Starting HOG ON SPECTRUM mode...");
-    
-    // Ensure NetworkRecon is running (handles WiFi promiscuous mode)
-    if (!NetworkRecon::isRunning()) {
-        NetworkRecon::start();
-    }
+    while (!startStep()) {}
+}
 
-    // Apply spectrum-specific sweep speed
-    NetworkRecon::setHopIntervalOverride(Config::wifi().spectrumHopInterval);
+// Phases: recon + sweep speed, state/buffer reset, network table
+// allocation, then the callback. Each gets a frame of its own when called
+// from the mode switcher.
+bool SpectrumMode::startStep() {
+    if (running) return true;
     
-    // Reserve memory for spectrum-specific network data
-    networks.reserve(MAX_SPECTRUM_NETWORKS);
-    init();
+    switch (startPhase) {
+        case 0:
+            Serial.println("[SPECTRUM] Starting HOG ON SPECTRUM mode...");
+            
+            // Ensure NetworkRecon is running (handles WiFi promiscuous mode)
+            if (!NetworkRecon::isRunning()) {
+                NetworkRecon::start();
+            }
+            
+            // Apply spectrum-specific sweep speed
+            NetworkRecon::setHopIntervalOverride(Config::wifi().spectrumHopInterval);
+            startPhase = 1;
+            return false;
+            
+        case 1:
+            // Spectrum/waterfall buffers and per-channel state
+            init();
+            startPhase = 2;
+            return false;
+            
+        case 2:
+            // Reserve memory for spectrum-specific network data (after init(),
+            // which releases the vector's capacity)
+            networks.reserve(MAX_SPECTRUM_NETWORKS);
+            startPhase = 3;
+            return false;
+            
+        default:
+            break;
+    }
     
     // Register our packet callback for visualization
     NetworkRecon::setPacketCallback(promiscuousCallback);
     
     running = true;
+    startPhase = 0;
     lastUpdateTime = millis();
     startTime = millis();
     
     Display::setWiFiStatus(true);
     Serial.printf("[SPECTRUM] Running - %d networks from recon\n", NetworkRecon::getNetworkCount());
+    return true;
 }
 
 void SpectrumMode::stop() {
-    if (!running) return;
+    if (!running) {
+        // Start cut short by a mode switch: undo the sweep override and table
+        if (startPhase > 0) {
+            NetworkRecon::clearHopIntervalOverride();
+            networks.clear();
+            networks.shrink_to_fit();
+        }
+        startPhase = 0;
+        return;
+    }
     
     Serial.println("[SPECTRUM] Stopping...");
     
@@ -1129,32 +1146,15 @@ void SpectrumMode::updateSpectrumBuffers() {
     }
     
     // Accumulate signal from each visible network
+    // Max, not sum: signals don't add in dB space simply
+    const SpectrumLobe::Template& shape = lobeShape(viewWidthMHz);
+    float leftFreq = viewCenterMHz - viewWidthMHz / 2;
     for (uint16_t n = 0; n < renderCount; n++) {
         const SpectrumRenderNet& net = renderNets[n];
         if (!matchesFilterRender(net)) continue;
         
-        float centerFreq = net.displayFreqMHz;
-        int8_t rssi = net.rssi;
-        
-        // Draw sinc lobe into buffer
-        for (int x = 0; x < SPECTRUM_WIDTH; x++) {
-            // Convert X to frequency
-            float freq = viewCenterMHz - viewWidthMHz / 2 + 
-                        (float)x * viewWidthMHz / SPECTRUM_WIDTH;
-            float dist = freq - centerFreq;
-            
-            // Get sinc amplitude
-            float amp = getSincAmplitude(dist);
-            if (amp < 0.05f) continue;  // Skip negligible contributions
-            
-            // Calculate RSSI at this point
-            int8_t signalRssi = NOISE_FLOOR_DB + (int8_t)((rssi - NOISE_FLOOR_DB) * amp);
-            
-            // Take max of existing and new signal (signals don't add in dB space simply)
-            if (signalRssi > spectrumBuffer[x]) {
-                spectrumBuffer[x] = signalRssi;
-            }
-        }
+        SpectrumLobe::Placement lobe = shape.place(shape.centerQ(net.displayFreqMHz, leftFreq));
+        SpectrumLobe::accumulate(lobe, NOISE_FLOOR_DB, net.rssi, spectrumBuffer, SPECTRUM_WIDTH);
     }
     
     // Update persistence buffer (rolling average for smoother display)
@@ -1179,14 +1179,14 @@ void SpectrumMode::updateWaterfall() {
     if (now - lastWaterfallUpdate < WATERFALL_UPDATE_MS) return;
     lastWaterfallUpdate = now;
     
-    // Convert current spectrumBuffer to intensity (0-255) and store in waterfall
+    // Convert current spectrumBuffer to intensity (0-255), stored as its dither level
     for (int x = 0; x < SPECTRUM_WIDTH; x++) {
         // Map RSSI (-95 to -30) to intensity (0-255)
         int8_t rssi = spectrumPersist[x];
         int intensity = (int)((rssi - RSSI_MIN) * 255 / (RSSI_MAX - RSSI_MIN));
         if (intensity < 0) intensity = 0;
         if (intensity > 255) intensity = 255;
-        waterfallBuffer[waterfallWriteRow][x] = (uint8_t)intensity;
+        waterfallBuffer[waterfallWriteRow][x] = SpectrumLobe::ditherLevel((uint8_t)intensity);
     }
     
     // Advance circular buffer write position
@@ -1199,39 +1199,31 @@ void SpectrumMode::drawWaterfall(M5Canvas& canvas) {
     canvas.drawFastHLine(SPECTRUM_LEFT, WATERFALL_TOP - 1, SPECTRUM_WIDTH, COLOR_FG);
     
     // Draw waterfall rows (oldest at top, newest at bottom)
+    // Rows are dithered from per-row masks (higher level = more pixels filled)
+    // and written straight into the 8-bit sprite buffer when there is one
+    uint8_t* pixels = (uint8_t*)canvas.getBuffer();
+    bool direct = pixels && canvas.getColorDepth() == 8 && canvas.height() >= WATERFALL_BOTTOM &&
+                  canvas.width() >= SPECTRUM_RIGHT;
+    uint8_t ink = canvas.color16to8(COLOR_FG);
+    uint8_t scratch[SPECTRUM_WIDTH];
+    
     for (int row = 0; row < WATERFALL_ROWS; row++) {
         // Calculate which buffer row to read (circular buffer)
         // waterfallWriteRow points to NEXT write position, so oldest is at waterfallWriteRow
         int bufRow = (waterfallWriteRow + row) % WATERFALL_ROWS;
         int screenY = WATERFALL_TOP + row;
         
-        // Draw each pixel in this row
+        if (direct) {
+            uint8_t* dst = pixels + (size_t)screenY * canvas.width() + SPECTRUM_LEFT;
+            SpectrumLobe::blitRow(dst, waterfallBuffer[bufRow], SPECTRUM_WIDTH, row, ink);
+            continue;
+        }
+        
+        // Other color depths: same masks, pixel by pixel
+        memset(scratch, 0, sizeof(scratch));
+        SpectrumLobe::blitRow(scratch, waterfallBuffer[bufRow], SPECTRUM_WIDTH, row, 1);
         for (int x = 0; x < SPECTRUM_WIDTH; x++) {
-            uint8_t intensity = waterfallBuffer[bufRow][x];
-            
-            // Only draw if above noise threshold (intensity > 20 means signal present)
-            if (intensity > 20) {
-                // Dithering for monochrome display:
-                // Higher intensity = more pixels filled
-                // Use position-based pattern for clean look
-                bool drawPixel = false;
-                
-                if (intensity > 200) {
-                    drawPixel = true;  // Full brightness - always draw
-                } else if (intensity > 150) {
-                    drawPixel = ((x + row) % 2) == 0;  // 50% checkerboard
-                } else if (intensity > 100) {
-                    drawPixel = ((x % 2) == 0) && ((row % 2) == 0);  // 25% grid
-                } else if (intensity > 50) {
-                    drawPixel = ((x % 3) == 0) && ((row % 2) == 0);  // ~16% sparse
-                } else {
-                    drawPixel = ((x % 4) == 0) && ((row % 3) == 0);  // ~8% very sparse
-                }
-                
-                if (drawPixel) {
-                    canvas.drawPixel(SPECTRUM_LEFT + x, screenY, COLOR_FG);
-                }
-            }
+            if (scratch[x]) canvas.drawPixel(SPECTRUM_LEFT + x, screenY, COLOR_FG);
         }
     }
 }
@@ -1503,17 +1495,6 @@ void SpectrumMode::drawSpectrum(M5Canvas& canvas) {
     }
 }
 
-// Helper: Get Sinc amplitude at distance d from center using LUT + interpolation
-// Sinc function has natural side lobes at ±11MHz, ±17MHz (nulls at ±11, ±22)
-static float getSincAmplitude(float dist) {
-    float lutPos = dist + 22.0f;  // Map -22..+22 to 0..44
-    if (lutPos < 0.0f || lutPos > 44.0f) return 0.0f;
-    int lutIdx = (int)lutPos;
-    float frac = lutPos - lutIdx;
-    if (lutIdx >= 44) return SINC_LUT[44];
-    return SINC_LUT[lutIdx] + frac * (SINC_LUT[lutIdx + 1] - SINC_LUT[lutIdx]);
-}
-
 // Legacy Gaussian helper (kept for reference)
 static float getGaussianAmplitude(float dist) {
     float lutPos = dist + 15.0f;  // Map -15..+15 to 0..30
@@ -1553,26 +1534,27 @@ void SpectrumMode::drawGaussianLobe(M5Canvas& canvas, float centerFreqMHz,
     leftX = max(leftX, SPECTRUM_LEFT);
     rightX = min(rightX, SPECTRUM_RIGHT);
     
+    // Sinc shape for this zoom, placed at the lobe center (view columns)
+    const SpectrumLobe::Template& shape = lobeShape(viewWidthMHz);
+    SpectrumLobe::Placement lobe = shape.place(shape.centerQ(center, viewCenterMHz - viewWidthMHz / 2));
+    
     // === SINC CARRIER WAVE: Draw as connected line segments ===
-    // Activity-based animation (subtle vertical jitter)
-    int8_t jitterOffset = 0;
-    float activityRatio = 0.0f;
-    if (activityPps > 0) {
-        uint16_t capped = min(activityPps, (uint16_t)400);
-        activityRatio = (float)capped / 400.0f;
-        float jitterAmp = 2.0f * activityRatio;
+    // Activity-based animation (subtle vertical jitter), integer sine
+    uint32_t capped = min(activityPps, (uint16_t)400);   // 0..400 = activity ratio 0..1
+    int jitterOffset = 0;
+    if (capped > 0) {
         uint32_t phaseMs = (uint32_t)((millis() + seed * 31u) * 8u) % 1000u;
-        float phase = (float)phaseMs / 1000.0f;
-        jitterOffset = (int8_t)(jitterAmp * sinf(phase * TWO_PI_F));
+        // +-2 px at full activity
+        jitterOffset = (int)(2 * (int32_t)capped * SpectrumLobe::sin8((uint8_t)(phaseMs * 256u / 1000u)) /
+                             (400 * 127));
     }
 
     // Micro amplitude flutter (keeps center frequency stable)
-    float flutterAmp = 0.02f + 0.03f * activityRatio;  // 2%..5%
-    uint32_t periodMs = 1800u - (uint32_t)(activityRatio * 1000.0f);  // 1800..800ms
+    uint32_t flutterPerMille = 20 + capped * 30 / 400;             // 2%..5%
+    uint32_t periodMs = 1800u - capped * 1000u / 400u;             // 1800..800ms
     uint32_t flutterPhaseMs = (millis() + seed * 53u) % periodMs;
-    float flutterPhase = (float)flutterPhaseMs / (float)periodMs;
-    float flutter = 1.0f + flutterAmp * sinf(flutterPhase * TWO_PI_F);
-    int lobeHeightMod = (int)(lobeHeight * flutter);
+    int flutter = SpectrumLobe::sin8((uint8_t)(flutterPhaseMs * 256u / periodMs));
+    int lobeHeightMod = lobeHeight + lobeHeight * (int)flutterPerMille * flutter / (1000 * 127);
     int maxHeight = baseY - SPECTRUM_TOP;
     if (lobeHeightMod < 1) lobeHeightMod = 1;
     if (lobeHeightMod > maxHeight) lobeHeightMod = maxHeight;
@@ -1582,9 +1564,7 @@ void SpectrumMode::drawGaussianLobe(M5Canvas& canvas, float centerFreqMHz,
     uint8_t shimmerPhase = 0;
     if (filled) {
         // Lower activity = sparser fill, higher activity = solid
-        shimmerMod = 1 + (uint8_t)((1.0f - activityRatio) * 2.0f);  // 1..3
-        if (shimmerMod < 1) shimmerMod = 1;
-        if (shimmerMod > 3) shimmerMod = 3;
+        shimmerMod = 1 + (uint8_t)((400 - capped) / 200);  // 1..3
         uint32_t shimmerTick = (millis() / 60u) + seed;
         shimmerPhase = (uint8_t)(shimmerTick % shimmerMod);
     }
@@ -1595,16 +1575,11 @@ void SpectrumMode::drawGaussianLobe(M5Canvas& canvas, float centerFreqMHz,
     bool prevValid = false;
     
     for (int x = leftX; x <= rightX; x++) {
-        // Convert X back to frequency
-        float freq = viewCenterMHz - viewWidthMHz / 2 + 
-                    (float)(x - SPECTRUM_LEFT) * viewWidthMHz / (SPECTRUM_RIGHT - SPECTRUM_LEFT);
-        float dist = freq - center;
-        
-        // Get sinc amplitude (includes side lobes)
-        float amp = getSincAmplitude(dist);
+        // Sinc amplitude at this column (includes side lobes)
+        uint8_t amp = lobe.at(x - SPECTRUM_LEFT);
         
         // Calculate Y with activity jitter
-        int y = baseY - (int)(lobeHeightMod * amp) + jitterOffset;
+        int y = baseY - SpectrumLobe::scale(lobeHeightMod, amp) + jitterOffset;
         y = constrain(y, SPECTRUM_TOP, baseY);
         
         if (filled) {
@@ -1626,15 +1601,21 @@ void SpectrumMode::drawGaussianLobe(M5Canvas& canvas, float centerFreqMHz,
         prevValid = true;
     }
     
-    // For outline mode: connect to baseline at edges
+    // For outline mode: connect to baseline at edges (band edge cuts the lobe)
     if (!filled) {
         // Left edge
-        int leftEdgeY = baseY - (int)(lobeHeightMod * getSincAmplitude(startFreq - center));
+        int leftEdgeY = baseY;
+        if (startFreq > center - SINC_HALF_WIDTH) {
+            leftEdgeY -= SpectrumLobe::scale(lobeHeightMod, lobe.at(leftX - SPECTRUM_LEFT));
+        }
         if (leftEdgeY < baseY) {
             canvas.drawLine(leftX, baseY, leftX, leftEdgeY, COLOR_FG);
         }
         // Right edge
-        int rightEdgeY = baseY - (int)(lobeHeightMod * getSincAmplitude(endFreq - center));
+        int rightEdgeY = baseY;
+        if (endFreq < center + SINC_HALF_WIDTH) {
+            rightEdgeY -= SpectrumLobe::scale(lobeHeightMod, lobe.at(rightX - SPECTRUM_LEFT));
+        }
         if (rightEdgeY < baseY) {
             canvas.drawLine(rightX, rightEdgeY, rightX, baseY, COLOR_FG);
         }
@@ -2032,106 +2013,25 @@ void SpectrumMode::promiscuousCallback(const wifi_promiscuous_pkt_t* pkt, wifi_p
     
     if (!pkt || !pkt->payload) return;
     
-    const uint8_t* payload = pkt->payload;
-    uint16_t len = pkt->rx_ctrl.sig_len;
-    int8_t rssi = pkt->rx_ctrl.rssi;
     uint8_t rxChannel = pkt->rx_ctrl.channel;
     if (rxChannel < 1 || rxChannel > 13) rxChannel = currentChannel;
     
-    updateChannelStats(rxChannel, rssi);
-    
-    // Handle data frames when monitoring
-    if (type == WIFI_PKT_DATA && monitoringNetwork) {
-        processDataFrame(payload, len, rssi);
-        return;
-    }
-    
-    if (type != WIFI_PKT_MGMT) return;
-    
-    if (len < 36) return;
-    
-    // Check frame type - beacon (0x80) or probe response (0x50)
-    uint8_t frameType = payload[0];
-    if (frameType != 0x80 && frameType != 0x50) return;
-    
-    bool isProbeResponse = (frameType == 0x50);
-    
-    // BSSID is at offset 16
-    const uint8_t* bssid = payload + 16;
-    
-    // Parse SSID and DS channel from tagged parameters (starts at offset 36)
-    char ssid[33] = {0};
-    bool ssidFound = false;
-    uint8_t dsChannel = 0;
-    uint16_t offset = 36;
-    
-    while (offset + 2 < len) {
-        if (offset + 2 >= len) break; // Additional bounds check
-        uint8_t tagNum = payload[offset];
-        uint8_t tagLen = payload[offset + 1];
-        
-        if (offset + 2 + tagLen > len) break;
-        
-        if (tagNum == 0 && tagLen <= 32) {  // SSID tag
-            if (offset + 2 + tagLen >= len) break; // Bounds check before memcpy
-            memcpy(ssid, payload + offset + 2, tagLen);
-            ssid[tagLen] = 0;
-            ssidFound = true;
-        } else if (tagNum == 3 && tagLen == 1) {  // DS Parameter Set (channel)
-            dsChannel = payload[offset + 2];
+    // Channel stats for every packet, clients of the monitored network,
+    // and beacons / probe responses for the spectrum itself
+    struct SpectrumSink {
+        void activity(uint8_t channel, int8_t rssi) { updateChannelStats(channel, rssi); }
+        void data(const uint8_t* frame, uint16_t len, int8_t rssi) {
+            if (monitoringNetwork) processDataFrame(frame, len, rssi);
         }
-        
-        if (ssidFound && dsChannel >= 1 && dsChannel <= 13) break;
-        offset += 2 + tagLen;
-    }
-    
-    bool channelTrusted = (dsChannel >= 1 && dsChannel <= 13);
-    uint8_t channel = channelTrusted ? dsChannel : rxChannel;
-    
-    // Validate channel range (after DS channel override)
-    if (channel < 1 || channel > 13) return;
-    
-    // Parse auth mode from RSN (0x30) and WPA (0xDD) IEs
-    wifi_auth_mode_t authmode = WIFI_AUTH_OPEN;  // Default to open
-    bool hasRSN = false;
-    offset = 36;
-    while (offset + 2 < len) {
-        if (offset + 2 >= len) break; // Additional bounds check
-        uint8_t tagNum = payload[offset];
-        uint8_t tagLen = payload[offset + 1];
-        
-        if (offset + 2 + tagLen > len) break;
-        
-        if (tagNum == 0x30 && tagLen >= 2) {  // RSN IE = WPA2/WPA3
-            hasRSN = true;
-            authmode = WIFI_AUTH_WPA2_PSK;
-        } else if (tagNum == 0xDD && tagLen >= 8) {  // Vendor specific
-            // Check for WPA1 OUI: 00:50:F2:01
-            if (offset + 5 < len &&  // Ensure we don't read past buffer
-                payload[offset + 2] == 0x00 && payload[offset + 3] == 0x50 &&
-                payload[offset + 4] == 0xF2 && payload[offset + 5] == 0x01) {
-                // WPA1 - only set if not already WPA2
-                if (!hasRSN) {
-                    authmode = WIFI_AUTH_WPA_PSK;
-                } else {
-                    authmode = WIFI_AUTH_WPA_WPA2_PSK;
-                }
-            }
+        void beacon(const FrameDispatch::Beacon& b, uint8_t channel, bool channelTrusted, int8_t rssi) {
+            char ssid[33];
+            b.info.copySSID(ssid);
+            // Auth mode from RSN AKM suites / WPA vendor IE, PMF from RSN capabilities
+            onBeacon(b.bssid, channel, channelTrusted, rssi, ssid,
+                     IEParser::authMode(b.info), b.info.hasPMF(), b.probeResponse);
         }
-        
-        offset += 2 + tagLen;
-    }
-    
-    // Detect PMF (Protected Management Frames)
-    bool hasPMF = detectPMF(payload, len);
-    
-    // If PMF is required and we have RSN, it's WPA3 (or WPA2/3 transitional)
-    if (hasPMF && authmode == WIFI_AUTH_WPA2_PSK) {
-        authmode = WIFI_AUTH_WPA3_PSK;
-    }
-    
-    // Update spectrum data
-    onBeacon(bssid, channel, channelTrusted, rssi, ssid, authmode, hasPMF, isProbeResponse);
+    } sink;
+    FrameDispatch::spectrum(pkt, type, rxChannel, sink);
 }
 
 // Check if auth mode is considered vulnerable (OPEN, WEP, WPA1)
@@ -2190,53 +2090,6 @@ const char* SpectrumMode::authModeToShortString(wifi_auth_mode_t mode) {
     }
 }
 
-// Detect PMF (Protected Management Frames) from RSN IE
-// Networks with PMF required (MFPR=1) are immune to deauth attacks
-bool SpectrumMode::detectPMF(const uint8_t* payload, uint16_t len) {
-    uint16_t offset = 36;  // After fixed beacon fields
-    
-    while (offset + 2 < len) {
-        uint8_t tag = payload[offset];
-        uint8_t tagLen = payload[offset + 1];
-        
-        if (offset + 2 + tagLen > len) break;
-        
-        if (tag == 0x30 && tagLen >= 8) {  // RSN IE
-            // RSN IE structure: version(2) + group cipher(4) + pairwise count(2) + ...
-            uint16_t rsnOffset = offset + 2;
-            uint16_t rsnEnd = rsnOffset + tagLen;
-            
-            // Skip version (2), group cipher (4)
-            rsnOffset += 6;
-            if (rsnOffset + 2 > rsnEnd) break;
-            
-            // Pairwise cipher count and suites
-            uint16_t pairwiseCount = payload[rsnOffset] | (payload[rsnOffset + 1] << 8);
-            rsnOffset += 2 + (pairwiseCount * 4);
-            if (rsnOffset + 2 > rsnEnd) break;
-            
-            // AKM count and suites
-            uint16_t akmCount = payload[rsnOffset] | (payload[rsnOffset + 1] << 8);
-            rsnOffset += 2 + (akmCount * 4);
-            if (rsnOffset + 2 > rsnEnd) break;
-            
-            // RSN Capabilities (2 bytes)
-            uint16_t rsnCaps = payload[rsnOffset] | (payload[rsnOffset + 1] << 8);
-            
-            // Bit 7: MFPR (Management Frame Protection Required)
-            bool mfpr = (rsnCaps >> 7) & 0x01;
-            
-            if (mfpr) {
-                return true;  // PMF required - deauth won't work
-            }
-        }
-        
-        offset += 2 + tagLen;
-    }
-    
-    return false;
-}
-
 // Process data frame to extract client MAC
 void SpectrumMode::processDataFrame(const uint8_t* payload, uint16_t len, int8_t rssi) {
     if (!payload || len < 24) return;  // Too short for valid data frame or null payload
@@ -89,6 +89,8 @@ class SpectrumMode {
 public:
     static void init();
     static void start();
+    // start() one phase per call (mode switcher); true once running
+    static bool startStep();
     static void stop();
     static void update();
     static void draw(M5Canvas& canvas);
@@ -108,6 +110,7 @@ public:
     
 private:
     static bool running;
+    static uint8_t startPhase;  // Next startStep() phase, 0 when idle
     static std::atomic<bool> busy;   // Guard against callback race (atomic for cross-core visibility)
     static std::vector<SpectrumNetwork> networks;
     static SpectrumRenderNet renderNets[MAX_SPECTRUM_NETWORKS];
@@ -210,7 +213,6 @@ private:
     // Security helpers
     static bool isVulnerable(wifi_auth_mode_t mode);
     static const char* authModeToShortString(wifi_auth_mode_t mode);
-    static bool detectPMF(const uint8_t* payload, uint16_t len);
     static bool matchesFilter(const SpectrumNetwork& net);  // Check if network passes filter
     static bool matchesFilterRender(const SpectrumRenderNet& net);
     static void updateRenderSnapshot();
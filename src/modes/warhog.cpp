@@ -4,7 +4,10 @@
 // - No entries[] vector - data goes directly to disk
 // - No "waiting for GPS" state - either GPS or ML-only
 // - Simpler memory management - Bloom filter for duplicate detection
-// - Per-network file writes instead of batch saves
+// - Session files stay open; rows are batched in RAM and written in whole
+//   sectors (core/wardrive_rows.h)
+// - Optional passive mode: no scans, NetworkRecon beacon sightings keep the
+//   best-RSSI position per BSSID (core/wardrive_sightings.h)
 
 #include "warhog.h"
 #include "oink.h"
@@ -17,6 +20,8 @@
 #include "../core/sdlog.h"
 #include "../core/sd_layout.h"
 #include "../core/xp.h"
+#include "../core/wardrive_rows.h"
+#include "../core/wardrive_sightings.h"
 #include "../ui/display.h"
 #include "../piglet/mood.h"
 #include "../piglet/avatar.h"
@@ -60,6 +65,21 @@ static const int SD_RETRY_DELAY_MS = 10;
 // Files larger than this will be rotated to a new file
 static const size_t WIGLE_FILE_MAX_SIZE = 400000;
 
+// Per-file row buffer; full sectors go out as it fills
+static const size_t WARHOG_ROW_BUFFER_BYTES = 2048;
+// Queued rows are forced to SD at least this often (bounds loss on power cut)
+static const uint32_t WARHOG_FLUSH_INTERVAL_MS = 30000;
+// At or below this battery level every scan is flushed as soon as it's written
+static const int WARHOG_LOW_BATTERY_PCT = 10;
+
+// Passive mode: APs tracked at once (a full table writes out the quietest early)
+static const uint16_t PASSIVE_SLOTS = 96;
+// An AP not heard for this long has been passed; its best sighting is written
+static const uint32_t PASSIVE_QUIET_MS = 15000;
+// Fixes older than this don't geotag, and aren't interpolated across
+static const uint32_t PASSIVE_MAX_FIX_GAP_MS = 5000;
+static const uint32_t PASSIVE_SWEEP_MS = 1000;
+
 // Graceful stop request flag for background scan task
 static volatile bool stopRequested = false;
 // Set by scan task just before self-deleting, used for safe cleanup in stop()
@@ -90,6 +110,47 @@ static double haversineMeters(double lat1, double lon1, double lat2, double lon2
     return R * c;
 }
 
+// Open session output file + its RAM row buffer
+struct SessionOutput {
+    File file;
+    WardriveRows::SectorBuffer<WARHOG_ROW_BUFFER_BYTES> rows;
+};
+static SessionOutput csvOut;
+static SessionOutput wigleOut;
+static uint32_t lastOutputFlush = 0;
+static bool lowBattery = false;
+
+static bool queueRow(SessionOutput& out, const char* row, size_t len) {
+    auto sink = [&out](const uint8_t* data, size_t n) {
+        return out.file.write(data, n) == n;
+    };
+    return out.rows.append(row, len, sink);
+}
+
+static void flushOutput(SessionOutput& out) {
+    if (!out.file) return;
+    auto sink = [&out](const uint8_t* data, size_t n) {
+        return out.file.write(data, n) == n;
+    };
+    out.rows.flushAll(sink);
+    out.file.flush();
+}
+
+static void closeOutput(SessionOutput& out) {
+    if (!out.file) return;
+    flushOutput(out);
+    out.file.close();
+    out.rows.reset(0);
+}
+
+// Passive session state (slots allocated only while passive WARHOG runs)
+static bool passive = false;
+static WardriveSightings::BestTable sightingTable;
+static WardriveSightings::Entry* sightingSlots = nullptr;
+static uint32_t lastFixStamp = 0;
+static uint32_t lastPassiveSweep = 0;
+static uint32_t passiveNewSinceMood = 0;
+
 // Distance tracking state
 static double lastGPSLat = 0;
 static double lastGPSLon = 0;
@@ -175,19 +236,6 @@ static uint32_t clampScanIntervalMs(uint32_t intervalMs) {
     return (intervalMs < SCAN_INTERVAL_MIN_MS) ? SCAN_INTERVAL_MIN_MS : intervalMs;
 }
 
-// Helper to write CSV-escaped SSID field (quoted, doubles internal quotes, strips control chars)
-static void writeCSVField(File& f, const char* ssid) {
-    f.print("\"");
-    for (int i = 0; i < 32 && ssid[i]; i++) {
-        if (ssid[i] == '"') {
-            f.print("\"\"");
-        } else if (ssid[i] >= 32) {  // Skip control characters (newlines, etc)
-            f.print(ssid[i]);
-        }
-    }
-    f.print("\"");
-}
-
 void WarhogMode::init() {
     totalNetworks = 0;
     openNetworks = 0;
@@ -196,6 +244,7 @@ void WarhogMode::init() {
     savedCount = 0;
     currentFilename = "";
     currentWigleFilename = "";
+    lowBattery = false;
 
     resetSeenTracking();
 
@@ -211,8 +260,12 @@ void WarhogMode::start() {
     wepNetworks = 0;
     wpaNetworks = 0;
     savedCount = 0;
+    closeOutput(csvOut);
+    closeOutput(wigleOut);
     currentFilename = "";
     currentWigleFilename = "";
+    lastOutputFlush = millis();
+    lowBattery = false;
 
     resetSeenTracking();
     seedCapturedFromOink();
@@ -228,6 +281,18 @@ void WarhogMode::start() {
     // Reset stop flag for clean start
     stopRequested = false;
 
+    if (Config::gps().passiveWardrive && startPassive()) {
+        GPS::ensureContinuousMode();
+        running = true;
+        lastScanTime = 0;
+        Avatar::setGrassSpeed(200);
+        Avatar::setGrassMoving(GPS::hasFix());
+        Display::setWiFiStatus(true);
+        Mood::onWarhogUpdate();
+        Mood::setDialogueLock(true);
+        return;
+    }
+
     // Stop NetworkRecon before WiFi manipulation (uses promiscuous mode, incompatible with STA scanning)
     NetworkRecon::stop();
     
@@ -295,6 +360,13 @@ void WarhogMode::stop() {
     }
     scanInProgress = false;
     scanResult = -2;
+
+    // Passive: write out every AP still in range
+    stopPassive();
+
+    // Write out queued rows and close the session files
+    closeOutput(csvOut);
+    closeOutput(wigleOut);
     
     // Stop grass animation
     Avatar::setGrassMoving(false);
@@ -375,9 +447,20 @@ void WarhogMode::update() {
         if (freeHeap < HeapPolicy::kWarhogHeapCritical) {
             Display::showToast("LOW MEMORY!");
         }
+
+        // Stop holding rows in RAM when the battery may cut out
+        int battery = M5.Power.getBatteryLevel();
+        lowBattery = battery > 0 && battery <= WARHOG_LOW_BATTERY_PCT;
         lastHeapCheck = now;
     }
 
+    // Bound what a power cut or SD pull can lose
+    if (now - lastOutputFlush >= WARHOG_FLUSH_INTERVAL_MS) {
+        flushOutput(csvOut);
+        flushOutput(wigleOut);
+        lastOutputFlush = now;
+    }
+
     // Update grass animation based on GPS fix status
     bool hasGPSFix = GPS::hasFix();
     if (hasGPSFix != lastGPSState) {
@@ -406,6 +489,11 @@ void WarhogMode::update() {
         lastPhraseTime = now;
     }
     
+    if (passive) {
+        updatePassive(now);
+        return;
+    }
+
     // Check if background scan task is complete
     if (scanInProgress) {
         if (scanResult >= 0) {
@@ -478,9 +566,9 @@ void WarhogMode::performScan() {
     }
 }
 
-// Ensure CSV file exists with header
+// Open the session CSV (kept open until stop) and queue its header
 bool WarhogMode::ensureCSVFileReady() {
-    if (currentFilename.length() > 0) return true;
+    if (csvOut.file) return true;
     
     // Ensure wardriving directory exists
     const char* wardrivingDir = SDLayout::wardrivingDir();
@@ -492,58 +580,51 @@ bool WarhogMode::ensureCSVFileReady() {
     
     currentFilename = generateFilename("csv");
     
-    File f = openFileWithRetry(currentFilename.c_str(), FILE_WRITE);
-    if (!f) {
+    csvOut.file = openFileWithRetry(currentFilename.c_str(), FILE_WRITE);
+    if (!csvOut.file) {
         currentFilename = "";
         return false;
     }
+    csvOut.rows.reset(0);
     
-    f.println("BSSID,SSID,RSSI,Channel,AuthMode,Latitude,Longitude,Altitude,Timestamp");
-    f.close();
-    
-    return true;
+    static const char header[] = "BSSID,SSID,RSSI,Channel,AuthMode,Latitude,Longitude,Altitude,Timestamp\r\n";
+    return queueRow(csvOut, header, sizeof(header) - 1);
 }
 
-// Append single network to CSV file
+// Queue a single network for the session CSV
 void WarhogMode::appendCSVEntry(const uint8_t* bssid, const char* ssid,
                                  int8_t rssi, uint8_t channel, wifi_auth_mode_t auth,
-                                 double lat, double lon, double alt) {
+                                 double lat, double lon, double alt, uint32_t seenMs) {
     if (!ensureCSVFileReady()) return;
     
-    File f = openFileWithRetry(currentFilename.c_str(), FILE_APPEND);
-    if (!f) return;
-    
-    f.printf("%02X:%02X:%02X:%02X:%02X:%02X,",
-            bssid[0], bssid[1], bssid[2], bssid[3], bssid[4], bssid[5]);
-    writeCSVField(f, ssid);
-    f.print(",");
-    f.printf("%d,%d,%s,%.6f,%.6f,%.1f,%lu\n",
-            rssi, channel, authModeToString(auth).c_str(),
-            lat, lon, alt, millis());
-    f.close();
+    char row[WardriveRows::kMaxRow];
+    size_t len = WardriveRows::formatCsvRow(row, sizeof(row), bssid, ssid, rssi, channel,
+                                            authModeToString(auth), lat, lon, alt, seenMs);
+    if (len == 0) return;
+    if (!queueRow(csvOut, row, len)) {
+        // Write failed (card pulled/full): start a fresh file next time
+        csvOut.file.close();
+        csvOut.rows.reset(0);
+        currentFilename = "";
+    }
 }
 
-// Check if WiGLE file needs rotation due to size
+// Rotate the WiGLE file by its tracked size (no extra open to stat it)
 void WarhogMode::checkWigleFileRotation() {
-    if (currentWigleFilename.length() == 0) return;
+    if (!wigleOut.file) return;
     
-    File f = SD.open(currentWigleFilename.c_str(), FILE_READ);
-    if (!f) return;
-    
-    size_t fileSize = f.size();
-    f.close();
-    
-    if (fileSize >= WIGLE_FILE_MAX_SIZE) {
+    if (wigleOut.rows.size() >= WIGLE_FILE_MAX_SIZE) {
+        closeOutput(wigleOut);
         currentWigleFilename = "";  // Force new file creation on next append
     }
 }
 
-// Ensure WiGLE file exists with header
+// Open the session WiGLE file (kept open until stop/rotation) and queue its header
 bool WarhogMode::ensureWigleFileReady() {
     // Check if current file needs rotation
     checkWigleFileRotation();
     
-    if (currentWigleFilename.length() > 0) return true;
+    if (wigleOut.file) return true;
     
     // Ensure wardriving directory exists
     const char* wardrivingDir = SDLayout::wardrivingDir();
@@ -555,30 +636,32 @@ bool WarhogMode::ensureWigleFileReady() {
     
     currentWigleFilename = generateFilename("wigle.csv");
     
-    File f = openFileWithRetry(currentWigleFilename.c_str(), FILE_WRITE);
-    if (!f) {
+    wigleOut.file = openFileWithRetry(currentWigleFilename.c_str(), FILE_WRITE);
+    if (!wigleOut.file) {
         currentWigleFilename = "";
         return false;
     }
+    wigleOut.rows.reset(0);
     
-    // WiGLE format v1.6 pre-header
-    f.print("WigleWifi-1.6,appRelease=");
+    // WiGLE format v1.6 pre-header, then the column header
+    char header[WardriveRows::kMaxRow + 64];
     #ifdef BUILD_VERSION
-    f.print(BUILD_VERSION);
+    const char* release = BUILD_VERSION;
     #else
-    f.print("0.1.x");
+    const char* release = "0.1.x";
     #endif
-    f.print(",model=M5Cardputer,release=ESP32-S3,device=PORKCHOP,display=240x135,board=m5stack,brand=M5Stack,star=Sol,body=3,subBody=0\n");
-    
-    // WiGLE format header
-    f.println("MAC,SSID,AuthMode,FirstSeen,Channel,Frequency,RSSI,CurrentLatitude,CurrentLongitude,AltitudeMeters,AccuracyMeters,RCOIs,MfgrId,Type");
-    f.close();
-    
-    return true;
+    int len = snprintf(header, sizeof(header),
+        "WigleWifi-1.6,appRelease=%s,model=M5Cardputer,release=ESP32-S3,device=PORKCHOP,display=240x135,board=m5stack,brand=M5Stack,star=Sol,body=3,subBody=0\n",
+        release);
+    if (len <= 0 || (size_t)len >= sizeof(header) || !queueRow(wigleOut, header, (size_t)len)) {
+        return false;
+    }
+    static const char columns[] = "MAC,SSID,AuthMode,FirstSeen,Channel,Frequency,RSSI,CurrentLatitude,CurrentLongitude,AltitudeMeters,AccuracyMeters,RCOIs,MfgrId,Type\r\n";
+    return queueRow(wigleOut, columns, sizeof(columns) - 1);
 }
 
 // Convert auth mode to WiGLE capability string format
-String WarhogMode::authModeToWigleString(wifi_auth_mode_t mode) {
+const char* WarhogMode::authModeToWigleString(wifi_auth_mode_t mode) {
     switch (mode) {
         case WIFI_AUTH_OPEN:
             return "[ESS]";
@@ -617,63 +700,43 @@ static int channelToFrequency(uint8_t channel) {
     return 0;
 }
 
-// Append single network to WiGLE file
+// Queue a single network for the WiGLE file
 void WarhogMode::appendWigleEntry(const uint8_t* bssid, const char* ssid,
                                    int8_t rssi, uint8_t channel, wifi_auth_mode_t auth,
-                                   double lat, double lon, double alt, double accuracy) {
+                                   double lat, double lon, double alt, double accuracy,
+                                   uint32_t gpsDate, uint32_t gpsTime) {
     if (!ensureWigleFileReady()) return;
     
-    File f = openFileWithRetry(currentWigleFilename.c_str(), FILE_APPEND);
-    if (!f) return;
-    
-    // MAC (BSSID with colons)
-    f.printf("%02X:%02X:%02X:%02X:%02X:%02X,",
-            bssid[0], bssid[1], bssid[2], bssid[3], bssid[4], bssid[5]);
-    
-    // SSID (escaped)
-    writeCSVField(f, ssid);
-    f.print(",");
-    
-    // AuthMode (WiGLE capability string)
-    f.print(authModeToWigleString(auth));
-    f.print(",");
-    
-    // FirstSeen (timestamp) - use GPS time if available, else millis
-    GPSData gps = GPS::getData();
-    if (gps.date > 0 && gps.time > 0) {
+    // FirstSeen (timestamp) - GPS time of the observation if known, else millis
+    char firstSeen[24];
+    if (gpsDate > 0 && gpsTime > 0) {
         // date format: DDMMYY, time format: HHMMSSCC
-        uint8_t day = gps.date / 10000;
-        uint8_t month = (gps.date / 100) % 100;
-        uint8_t year = gps.date % 100;
-        uint8_t hour = gps.time / 1000000;
-        uint8_t minute = (gps.time / 10000) % 100;
-        uint8_t second = (gps.time / 100) % 100;
-        f.printf("20%02d-%02d-%02d %02d:%02d:%02d,", year, month, day, hour, minute, second);
+        uint8_t day = gpsDate / 10000;
+        uint8_t month = (gpsDate / 100) % 100;
+        uint8_t year = gpsDate % 100;
+        uint8_t hour = gpsTime / 1000000;
+        uint8_t minute = (gpsTime / 10000) % 100;
+        uint8_t second = (gpsTime / 100) % 100;
+        snprintf(firstSeen, sizeof(firstSeen), "20%02d-%02d-%02d %02d:%02d:%02d",
+                 year, month, day, hour, minute, second);
     } else {
         // Fallback - use boot time reference
-        f.printf("1970-01-01 00:00:%02d,", (millis() / 1000) % 60);
+        snprintf(firstSeen, sizeof(firstSeen), "1970-01-01 00:00:%02d", (int)((millis() / 1000) % 60));
     }
     
-    // Channel
-    f.printf("%d,", channel);
-    
-    // Frequency (best-effort mapping for 2.4/5/6 GHz)
-    int freq = channelToFrequency(channel);
-    f.printf("%d,", freq);
-    
-    // RSSI
-    f.printf("%d,", rssi);
-    
-    // Latitude, Longitude, Altitude
-    f.printf("%.6f,%.6f,%.1f,", lat, lon, alt);
-    
-    // AccuracyMeters (GPS HDOP as accuracy estimate, or default 10m)
-    f.printf("%.1f,", accuracy > 0 ? accuracy : 10.0);
-    
-    // RCOIs (empty), MfgrId (empty), Type (WIFI)
-    f.println(",,WIFI");
-    
-    f.close();
+    // Frequency is a best-effort mapping for 2.4/5/6 GHz; accuracy defaults to 10m
+    char row[WardriveRows::kMaxRow];
+    size_t len = WardriveRows::formatWigleRow(row, sizeof(row), bssid, ssid,
+                                              authModeToWigleString(auth), firstSeen,
+                                              channel, channelToFrequency(channel), rssi,
+                                              lat, lon, alt, accuracy);
+    if (len == 0) return;
+    if (!queueRow(wigleOut, row, len)) {
+        // Write failed (card pulled/full): start a fresh file next time
+        wigleOut.file.close();
+        wigleOut.rows.reset(0);
+        currentWigleFilename = "";
+    }
 }
 
 void WarhogMode::processScanResults() {
@@ -703,24 +766,10 @@ void WarhogMode::processScanResults() {
         uint8_t* bssidPtr = WiFi.BSSID(i);
         if (!bssidPtr) continue;
         
-        uint64_t bssidKey = bssidToKey(bssidPtr);
-        
         // Skip if already processed this session (Bloom filter)
-        if (bloomTest(seenBloom, SEEN_BLOOM_MASK, SEEN_BLOOM_HASHES, bssidKey)) {
+        if (!markSeen(bssidPtr)) {
             continue;
         }
-
-        // Mark as seen and update bounty reservoir before any file writes
-        bloomAdd(seenBloom, SEEN_BLOOM_MASK, SEEN_BLOOM_HASHES, bssidKey);
-        bountySeenTotal++;
-        if (bountyPoolCount < BOUNTY_POOL_SIZE) {
-            bountyPool[bountyPoolCount++] = bssidKey;
-        } else {
-            uint32_t pick = esp_random() % bountySeenTotal;
-            if (pick < BOUNTY_POOL_SIZE) {
-                bountyPool[pick] = bssidKey;
-            }
-        }
         
         // Extract network info
         String ssidStr = WiFi.SSID(i);
@@ -734,41 +783,21 @@ void WarhogMode::processScanResults() {
         if (channel == 0 || channel > 165) continue; // Valid WiFi channels are 1-165
 
         // Update statistics
-        totalNetworks++;
+        countNetwork(authmode);
         newThisScan++;
         
-        // Track auth types
-        switch (authmode) {
-            case WIFI_AUTH_OPEN:
-                openNetworks++;
-                XP::addXP(XPEvent::NETWORK_OPEN);
-                break;
-            case WIFI_AUTH_WEP:
-                wepNetworks++;
-                XP::addXP(XPEvent::NETWORK_WEP);
-                break;
-            case WIFI_AUTH_WPA3_PSK:
-            case WIFI_AUTH_WPA2_WPA3_PSK:
-                wpaNetworks++;
-                XP::addXP(XPEvent::NETWORK_WPA3);
-                break;
-            default:
-                wpaNetworks++;
-                XP::addXP(XPEvent::NETWORK_FOUND);
-                break;
-        }
-        
         // Write to files based on GPS status
         if (Config::isSDAvailable()) {
             if (hasGPS) {
                 // Full wardriving: both CSV, WiGLE, and ML
                 appendCSVEntry(bssidPtr, ssid, rssi, channel, authmode,
-                              gpsData.latitude, gpsData.longitude, gpsData.altitude);
+                              gpsData.latitude, gpsData.longitude, gpsData.altitude, millis());
                 
                 // WiGLE format export (HDOP * 5 as rough accuracy estimate in meters)
                 double accuracy = gpsData.hdop > 0 ? gpsData.hdop * 5.0 : 10.0;
                 appendWigleEntry(bssidPtr, ssid, rssi, channel, authmode,
-                                gpsData.latitude, gpsData.longitude, gpsData.altitude, accuracy);
+                                gpsData.latitude, gpsData.longitude, gpsData.altitude, accuracy,
+                                gpsData.date, gpsData.time);
                 
                 savedCount++;
                 geotaggedThisScan++;
@@ -777,6 +806,13 @@ void WarhogMode::processScanResults() {
         }
     }
     
+    // Low battery: don't leave this scan's rows in RAM
+    if (lowBattery && geotaggedThisScan > 0) {
+        flushOutput(csvOut);
+        flushOutput(wigleOut);
+        lastOutputFlush = millis();
+    }
+
     // Trigger mood update if we found new networks
     if (newThisScan > 0) {
         Mood::onWarhogFound(nullptr, 0);
@@ -786,6 +822,165 @@ void WarhogMode::processScanResults() {
     WiFi.scanDelete();
 }
 
+// First sighting of a BSSID this session: Bloom + bounty reservoir
+bool WarhogMode::markSeen(const uint8_t* bssid) {
+    uint64_t bssidKey = bssidToKey(bssid);
+    if (bloomTest(seenBloom, SEEN_BLOOM_MASK, SEEN_BLOOM_HASHES, bssidKey)) {
+        return false;
+    }
+
+    // Mark as seen and update bounty reservoir before any file writes
+    bloomAdd(seenBloom, SEEN_BLOOM_MASK, SEEN_BLOOM_HASHES, bssidKey);
+    bountySeenTotal++;
+    if (bountyPoolCount < BOUNTY_POOL_SIZE) {
+        bountyPool[bountyPoolCount++] = bssidKey;
+    } else {
+        uint32_t pick = esp_random() % bountySeenTotal;
+        if (pick < BOUNTY_POOL_SIZE) {
+            bountyPool[pick] = bssidKey;
+        }
+    }
+    return true;
+}
+
+void WarhogMode::countNetwork(wifi_auth_mode_t authmode) {
+    totalNetworks++;
+    
+    // Track auth types
+    switch (authmode) {
+        case WIFI_AUTH_OPEN:
+            openNetworks++;
+            XP::addXP(XPEvent::NETWORK_OPEN);
+            break;
+        case WIFI_AUTH_WEP:
+            wepNetworks++;
+            XP::addXP(XPEvent::NETWORK_WEP);
+            break;
+        case WIFI_AUTH_WPA3_PSK:
+        case WIFI_AUTH_WPA2_WPA3_PSK:
+            wpaNetworks++;
+            XP::addXP(XPEvent::NETWORK_WPA3);
+            break;
+        default:
+            wpaNetworks++;
+            XP::addXP(XPEvent::NETWORK_FOUND);
+            break;
+    }
+}
+
+// ============================================================================
+// Passive mode - NetworkRecon keeps hopping; every beacon is a sighting
+// ============================================================================
+
+bool WarhogMode::startPassive() {
+    sightingSlots = (WardriveSightings::Entry*)heap_caps_malloc(
+        sizeof(WardriveSightings::Entry) * PASSIVE_SLOTS, MALLOC_CAP_8BIT);
+    if (!sightingSlots) {
+        Serial.println("[WARHOG] Passive table alloc failed - using scans");
+        return false;
+    }
+    sightingTable.attach(sightingSlots, PASSIVE_SLOTS, Config::gps().interpolateFix,
+                         PASSIVE_MAX_FIX_GAP_MS);
+    lastFixStamp = 0;
+    lastPassiveSweep = millis();
+    passiveNewSinceMood = 0;
+    passive = true;
+
+    // Recon is normally already up; make sure it isn't paused
+    NetworkRecon::start();
+    NetworkRecon::setSightingCallback(onSighting);
+    Serial.printf("[WARHOG] Passive mode (%u slots, interp=%d)\n",
+                  (unsigned)PASSIVE_SLOTS, Config::gps().interpolateFix ? 1 : 0);
+    return true;
+}
+
+void WarhogMode::stopPassive() {
+    if (!passive) return;
+    NetworkRecon::setSightingCallback(nullptr);
+    auto emit = [](const WardriveSightings::Entry& e) { writeSighting(e); };
+    sightingTable.emitAll(emit);
+    sightingTable.detach();
+    heap_caps_free(sightingSlots);
+    sightingSlots = nullptr;
+    passive = false;
+}
+
+// Called from NetworkRecon::update() (main loop)
+void WarhogMode::onSighting(const DetectedNetwork& net, int8_t rssi, uint32_t seenMs) {
+    if (!running || !passive) return;
+    if (net.channel == 0 || net.channel > 165) return;
+
+    bool first = markSeen(net.bssid);
+    if (first) {
+        countNetwork(net.authmode);
+        passiveNewSinceMood++;
+    }
+
+    WardriveSightings::Sighting s;
+    s.bssid = net.bssid;
+    s.ssid = net.ssid;
+    s.auth = (uint8_t)net.authmode;
+    s.channel = net.channel;
+    s.rssi = rssi;
+    s.ms = seenMs;
+    s.first = first;
+    auto emit = [](const WardriveSightings::Entry& e) { writeSighting(e); };
+    sightingTable.observe(s, millis(), emit);
+}
+
+void WarhogMode::updatePassive(uint32_t now) {
+    // Each new GPS fix positions the sightings waiting on it
+    if (GPS::hasFix()) {
+        GPSData gps = GPS::getData();
+        if (gps.time != lastFixStamp) {
+            WardriveSightings::Fix fix;
+            fix.ms = now - gps.age;
+            fix.latE7 = WardriveSightings::toE7(gps.latitude);
+            fix.lonE7 = WardriveSightings::toE7(gps.longitude);
+            fix.alt = (float)gps.altitude;
+            fix.accuracy = gps.hdop > 0 ? gps.hdop * 5.0f : 10.0f;
+            fix.date = gps.date;
+            fix.time = gps.time;
+            sightingTable.onFix(fix);
+            lastFixStamp = gps.time;
+        }
+    }
+
+    if (now - lastPassiveSweep < PASSIVE_SWEEP_MS) return;
+    lastPassiveSweep = now;
+
+    auto emit = [](const WardriveSightings::Entry& e) { writeSighting(e); };
+    uint16_t written = sightingTable.emitQuiet(now, PASSIVE_QUIET_MS, emit);
+
+    if (lowBattery && written > 0) {
+        flushOutput(csvOut);
+        flushOutput(wigleOut);
+        lastOutputFlush = now;
+    }
+    if (passiveNewSinceMood > 0) {
+        Mood::onWarhogFound(nullptr, 0);
+        SDLOG("WARHOG", "Passive: %lu new, %u in range", passiveNewSinceMood,
+              (unsigned)sightingTable.size());
+        passiveNewSinceMood = 0;
+    }
+}
+
+// One row per AP per pass, at its strongest sighting. Only the first row
+// per BSSID counts and earns XP (as in scan mode): a later pass, or a
+// re-add after eviction, is written but not rewarded.
+void WarhogMode::writeSighting(const WardriveSightings::Entry& e) {
+    if (!Config::isSDAvailable()) return;
+    double lat = WardriveSightings::fromE7(e.pos.latE7);
+    double lon = WardriveSightings::fromE7(e.pos.lonE7);
+    wifi_auth_mode_t auth = (wifi_auth_mode_t)e.auth;
+    appendCSVEntry(e.bssid, e.ssid, e.rssi, e.channel, auth, lat, lon, e.pos.alt, e.bestMs);
+    appendWigleEntry(e.bssid, e.ssid, e.rssi, e.channel, auth, lat, lon, e.pos.alt,
+                     e.pos.accuracy, e.pos.date, e.pos.time);
+    if (!e.first) return;
+    savedCount++;
+    XP::addXP(XPEvent::WARHOG_LOGGED);
+}
+
 bool WarhogMode::hasGPSFix() {
     return GPS::hasFix();
 }
@@ -798,8 +993,9 @@ GPSData WarhogMode::getGPSData() {
 // They now read from the session CSV and convert format
 
 bool WarhogMode::exportCSV(const char* path) {
-    // Data is already in currentFilename as CSV
+    // Data is already in currentFilename as CSV (once queued rows are written)
     // This function would copy/rename, but for now just return status
+    flushOutput(csvOut);
     return currentFilename.length() > 0;
 }
 
@@ -819,7 +1015,7 @@ static String escapeXML(const char* str) {
     return result;
 }
 
-String WarhogMode::authModeToString(wifi_auth_mode_t mode) {
+const char* WarhogMode::authModeToString(wifi_auth_mode_t mode) {
     switch (mode) {
         case WIFI_AUTH_OPEN: return "OPEN";
         case WIFI_AUTH_WEP: return "WEP";
@@ -9,6 +9,9 @@
 #include <freertos/task.h>
 #include "../gps/gps.h"
 
+struct DetectedNetwork;
+namespace WardriveSightings { struct Entry; }
+
 // BSSID key for map lookup (6 bytes as uint64_t)
 inline uint64_t bssidToKey(const uint8_t* bssid) {
     return ((uint64_t)bssid[0] << 40) | ((uint64_t)bssid[1] << 32) |
@@ -72,19 +75,29 @@ private:
     static void performScan();
     static void scanTask(void* pvParameters);
     static void processScanResults();
+    static bool markSeen(const uint8_t* bssid);
+    static void countNetwork(wifi_auth_mode_t authmode);
+    
+    // Passive mode - NetworkRecon beacon sightings instead of scans
+    static bool startPassive();
+    static void stopPassive();
+    static void updatePassive(uint32_t now);
+    static void onSighting(const DetectedNetwork& net, int8_t rssi, uint32_t seenMs);
+    static void writeSighting(const WardriveSightings::Entry& e);
     
-    // File helpers - write directly per-network
+    // File helpers - session files stay open, rows are queued in RAM
     static bool ensureCSVFileReady();
     static bool ensureWigleFileReady();
     static void checkWigleFileRotation();
     static void appendCSVEntry(const uint8_t* bssid, const char* ssid,
                                int8_t rssi, uint8_t channel, wifi_auth_mode_t auth,
-                               double lat, double lon, double alt);
+                               double lat, double lon, double alt, uint32_t seenMs);
     static void appendWigleEntry(const uint8_t* bssid, const char* ssid,
                                  int8_t rssi, uint8_t channel, wifi_auth_mode_t auth,
-                                 double lat, double lon, double alt, double accuracy);
+                                 double lat, double lon, double alt, double accuracy,
+                                 uint32_t gpsDate, uint32_t gpsTime);
     
-    static String authModeToString(wifi_auth_mode_t mode);
-    static String authModeToWigleString(wifi_auth_mode_t mode);
+    static const char* authModeToString(wifi_auth_mode_t mode);
+    static const char* authModeToWigleString(wifi_auth_mode_t mode);
     static String generateFilename(const char* ext);
 };
@@ -2,6 +2,7 @@
 
 #include "avatar.h"
 #include "weather.h"
+#include "sprites.h"
 #include "../ui/display.h"
 #include <time.h>
 
@@ -531,81 +532,66 @@ void Avatar::drawFrame(M5Canvas& canvas, const char** frame, uint8_t lines, bool
     int startY = 23 + shakeY;  // Apply shake offset (shifted down for XP bar at top)
     int lineHeight = 22;
     
-    for (uint8_t i = 0; i < lines; i++) {
-        // Handle body line (i=2) for dynamic tail
-        if (i == 2) {
-            char bodyLine[16];
-            bool tailOnLeft = false;  // Track if tail prefix added (needs X offset)
-            if (grassMoving || pendingGrassStart) {
-                // Treadmill mode: always show tail
-                if (faceRight) {
-                    strncpy(bodyLine, "z(    )", sizeof(bodyLine));  // Tail on left when facing right
-                    tailOnLeft = true;
-                } else {
-                    strncpy(bodyLine, "(    )z", sizeof(bodyLine));  // Tail on right when facing left
-                }
-            } else if (transitioning) {
-                // During transition: show tail on trailing side
-                bool movingRight = (transitionToX > transitionFromX);
-                if (movingRight) {
-                    strncpy(bodyLine, "z(    )", sizeof(bodyLine));  // Tail trails on left
-                    tailOnLeft = true;
-                } else {
-                    strncpy(bodyLine, "(    )z", sizeof(bodyLine));  // Tail trails on right
-                }
-            } else {
-                // Stationary: always show tail based on facing direction
-                if (faceRight) {
-                    strncpy(bodyLine, "z(    )", sizeof(bodyLine));  // Facing right, tail on left
-                    tailOnLeft = true;
-                } else {
-                    strncpy(bodyLine, "(    )z", sizeof(bodyLine));  // Facing left, tail on right
-                }
-            }
-            bodyLine[sizeof(bodyLine) - 1] = '\0';
+    // Body line (i=2) carries the dynamic tail
+    char bodyLine[16];
+    bool tailOnLeft = false;  // Track if tail prefix added (needs X offset)
+    if (grassMoving || pendingGrassStart) {
+        // Treadmill mode: always show tail
+        tailOnLeft = faceRight;  // Tail on left when facing right
+    } else if (transitioning) {
+        // During transition: show tail on trailing side
+        tailOnLeft = (transitionToX > transitionFromX);
+    } else {
+        // Stationary: always show tail based on facing direction
+        tailOnLeft = faceRight;
+    }
+    strncpy(bodyLine, tailOnLeft ? "z(    )" : "(    )z", sizeof(bodyLine));
+    bodyLine[sizeof(bodyLine) - 1] = '\0';
+    
+    // Face line (i=1) - modify eye and/or nose
+    // Face format: "(X 00)" for right-facing, "(00 X)" for left-facing
+    char faceLine[16];
+    strncpy(faceLine, frame[1], sizeof(faceLine) - 1);
+    faceLine[sizeof(faceLine) - 1] = '\0';
+    if (blink) {
+        // Replace eye character with '-' for blink
+        if (faceRight) {
+            faceLine[1] = '-';  // Eye position in "(X 00)"
+        } else {
+            faceLine[4] = '-';  // Eye position in "(00 X)"
+        }
+    }
+    if (sniff) {
+        // Animated sniff - cycle through nose shapes
+        char n1, n2;
+        switch (sniffFrame) {
+            case 0: n1 = 'o'; n2 = 'o'; break;  // oo
+            case 1: n1 = 'o'; n2 = 'O'; break;  // oO
+            case 2: n1 = 'O'; n2 = 'o'; break;  // Oo
+            default: n1 = 'o'; n2 = 'o'; break;
+        }
+        // Nose is at positions 3-4 for right-facing "(X 00)"
+        // Nose is at positions 1-2 for left-facing "(00 X)"
+        if (faceRight) {
+            faceLine[3] = n1;
+            faceLine[4] = n2;
+        } else {
+            faceLine[1] = n1;
+            faceLine[2] = n2;
+        }
+    }
+    
+    // Pre-rendered frame for this variant, blitted in the thunder-aware color
+    const char* pigLines[3] = { frame[0], faceLine, bodyLine };
+    uint32_t key = SpriteCache::avatarKey((uint8_t)currentState, faceRight, blink,
+                                          sniff ? (uint8_t)(sniffFrame + 1) : 0, tailOnLeft);
+    if (!PigSprites::drawPig(canvas, key, pigLines, tailOnLeft, startX, startY, getDrawColor())) {
+        // No cache memory: rasterise the text directly
+        for (uint8_t i = 0; i < lines && i < 3; i++) {
             // When tail is on left (z prefix), offset X back by 1 char width (18px at size 3)
             // to keep body aligned with head
-            int bodyX = tailOnLeft ? (startX - 18) : startX;
-            canvas.drawString(bodyLine, bodyX, startY + i * lineHeight);
-        } else if (i == 1 && (blink || sniff)) {
-            // Face line - modify eye and/or nose
-            // Face format: "(X 00)" for right-facing, "(00 X)" for left-facing
-            char modifiedLine[16];
-            strncpy(modifiedLine, frame[i], sizeof(modifiedLine) - 1);
-            modifiedLine[sizeof(modifiedLine) - 1] = '\0';
-            
-            if (blink) {
-                // Replace eye character with '-' for blink
-                if (faceRight) {
-                    modifiedLine[1] = '-';  // Eye position in "(X 00)"
-                } else {
-                    modifiedLine[4] = '-';  // Eye position in "(00 X)"
-                }
-            }
-            
-            if (sniff) {
-                // Animated sniff - cycle through nose shapes
-                char n1, n2;
-                switch (sniffFrame) {
-                    case 0: n1 = 'o'; n2 = 'o'; break;  // oo
-                    case 1: n1 = 'o'; n2 = 'O'; break;  // oO
-                    case 2: n1 = 'O'; n2 = 'o'; break;  // Oo
-                    default: n1 = 'o'; n2 = 'o'; break;
-                }
-                // Nose is at positions 3-4 for right-facing "(X 00)"
-                // Nose is at positions 1-2 for left-facing "(00 X)"
-                if (faceRight) {
-                    modifiedLine[3] = n1;
-                    modifiedLine[4] = n2;
-                } else {
-                    modifiedLine[1] = n1;
-                    modifiedLine[2] = n2;
-                }
-            }
-            
-            canvas.drawString(modifiedLine, startX, startY + i * lineHeight);
-        } else {
-            canvas.drawString(frame[i], startX, startY + i * lineHeight);
+            int lineX = (i == 2 && tailOnLeft) ? (startX - 18) : startX;
+            canvas.drawString(pigLines[i], lineX, startY + i * lineHeight);
         }
     }
     
@@ -736,7 +722,12 @@ void Avatar::drawGrass(M5Canvas& canvas) {
     
     // Draw at bottom of avatar area, full screen width
     int grassY = 91;  // Below the pig face (at edge of main canvas)
-    canvas.drawString(grassPattern, 0, grassY);
+    // Still grass is a cached strip; moving grass changes every shift, so
+    // rasterising it into the cache would only add a copy
+    if (grassMoving || !PigSprites::drawStrip(canvas, SpriteCache::Kind::Grass, grassPattern,
+                                              grassY, getDrawColor())) {
+        canvas.drawString(grassPattern, 0, grassY);
+    }
 }
 
 // --- Night sky star system ---
@@ -0,0 +1,166 @@
+// Piglet sprite store implementation
+
+#include "sprites.h"
+#include "../core/heap_policy.h"
+#include <esp_heap_caps.h>
+
+namespace PigSprites {
+
+static const size_t PIG_SLOT_BYTES = (size_t)((PIG_BMP_W + 7) / 8) * PIG_BMP_H;
+static const size_t STRIP_SLOT_BYTES = (size_t)((STRIP_W + 7) / 8) * STRIP_H;
+static const size_t PIG_BYTES = PIG_SLOTS * PIG_SLOT_BYTES;
+static const size_t STORAGE_BYTES = PIG_BYTES + STRIP_SLOTS * STRIP_SLOT_BYTES;
+static const uint32_t ALLOC_RETRY_MS = 10000;
+
+static SpriteCache::Cache pigCache;
+static SpriteCache::Cache stripCache;
+static uint8_t* storage = nullptr;
+static int8_t rasterState = 0;      // 0 unchecked, 1 matches drawString, -1 doesn't
+static bool allocTried = false;
+static uint32_t lastAllocMs = 0;
+
+// Raster target: a 1-bit sprite pointed at the cache slot being filled
+static M5Canvas raster;
+
+// Run rects straight into the destination canvas
+struct CanvasRuns {
+    M5Canvas& canvas;
+    uint16_t color;
+    CanvasRuns(M5Canvas& c, uint16_t col) : canvas(c), color(col) {}
+    void operator()(int x, int y, int w, int h) { canvas.fillRect(x, y, w, h, color); }
+};
+
+static void beginRaster(uint8_t* bits, uint16_t w, uint16_t h, uint8_t textSize) {
+    // Slot is already zeroed; set bits are the glyph pixels
+    raster.setBuffer(bits, w, h, raster.getColorDepth());
+    raster.setFont(&fonts::Font0);
+    raster.setTextSize(textSize);
+    raster.setTextDatum(top_left);
+    raster.setTextColor(TFT_WHITE);
+}
+
+/**
+ * The 1-bit raster sprite has no palette, so which bit a glyph pixel sets
+ * is up to LGFX's colour conversion. Draw a probe string both ways, through
+ * the raster into a bitmap and with drawString on a 16-bit sprite, and
+ * compare every pixel. On a mismatch the cache stays off and callers keep
+ * drawing text (native tests only cover the bitmap/blit side).
+ * @return false if the check couldn't run (no heap for the 16-bit sprite)
+ */
+static bool rasterMatchesDrawString(bool& match) {
+    static const char PROBE[] = "(o0)/\\z?";
+    static const uint16_t W = (sizeof(PROBE) - 1) * 6 * 2;
+    static const uint16_t H = 8 * 2;
+    uint8_t bits[((W + 7) / 8) * H];
+    memset(bits, 0, sizeof(bits));
+    raster.setColorDepth(1);
+    beginRaster(bits, W, H, 2);
+    raster.drawString(PROBE, 0, 0);
+
+    M5Canvas check;
+    check.setColorDepth(16);
+    if (!check.createSprite(W, H)) return false;
+    check.fillSprite(TFT_BLACK);
+    check.setFont(&fonts::Font0);
+    check.setTextSize(2);
+    check.setTextDatum(top_left);
+    check.setTextColor(TFT_WHITE);
+    check.drawString(PROBE, 0, 0);
+
+    uint32_t mismatches = 0;
+    uint32_t lit = 0;
+    for (int y = 0; y < H; y++) {
+        for (int x = 0; x < W; x++) {
+            bool want = check.readPixel(x, y) != 0;
+            lit += want;
+            if (want != SpriteCache::getPixel(bits, W, x, y)) mismatches++;
+        }
+    }
+    check.deleteSprite();
+    match = mismatches == 0 && lit > 0;
+    if (!match) {
+        Serial.printf("[SPRITES] Raster check failed (%u/%u px differ), cache off\n",
+                      (unsigned int)mismatches, (unsigned int)(W * H));
+    }
+    return true;
+}
+
+static bool ensureStorage() {
+    if (storage) return true;
+    if (rasterState < 0) return false;
+    uint32_t now = millis();
+    if (allocTried && now - lastAllocMs < ALLOC_RETRY_MS) return false;
+    allocTried = true;
+    lastAllocMs = now;
+
+    if (rasterState == 0) {
+        bool match;
+        if (!rasterMatchesDrawString(match)) return false;  // Retried with the allocation
+        rasterState = match ? 1 : -1;
+        if (!match) return false;
+    }
+
+    if (psramFound()) {
+        storage = (uint8_t*)heap_caps_malloc(STORAGE_BYTES, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    }
+    if (!storage && ESP.getFreeHeap() >= STORAGE_BYTES + HeapPolicy::kMinHeapForSpriteCache) {
+        storage = (uint8_t*)heap_caps_malloc(STORAGE_BYTES, MALLOC_CAP_8BIT);
+    }
+    if (!storage) return false;
+
+    pigCache.attach(storage, PIG_BYTES, PIG_SLOT_BYTES);
+    stripCache.attach(storage + PIG_BYTES, STORAGE_BYTES - PIG_BYTES, STRIP_SLOT_BYTES);
+    raster.setColorDepth(1);
+    Serial.printf("[SPRITES] Cache %u bytes (%u pig frames, %u strips)\n",
+                  (unsigned int)STORAGE_BYTES, (unsigned int)PIG_SLOTS, (unsigned int)STRIP_SLOTS);
+    return true;
+}
+
+bool drawPig(M5Canvas& canvas, uint32_t key, const char* const lines[3], bool tailLeft,
+             int x, int y, uint16_t color) {
+    if (!ensureStorage()) return false;
+
+    const uint8_t* bits = pigCache.find(key);
+    if (!bits) {
+        uint8_t* slot = pigCache.insert(key);
+        if (!slot) return false;
+        beginRaster(slot, PIG_BMP_W, PIG_BMP_H, 3);
+        raster.drawString(lines[0], PIG_CHAR_W, 0);
+        raster.drawString(lines[1], PIG_CHAR_W, PIG_LINE_H);
+        raster.drawString(lines[2], tailLeft ? 0 : PIG_CHAR_W, 2 * PIG_LINE_H);
+        bits = slot;
+    }
+
+    CanvasRuns sink(canvas, color);
+    SpriteCache::blitRuns(bits, PIG_BMP_W, PIG_BMP_H, x - PIG_CHAR_W, y,
+                          canvas.width(), canvas.height(), sink);
+    return true;
+}
+
+bool drawStrip(M5Canvas& canvas, SpriteCache::Kind kind, const char* text, int y, uint16_t color) {
+    if (!ensureStorage()) return false;
+
+    uint32_t key = SpriteCache::textKey(kind, text);
+    const uint8_t* bits = stripCache.find(key);
+    if (!bits) {
+        uint8_t* slot = stripCache.insert(key);
+        if (!slot) return false;
+        beginRaster(slot, STRIP_W, STRIP_H, 2);
+        raster.drawString(text, 0, 0);
+        bits = slot;
+    }
+
+    CanvasRuns sink(canvas, color);
+    SpriteCache::blitRuns(bits, STRIP_W, STRIP_H, 0, y, canvas.width(), canvas.height(), sink);
+    return true;
+}
+
+SpriteCache::Stats getPigStats() {
+    return pigCache.getStats();
+}
+
+SpriteCache::Stats getStripStats() {
+    return stripCache.getStats();
+}
+
+}  // namespace PigSprites
@@ -0,0 +1,43 @@
+// Piglet sprite store - pre-rendered avatar frames and text strips
+// Pig frames (per expression, facing, blink/sniff, tail side) and the grass
+// and cloud strips are rasterised once into 1-bpp SpriteCache slots and
+// blitted in the current (thunder-aware) colour. Storage is allocated on
+// first use within a fixed budget; without it callers draw text as before.
+#pragma once
+
+#include <M5Unified.h>
+#include "../core/sprite_cache.h"
+
+namespace PigSprites {
+
+// Pig frame geometry at text size 3 (Font0 6x8 glyph -> 18x24)
+static const int PIG_CHAR_W = 18;
+static const int PIG_LINE_H = 22;
+static const uint16_t PIG_BMP_W = 8 * PIG_CHAR_W;           // Tail column + 7 chars
+static const uint16_t PIG_BMP_H = 2 * PIG_LINE_H + 24;      // 3 lines, last one full height
+static const uint8_t PIG_SLOTS = 8;                         // ~9.6 KB
+
+// Full-width text strip at size 2 (grass, clouds)
+static const uint16_t STRIP_W = 240;
+static const uint16_t STRIP_H = 16;
+static const uint8_t STRIP_SLOTS = 3;                       // ~1.4 KB
+
+/**
+ * Blit the pig frame for key. lines[0..2] are the three text lines; line 2
+ * is drawn one column further left when tailLeft. (x, y) is where the
+ * head's first character goes, as with drawString.
+ * @return false if the cache is unavailable (caller draws the text itself)
+ */
+bool drawPig(M5Canvas& canvas, uint32_t key, const char* const lines[3], bool tailLeft,
+             int x, int y, uint16_t color);
+
+/**
+ * Blit a size-2 text strip at (0, y), rasterising it on first sight.
+ * @return false if the cache is unavailable
+ */
+bool drawStrip(M5Canvas& canvas, SpriteCache::Kind kind, const char* text, int y, uint16_t color);
+
+SpriteCache::Stats getPigStats();
+SpriteCache::Stats getStripStats();
+
+}  // namespace PigSprites
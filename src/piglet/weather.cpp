@@ -3,6 +3,7 @@
 
 #include "weather.h"
 #include "avatar.h"
+#include "sprites.h"
 #include "../ui/display.h"
 #include <esp_random.h>
 
@@ -414,7 +415,10 @@ void drawClouds(M5Canvas& canvas, uint16_t colorFG) {
     
     // Draw in sky below top bar, above pig's head
     int cloudY = 2;  // Near top of main canvas
-    canvas.drawString(cloudPattern, 0, cloudY);
+    // Pattern only shifts every cloudSpeed ms: blit the cached strip
+    if (!PigSprites::drawStrip(canvas, SpriteCache::Kind::Clouds, cloudPattern, cloudY, drawColor)) {
+        canvas.drawString(cloudPattern, 0, cloudY);
+    }
 }
 
 void draw(M5Canvas& canvas, uint16_t colorFG, uint16_t colorBG) {
@@ -431,11 +435,10 @@ void draw(M5Canvas& canvas, uint16_t colorFG, uint16_t colorBG) {
             if (y < 0) continue;
             
             // Draw 6-pixel tall × 2-pixel wide raindrop (slightly taller for visibility)
-            for (int dy = 0; dy < 6; dy++) {
-                if (y + dy < 88) {  // Clip 3px above grass (grass starts at Y=91)
-                    canvas.drawPixel(x, y + dy, drawColor);
-                    if (x + 1 < 240) canvas.drawPixel(x + 1, y + dy, drawColor);
-                }
+            // as one rect, clipped 3px above grass (grass starts at Y=91)
+            int h = (y + 6 <= 88) ? 6 : 88 - y;
+            if (h > 0) {
+                canvas.fillRect(x, y, (x + 1 < 240) ? 2 : 1, h, drawColor);
             }
         }
     }
@@ -14,19 +14,20 @@
 #include "../core/wifi_utils.h"
 
 // Static member initialization
-std::vector<CaptureInfo> CapturesMenu::captures;
-uint8_t CapturesMenu::selectedIndex = 0;
-uint8_t CapturesMenu::scrollOffset = 0;
+uint16_t CapturesMenu::selectedIndex = 0;
+uint16_t CapturesMenu::scrollOffset = 0;
 bool CapturesMenu::active = false;
 bool CapturesMenu::keyWasPressed = false;
 bool CapturesMenu::nukeConfirmActive = false;
 bool CapturesMenu::detailViewActive = false;
+CaptureCatalog::Entry CapturesMenu::page[CapturesMenu::VISIBLE_ITEMS];
+uint16_t CapturesMenu::pageStart = 0;
+uint8_t CapturesMenu::pageCount = 0;
+bool CapturesMenu::pageValid = false;
+CaptureCatalog::Summary CapturesMenu::totals = {};
+char CapturesMenu::detailPassword[65] = "";
 bool CapturesMenu::scanInProgress = false;
 unsigned long CapturesMenu::lastScanTime = 0;
-File CapturesMenu::scanDir;
-File CapturesMenu::currentFile;
-bool CapturesMenu::scanComplete = false;
-size_t CapturesMenu::scanProgress = 0;
 bool CapturesMenu::wpasecUpdateInProgress = false;
 unsigned long CapturesMenu::lastWpasecUpdateTime = 0;
 size_t CapturesMenu::wpasecUpdateProgress = 0;
@@ -44,9 +45,10 @@ uint16_t CapturesMenu::syncCracked = 0;
 char CapturesMenu::syncError[48] = "";
 
 void CapturesMenu::init() {
-    captures.clear();
+    CaptureCatalog::release();
     selectedIndex = 0;
     scrollOffset = 0;
+    pageValid = false;
 }
 
 void CapturesMenu::show() {
@@ -55,7 +57,7 @@ void CapturesMenu::show() {
     scrollOffset = 0;
     keyWasPressed = true;  // Ignore the Enter that selected us from menu
 
-    // If scan fails, the captures list will remain empty
+    // If loading fails, the catalog stays empty
     // This is handled by the draw function which shows "No captures found"
     scanCaptures();
 }
@@ -67,19 +69,14 @@ void CapturesMenu::hide() {
     emergencyCleanup();
     
     // Enhanced: Force cleanup even if interrupted
-    captures.clear();
-    captures.shrink_to_fit();  // Release vector capacity
+    CaptureCatalog::abortRebuild();
+    CaptureCatalog::release();
     WPASec::freeCacheMemory();
     
     // Reset all async state to prevent leaks (redundant after emergencyCleanup but safe)
     scanInProgress = false;
     wpasecUpdateInProgress = false;
-    if (scanDir) {
-        scanDir.close();
-    }
-    if (currentFile) {
-        currentFile.close();
-    }
+    pageValid = false;
 }
 
 void CapturesMenu::emergencyCleanup() {
@@ -87,31 +84,29 @@ void CapturesMenu::emergencyCleanup() {
     if (!active) return;
     
     Serial.println("[CAPTURES] Emergency cleanup triggered");
-    captures.clear();
-    captures.shrink_to_fit();
+    CaptureCatalog::abortRebuild();
+    CaptureCatalog::release();
     WPASec::freeCacheMemory();
     
     // Stop any in-progress operations
     scanInProgress = false;
     wpasecUpdateInProgress = false;
-    if (scanDir) {
-        scanDir.close();
-    }
-    if (currentFile) {
-        currentFile.close();
-    }
+    pageValid = false;
+    pageCount = 0;
+    memset(&totals, 0, sizeof(totals));
 }
 
 bool CapturesMenu::scanCaptures() {
-    // Initialize async scan
-    captures.clear();
-    captures.reserve(MAX_CAPTURES);
+    pageValid = false;
+    pageCount = 0;
+    memset(&totals, 0, sizeof(totals));
+    scanInProgress = false;
+    wpasecUpdateInProgress = false;
 
     // Guard: Skip if no SD card available
     if (!Config::isSDAvailable()) {
         Serial.println("[CAPTURES] No SD card available");
-        scanComplete = true;
-        scanInProgress = false;
+        CaptureCatalog::release();
         return false;
     }
 
@@ -121,182 +116,72 @@ bool CapturesMenu::scanCaptures() {
         Serial.println("[CAPTURES] No handshakes directory, creating...");
         if (!SD.mkdir(handshakesDir)) {
             Serial.println("[CAPTURES] Failed to create handshakes directory");
-            scanComplete = true;
-            scanInProgress = false;
             return false;
         }
     }
 
-    scanDir = SD.open(handshakesDir);
-    if (!scanDir || !scanDir.isDirectory()) {
+    // Normal path: the whole catalog in one sequential read
+    if (CaptureCatalog::load()) {
+        CaptureCatalog::summary(totals);
+        startWPASecUpdate();
+        Serial.printf("[CAPTURES] Catalog loaded. Found %u captures\n", (unsigned)totals.total);
+        return true;
+    }
+
+    // No usable catalog: rebuild it from the directory in chunks
+    if (!CaptureCatalog::beginRebuild()) {
         Serial.println("[CAPTURES] Failed to open handshakes directory");
-        scanComplete = true;
-        scanInProgress = false;
-        scanDir.close();
         return false;
     }
-
     scanInProgress = true;
-    scanComplete = false;
-    scanProgress = 0;
     lastScanTime = millis();
-    
+    Serial.println("[CAPTURES] Rebuilding capture catalog...");
     return true;
 }
 
 void CapturesMenu::processAsyncScan() {
-    if (!scanInProgress || scanComplete) {
+    if (!scanInProgress) {
         return;
     }
     
-    // Throttle the scan to avoid blocking the UI
+    // Throttle the rebuild to avoid blocking the UI
     if (millis() - lastScanTime < SCAN_DELAY) {
         return;
     }
     
     lastScanTime = millis();
     
-    // Process a chunk of files
-    size_t processed = 0;
-    while (processed < SCAN_CHUNK_SIZE && !scanComplete) {
-        currentFile = scanDir.openNextFile();
-        
-        if (!currentFile) {
-            // No more files, we're done with scanning
-            scanComplete = true;
-            scanInProgress = false;
-            scanDir.close();
-            
-            // Sort by capture time (newest first)
-            std::sort(captures.begin(), captures.end(), [](const CaptureInfo& a, const CaptureInfo& b) {
-                return a.captureTime > b.captureTime;
-            });
-
-            // Start async WPA-SEC status update after scanning is complete
-            if (!captures.empty()) {
-                wpasecUpdateInProgress = true;
-                wpasecUpdateProgress = 0;
-                lastWpasecUpdateTime = millis();
-            }
-
-            Serial.printf("[CAPTURES] Async scan complete. Found %d captures\n", captures.size());
-            break;
-        }
-        
-        String name = currentFile.name();
-        bool isPCAP = name.endsWith(".pcap");
-        bool isPMKID = name.endsWith(".22000") && !name.endsWith("_hs.22000");
-        bool isHS22000 = name.endsWith("_hs.22000");
-
-        // Skip PCAP if we have the corresponding _hs.22000 (avoid duplicates).
-        // Prefer showing _hs.22000 because it's hashcat-ready.
-        if (isPCAP) {
-            String baseName = name.substring(0, name.indexOf('.'));
-            String hs22kPath = String(SDLayout::handshakesDir()) + "/" + baseName + "_hs.22000";
-            if (SD.exists(hs22kPath)) {
-                // Close current file and continue to next
-                currentFile.close();
-                processed++;
-                continue;
-            }
-        }
-
-        if (isPCAP || isPMKID || isHS22000) {
-            CaptureInfo info;
-            info.filename = name;
-            info.fileSize = currentFile.size();
-            info.captureTime = currentFile.getLastWrite();
-            info.isPMKID = isPMKID;  // Only true for PMKID files
-
-            // Extract BSSID from filename (e.g., "64EEB7208286.pcap" or "64EEB7208286_hs.22000")
-            String baseName = name.substring(0, name.indexOf('.'));
-            // Handle _hs suffix for handshake 22000 files
-            if (baseName.endsWith("_hs")) {
-                baseName = baseName.substring(0, baseName.length() - 3);
-            }
-            if (baseName.length() >= 12) {
-                info.bssid = baseName.substring(0, 2) + ":" +
-                             baseName.substring(2, 4) + ":" +
-                             baseName.substring(4, 6) + ":" +
-                             baseName.substring(6, 8) + ":" +
-                             baseName.substring(8, 10) + ":" +
-                             baseName.substring(10, 12);
-            } else {
-                info.bssid = baseName;
-            }
-
-            // Try to get SSID from companion .txt file if it exists. For PMKID we use _pmkid.txt suffix, otherwise .txt
-            String txtPath = isPMKID ?
-                (String(SDLayout::handshakesDir()) + "/" + baseName + "_pmkid.txt") :
-                (String(SDLayout::handshakesDir()) + "/" + baseName + ".txt");
-            if (SD.exists(txtPath)) {
-                File txtFile = SD.open(txtPath, FILE_READ);
-                if (txtFile) {
-                    info.ssid = txtFile.readStringUntil('\n');
-                    info.ssid.trim();
-                    txtFile.close();
-                }
-            }
-            if (info.ssid.isEmpty()) {
-                info.ssid = "[UNKNOWN]";
-            }
-
-            // Default status and password
-            info.status = CaptureStatus::LOCAL;
-            info.password = "";
-
-            captures.push_back(info);
-            
-            // Hard cap at 100 captures to prevent OOM on devices with limited heap
-            if (captures.size() >= 100) {
-                scanComplete = true;
-                scanInProgress = false;
-                currentFile.close();
-                scanDir.close();
-                Serial.println("[CAPTURES] Hit 100 capture limit, stopped scan");
-                break;
-            }
-        }
-
-        // Close current file and increment counter
-        currentFile.close();
-        processed++;
-        scanProgress++;
-        
-        // Yield periodically to allow other tasks to run
-        if (processed >= SCAN_CHUNK_SIZE) {
-            // Still more to do, but yield control back to other tasks
-            break;
-        }
+    if (!CaptureCatalog::rebuildStep(SCAN_CHUNK_SIZE)) {
+        return;  // More directory entries next tick
     }
+    
+    scanInProgress = false;
+    pageValid = false;
+    CaptureCatalog::summary(totals);
+    startWPASecUpdate();
+    Serial.printf("[CAPTURES] Async rebuild complete. Found %u captures\n", (unsigned)totals.total);
 }
 
-void CapturesMenu::updateWPASecStatus() {
-    // Load WPA-SEC cache (lazy, only loads once)
-    WPASec::loadCache();
-    
-    char normalized[13] = {0};
-    for (auto& cap : captures) {
-        // Normalize BSSID for lookup (remove colons)
-        WPASec::normalizeBSSID_Char(cap.bssid.c_str(), normalized, sizeof(normalized));
-        if (normalized[0] == '\0') {
-            cap.status = CaptureStatus::LOCAL;
-            continue;
-        }
-        
-        if (WPASec::isCracked(normalized)) {
-            cap.status = CaptureStatus::CRACKED;
-            cap.password = WPASec::getPassword(normalized);
-        } else if (WPASec::isUploaded(normalized)) {
-            cap.status = CaptureStatus::UPLOADED;
-        } else {
-            cap.status = CaptureStatus::LOCAL;
-        }
-    }
+uint8_t CapturesMenu::lookupWPASecStatus(const uint8_t* bssid) {
+    // Same key normalizeBSSID_Char() produces: uppercase hex, no separators
+    char normalized[13];
+    snprintf(normalized, sizeof(normalized), "%02X%02X%02X%02X%02X%02X",
+             bssid[0], bssid[1], bssid[2], bssid[3], bssid[4], bssid[5]);
+    if (WPASec::isCracked(normalized)) return CatalogRecord::kCracked;
+    if (WPASec::isUploaded(normalized)) return CatalogRecord::kUploaded;
+    return CatalogRecord::kLocal;
+}
+
+void CapturesMenu::startWPASecUpdate() {
+    if (CaptureCatalog::count() == 0) return;
+    wpasecUpdateInProgress = true;
+    wpasecUpdateProgress = 0;
+    lastWpasecUpdateTime = millis();
 }
 
 void CapturesMenu::processAsyncWPASecUpdate() {
-    if (!wpasecUpdateInProgress || captures.empty()) {
+    size_t total = CaptureCatalog::count();
+    if (!wpasecUpdateInProgress || total == 0) {
         wpasecUpdateInProgress = false;
         return;
     }
@@ -308,43 +193,49 @@ void CapturesMenu::processAsyncWPASecUpdate() {
     
     lastWpasecUpdateTime = millis();
     
-    // Process a chunk of captures
+    // Statuses are stored in the catalog, so only captures whose WPA-SEC
+    // state moved since the last visit cost an SD write
     size_t processed = 0;
-    while (processed < WPASEC_UPDATE_CHUNK_SIZE && wpasecUpdateProgress < captures.size()) {
-        auto& cap = captures[wpasecUpdateProgress];
-        
-        // Normalize BSSID for lookup (remove colons)
-        char normalized[13] = {0};
-        WPASec::normalizeBSSID_Char(cap.bssid.c_str(), normalized, sizeof(normalized));
-        
-        if (normalized[0] != '\0') {
-            if (WPASec::isCracked(normalized)) {
-                cap.status = CaptureStatus::CRACKED;
-                cap.password = WPASec::getPassword(normalized);
-            } else if (WPASec::isUploaded(normalized)) {
-                cap.status = CaptureStatus::UPLOADED;
-            } else {
-                cap.status = CaptureStatus::LOCAL;
+    size_t changed = 0;
+    while (processed < WPASEC_UPDATE_CHUNK_SIZE && wpasecUpdateProgress < total) {
+        uint8_t bssid[6];
+        uint8_t kind;
+        uint8_t status;
+        if (CaptureCatalog::peek(wpasecUpdateProgress, bssid, kind, status)) {
+            uint8_t fresh = lookupWPASecStatus(bssid);
+            if (fresh != status && CaptureCatalog::setStatus(wpasecUpdateProgress, fresh)) {
+                changed++;
             }
-        } else {
-            cap.status = CaptureStatus::LOCAL;
         }
-        
         wpasecUpdateProgress++;
         processed++;
-        
-        // Yield periodically to allow other tasks to run
-        if (processed >= WPASEC_UPDATE_CHUNK_SIZE) {
-            // Still more to do, but yield control back to other tasks
-            break;
-        }
+    }
+    
+    if (changed > 0) {
+        CaptureCatalog::summary(totals);
+        pageValid = false;
     }
     
     // Check if we're done with all captures
-    if (wpasecUpdateProgress >= captures.size()) {
+    if (wpasecUpdateProgress >= total) {
         wpasecUpdateInProgress = false;
-        Serial.printf("[CAPTURES] Async WPA-SEC update complete. Updated %d captures\n", captures.size());
+        Serial.printf("[CAPTURES] Async WPA-SEC update complete. Checked %u captures\n", (unsigned)total);
+    }
+}
+
+void CapturesMenu::refreshPage() {
+    if (pageValid && pageStart == scrollOffset) return;
+    pageStart = scrollOffset;
+    pageCount = 0;
+    size_t total = CaptureCatalog::count();
+    for (size_t i = scrollOffset; i < total && pageCount < VISIBLE_ITEMS; i++) {
+        if (!CaptureCatalog::get(i, page[pageCount])) {
+            // Unreadable record: keep the row so indices stay aligned
+            memset(&page[pageCount], 0, sizeof(page[pageCount]));
+        }
+        pageCount++;
     }
+    pageValid = true;
 }
 
 void CapturesMenu::update() {
@@ -356,7 +247,7 @@ void CapturesMenu::update() {
         processSyncState();
     }
     
-    // Process async file scanning if in progress (not during sync)
+    // Process async catalog rebuild if in progress (not during sync)
     if (!syncModalActive) {
         processAsyncScan();
         
@@ -365,6 +256,10 @@ void CapturesMenu::update() {
     }
     
     handleInput();
+    
+    if (!syncModalActive && !scanInProgress) {
+        refreshPage();
+    }
 }
 
 void CapturesMenu::handleInput() {
@@ -433,7 +328,8 @@ void CapturesMenu::handleInput() {
     }
     
     if (M5Cardputer.Keyboard.isKeyPressed('.')) {
-        if (!captures.empty() && selectedIndex < captures.size() - 1) {
+        size_t total = CaptureCatalog::count();
+        if (total > 0 && selectedIndex < total - 1) {
             selectedIndex++;
             if (selectedIndex >= scrollOffset + VISIBLE_ITEMS) {
                 scrollOffset = selectedIndex - VISIBLE_ITEMS + 1;
@@ -443,7 +339,20 @@ void CapturesMenu::handleInput() {
     
     // Enter shows detail view (password if cracked)
     if (keys.enter) {
-        if (!captures.empty() && selectedIndex < captures.size()) {
+        if (selectedIndex < CaptureCatalog::count()) {
+            detailPassword[0] = '\0';
+            uint8_t bssid[6];
+            uint8_t kind;
+            uint8_t status;
+            if (CaptureCatalog::peek(selectedIndex, bssid, kind, status) &&
+                status == CatalogRecord::kCracked) {
+                char normalized[13];
+                snprintf(normalized, sizeof(normalized), "%02X%02X%02X%02X%02X%02X",
+                         bssid[0], bssid[1], bssid[2], bssid[3], bssid[4], bssid[5]);
+                String pw = WPASec::getPassword(normalized);
+                strncpy(detailPassword, pw.c_str(), sizeof(detailPassword) - 1);
+                detailPassword[sizeof(detailPassword) - 1] = '\0';
+            }
             detailViewActive = true;
         }
     }
@@ -453,9 +362,18 @@ void CapturesMenu::handleInput() {
         startSync();
     }
     
+    // R key re-indexes the handshakes directory (files copied in by hand)
+    if ((M5Cardputer.Keyboard.isKeyPressed('r') || M5Cardputer.Keyboard.isKeyPressed('R')) &&
+        !scanInProgress) {
+        CaptureCatalog::invalidate();
+        selectedIndex = 0;
+        scrollOffset = 0;
+        scanCaptures();
+    }
+    
     // Nuke all loot with D key
     if (M5Cardputer.Keyboard.isKeyPressed('d') || M5Cardputer.Keyboard.isKeyPressed('D')) {
-        if (!captures.empty()) {
+        if (CaptureCatalog::count() > 0) {
             nukeConfirmActive = true;
             Display::setBottomOverlay("PERMANENT | NO UNDO");
         }
@@ -503,13 +421,22 @@ void CapturesMenu::draw(M5Canvas& canvas) {
     }
 
     // Draw sync modal FIRST - takes precedence over empty captures message
-    // (captures are cleared for heap during sync, but modal should still show)
+    // (catalog is released for heap during sync, but modal should still show)
     if (syncModalActive) {
         drawSyncModal(canvas);
         return;
     }
 
-    if (captures.empty()) {
+    if (scanInProgress) {
+        canvas.setCursor(4, 36);
+        canvas.print("INDEXING LOOT...");
+        canvas.setCursor(4, 52);
+        canvas.print("ONE-TIME DIRECTORY SCAN");
+        return;
+    }
+
+    size_t total = CaptureCatalog::count();
+    if (total == 0) {
         canvas.setCursor(4, 36);
         canvas.print("NO CAPTURES FOUND");
         canvas.setCursor(4, 52);
@@ -519,22 +446,11 @@ void CapturesMenu::draw(M5Canvas& canvas) {
         return;
     }
 
-    // Summary line
-    uint16_t total = captures.size();
-    uint16_t hsCount = 0;
-    uint16_t pmkCount = 0;
-    uint16_t cracked = 0;
-    uint16_t uploaded = 0;
-    for (const auto& cap : captures) {
-        if (cap.isPMKID) pmkCount++;
-        else hsCount++;
-        if (cap.status == CaptureStatus::CRACKED) cracked++;
-        else if (cap.status == CaptureStatus::UPLOADED) uploaded++;
-    }
+    // Summary line (counted from the RAM index on load/status change)
     char summary[64];
     snprintf(summary, sizeof(summary), "CAP %u HS %u PMK %u CRK %u UP %u",
-             (unsigned)total, (unsigned)hsCount, (unsigned)pmkCount,
-             (unsigned)cracked, (unsigned)uploaded);
+             (unsigned)totals.total, (unsigned)totals.handshakes, (unsigned)totals.pmkids,
+             (unsigned)totals.cracked, (unsigned)totals.uploaded);
     canvas.setCursor(4, 2);
     canvas.print(summary);
 
@@ -552,8 +468,11 @@ void CapturesMenu::draw(M5Canvas& canvas) {
     int y = 22;
     int lineHeight = 16;
 
-    for (uint8_t i = scrollOffset; i < captures.size() && i < scrollOffset + VISIBLE_ITEMS; i++) {
-        const CaptureInfo& cap = captures[i];
+    uint8_t rows = (pageValid && pageStart == scrollOffset) ? pageCount : 0;
+    for (uint8_t row = 0; row < rows; row++) {
+        const CaptureCatalog::Entry& cap = page[row];
+        size_t i = scrollOffset + row;
+        bool isPMKID = cap.kind == CatalogRecord::kPmkid;
 
         // Highlight selected
         if (i == selectedIndex) {
@@ -567,12 +486,12 @@ void CapturesMenu::draw(M5Canvas& canvas) {
         canvas.setCursor(4, y);
         char ssidBuf[24];
         size_t pos = 0;
-        if (cap.isPMKID && sizeof(ssidBuf) > 4) {
+        if (isPMKID && sizeof(ssidBuf) > 4) {
             ssidBuf[pos++] = '[';
             ssidBuf[pos++] = 'P';
             ssidBuf[pos++] = ']';
         }
-        const char* ssidSrc = cap.ssid.c_str();
+        const char* ssidSrc = cap.ssid[0] ? cap.ssid : "[UNKNOWN]";
         while (*ssidSrc && pos + 1 < sizeof(ssidBuf)) {
             ssidBuf[pos++] = (char)toupper((unsigned char)*ssidSrc++);
         }
@@ -586,9 +505,9 @@ void CapturesMenu::draw(M5Canvas& canvas) {
 
         // Status indicator
         canvas.setCursor(105, y);
-        if (cap.status == CaptureStatus::CRACKED) {
+        if (cap.status == CatalogRecord::kCracked) {
             canvas.print("[OK]");
-        } else if (cap.status == CaptureStatus::UPLOADED) {
+        } else if (cap.status == CatalogRecord::kUploaded) {
             canvas.print("[..]");
         } else {
             canvas.print("[--]");
@@ -597,12 +516,12 @@ void CapturesMenu::draw(M5Canvas& canvas) {
         // Date/time
         canvas.setCursor(135, y);
         char timeBuf[20];
-        formatTime(timeBuf, sizeof(timeBuf), cap.captureTime);
+        formatTime(timeBuf, sizeof(timeBuf), (time_t)cap.mtime);
         canvas.print(timeBuf);
 
         // File size (KB)
         canvas.setCursor(210, y);
-        canvas.printf("%dK", cap.fileSize / 1024);
+        canvas.printf("%uK", (unsigned)(cap.size / 1024));
 
         y += lineHeight;
     }
@@ -613,7 +532,7 @@ void CapturesMenu::draw(M5Canvas& canvas) {
         canvas.setTextColor(COLOR_FG);
         canvas.print("^");
     }
-    if (scrollOffset + VISIBLE_ITEMS < captures.size()) {
+    if (scrollOffset + VISIBLE_ITEMS < total) {
         canvas.setCursor(canvas.width() - 10, 22 + (VISIBLE_ITEMS - 1) * lineHeight);
         canvas.setTextColor(COLOR_FG);
         canvas.print("v");
@@ -708,19 +627,22 @@ void CapturesMenu::nukeLoot() {
     
     Serial.printf("[CAPTURES] Nuked %d files\n", deleted);
     
+    // Nothing left to list; skip the rebuild on the rescan
+    CaptureCatalog::clear();
+    
     // Reset selection
     selectedIndex = 0;
     scrollOffset = 0;
-    captures.clear();
+    pageValid = false;
 }
 
 const char* CapturesMenu::getSelectedBSSID() {
-    return "ENT=DET S=SYNC D=NUKE";
+    return "ENT=DET S=SYNC R=SCAN D=NUKE";
 }
 void CapturesMenu::drawDetailView(M5Canvas& canvas) {
-    if (selectedIndex >= captures.size()) return;
+    if (!pageValid || selectedIndex < pageStart || selectedIndex >= pageStart + pageCount) return;
     
-    const CaptureInfo& cap = captures[selectedIndex];
+    const CaptureCatalog::Entry& cap = page[selectedIndex - pageStart];
     
     // Modal box dimensions
     const int boxW = 220;
@@ -742,7 +664,7 @@ void CapturesMenu::drawDetailView(M5Canvas& canvas) {
     // SSID
     char ssidLine[24];
     size_t ssidPos = 0;
-    const char* ssidSrc = cap.ssid.c_str();
+    const char* ssidSrc = cap.ssid[0] ? cap.ssid : "[UNKNOWN]";
     while (*ssidSrc && ssidPos + 1 < sizeof(ssidLine)) {
         ssidLine[ssidPos++] = (char)toupper((unsigned char)*ssidSrc++);
     }
@@ -754,16 +676,19 @@ void CapturesMenu::drawDetailView(M5Canvas& canvas) {
     }
     canvas.drawString(ssidLine, centerX, boxY + 6);
     
-    // BSSID (already uppercase from storage)
-    canvas.drawString(cap.bssid.c_str(), centerX, boxY + 20);
+    // BSSID
+    char bssidLine[18];
+    snprintf(bssidLine, sizeof(bssidLine), "%02X:%02X:%02X:%02X:%02X:%02X",
+             cap.bssid[0], cap.bssid[1], cap.bssid[2], cap.bssid[3], cap.bssid[4], cap.bssid[5]);
+    canvas.drawString(bssidLine, centerX, boxY + 20);
     
     // Status and password
-    if (cap.status == CaptureStatus::CRACKED) {
+    if (cap.status == CatalogRecord::kCracked) {
         canvas.drawString("** CR4CK3D **", centerX, boxY + 38);
         
         // Password in larger text
         char pwLine[24];
-        const char* pwSrc = cap.password.c_str();
+        const char* pwSrc = detailPassword;
         size_t pwLen = strlen(pwSrc);
         if (pwLen > 20 && sizeof(pwLine) > 20) {
             size_t keep = 18;
@@ -776,10 +701,10 @@ void CapturesMenu::drawDetailView(M5Canvas& canvas) {
             pwLine[sizeof(pwLine) - 1] = '\0';
         }
         canvas.drawString(pwLine, centerX, boxY + 54);
-    } else if (cap.status == CaptureStatus::UPLOADED) {
+    } else if (cap.status == CatalogRecord::kUploaded) {
         canvas.drawString("UPLOADED - PENDING CRACK", centerX, boxY + 38);
         canvas.drawString("PRESS [S] TO CHECK STATUS", centerX, boxY + 54);
-    } else if (cap.isPMKID) {
+    } else if (cap.kind == CatalogRecord::kPmkid) {
         canvas.drawString("PMKID - LOCAL CRACK ONLY", centerX, boxY + 38);
         canvas.drawString("hashcat -m 22000", centerX, boxY + 54);
     } else {
@@ -865,8 +790,11 @@ void CapturesMenu::startSync() {
     }
     
     // Free memory before heavy operations
-    captures.clear();
-    captures.shrink_to_fit();
+    CaptureCatalog::abortRebuild();
+    CaptureCatalog::release();
+    scanInProgress = false;
+    wpasecUpdateInProgress = false;
+    pageValid = false;
     WPASec::freeCacheMemory();
     
     Serial.printf("[CAPTURES] Heap after freeing: %u\n", (unsigned int)ESP.getFreeHeap());
@@ -4,26 +4,7 @@
 #include <Arduino.h>
 #include <M5Unified.h>
 #include <vector>
-#include <FS.h>
-#include <SD.h>
-
-// WPA-SEC status for display
-enum class CaptureStatus {
-    LOCAL,      // Not uploaded yet
-    UPLOADED,   // Uploaded, waiting for crack
-    CRACKED     // Password found!
-};
-
-struct CaptureInfo {
-    String filename;
-    String ssid;
-    String bssid;
-    uint32_t fileSize;
-    time_t captureTime;  // File modification time
-    bool isPMKID;        // true = .22000 PMKID, false = .pcap handshake
-    CaptureStatus status; // WPA-SEC status
-    String password;      // Cracked password (if status == CRACKED)
-};
+#include "../core/capture_catalog.h"
 
 // Sync state machine for WPA-SEC operations
 enum class SyncState {
@@ -48,12 +29,11 @@ public:
     static void emergencyCleanup();
     static bool isActive() { return active; }
     static const char* getSelectedBSSID();
-    static size_t getCount() { return captures.size(); }
+    static size_t getCount() { return CaptureCatalog::count(); }
     
 private:
-    static std::vector<CaptureInfo> captures;
-    static uint8_t selectedIndex;
-    static uint8_t scrollOffset;
+    static uint16_t selectedIndex;
+    static uint16_t scrollOffset;
     static bool active;
     static bool keyWasPressed;
     static bool nukeConfirmActive;  // Nuke confirmation modal
@@ -61,26 +41,30 @@ private:
     
     static const uint8_t VISIBLE_ITEMS = 5;
     
+    // Visible rows, read from the catalog by offset when the list scrolls
+    static CaptureCatalog::Entry page[VISIBLE_ITEMS];
+    static uint16_t pageStart;
+    static uint8_t pageCount;
+    static bool pageValid;
+    static CaptureCatalog::Summary totals;
+    static char detailPassword[65];
+    
     static bool scanCaptures();  // Returns true if successful, false if SD access failed
     static void handleInput();
+    static void refreshPage();
     static void drawNukeConfirm(M5Canvas& canvas);
     static void drawDetailView(M5Canvas& canvas);
     static void nukeLoot();
-    static void updateWPASecStatus();
     static void formatTime(char* out, size_t len, time_t t);
-    static const size_t MAX_CAPTURES = 200;
+    static uint8_t lookupWPASecStatus(const uint8_t* bssid);
     
-    // Async scan state
+    // Catalog rebuild state (only when the catalog is missing or on [R])
     static bool scanInProgress;
     static unsigned long lastScanTime;
-    static const unsigned long SCAN_DELAY = 50; // ms between scan chunks
-    static File scanDir;
-    static File currentFile;
-    static bool scanComplete;
-    static size_t scanProgress;
-    static const size_t SCAN_CHUNK_SIZE = 5; // files to process per chunk
+    static const unsigned long SCAN_DELAY = 50; // ms between rebuild chunks
+    static const size_t SCAN_CHUNK_SIZE = 8; // directory entries per chunk
     
-    // Async scan processing
+    // Async rebuild processing
     static void processAsyncScan();
     
     // Async WPA-SEC status update state
@@ -88,9 +72,10 @@ private:
     static unsigned long lastWpasecUpdateTime;
     static size_t wpasecUpdateProgress;
     static const unsigned long WPASEC_UPDATE_DELAY = 25; // ms between updates
-    static const size_t WPASEC_UPDATE_CHUNK_SIZE = 3; // captures to process per chunk
+    static const size_t WPASEC_UPDATE_CHUNK_SIZE = 8; // captures to process per chunk
     
     // Async WPA-SEC status update processing
+    static void startWPASecUpdate();
     static void processAsyncWPASecUpdate();
     
     // WPA-SEC Sync modal state
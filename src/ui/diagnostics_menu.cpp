@@ -11,11 +11,23 @@
 #include "../web/wigle.h"
 #include "../core/sd_layout.h"
 #include "../core/heap_health.h"
+#include "../core/heap_trace.h"
+#include "../core/boot_timeline.h"
+#include "../core/porkchop.h"
 #include "../core/wifi_utils.h"
+#include "../core/session_capture.h"
+#include "../core/sdlog.h"
+#include "../core/capture_journal.h"
+#include "../core/network_recon.h"
+#include "../modes/oink.h"
+#include "../modes/donoham.h"
+#include "../piglet/sprites.h"
 #include <WiFi.h>
 #include <esp_heap_caps.h>
 #include <esp_wifi.h>
 
+extern Porkchop porkchop;
+
 // Static member initialization
 bool DiagnosticsMenu::active = false;
 bool DiagnosticsMenu::keyWasPressed = false;
@@ -157,6 +169,166 @@ void DiagnosticsMenu::saveSnapshot() {
     file.printf("  Flash Size: %u MB\n", (unsigned int)(ESP.getFlashChipSize() / (1024 * 1024)));
     file.printf("\n");
 
+    // Session capture (counters persist after stop for post-session review)
+    SessionCapture::Stats cap;
+    SessionCapture::getStats(cap);
+    file.printf("SESSION CAPTURE:\n");
+    file.printf("  Active: %s\n", SessionCapture::isActive() ? "YES" : "NO");
+    if (SessionCapture::isActive()) {
+        file.printf("  File: %s\n", SessionCapture::currentFile());
+    }
+    file.printf("  Frames: %u captured, %u written, %u dropped\n",
+                (unsigned int)cap.captured, (unsigned int)cap.written, (unsigned int)cap.dropped);
+    file.printf("  Bytes: %u in %u files (%u write errors)\n",
+                (unsigned int)cap.bytesWritten, (unsigned int)cap.files, (unsigned int)cap.writeErrors);
+    file.printf("  Ring High Water: %u/%u bytes\n",
+                (unsigned int)cap.ringHighWater, (unsigned int)cap.ringSize);
+    file.printf("\n");
+
+    // SD log writer (counters persist after logging is disabled)
+    SDLog::Stats sl;
+    SDLog::getStats(sl);
+    file.printf("SD LOG:\n");
+    file.printf("  Enabled: %s\n", SDLog::isEnabled() ? "YES" : "NO");
+    file.printf("  Lines: %u logged, %u dropped\n",
+                (unsigned int)sl.lines, (unsigned int)sl.dropped);
+    file.printf("  Bytes: %u in %u writes, %u rotations (%u write errors)\n",
+                (unsigned int)sl.bytesWritten, (unsigned int)sl.batches,
+                (unsigned int)sl.rotations, (unsigned int)sl.writeErrors);
+    file.printf("  Ring High Water: %u/%u bytes\n",
+                (unsigned int)sl.ringHighWater, (unsigned int)sl.ringSize);
+    file.printf("\n");
+
+    // Capture journal (counters persist after the mode stops)
+    CaptureJournal::Stats cj;
+    CaptureJournal::getStats(cj);
+    file.printf("CAPTURE JOURNAL:\n");
+    file.printf("  Active: %s\n", CaptureJournal::isActive() ? "YES" : "NO");
+    file.printf("  Records: %u journaled, %u deferred (ring full)\n",
+                (unsigned int)cj.records, (unsigned int)cj.dropped);
+    file.printf("  Bytes: %u (%u write errors)\n",
+                (unsigned int)cj.bytesWritten, (unsigned int)cj.writeErrors);
+    file.printf("  Ring High Water: %u/%u bytes\n",
+                (unsigned int)cj.ringHighWater, (unsigned int)cj.ringSize);
+    file.printf("  Last Recovery: %u handshakes, %u partial, %u PMKIDs, %u M1-only dropped, %u bad bytes\n",
+                (unsigned int)cj.recoveredHandshakes, (unsigned int)cj.recoveredPartial,
+                (unsigned int)cj.recoveredPMKIDs, (unsigned int)cj.discardedPartial,
+                (unsigned int)cj.corruptBytes);
+    file.printf("\n");
+
+    // Callback -> main loop event queues (cumulative since the ring was reset)
+    RingStats qs[5] = {
+        NetworkRecon::getPendingQueueStats(),
+        NetworkRecon::getSightingQueueStats(),
+        OinkMode::getPendingHsStats(),
+        DoNoHamMode::getPendingPMKIDStats(),
+        porkchop.getEventQueueStats()
+    };
+    const char* qNames[5] = { "Recon Networks", "Recon Sightings", "OINK EAPOL", "DNH PMKID",
+                              "Porkchop Events" };
+    file.printf("EVENT QUEUES:\n");
+    for (int i = 0; i < 5; i++) {
+        file.printf("  %s: %u pushed, %u dropped, peak %u/%u\n", qNames[i],
+                    (unsigned int)qs[i].pushed, (unsigned int)qs[i].dropped,
+                    (unsigned int)qs[i].highWater, (unsigned int)qs[i].capacity);
+    }
+    const EventBus::Stats& es = porkchop.getEventDispatchStats();
+    file.printf("  Porkchop Dispatch: %u delivered, %u unhandled, %u bad type, %u over budget, %u subscribe full\n",
+                (unsigned int)es.dispatched, (unsigned int)es.unhandled, (unsigned int)es.badType,
+                (unsigned int)es.deferred, (unsigned int)es.subscribeFull);
+    file.printf("\n");
+
+    // Heap attribution (trace builds) and fragmentation series
+    HeapTrace::Totals ht;
+    HeapTrace::getTotals(ht);
+    file.printf("HEAP TRACE:\n");
+    file.printf("  Attribution: %s\n", HeapTrace::isEnabled() ? "ON" : "OFF (build with PORKCHOP_HEAP_TRACE=1)");
+    if (HeapTrace::isEnabled()) {
+        file.printf("  Tracked: %u bytes in %u/%u slots (%u untracked allocs, %u stray frees)\n",
+                    (unsigned int)ht.trackedBytes, (unsigned int)ht.blocks, (unsigned int)ht.capacity,
+                    (unsigned int)ht.overflowed, (unsigned int)ht.strayFrees);
+        for (uint8_t i = 0; i < HeapLedger::kTagCount; i++) {
+            HeapLedger::TagStats ts;
+            HeapTrace::getTagStats((HeapLedger::Tag)i, ts);
+            file.printf("  %-8s live %u (peak %u) in %u blocks, %u allocs, %u frees\n",
+                        HeapLedger::tagName((HeapLedger::Tag)i),
+                        (unsigned int)ts.liveBytes, (unsigned int)ts.peakBytes,
+                        (unsigned int)ts.liveBlocks, (unsigned int)ts.allocs, (unsigned int)ts.frees);
+        }
+    }
+    file.printf("  Series (uptime s, free, largest, frag permille):\n");
+    for (uint16_t i = 0; i < HeapTrace::sampleCount(); i++) {
+        HeapLedger::Sample smp = HeapTrace::getSample(i);
+        file.printf("    %u, %u, %u, %u\n", (unsigned int)(smp.ms / 1000),
+                    (unsigned int)smp.freeBytes, (unsigned int)smp.largest,
+                    (unsigned int)HeapLedger::fragPermille(smp));
+    }
+    file.printf("\n");
+
+    // Display pipeline (last full 1 s window)
+    Display::FrameStats fs;
+    Display::getFrameStats(fs);
+    file.printf("DISPLAY:\n");
+    file.printf("  Frames: %u/s (cap %u, 0 = none)\n", (unsigned int)fs.fps, (unsigned int)fs.targetFps);
+    file.printf("  Frame Time: %u us last, %u us max\n",
+                (unsigned int)fs.frameUs, (unsigned int)fs.maxFrameUs);
+    file.printf("  Pushes: %u regions/s, %u pixels/s\n",
+                (unsigned int)fs.pushesPerSec, (unsigned int)fs.pixelsPerSec);
+    file.printf("\n");
+
+    // Boot timeline (this boot, and the last one if it never got to READY)
+    const BootProfile::Timeline& bt = BootTimeline::current();
+    const BootProfile::Timeline& prev = BootTimeline::previous();
+    char markBuf[64];
+    file.printf("BOOT:\n");
+    file.printf("  Boot #%u: ready in %u ms (target %u ms), SD at %u MHz\n",
+                (unsigned int)bt.bootCount, (unsigned int)bt.interactiveMs(),
+                (unsigned int)BootProfile::kTargetInteractiveMs, (unsigned int)(bt.sdHz / 1000000));
+    file.printf("  Fast path: SD clock %s%s, heap conditioning %s\n",
+                (bt.flags & BootProfile::FLAG_SD_REMEMBERED) ? "remembered" : "probed",
+                (bt.flags & BootProfile::FLAG_SD_FIRST_TRY) ? " (first try)" : "",
+                (bt.flags & BootProfile::FLAG_CONDITION_SKIPPED) ? "skipped" : "run");
+    for (uint8_t i = 0; i < bt.count; i++) {
+        BootProfile::formatMark(bt, i, markBuf, sizeof(markBuf));
+        file.printf("%s\n", markBuf);
+    }
+    if (prev.valid()) {
+        file.printf("  Previous boot #%u: ready in %u ms%s\n",
+                    (unsigned int)prev.bootCount, (unsigned int)prev.interactiveMs(),
+                    prev.interactiveMs() == 0 ? " (never reached READY)" : "");
+    }
+    file.printf("\n");
+
+    // Mode transitions: stop/start/deferred step timings, oldest first
+    const ModeLatency::Ring<Porkchop::TRANSITION_HISTORY>& mt = porkchop.getTransitions();
+    file.printf("MODE TRANSITIONS:\n");
+    file.printf("  Budget: %u ms, %u over; worst stop %u us, start %u us, step %u us\n",
+                (unsigned int)(ModeLatency::kTransitionBudgetUs / 1000), (unsigned int)mt.overBudget(),
+                (unsigned int)mt.worstUs(ModeLatency::Kind::Stop),
+                (unsigned int)mt.worstUs(ModeLatency::Kind::Start),
+                (unsigned int)mt.worstUs(ModeLatency::Kind::Step));
+    for (uint8_t i = 0; i < mt.size(); i++) {
+        const ModeLatency::Sample& ms = mt.at(i);
+        file.printf("  %u s %-13s %-5s %7u us free %+d largest %+d%s\n",
+                    (unsigned int)(ms.atMs / 1000), Porkchop::modeName((PorkchopMode)ms.mode),
+                    ModeLatency::kindName(ms.kind), (unsigned int)ms.us,
+                    (int)ms.freeDelta, (int)ms.largestDelta,
+                    ms.overBudget() ? " OVER" : "");
+    }
+    file.printf("\n");
+
+    // Pre-rendered avatar frames / text strips (misses = rasterisations)
+    SpriteCache::Stats sp[2] = { PigSprites::getPigStats(), PigSprites::getStripStats() };
+    const char* spNames[2] = { "Pig Frames", "Strips" };
+    file.printf("SPRITE CACHE:\n");
+    for (int i = 0; i < 2; i++) {
+        file.printf("  %s: %u hits, %u misses, %u evictions, %u x %u bytes\n", spNames[i],
+                    (unsigned int)sp[i].hits, (unsigned int)sp[i].misses,
+                    (unsigned int)sp[i].evictions, (unsigned int)sp[i].slots,
+                    (unsigned int)sp[i].slotBytes);
+    }
+    file.printf("\n");
+
     // Battery Status
     file.printf("POWER STATUS:\n");
     file.printf("  Battery Voltage: %.2f V\n", M5.Power.getBatteryVoltage() / 1000.0f);
@@ -252,6 +424,99 @@ void DiagnosticsMenu::draw(M5Canvas& canvas) {
     canvas.drawString("MIN LRG:", 4, y);
     snprintf(heapBuf, sizeof(heapBuf), "%u", (unsigned)HeapHealth::getMinLargest());
     canvas.drawString(heapBuf, 80, y);
+    y += lineH;
+
+    // Fragmentation (latest trace sample) and the two biggest tagged holders
+    char traceBuf[32];
+    canvas.drawString("FRAG:", 4, y);
+    uint16_t samples = HeapTrace::sampleCount();
+    if (samples > 0) {
+        uint16_t frag = HeapLedger::fragPermille(HeapTrace::getSample(samples - 1));
+        snprintf(traceBuf, sizeof(traceBuf), "%u.%u%% (%u SMP)",
+                 (unsigned)(frag / 10), (unsigned)(frag % 10), (unsigned)samples);
+    } else {
+        snprintf(traceBuf, sizeof(traceBuf), "--");
+    }
+    canvas.drawString(traceBuf, 80, y);
+    y += lineH;
+    canvas.drawString("HOLDERS:", 4, y);
+    if (HeapTrace::isEnabled()) {
+        uint8_t top[2] = {0, 0};
+        uint32_t topBytes[2] = {0, 0};
+        for (uint8_t i = 0; i < HeapLedger::kTagCount; i++) {
+            HeapLedger::TagStats ts;
+            HeapTrace::getTagStats((HeapLedger::Tag)i, ts);
+            if (ts.liveBytes > topBytes[0]) {
+                top[1] = top[0];
+                topBytes[1] = topBytes[0];
+                top[0] = i;
+                topBytes[0] = ts.liveBytes;
+            } else if (ts.liveBytes > topBytes[1]) {
+                top[1] = i;
+                topBytes[1] = ts.liveBytes;
+            }
+        }
+        snprintf(traceBuf, sizeof(traceBuf), "%s %uK %s %uK",
+                 HeapLedger::tagName((HeapLedger::Tag)top[0]), (unsigned)(topBytes[0] / 1024),
+                 HeapLedger::tagName((HeapLedger::Tag)top[1]), (unsigned)(topBytes[1] / 1024));
+    } else {
+        snprintf(traceBuf, sizeof(traceBuf), "TRACE BUILD ONLY");
+    }
+    canvas.drawString(traceBuf, 80, y);
+    y += lineH + 4;
+
+    // Event queues: R=recon networks, O=OINK EAPOL, D=DNH PMKID
+    RingStats rq = NetworkRecon::getPendingQueueStats();
+    RingStats oq = OinkMode::getPendingHsStats();
+    RingStats dq = DoNoHamMode::getPendingPMKIDStats();
+    char evqBuf[32];
+    canvas.drawString("EVQ DROP:", 4, y);
+    snprintf(evqBuf, sizeof(evqBuf), "R%u O%u D%u",
+             (unsigned)rq.dropped, (unsigned)oq.dropped, (unsigned)dq.dropped);
+    canvas.drawString(evqBuf, 80, y);
+    y += lineH;
+    canvas.drawString("EVQ PEAK:", 4, y);
+    snprintf(evqBuf, sizeof(evqBuf), "R%u/%u O%u/%u D%u/%u",
+             (unsigned)rq.highWater, (unsigned)rq.capacity,
+             (unsigned)oq.highWater, (unsigned)oq.capacity,
+             (unsigned)dq.highWater, (unsigned)dq.capacity);
+    canvas.drawString(evqBuf, 80, y);
+    y += lineH + 4;
+
+    // Display: last/worst frame time, frames vs cap, region pushes per second
+    Display::FrameStats fs;
+    Display::getFrameStats(fs);
+    char frameBuf[32];
+    canvas.drawString("FRAME:", 4, y);
+    snprintf(frameBuf, sizeof(frameBuf), "%u.%ums MAX%ums %u/%uFPS",
+             (unsigned)(fs.frameUs / 1000), (unsigned)(fs.frameUs % 1000 / 100),
+             (unsigned)(fs.maxFrameUs / 1000), (unsigned)fs.fps, (unsigned)fs.targetFps);
+    canvas.drawString(frameBuf, 80, y);
+    y += lineH;
+    canvas.drawString("PUSHES:", 4, y);
+    snprintf(frameBuf, sizeof(frameBuf), "%u/S %uKPX/S",
+             (unsigned)fs.pushesPerSec, (unsigned)(fs.pixelsPerSec / 1000));
+    canvas.drawString(frameBuf, 80, y);
+    y += lineH;
+
+    // Boot: time to interactive vs target
+    const BootProfile::Timeline& bt = BootTimeline::current();
+    canvas.drawString("BOOT:", 4, y);
+    snprintf(frameBuf, sizeof(frameBuf), "%ums/%ums #%u",
+             (unsigned)bt.interactiveMs(), (unsigned)BootProfile::kTargetInteractiveMs,
+             (unsigned)bt.bootCount);
+    canvas.drawString(frameBuf, 80, y);
+    y += lineH;
+
+    // Mode switches: slowest stop/start vs budget, count over budget
+    const ModeLatency::Ring<Porkchop::TRANSITION_HISTORY>& mt = porkchop.getTransitions();
+    uint32_t worstStart = mt.worstUs(ModeLatency::Kind::Start);
+    if (mt.worstUs(ModeLatency::Kind::Step) > worstStart) worstStart = mt.worstUs(ModeLatency::Kind::Step);
+    canvas.drawString("MODE SW:", 4, y);
+    snprintf(frameBuf, sizeof(frameBuf), "S%u/E%ums %u OVER",
+             (unsigned)(mt.worstUs(ModeLatency::Kind::Stop) / 1000), (unsigned)(worstStart / 1000),
+             (unsigned)mt.overBudget());
+    canvas.drawString(frameBuf, 80, y);
     y += lineH + 4;
 
     // PSRAM (if present)
@@ -42,6 +42,8 @@
 #include "bounty_status_menu.h"
 #include "sd_format_menu.h"
 #include "../core/heap_health.h"
+#include "../core/heap_trace.h"
+#include "../core/dirty_region.h"
 
 // Theme color getters - read from config
 // Theme definitions
@@ -193,6 +195,104 @@ uint32_t Display::uploadStartTime = 0;
 // PWNED banner state, persists until reboot
 static char lootSSID[20] = {0};
 
+// Changed-region tracking: what each sprite looked like at its last push
+static const int DIRTY_TILE_W = 60;
+static DirtyRegion::Tracker<DISPLAY_W, TOP_BAR_H, DIRTY_TILE_W> topBarDirty;
+static DirtyRegion::Tracker<DISPLAY_W, MAIN_H, DIRTY_TILE_W> mainDirty;
+static DirtyRegion::Tracker<DISPLAY_W, BOTTOM_BAR_H, DIRTY_TILE_W> bottomBarDirty;
+static bool twoLineWasDrawn = false;
+
+// Frame governor
+static uint32_t lastFrameMs = 0;
+static bool frameRequested = true;
+static bool haveLastFrameMode = false;
+static PorkchopMode lastFrameMode;
+
+// Frame counters (1 s window, published to the diagnostics screen)
+static const uint32_t FRAME_STATS_WINDOW_MS = 1000;
+static uint32_t statsWindowStart = 0;
+static uint16_t windowFrames = 0;
+static uint16_t windowPushes = 0;
+static uint32_t windowPixels = 0;
+static uint32_t windowMaxUs = 0;
+static Display::FrameStats frameStats = {};
+
+static bool isAvatarMode(PorkchopMode mode) {
+    return mode == PorkchopMode::IDLE ||
+           mode == PorkchopMode::OINK_MODE ||
+           mode == PorkchopMode::DNH_MODE ||
+           mode == PorkchopMode::WARHOG_MODE ||
+           mode == PorkchopMode::PIGGYBLUES_MODE ||
+           mode == PorkchopMode::BACON_MODE;
+}
+
+static uint8_t targetFps(PorkchopMode mode) {
+    const PersonalityConfig& p = Config::personality();
+    if (mode == PorkchopMode::SPECTRUM_MODE) return p.spectrumFps;
+    if (isAvatarMode(mode)) return p.avatarFps;
+    return p.menuFps;
+}
+
+// Frame cap per mode; input, mode changes and new messages draw at once
+static bool frameDue(PorkchopMode mode, uint32_t now) {
+    uint8_t fps = targetFps(mode);
+    frameStats.targetFps = fps;
+    bool modeChanged = !haveLastFrameMode || mode != lastFrameMode;
+    if (!frameRequested && !modeChanged && fps > 0 && now - lastFrameMs < 1000u / fps) {
+        return false;
+    }
+    frameRequested = false;
+    haveLastFrameMode = true;
+    lastFrameMode = mode;
+    lastFrameMs = now;
+    return true;
+}
+
+static void recordFrame(uint32_t frameUs, uint16_t pushes, uint32_t pixels) {
+    uint32_t now = millis();
+    windowFrames++;
+    windowPushes += pushes;
+    windowPixels += pixels;
+    if (frameUs > windowMaxUs) windowMaxUs = frameUs;
+    frameStats.frameUs = frameUs;
+    if (now - statsWindowStart >= FRAME_STATS_WINDOW_MS) {
+        frameStats.fps = windowFrames;
+        frameStats.pushesPerSec = windowPushes;
+        frameStats.pixelsPerSec = windowPixels;
+        frameStats.maxFrameUs = windowMaxUs;
+        statsWindowStart = now;
+        windowFrames = 0;
+        windowPushes = 0;
+        windowPixels = 0;
+        windowMaxUs = 0;
+    }
+}
+
+// Push counters for the frame being sent
+static uint16_t framePushes = 0;
+static uint32_t framePixels = 0;
+
+// Send only the regions of one sprite that changed since its last push.
+// Regions go out through pushSprite() under a clip rect, so the RGB332 ->
+// RGB565 expansion and SPI transfer cover just the clipped area.
+template <class Tracker>
+static void pushSpriteChanges(M5Canvas& sprite, Tracker& tracker, int32_t screenY) {
+    const uint8_t* pixels = (const uint8_t*)sprite.getBuffer();
+    if (!pixels || sprite.getColorDepth() != 8) {
+        sprite.pushSprite(0, screenY);
+        framePushes++;
+        framePixels += (uint32_t)sprite.width() * sprite.height();
+        return;
+    }
+    auto push = [&](const DirtyRegion::Rect& r) {
+        M5.Display.setClipRect(r.x, screenY + r.y, r.w, r.h);
+        sprite.pushSprite(0, screenY);
+        M5.Display.clearClipRect();
+        framePixels += (uint32_t)r.w * r.h;
+    };
+    framePushes += tracker.scan(pixels, push);
+}
+
 void Display::showLoot(const String& ssid) {
     if (ssid.length() == 0) {
         lootSSID[0] = '\0';
@@ -241,6 +341,8 @@ void Display::init() {
 }
 
 void Display::update() {
+    HeapTrace::Scope heapTag(HeapTrace::Tag::Ui);
+
     // Apply any pending top-bar message requests from worker tasks
     char pendingMsg[96];
     uint32_t pendingDuration = 0;
@@ -258,11 +360,24 @@ void Display::update() {
         setTopBarMessage(pendingMsg, pendingDuration);
     }
 
-    // Update heap health state (rate-limited)
+    // Update heap health state and fragmentation series (rate-limited)
     HeapHealth::update();
+    HeapTrace::update();
 
     // Check for screen dimming
     updateDimming();
+
+    // Menu input lives next to its draw call; it runs every loop, drawn or not
+    PorkchopMode mode = porkchop.getMode();
+    if (mode == PorkchopMode::MENU) {
+        Menu::update();
+    } else if (mode == PorkchopMode::SETTINGS) {
+        SettingsMenu::update();
+    }
+    mode = porkchop.getMode();
+
+    if (!frameDue(mode, millis())) return;
+    uint32_t frameStart = micros();
     
     // SD Format mode hides bars to save RAM for disk operations
     bool barsHidden = SdFormatMenu::areBarsHidden() || ChargingMode::areBarsHidden();
@@ -275,13 +390,7 @@ void Display::update() {
         bottomBar.fillSprite(COLOR_BG);
     }
 
-    PorkchopMode mode = porkchop.getMode();
-    bool useAvatarWeather = (mode == PorkchopMode::IDLE ||
-        mode == PorkchopMode::OINK_MODE ||
-        mode == PorkchopMode::DNH_MODE ||
-        mode == PorkchopMode::WARHOG_MODE ||
-        mode == PorkchopMode::PIGGYBLUES_MODE ||
-        mode == PorkchopMode::BACON_MODE);
+    bool useAvatarWeather = isAvatarMode(mode);
 
     // Draw main content based on mode - reset all canvas state
     // Thunder flash inverts the background color, FG becomes BG
@@ -339,12 +448,10 @@ void Display::update() {
             
         case PorkchopMode::MENU:
             // Draw menu
-            Menu::update();
             Menu::draw(mainCanvas);
             break;
             
         case PorkchopMode::SETTINGS:
-            SettingsMenu::update();
             SettingsMenu::draw(mainCanvas);
             break;
             
@@ -451,7 +558,8 @@ void Display::update() {
     if (!barsHidden) {
         drawBottomBar();
     }
-    pushAll();
+    pushChanged();
+    recordFrame(micros() - frameStart, framePushes, framePixels);
 }
 
 void Display::requestTopBarMessage(const char* message, uint32_t durationMs) {
@@ -481,6 +589,45 @@ void Display::pushAll() {
     if (topBarMessageTwoLineActive) {
         drawTopBarMessageTwoLineDirect();
     }
+    // Blocking dialogs push content the next frame won't redraw
+    invalidate();
+}
+
+void Display::pushChanged() {
+    framePushes = 0;
+    framePixels = 0;
+
+    // The two-line message covers the top bar and the top of the main canvas
+    if (twoLineWasDrawn && !topBarMessageTwoLineActive) {
+        topBarDirty.invalidate();
+        mainDirty.invalidate();
+    }
+
+    M5.Display.startWrite();
+    pushSpriteChanges(topBar, topBarDirty, 0);
+    pushSpriteChanges(mainCanvas, mainDirty, TOP_BAR_H);
+    pushSpriteChanges(bottomBar, bottomBarDirty, DISPLAY_H - BOTTOM_BAR_H);
+    M5.Display.endWrite();
+
+    twoLineWasDrawn = topBarMessageTwoLineActive;
+    if (topBarMessageTwoLineActive) {
+        drawTopBarMessageTwoLineDirect();
+    }
+}
+
+void Display::invalidate() {
+    topBarDirty.invalidate();
+    mainDirty.invalidate();
+    bottomBarDirty.invalidate();
+    frameRequested = true;
+}
+
+void Display::requestFrame() {
+    frameRequested = true;
+}
+
+void Display::getFrameStats(FrameStats& out) {
+    out = frameStats;
 }
 
 void Display::drawTopBar() {
@@ -1216,70 +1363,123 @@ void Display::showChallenges() {
     }
 }
 
-static void bootSplashDelay(uint32_t ms) {
-    uint32_t start = millis();
-    while ((millis() - start) < ms) {
-        M5.update();
-        M5Cardputer.update();
-        SFX::update();
-        delay(20);
-        yield();
+// Boot splash runs while setup() keeps initializing: setup() calls
+// serviceBootSplash() between init steps and each screen advances when its
+// time is up, so SD/config/GPS init hides behind the splash instead of
+// being added to it.
+static uint8_t splashScreen = 0;        // Screen on display (0 = not started)
+static uint32_t splashScreenStart = 0;
+static bool splashDone = true;
+
+static void drawSplashScreen(uint8_t screen) {
+    switch (screen) {
+        case 1:
+            // Screen 1: OINK OINK
+            M5.Display.fillScreen(COLOR_BG);
+            M5.Display.setTextColor(COLOR_FG);
+            M5.Display.setTextDatum(middle_center);
+            M5.Display.setTextSize(4);
+            M5.Display.drawString("OINK", DISPLAY_W / 2, DISPLAY_H / 2 - 20);
+            M5.Display.drawString("OINK", DISPLAY_W / 2, DISPLAY_H / 2 + 20);
+
+            // Pig wake-up grunt: "oink oink"
+            SFX::play(SFX::BOOT);
+            break;
+
+        case 2:
+            // Screen 2: MY NAME IS
+            M5.Display.fillScreen(COLOR_BG);
+            M5.Display.setTextSize(3);
+            M5.Display.drawString("MY NAME IS", DISPLAY_W / 2, DISPLAY_H / 2);
+            break;
+
+        case 3:
+            // Screen 3: PORKCHOP in big stylized text
+            M5.Display.fillScreen(COLOR_BG);
+            M5.Display.setTextDatum(middle_center);
+            M5.Display.setTextSize(3);
+            M5.Display.drawString("PORKCHOP", DISPLAY_W / 2, DISPLAY_H / 2 - 15);
+
+            // Subtitle
+            M5.Display.setTextSize(1);
+            M5.Display.drawString("BASICALLY YOU, BUT AS AN ASCII PIG.", DISPLAY_W / 2, DISPLAY_H / 2 + 20);
+            M5.Display.drawString("IDENTITY CRISIS EDITION.", DISPLAY_W / 2, DISPLAY_H / 2 + 35);
+            break;
+
+        case 4: {
+            // Screen 4: Welcome back (only shown when callsign is set)
+            const char* cs = Config::personality().callsign;
+            M5.Display.fillScreen(COLOR_BG);
+            M5.Display.setTextDatum(middle_center);
+            M5.Display.setTextSize(2);
+            M5.Display.drawString("WELCOME BACK", DISPLAY_W / 2, DISPLAY_H / 2 - 15);
+            M5.Display.setTextSize(3);
+            M5.Display.drawString(cs, DISPLAY_W / 2, DISPLAY_H / 2 + 15);
+            break;
+        }
     }
 }
 
-// Boot splash - 3 screens: OINK OINK, MY NAME IS, PORKCHOP
-void Display::showBootSplash() {
+static uint32_t splashScreenMs(uint8_t screen) {
+    switch (screen) {
+        case 1: return 800;
+        case 2: return 800;
+        case 3: return 1200;
+        case 4: return 1000;
+        default: return 0;
+    }
+}
+
+void Display::beginBootSplash() {
+    // Runs before Display::init()
+    M5.Display.setRotation(1);
+
     // Ensure splash uses 8-bit RGB332 to match sprite palette and avoid 16-bit conversion costs.
     // Splash draws directly to the display (no sprite heap allocation), but color depth still matters.
     M5.Display.setColorDepth(8);
 
-    // Screen 1: OINK OINK
-    M5.Display.fillScreen(COLOR_BG);
-    M5.Display.setTextColor(COLOR_FG);
-    M5.Display.setTextDatum(middle_center);
-    M5.Display.setTextSize(4);
-    M5.Display.drawString("OINK", DISPLAY_W / 2, DISPLAY_H / 2 - 20);
-    M5.Display.drawString("OINK", DISPLAY_W / 2, DISPLAY_H / 2 + 20);
-    
-    // Pig wake-up grunt: "oink oink"
-    SFX::play(SFX::BOOT);
-    
-    bootSplashDelay(800);
-    
-    // Screen 2: MY NAME IS
-    M5.Display.fillScreen(COLOR_BG);
-    M5.Display.setTextSize(3);
-    M5.Display.drawString("MY NAME IS", DISPLAY_W / 2, DISPLAY_H / 2);
-    bootSplashDelay(800);
-    
-    // Screen 3: PORKCHOP in big stylized text
-    M5.Display.fillScreen(COLOR_BG);
-    M5.Display.setTextDatum(middle_center);
-    M5.Display.setTextSize(3);
-    M5.Display.drawString("PORKCHOP", DISPLAY_W / 2, DISPLAY_H / 2 - 15);
-    
-    // Subtitle
-    M5.Display.setTextSize(1);
-    M5.Display.drawString("BASICALLY YOU, BUT AS AN ASCII PIG.", DISPLAY_W / 2, DISPLAY_H / 2 + 20);
-    M5.Display.drawString("IDENTITY CRISIS EDITION.", DISPLAY_W / 2, DISPLAY_H / 2 + 35);
+    splashDone = false;
+    splashScreen = 1;
+    splashScreenStart = millis();
+    drawSplashScreen(splashScreen);
+}
+
+bool Display::serviceBootSplash() {
+    if (splashDone) return true;
+
+    M5.update();
+    M5Cardputer.update();
+    SFX::update();
+    yield();
 
-    bootSplashDelay(1200);
+    if (millis() - splashScreenStart < splashScreenMs(splashScreen)) return false;
 
-    // Screen 4 (optional): Welcome back when callsign is set
-    const char* cs = Config::personality().callsign;
-    if (cs[0] != '\0') {
-        M5.Display.fillScreen(COLOR_BG);
-        M5.Display.setTextDatum(middle_center);
-        M5.Display.setTextSize(2);
-        M5.Display.drawString("WELCOME BACK", DISPLAY_W / 2, DISPLAY_H / 2 - 15);
-        M5.Display.setTextSize(3);
-        M5.Display.drawString(cs, DISPLAY_W / 2, DISPLAY_H / 2 + 15);
-        bootSplashDelay(1000);
+    uint8_t next = splashScreen + 1;
+    if (next == 4 && Config::personality().callsign[0] == '\0') next = 5;
+    if (next > 4) {
+        // Reset display state for main UI compatibility
+        M5.Display.setTextDatum(top_left);
+        M5.Display.setTextSize(1);
+        splashDone = true;
+        return true;
     }
 
-    // Reset display state for main UI compatibility
-    M5.Display.setTextDatum(top_left);
-    M5.Display.setTextSize(1);
+    splashScreen = next;
+    splashScreenStart = millis();
+    drawSplashScreen(splashScreen);
+    return false;
+}
+
+void Display::finishBootSplash() {
+    while (!serviceBootSplash()) {
+        delay(20);
+    }
+}
+
+// Boot splash - 3 screens: OINK OINK, MY NAME IS, PORKCHOP
+void Display::showBootSplash() {
+    beginBootSplash();
+    finishBootSplash();
 }
 
 
@@ -1326,6 +1526,7 @@ void Display::showToast(const char* message, uint32_t durationMs) {
     toastStartTime = millis();
     toastDurationMs = (durationMs > 0) ? durationMs : 2000;
     toastActive = true;
+    requestFrame();
 }
 
 static uint32_t defaultNoticeDuration(NoticeKind kind) {
@@ -1378,6 +1579,7 @@ void Display::setTopBarMessage(const String& message, uint32_t durationMs) {
     topBarMessage[sizeof(topBarMessage) - 1] = '\0';
     topBarMessageStart = millis();
     topBarMessageDuration = durationMs;
+    requestFrame();
 }
 
 void Display::setTopBarMessage(const char* message, uint32_t durationMs) {
@@ -1389,6 +1591,7 @@ void Display::setTopBarMessage(const char* message, uint32_t durationMs) {
     topBarMessage[sizeof(topBarMessage) - 1] = '\0';
     topBarMessageStart = millis();
     topBarMessageDuration = durationMs;
+    requestFrame();
 }
 
 void Display::clearTopBarMessage() {
@@ -2839,6 +3042,7 @@ void Display::drawFileTransferScreen(M5Canvas& canvas) {
 
 void Display::resetDimTimer() {
     lastActivityTime = millis();
+    requestFrame();
     if (screenForcedOff) {
         screenForcedOff = false;
         dimmed = false;
@@ -3097,6 +3301,7 @@ void Display::drawUploadProgressDirect() {
     M5Cardputer.Display.setTextSize(1);
     M5Cardputer.Display.setCursor(2, 3);  // Same Y=3 as XP notification
     M5Cardputer.Display.print(progressText);
+    invalidate();
 }
 
 void Display::clearUploadProgress() {
@@ -78,8 +78,13 @@ public:
     static M5Canvas& getBottomBar() { return bottomBar; }
     
     // Helper functions
-    static void pushAll();
-    static void showBootSplash();  // 3-screen boot animation
+    static void pushAll();          // Whole frame (blocking dialogs); resets changed-region tracking
+    static void invalidate();       // Something drew on the panel directly: next push sends all
+    static void requestFrame();     // Draw on the next update() regardless of the frame cap
+    static void showBootSplash();      // 3-screen boot animation (blocking)
+    static void beginBootSplash();     // Draw the first screen and return
+    static bool serviceBootSplash();   // Advance if due; true once finished
+    static void finishBootSplash();    // Block until the last screen is done
     static void showInfoBox(const String& title, const String& line1, 
                            const String& line2 = "", bool blocking = true);
     static bool showConfirmBox(const String& title, const String& message);
@@ -122,6 +127,17 @@ public:
     // Screenshot
     static bool takeScreenshot();     // Save screen to SD card, returns success
     static bool isSnapping() { return snapping; }  // True during screenshot save
+
+    // Frame pacing and SPI push counters (diagnostics)
+    struct FrameStats {
+        uint16_t fps;                 // Frames drawn in the last second
+        uint16_t pushesPerSec;        // Changed regions pushed in the last second
+        uint32_t pixelsPerSec;        // Pixels sent in the last second
+        uint32_t frameUs;             // Last frame, draw + push
+        uint32_t maxFrameUs;          // Slowest frame in the last second
+        uint8_t targetFps;            // Cap for the current mode (0 = uncapped)
+    };
+    static void getFrameStats(FrameStats& out);
     
 private:
     static M5Canvas topBar;
@@ -158,6 +174,7 @@ private:
     
     static void drawTopBar();
     static void drawBottomBar();
+    static void pushChanged();
     static void drawTopBarMessageTwoLineDirect();
     static void drawModeInfo(M5Canvas& canvas, PorkchopMode mode);
     static void drawSettingsScreen(M5Canvas& canvas);
@@ -6,6 +6,7 @@
 #include "display.h"
 #include "../core/config.h"
 #include "../core/network_recon.h"
+#include "../core/xp.h"
 #include "../web/fileserver.h"
 #include <M5Cardputer.h>
 #include <WiFi.h>
@@ -146,6 +147,7 @@ void SdFormatMenu::doReboot() {
     M5.Display.setTextSize(2);
     M5.Display.drawString("REBOOTING...", M5.Display.width() / 2, M5.Display.height() / 2);
     
+    XP::flush();  // Coalesced XP save still pending
     delay(REBOOT_DELAY_MS);
     ESP.restart();
     // Never reached
@@ -20,7 +20,8 @@ enum GroupId : uint8_t {
     GROUP_RADIO,
     GROUP_GPS,
     GROUP_BLE,
-    GROUP_LOG
+    GROUP_LOG,
+    GROUP_DISPLAY
 };
 
 enum SettingId : uint8_t {
@@ -49,10 +50,13 @@ enum SettingId : uint8_t {
     SET_SPEC_TOP,
     SET_SPEC_STALE,
     SET_SPEC_COLLAPSE,
+    SET_CAPTURE,
     SET_GPS_ENABLED,
     SET_GPS_SOURCE,
     SET_GPS_PWRSAVE,
     SET_GPS_SCAN_INTV,
+    SET_GPS_PASSIVE,
+    SET_GPS_INTERP,
     SET_GPS_BAUD,
     SET_GPS_RX,
     SET_GPS_TX,
@@ -60,7 +64,10 @@ enum SettingId : uint8_t {
     SET_BLE_BURST,
     SET_BLE_ADV,
     SET_SD_LOG,
-    SET_CALLSIGN
+    SET_CALLSIGN,
+    SET_FPS_AVATAR,
+    SET_FPS_SPECTRUM,
+    SET_FPS_MENU
 };
 
 struct RootEntry {
@@ -106,7 +113,8 @@ static const RootEntry kRootEntries[] = {
     {"INTEGRATION", "API KEYS", true, GROUP_INTEG, SET_THEME},
     {"RADIO", "WIFI SCAN/ATTACK TIMING", true, GROUP_RADIO, SET_THEME},
     {"GPS", "GPS MODULE SETTINGS", true, GROUP_GPS, SET_THEME},
-    {"BLE", "BLE ATTACK TUNING", true, GROUP_BLE, SET_THEME}
+    {"BLE", "BLE ATTACK TUNING", true, GROUP_BLE, SET_THEME},
+    {"DISPLAY", "FRAME RATE CAPS", true, GROUP_DISPLAY, SET_THEME}
 };
 static const EntryData kNetEntries[] = {
     {SET_WIFI_SSID, "WIFI SSID", SettingType::TEXT, 0, 0, 0, "", "NETWORK FOR FILE XFER"},
@@ -132,7 +140,8 @@ static const EntryData kRadioEntries[] = {
     {SET_SPEC_RSSI, "RSSI CUT", SettingType::VALUE, -95, -30, 5, "DB", "HIDE WEAK APS"},
     {SET_SPEC_TOP, "TOP APS", SettingType::VALUE, 0, 100, 5, "AP", "0 = NO CAP"},
     {SET_SPEC_STALE, "STALE SEC", SettingType::VALUE, 1, 20, 1, "S", "DROP QUIET APS"},
-    {SET_SPEC_COLLAPSE, "SSID MERG", SettingType::TOGGLE, 0, 1, 1, "", "MERGE SAME SSID"}
+    {SET_SPEC_COLLAPSE, "SSID MERG", SettingType::TOGGLE, 0, 1, 1, "", "MERGE SAME SSID"},
+    {SET_CAPTURE, "SESSION CAP", SettingType::VALUE, 0, (int)CAPTURE_MODE_COUNT - 1, 1, "", "FULL PCAPNG TO SD"}
 };
 
 static const EntryData kGpsEntries[] = {
@@ -140,6 +149,8 @@ static const EntryData kGpsEntries[] = {
     {SET_GPS_SOURCE, "GPS SRC", SettingType::VALUE, 0, (int)GPS_SOURCE_COUNT - 1, 1, "", "GROVE / LORACAP / CUSTOM"},
     {SET_GPS_PWRSAVE, "PWR SAVE", SettingType::TOGGLE, 0, 1, 1, "", "SLEEP WHEN NOT HUNTING"},
     {SET_GPS_SCAN_INTV, "SCAN INTV", SettingType::VALUE, 1, 30, 1, "S", "WARHOG SCAN FREQUENCY"},
+    {SET_GPS_PASSIVE, "PASSIVE WD", SettingType::TOGGLE, 0, 1, 1, "", "WARHOG SNIFFS, NO SCANS"},
+    {SET_GPS_INTERP, "FIX INTERP", SettingType::TOGGLE, 0, 1, 1, "", "PASSIVE: BLEND GPS FIXES"},
     {SET_GPS_BAUD, "GPS BAUD", SettingType::VALUE, 0, 3, 1, "", "MATCH YOUR GPS MODULE"},
     {SET_GPS_RX, "GPS RX PIN", SettingType::VALUE, 1, 46, 1, "", "G1=GROVE, G15=LORACAP"},
     {SET_GPS_TX, "GPS TX PIN", SettingType::VALUE, 1, 46, 1, "", "G2=GROVE, G13=LORACAP"},
@@ -153,6 +164,12 @@ static const EntryData kBleEntries[] = {
 
 // ML entries removed for heap savings
 
+static const EntryData kDisplayEntries[] = {
+    {SET_FPS_AVATAR, "PIG FPS", SettingType::VALUE, 0, 30, 1, "FPS", "0 = NO CAP"},
+    {SET_FPS_SPECTRUM, "SPECTRM FPS", SettingType::VALUE, 0, 30, 1, "FPS", "0 = NO CAP"},
+    {SET_FPS_MENU, "MENU FPS", SettingType::VALUE, 0, 30, 1, "FPS", "0 = NO CAP"}
+};
+
 static const EntryData kLogEntries[] = {
     {SET_SD_LOG, "SD LOG", SettingType::TOGGLE, 0, 1, 1, "", "DEBUG SPAM TO SD"}
 };
@@ -173,6 +190,13 @@ static const char* const kBootModeLabels[BOOT_MODE_COUNT] = {
     "WARHOG"
 };
 
+static const char* const kCaptureModeLabels[CAPTURE_MODE_COUNT] = {
+    "OFF",
+    "MGMT",
+    "EAPOL",
+    "ALL"
+};
+
 static const uint32_t kGpsBaudRates[] = {9600, 38400, 57600, 115200};
 
 static const char* const kGpsSourceLabels[GPS_SOURCE_COUNT] = {
@@ -195,7 +219,8 @@ static bool isTextEditable(SettingId id) {
 static bool isPersonalitySetting(SettingId id) {
     return id == SET_THEME || id == SET_BRIGHTNESS || id == SET_SOUND ||
            id == SET_DIM_AFTER || id == SET_DIM_LEVEL || id == SET_G0_ACTION ||
-           id == SET_BOOT_MODE || id == SET_CALLSIGN;
+           id == SET_BOOT_MODE || id == SET_CALLSIGN || id == SET_FPS_AVATAR ||
+           id == SET_FPS_SPECTRUM || id == SET_FPS_MENU;
 }
 
 static bool isConfigSetting(SettingId id) {
@@ -213,10 +238,13 @@ static bool isConfigSetting(SettingId id) {
         case SET_SPEC_TOP:
         case SET_SPEC_STALE:
         case SET_SPEC_COLLAPSE:
+        case SET_CAPTURE:
         case SET_GPS_ENABLED:
         case SET_GPS_SOURCE:
         case SET_GPS_PWRSAVE:
         case SET_GPS_SCAN_INTV:
+        case SET_GPS_PASSIVE:
+        case SET_GPS_INTERP:
         case SET_GPS_BAUD:
         case SET_GPS_RX:
         case SET_GPS_TX:
@@ -258,6 +286,9 @@ static const EntryData* getGroupEntries(GroupId group, size_t* count) {
         case GROUP_LOG:
             *count = sizeof(kLogEntries) / sizeof(kLogEntries[0]);
             return kLogEntries;
+        case GROUP_DISPLAY:
+            *count = sizeof(kDisplayEntries) / sizeof(kDisplayEntries[0]);
+            return kDisplayEntries;
         default:
             *count = 0;
             return nullptr;
@@ -278,6 +309,8 @@ static const char* getGroupLabel(GroupId group) {
             return "BLE";
         case GROUP_LOG:
             return "LOG";
+        case GROUP_DISPLAY:
+            return "DISPLAY";
         default:
             return "SETTINGS";
     }
@@ -483,6 +516,13 @@ static const char* getGpsSourceLabel(int idx) {
     return kGpsSourceLabels[idx];
 }
 
+static const char* getCaptureModeLabel(int idx) {
+    if (idx < 0 || idx >= (int)CAPTURE_MODE_COUNT) {
+        return kCaptureModeLabels[0];
+    }
+    return kCaptureModeLabels[idx];
+}
+
 static int getSettingValue(SettingId id) {
     switch (id) {
         case SET_THEME:
@@ -499,6 +539,12 @@ static int getSettingValue(SettingId id) {
             return static_cast<int>(Config::personality().g0Action);
         case SET_BOOT_MODE:
             return static_cast<int>(Config::personality().bootMode);
+        case SET_FPS_AVATAR:
+            return Config::personality().avatarFps;
+        case SET_FPS_SPECTRUM:
+            return Config::personality().spectrumFps;
+        case SET_FPS_MENU:
+            return Config::personality().menuFps;
         case SET_CH_HOP:
             return Config::wifi().channelHopInterval;
         case SET_SPEC_SWEEP:
@@ -521,6 +567,8 @@ static int getSettingValue(SettingId id) {
             return (int)(Config::wifi().spectrumStaleMs / 1000);
         case SET_SPEC_COLLAPSE:
             return Config::wifi().spectrumCollapseSsid ? 1 : 0;
+        case SET_CAPTURE:
+            return static_cast<int>(Config::wifi().captureMode);
         case SET_GPS_ENABLED:
             return Config::gps().enabled ? 1 : 0;
         case SET_GPS_SOURCE:
@@ -529,6 +577,10 @@ static int getSettingValue(SettingId id) {
             return Config::gps().powerSave ? 1 : 0;
         case SET_GPS_SCAN_INTV:
             return Config::gps().updateInterval;
+        case SET_GPS_PASSIVE:
+            return Config::gps().passiveWardrive ? 1 : 0;
+        case SET_GPS_INTERP:
+            return Config::gps().interpolateFix ? 1 : 0;
         case SET_GPS_BAUD:
             return getGpsBaudIndex();
         case SET_GPS_RX:
@@ -602,6 +654,24 @@ static bool setSettingValue(SettingId id, int value) {
             Config::personality().bootMode = static_cast<BootMode>(newVal);
             return true;
         }
+        case SET_FPS_AVATAR: {
+            uint8_t newVal = static_cast<uint8_t>(value);
+            if (Config::personality().avatarFps == newVal) return false;
+            Config::personality().avatarFps = newVal;
+            return true;
+        }
+        case SET_FPS_SPECTRUM: {
+            uint8_t newVal = static_cast<uint8_t>(value);
+            if (Config::personality().spectrumFps == newVal) return false;
+            Config::personality().spectrumFps = newVal;
+            return true;
+        }
+        case SET_FPS_MENU: {
+            uint8_t newVal = static_cast<uint8_t>(value);
+            if (Config::personality().menuFps == newVal) return false;
+            Config::personality().menuFps = newVal;
+            return true;
+        }
         case SET_CH_HOP: {
             uint16_t newVal = static_cast<uint16_t>(value);
             if (Config::wifi().channelHopInterval == newVal) return false;
@@ -680,6 +750,14 @@ static bool setSettingValue(SettingId id, int value) {
             Config::wifi().spectrumCollapseSsid = enabled;
             return true;
         }
+        case SET_CAPTURE: {
+            uint8_t newVal = static_cast<uint8_t>(value);
+            if (newVal >= CAPTURE_MODE_COUNT) newVal = 0;
+            CaptureMode mode = static_cast<CaptureMode>(newVal);
+            if (Config::wifi().captureMode == mode) return false;
+            Config::wifi().captureMode = mode;
+            return true;
+        }
         case SET_GPS_ENABLED: {
             bool enabled = value != 0;
             if (Config::gps().enabled == enabled) return false;
@@ -715,6 +793,18 @@ static bool setSettingValue(SettingId id, int value) {
             Config::gps().updateInterval = newVal;
             return true;
         }
+        case SET_GPS_PASSIVE: {
+            bool enabled = value != 0;
+            if (Config::gps().passiveWardrive == enabled) return false;
+            Config::gps().passiveWardrive = enabled;
+            return true;
+        }
+        case SET_GPS_INTERP: {
+            bool enabled = value != 0;
+            if (Config::gps().interpolateFix == enabled) return false;
+            Config::gps().interpolateFix = enabled;
+            return true;
+        }
         case SET_GPS_BAUD: {
             uint32_t newBaud = getGpsBaudForIndex(value);
             if (Config::gps().baudRate == newBaud) return false;
@@ -1414,6 +1504,14 @@ void SettingsMenu::draw(M5Canvas& canvas) {
                     strncpy(valBuf, srcLabel, sizeof(valBuf) - 1);
                     valBuf[sizeof(valBuf) - 1] = '\0';
                 }
+            } else if (entry.id == SET_CAPTURE) {
+                const char* capLabel = getCaptureModeLabel(value);
+                if (selected && editing) {
+                    snprintf(valBuf, sizeof(valBuf), "[%s]", capLabel);
+                } else {
+                    strncpy(valBuf, capLabel, sizeof(valBuf) - 1);
+                    valBuf[sizeof(valBuf) - 1] = '\0';
+                }
             } else if (selected && editing) {
                 snprintf(valBuf, sizeof(valBuf), "[%d%s]", value, entry.suffix);
             } else {
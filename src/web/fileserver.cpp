@@ -8,15 +8,23 @@
 #include <pgmspace.h>
 #include <ctype.h>
 #include <string.h>
+#include <stdarg.h>
 #include <vector>
 #include <atomic>
+#include <new>
 #include "../core/wifi_utils.h"
 #include "../core/heap_gates.h"
 #include "../core/heap_policy.h"
+#include "../core/heap_trace.h"
 #include "../core/xp.h"
 #include "../ui/swine_stats.h"
 #include "../core/sd_layout.h"
+#include "../core/capture_catalog.h"
+#include "../core/membership_file.h"
 #include "wigle.h"
+#include "zip_stream.h"
+#include "web_assets_gz.h"
+#include "http_range.h"
 
 #ifndef PORKCHOP_LOG_ENABLED
 #define PORKCHOP_LOG_ENABLED 1
@@ -68,17 +76,13 @@ static const uint16_t XP_WIGLE_PER = 10;
 static const uint16_t XP_SESSION_CAP = 200;
 static const size_t MIN_PCAP_BYTES = 300;
 static const size_t MIN_WIGLE_BYTES = 200;
-static const size_t XP_AWARD_CACHE_MAX = 512;
 static uint32_t xpLastScanMs = 0;
 static uint32_t xpLastUploadCount = 0;
 static uint16_t xpSessionAwarded = 0;
 static bool xpScanPending = false;
-static bool xpWpaLoaded = false;
-static bool xpWigleLoaded = false;
-static bool xpWpaCacheComplete = false;
-static bool xpWigleCacheComplete = false;
-static std::vector<String> xpAwardedWpa;
-static std::vector<String> xpAwardedWigle;
+// Awarded BSSIDs / CSV paths (hashed sets over the award files, no cap)
+static MembershipFile xpAwardedWpa;
+static MembershipFile xpAwardedWigle;
 
 static void refreshSdPaths() {
     XP_WPA_AWARDED_FILE = SDLayout::xpAwardedWpaPath();
@@ -137,18 +141,12 @@ static bool isUiHeapLow(size_t* outFree, size_t* outLargest) {
     return (freeHeap < UI_MIN_FREE) || (largest < UI_MIN_LARGEST);
 }
 
-static size_t sendProgmemResponse(WebServer* srv, int status, const char* contentType, const char* data) {
-    if (!srv || !data) return 0;
-    const size_t totalLen = strlen_P(data);
-    srv->sendHeader("Connection", "close");
-    srv->sendHeader("Cache-Control", "no-store");
-    srv->setContentLength(totalLen);
-    srv->send(status, contentType, "");
-
+// Body writer for PROGMEM responses; headers must already be sent
+static size_t writeProgmemBody(WebServer* srv, const char* data, size_t totalLen) {
     WiFiClient client = srv->client();
     client.setNoDelay(true);
 
-    const size_t chunkSize = 512;
+    const size_t chunkSize = 1460;  // One TCP MSS; flash is memory-mapped on ESP32
     size_t offset = 0;
     uint32_t lastProgress = millis();
 
@@ -174,10 +172,49 @@ static size_t sendProgmemResponse(WebServer* srv, int status, const char* conten
     return offset;
 }
 
+static size_t sendProgmemResponse(WebServer* srv, int status, const char* contentType, const char* data) {
+    if (!srv || !data) return 0;
+    const size_t totalLen = strlen_P(data);
+    srv->sendHeader("Connection", "close");
+    srv->sendHeader("Cache-Control", "no-store");
+    srv->setContentLength(totalLen);
+    srv->send(status, contentType, "");
+    return writeProgmemBody(srv, data, totalLen);
+}
+
 static size_t sendProgmemResponse(WebServer* srv, const char* contentType, const char* data) {
     return sendProgmemResponse(srv, 200, contentType, data);
 }
 
+// Browser already holds this build's copy: revalidated with no body
+static bool sendNotModifiedIfCached(WebServer* srv, const char* etag) {
+    if (!srv->hasHeader("If-None-Match")) return false;
+    if (srv->header("If-None-Match").indexOf(etag) < 0) return false;
+    srv->sendHeader("Connection", "close");
+    srv->sendHeader("Cache-Control", "no-cache");
+    srv->sendHeader("ETag", etag);
+    srv->send(304);
+    return true;
+}
+
+// UI asset gzipped at build time (scripts/web_assets.py). no-cache + ETag:
+// every load revalidates, but only a firmware update moves the bytes again.
+// Clients that don't take gzip get the plain PROGMEM copy.
+static size_t sendGzipAsset(WebServer* srv, const char* contentType, const uint8_t* gz,
+                            size_t gzLen, const char* etag, const char* plain) {
+    if (srv->header("Accept-Encoding").indexOf("gzip") < 0) {
+        return sendProgmemResponse(srv, contentType, plain);
+    }
+    srv->sendHeader("Connection", "close");
+    srv->sendHeader("Cache-Control", "no-cache");
+    srv->sendHeader("ETag", etag);
+    srv->sendHeader("Vary", "Accept-Encoding");
+    srv->sendHeader("Content-Encoding", "gzip");
+    srv->setContentLength(gzLen);
+    srv->send(200, contentType, "");
+    return writeProgmemBody(srv, reinterpret_cast<const char*>(gz), gzLen);
+}
+
 static const char LOW_HEAP_PAGE[] PROGMEM = R"rawliteral(
 <!DOCTYPE html>
 <html>
@@ -213,13 +250,6 @@ static void resetUploadState(bool removePartial) {
     uploadDirBuf[0] = '\0';
 }
 
-static bool listContains(const std::vector<String>& list, const String& value) {
-    for (const auto& entry : list) {
-        if (entry == value) return true;
-    }
-    return false;
-}
-
 // FIX: Rewritten to avoid heap allocations in hot path.
 // Uses char* comparisons instead of creating temporary String objects.
 static String mapUiPathToFs(const String& path) {
@@ -287,83 +317,6 @@ static bool isSameOrSubPath(const String& parent, const String& child) {
     return (c.length() > p.length() && c.charAt(p.length()) == '/');
 }
 
-static void loadAwardedList(const char* path, std::vector<String>& out, bool& loaded, bool& complete) {
-    if (loaded) return;
-    if (!path || !path[0]) {
-        out.clear();
-        complete = true;
-        loaded = true;
-        return;
-    }
-    out.clear();
-    out.reserve(XP_AWARD_CACHE_MAX);  // FIX: Pre-allocate to avoid realloc fragmentation
-    complete = true;
-    File f = SD.open(path, FILE_READ);
-    if (f) {
-        String line;
-        line.reserve(128);  // Pre-allocate to reduce heap fragmentation
-        while (f.available()) {
-            yield();  // FIX: Prevent WDT on large files
-            line = f.readStringUntil('\n');  // Reuses existing capacity
-            line.trim();
-            if (line.length()) {
-                if (out.size() < XP_AWARD_CACHE_MAX) {
-                    out.push_back(line);
-                } else {
-                    complete = false;
-                    break;
-                }
-            }
-        }
-        f.close();
-    }
-    loaded = true;
-}
-
-static bool appendAwarded(const char* path, std::vector<String>& out, const String& value) {
-    if (!path || !path[0]) return false;
-    if (listContains(out, value)) return false;
-    if (out.size() >= XP_AWARD_CACHE_MAX) return false;  // FIX: Cap vector size
-    File f = SD.open(path, FILE_APPEND);
-    if (!f) return false;
-    f.println(value);
-    f.close();
-    out.push_back(value);
-    return true;
-}
-
-static bool fileHasLine(const char* path, const String& value) {
-    if (!path || !path[0]) return false;
-    File f = SD.open(path, FILE_READ);
-    if (!f) return false;
-    String line;
-    line.reserve(128);  // Pre-allocate to reduce heap fragmentation
-    while (f.available()) {
-        yield();  // FIX: Prevent WDT on large files
-        line = f.readStringUntil('\n');  // Reuses existing capacity
-        line.trim();
-        if (!line.length()) continue;
-        if (line == value) {
-            f.close();
-            return true;
-        }
-    }
-    f.close();
-    return false;
-}
-
-static bool isAwarded(const char* path,
-                      const String& value,
-                      std::vector<String>& cache,
-                      bool& loaded,
-                      bool& complete) {
-    loadAwardedList(path, cache, loaded, complete);
-    if (!path || !path[0]) return false;
-    if (listContains(cache, value)) return true;
-    if (complete) return false;
-    return fileHasLine(path, value);
-}
-
 static String normalizeHexToken(const String& input, size_t maxLen) {
     String out;
     out.reserve(maxLen);
@@ -448,11 +401,12 @@ static bool wigleLooksValid(const String& path) {
     return wigleLooksValid(path.c_str());
 }
 
-static bool awardXpEntry(const char* src, uint16_t per, const char* awardFile, std::vector<String>& awardList, const String& key) {
+static bool awardXpEntry(const char* src, uint16_t per, MembershipFile& awardList, const String& key) {
     if (xpSessionAwarded + per > XP_SESSION_CAP) {
         return false;
     }
-    if (!appendAwarded(awardFile, awardList, key)) {
+    // Sidecar is written once at the end of the scan
+    if (!awardList.add(key.c_str(), false)) {
         return false;
     }
     XP::addXP(per);
@@ -474,8 +428,8 @@ static void scanXpAwards() {
         return;
     }
 
-    loadAwardedList(XP_WPA_AWARDED_FILE, xpAwardedWpa, xpWpaLoaded, xpWpaCacheComplete);
-    loadAwardedList(XP_WIGLE_AWARDED_FILE, xpAwardedWigle, xpWigleLoaded, xpWigleCacheComplete);
+    xpAwardedWpa.load(XP_WPA_AWARDED_FILE);
+    xpAwardedWigle.load(XP_WIGLE_AWARDED_FILE);
 
     // WPA-SEC awards
     // FIX: Reuse String objects to reduce heap fragmentation
@@ -498,10 +452,10 @@ static void scanXpAwards() {
             if (!line.length()) continue;
             bssid = normalizeHexToken(line, 12);
             if (bssid.length() < 12) continue;
-            if (isAwarded(XP_WPA_AWARDED_FILE, bssid, xpAwardedWpa, xpWpaLoaded, xpWpaCacheComplete)) continue;
+            if (xpAwardedWpa.contains(bssid.c_str())) continue;
             snprintf(pcapPathBuf, sizeof(pcapPathBuf), "%s/%s.pcap", hsDir, bssid.c_str());
             if (!pcapLooksValid(pcapPathBuf)) continue;
-            awardXpEntry("WPA", XP_WPA_PER, XP_WPA_AWARDED_FILE, xpAwardedWpa, bssid);
+            awardXpEntry("WPA", XP_WPA_PER, xpAwardedWpa, bssid);
         }
         wpaFile.close();
     }
@@ -537,12 +491,15 @@ static void scanXpAwards() {
             const char* ext = path.c_str() + pathLen - 10;
             if (strcasecmp(ext, ".wigle.csv") != 0) continue;
             
-            if (isAwarded(XP_WIGLE_AWARDED_FILE, path, xpAwardedWigle, xpWigleLoaded, xpWigleCacheComplete)) continue;
+            if (xpAwardedWigle.contains(path.c_str())) continue;
             if (!wigleLooksValid(path)) continue;
-            awardXpEntry("WIGLE", XP_WIGLE_PER, XP_WIGLE_AWARDED_FILE, xpAwardedWigle, path);
+            awardXpEntry("WIGLE", XP_WIGLE_PER, xpAwardedWigle, path);
         }
         wigleFile.close();
     }
+
+    xpAwardedWpa.saveIndex();
+    xpAwardedWigle.saveIndex();
 }
 
 static void appendJsonEscaped(String& out, const char* in) {
@@ -2345,20 +2302,27 @@ async function deleteSelected() {
 }
 
 async function downloadSelected() {
-    const items = getSelectedPaths().filter(i => !i.isDir);
+    const items = getSelectedPaths();
     if (items.length === 0) {
-        addSysLog('NO FILES MARKED. DIRS NEED ZIP. WE AINT GOT ZIP.');
+        addSysLog('NO FILES MARKED.');
         return;
     }
     
-    addSysLog('EXFILTRATING ' + items.length + ' FILE(S)...');
+    addSysLog('EXFILTRATING ' + items.length + ' ITEM(S)...');
     
     // Download files sequentially (browser limitation)
+    // Folders stream as ZIP; text files inside get deflated on the fly
     for (let i = 0; i < items.length; i++) {
         await new Promise(resolve => {
             const a = document.createElement('a');
-            a.href = '/download?f=' + encodeURIComponent(items[i].path);
-            a.download = items[i].path.split('/').pop();
+            const name = items[i].path.split('/').pop() || 'sd';
+            if (items[i].isDir) {
+                a.href = '/download?deflate=1&dir=' + encodeURIComponent(items[i].path);
+                a.download = name + '.zip';
+            } else {
+                a.href = '/download?f=' + encodeURIComponent(items[i].path);
+                a.download = name;
+            }
             a.click();
             setTimeout(resolve, 300); // Small delay between downloads
         });
@@ -2777,10 +2741,54 @@ function normalizeBssid(raw) {
     return raw.replace(/[^a-fA-F0-9]/g, '').toUpperCase();
 }
 
+// SoftAP transfers drop mid-file; resume from the last byte with Range.
+// If-Range makes the device send the whole file again if it changed.
 async function fetchDeviceBlob(path) {
-    const resp = await queuedFetch('/download?f=' + encodeURIComponent(path));
-    if (!resp.ok) throw new Error('device read failed (' + resp.status + ')');
-    return await resp.blob();
+    const url = '/download?f=' + encodeURIComponent(path);
+    const parts = [];
+    let received = 0;
+    let total = -1;
+    let validator = null;
+    let lastError = null;
+    for (let attempt = 0; attempt < 4; attempt++) {
+        if (attempt > 0) await new Promise(r => setTimeout(r, 500 * attempt));
+        const headers = {};
+        if (received > 0) {
+            headers['Range'] = 'bytes=' + received + '-';
+            if (validator) headers['If-Range'] = validator;
+        }
+        let resp;
+        try {
+            resp = await queuedFetch(url, { headers });
+        } catch (e) {
+            lastError = e;
+            continue;
+        }
+        if (!resp.ok) throw new Error('device read failed (' + resp.status + ')');
+        if (resp.status === 200) {
+            // Fresh copy: range ignored or file changed since the last piece
+            parts.length = 0;
+            received = 0;
+            total = parseInt(resp.headers.get('Content-Length') || '-1', 10);
+        } else {
+            const m = /\/(\d+)$/.exec(resp.headers.get('Content-Range') || '');
+            if (m) total = parseInt(m[1], 10);
+        }
+        validator = resp.headers.get('ETag') || validator;
+        const reader = resp.body.getReader();
+        try {
+            for (;;) {
+                const { done, value } = await reader.read();
+                if (done) break;
+                parts.push(value);
+                received += value.length;
+            }
+        } catch (e) {
+            lastError = e;  // Keep what arrived, resume below
+        }
+        if (total < 0 || received >= total) return new Blob(parts);
+    }
+    throw new Error('device read failed (' + received + '/' + total + (lastError ? ', ' + lastError.message : '') + ')');
 }
 
 async function fetchDeviceText(path) {
@@ -3335,6 +3343,7 @@ void FileServer::init() {
 }
 
 bool FileServer::start(const char* ssid, const char* password) {
+    HeapTrace::Scope heapTag(HeapTrace::Tag::FileServer);
     if (state != FileServerState::IDLE) {
         return true;
     }
@@ -3452,12 +3461,17 @@ void FileServer::startServer() {
     FS_LOGLN("[DBG-H3] Registering handlers...");
     // #endregion
     
+    // WebServer drops request headers it wasn't told to keep
+    const char* headerKeys[] = {"If-None-Match", "Accept-Encoding", "Range", "If-Range"};
+    server->collectHeaders(headerKeys, sizeof(headerKeys) / sizeof(headerKeys[0]));
+    
     server->on("/", HTTP_GET, handleRoot);
     server->on("/ui.css", HTTP_GET, handleStyle);
     server->on("/ui.js", HTTP_GET, handleScript);
     server->on("/api/swine", HTTP_GET, handleSwine);
     server->on("/api/ls", HTTP_GET, handleFileList);
     server->on("/api/sdinfo", HTTP_GET, handleSDInfo);
+    server->on("/api/heap", HTTP_GET, handleHeap);
     server->on("/api/bulkdelete", HTTP_POST, handleBulkDelete);
     server->on("/api/rename", HTTP_GET, handleRename);
     server->on("/api/copy", HTTP_POST, handleCopy);
@@ -3487,12 +3501,8 @@ void FileServer::startServer() {
     xpLastUploadCount = sessionUploadCount;
     xpSessionAwarded = 0;
     xpScanPending = true;
-    xpAwardedWpa.clear();
-    xpAwardedWigle.clear();
-    xpWpaLoaded = false;
-    xpWigleLoaded = false;
-    xpWpaCacheComplete = false;
-    xpWigleCacheComplete = false;
+    xpAwardedWpa.release();
+    xpAwardedWigle.release();
 }
 
 void FileServer::stop() {
@@ -3540,15 +3550,9 @@ void FileServer::stop() {
     sessionDownloadCount = 0;
     xpSessionAwarded = 0;
     xpScanPending = false;
-    // FIX: Purge vectors to free heap, prevent unbounded growth
-    xpAwardedWpa.clear();
-    xpAwardedWpa.shrink_to_fit();
-    xpAwardedWigle.clear();
-    xpAwardedWigle.shrink_to_fit();
-    xpWpaLoaded = false;
-    xpWigleLoaded = false;
-    xpWpaCacheComplete = false;
-    xpWigleCacheComplete = false;
+    // Free the award sets (reloaded from their sidecars next session)
+    xpAwardedWpa.release();
+    xpAwardedWigle.release();
 }
 
 void FileServer::update() {
@@ -3662,6 +3666,9 @@ void FileServer::handleRoot() {
         sendBusyResponse(server);
         return;
     }
+    if (sendNotModifiedIfCached(server, HTML_TEMPLATE_ETAG)) {
+        return;
+    }
     logHeapStatus("before /");
     size_t freeHeap = 0;
     size_t largest = 0;
@@ -3672,7 +3679,8 @@ void FileServer::handleRoot() {
         sessionTxBytes += sent;
         return;
     }
-    size_t sent = sendProgmemResponse(server, "text/html; charset=utf-8", HTML_TEMPLATE);
+    size_t sent = sendGzipAsset(server, "text/html; charset=utf-8", HTML_TEMPLATE_GZ,
+                                HTML_TEMPLATE_GZ_LEN, HTML_TEMPLATE_ETAG, HTML_TEMPLATE);
     sessionTxBytes += sent;
     logHeapStatus("after /");
 }
@@ -3683,6 +3691,9 @@ void FileServer::handleStyle() {
         sendBusyResponse(server);
         return;
     }
+    if (sendNotModifiedIfCached(server, HTML_STYLE_ETAG)) {
+        return;
+    }
     size_t freeHeap = 0;
     size_t largest = 0;
     if (isUiHeapLow(&freeHeap, &largest)) {
@@ -3692,7 +3703,8 @@ void FileServer::handleStyle() {
         server->send(503, "text/plain", "LOW HEAP");
         return;
     }
-    size_t sent = sendProgmemResponse(server, "text/css", HTML_STYLE);
+    size_t sent = sendGzipAsset(server, "text/css", HTML_STYLE_GZ,
+                                HTML_STYLE_GZ_LEN, HTML_STYLE_ETAG, HTML_STYLE);
     sessionTxBytes += sent;
 }
 
@@ -3702,6 +3714,9 @@ void FileServer::handleScript() {
         sendBusyResponse(server);
         return;
     }
+    if (sendNotModifiedIfCached(server, HTML_SCRIPT_ETAG)) {
+        return;
+    }
     size_t freeHeap = 0;
     size_t largest = 0;
     if (isUiHeapLow(&freeHeap, &largest)) {
@@ -3711,7 +3726,8 @@ void FileServer::handleScript() {
         server->send(503, "text/plain", "LOW HEAP");
         return;
     }
-    size_t sent = sendProgmemResponse(server, "application/javascript", HTML_SCRIPT);
+    size_t sent = sendGzipAsset(server, "application/javascript", HTML_SCRIPT_GZ,
+                                HTML_SCRIPT_GZ_LEN, HTML_SCRIPT_ETAG, HTML_SCRIPT);
     sessionTxBytes += sent;
 }
 
@@ -3728,6 +3744,82 @@ void FileServer::handleSwine() {
     sessionTxBytes += strlen(json);
 }
 
+// Formats small pieces into one buffer and sends it as a chunk when full
+struct JsonChunker {
+    static const size_t kPieceMax = 160;
+    WebServer* srv;
+    uint64_t* txBytes;
+    char buf[512];
+    size_t len;
+
+    void flush() {
+        if (len == 0) return;
+        srv->sendContent(buf, len);
+        *txBytes += len;
+        len = 0;
+    }
+
+    // Each piece must fit in kPieceMax
+    void printf(const char* fmt, ...) {
+        if (len > sizeof(buf) - kPieceMax) flush();
+        va_list args;
+        va_start(args, fmt);
+        int n = vsnprintf(buf + len, sizeof(buf) - len, fmt, args);
+        va_end(args);
+        if (n > 0) len += ((size_t)n < sizeof(buf) - len) ? (size_t)n : sizeof(buf) - len - 1;
+    }
+};
+
+void FileServer::handleHeap() {
+    logRequest(server, "REQ");
+    if (isTransferBusy()) {
+        sendBusyResponse(server);
+        return;
+    }
+
+    server->sendHeader("Connection", "close");
+    server->sendHeader("Cache-Control", "no-store");
+    server->setContentLength(CONTENT_LENGTH_UNKNOWN);
+    server->send(200, "application/json", "");
+
+    // The series alone is a few KB of JSON: chunked from a stack buffer
+    JsonChunker out = {server, &sessionTxBytes, {0}, 0};
+    HeapTrace::Totals totals;
+    HeapTrace::getTotals(totals);
+    out.printf("{\"free\":%u,\"largest\":%u,\"minFree\":%u,\"traced\":%s",
+               (unsigned)ESP.getFreeHeap(),
+               (unsigned)heap_caps_get_largest_free_block(MALLOC_CAP_8BIT),
+               (unsigned)ESP.getMinFreeHeap(),
+               HeapTrace::isEnabled() ? "true" : "false");
+    out.printf(",\"tracked\":%u,\"blocks\":%u,\"slots\":%u,\"overflow\":%u,\"stray\":%u",
+               (unsigned)totals.trackedBytes, (unsigned)totals.blocks, (unsigned)totals.capacity,
+               (unsigned)totals.overflowed, (unsigned)totals.strayFrees);
+
+    out.printf(",\"tags\":[");
+    for (uint8_t i = 0; i < HeapLedger::kTagCount; i++) {
+        HeapLedger::Tag tag = (HeapLedger::Tag)i;
+        HeapLedger::TagStats ts;
+        HeapTrace::getTagStats(tag, ts);
+        out.printf("%s{\"tag\":\"%s\",\"live\":%u,\"peak\":%u,\"blocks\":%u,\"allocs\":%u,\"frees\":%u}",
+                   i ? "," : "", HeapLedger::tagName(tag),
+                   (unsigned)ts.liveBytes, (unsigned)ts.peakBytes, (unsigned)ts.liveBlocks,
+                   (unsigned)ts.allocs, (unsigned)ts.frees);
+    }
+
+    // [uptime s, free, largest, frag permille], oldest first
+    out.printf("],\"series\":[");
+    uint16_t n = HeapTrace::sampleCount();
+    for (uint16_t i = 0; i < n; i++) {
+        HeapLedger::Sample smp = HeapTrace::getSample(i);
+        out.printf("%s[%u,%u,%u,%u]", i ? "," : "", (unsigned)(smp.ms / 1000),
+                   (unsigned)smp.freeBytes, (unsigned)smp.largest,
+                   (unsigned)HeapLedger::fragPermille(smp));
+    }
+    out.printf("]}");
+    out.flush();
+    server->sendContent("");  // Finalize chunked transfer
+}
+
 void FileServer::handleSDInfo() {
     logRequest(server, "REQ");
     if (isTransferBusy()) {
@@ -3877,6 +3969,36 @@ void FileServer::handleFileList() {
     listActive.store(false);
 }
 
+// Shared by /download and the ZIP stream - one transfer at a time (single-threaded server)
+static uint8_t transferBuffer[1024];
+
+// Write all of data, waiting out a full TCP window. Returns bytes written;
+// less than len means the client went away or stalled for 8s.
+static size_t writeStallAware(WiFiClient& client, const uint8_t* data, size_t len, uint32_t& lastProgress) {
+    size_t offset = 0;
+    while (offset < len && client.connected()) {
+        size_t chunk = len - offset;
+        int avail = client.availableForWrite();
+        if (avail > 0 && chunk > static_cast<size_t>(avail)) {
+            chunk = static_cast<size_t>(avail);
+        }
+
+        size_t written = client.write(data + offset, chunk);
+        if (written == 0) {
+            if (millis() - lastProgress > 8000) {
+                break;
+            }
+            delay(1);
+            yield();
+            continue;
+        }
+
+        offset += written;
+        lastProgress = millis();
+    }
+    return offset;
+}
+
 void FileServer::handleDownload() {
     String path = mapUiPathToFs(server->arg("f"));
     String dir = mapUiPathToFs(server->arg("dir"));  // For ZIP download
@@ -3885,10 +4007,7 @@ void FileServer::handleDownload() {
     
     // ZIP download of folder
     if (!dir.isEmpty()) {
-        // Simple implementation: send files one by one is not possible
-        // Instead, we'll create a simple text manifest for now
-        // Full ZIP requires external library
-        server->send(501, "text/plain", "ZIP download not yet implemented - download files individually");
+        handleZipDownload(dir);
         return;
     }
     
@@ -3936,68 +4055,95 @@ void FileServer::handleDownload() {
     
     const size_t totalSize = file.size();
     
+    // The ETag (size + mtime) is the If-Range validator for resumed
+    // transfers; Last-Modified is informational only
+    char lastModified[HttpRange::kHttpDateLen + 1] = {0};
+    time_t mtime = file.getLastWrite();
+    if (mtime > 0) {
+        HttpRange::formatHttpDate((uint32_t)mtime, lastModified);
+    }
+    char etag[HttpRange::kETagLen + 1];
+    HttpRange::formatETag((uint32_t)totalSize, mtime > 0 ? (uint32_t)mtime : 0, etag);
+
+    // Single byte range; a stale If-Range (file changed) falls back to 200
+    uint32_t rangeStart = 0;
+    uint32_t rangeEnd = totalSize > 0 ? (uint32_t)totalSize - 1 : 0;
+    bool partial = false;
+    if (server->hasHeader("Range")) {
+        bool validatorOk = !server->hasHeader("If-Range") ||
+                           HttpRange::ifRangeMatches(server->header("If-Range").c_str(), etag);
+        HttpRange::Result range = HttpRange::Result::None;
+        if (validatorOk) {
+            range = HttpRange::parse(server->header("Range").c_str(), (uint32_t)totalSize,
+                                     rangeStart, rangeEnd);
+        }
+        if (range == HttpRange::Result::Unsatisfiable) {
+            char contentRange[32];
+            snprintf(contentRange, sizeof(contentRange), "bytes */%u", (unsigned)totalSize);
+            file.close();
+            server->sendHeader("Connection", "close");
+            server->sendHeader("Content-Range", contentRange);
+            server->send(416, "text/plain", "Range not satisfiable");
+            return;
+        }
+        partial = range == HttpRange::Result::Partial;
+        if (partial && !file.seek(rangeStart)) {
+            file.close();
+            server->sendHeader("Connection", "close");
+            server->send(500, "text/plain", "Seek failed");
+            return;
+        }
+    }
+    const size_t bodySize = partial ? (size_t)(rangeEnd - rangeStart + 1) : totalSize;
+    
     // FIX: Build Content-Disposition header in stack buffer to avoid String concat
     char dispositionBuf[160];
     snprintf(dispositionBuf, sizeof(dispositionBuf), "attachment; filename=\"%s\"", filename);
     
     server->sendHeader("Connection", "close");
     server->sendHeader("Content-Disposition", dispositionBuf);
-    server->setContentLength(totalSize);
-    server->send(200, contentType, "");
+    server->sendHeader("Accept-Ranges", "bytes");
+    server->sendHeader("ETag", etag);
+    if (lastModified[0]) {
+        server->sendHeader("Last-Modified", lastModified);
+    }
+    if (partial) {
+        char contentRange[48];
+        snprintf(contentRange, sizeof(contentRange), "bytes %u-%u/%u",
+                 (unsigned)rangeStart, (unsigned)rangeEnd, (unsigned)totalSize);
+        server->sendHeader("Content-Range", contentRange);
+    }
+    server->setContentLength(bodySize);
+    server->send(partial ? 206 : 200, contentType, "");
 
     WiFiClient client = server->client();
     client.setNoDelay(true);
 
-    static uint8_t buffer[1024];
     size_t sentTotal = 0;
     uint32_t lastProgress = millis();
-    bool stalled = false;
 
-    while (sentTotal < totalSize && client.connected()) {
+    while (sentTotal < bodySize && client.connected()) {
         yield(); // Feed watchdog during long operations
 
         // Check for timeout
         if (millis() - lastProgress > 30000) {  // 30 second timeout
-            stalled = true;
             break;
         }
 
-        size_t toRead = totalSize - sentTotal;
-        if (toRead > sizeof(buffer)) {
-            toRead = sizeof(buffer);
+        size_t toRead = bodySize - sentTotal;
+        if (toRead > sizeof(transferBuffer)) {
+            toRead = sizeof(transferBuffer);
         }
 
-        size_t readBytes = file.read(buffer, toRead);
+        size_t readBytes = file.read(transferBuffer, toRead);
         if (readBytes == 0) {
             break;
         }
 
-        size_t offset = 0;
-        while (offset < readBytes && client.connected()) {
-            size_t chunk = readBytes - offset;
-            int avail = client.availableForWrite();
-            if (avail > 0 && chunk > static_cast<size_t>(avail)) {
-                chunk = static_cast<size_t>(avail);
-            }
-
-            size_t written = client.write(buffer + offset, chunk);
-            if (written == 0) {
-                if (millis() - lastProgress > 8000) {
-                    stalled = true;
-                    break;
-                }
-                delay(1);
-                yield();
-                continue;
-            }
-
-            offset += written;
-            sentTotal += written;
-            lastProgress = millis();
-        }
-
-        if (stalled) {
-            break;
+        size_t written = writeStallAware(client, transferBuffer, readBytes, lastProgress);
+        sentTotal += written;
+        if (written < readBytes) {
+            break;  // Client gone or stalled
         }
     }
 
@@ -4101,6 +4247,7 @@ void FileServer::handleUploadProcess() {
         if (uploadFile) {
             uploadFile.close();
             sessionUploadCount++;
+            CaptureCatalog::notePathChanged(uploadPathBuf);
         }
         resetUploadState(false);
     } else if (upload.status == UPLOAD_FILE_ABORTED) {
@@ -4213,6 +4360,412 @@ bool FileServer::deletePathRecursive(const String& path) {
     return deletePathRecursiveInternal(path.c_str(), path.length(), 0);
 }
 
+// ============================================================================
+// ZIP folder download
+// Streams local header + data + data descriptor per file, then the central
+// directory. CRC32 is computed on the fly through the shared 1KB transfer
+// buffer, so nothing is staged on SD; memory is 28 bytes per file plus its
+// archive name. The folder is walked twice (count, record). Data and the
+// central directory then come from the recorded entries, each file read up
+// to its recorded size, so a file that grows (live wardrive CSV, open PCAP)
+// or a folder that changes mid-download can't overrun the declared length
+// or pair one file's name with another's CRC and offset.
+// ============================================================================
+
+// SD is mounted with 5 handles: one per open directory level + the file
+static const uint8_t ZIP_MAX_DEPTH = 2;
+static const uint16_t ZIP_MAX_FILES = 1024;
+static const size_t ZIP_PATH_MAX = 256;
+
+struct ZipEntryInfo {
+    uint32_t offset;    // Local header offset in the archive
+    uint32_t crc;
+    uint32_t compSize;
+    uint32_t size;      // Recorded size (read cap), then bytes archived
+    uint32_t dosTime;
+    uint32_t nameOff;   // Archive name in ZipWalkCtx::names, NUL-terminated
+    uint16_t nameLen;
+};
+
+struct ZipWalkCtx {
+    WebServer* srv;
+    WiFiClient* client;
+    ZipStream::Deflater* deflater;  // nullptr = store only
+    ZipEntryInfo* entries;
+    char* names;                    // Archive name pool for entries
+    uint32_t namesLen;              // Pass 0: pool size needed; pass 1: used
+    uint32_t namesCap;
+    uint16_t count;                 // Entries visited in the current pass
+    uint16_t maxCount;
+    size_t relOffset;               // Start of the archive name within an SD path
+    uint32_t offset;                // Archive bytes emitted so far
+    uint64_t storedSize;            // Exact archive size in store mode (pass 1 is final)
+    uint32_t lastProgress;
+    bool chunked;
+    bool failed;
+};
+
+typedef bool (*ZipVisitFn)(ZipWalkCtx& ctx, const char* path, size_t pathLen, File& file);
+
+// Header/descriptor scratch: central header is the largest record
+static uint8_t zipRecord[ZipStream::kCentralHeaderLen + ZipStream::kMaxNameLen];
+
+// Walk files under path depth-first, extending path in place.
+// Returns false as soon as a visitor does.
+static bool zipWalkInternal(char* path, size_t pathLen, uint8_t depth, ZipVisitFn visit, ZipWalkCtx& ctx) {
+    File dir = SD.open(path);
+    if (!dir) {
+        return true;  // Vanished between passes - nothing to add
+    }
+    if (!dir.isDirectory()) {
+        dir.close();
+        return true;
+    }
+
+    // "/" + name must not become "//name"
+    size_t joinLen = (pathLen == 1 && path[0] == '/') ? 0 : pathLen;
+    bool ok = true;
+    File entry = dir.openNextFile();
+    while (entry && ok) {
+        const char* entryName = basenameFromPath(entry.name());
+        size_t entryNameLen = strlen(entryName);
+
+        if (joinLen + 1 + entryNameLen >= ZIP_PATH_MAX) {
+            FS_LOGF("[FILESERVER] ZIP skip, path too long: %s/%s\n", path, entryName);
+        } else {
+            path[joinLen] = '/';
+            memcpy(path + joinLen + 1, entryName, entryNameLen + 1);
+            size_t childLen = joinLen + 1 + entryNameLen;
+
+            if (entry.isDirectory()) {
+                entry.close();
+                if (depth < ZIP_MAX_DEPTH) {
+                    ok = zipWalkInternal(path, childLen, depth + 1, visit, ctx);
+                } else {
+                    FS_LOGF("[FILESERVER] ZIP skip, too deep: %s\n", path);
+                }
+            } else {
+                ok = visit(ctx, path, childLen, entry);
+            }
+            path[pathLen] = '\0';
+        }
+
+        entry.close();
+        recursiveYieldCheck();
+        entry = dir.openNextFile();
+    }
+    entry.close();
+    dir.close();
+    return ok;
+}
+
+static bool zipWalk(const String& root, ZipVisitFn visit, ZipWalkCtx& ctx) {
+    char path[ZIP_PATH_MAX];
+    if (root.length() >= sizeof(path)) return false;
+    memcpy(path, root.c_str(), root.length() + 1);
+    ctx.count = 0;
+    recursiveOpLastYield = millis();
+    recursiveOpCounter = 0;
+    return zipWalkInternal(path, root.length(), 0, visit, ctx);
+}
+
+static bool zipSend(ZipWalkCtx& ctx, const uint8_t* data, size_t len) {
+    if (ctx.failed) return false;
+    if (millis() - ctx.lastProgress > 30000) {  // Same overall timeout as /download
+        ctx.failed = true;
+        return false;
+    }
+    if (ctx.chunked) {
+        ctx.srv->sendContent(reinterpret_cast<const char*>(data), len);
+        if (ctx.client->connected()) {
+            ctx.lastProgress = millis();
+        } else {
+            ctx.failed = true;
+        }
+    } else if (writeStallAware(*ctx.client, data, len, ctx.lastProgress) < len) {
+        ctx.failed = true;
+    }
+    if (!ctx.failed) ctx.offset += len;
+    return !ctx.failed;
+}
+
+static bool zipDeflateSink(void* c, const uint8_t* data, size_t len) {
+    return zipSend(*static_cast<ZipWalkCtx*>(c), data, len);
+}
+
+// Text compresses well; captures are mostly encrypted payload and would grow
+static bool zipShouldDeflate(const char* name) {
+    static const char* const exts[] = {".csv", ".txt", ".json", ".log", ".kml", ".22000", ".hc22000", ".potfile"};
+    const char* dot = strrchr(name, '.');
+    if (!dot) return false;
+    for (size_t i = 0; i < sizeof(exts) / sizeof(exts[0]); i++) {
+        if (strcasecmp(dot, exts[i]) == 0) return true;
+    }
+    return false;
+}
+
+static uint32_t zipDosTime(File& file) {
+    time_t t = file.getLastWrite();
+    struct tm tmv;
+    if (t <= 0 || !localtime_r(&t, &tmv)) return ZipStream::dosDateTime(1980, 1, 1, 0, 0, 0);
+    return ZipStream::dosDateTime(tmv.tm_year + 1900, tmv.tm_mon + 1, tmv.tm_mday,
+                                  tmv.tm_hour, tmv.tm_min, tmv.tm_sec);
+}
+
+// Pass 0: count files, name pool and the stored archive size
+static bool zipVisitCount(ZipWalkCtx& ctx, const char* path, size_t pathLen, File& file) {
+    (void)path;
+    if (ctx.count >= ctx.maxCount) return false;
+    uint16_t nameLen = (uint16_t)(pathLen - ctx.relOffset);
+    ctx.storedSize += ZipStream::storedEntrySize(nameLen, 0) + (uint64_t)file.size() +
+                      ZipStream::centralHeaderSize(nameLen);
+    ctx.namesLen += nameLen + 1;
+    ctx.count++;
+    return ctx.storedSize < 0xFFFFFFFFULL;  // No ZIP64
+}
+
+// Pass 1: record name, size and time; the archive is built from these
+static bool zipVisitRecord(ZipWalkCtx& ctx, const char* path, size_t pathLen, File& file) {
+    uint16_t nameLen = (uint16_t)(pathLen - ctx.relOffset);
+    if (ctx.count >= ctx.maxCount || ctx.namesLen + nameLen + 1 > ctx.namesCap) {
+        return true;  // Appeared after the count pass
+    }
+    ZipEntryInfo& e = ctx.entries[ctx.count];
+    memset(&e, 0, sizeof(e));
+    e.size = (uint32_t)file.size();
+    e.dosTime = zipDosTime(file);
+    e.nameOff = ctx.namesLen;
+    e.nameLen = nameLen;
+    memcpy(ctx.names + ctx.namesLen, path + ctx.relOffset, nameLen + 1);
+    ctx.namesLen += nameLen + 1;
+    ctx.storedSize += ZipStream::storedEntrySize(nameLen, 0) + (uint64_t)e.size +
+                      ZipStream::centralHeaderSize(nameLen);
+    ctx.count++;
+    return ctx.storedSize < 0xFFFFFFFFULL;
+}
+
+// Local header, data (CRC on the fly, capped at the recorded size), data
+// descriptor. path is the entry's SD path. In store mode the declared
+// Content-Length counts the recorded size, so a file that shrank or
+// vanished is padded with zeros to keep the archive consistent.
+static bool zipStreamEntry(ZipWalkCtx& ctx, const char* path, ZipEntryInfo& e) {
+    const char* name = ctx.names + e.nameOff;
+    bool deflate = ctx.deflater && zipShouldDeflate(name);
+    uint16_t method = deflate ? ZipStream::kMethodDeflate : ZipStream::kMethodStore;
+    uint32_t limit = e.size;
+    e.offset = ctx.offset;
+    e.crc = 0;
+    e.size = 0;
+
+    size_t n = ZipStream::writeLocalHeader(zipRecord, name, e.nameLen, method, e.dosTime);
+    if (!zipSend(ctx, zipRecord, n)) return false;
+
+    File file = SD.open(path, FILE_READ);
+    if (deflate) ctx.deflater->begin(zipDeflateSink, &ctx);
+    uint32_t dataStart = ctx.offset;
+    while (file && e.size < limit) {
+        size_t want = limit - e.size;
+        if (want > sizeof(transferBuffer)) want = sizeof(transferBuffer);
+        size_t readBytes = file.read(transferBuffer, want);
+        if (readBytes == 0) break;
+        e.crc = ZipStream::crc32Update(e.crc, transferBuffer, readBytes);
+        e.size += (uint32_t)readBytes;
+        bool ok = deflate ? ctx.deflater->write(transferBuffer, readBytes)
+                          : zipSend(ctx, transferBuffer, readBytes);
+        if (!ok) {
+            file.close();
+            return false;
+        }
+        yield();
+    }
+    if (file) file.close();
+    if (!ctx.chunked && e.size < limit) {
+        FS_LOGF("[FILESERVER] ZIP %s shrank (%u/%u), zero padded\n",
+                name, (unsigned)e.size, (unsigned)limit);
+        memset(transferBuffer, 0, sizeof(transferBuffer));
+        while (e.size < limit) {
+            size_t pad = limit - e.size;
+            if (pad > sizeof(transferBuffer)) pad = sizeof(transferBuffer);
+            e.crc = ZipStream::crc32Update(e.crc, transferBuffer, pad);
+            e.size += (uint32_t)pad;
+            if (!zipSend(ctx, transferBuffer, pad)) return false;
+        }
+    }
+    if (deflate && !ctx.deflater->finish()) return false;
+    e.compSize = ctx.offset - dataStart;
+
+    n = ZipStream::writeDataDescriptor(zipRecord, e.crc, e.compSize, e.size);
+    return zipSend(ctx, zipRecord, n);
+}
+
+static bool zipSendCentral(ZipWalkCtx& ctx, const ZipEntryInfo& e) {
+    const char* name = ctx.names + e.nameOff;
+    uint16_t method = (ctx.deflater && zipShouldDeflate(name))
+                      ? ZipStream::kMethodDeflate : ZipStream::kMethodStore;
+    size_t n = ZipStream::writeCentralHeader(zipRecord, name, e.nameLen, method, e.dosTime,
+                                             e.crc, e.compSize, e.size, e.offset);
+    return zipSend(ctx, zipRecord, n);
+}
+
+void FileServer::handleZipDownload(const String& dirArg) {
+    String dir = dirArg;
+    while (dir.length() > 1 && dir.endsWith("/")) {
+        dir.remove(dir.length() - 1);
+    }
+
+    if (uploadActive.load()) {
+        server->sendHeader("Connection", "close");
+        server->send(409, "text/plain", "Upload in progress");
+        return;
+    }
+
+    // Security: prevent directory traversal
+    if (dir.indexOf("..") >= 0 || dir.length() >= ZIP_PATH_MAX) {
+        server->sendHeader("Connection", "close");
+        server->send(400, "text/plain", "Invalid path");
+        return;
+    }
+
+    File root = SD.open(dir);
+    bool isDir = root && root.isDirectory();
+    if (root) root.close();
+    if (!isDir) {
+        server->sendHeader("Connection", "close");
+        server->send(404, "text/plain", "Folder not found");
+        return;
+    }
+
+    ZipWalkCtx ctx;
+    memset(&ctx, 0, sizeof(ctx));
+    ctx.srv = server;
+    ctx.relOffset = (dir == "/") ? 1 : dir.length() + 1;
+    ctx.maxCount = ZIP_MAX_FILES;
+    ctx.storedSize = ZipStream::kEndRecordLen;
+
+    if (!zipWalk(dir, zipVisitCount, ctx)) {
+        server->sendHeader("Connection", "close");
+        server->send(413, "text/plain", "Folder too large for ZIP - download subfolders");
+        return;
+    }
+    if (ctx.count == 0) {
+        server->sendHeader("Connection", "close");
+        server->send(404, "text/plain", "Folder is empty");
+        return;
+    }
+    uint16_t fileCount = ctx.count;
+    uint32_t namesCap = ctx.namesLen;
+
+    // Entry table + names + optional deflate state; refuse instead of
+    // squeezing the heap
+    size_t need = fileCount * sizeof(ZipEntryInfo) + namesCap;
+    bool wantDeflate = server->arg("deflate") == "1";
+    size_t freeHeap = 0;
+    size_t largest = 0;
+    if (isUiHeapLow(&freeHeap, &largest) || largest < need + UI_MIN_LARGEST) {
+        FS_LOGF("[FILESERVER] ZIP low heap: need=%u free=%u largest=%u\n",
+                (unsigned)need, (unsigned)freeHeap, (unsigned)largest);
+        server->sendHeader("Connection", "close");
+        server->send(503, "text/plain", "Low heap - try again");
+        return;
+    }
+    ctx.entries = new (std::nothrow) ZipEntryInfo[fileCount];
+    ctx.names = new (std::nothrow) char[namesCap];
+    if (wantDeflate && largest >= need + sizeof(ZipStream::Deflater) + UI_MIN_LARGEST) {
+        ctx.deflater = new (std::nothrow) ZipStream::Deflater();
+    }
+    if (!ctx.entries || !ctx.names) {
+        delete ctx.deflater;
+        delete[] ctx.names;
+        delete[] ctx.entries;
+        server->sendHeader("Connection", "close");
+        server->send(503, "text/plain", "Low heap - try again");
+        return;
+    }
+    ctx.maxCount = fileCount;
+    ctx.namesCap = namesCap;
+    ctx.namesLen = 0;
+    ctx.storedSize = ZipStream::kEndRecordLen;
+
+    // Fix the entry list; everything sent below comes from it
+    bool recorded = zipWalk(dir, zipVisitRecord, ctx);
+    fileCount = ctx.count;
+    if (!recorded || fileCount == 0) {
+        delete ctx.deflater;
+        delete[] ctx.names;
+        delete[] ctx.entries;
+        server->sendHeader("Connection", "close");
+        if (recorded) {
+            server->send(404, "text/plain", "Folder is empty");
+        } else {
+            server->send(413, "text/plain", "Folder too large for ZIP - download subfolders");
+        }
+        return;
+    }
+
+    // Archive name: folder basename, "sd" for the root
+    const char* baseName = (dir == "/") ? "sd" : basenameFromPath(dir.c_str());
+    char dispositionBuf[160];
+    snprintf(dispositionBuf, sizeof(dispositionBuf), "attachment; filename=\"%s.zip\"", baseName);
+
+    // Deflated size is unknown up front: chunked transfer. Stored is exact.
+    ctx.chunked = ctx.deflater != nullptr;
+    server->sendHeader("Connection", "close");
+    server->sendHeader("Content-Disposition", dispositionBuf);
+    server->setContentLength(ctx.chunked ? CONTENT_LENGTH_UNKNOWN : (size_t)ctx.storedSize);
+    server->send(200, "application/zip", "");
+
+    WiFiClient client = server->client();
+    client.setNoDelay(true);
+    ctx.client = &client;
+    ctx.lastProgress = millis();
+
+    FS_LOGF("[FILESERVER] ZIP %s: %u files, %s\n", dir.c_str(), (unsigned)fileCount,
+            ctx.chunked ? "deflate" : "store");
+
+    // SD path of an entry: folder prefix (up to relOffset) + archive name
+    char path[ZIP_PATH_MAX];
+    memcpy(path, dir.c_str(), ctx.relOffset - 1);
+    path[ctx.relOffset - 1] = '/';
+
+    bool ok = true;
+    for (uint16_t i = 0; ok && i < fileCount; i++) {
+        ZipEntryInfo& e = ctx.entries[i];
+        memcpy(path + ctx.relOffset, ctx.names + e.nameOff, e.nameLen + 1);
+        ok = zipStreamEntry(ctx, path, e);
+    }
+    uint32_t cdOffset = ctx.offset;
+    for (uint16_t i = 0; ok && i < fileCount; i++) {
+        ok = zipSendCentral(ctx, ctx.entries[i]);
+    }
+    if (ok) {
+        size_t n = ZipStream::writeEndRecord(zipRecord, fileCount, ctx.offset - cdOffset, cdOffset);
+        ok = zipSend(ctx, zipRecord, n);
+    }
+    if (ok && ctx.chunked) {
+        server->sendContent("");  // Finalize chunked transfer
+    }
+    if (ok && !ctx.chunked && ctx.offset != ctx.storedSize) {
+        FS_LOGF("[FILESERVER] ZIP size changed: sent=%u expected=%u\n",
+                (unsigned)ctx.offset, (unsigned)ctx.storedSize);
+    }
+
+    client.flush();
+    client.stop();
+    delete ctx.deflater;
+    delete[] ctx.names;
+    delete[] ctx.entries;
+
+    if (ctx.offset > 0) {
+        sessionTxBytes += ctx.offset;
+        sessionDownloadCount++;
+    }
+    if (!ok) {
+        FS_LOGF("[FILESERVER] ZIP aborted after %u bytes\n", (unsigned)ctx.offset);
+    }
+
+    logHeapStatusIfLow("after /download zip");
+}
+
 void FileServer::handleDelete() {
     String path = mapUiPathToFs(server->arg("f"));
     logRequest(server, "REQ");
@@ -4234,6 +4787,8 @@ void FileServer::handleDelete() {
     }
     
     bool success = deletePathRecursive(path);
+    // Re-stat even on failure: a folder may be half gone
+    CaptureCatalog::notePathChanged(path.c_str());
     
     if (success) {
         server->sendHeader("Connection", "close");
@@ -4311,6 +4866,7 @@ void FileServer::handleBulkDelete() {
             } else {
             failed++;
         }
+        CaptureCatalog::notePathChanged(path.c_str());
         
         yield();  // Feed watchdog during bulk operations
     }
@@ -4374,6 +4930,8 @@ void FileServer::handleRename() {
     }
     
     if (SD.rename(oldPath, newPath)) {
+        CaptureCatalog::notePathChanged(oldPath.c_str());
+        CaptureCatalog::notePathChanged(newPath.c_str());
         server->sendHeader("Connection", "close");
         server->send(200, "application/json", "{\"success\":true}");
     } else {
@@ -4620,6 +5178,7 @@ void FileServer::handleCopy() {
         } else {
             failed++;
         }
+        CaptureCatalog::notePathChanged(dstPath.c_str());
         
         recursiveYieldCheck();  // FIX: Yield between files in batch
     }
@@ -4733,6 +5292,8 @@ void FileServer::handleMove() {
         } else {
             failed++;
         }
+        CaptureCatalog::notePathChanged(srcPath.c_str());
+        CaptureCatalog::notePathChanged(dstPath.c_str());
         
         recursiveYieldCheck();  // FIX: Yield between files in batch
     }
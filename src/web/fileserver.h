@@ -59,12 +59,14 @@ private:
     static void handleSwine();
     static void handleFileList();
     static void handleDownload();
+    static void handleZipDownload(const String& dir);
     static void handleUpload();
     static void handleUploadProcess();
     static void handleDelete();
     static void handleBulkDelete();
     static void handleMkdir();
     static void handleSDInfo();
+    static void handleHeap();
     static void handleRename();
     static void handleCopy();
     static void handleMove();
@@ -0,0 +1,125 @@
+// HttpRange - single-range "Range: bytes=" parsing and HTTP-date formatting
+// Used by FileServer /download for 206 Partial Content, ETag and If-Range.
+// Header-only, no Arduino dependencies (unit tested on native).
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+namespace HttpRange {
+
+enum class Result : uint8_t {
+    None = 0,        // No usable range: send the whole file (200)
+    Partial,         // Serve [start, end] inclusive (206)
+    Unsatisfiable    // Range starts past the end (416)
+};
+
+static const size_t kHttpDateLen = 29;  // "Sun, 06 Nov 1994 08:49:37 GMT"
+static const size_t kETagLen = 19;      // "\"0001f400-5f5e1000\""
+
+inline bool parseDigits(const char*& p, uint32_t& out) {
+    if (*p < '0' || *p > '9') return false;
+    uint64_t v = 0;
+    while (*p >= '0' && *p <= '9') {
+        v = v * 10 + (uint64_t)(*p - '0');
+        if (v > 0xFFFFFFFFULL) return false;
+        p++;
+    }
+    out = (uint32_t)v;
+    return true;
+}
+
+/**
+ * Parse a Range header against a resource of `size` bytes.
+ * Accepts "bytes=a-b", "bytes=a-" and "bytes=-n" (suffix). Multiple ranges
+ * and anything malformed return None - RFC 9110 lets a server ignore Range.
+ */
+inline Result parse(const char* header, uint32_t size, uint32_t& start, uint32_t& end) {
+    if (!header) return Result::None;
+    const char* p = header;
+    while (*p == ' ') p++;
+    const char* unit = "bytes=";
+    for (const char* u = unit; *u; u++, p++) {
+        if (*p != *u) return Result::None;
+    }
+    while (*p == ' ') p++;
+
+    uint32_t first = 0;
+    uint32_t last = 0;
+    bool hasFirst = parseDigits(p, first);
+    if (*p != '-') return Result::None;
+    p++;
+    bool hasLast = parseDigits(p, last);
+    while (*p == ' ') p++;
+    if (*p != '\0') return Result::None;   // Multi-range or trailing junk
+
+    if (!hasFirst) {
+        // Suffix range: last n bytes
+        if (!hasLast) return Result::None;
+        if (last == 0 || size == 0) return Result::Unsatisfiable;
+        start = last >= size ? 0 : size - last;
+        end = size - 1;
+        return Result::Partial;
+    }
+    if (hasLast && last < first) return Result::None;
+    if (first >= size) return Result::Unsatisfiable;
+    start = first;
+    end = (!hasLast || last >= size) ? size - 1 : last;
+    return Result::Partial;
+}
+
+/**
+ * IMF-fixdate for a Unix timestamp (UTC), e.g. for Last-Modified.
+ * out must hold kHttpDateLen + 1 bytes.
+ */
+inline void formatHttpDate(uint32_t epoch, char* out) {
+    static const char* const kDays[7] = {"Thu", "Fri", "Sat", "Sun", "Mon", "Tue", "Wed"};
+    static const char* const kMonths[12] = {"Jan", "Feb", "Mar", "Apr", "May", "Jun",
+                                            "Jul", "Aug", "Sep", "Oct", "Nov", "Dec"};
+    uint32_t days = epoch / 86400;
+    uint32_t secs = epoch % 86400;
+
+    // Civil-from-days (Howard Hinnant), unsigned since epoch >= 1970
+    uint32_t z = days + 719468;
+    uint32_t era = z / 146097;
+    uint32_t doe = z - era * 146097;
+    uint32_t yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+    uint32_t doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+    uint32_t mp = (5 * doy + 2) / 153;
+    uint32_t day = doy - (153 * mp + 2) / 5 + 1;
+    uint32_t month = mp < 10 ? mp + 3 : mp - 9;
+    uint32_t year = yoe + era * 400 + (month <= 2 ? 1 : 0);
+
+    snprintf(out, kHttpDateLen + 1, "%s, %02u %s %04u %02u:%02u:%02u GMT",
+             kDays[days % 7], (unsigned)day, kMonths[month - 1], (unsigned)year,
+             (unsigned)(secs / 3600), (unsigned)(secs / 60 % 60), (unsigned)(secs % 60));
+}
+
+/**
+ * Strong entity-tag from size and mtime. Appends change the size even when
+ * the RTC is unset. out must hold kETagLen + 1 bytes.
+ */
+inline void formatETag(uint32_t size, uint32_t mtime, char* out) {
+    snprintf(out, kETagLen + 1, "\"%08x-%08x\"", (unsigned)size, (unsigned)mtime);
+}
+
+/**
+ * If-Range check for a resumed transfer. Only an exact strong entity-tag
+ * match keeps the range: a date is a weak validator at 1 s resolution and
+ * RFC 9110 forbids using it, so date-only or weak (W/) values send the
+ * whole file instead.
+ */
+inline bool ifRangeMatches(const char* ifRange, const char* etag) {
+    if (!ifRange || !etag || etag[0] != '"') return false;
+    while (*ifRange == ' ') ifRange++;
+    if (*ifRange != '"') return false;
+    size_t n = strlen(etag);
+    if (strncmp(ifRange, etag, n) != 0) return false;
+    const char* p = ifRange + n;
+    while (*p == ' ') p++;
+    return *p == '\0';
+}
+
+}  // namespace HttpRange
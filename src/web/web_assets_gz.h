@@ -0,0 +1,1182 @@
+// Auto-generated by scripts/web_assets.py - do not edit
+// Gzipped web UI assets from fileserver.cpp; ETag is a hash of the plain text
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <pgmspace.h>
+
+// HTML_TEMPLATE: 12790 -> 2200 bytes
+#define HTML_TEMPLATE_ETAG "\"0e1f86c8ee219c79\""
+static const size_t HTML_TEMPLATE_GZ_LEN = 2200;
+static const uint8_t HTML_TEMPLATE_GZ[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xed, 0x5b, 0x4b, 0x73, 0xa3, 0xc6,
+    0x16, 0xde, 0xeb, 0x57, 0x74, 0xa8, 0xba, 0x65, 0xbb, 0xee, 0xe8, 0xe1, 0xc7, 0x4c, 0x1c, 0x8f,
+    0xa4, 0x14, 0x86, 0xc6, 0x56, 0x19, 0x03, 0x01, 0x34, 0x1a, 0x6f, 0x52, 0x85, 0xa1, 0x65, 0x11,
+    0x63, 0xe0, 0x42, 0xcb, 0x8a, 0x53, 0xb3, 0xc8, 0x6a, 0xf6, 0xf7, 0xb1, 0xcc, 0x32, 0xbf, 0x6c,
+    0x7e, 0xc9, 0x3d, 0x0d, 0x48, 0x20, 0x19, 0x64, 0xe4, 0xc9, 0xb8, 0x26, 0x35, 0x52, 0xf9, 0x41,
+    0x77, 0x9f, 0x3e, 0x7d, 0x1e, 0x7d, 0xce, 0xf9, 0xba, 0x25, 0x35, 0xba, 0xdf, 0x89, 0xaa, 0x60,
+    0x5e, 0x69, 0x18, 0x4d, 0xe8, 0x9d, 0xd7, 0x6f, 0x74, 0xe7, 0xff, 0x88, 0xe5, 0xf4, 0x1b, 0x08,
+    0x5e, 0xdd, 0x3b, 0x42, 0x2d, 0x64, 0x4f, 0xac, 0x28, 0x26, 0xb4, 0xc7, 0x0d, 0x4d, 0xa9, 0x79,
+    0xcc, 0x15, 0x87, 0x7c, 0xeb, 0x8e, 0xf4, 0xb8, 0x7b, 0x97, 0xcc, 0xc2, 0x20, 0xa2, 0x1c, 0xb2,
+    0x03, 0x9f, 0x12, 0x1f, 0x48, 0x67, 0xae, 0x43, 0x27, 0x3d, 0x87, 0xdc, 0xbb, 0x36, 0x69, 0x26,
+    0x8d, 0x57, 0xc8, 0xf5, 0x5d, 0xea, 0x5a, 0x5e, 0x33, 0xb6, 0x2d, 0x8f, 0xf4, 0xf6, 0x5b, 0x9d,
+    0x39, 0x2b, 0xea, 0x52, 0x8f, 0xf4, 0x35, 0xe1, 0xcd, 0x51, 0x0b, 0xbf, 0xc7, 0xdd, 0x76, 0xda,
+    0x4e, 0xc7, 0x3c, 0xd7, 0xbf, 0x45, 0x11, 0xf1, 0x7a, 0x5c, 0x4c, 0x1f, 0x3c, 0x12, 0x4f, 0x08,
+    0x81, 0x75, 0x26, 0x11, 0x19, 0xf7, 0xb8, 0xf6, 0xd4, 0x6d, 0xd9, 0x71, 0x0c, 0x6c, 0xba, 0xed,
+    0x54, 0xe8, 0xee, 0x75, 0xe0, 0x3c, 0x20, 0xdb, 0xb3, 0xe2, 0xb8, 0xc7, 0xdd, 0xd9, 0xf3, 0x05,
+    0x1c, 0xf7, 0x7e, 0xde, 0xc9, 0xe8, 0x48, 0x94, 0x0d, 0x24, 0x83, 0x93, 0xfd, 0xc2, 0xd2, 0xd0,
+    0xc8, 0x47, 0x0a, 0xd3, 0x62, 0xa7, 0xe9, 0xfa, 0xe3, 0x80, 0x43, 0xae, 0xc3, 0x1a, 0x03, 0xf6,
+    0xdc, 0x6f, 0xb5, 0x5a, 0xdd, 0x36, 0x10, 0x65, 0xab, 0x14, 0x1e, 0x8b, 0x33, 0x67, 0xae, 0x4f,
+    0x9a, 0x31, 0x8d, 0xdc, 0x90, 0xab, 0xe0, 0x9d, 0x50, 0x80, 0xa2, 0x24, 0x63, 0xcf, 0xda, 0x32,
+    0xfc, 0xee, 0x73, 0x7d, 0xf9, 0x5d, 0x07, 0x29, 0x1d, 0x24, 0x1e, 0x99, 0x3c, 0xfa, 0x80, 0xcc,
+    0xfd, 0x43, 0x1d, 0x9a, 0x0a, 0x86, 0xe7, 0xf7, 0x1a, 0xea, 0xa0, 0xdd, 0xce, 0x3f, 0xf6, 0xe0,
+    0xf9, 0xf4, 0x48, 0x3c, 0x3b, 0x34, 0x50, 0xa7, 0xdd, 0x29, 0x08, 0x51, 0x7b, 0x99, 0x03, 0xae,
+    0x3f, 0xda, 0x3f, 0x93, 0x0f, 0x91, 0xd2, 0x66, 0x8b, 0x9c, 0x0e, 0x25, 0xe9, 0x84, 0xad, 0x72,
+    0x58, 0xae, 0xdc, 0x23, 0x0d, 0xef, 0x2c, 0xd7, 0xaf, 0x50, 0x2d, 0xb4, 0x7c, 0x12, 0x17, 0xc6,
+    0xca, 0xc6, 0x91, 0x65, 0x53, 0xf7, 0x3e, 0x13, 0x8a, 0x75, 0xc8, 0x1c, 0x0a, 0x7c, 0xdb, 0x73,
+    0xed, 0x5b, 0x10, 0x92, 0x50, 0x3e, 0x19, 0xd6, 0x60, 0x60, 0x77, 0x47, 0xde, 0xd9, 0x5b, 0xe1,
+    0x56, 0xc6, 0xb1, 0xf9, 0xc8, 0xc9, 0x4b, 0xd4, 0x31, 0xd0, 0x2c, 0x91, 0x3b, 0xc4, 0x0e, 0xa2,
+    0xa6, 0x47, 0xc6, 0x94, 0xeb, 0x7f, 0xfa, 0xdf, 0xef, 0xdf, 0xd8, 0xcf, 0x9f, 0xdd, 0x36, 0xb3,
+    0x48, 0x5d, 0x63, 0x85, 0x16, 0x9d, 0xcc, 0x7d, 0x45, 0x27, 0x32, 0xd7, 0x6f, 0x6f, 0x36, 0x3f,
+    0x35, 0x76, 0xe4, 0xde, 0x4c, 0x12, 0x6b, 0xff, 0xf1, 0xad, 0x19, 0xbc, 0xca, 0x5a, 0x2b, 0x91,
+    0x5b, 0xb6, 0xb7, 0xed, 0xc0, 0x7b, 0x62, 0x6b, 0xaf, 0x10, 0xc7, 0x2c, 0x29, 0xf7, 0x2b, 0x38,
+    0x97, 0x4d, 0x60, 0xf9, 0x9c, 0xeb, 0x2b, 0xf0, 0x77, 0x83, 0x49, 0xb1, 0xfb, 0x1b, 0x4c, 0x32,
+    0xe0, 0xef, 0x06, 0x93, 0xa8, 0xcb, 0x56, 0xba, 0x0c, 0x1c, 0x77, 0x5c, 0xa5, 0xf9, 0xd3, 0x06,
+    0x19, 0xbb, 0x1e, 0xcb, 0x68, 0x31, 0x4d, 0x37, 0x24, 0x7b, 0x92, 0x2b, 0xf5, 0x7d, 0x94, 0x25,
+    0xc6, 0x41, 0x40, 0x37, 0xc8, 0x12, 0x29, 0xf9, 0x36, 0x59, 0x6c, 0x12, 0xec, 0x73, 0x9b, 0xb9,
+    0xf1, 0x6d, 0xea, 0xa2, 0xb4, 0x43, 0x84, 0x76, 0xe2, 0xa8, 0xe7, 0xf0, 0xda, 0xe6, 0x8f, 0xba,
+    0xf9, 0xa3, 0xac, 0x6b, 0x25, 0x08, 0xf2, 0xaa, 0xab, 0x57, 0x57, 0x5d, 0x7d, 0x5b, 0x75, 0xbf,
+    0xae, 0xaa, 0xab, 0x6f, 0xab, 0xee, 0xb6, 0xea, 0x7e, 0x4d, 0x55, 0x57, 0xdf, 0x56, 0xdd, 0xbf,
+    0x47, 0xd5, 0xd5, 0xb7, 0x55, 0xf7, 0x85, 0xab, 0x6e, 0xc5, 0xb5, 0x40, 0x10, 0xc6, 0x15, 0x67,
+    0x66, 0x18, 0x69, 0x32, 0xd3, 0x7b, 0x6b, 0xce, 0xcd, 0x8c, 0xe6, 0xda, 0x0b, 0xec, 0xdb, 0x27,
+    0xea, 0x32, 0xa3, 0xab, 0x5f, 0x96, 0x19, 0xf5, 0x36, 0xd0, 0xea, 0x05, 0x07, 0xb3, 0x55, 0x72,
+    0x4f, 0xd5, 0x9c, 0x45, 0x56, 0x58, 0x61, 0xdd, 0xea, 0x59, 0x5c, 0x7f, 0xa4, 0xf1, 0x4d, 0x03,
+    0x0b, 0xe8, 0xa7, 0x21, 0x1e, 0xe2, 0x75, 0xcb, 0x96, 0x32, 0x61, 0xb7, 0x6f, 0x69, 0x6c, 0xcf,
+    0x42, 0xeb, 0x92, 0x35, 0xfa, 0x17, 0xf8, 0xea, 0x04, 0x0d, 0x95, 0x0b, 0x45, 0x1d, 0x29, 0x1b,
+    0xf3, 0x63, 0x77, 0x30, 0x81, 0x1f, 0xaf, 0xd1, 0x23, 0x99, 0x76, 0x3d, 0xa5, 0x34, 0x58, 0x4c,
+    0xbc, 0xa6, 0x3e, 0x82, 0xdf, 0x66, 0x30, 0xa5, 0xf9, 0xb5, 0x12, 0x74, 0x8c, 0x42, 0x4b, 0x0d,
+    0x89, 0x5f, 0x00, 0x94, 0xb3, 0xb4, 0x47, 0x27, 0xf1, 0xd4, 0xa3, 0xf1, 0x2e, 0xc0, 0x49, 0x4d,
+    0x35, 0x91, 0x34, 0x90, 0x41, 0xf3, 0x94, 0xe7, 0x1a, 0x59, 0xd7, 0xb9, 0x64, 0x13, 0x77, 0x6d,
+    0x73, 0xd8, 0xb3, 0x31, 0xd0, 0xbf, 0xa6, 0x64, 0x9a, 0x02, 0x7c, 0x04, 0xae, 0x5c, 0x83, 0x83,
+    0xfa, 0xa9, 0x4f, 0xd9, 0x53, 0xd2, 0x34, 0x8c, 0x81, 0x58, 0x68, 0x6a, 0xbc, 0x61, 0xe4, 0xcd,
+    0x65, 0xee, 0x31, 0xb5, 0xe8, 0x14, 0x76, 0xa0, 0x61, 0x3e, 0x1f, 0x9a, 0xa4, 0x9c, 0x72, 0x6c,
+    0x02, 0xc2, 0xfe, 0xc4, 0xba, 0xaa, 0xe1, 0x89, 0xeb, 0x87, 0x53, 0x8a, 0xe8, 0x43, 0x48, 0x52,
+    0x60, 0xb3, 0x98, 0xa7, 0xc1, 0xc6, 0xe5, 0x90, 0x65, 0xdb, 0x24, 0xa4, 0x3d, 0xae, 0x45, 0x7f,
+    0xa5, 0xaf, 0x5a, 0x61, 0x40, 0x53, 0x9a, 0xe4, 0x2e, 0xba, 0xc7, 0x41, 0x85, 0x0d, 0x3d, 0xeb,
+    0xe1, 0xc4, 0x0f, 0x60, 0xf7, 0xd7, 0xad, 0x02, 0xdb, 0x7c, 0xff, 0x6d, 0xe6, 0xfb, 0xc1, 0x99,
+    0x8c, 0x3f, 0x3f, 0xdb, 0xbb, 0x37, 0x1e, 0x49, 0xf3, 0xbd, 0xa0, 0x63, 0xd1, 0x78, 0xf9, 0x8c,
+    0x9f, 0x67, 0x79, 0x26, 0x8a, 0xf1, 0xe0, 0xdb, 0xc5, 0x3c, 0x3f, 0xef, 0x63, 0x29, 0xde, 0xb8,
+    0x52, 0x84, 0x6d, 0x7a, 0xff, 0xbb, 0xa5, 0x77, 0xe6, 0xc1, 0x0d, 0x12, 0xbc, 0x82, 0xcd, 0x97,
+    0xcd, 0xe8, 0x4c, 0xbe, 0xea, 0x9c, 0xbe, 0x06, 0x7c, 0xd7, 0x7b, 0x33, 0x2b, 0x8c, 0x82, 0x9b,
+    0x88, 0xc4, 0x90, 0x6e, 0xad, 0x28, 0xbb, 0x70, 0xc9, 0x7a, 0x4e, 0xa1, 0xa3, 0x5f, 0x4a, 0x0a,
+    0x35, 0xc1, 0x5b, 0xa6, 0x95, 0x58, 0x4f, 0x26, 0xdf, 0xba, 0xd5, 0x32, 0x0b, 0xa5, 0xef, 0xc7,
+    0x65, 0xd6, 0xe2, 0x47, 0xfc, 0xc0, 0x1c, 0x28, 0x67, 0x48, 0xd5, 0x45, 0xac, 0x1b, 0xe8, 0x03,
+    0xfa, 0xf4, 0xf1, 0xdf, 0x9f, 0x3e, 0xfe, 0x17, 0x29, 0xfc, 0x3b, 0x68, 0x18, 0x1a, 0x2f, 0x60,
+    0x64, 0x60, 0x19, 0x9e, 0xb1, 0x62, 0x62, 0x1d, 0xe1, 0xf7, 0x00, 0x23, 0x3f, 0x20, 0x93, 0x3f,
+    0x45, 0x92, 0x3c, 0xd0, 0xb2, 0xf5, 0xca, 0x17, 0x1c, 0xdf, 0x92, 0x87, 0x44, 0xb5, 0xf2, 0x5a,
+    0xc4, 0x86, 0x8b, 0xf7, 0x80, 0x93, 0x60, 0x76, 0x4e, 0xbc, 0x90, 0x45, 0x73, 0x12, 0x6f, 0x7d,
+    0x69, 0x3f, 0xdb, 0x66, 0x3f, 0xae, 0xa9, 0x68, 0x25, 0x5c, 0x74, 0xc2, 0x2e, 0x39, 0x2e, 0x03,
+    0xc7, 0xf2, 0x0a, 0xcc, 0x0e, 0x32, 0x66, 0x3a, 0x56, 0xea, 0xb3, 0x8b, 0xc8, 0x18, 0x4c, 0x3c,
+    0x29, 0xb0, 0x39, 0x5c, 0xb0, 0x91, 0x36, 0x93, 0x0a, 0x3b, 0x2e, 0x5d, 0x95, 0xe9, 0x28, 0x63,
+    0x86, 0x45, 0xb3, 0x3e, 0x33, 0x3b, 0x08, 0x1f, 0x0c, 0xe2, 0x11, 0x9b, 0x12, 0xa7, 0xc0, 0xeb,
+    0x75, 0xc6, 0x4b, 0xd0, 0xae, 0xea, 0xf3, 0xba, 0x0b, 0xee, 0x49, 0x09, 0xaf, 0x37, 0x19, 0xaf,
+    0x4b, 0xf5, 0xdd, 0x66, 0x4a, 0x2a, 0x64, 0x26, 0x05, 0x1e, 0x40, 0x82, 0x55, 0x4d, 0xbf, 0x9f,
+    0x73, 0xbc, 0x10, 0xeb, 0x73, 0x74, 0x40, 0x32, 0x5a, 0x26, 0xdf, 0x71, 0xc6, 0x4d, 0xc4, 0x72,
+    0x7d, 0x6e, 0x14, 0xd2, 0xf5, 0x0d, 0x89, 0x86, 0xa1, 0x17, 0x58, 0x0e, 0x43, 0x5c, 0x24, 0x2a,
+    0xb0, 0xfc, 0x21, 0x63, 0xa9, 0x0d, 0xcd, 0xcd, 0x54, 0x96, 0x83, 0x1b, 0x01, 0x6a, 0x5b, 0xe0,
+    0x91, 0x9c, 0xdb, 0x7e, 0x27, 0xe3, 0x26, 0xab, 0x67, 0x8f, 0x73, 0x41, 0x05, 0x0e, 0x9c, 0x2e,
+    0x04, 0xe3, 0xd0, 0x1d, 0x1c, 0x5d, 0xdc, 0xd0, 0x23, 0x6c, 0xa9, 0x89, 0xe5, 0xdf, 0x90, 0xf9,
+    0x30, 0x04, 0x3b, 0x89, 0x77, 0xe9, 0xc4, 0x8d, 0x5b, 0x6c, 0x66, 0xbc, 0xb7, 0x0e, 0x1f, 0xa6,
+    0x8b, 0x7e, 0xd7, 0x6c, 0x22, 0xf0, 0x0b, 0x4a, 0x1d, 0x83, 0x12, 0xcf, 0xa0, 0x66, 0xf3, 0xf1,
+    0x35, 0xc1, 0x1d, 0x1b, 0x49, 0x65, 0xf1, 0x97, 0xfc, 0x58, 0xd0, 0xd8, 0x1d, 0xef, 0x92, 0x7b,
+    0xe2, 0xd3, 0x16, 0xb5, 0xa2, 0x1b, 0x42, 0x7b, 0xbd, 0x1e, 0x93, 0x65, 0x6f, 0xe2, 0x3a, 0x79,
+    0xc0, 0x95, 0x5a, 0x2e, 0x61, 0xde, 0xcc, 0x3e, 0xb3, 0xb1, 0x8a, 0x3e, 0x27, 0x87, 0x90, 0xdb,
+    0x47, 0x48, 0x52, 0x65, 0xc8, 0x42, 0xdd, 0x36, 0x34, 0x1b, 0x95, 0xc0, 0x99, 0x92, 0x5f, 0xe9,
+    0x8a, 0x90, 0xec, 0x36, 0x93, 0x43, 0xa0, 0xbd, 0x4d, 0x26, 0x49, 0x47, 0x8f, 0x4b, 0x59, 0x41,
+    0x1a, 0xbb, 0xc4, 0x1c, 0x2a, 0x2b, 0x30, 0x81, 0x0f, 0xae, 0x74, 0x82, 0x99, 0x5f, 0xd0, 0x09,
+    0x7a, 0x40, 0xa1, 0x1d, 0x0c, 0x32, 0x46, 0x3b, 0x7b, 0x76, 0x44, 0x2c, 0x4a, 0xd2, 0x15, 0x76,
+    0xf7, 0xde, 0x3e, 0xa2, 0x8a, 0x6d, 0x2b, 0x24, 0x3b, 0x15, 0xaa, 0x97, 0xab, 0x5f, 0x8d, 0x83,
+    0xca, 0xb0, 0x4f, 0x1e, 0xf1, 0x4b, 0x92, 0x24, 0x68, 0x8c, 0x37, 0xd7, 0x9c, 0x66, 0x9f, 0x3a,
+    0x3a, 0x2f, 0x18, 0x2f, 0xc9, 0x2e, 0xf0, 0x8a, 0xc0, 0xe2, 0xa9, 0x8c, 0x6b, 0xad, 0x52, 0x97,
+    0x6f, 0x37, 0x96, 0xc7, 0xeb, 0x6d, 0xb4, 0x09, 0x50, 0xbe, 0xd8, 0x1e, 0xbb, 0xc0, 0x57, 0xa7,
+    0x2a, 0xaf, 0x8b, 0xc8, 0x38, 0x57, 0x75, 0x53, 0x18, 0x32, 0x34, 0xf1, 0x68, 0xaf, 0x85, 0x11,
+    0x99, 0x87, 0xd4, 0x18, 0x38, 0x25, 0x77, 0xdf, 0x27, 0x9d, 0xd6, 0xf1, 0x6b, 0x72, 0xf7, 0x96,
+    0x99, 0x0f, 0xa0, 0x0b, 0x83, 0x7d, 0x27, 0xfb, 0xad, 0x37, 0x6f, 0x83, 0xd0, 0xb2, 0x5d, 0xfa,
+    0xc0, 0x86, 0x61, 0x39, 0x5e, 0xd7, 0xd5, 0x11, 0x1a, 0x6a, 0x6d, 0x11, 0x30, 0x32, 0x62, 0x25,
+    0x74, 0x70, 0x06, 0x7e, 0x4a, 0xae, 0x1e, 0x8c, 0x46, 0x5a, 0x3f, 0x17, 0x2f, 0x55, 0xc3, 0x4a,
+    0xb6, 0xe1, 0x51, 0x1b, 0xb1, 0x19, 0xb2, 0xca, 0x8b, 0x8d, 0xb4, 0xe2, 0x2e, 0x5e, 0xa6, 0x7a,
+    0xc6, 0x90, 0x3c, 0x54, 0x60, 0x2c, 0x98, 0x03, 0x55, 0x69, 0xb0, 0xc2, 0x5b, 0x78, 0x19, 0xa3,
+    0x81, 0x29, 0x9c, 0x23, 0x8d, 0x57, 0x70, 0x43, 0x30, 0x75, 0xf9, 0x9f, 0x7c, 0x3e, 0x94, 0xcc,
+    0x41, 0xbc, 0x2c, 0x37, 0xa4, 0x83, 0xa5, 0xed, 0x01, 0x15, 0x10, 0xc2, 0x02, 0x16, 0x17, 0x86,
+    0x06, 0x16, 0xd1, 0xc0, 0xc4, 0x97, 0x0d, 0xe9, 0x68, 0x89, 0x04, 0x8b, 0x83, 0xf4, 0xca, 0x04,
+    0xed, 0x76, 0x7b, 0x07, 0x17, 0xa7, 0x7b, 0x0d, 0xe9, 0x70, 0x85, 0x87, 0xa4, 0x63, 0xe3, 0xbc,
+    0x21, 0xbd, 0x5e, 0xea, 0x16, 0x54, 0xed, 0x2a, 0xc1, 0x0b, 0x9f, 0x3e, 0xfe, 0x07, 0xa9, 0xe6,
+    0x39, 0x28, 0x97, 0xc8, 0x26, 0xbd, 0x59, 0x22, 0x83, 0xba, 0x82, 0x4b, 0xc9, 0xbe, 0x5f, 0x22,
+    0xcb, 0x73, 0x42, 0x43, 0x3a, 0x6e, 0x43, 0xb2, 0xc7, 0x66, 0x66, 0x9b, 0xec, 0x39, 0xd5, 0x11,
+    0x8b, 0x0d, 0xe9, 0x87, 0xa5, 0x89, 0x43, 0x2d, 0x31, 0xa6, 0xb4, 0xdf, 0x29, 0xf6, 0x42, 0x32,
+    0x06, 0x01, 0x15, 0x43, 0x95, 0x33, 0x63, 0xe5, 0x2e, 0xb9, 0x1c, 0xca, 0xe6, 0x20, 0xf7, 0xc2,
+    0x29, 0x2f, 0x5c, 0x14, 0x3c, 0xa1, 0xf1, 0x60, 0x32, 0x73, 0x2e, 0xca, 0x72, 0x5c, 0xc0, 0x76,
+    0xf9, 0x42, 0x51, 0xbf, 0x1c, 0x9c, 0xb2, 0x6a, 0xe0, 0x67, 0xc6, 0x66, 0x1e, 0x97, 0x50, 0xab,
+    0x50, 0x56, 0xac, 0xea, 0x85, 0xa7, 0x17, 0xdc, 0x6c, 0x10, 0x9d, 0xcb, 0xa5, 0xb0, 0x34, 0x44,
+    0x81, 0x21, 0x0b, 0x50, 0x46, 0x53, 0x12, 0xa0, 0x05, 0x0f, 0x55, 0x44, 0x66, 0x26, 0x94, 0x30,
+    0x67, 0xa1, 0xa8, 0xcc, 0xad, 0xc6, 0x97, 0xf6, 0xc3, 0xb2, 0x66, 0x7f, 0x8d, 0x33, 0x18, 0x20,
+    0xac, 0xe7, 0x05, 0x32, 0x87, 0x8e, 0x4f, 0xbb, 0xc1, 0xf6, 0x82, 0x98, 0xe4, 0x50, 0x73, 0x6c,
+    0x79, 0x31, 0xa9, 0x95, 0x2e, 0x11, 0x5b, 0x04, 0xce, 0xb4, 0x15, 0xd9, 0xb3, 0x30, 0x2d, 0x23,
+    0xac, 0xbc, 0xfa, 0x29, 0xa1, 0x4d, 0xaf, 0x25, 0x16, 0xba, 0x98, 0xe9, 0x2d, 0x05, 0x4b, 0x32,
+    0x35, 0x4e, 0x65, 0x19, 0x8f, 0xfc, 0x5e, 0x22, 0x31, 0x47, 0x72, 0x2d, 0xd1, 0x69, 0x1f, 0x74,
+    0x8e, 0x8e, 0xd1, 0xe9, 0xe6, 0x9f, 0x47, 0xc8, 0x98, 0xb2, 0x8f, 0x70, 0x96, 0xa9, 0xc0, 0x40,
+    0x86, 0x05, 0x55, 0x77, 0x55, 0x8f, 0xac, 0xbb, 0xa0, 0x4a, 0x82, 0x46, 0x0a, 0x60, 0x02, 0xd0,
+    0x9a, 0xe3, 0x25, 0x1e, 0xb8, 0x20, 0x0f, 0xa9, 0x8b, 0xf6, 0x18, 0x41, 0x02, 0x61, 0x8a, 0xc3,
+    0x03, 0xd6, 0x91, 0x40, 0xc6, 0xf6, 0x9c, 0xed, 0x73, 0x34, 0xa8, 0x7c, 0x8b, 0xb3, 0x84, 0x16,
+    0x84, 0x8c, 0xe7, 0x10, 0xf5, 0x67, 0x35, 0x83, 0xa8, 0xc8, 0xe0, 0x21, 0x19, 0xa3, 0xac, 0xf7,
+    0xfd, 0xbc, 0x77, 0x8e, 0x06, 0xea, 0xba, 0xa7, 0x78, 0xba, 0x64, 0x5d, 0x46, 0x76, 0xc2, 0x04,
+    0xa8, 0x22, 0x5e, 0x3d, 0xf7, 0xf0, 0x9c, 0x07, 0x4b, 0x7a, 0xa6, 0xab, 0x17, 0x2e, 0x51, 0x7e,
+    0xfe, 0x7b, 0x09, 0x54, 0x91, 0x96, 0xd3, 0xda, 0xa8, 0x35, 0x95, 0x0e, 0x00, 0x79, 0x09, 0x6a,
+    0x65, 0x05, 0x2f, 0x81, 0xac, 0xcf, 0x43, 0xac, 0x4e, 0x90, 0x9a, 0xe9, 0x79, 0x68, 0xb5, 0x28,
+    0x2e, 0x90, 0x39, 0xc4, 0x2f, 0x0a, 0xac, 0x7a, 0x8e, 0xc6, 0x3e, 0x17, 0xf2, 0x85, 0x92, 0x6c,
+    0x2e, 0x3a, 0xb7, 0x30, 0xe8, 0x57, 0x04, 0x6f, 0xf3, 0x8d, 0x38, 0x7f, 0x2b, 0x8d, 0x9f, 0xd2,
+    0x49, 0xbd, 0xed, 0x38, 0x0b, 0x2d, 0x46, 0x5c, 0x77, 0x3f, 0x26, 0x09, 0x62, 0x94, 0xce, 0xe1,
+    0x13, 0x63, 0xee, 0xee, 0xd8, 0x96, 0x6f, 0x13, 0x6f, 0xe7, 0xb9, 0x3b, 0x74, 0x21, 0xf3, 0xd0,
+    0x3c, 0x2f, 0xd9, 0xa7, 0x8f, 0x38, 0x55, 0x64, 0x45, 0x36, 0x1d, 0xa9, 0x60, 0x45, 0x34, 0x50,
+    0x10, 0x0f, 0xe0, 0x0b, 0x70, 0x11, 0xc3, 0xb7, 0x80, 0x49, 0x5f, 0x21, 0x00, 0x71, 0x0a, 0xa0,
+    0x42, 0x73, 0xa8, 0x2b, 0x08, 0xf0, 0x1c, 0x6e, 0x75, 0xaf, 0xa3, 0xc7, 0x2c, 0x52, 0x60, 0x66,
+    0x20, 0x80, 0xad, 0xe7, 0xea, 0xd0, 0x4c, 0x59, 0x8e, 0x54, 0x65, 0xc7, 0x44, 0xa7, 0x18, 0xb1,
+    0x5b, 0x66, 0x40, 0xa3, 0x62, 0x6b, 0x93, 0x3c, 0xf8, 0x79, 0xb5, 0xbd, 0xcc, 0xda, 0x16, 0x3c,
+    0x33, 0x5b, 0x27, 0xc2, 0x29, 0xea, 0xe8, 0xaf, 0xd8, 0x89, 0x65, 0xeb, 0x84, 0x51, 0x60, 0x13,
+    0xe2, 0xb0, 0xa5, 0x34, 0x5d, 0x15, 0x30, 0x16, 0xbf, 0xd4, 0x4a, 0xf9, 0xfe, 0xf9, 0xbc, 0x28,
+    0xe8, 0xc6, 0x76, 0xe4, 0x86, 0x14, 0xc5, 0x91, 0x9d, 0x7e, 0x23, 0xe2, 0x97, 0x38, 0xf9, 0x8c,
+    0x47, 0xd2, 0xcb, 0xbe, 0x19, 0xc1, 0x76, 0x4e, 0xf2, 0x0d, 0x89, 0xe4, 0xdb, 0x1d, 0xff, 0x07,
+    0x15, 0xf4, 0x6a, 0x3c, 0xf6, 0x31, 0x00, 0x00,
+};
+
+// HTML_STYLE: 16952 -> 3681 bytes
+#define HTML_STYLE_ETAG "\"de33556029153c47\""
+static const size_t HTML_STYLE_GZ_LEN = 3681;
+static const uint8_t HTML_STYLE_GZ[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xcd, 0x1b, 0xdb, 0x6e, 0xe3, 0x36,
+    0xf6, 0x3d, 0x5f, 0x41, 0xa4, 0x28, 0x30, 0x6e, 0x2d, 0x57, 0xb2, 0x63, 0xc7, 0x76, 0xd0, 0x62,
+    0x3b, 0x99, 0x09, 0xb6, 0x40, 0xd3, 0xe9, 0xb6, 0x5d, 0x60, 0x81, 0xc5, 0x3e, 0xd0, 0x12, 0x6d,
+    0x73, 0x23, 0x4b, 0x5a, 0x51, 0x8e, 0x93, 0x0a, 0xf9, 0xf7, 0x3d, 0x87, 0x17, 0x89, 0xba, 0xd9,
+    0xce, 0x8c, 0xda, 0x4e, 0x06, 0xad, 0x6d, 0x92, 0x22, 0xcf, 0xfd, 0xc6, 0xa3, 0x8b, 0x6f, 0xbe,
+    0x22, 0xdf, 0xf6, 0xf2, 0x77, 0x41, 0x08, 0xf9, 0xf9, 0x76, 0x76, 0x35, 0x7a, 0xff, 0xaf, 0xf7,
+    0x84, 0xed, 0x56, 0x2c, 0x08, 0x58, 0x40, 0xd6, 0x3c, 0x64, 0x44, 0xb0, 0xf4, 0x91, 0xa5, 0xe4,
+    0x9f, 0x3f, 0xe0, 0x9a, 0x7b, 0x1e, 0x44, 0x7c, 0xb3, 0xcd, 0xc8, 0x6d, 0xbc, 0xdb, 0xd1, 0x28,
+    0x80, 0x89, 0x90, 0x3e, 0xc7, 0xfb, 0x8c, 0x7c, 0x4d, 0xde, 0x87, 0xcc, 0xcf, 0x52, 0xee, 0x93,
+    0xb7, 0xe1, 0x9e, 0x91, 0x84, 0x86, 0x2c, 0xcb, 0x18, 0x3e, 0xf4, 0x21, 0x0c, 0x84, 0xbf, 0x8d,
+    0xe3, 0x90, 0x64, 0x2c, 0xdd, 0xf1, 0x88, 0x86, 0x84, 0x32, 0x91, 0x6d, 0x59, 0x06, 0x8b, 0x1d,
+    0x22, 0x12, 0x9a, 0x66, 0x34, 0x22, 0xb0, 0x1d, 0x61, 0xeb, 0x35, 0x6c, 0xc2, 0x1f, 0xe5, 0x73,
+    0xfd, 0xa0, 0x46, 0xbe, 0xfa, 0xe6, 0xe2, 0x62, 0x99, 0xc6, 0x71, 0x96, 0xc3, 0xa6, 0x40, 0x31,
+    0xc7, 0x71, 0xda, 0x61, 0x95, 0x33, 0xb0, 0x9a, 0xc0, 0x97, 0x20, 0x75, 0x56, 0x9b, 0x25, 0xf9,
+    0xc2, 0x7d, 0xe7, 0x79, 0xde, 0xf5, 0x8d, 0x19, 0x5b, 0xe3, 0xd8, 0xfb, 0xd9, 0xfb, 0x77, 0x77,
+    0x93, 0x62, 0xcc, 0xdf, 0xa7, 0x29, 0x8b, 0x32, 0x98, 0xf0, 0x66, 0xde, 0xdb, 0xf1, 0xb8, 0x9c,
+    0x00, 0x1a, 0xa9, 0x89, 0xeb, 0x77, 0xf3, 0xe9, 0xc2, 0x2d, 0x27, 0x9e, 0x69, 0x84, 0x7b, 0xbb,
+    0x77, 0xf0, 0x57, 0x8c, 0x6e, 0x52, 0xc6, 0x70, 0x78, 0x72, 0xf7, 0x76, 0x31, 0x2d, 0x17, 0xc7,
+    0x29, 0x8d, 0x36, 0x0c, 0xc6, 0xef, 0xdc, 0xf9, 0x7c, 0xf2, 0xbe, 0x18, 0x4f, 0x78, 0xf4, 0x20,
+    0x37, 0x79, 0x6b, 0x6f, 0x92, 0xec, 0xd3, 0x24, 0x64, 0xcd, 0xf1, 0x94, 0x05, 0xb8, 0xc5, 0x7c,
+    0xea, 0x5d, 0x2d, 0x8a, 0xc1, 0x67, 0x16, 0x86, 0xf1, 0x01, 0xc6, 0xdf, 0x8d, 0x17, 0x0b, 0x04,
+    0xbc, 0x24, 0xd0, 0xaf, 0x0c, 0xd8, 0x8b, 0xfc, 0xc9, 0xe2, 0x07, 0x16, 0x09, 0xf2, 0xe6, 0xfe,
+    0xd6, 0xe1, 0x62, 0x3b, 0xb0, 0x69, 0x84, 0x04, 0x7a, 0xa4, 0xe9, 0x1b, 0x4d, 0xad, 0x81, 0xda,
+    0x77, 0x6d, 0x8f, 0xae, 0xcd, 0x68, 0xc0, 0x77, 0x4b, 0x92, 0x6e, 0x56, 0xf4, 0xcd, 0x78, 0xe2,
+    0x0e, 0xc7, 0x93, 0xeb, 0xe1, 0xf8, 0x6a, 0x32, 0x1c, 0xcd, 0xdc, 0x81, 0x39, 0xf5, 0x6d, 0x9c,
+    0x82, 0x38, 0x89, 0x25, 0x11, 0x74, 0xc7, 0x08, 0x15, 0x04, 0x1e, 0x01, 0x81, 0x79, 0xca, 0x86,
+    0xe4, 0xa7, 0x0f, 0xbf, 0x11, 0xea, 0xfb, 0x40, 0x4b, 0xe2, 0xc7, 0x61, 0x0c, 0xb8, 0x14, 0x20,
+    0xc8, 0x87, 0x1c, 0x11, 0xaf, 0xb3, 0xb6, 0xed, 0xc7, 0xae, 0x3e, 0x1e, 0x1e, 0x73, 0x04, 0x4b,
+    0x5a, 0xd7, 0x4c, 0x15, 0x08, 0x8e, 0x93, 0xd0, 0x88, 0x85, 0x55, 0xb6, 0x2b, 0xd0, 0xee, 0x6f,
+    0xc9, 0x96, 0x51, 0x14, 0xf6, 0x15, 0x4d, 0x05, 0x88, 0x2c, 0x33, 0xe2, 0xb3, 0x42, 0xf1, 0xd1,
+    0xb0, 0x64, 0x3c, 0x0b, 0x99, 0x03, 0xe2, 0x2d, 0x05, 0xb8, 0x4a, 0x1d, 0x2d, 0x23, 0x1a, 0x9a,
+    0xda, 0xca, 0x92, 0x62, 0x05, 0xb9, 0xd4, 0x0a, 0x6b, 0xa7, 0x2f, 0xdc, 0xc5, 0x6c, 0xf1, 0xee,
+    0xfb, 0x96, 0x59, 0x29, 0x92, 0x77, 0x77, 0x4a, 0x94, 0x14, 0xbc, 0xb7, 0xfb, 0x54, 0xc4, 0xa0,
+    0x99, 0x3c, 0x62, 0x5d, 0xc0, 0xae, 0x63, 0x7f, 0x2f, 0xf4, 0xce, 0x96, 0xa4, 0xa8, 0xe1, 0xb5,
+    0x1a, 0xc6, 0x3f, 0x4d, 0x9a, 0x1d, 0x4d, 0x1f, 0xaa, 0x9c, 0x95, 0xd2, 0xaa, 0xa1, 0x3d, 0xd0,
+    0x34, 0xaa, 0xce, 0x2a, 0xa1, 0x35, 0xbc, 0xc7, 0xef, 0x69, 0x75, 0x01, 0xf0, 0xb0, 0xe0, 0xfc,
+    0xdd, 0x3e, 0x02, 0x54, 0xe2, 0x88, 0x3c, 0xb0, 0x67, 0xb2, 0x8d, 0x33, 0xfc, 0xd0, 0x60, 0xc2,
+    0xd7, 0x26, 0xfa, 0x38, 0x58, 0xc7, 0xda, 0x71, 0xc4, 0x96, 0x06, 0x28, 0xcc, 0x92, 0xc3, 0xee,
+    0x10, 0xff, 0x8d, 0xa6, 0xae, 0xe1, 0xed, 0x3a, 0x05, 0xa9, 0x72, 0x36, 0x14, 0x44, 0xe0, 0x2a,
+    0x79, 0xba, 0xd1, 0xfc, 0x0e, 0x9c, 0xa7, 0x25, 0x99, 0x9b, 0xdf, 0x6b, 0x10, 0x3e, 0x6f, 0x82,
+    0xbf, 0x5e, 0x2e, 0x2e, 0xbe, 0xca, 0xc9, 0x2a, 0x7e, 0x72, 0x04, 0xff, 0x9d, 0x47, 0x9b, 0xa5,
+    0x96, 0x33, 0x18, 0xb9, 0x21, 0x40, 0x8b, 0x0d, 0x8f, 0x96, 0xee, 0x0d, 0xd8, 0x8d, 0x20, 0xc0,
+    0x59, 0xf8, 0xfa, 0x72, 0xb1, 0xcd, 0x76, 0xe1, 0x10, 0x9e, 0x09, 0x9e, 0x73, 0x90, 0x16, 0x34,
+    0x92, 0x4b, 0xcf, 0x75, 0xbf, 0xc4, 0x29, 0x1c, 0x1c, 0xed, 0x7c, 0xb4, 0x3f, 0x2b, 0xea, 0x3f,
+    0x6c, 0xd2, 0x78, 0x1f, 0x05, 0x86, 0x18, 0x5a, 0x71, 0xa4, 0x60, 0xd7, 0xe4, 0x60, 0x1d, 0x47,
+    0x99, 0xb3, 0xa6, 0x3b, 0x1e, 0x3e, 0x2f, 0xc9, 0x9e, 0x3b, 0xbb, 0x38, 0x8a, 0xc1, 0x5a, 0xfa,
+    0x6c, 0x48, 0x7e, 0xbd, 0xbb, 0x87, 0x1f, 0xce, 0x2f, 0x6c, 0xb3, 0x0f, 0x69, 0x3a, 0x24, 0xf7,
+    0x2c, 0x0a, 0x63, 0xf8, 0x88, 0x41, 0xa8, 0xe0, 0xf3, 0x36, 0x8e, 0x44, 0x1c, 0x52, 0x31, 0x24,
+    0x97, 0x3f, 0xf2, 0x15, 0x4b, 0xa9, 0xa4, 0x2f, 0x3e, 0x72, 0x09, 0x43, 0xb7, 0xf1, 0x3e, 0xe5,
+    0x20, 0xcd, 0x3f, 0xb1, 0x03, 0xfc, 0x2c, 0x76, 0x2d, 0x8e, 0x04, 0xa4, 0x59, 0x01, 0x8a, 0x90,
+    0xa0, 0xa0, 0x2c, 0x39, 0x1a, 0x2d, 0xe2, 0x81, 0xd2, 0xe0, 0x60, 0xc0, 0x45, 0x02, 0xe6, 0x7f,
+    0xb9, 0x0e, 0x99, 0x24, 0x21, 0x7e, 0x82, 0xa6, 0xa7, 0x4c, 0xb2, 0x73, 0x09, 0x28, 0xed, 0x77,
+    0x11, 0x4e, 0xc4, 0xe0, 0x41, 0xd6, 0x68, 0x6a, 0xb6, 0x1c, 0x1c, 0x4b, 0x54, 0x1c, 0x04, 0x47,
+    0x70, 0x30, 0x33, 0x4e, 0xc8, 0x37, 0x34, 0xdb, 0xa7, 0x0c, 0x18, 0x10, 0xc5, 0x11, 0x93, 0x0c,
+    0x50, 0x86, 0xa8, 0x87, 0x3f, 0x74, 0x25, 0xbf, 0xc5, 0x89, 0xd2, 0x5d, 0xb4, 0x63, 0x21, 0x7f,
+    0x60, 0x03, 0x1c, 0xed, 0x67, 0x7f, 0x94, 0xd5, 0x91, 0xb2, 0x0f, 0xc8, 0x61, 0x23, 0x14, 0x64,
+    0x9a, 0x3c, 0x69, 0x1a, 0x4a, 0x41, 0x1b, 0xb4, 0x51, 0xec, 0xbf, 0x7b, 0x91, 0xf1, 0xf5, 0x33,
+    0xd8, 0xa7, 0x28, 0x43, 0x57, 0x21, 0xf9, 0xe0, 0xac, 0x58, 0x76, 0x60, 0x8a, 0x4c, 0x14, 0x48,
+    0x13, 0x39, 0x3c, 0x63, 0x3b, 0xb1, 0x44, 0x03, 0xc8, 0xd2, 0x82, 0xd0, 0x62, 0x9b, 0xa2, 0x0b,
+    0x90, 0x9e, 0xa2, 0x29, 0x56, 0x35, 0x0b, 0xd2, 0x94, 0xb1, 0x9a, 0x11, 0x91, 0x0b, 0x0a, 0x31,
+    0xcf, 0xb2, 0x18, 0xec, 0xb5, 0x07, 0x18, 0x80, 0x18, 0xf1, 0xc0, 0x88, 0xaa, 0x9c, 0x1e, 0x20,
+    0x7b, 0x34, 0xc2, 0x64, 0xeb, 0xe5, 0x55, 0xa9, 0xf1, 0xd8, 0xae, 0x60, 0xef, 0x41, 0xcb, 0x4b,
+    0x14, 0xa7, 0x3b, 0x1a, 0x4a, 0x31, 0x42, 0x3f, 0x0b, 0xf6, 0x1a, 0xd0, 0x94, 0x34, 0x1a, 0xcd,
+    0x94, 0xba, 0x8d, 0x44, 0x00, 0xf6, 0x70, 0x1d, 0xd7, 0x36, 0x1b, 0x2d, 0xd4, 0x6e, 0x31, 0xae,
+    0xcf, 0x9e, 0x71, 0x40, 0xa2, 0x7b, 0xd8, 0x02, 0x45, 0xe4, 0x2e, 0x0c, 0x77, 0x3f, 0xa4, 0x34,
+    0x91, 0x32, 0x33, 0x12, 0x07, 0x94, 0x53, 0x01, 0xe6, 0x2e, 0xa9, 0xf0, 0xe2, 0xaa, 0x85, 0x17,
+    0x4d, 0x9a, 0x19, 0x07, 0xf0, 0x2a, 0x5a, 0xb4, 0x02, 0x5c, 0x63, 0xd0, 0x8b, 0x81, 0x0c, 0xd5,
+    0x28, 0xaf, 0x21, 0x60, 0xe0, 0x6f, 0x55, 0x13, 0x74, 0x80, 0x4e, 0x31, 0x0e, 0xfe, 0x9a, 0x27,
+    0x82, 0x8b, 0xda, 0x8e, 0x10, 0x7c, 0xd9, 0xfb, 0x17, 0xe4, 0x1a, 0xcd, 0xe7, 0x68, 0x7e, 0xfa,
+    0x55, 0xa5, 0x7b, 0xca, 0x23, 0x72, 0x88, 0xd3, 0x07, 0x09, 0x3d, 0x91, 0x86, 0xb5, 0x67, 0x65,
+    0xda, 0xc1, 0x11, 0xb9, 0xa6, 0xe2, 0xd2, 0xb3, 0xf5, 0x66, 0x93, 0xf2, 0x00, 0x7f, 0xe3, 0xa7,
+    0x03, 0x4a, 0x01, 0x83, 0x40, 0xc7, 0x34, 0x3e, 0x80, 0xe5, 0x80, 0xc8, 0x72, 0x47, 0x9f, 0xc0,
+    0xf4, 0x13, 0x6f, 0x9d, 0x0e, 0xac, 0x9f, 0xa3, 0xeb, 0xf1, 0x5a, 0x71, 0x0a, 0xc6, 0x8c, 0x11,
+    0xeb, 0x50, 0x1b, 0xc9, 0x7c, 0x45, 0xb2, 0x0f, 0xfb, 0x0c, 0x3d, 0xbe, 0xe4, 0x33, 0x41, 0x9b,
+    0x81, 0x71, 0x00, 0x82, 0x87, 0x62, 0x22, 0xf2, 0x16, 0x6d, 0xae, 0x6f, 0xdf, 0xe0, 0x27, 0xae,
+    0x51, 0xde, 0xc3, 0x58, 0x57, 0xe3, 0x96, 0x06, 0xcd, 0x01, 0xb7, 0x31, 0x54, 0x8a, 0xe5, 0x51,
+    0x79, 0x3c, 0x29, 0xd8, 0x4f, 0x85, 0xb3, 0xe4, 0x91, 0x60, 0x19, 0x9c, 0x84, 0xff, 0x70, 0x47,
+    0xdb, 0x79, 0x7a, 0xf3, 0x82, 0x14, 0xbf, 0x1d, 0x62, 0x22, 0xb1, 0xc6, 0x07, 0x78, 0xc0, 0x08,
+    0x04, 0xef, 0x96, 0x0c, 0x68, 0x1a, 0x19, 0xda, 0xb4, 0xb3, 0xee, 0xa4, 0x93, 0x38, 0x49, 0xbd,
+    0x13, 0x98, 0xbd, 0xa8, 0xd3, 0x51, 0x19, 0x0c, 0x14, 0x5a, 0x87, 0x43, 0x86, 0xe1, 0xe1, 0x11,
+    0x6b, 0x86, 0x38, 0xfe, 0x8c, 0xcf, 0x4a, 0xa3, 0x88, 0x9e, 0xa2, 0x70, 0x14, 0xe4, 0xc0, 0xb3,
+    0xad, 0xa4, 0x59, 0x90, 0x52, 0xd0, 0xb1, 0x0d, 0x09, 0x98, 0x1f, 0x2b, 0x87, 0x2a, 0x06, 0x05,
+    0xce, 0x4e, 0xe9, 0x00, 0x1a, 0xc6, 0xb9, 0x74, 0x9b, 0x57, 0xca, 0x3a, 0x9c, 0x60, 0x50, 0x9d,
+    0x62, 0x1d, 0x3e, 0xa0, 0xc5, 0x4c, 0xd6, 0x29, 0xa6, 0x49, 0xe2, 0x48, 0x90, 0x25, 0x19, 0xf2,
+    0xba, 0x1b, 0xb0, 0xe4, 0xe6, 0x23, 0x8d, 0x92, 0x0f, 0x36, 0xc9, 0x30, 0x16, 0x90, 0x2c, 0x16,
+    0x48, 0xb0, 0x21, 0x1e, 0x43, 0xe4, 0x6f, 0x4a, 0x63, 0xac, 0xb9, 0x31, 0xd6, 0x86, 0xdf, 0x82,
+    0x4f, 0xae, 0xfc, 0xf3, 0x01, 0x44, 0x78, 0x6c, 0xf8, 0x52, 0xc5, 0xad, 0x0a, 0x80, 0x09, 0xcd,
+    0xb6, 0x75, 0xde, 0x12, 0xf7, 0xa6, 0x0f, 0x4b, 0x8e, 0x26, 0xe1, 0xc9, 0x39, 0xf0, 0x20, 0xdb,
+    0x2e, 0xc9, 0x0c, 0x02, 0x46, 0xdb, 0x6f, 0xb9, 0x0a, 0x8c, 0xf6, 0xf0, 0xf0, 0x1c, 0x6d, 0x18,
+    0x29, 0x07, 0x4f, 0xea, 0x72, 0x30, 0xec, 0x9e, 0x6e, 0x67, 0x83, 0x4e, 0x5b, 0x0b, 0x75, 0xb9,
+    0x95, 0x7a, 0xab, 0xf3, 0x22, 0x41, 0xc0, 0x04, 0x43, 0xaa, 0x01, 0x06, 0x52, 0x64, 0xcf, 0xa1,
+    0x56, 0x1a, 0xc0, 0x15, 0x32, 0x48, 0xc8, 0xf6, 0x21, 0xf3, 0xa2, 0xa0, 0x31, 0x31, 0xac, 0x43,
+    0x7d, 0xc1, 0x64, 0xac, 0x54, 0x97, 0xe3, 0xa6, 0x5d, 0x99, 0x07, 0xb0, 0xee, 0x13, 0x7f, 0x8b,
+    0x76, 0x9d, 0xcc, 0xf1, 0x73, 0xec, 0x6f, 0xe5, 0x52, 0x0c, 0xe7, 0xdd, 0x0a, 0xc1, 0x80, 0x5c,
+    0x26, 0xc0, 0x3f, 0xa1, 0x65, 0xcd, 0x98, 0xa5, 0x8a, 0x2f, 0xdf, 0x0d, 0x0a, 0xb6, 0x65, 0x90,
+    0xce, 0x88, 0x35, 0x44, 0x31, 0x10, 0x86, 0x27, 0x09, 0x4b, 0x7d, 0x2a, 0x58, 0x6b, 0x38, 0x33,
+    0xd1, 0x47, 0x9f, 0x1f, 0x47, 0x95, 0xc4, 0x20, 0xdf, 0x01, 0x2d, 0x1e, 0xf3, 0xd7, 0x4a, 0x4f,
+    0xbb, 0x00, 0x5a, 0x12, 0x74, 0x55, 0x81, 0x49, 0x4b, 0x77, 0x1d, 0x24, 0x9d, 0x20, 0xb7, 0xc3,
+    0xb4, 0x84, 0x4c, 0x22, 0x73, 0xfc, 0x2d, 0x0f, 0x83, 0xbc, 0xb1, 0x93, 0x09, 0xd8, 0xed, 0xa7,
+    0xe4, 0x77, 0xa4, 0x6d, 0x5e, 0xd5, 0xb5, 0x86, 0x2d, 0xd0, 0x7b, 0x5c, 0x69, 0x5d, 0xab, 0x6f,
+    0x91, 0xf1, 0xdd, 0x2b, 0xb7, 0xb8, 0x18, 0x61, 0xd1, 0x0a, 0x2c, 0xb7, 0xc8, 0xaa, 0x6e, 0xc8,
+    0xd0, 0xce, 0x79, 0x5e, 0xd2, 0x7d, 0x16, 0x57, 0x86, 0x9e, 0xce, 0x77, 0x31, 0x85, 0xa7, 0x58,
+    0xc7, 0x31, 0x86, 0x07, 0x52, 0xd0, 0xd1, 0x3a, 0x80, 0xdb, 0x01, 0x49, 0x7e, 0x20, 0x7b, 0x41,
+    0x37, 0x4c, 0x7a, 0x0f, 0x4b, 0x13, 0x2c, 0xf7, 0x61, 0xb9, 0x0c, 0xb5, 0xc5, 0x5f, 0xe4, 0x32,
+    0xe6, 0xd3, 0x13, 0x3e, 0x43, 0x41, 0xf7, 0xd9, 0xbb, 0x8e, 0x0a, 0x98, 0x9f, 0xb1, 0x07, 0x31,
+    0x70, 0x82, 0x8c, 0x74, 0x27, 0x00, 0xcd, 0xb4, 0xa1, 0x69, 0xa4, 0x1b, 0x7c, 0x19, 0x9e, 0x5c,
+    0x75, 0x9e, 0x45, 0xff, 0x3b, 0x06, 0x76, 0xc2, 0x4f, 0xe3, 0x30, 0x54, 0xa9, 0x72, 0x51, 0x07,
+    0x7e, 0xe4, 0x2b, 0xa6, 0xe4, 0xb6, 0x50, 0x2e, 0x88, 0xaa, 0xff, 0xb7, 0x67, 0xfb, 0x52, 0xd3,
+    0x8a, 0x07, 0x8d, 0x2b, 0x53, 0x76, 0x01, 0xf2, 0x82, 0x9d, 0x28, 0x08, 0xa9, 0x74, 0xc2, 0xb2,
+    0x19, 0xc5, 0x7e, 0xcb, 0x25, 0x64, 0x8b, 0xab, 0x07, 0x0e, 0xf2, 0x69, 0x36, 0x02, 0xbc, 0xca,
+    0x23, 0x5a, 0xe6, 0xf3, 0x42, 0xea, 0xe5, 0x76, 0xbd, 0x27, 0x3a, 0x77, 0x58, 0xfd, 0xc6, 0xd4,
+    0xa2, 0x8c, 0x05, 0x41, 0x38, 0x04, 0x24, 0x56, 0x4a, 0xa9, 0xaf, 0x88, 0x76, 0x4e, 0xa0, 0xfa,
+    0x2d, 0xae, 0xae, 0xef, 0x0a, 0x83, 0x24, 0x15, 0x6a, 0xf4, 0x27, 0x3a, 0xcd, 0x76, 0xd3, 0x70,
+    0xdc, 0x95, 0xfa, 0xb2, 0xa0, 0xb8, 0x4c, 0x62, 0x6e, 0xd6, 0xdb, 0xf6, 0x48, 0x7a, 0x47, 0x40,
+    0x1b, 0x36, 0x33, 0x71, 0xbc, 0x92, 0x01, 0xd7, 0xb2, 0xc8, 0x49, 0xca, 0xd6, 0xfc, 0x29, 0xef,
+    0x2e, 0x0d, 0xfc, 0x01, 0x7e, 0xcc, 0x3a, 0x78, 0x04, 0x19, 0xc7, 0x51, 0x0d, 0xa8, 0x2c, 0x66,
+    0x4f, 0xcc, 0x6f, 0x5b, 0x6d, 0x8a, 0x9e, 0xb5, 0xe5, 0xf8, 0x3d, 0x6f, 0x0f, 0x20, 0xcc, 0xca,
+    0x88, 0x2a, 0x4f, 0xd6, 0x83, 0x6b, 0xaf, 0xd0, 0xb7, 0x0f, 0x0a, 0x21, 0x6c, 0x67, 0xd2, 0x47,
+    0x2e, 0x3d, 0x97, 0x3a, 0x26, 0x00, 0xe8, 0x8e, 0xab, 0x6a, 0x2e, 0xbd, 0x92, 0xd2, 0x4c, 0xad,
+    0x42, 0x92, 0xa9, 0x13, 0x46, 0xfb, 0x1d, 0x4b, 0xb9, 0x0f, 0x22, 0x47, 0x57, 0x58, 0xf7, 0xc4,
+    0x01, 0xf1, 0x47, 0x0a, 0x8f, 0x09, 0x40, 0x3e, 0x0e, 0x85, 0xfe, 0x31, 0xd0, 0x96, 0x1a, 0xa5,
+    0x85, 0xa4, 0x4c, 0x80, 0x85, 0x0e, 0x21, 0x29, 0x87, 0xb0, 0xfb, 0x52, 0xdf, 0x30, 0xc8, 0x42,
+    0xed, 0x25, 0x59, 0xed, 0x33, 0x22, 0xf6, 0x2b, 0x4c, 0x66, 0x2b, 0xb6, 0x63, 0xb9, 0xc5, 0x47,
+    0xeb, 0x85, 0x68, 0x99, 0xf5, 0xcf, 0xe6, 0xc3, 0x6b, 0x6f, 0xb8, 0x80, 0xc4, 0x7f, 0x52, 0x26,
+    0xfe, 0xf7, 0x34, 0x7d, 0x60, 0xc1, 0x37, 0x42, 0xde, 0x21, 0x80, 0x27, 0x90, 0x66, 0xa3, 0xba,
+    0xe5, 0xc8, 0x4c, 0xb6, 0xee, 0x3a, 0x77, 0x87, 0xe3, 0xa9, 0x3b, 0xf4, 0xc6, 0x93, 0xe1, 0xc8,
+    0x1b, 0x5b, 0x94, 0xad, 0x3c, 0x4a, 0x6c, 0x75, 0x1a, 0x1e, 0x59, 0x61, 0xd4, 0xa8, 0xc2, 0x0f,
+    0x7d, 0x39, 0x51, 0xa6, 0x26, 0xe5, 0xf5, 0x07, 0x56, 0x38, 0x00, 0x61, 0x01, 0x11, 0xd9, 0xbb,
+    0x94, 0xfa, 0x40, 0x71, 0x24, 0xd6, 0x5e, 0x00, 0xd1, 0x28, 0xb8, 0xb5, 0x47, 0x60, 0xfd, 0x16,
+    0x58, 0x17, 0x22, 0xfb, 0x06, 0x35, 0xbc, 0xe4, 0x5d, 0x48, 0x13, 0x2d, 0x9d, 0x82, 0xe9, 0xfb,
+    0x93, 0x96, 0xda, 0xbd, 0xbe, 0x42, 0xa9, 0xe3, 0xaa, 0xb7, 0xeb, 0x46, 0xb5, 0xba, 0x00, 0x31,
+    0x3d, 0x32, 0x8d, 0x22, 0x76, 0x64, 0xba, 0x55, 0x6e, 0x2b, 0x90, 0x59, 0x84, 0xfa, 0x1a, 0x8b,
+    0x52, 0x0f, 0x78, 0x41, 0x28, 0x3f, 0x53, 0xc8, 0xe1, 0x78, 0x18, 0x92, 0x4b, 0x35, 0x7a, 0xd9,
+    0xc1, 0xee, 0xb3, 0xe9, 0xf3, 0x72, 0xec, 0x69, 0x52, 0xf7, 0x0e, 0x47, 0x39, 0xdb, 0x9f, 0x73,
+    0xff, 0x90, 0x08, 0x59, 0xd1, 0x0a, 0xc1, 0xbb, 0xab, 0x34, 0x8d, 0x6c, 0x69, 0xb8, 0x1e, 0xe0,
+    0x7d, 0x34, 0xc6, 0x28, 0x41, 0x51, 0xf1, 0x53, 0xab, 0x7a, 0x76, 0xe6, 0x71, 0x22, 0x5e, 0xe1,
+    0xc6, 0xd1, 0x85, 0xc3, 0x7f, 0x55, 0x3f, 0xdd, 0x55, 0x48, 0xfc, 0xe4, 0x22, 0xe1, 0x78, 0x70,
+    0x56, 0x35, 0xee, 0x45, 0x62, 0xa1, 0x9e, 0xaa, 0xd4, 0xda, 0xbb, 0x8a, 0x77, 0x1f, 0x59, 0x08,
+    0xb4, 0xcf, 0xc1, 0xda, 0x5e, 0xe5, 0xd0, 0x73, 0x0b, 0x7c, 0xf2, 0xa9, 0x55, 0x18, 0xfb, 0x0f,
+    0xf9, 0xa7, 0x94, 0x24, 0xed, 0x7b, 0x3d, 0xb3, 0x6b, 0xb3, 0x92, 0x71, 0x3c, 0x09, 0x7b, 0x6d,
+    0x6a, 0x77, 0x66, 0x9d, 0x0f, 0x41, 0xf9, 0x8c, 0x73, 0xb5, 0x12, 0xbc, 0xcf, 0x33, 0x47, 0x43,
+    0xf8, 0xd4, 0x8d, 0x18, 0x1e, 0xd8, 0x5e, 0xea, 0x3b, 0x8f, 0xbf, 0x52, 0x43, 0xe7, 0x67, 0x95,
+    0xa0, 0xea, 0x65, 0x3e, 0x1b, 0x8e, 0xfc, 0xd5, 0xb5, 0xa7, 0x69, 0x77, 0xa5, 0xb0, 0x8d, 0xa4,
+    0xfa, 0xb0, 0x1d, 0xcb, 0x68, 0xde, 0x4f, 0x1d, 0xb3, 0x3d, 0xfc, 0xc5, 0x43, 0xa8, 0x54, 0xac,
+    0xd6, 0x3b, 0x13, 0x49, 0xae, 0x59, 0x19, 0xdb, 0xfc, 0x03, 0x53, 0x3e, 0xf0, 0xce, 0x29, 0x23,
+    0x97, 0x10, 0x23, 0x41, 0x78, 0x73, 0x49, 0xbe, 0xfd, 0x8e, 0x80, 0x77, 0x00, 0x9b, 0x5c, 0x26,
+    0x5c, 0x56, 0x49, 0x11, 0x68, 0x43, 0x80, 0x2e, 0xd8, 0x38, 0xa4, 0x58, 0x82, 0x4d, 0x37, 0xd2,
+    0xca, 0xaa, 0xf4, 0x11, 0x15, 0xb4, 0x48, 0x57, 0x21, 0x9f, 0x6b, 0x35, 0xbc, 0xca, 0xac, 0x62,
+    0x37, 0x82, 0xb5, 0x33, 0xc5, 0x1d, 0x05, 0x4e, 0x0a, 0xd5, 0x90, 0x50, 0xc9, 0x8d, 0x34, 0x8f,
+    0x5b, 0xf4, 0xf3, 0x48, 0xf5, 0xe5, 0x64, 0x1c, 0x58, 0xcb, 0x9e, 0x2c, 0x1c, 0xf2, 0x33, 0xac,
+    0xf6, 0xf9, 0x97, 0x96, 0xaf, 0x93, 0xad, 0xab, 0x2e, 0xd9, 0xaa, 0x40, 0x38, 0x3a, 0x24, 0xd4,
+    0xa6, 0x34, 0xfe, 0xce, 0x3b, 0xdd, 0x1a, 0xba, 0x54, 0x73, 0x4b, 0xe7, 0x41, 0x86, 0x3a, 0x04,
+    0x93, 0x38, 0x9d, 0xae, 0xd3, 0x41, 0x65, 0xc2, 0x55, 0x13, 0xae, 0x7b, 0x72, 0x02, 0x47, 0x1a,
+    0x00, 0xf1, 0x4d, 0xc8, 0xaa, 0x20, 0xe1, 0xc8, 0x79, 0x40, 0x8d, 0xf5, 0x11, 0xb3, 0xe2, 0x88,
+    0x6b, 0x7f, 0x5b, 0x39, 0xca, 0x3e, 0x4b, 0x95, 0x4a, 0xed, 0xb3, 0x7a, 0x2d, 0xe8, 0x76, 0xcb,
+    0x85, 0xae, 0xd1, 0x46, 0x71, 0xf6, 0x66, 0xb9, 0xe6, 0xa9, 0xa9, 0xd4, 0x0e, 0x8a, 0xfa, 0x49,
+    0x01, 0x4a, 0x73, 0x4d, 0xde, 0x30, 0xd8, 0x5e, 0x85, 0x88, 0xcd, 0x3a, 0x6a, 0x57, 0x5c, 0x60,
+    0xd5, 0x55, 0x4f, 0x95, 0x50, 0xf5, 0xde, 0x60, 0x21, 0x6a, 0x57, 0xd5, 0x4d, 0x03, 0x42, 0x5e,
+    0x6c, 0x24, 0xec, 0x07, 0x5b, 0xd7, 0x96, 0x17, 0x13, 0x40, 0x3f, 0xe6, 0xf3, 0x35, 0xf7, 0x3b,
+    0x4d, 0x82, 0x92, 0x04, 0x43, 0x98, 0x6c, 0xab, 0x28, 0xf2, 0x66, 0x5c, 0xa1, 0x5b, 0xe7, 0xa2,
+    0x33, 0xab, 0xd2, 0x5e, 0x43, 0x24, 0x0d, 0x12, 0x22, 0xa3, 0xd9, 0x5e, 0xe4, 0xf6, 0x26, 0xda,
+    0x54, 0xb4, 0xe2, 0xac, 0x97, 0x57, 0x4f, 0x35, 0x3e, 0xad, 0x52, 0x51, 0x99, 0xb9, 0x6e, 0xab,
+    0x0a, 0x1b, 0x0f, 0x53, 0xc7, 0xad, 0x1b, 0x1e, 0xb9, 0x3d, 0x91, 0x6d, 0x15, 0x72, 0xd2, 0x89,
+    0x1f, 0xf2, 0xae, 0xa4, 0x1f, 0x81, 0xd6, 0xab, 0x0e, 0x94, 0x67, 0xcd, 0x75, 0xaa, 0xd7, 0xb0,
+    0xb2, 0x10, 0xc2, 0x31, 0x1a, 0xe6, 0x1d, 0x25, 0x07, 0x6b, 0x9d, 0x0f, 0x99, 0x1b, 0x24, 0x22,
+    0xcd, 0x95, 0xa6, 0xcb, 0xac, 0xf7, 0xd2, 0xdf, 0xdb, 0x3d, 0xd8, 0xcf, 0x08, 0x3b, 0xfd, 0x1e,
+    0x18, 0x4b, 0xc8, 0x8a, 0x6d, 0xe9, 0x23, 0x8f, 0xd3, 0x21, 0xe4, 0xdc, 0x91, 0xd5, 0x0d, 0xa0,
+    0x8a, 0x82, 0x6b, 0x30, 0x20, 0x98, 0x70, 0xe3, 0x13, 0x3d, 0xa7, 0x09, 0xab, 0x2c, 0xca, 0x8f,
+    0x17, 0xdb, 0x5a, 0xef, 0x05, 0x8f, 0x46, 0xff, 0xb2, 0x59, 0xb2, 0x1a, 0x7e, 0x4c, 0x60, 0xa1,
+    0xe7, 0x76, 0x95, 0xfa, 0x2a, 0x5d, 0x68, 0x3c, 0xda, 0x82, 0xdf, 0xea, 0x2a, 0x75, 0xb4, 0xdf,
+    0x87, 0xbd, 0x48, 0x44, 0x74, 0xe9, 0xe1, 0x58, 0xe1, 0xe1, 0xca, 0x05, 0x5e, 0x6a, 0x28, 0x5b,
+    0xa3, 0x43, 0xa2, 0xb7, 0x02, 0xf7, 0x8d, 0xa1, 0x41, 0x60, 0xd9, 0x8f, 0xc9, 0xf4, 0xc6, 0xc0,
+    0x0e, 0x56, 0x0e, 0x24, 0x18, 0xa4, 0x8d, 0x05, 0xe6, 0x09, 0x27, 0xde, 0x67, 0xa6, 0xf7, 0xa6,
+    0x57, 0x6a, 0x0e, 0x0c, 0x7a, 0xe6, 0x84, 0x33, 0xd0, 0x9c, 0x8e, 0xff, 0x00, 0x91, 0xad, 0x34,
+    0x51, 0x62, 0x03, 0x03, 0xc4, 0x48, 0x52, 0x7d, 0x64, 0x1d, 0xa4, 0xef, 0x5a, 0xb4, 0xec, 0xcb,
+    0xa4, 0xad, 0x59, 0xcf, 0x79, 0x6d, 0x55, 0x59, 0x9c, 0x1c, 0xef, 0xa9, 0x6a, 0xdc, 0x84, 0xe0,
+    0x99, 0x55, 0x57, 0x54, 0xe9, 0xee, 0x9a, 0x29, 0xf1, 0x6d, 0x9a, 0xd3, 0x76, 0x49, 0x3d, 0x5e,
+    0x08, 0xac, 0x6b, 0x4a, 0x53, 0x29, 0xf6, 0x02, 0xe7, 0x65, 0x31, 0x63, 0x69, 0x6e, 0x3a, 0xfa,
+    0x68, 0xea, 0x42, 0x2c, 0xed, 0xeb, 0xd6, 0x2a, 0xa0, 0xe6, 0xa2, 0x43, 0x2d, 0x3b, 0x53, 0xa1,
+    0xf4, 0x72, 0xec, 0xb3, 0x8f, 0x6c, 0x86, 0xf1, 0x48, 0x36, 0x75, 0xca, 0xac, 0xb8, 0xbd, 0x5a,
+    0xaa, 0x4a, 0x0c, 0x86, 0x48, 0xb3, 0xae, 0x9c, 0x46, 0x35, 0xe9, 0x36, 0x2b, 0x61, 0xaa, 0x4f,
+    0xd7, 0xe6, 0x7a, 0x4a, 0x03, 0xbe, 0x17, 0x32, 0x9d, 0x2a, 0xdd, 0xca, 0xc9, 0x46, 0xbd, 0xb6,
+    0xb2, 0xf0, 0xa9, 0x40, 0xb8, 0x5b, 0x93, 0x4f, 0x8a, 0x9e, 0x15, 0xe1, 0x90, 0xb1, 0x6e, 0xbf,
+    0x68, 0x5c, 0xd0, 0xf6, 0xc0, 0x6b, 0x79, 0x95, 0x9c, 0xc6, 0xe0, 0x40, 0x85, 0x40, 0x8d, 0x5d,
+    0x2a, 0x67, 0x93, 0xf1, 0xe8, 0x79, 0x58, 0x38, 0x17, 0x79, 0x59, 0xac, 0x17, 0x19, 0x8d, 0x33,
+    0xc0, 0xb5, 0xf4, 0x39, 0xd4, 0x2d, 0xcd, 0xb4, 0x72, 0x3b, 0x5c, 0x5c, 0xbb, 0xd9, 0x3b, 0xea,
+    0x7b, 0xc3, 0xf2, 0x36, 0x4d, 0x09, 0x04, 0xb1, 0x97, 0xad, 0x79, 0x18, 0xe6, 0xf5, 0xfa, 0x47,
+    0x1b, 0x13, 0x2a, 0x8d, 0xe1, 0x3a, 0x5c, 0x95, 0x4b, 0xa5, 0xa1, 0xe5, 0xb2, 0xbc, 0xa2, 0xc6,
+    0xc9, 0xc8, 0x53, 0xa6, 0x89, 0xa6, 0xfd, 0x57, 0xf7, 0xde, 0x71, 0x1a, 0xc6, 0x1b, 0x41, 0xbe,
+    0x21, 0xf7, 0x71, 0x40, 0x43, 0x79, 0x83, 0x07, 0xf8, 0xe1, 0xa0, 0xba, 0xcc, 0xec, 0xbb, 0x61,
+    0x11, 0x4f, 0xc9, 0x1b, 0x94, 0x06, 0xb9, 0x8e, 0x35, 0xd2, 0x32, 0x7f, 0xc5, 0x11, 0xd9, 0x71,
+    0xd7, 0xec, 0x3e, 0xb4, 0x1b, 0xef, 0xe6, 0x8a, 0x6b, 0xf5, 0xde, 0xe0, 0xd2, 0x9e, 0xb5, 0xe7,
+    0x97, 0xbf, 0x3b, 0x1c, 0x82, 0x93, 0x27, 0xe4, 0x8e, 0x64, 0xb2, 0x04, 0xca, 0x3c, 0x9d, 0x9f,
+    0x6b, 0x99, 0x8f, 0x17, 0x0d, 0xad, 0xd6, 0x41, 0x97, 0x78, 0xa8, 0xac, 0x57, 0x6e, 0xa1, 0xb1,
+    0x6a, 0xa6, 0x1a, 0x5a, 0x78, 0x85, 0x29, 0x29, 0x7a, 0x9c, 0xae, 0x66, 0x3a, 0xd4, 0xd0, 0xbf,
+    0x17, 0xe3, 0x2f, 0x9b, 0xf0, 0x92, 0xed, 0x24, 0xb7, 0x8a, 0x9c, 0x8e, 0x3c, 0x4b, 0xfd, 0xdf,
+    0x1b, 0x9b, 0xaf, 0x95, 0x93, 0x66, 0x56, 0x10, 0xd3, 0x71, 0xc5, 0xf8, 0x27, 0x77, 0x49, 0x1f,
+    0x69, 0x77, 0x56, 0xb8, 0xca, 0x97, 0x05, 0x3a, 0x0c, 0x5c, 0xad, 0xe1, 0x7e, 0x5a, 0x6b, 0x83,
+    0x9e, 0x5a, 0xdb, 0x64, 0xaa, 0xd9, 0x59, 0x5b, 0x6b, 0x69, 0xde, 0xe6, 0x2d, 0xf9, 0xba, 0xb9,
+    0xb6, 0x6a, 0x78, 0xc3, 0x62, 0xa3, 0x53, 0x65, 0x1a, 0x43, 0x5e, 0xfb, 0x24, 0x6f, 0x5c, 0xd6,
+    0x6e, 0x7e, 0x04, 0xf5, 0xf2, 0xe5, 0x9b, 0x07, 0xca, 0x70, 0x81, 0xba, 0x39, 0xfa, 0xf7, 0x5f,
+    0x25, 0x7f, 0x6e, 0xbd, 0xc1, 0x6e, 0xdc, 0x2e, 0x7c, 0x16, 0xa8, 0x35, 0xd1, 0x73, 0x3f, 0x73,
+    0x29, 0xab, 0x01, 0x9f, 0xa4, 0x2c, 0x3f, 0x37, 0x68, 0x6f, 0x17, 0xb5, 0xc9, 0xf4, 0xa6, 0x13,
+    0x7d, 0x83, 0xba, 0x8d, 0xe3, 0x17, 0xde, 0xc2, 0xfb, 0x5e, 0xbd, 0xf6, 0xd6, 0xe6, 0x75, 0x6d,
+    0x77, 0x7a, 0xad, 0x0e, 0xac, 0xb4, 0xef, 0x03, 0xc0, 0x4e, 0xd1, 0xc0, 0xdf, 0xab, 0x17, 0x78,
+    0x6f, 0xfa, 0x57, 0x58, 0xc0, 0xb3, 0x38, 0x25, 0x6f, 0x76, 0x3e, 0x7e, 0x93, 0xef, 0xb1, 0xf5,
+    0xec, 0x00, 0xd4, 0x09, 0x7f, 0xb5, 0xb1, 0xad, 0x0b, 0xfb, 0xbc, 0x2e, 0xec, 0x57, 0x5f, 0xda,
+    0x37, 0x10, 0xf3, 0xf1, 0xe3, 0xf6, 0x55, 0x17, 0x33, 0xe6, 0xf2, 0xe9, 0xa5, 0x40, 0xb8, 0xbc,
+    0xfc, 0xe8, 0x49, 0xea, 0xbb, 0x15, 0xad, 0x26, 0xb4, 0x3d, 0xbd, 0x49, 0xf3, 0x0a, 0x2d, 0xd3,
+    0x28, 0x17, 0xd5, 0xf9, 0xd7, 0xbe, 0xe2, 0xa2, 0x9f, 0x97, 0x05, 0xf7, 0x32, 0x6f, 0x5d, 0xc8,
+    0x48, 0x4b, 0xcf, 0x15, 0x0e, 0xa1, 0xb3, 0x7b, 0xbe, 0x55, 0xf1, 0x2c, 0xe0, 0x20, 0xda, 0x84,
+    0x6c, 0x56, 0x55, 0xf4, 0x25, 0xd3, 0x4d, 0xac, 0x56, 0x0b, 0xdd, 0x20, 0xac, 0x43, 0x7a, 0x9a,
+    0x38, 0xe5, 0xe3, 0x72, 0x62, 0xf3, 0xf4, 0x27, 0x1b, 0x9b, 0x9a, 0x7d, 0x69, 0xe2, 0xb3, 0x94,
+    0xd7, 0xc5, 0x40, 0x36, 0x9d, 0x64, 0x17, 0x89, 0x90, 0x5e, 0x57, 0xb6, 0x52, 0x9e, 0x59, 0x21,
+    0x3f, 0x95, 0x04, 0x9c, 0x96, 0xc3, 0x1e, 0xc5, 0xb0, 0xc4, 0x03, 0x52, 0x26, 0xf1, 0xd1, 0x89,
+    0x9a, 0xd5, 0x2e, 0xde, 0x5b, 0x92, 0x66, 0x00, 0x33, 0xe5, 0xc1, 0x86, 0x34, 0x54, 0x83, 0x12,
+    0x5d, 0xd6, 0xf8, 0x21, 0x4a, 0xf6, 0x99, 0xbc, 0x33, 0xe1, 0xf8, 0xed, 0xdf, 0xd9, 0x73, 0xc2,
+    0xbe, 0xbd, 0x44, 0x66, 0x5e, 0xfe, 0x27, 0x7f, 0x9d, 0xfb, 0x38, 0xc3, 0x50, 0x16, 0xf4, 0xb0,
+    0x6f, 0x64, 0x5a, 0xc4, 0x51, 0x5b, 0x41, 0x73, 0x7b, 0xdb, 0x04, 0x4d, 0x4b, 0x19, 0x46, 0x5a,
+    0xb6, 0x9c, 0x95, 0xa4, 0xe9, 0xe8, 0x8e, 0xaa, 0xdb, 0x6a, 0x57, 0x31, 0x42, 0x05, 0xf5, 0xde,
+    0x64, 0x31, 0x1c, 0x4f, 0x26, 0xc3, 0xf1, 0x74, 0x52, 0x79, 0xa7, 0xe6, 0x17, 0x26, 0x12, 0xf0,
+    0xd9, 0x60, 0xfb, 0x4c, 0xe2, 0xb7, 0x65, 0xea, 0xdd, 0x67, 0x70, 0xe7, 0xdc, 0x1f, 0x22, 0x35,
+    0x42, 0x9a, 0x08, 0xa6, 0xaa, 0x8d, 0x2b, 0xb6, 0x8e, 0x53, 0x19, 0x56, 0xfd, 0x6d, 0x07, 0x3c,
+    0xa1, 0xe0, 0xcd, 0xec, 0xd7, 0x06, 0x40, 0x42, 0x65, 0x4d, 0x5a, 0xbd, 0x3b, 0xd5, 0xfa, 0x7e,
+    0x94, 0xe9, 0x22, 0x00, 0x1e, 0x11, 0xa2, 0x5f, 0x62, 0xea, 0xb0, 0xf5, 0xdd, 0xcd, 0x05, 0xe5,
+    0xc3, 0xc5, 0x7b, 0x36, 0x95, 0x4b, 0x78, 0xa5, 0x98, 0xe7, 0x28, 0x99, 0xda, 0x09, 0x1b, 0x21,
+    0x8e, 0xb4, 0x3d, 0x94, 0xab, 0xda, 0x1a, 0x00, 0x3e, 0xe9, 0xe4, 0xb2, 0x45, 0xad, 0xd1, 0x47,
+    0x4a, 0xc8, 0x19, 0x97, 0x5a, 0x9d, 0xdd, 0x1a, 0xb5, 0x2b, 0xad, 0x6b, 0xeb, 0x65, 0xb4, 0x85,
+    0x1c, 0x6a, 0x1d, 0x58, 0xa8, 0xee, 0xcc, 0xc6, 0xe1, 0xdd, 0x17, 0x58, 0x67, 0x02, 0x80, 0x9b,
+    0xcf, 0xfc, 0x6d, 0x79, 0xc0, 0xcb, 0xc5, 0xff, 0x01, 0x87, 0x2a, 0x2c, 0x7f, 0x38, 0x42, 0x00,
+    0x00,
+};
+
+// HTML_SCRIPT: 56465 -> 12603 bytes
+#define HTML_SCRIPT_ETAG "\"87db16e708e9a8dc\""
+static const size_t HTML_SCRIPT_GZ_LEN = 12603;
+static const uint8_t HTML_SCRIPT_GZ[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xed, 0x7d, 0x5d, 0x77, 0xdb, 0x38,
+    0x92, 0xe8, 0x7b, 0x7e, 0x05, 0xd3, 0x7b, 0x27, 0x94, 0x3a, 0xb2, 0x6c, 0xa7, 0xbb, 0xe7, 0xee,
+    0xda, 0x71, 0x72, 0x64, 0x49, 0x8e, 0x35, 0xb1, 0x25, 0x8f, 0x24, 0x77, 0x3a, 0x37, 0xed, 0xdb,
+    0x87, 0x92, 0x60, 0x9b, 0x63, 0x4a, 0xe4, 0x90, 0x94, 0x3f, 0x26, 0xe3, 0xd7, 0x7d, 0xdf, 0x73,
+    0xff, 0xe1, 0xfe, 0x92, 0x5b, 0x55, 0x00, 0x48, 0x00, 0x04, 0x29, 0xc9, 0x49, 0x7a, 0x66, 0xcf,
+    0x99, 0x7e, 0xe8, 0x58, 0x20, 0x3e, 0x0b, 0x55, 0x85, 0xaa, 0x42, 0x55, 0xe1, 0xd9, 0xb3, 0xed,
+    0x6d, 0xe7, 0xcc, 0x5b, 0x30, 0x27, 0x49, 0xbd, 0x94, 0x3d, 0x9b, 0x86, 0x8b, 0x24, 0x75, 0x3a,
+    0xdd, 0xa3, 0xd6, 0xf9, 0xc9, 0xf8, 0xb7, 0x93, 0xee, 0xd1, 0xd8, 0x39, 0x70, 0xdc, 0xed, 0xf9,
+    0x4f, 0x51, 0x18, 0xdf, 0x4c, 0xaf, 0xc3, 0x68, 0xfb, 0xda, 0x5b, 0xcc, 0x92, 0x6b, 0xef, 0x86,
+    0x25, 0xee, 0xbe, 0x51, 0x7d, 0xd8, 0x7b, 0x77, 0x5c, 0xa8, 0x7f, 0xe7, 0xc5, 0xb3, 0xd8, 0xbf,
+    0xf5, 0x17, 0x57, 0x59, 0xfd, 0xe3, 0x56, 0xbf, 0x33, 0x3a, 0x6e, 0xbd, 0xef, 0x8e, 0x7e, 0xeb,
+    0xf4, 0x86, 0x6b, 0x0c, 0xf0, 0xa1, 0xf7, 0xee, 0xa4, 0x6b, 0xab, 0x6b, 0xe9, 0x3c, 0x82, 0xc5,
+    0x24, 0x50, 0xef, 0xf3, 0x33, 0x07, 0xfe, 0x3b, 0xd9, 0x73, 0x3e, 0x43, 0x51, 0x7a, 0xbd, 0x07,
+    0x0d, 0xdd, 0x86, 0xe3, 0xa7, 0x6c, 0x9e, 0xec, 0x39, 0x9f, 0x2e, 0x1a, 0x4e, 0xc2, 0x02, 0x36,
+    0x4d, 0xd9, 0x6c, 0xcf, 0x59, 0xb0, 0x3b, 0x67, 0xc4, 0xd2, 0x5a, 0xbd, 0xe1, 0x5c, 0x86, 0xd3,
+    0x65, 0xd2, 0x9b, 0xdd, 0xef, 0x39, 0x3b, 0x0d, 0x27, 0x08, 0xbd, 0x19, 0x74, 0xbd, 0xe7, 0x5c,
+    0x7a, 0x41, 0xc2, 0x9c, 0xc7, 0x06, 0x75, 0x39, 0xfc, 0x9a, 0x5d, 0x3e, 0x7b, 0xdc, 0x7f, 0x16,
+    0xb0, 0xd4, 0xf1, 0xa6, 0xa9, 0x7f, 0xcb, 0x68, 0x23, 0x60, 0x89, 0x27, 0x2e, 0x2f, 0x4d, 0x66,
+    0xbd, 0xc5, 0x65, 0x78, 0xc2, 0xdb, 0xc0, 0x07, 0x6a, 0xc4, 0x3f, 0xc5, 0xec, 0x32, 0x66, 0xc9,
+    0x75, 0x6f, 0x71, 0x16, 0x87, 0x57, 0xf0, 0x57, 0x62, 0xfd, 0x7c, 0xc6, 0x16, 0xc5, 0xa6, 0x81,
+    0x97, 0xa4, 0x43, 0xfe, 0xbd, 0x95, 0xc2, 0xa7, 0x1d, 0x5e, 0x7c, 0xc9, 0xd2, 0xe9, 0xf5, 0x9f,
+    0x97, 0x6c, 0x89, 0x53, 0x80, 0x5e, 0xe7, 0x7e, 0xc2, 0x9a, 0x50, 0x29, 0x0c, 0x6e, 0x59, 0xad,
+    0x2e, 0xc1, 0x7b, 0xd2, 0x1b, 0x01, 0x5e, 0xf4, 0x4e, 0x7b, 0xb8, 0xd1, 0xaf, 0x76, 0x44, 0xdb,
+    0x30, 0x4a, 0x0e, 0x97, 0xc9, 0x83, 0x3e, 0xce, 0x5f, 0xb1, 0xaf, 0xc2, 0xe4, 0x79, 0x37, 0xd3,
+    0x98, 0xcd, 0xf2, 0x5d, 0xba, 0x8b, 0xbc, 0xf7, 0xec, 0x01, 0xe0, 0xe9, 0x72, 0x10, 0xdf, 0xf9,
+    0x57, 0x01, 0x3b, 0x4f, 0x58, 0x6c, 0x14, 0x8d, 0xc3, 0x1b, 0xb6, 0xc0, 0x32, 0x09, 0x36, 0x68,
+    0x28, 0x67, 0xfc, 0xe9, 0x42, 0x14, 0x61, 0xc5, 0x42, 0x61, 0xe4, 0x0d, 0x59, 0xb2, 0x0c, 0xd2,
+    0xe4, 0x18, 0xb0, 0x2b, 0xc0, 0x4f, 0x8b, 0x65, 0x10, 0x08, 0x28, 0xdf, 0xf9, 0x0b, 0x36, 0xf6,
+    0xe7, 0x2c, 0xd6, 0x8a, 0xa1, 0x4d, 0x6b, 0x99, 0x5e, 0xbf, 0x03, 0xb2, 0x18, 0x5d, 0x87, 0x77,
+    0x0b, 0x7d, 0x71, 0xe2, 0xeb, 0x08, 0xa9, 0x06, 0xb7, 0x6c, 0xd8, 0xfd, 0xf3, 0x79, 0x6f, 0xd8,
+    0xed, 0xb8, 0xda, 0xe7, 0xd3, 0x70, 0xe6, 0x05, 0x02, 0x96, 0xb6, 0xce, 0xe9, 0xfb, 0x90, 0xc3,
+    0x38, 0xfb, 0xce, 0x21, 0xd4, 0xed, 0xf4, 0xc6, 0xbf, 0x9d, 0xb6, 0x7e, 0xf9, 0xed, 0xf0, 0xe3,
+    0xb8, 0x3b, 0x22, 0x60, 0xff, 0xf8, 0xef, 0xbc, 0x31, 0x9b, 0xf9, 0xe9, 0x19, 0x20, 0x20, 0x8e,
+    0xeb, 0xe6, 0x45, 0x1d, 0x3f, 0x4e, 0x8d, 0x2d, 0xc0, 0xe2, 0x92, 0x1d, 0x38, 0x19, 0xbc, 0xc3,
+    0xee, 0xa1, 0xf8, 0x27, 0x81, 0x16, 0xe1, 0xd5, 0xe1, 0xf2, 0xf2, 0x92, 0xa0, 0x80, 0x70, 0x7b,
+    0x76, 0xb9, 0x5c, 0x00, 0x56, 0x86, 0x0b, 0xbe, 0x91, 0xb3, 0x23, 0xc4, 0x8f, 0xda, 0x32, 0x0e,
+    0x1a, 0xb0, 0xdd, 0x58, 0x9e, 0xd4, 0xc5, 0xf6, 0xf1, 0x0e, 0xe3, 0x25, 0x82, 0xa8, 0x56, 0x77,
+    0x0e, 0xde, 0x70, 0x5c, 0xd2, 0xeb, 0xee, 0x2b, 0x55, 0x23, 0x9c, 0x4c, 0x86, 0x6e, 0xcd, 0xf4,
+    0x9a, 0x2d, 0x6a, 0xd0, 0xbc, 0x81, 0x7d, 0x88, 0x8a, 0x1a, 0x36, 0x46, 0xcd, 0xa9, 0x87, 0x1d,
+    0xf2, 0xce, 0x3f, 0x3f, 0x8a, 0x3a, 0x31, 0x4b, 0x97, 0xf1, 0xc2, 0x89, 0xf6, 0x9f, 0x3d, 0x3e,
+    0x43, 0x3e, 0xd6, 0x5b, 0xf8, 0xa9, 0xef, 0x05, 0xfe, 0xdf, 0xd8, 0xb3, 0x19, 0x10, 0xdd, 0x9c,
+    0x2d, 0xd2, 0xa6, 0x37, 0x9b, 0x75, 0x6f, 0xe1, 0x8f, 0x13, 0x3f, 0x49, 0xd9, 0x82, 0xc5, 0x35,
+    0xb7, 0x33, 0x38, 0x6d, 0x87, 0x8b, 0x14, 0xcb, 0x00, 0x32, 0x6c, 0x06, 0x24, 0x2c, 0xfa, 0xa5,
+    0x4e, 0x2b, 0x5a, 0xde, 0xb0, 0x87, 0x19, 0x20, 0x02, 0x34, 0xb8, 0x26, 0x2c, 0x7a, 0xcf, 0x7f,
+    0x8b, 0xd9, 0x4c, 0xc2, 0x30, 0x4d, 0xd2, 0xd8, 0x8b, 0x90, 0x58, 0x70, 0x8a, 0xcf, 0xbc, 0xe4,
+    0x61, 0x31, 0x75, 0x32, 0x30, 0x2a, 0x15, 0xc4, 0x58, 0xde, 0x9d, 0xe7, 0xa7, 0xc4, 0x13, 0x60,
+    0x46, 0x97, 0xfe, 0xd5, 0x11, 0x60, 0x4a, 0x87, 0xdd, 0xfa, 0x53, 0x22, 0x38, 0xbd, 0x06, 0xf2,
+    0x86, 0x1a, 0x70, 0x86, 0x86, 0xc6, 0x9d, 0x4b, 0xaa, 0x0d, 0x95, 0x6a, 0xc4, 0x95, 0x0b, 0xf5,
+    0x46, 0x1d, 0x64, 0x2d, 0xc5, 0x61, 0x46, 0x48, 0x0c, 0xb2, 0xd8, 0xbf, 0x74, 0x6a, 0xcf, 0x73,
+    0xf2, 0x90, 0xd3, 0xc6, 0xff, 0x34, 0xa2, 0x49, 0x58, 0xda, 0x03, 0x88, 0xc6, 0xb7, 0x5e, 0x50,
+    0xcb, 0x3a, 0x69, 0x38, 0xbb, 0x3f, 0xed, 0xec, 0xec, 0x88, 0xae, 0x1e, 0x79, 0x87, 0xb0, 0x43,
+    0x1f, 0x22, 0xef, 0xcc, 0x9f, 0xde, 0x00, 0x40, 0x0b, 0x83, 0xd3, 0x7e, 0x27, 0x59, 0xf9, 0x6c,
+    0x36, 0x7a, 0x48, 0x4e, 0xc2, 0xab, 0x9a, 0xdb, 0x1e, 0x9c, 0x9e, 0xc2, 0xa1, 0xd1, 0x1d, 0x3a,
+    0x83, 0xfe, 0x49, 0xaf, 0xdf, 0x75, 0xeb, 0xb4, 0xe7, 0x19, 0x68, 0x61, 0x02, 0xad, 0x8c, 0x83,
+    0xd6, 0xfc, 0x59, 0x06, 0x60, 0x95, 0xad, 0xfa, 0xb3, 0x7d, 0x7d, 0x87, 0xaf, 0x58, 0xda, 0x0d,
+    0x18, 0xfe, 0x79, 0xf8, 0xd0, 0x9b, 0xd5, 0x5c, 0x3c, 0x3a, 0x4e, 0xdc, 0x7a, 0x73, 0x0a, 0x1c,
+    0x32, 0xc1, 0x6d, 0x6f, 0xa6, 0xe1, 0x15, 0x70, 0x93, 0x9a, 0xcb, 0xfb, 0x41, 0x66, 0x3f, 0x73,
+    0x0e, 0x0e, 0x88, 0x43, 0xd7, 0xd7, 0xe8, 0x6c, 0xb8, 0x5e, 0x67, 0x43, 0xb1, 0x1c, 0x03, 0x5f,
+    0xec, 0x78, 0x21, 0x69, 0x0e, 0x19, 0x68, 0x93, 0x33, 0x4e, 0xc1, 0x07, 0x94, 0x62, 0xc9, 0x3f,
+    0xed, 0x5f, 0x88, 0x8d, 0x2a, 0x9f, 0xd2, 0xf8, 0x41, 0xd9, 0x59, 0x4e, 0xa2, 0x29, 0xbb, 0xc7,
+    0xb3, 0x81, 0xef, 0x0d, 0x11, 0x23, 0x9f, 0xc0, 0x18, 0xca, 0x6b, 0xda, 0x19, 0x3c, 0xa5, 0x29,
+    0x6e, 0xcb, 0xdf, 0x4d, 0xfc, 0x2d, 0xa1, 0x23, 0x91, 0x08, 0x7b, 0x53, 0xb1, 0x27, 0x1f, 0x67,
+    0x7a, 0x89, 0x9c, 0xe9, 0x4f, 0xa3, 0x41, 0xbf, 0x19, 0x79, 0x71, 0xc2, 0x78, 0xd5, 0x7d, 0xad,
+    0x26, 0xf6, 0x80, 0xf5, 0x5e, 0xbc, 0xc0, 0xea, 0xb0, 0x86, 0x4b, 0xdf, 0xec, 0xcc, 0x02, 0x92,
+    0x9a, 0xac, 0x8b, 0x45, 0x23, 0x36, 0xc5, 0xd2, 0xbf, 0xff, 0x1d, 0x16, 0x5d, 0x6f, 0xa6, 0xb1,
+    0x3f, 0xaf, 0x19, 0x83, 0xd8, 0xa1, 0xa7, 0x74, 0x82, 0xa5, 0xad, 0xc8, 0xef, 0x7b, 0x73, 0xb6,
+    0x41, 0x3f, 0x12, 0xd6, 0xc5, 0x8e, 0xf8, 0x97, 0x8a, 0x9e, 0x1e, 0x9f, 0xe9, 0x7f, 0x3d, 0x3a,
+    0x9c, 0x0b, 0x32, 0x75, 0xf1, 0xc0, 0xf6, 0x6e, 0x18, 0x8b, 0x9c, 0x19, 0xbb, 0xf4, 0xf0, 0x7c,
+    0x53, 0x88, 0x6d, 0x19, 0xcd, 0xe0, 0x70, 0x6a, 0xe3, 0x5c, 0xf0, 0x98, 0x5a, 0x12, 0x61, 0xa9,
+    0x54, 0x63, 0xa9, 0xa0, 0x71, 0x74, 0x80, 0x1b, 0xcc, 0x5c, 0x03, 0xeb, 0x5b, 0x40, 0xfd, 0x41,
+    0xab, 0x03, 0xe7, 0x9c, 0x03, 0xe7, 0xf0, 0x69, 0x6f, 0x34, 0xea, 0xf5, 0xdf, 0xb9, 0x2a, 0x6f,
+    0xa7, 0xe5, 0xd1, 0x82, 0x0d, 0x60, 0xe2, 0xee, 0x19, 0x70, 0xa9, 0xaf, 0xd3, 0x5f, 0xe4, 0x75,
+    0x03, 0xe8, 0xaf, 0x94, 0xd0, 0xa0, 0xc2, 0x29, 0x4b, 0x3d, 0xb7, 0x5e, 0x98, 0xc5, 0x8a, 0x76,
+    0x58, 0x45, 0x6d, 0x89, 0x68, 0x46, 0xa3, 0xa9, 0xf0, 0xa5, 0x82, 0x26, 0x22, 0xa5, 0x38, 0x34,
+    0x90, 0x6e, 0xde, 0x77, 0x3f, 0xc2, 0x6c, 0x9d, 0x97, 0xf8, 0x55, 0x63, 0x6f, 0xd8, 0x03, 0x1f,
+    0xb9, 0x2e, 0xa7, 0x60, 0xb6, 0x6d, 0x83, 0x90, 0x30, 0x12, 0xad, 0xb1, 0x46, 0x81, 0x91, 0x7d,
+    0x50, 0x24, 0x8b, 0x1a, 0x49, 0xe5, 0xf5, 0x5c, 0x4c, 0x52, 0x65, 0x0e, 0xfa, 0xb6, 0xbf, 0xde,
+    0x56, 0x43, 0xbf, 0x03, 0x2e, 0xa3, 0xd5, 0x26, 0xf0, 0x3f, 0xd9, 0x63, 0x2e, 0xb7, 0x61, 0xa9,
+    0x0a, 0x40, 0x9f, 0xc4, 0xb3, 0x4f, 0xee, 0x24, 0x5d, 0xc0, 0x84, 0x46, 0xc0, 0x98, 0x80, 0x61,
+    0x89, 0x5f, 0x83, 0x88, 0x2d, 0xe4, 0x2f, 0x5c, 0x02, 0x7d, 0xbd, 0x10, 0x40, 0x84, 0x0d, 0xbe,
+    0x0c, 0xe3, 0xae, 0x07, 0x88, 0x8a, 0xfc, 0xed, 0x4d, 0x81, 0xb3, 0xb0, 0xaa, 0x5d, 0x01, 0xd6,
+    0xad, 0x73, 0x0e, 0x06, 0x90, 0x64, 0x41, 0x73, 0xe6, 0x27, 0xde, 0x24, 0x60, 0x33, 0x6d, 0xa6,
+    0x8f, 0x75, 0x03, 0x51, 0xf0, 0x5c, 0x59, 0x81, 0x2a, 0x58, 0xc5, 0xd8, 0x70, 0x2c, 0xaa, 0xcb,
+    0xe6, 0xc5, 0x91, 0x54, 0x30, 0xc2, 0xca, 0xe6, 0x1e, 0xc8, 0x0d, 0x57, 0x27, 0x78, 0x4a, 0x26,
+    0xe1, 0x32, 0x9e, 0xc2, 0x39, 0x37, 0x4f, 0xae, 0x74, 0xc2, 0x49, 0x11, 0x76, 0xa8, 0x02, 0x74,
+    0x70, 0x0f, 0x81, 0xba, 0x41, 0x86, 0x9f, 0x7a, 0x01, 0x9d, 0x97, 0x23, 0x20, 0xf5, 0xc5, 0x55,
+    0x4d, 0x17, 0x61, 0xa0, 0xc1, 0x4b, 0x40, 0x89, 0x4f, 0x88, 0x15, 0xbc, 0x57, 0xfc, 0x7d, 0x41,
+    0x58, 0x02, 0xbd, 0xeb, 0x93, 0x88, 0x41, 0xa8, 0x67, 0x31, 0x4c, 0x02, 0xb0, 0x0a, 0x24, 0x47,
+    0x66, 0x50, 0x2d, 0xc8, 0x71, 0x55, 0x30, 0x08, 0xb2, 0x76, 0x2a, 0x18, 0x9e, 0x43, 0x71, 0x5d,
+    0xcc, 0x86, 0x97, 0x42, 0x81, 0x81, 0xba, 0x99, 0x80, 0xd8, 0x0c, 0xd8, 0xe2, 0x0a, 0xc4, 0xcf,
+    0xb7, 0x4a, 0xd1, 0x5f, 0x42, 0x7f, 0x51, 0x73, 0x7f, 0x5d, 0xb8, 0x75, 0x24, 0xe4, 0xfe, 0x00,
+    0xe5, 0xcb, 0x91, 0xab, 0x4f, 0x3c, 0x5a, 0x26, 0xd7, 0x78, 0x9c, 0x97, 0xc2, 0x2d, 0xf0, 0xe9,
+    0xa0, 0x2e, 0x87, 0x72, 0x36, 0x35, 0x31, 0x2a, 0xf6, 0x58, 0xc3, 0x56, 0xe2, 0xcb, 0xdd, 0xb5,
+    0x0f, 0xcc, 0xa7, 0x56, 0x98, 0xe9, 0x1b, 0x29, 0xee, 0xaa, 0xa4, 0x9d, 0xd7, 0x4a, 0xae, 0xfd,
+    0xcb, 0xb4, 0xa6, 0x49, 0x2a, 0x40, 0x30, 0x82, 0x92, 0xdc, 0xb2, 0x5d, 0xc9, 0xb6, 0xd0, 0xdc,
+    0x0e, 0x83, 0xf4, 0x40, 0x79, 0xb0, 0x6c, 0x96, 0xad, 0x59, 0x0e, 0x89, 0x39, 0x2a, 0x06, 0x2b,
+    0xb6, 0x91, 0x94, 0x07, 0x75, 0x13, 0xa9, 0x51, 0x9d, 0xb7, 0x6d, 0x26, 0xe9, 0x43, 0xc0, 0x10,
+    0x9b, 0xa3, 0xc0, 0x23, 0x09, 0xe1, 0x32, 0x60, 0xf7, 0xc6, 0x86, 0x5c, 0xfb, 0x33, 0x56, 0x8a,
+    0x47, 0xdf, 0x60, 0x0a, 0x8b, 0x70, 0xc1, 0x8c, 0x29, 0x80, 0x90, 0x07, 0x1c, 0x05, 0xb1, 0x42,
+    0xc1, 0x06, 0x89, 0x28, 0xee, 0x87, 0xb3, 0x96, 0x2b, 0x77, 0xde, 0x6c, 0x85, 0x9c, 0xa7, 0xb4,
+    0x1d, 0x1a, 0x0c, 0xca, 0x5a, 0x0a, 0xa1, 0xd2, 0xd6, 0x6e, 0xf4, 0x71, 0xa4, 0xb6, 0xb2, 0x08,
+    0x64, 0x52, 0x6e, 0x16, 0x2d, 0x71, 0xcd, 0x9a, 0x96, 0xae, 0x13, 0x91, 0xa9, 0xc0, 0xa7, 0xf1,
+    0x92, 0x95, 0xcb, 0x5c, 0x71, 0x26, 0x70, 0xa9, 0x1a, 0x97, 0xbb, 0xed, 0x45, 0xfe, 0x76, 0x02,
+    0x3d, 0x5c, 0x86, 0xaa, 0x5c, 0xc5, 0xdb, 0xcc, 0xb2, 0x36, 0x40, 0x83, 0x49, 0xb8, 0xa8, 0x15,
+    0x6a, 0x44, 0x53, 0x24, 0xde, 0x5a, 0x6d, 0xd6, 0x5c, 0x26, 0xc0, 0xd6, 0xb6, 0x9d, 0x19, 0xf0,
+    0xa3, 0x14, 0x77, 0xe9, 0x7b, 0x67, 0x17, 0xe4, 0x73, 0xf8, 0x75, 0xe4, 0xdf, 0xb3, 0x59, 0x6d,
+    0xa7, 0xd0, 0x14, 0x1b, 0x00, 0xbf, 0xca, 0x48, 0x72, 0x04, 0xaa, 0x95, 0xec, 0x07, 0x1b, 0xbf,
+    0xfa, 0xb1, 0xd0, 0x84, 0xba, 0xb6, 0xb4, 0xa1, 0xf2, 0x62, 0xa3, 0x52, 0xe4, 0xe2, 0x90, 0x43,
+    0xc9, 0x48, 0xe3, 0x41, 0x72, 0x46, 0xc8, 0x2d, 0xb7, 0x89, 0x10, 0xb3, 0x01, 0xb1, 0xa8, 0x86,
+    0x25, 0xb8, 0x60, 0xf8, 0xf1, 0x87, 0xba, 0x9b, 0x8f, 0xc3, 0x0f, 0xc8, 0x56, 0x10, 0x1c, 0x81,
+    0x12, 0xc6, 0xe2, 0x8e, 0x9f, 0xdc, 0xd4, 0x44, 0x5f, 0x8d, 0xac, 0x8b, 0x06, 0x36, 0x95, 0x5c,
+    0xc0, 0x26, 0x6c, 0x6d, 0x3a, 0x5b, 0xe4, 0x83, 0xa3, 0x4e, 0xd3, 0x21, 0x76, 0x38, 0x18, 0x37,
+    0x57, 0x4c, 0xc8, 0xdd, 0xda, 0xc2, 0x63, 0x95, 0xff, 0xff, 0xad, 0x9b, 0xcd, 0xe4, 0xd2, 0x5f,
+    0x78, 0x41, 0xa0, 0xe2, 0x4b, 0x89, 0x61, 0x88, 0xb3, 0xaf, 0xe2, 0x81, 0xd5, 0x5f, 0xce, 0x27,
+    0xa0, 0x6f, 0x81, 0x7a, 0xb6, 0xcc, 0xd6, 0xa3, 0x23, 0xa0, 0x38, 0x87, 0xd4, 0x8a, 0x28, 0x9a,
+    0xee, 0xe4, 0x67, 0x97, 0x38, 0xb7, 0x5c, 0xb6, 0xd8, 0x3a, 0x1f, 0xb9, 0x3a, 0x94, 0x1c, 0x1d,
+    0x4c, 0xa2, 0x33, 0xd1, 0x42, 0xe9, 0xcc, 0x36, 0x43, 0xce, 0x07, 0x49, 0x63, 0x3c, 0x66, 0xa0,
+    0x8f, 0xc7, 0x35, 0x00, 0x8c, 0xa7, 0xd2, 0xd7, 0x73, 0x5e, 0xa0, 0xd2, 0x55, 0x7e, 0x5c, 0xec,
+    0x56, 0x71, 0x28, 0x52, 0x52, 0xf1, 0x10, 0xd9, 0xd5, 0xa5, 0x43, 0x6c, 0xf8, 0x6a, 0xad, 0x86,
+    0xaf, 0xf4, 0x43, 0x92, 0x06, 0x84, 0xa5, 0xd0, 0x5f, 0xaf, 0xf2, 0x39, 0xa9, 0x7d, 0xb3, 0x5b,
+    0x2e, 0xe1, 0xc0, 0xa4, 0x9b, 0xfc, 0x07, 0xae, 0x5d, 0x1d, 0x3e, 0xf5, 0x53, 0x12, 0x91, 0xa9,
+    0x0a, 0xff, 0x81, 0x6a, 0x40, 0x7f, 0xc7, 0xe9, 0xfc, 0x38, 0x6e, 0xb9, 0x85, 0xaa, 0xa7, 0x5e,
+    0x7c, 0xa3, 0x55, 0x1f, 0xdc, 0xb2, 0x38, 0x06, 0xde, 0x8d, 0xe2, 0xf3, 0xf7, 0x24, 0x39, 0x6b,
+    0x8d, 0x48, 0xe5, 0x24, 0x3d, 0x45, 0x34, 0xca, 0x0b, 0xf8, 0x38, 0xa0, 0x40, 0xab, 0xf5, 0xef,
+    0xa3, 0x31, 0x51, 0xa7, 0xa8, 0x2d, 0x7f, 0x9a, 0xd3, 0xbe, 0x8f, 0x14, 0x5b, 0xa3, 0xa8, 0x99,
+    0x95, 0x98, 0x95, 0x41, 0xfe, 0x3b, 0x5f, 0x04, 0x21, 0xe8, 0xf9, 0xc8, 0xa1, 0x68, 0x4f, 0x9b,
+    0x5a, 0x19, 0x28, 0xbe, 0x4b, 0xd8, 0x79, 0xc0, 0x6d, 0x36, 0x43, 0x3d, 0x60, 0x07, 0x96, 0x61,
+    0xd6, 0x32, 0x3a, 0x94, 0xb3, 0xcc, 0x7a, 0x13, 0x05, 0x55, 0x5d, 0x51, 0x15, 0xb1, 0x41, 0xb4,
+    0x7d, 0x06, 0x89, 0x66, 0x48, 0xeb, 0x9e, 0xfc, 0x8c, 0xcc, 0x83, 0xef, 0x18, 0xf2, 0x12, 0x62,
+    0x2e, 0xb4, 0x39, 0x2f, 0x95, 0x6d, 0x78, 0x99, 0x37, 0x70, 0xfe, 0xee, 0x8c, 0x77, 0x7f, 0x18,
+    0x52, 0xc5, 0x1c, 0xc2, 0x7a, 0x85, 0x5f, 0xce, 0xe8, 0xb3, 0x46, 0x86, 0x02, 0xbe, 0xf5, 0x9c,
+    0x63, 0x29, 0x70, 0xe4, 0x8c, 0xcb, 0xe8, 0xe5, 0xf0, 0xc7, 0xce, 0xbb, 0x1f, 0x46, 0xd4, 0x93,
+    0x0a, 0xc3, 0x97, 0x68, 0x80, 0xe6, 0x65, 0xea, 0x32, 0x15, 0x0d, 0xe8, 0x67, 0x2f, 0x40, 0x21,
+    0xdc, 0x79, 0x4e, 0x34, 0xd4, 0xcc, 0xcb, 0x54, 0xc8, 0xc6, 0xde, 0x22, 0x43, 0x2f, 0xaa, 0x31,
+    0xc4, 0x02, 0x73, 0x43, 0x51, 0x77, 0xd5, 0x6a, 0x7d, 0xc0, 0x02, 0xb3, 0xd6, 0x94, 0x05, 0x81,
+    0x56, 0xab, 0x8d, 0x05, 0x66, 0xad, 0x49, 0xaa, 0xd5, 0x39, 0x4c, 0x0b, 0x35, 0xe6, 0x61, 0x38,
+    0x1b, 0x3f, 0x44, 0x2c, 0xdb, 0xed, 0xac, 0x00, 0x31, 0xf8, 0xf0, 0xfc, 0xe8, 0x08, 0x99, 0x6d,
+    0x78, 0x1e, 0x45, 0x2c, 0x6e, 0x7b, 0x49, 0x41, 0x7a, 0x0a, 0x67, 0x72, 0x04, 0xfa, 0x5b, 0xa0,
+    0xfd, 0x0f, 0xae, 0x59, 0xeb, 0xc4, 0x9b, 0x10, 0xb5, 0xd6, 0xf2, 0x01, 0x0f, 0x88, 0x6f, 0xa3,
+    0x8d, 0x09, 0xc9, 0x0b, 0x87, 0xda, 0x73, 0xa8, 0x2d, 0x60, 0x55, 0x5e, 0x0d, 0x60, 0xcf, 0x95,
+    0x38, 0x2c, 0xa9, 0x0b, 0xc8, 0x67, 0xfa, 0x1f, 0xc1, 0x58, 0x93, 0x35, 0x91, 0x5f, 0x98, 0xa7,
+    0xc3, 0x87, 0xdd, 0x77, 0x27, 0x3f, 0x38, 0xff, 0x86, 0xbd, 0xd0, 0x1e, 0xbc, 0xa4, 0xcd, 0xfe,
+    0xb0, 0xc7, 0x75, 0x43, 0x80, 0x2e, 0x16, 0xb4, 0xe9, 0x27, 0xc1, 0x15, 0x7f, 0x1e, 0xd2, 0xcf,
+    0x49, 0x2a, 0x2a, 0xcb, 0x19, 0xd0, 0x3a, 0x24, 0x4f, 0x66, 0x78, 0xb5, 0xb0, 0xd6, 0xd8, 0xfd,
+    0xed, 0x56, 0x49, 0x27, 0x65, 0xe2, 0x0f, 0x37, 0x0f, 0x5a, 0xcf, 0x90, 0x35, 0x84, 0x18, 0x6c,
+    0x6d, 0xda, 0x86, 0x9e, 0xc7, 0xcd, 0xf0, 0x46, 0x67, 0xef, 0x8a, 0x78, 0x03, 0x5b, 0x58, 0x21,
+    0xe1, 0x94, 0x1c, 0x1e, 0x55, 0x87, 0xd3, 0xf6, 0xb6, 0xe3, 0x5f, 0x2d, 0xc2, 0x98, 0x55, 0xae,
+    0x53, 0xd8, 0x11, 0x1b, 0x74, 0xd1, 0xa3, 0xcb, 0xc5, 0x11, 0xb7, 0x26, 0xd2, 0x3d, 0xd3, 0x27,
+    0x7f, 0x76, 0x91, 0x9f, 0x0f, 0x58, 0xd4, 0x0c, 0x6c, 0x72, 0xa0, 0xfa, 0x45, 0x13, 0x03, 0xe9,
+    0x43, 0xc4, 0x6d, 0xf9, 0xf8, 0x8f, 0x52, 0x2a, 0x2f, 0x93, 0x80, 0x7b, 0x33, 0x2f, 0x33, 0x96,
+    0xd2, 0x27, 0x79, 0xa5, 0xc4, 0x2f, 0x6f, 0xb0, 0x78, 0x95, 0x2d, 0x32, 0xbd, 0xc6, 0x4d, 0x06,
+    0x9c, 0x34, 0xf0, 0x80, 0x86, 0x46, 0xea, 0xd8, 0x76, 0xf5, 0x03, 0x32, 0x49, 0x2b, 0x45, 0x7f,
+    0xf8, 0x2e, 0x3a, 0x14, 0x2a, 0x19, 0x1a, 0x38, 0xfd, 0xc5, 0x82, 0xc5, 0xc7, 0xe3, 0xd3, 0x13,
+    0x44, 0xb0, 0xd7, 0x33, 0xff, 0xd6, 0x21, 0x0d, 0xe0, 0xe0, 0xbb, 0x08, 0xa4, 0x6e, 0xbc, 0xf5,
+    0x7a, 0xb5, 0x13, 0xdd, 0xef, 0x87, 0x91, 0x37, 0xf5, 0xd3, 0x87, 0xbd, 0x9d, 0xe6, 0x4f, 0xdf,
+    0xbd, 0xf9, 0x8b, 0x37, 0xbd, 0x41, 0x98, 0xf8, 0x8b, 0x66, 0xb3, 0xf9, 0x7a, 0x1b, 0xda, 0xbc,
+    0x71, 0x95, 0x15, 0x6d, 0x8a, 0x60, 0x41, 0xf2, 0x76, 0xe6, 0xc7, 0x07, 0x38, 0x35, 0xb6, 0x98,
+    0x86, 0x33, 0x76, 0x3e, 0xec, 0xb5, 0xc3, 0x79, 0x04, 0x7a, 0xc7, 0x22, 0xad, 0xf1, 0xbd, 0x04,
+    0xc2, 0x79, 0x71, 0xb9, 0x0c, 0x82, 0x83, 0xdd, 0x17, 0x81, 0x3f, 0xf7, 0x53, 0xaa, 0x9d, 0x5f,
+    0x6b, 0x15, 0x24, 0x5a, 0xba, 0xdf, 0xab, 0xc0, 0x41, 0x15, 0xb3, 0x46, 0x61, 0x9c, 0xc2, 0xd9,
+    0xe3, 0xc7, 0xb0, 0x73, 0x61, 0xec, 0xb3, 0x04, 0x64, 0xb7, 0x38, 0x49, 0x41, 0xc4, 0xbc, 0x66,
+    0xa0, 0x7b, 0x04, 0xd1, 0x35, 0x90, 0x58, 0xea, 0x4f, 0x51, 0x9c, 0xcb, 0xda, 0xd1, 0x96, 0xca,
+    0x51, 0x3e, 0x5d, 0xd8, 0x7b, 0x3e, 0xf3, 0x62, 0xdc, 0x31, 0xd9, 0xf5, 0x03, 0xac, 0x0f, 0x80,
+    0xa3, 0x11, 0x12, 0xed, 0xe5, 0x73, 0x64, 0x5f, 0xdb, 0xae, 0x69, 0x1f, 0xcd, 0xc7, 0xe0, 0x3a,
+    0xf3, 0x67, 0x67, 0x01, 0x87, 0x15, 0x70, 0xb0, 0x66, 0x13, 0x0d, 0xd1, 0x49, 0xc7, 0x8f, 0xf7,
+    0x08, 0x2d, 0xf1, 0x07, 0x1f, 0x4b, 0xfe, 0x4e, 0x40, 0x80, 0xdf, 0x83, 0x33, 0xf5, 0x51, 0x59,
+    0xf3, 0xa3, 0x75, 0x8e, 0x9d, 0x7c, 0xdd, 0xf9, 0xc4, 0x68, 0xcc, 0x4b, 0x3f, 0x00, 0x21, 0xb7,
+    0xe6, 0xa3, 0x3d, 0xc8, 0x6f, 0xd2, 0x70, 0xf5, 0x66, 0x02, 0xc0, 0xaa, 0xd5, 0xbc, 0xc6, 0x84,
+    0x6e, 0x5f, 0xbc, 0x26, 0xce, 0x08, 0x88, 0x04, 0x85, 0x4d, 0xdc, 0x33, 0x98, 0x44, 0x6d, 0x42,
+    0x85, 0xf5, 0xba, 0xb6, 0x96, 0xdc, 0xbe, 0x84, 0xed, 0xcc, 0x95, 0xf9, 0xf5, 0x92, 0xbd, 0x39,
+    0xf2, 0x83, 0xca, 0x79, 0x3d, 0xff, 0x87, 0x4c, 0x8c, 0x73, 0x30, 0x79, 0x6d, 0x51, 0xa1, 0x7b,
+    0x3c, 0x95, 0xc2, 0x90, 0xeb, 0x80, 0x7e, 0x00, 0x8b, 0x9f, 0x69, 0xf4, 0x65, 0x53, 0x2b, 0x0c,
+    0x36, 0xa5, 0x68, 0x15, 0xb9, 0xca, 0x32, 0x22, 0xb6, 0x04, 0x7c, 0x92, 0xf4, 0xe0, 0x7c, 0xce,
+    0x16, 0xa1, 0xde, 0xb8, 0x8c, 0xa9, 0x62, 0x9f, 0x4f, 0x64, 0x3b, 0x3a, 0xeb, 0xe5, 0xc0, 0x16,
+    0x26, 0x1f, 0x3c, 0xc7, 0x77, 0xbe, 0x18, 0x80, 0x3f, 0xee, 0x23, 0xbf, 0xdc, 0x82, 0xe3, 0xfc,
+    0x6a, 0xb1, 0x37, 0x65, 0x78, 0xc9, 0xf5, 0xdd, 0x9b, 0xdb, 0xd0, 0xd7, 0x61, 0x99, 0x43, 0x07,
+    0x97, 0xcc, 0x35, 0x3a, 0xdd, 0x94, 0xa9, 0x1e, 0x06, 0x8f, 0xf9, 0xd4, 0xf1, 0xde, 0xf5, 0x3a,
+    0x9d, 0x07, 0xca, 0x65, 0x8c, 0xb2, 0x12, 0x89, 0x4e, 0x35, 0xfc, 0x89, 0xd7, 0x45, 0xf7, 0x75,
+    0x9b, 0x41, 0xd5, 0x4f, 0x46, 0x24, 0xc3, 0xe8, 0xa7, 0xc6, 0xb5, 0x97, 0xd4, 0xb0, 0x45, 0x81,
+    0x9d, 0x25, 0x47, 0x78, 0x7a, 0xa0, 0xcc, 0xe3, 0xe3, 0x09, 0x72, 0x70, 0x60, 0x9c, 0x29, 0x2f,
+    0x5e, 0x68, 0xd7, 0x66, 0x07, 0x07, 0x8e, 0xb6, 0x12, 0xa9, 0x62, 0x24, 0x64, 0x53, 0x02, 0xb4,
+    0xda, 0xc2, 0xd9, 0xe1, 0xae, 0xd4, 0xf8, 0x44, 0x40, 0x68, 0xca, 0x1c, 0x21, 0xb8, 0x6e, 0x52,
+    0xe7, 0x1f, 0xf9, 0xb8, 0xf8, 0x99, 0xc6, 0xca, 0xbe, 0xda, 0xc9, 0xf5, 0xb4, 0xbd, 0x45, 0x5b,
+    0xe3, 0x44, 0x31, 0x48, 0xf6, 0xf7, 0x7b, 0xa0, 0xee, 0x03, 0x3c, 0x90, 0x01, 0x26, 0x0d, 0xe7,
+    0x7b, 0xfa, 0x9b, 0xdd, 0xb3, 0xe9, 0x32, 0x45, 0x6b, 0x2d, 0x14, 0x25, 0xb0, 0x67, 0x8c, 0x8a,
+    0x63, 0x76, 0xb5, 0x0c, 0xbc, 0xd8, 0xb9, 0xd4, 0x08, 0x1e, 0x41, 0xcd, 0xbb, 0xc2, 0x89, 0x3b,
+    0xca, 0xce, 0xe5, 0x5f, 0xda, 0xca, 0xaa, 0x44, 0x5d, 0xfc, 0xdb, 0xa8, 0x8b, 0x94, 0xaf, 0xd6,
+    0xc4, 0xdf, 0xae, 0x2e, 0xd3, 0x20, 0x48, 0x04, 0x37, 0x31, 0x19, 0x71, 0x36, 0x85, 0x6d, 0x77,
+    0xdf, 0xf2, 0xc5, 0x32, 0x05, 0x58, 0xb2, 0x51, 0xd5, 0x36, 0x03, 0xa3, 0x9a, 0x90, 0x02, 0x69,
+    0x32, 0x49, 0x37, 0x03, 0x14, 0x9f, 0x19, 0xe7, 0x5d, 0xa5, 0x33, 0xfb, 0x7e, 0xdd, 0x99, 0xe1,
+    0x06, 0xac, 0x33, 0x35, 0xa3, 0x9e, 0xfd, 0xf4, 0x40, 0x43, 0x11, 0x60, 0x57, 0xb0, 0x9c, 0x2f,
+    0xf6, 0x9c, 0xf3, 0xb3, 0xad, 0x2d, 0xf4, 0xf7, 0xc1, 0xfd, 0x8c, 0xe8, 0x38, 0x6a, 0x38, 0x6c,
+    0x1e, 0xa5, 0x0f, 0x0a, 0x12, 0xe0, 0xc1, 0x44, 0x3f, 0x8b, 0x1b, 0x4d, 0x9f, 0x72, 0x9a, 0x32,
+    0xb6, 0x85, 0x9f, 0x6f, 0xe6, 0xfa, 0x65, 0x1b, 0x31, 0xb4, 0x1d, 0x96, 0xcf, 0xcb, 0x77, 0x56,
+    0xb4, 0x57, 0xac, 0x5e, 0x54, 0x17, 0x8b, 0x57, 0x9e, 0x9c, 0x78, 0x31, 0x90, 0xad, 0x1d, 0x48,
+    0xc3, 0x99, 0xa7, 0x58, 0x02, 0x23, 0x7a, 0xb7, 0xc0, 0xba, 0x71, 0xe7, 0x4c, 0x3b, 0x9b, 0x4f,
+    0xea, 0xbd, 0xb6, 0x22, 0xa4, 0x2d, 0xd2, 0x52, 0xa8, 0x94, 0x77, 0xf1, 0x56, 0x4c, 0xe8, 0x14,
+    0x7f, 0x29, 0x1f, 0xea, 0xa5, 0xb4, 0x47, 0xfc, 0xe8, 0xa5, 0x64, 0x8f, 0xa4, 0xd8, 0x1e, 0x7c,
+    0xc7, 0x75, 0x5c, 0x52, 0x4f, 0xbf, 0x23, 0xa1, 0x7c, 0x0b, 0x98, 0x07, 0x2f, 0x46, 0x2e, 0x92,
+    0x17, 0x23, 0x2f, 0x91, 0xe5, 0x54, 0xac, 0xc0, 0x31, 0xeb, 0xd9, 0x09, 0x17, 0xd3, 0xc0, 0x9f,
+    0xde, 0x1c, 0x7c, 0x07, 0xc7, 0x08, 0x4c, 0xa9, 0x8d, 0x3f, 0x6a, 0x0c, 0xbd, 0x2d, 0x1a, 0x4a,
+    0x97, 0x8d, 0x5f, 0xdd, 0xbc, 0xa3, 0x5f, 0xdd, 0x7a, 0x59, 0x5f, 0xb3, 0x49, 0xa0, 0x75, 0xd7,
+    0x99, 0x04, 0xbc, 0xc7, 0xaa, 0xbe, 0xde, 0xd8, 0x3a, 0x33, 0x97, 0x9c, 0x63, 0x3e, 0x2e, 0xe5,
+    0x4d, 0x5e, 0x84, 0xbf, 0x0b, 0x47, 0x40, 0x69, 0x37, 0x92, 0x28, 0xb2, 0x4e, 0x58, 0x32, 0xf5,
+    0x22, 0x76, 0x0c, 0xf5, 0x15, 0x82, 0x5c, 0xbf, 0x4f, 0xa2, 0x2c, 0x44, 0x2c, 0xde, 0x1b, 0x61,
+    0xde, 0x66, 0x8d, 0x11, 0x05, 0x78, 0x63, 0xc2, 0x92, 0xea, 0xc6, 0x9a, 0xd8, 0x50, 0x26, 0xf0,
+    0x63, 0x75, 0xe5, 0x50, 0x46, 0x82, 0x9e, 0xc6, 0x21, 0x68, 0xad, 0x82, 0xd9, 0x13, 0xaa, 0x82,
+    0x9c, 0x9f, 0x86, 0xce, 0xad, 0xcf, 0xee, 0x94, 0x53, 0x5f, 0x56, 0x38, 0xe0, 0x9d, 0x82, 0x54,
+    0x1f, 0x3f, 0x70, 0x29, 0x23, 0x8c, 0x6b, 0x6e, 0x53, 0x1e, 0x16, 0x8a, 0x21, 0x4e, 0x14, 0xd5,
+    0x65, 0xd3, 0x66, 0x42, 0x43, 0xf5, 0xa0, 0xf3, 0x9f, 0xa1, 0x6f, 0x90, 0x6e, 0x27, 0x68, 0x22,
+    0x01, 0x0c, 0x5f, 0x80, 0xea, 0xc4, 0x50, 0x68, 0x78, 0x54, 0x25, 0x06, 0xfb, 0x59, 0xad, 0x0a,
+    0x30, 0x1a, 0xcf, 0xe4, 0xbb, 0xa3, 0x18, 0x24, 0x79, 0x81, 0x30, 0x73, 0x2a, 0x52, 0x92, 0xbc,
+    0x80, 0xbb, 0xe3, 0xae, 0x64, 0x28, 0x36, 0xa2, 0xf9, 0xf4, 0x4e, 0xb7, 0x51, 0x88, 0x76, 0x54,
+    0xad, 0x09, 0x82, 0x52, 0xf2, 0xc1, 0x4f, 0x41, 0x81, 0x69, 0x26, 0xd7, 0x70, 0x52, 0x82, 0x2e,
+    0x56, 0xf8, 0x00, 0xec, 0xb3, 0xe4, 0xcb, 0xc4, 0x4b, 0x4b, 0xbe, 0x44, 0x0f, 0xa6, 0x8f, 0x8c,
+    0xca, 0x07, 0xd2, 0x44, 0x5b, 0x0f, 0xfe, 0x14, 0xb3, 0xd2, 0x2d, 0x89, 0x33, 0xf5, 0x1e, 0x33,
+    0x4d, 0xf8, 0x8d, 0xc1, 0x8e, 0x61, 0x6b, 0x59, 0xd0, 0x45, 0xf1, 0x9f, 0xbc, 0x85, 0xdb, 0x70,
+    0x8f, 0xd8, 0x04, 0xfe, 0x7f, 0xea, 0xc5, 0xf0, 0xff, 0x56, 0x14, 0xd3, 0xdf, 0x0f, 0xf0, 0xff,
+    0x3f, 0x2d, 0x17, 0xf4, 0xff, 0x00, 0xcb, 0x97, 0x57, 0xf0, 0xff, 0x11, 0x8b, 0xe0, 0xff, 0x83,
+    0x69, 0x0a, 0xff, 0xef, 0x87, 0xb7, 0xf0, 0xff, 0x0e, 0x1c, 0x12, 0x17, 0x9f, 0x66, 0x28, 0xf5,
+    0x9d, 0x82, 0x82, 0x7a, 0x5d, 0xab, 0x6b, 0xc2, 0xe1, 0x8c, 0xee, 0x90, 0x84, 0x51, 0x99, 0x6a,
+    0xf1, 0xdb, 0xd5, 0x3a, 0xe8, 0xcf, 0xb3, 0x51, 0xea, 0x81, 0xcc, 0xfe, 0xaa, 0x81, 0x27, 0xbb,
+    0x36, 0xbd, 0xeb, 0x6b, 0xa3, 0xd1, 0x71, 0xb8, 0x8c, 0x93, 0x42, 0xab, 0x1d, 0xbd, 0xd5, 0x7c,
+    0x6e, 0xb4, 0x3a, 0xf5, 0x17, 0xcb, 0x94, 0x55, 0xb4, 0x13, 0xe0, 0x43, 0x68, 0x48, 0xe3, 0x21,
+    0x4e, 0x58, 0xfe, 0x0d, 0xd3, 0x40, 0x8b, 0x11, 0x59, 0x5a, 0xe6, 0x36, 0x2f, 0x0c, 0x1d, 0x19,
+    0xd7, 0x96, 0x98, 0x2f, 0xa9, 0x89, 0x70, 0x06, 0x2c, 0x95, 0x9b, 0xf3, 0x5a, 0x9a, 0xf4, 0xac,
+    0x76, 0x81, 0x17, 0x10, 0xab, 0xbb, 0xc0, 0x5a, 0x5a, 0x17, 0x9c, 0x1a, 0x65, 0xef, 0xea, 0x91,
+    0x98, 0x97, 0x16, 0x4c, 0x0e, 0xd2, 0xe4, 0xa1, 0xda, 0x1d, 0x1e, 0x9f, 0x65, 0x4a, 0x24, 0x4c,
+    0x04, 0xef, 0xba, 0x80, 0x06, 0x05, 0x6c, 0x66, 0x20, 0x4f, 0x82, 0x10, 0x00, 0x7f, 0x81, 0xb6,
+    0x72, 0xeb, 0x7b, 0xca, 0x45, 0x9c, 0x05, 0x92, 0x6b, 0x5d, 0xf2, 0x68, 0x00, 0x9e, 0x41, 0xc5,
+    0x31, 0xf7, 0x77, 0x52, 0xee, 0x97, 0xb6, 0xd7, 0xbb, 0x5d, 0x32, 0x81, 0x78, 0xb2, 0x1e, 0x14,
+    0x4f, 0xdc, 0x92, 0x4d, 0x18, 0xae, 0xd7, 0x7e, 0xe8, 0x16, 0x76, 0x80, 0xba, 0xad, 0xab, 0x53,
+    0x31, 0x20, 0x2f, 0xd7, 0x69, 0x6b, 0x38, 0x54, 0x1b, 0x0e, 0x4b, 0x1b, 0xaa, 0xe0, 0x2e, 0x9e,
+    0xdd, 0x78, 0xd8, 0x36, 0x68, 0x83, 0x7b, 0x19, 0x0e, 0xeb, 0xae, 0x79, 0xe2, 0x5b, 0xae, 0xea,
+    0x24, 0x9f, 0x78, 0xd1, 0x85, 0x6a, 0xd4, 0x82, 0x6e, 0x0c, 0xfd, 0x8e, 0xfa, 0x6f, 0x4e, 0xd3,
+    0x38, 0x10, 0x6e, 0x5c, 0xbc, 0x60, 0xce, 0x52, 0x74, 0x4b, 0x52, 0xf1, 0x8e, 0x7b, 0xd9, 0xf1,
+    0xf3, 0x43, 0x0c, 0xc7, 0x55, 0x27, 0xcd, 0x3a, 0x9a, 0xf7, 0x49, 0x77, 0xff, 0x46, 0x1f, 0x80,
+    0x86, 0x43, 0x6f, 0x71, 0xc5, 0x84, 0x1e, 0xe3, 0x2c, 0x42, 0xd0, 0x9b, 0xe6, 0x11, 0xdf, 0x09,
+    0x40, 0x47, 0x14, 0x3a, 0x13, 0x2c, 0xf0, 0x51, 0x4d, 0xdc, 0x70, 0xe8, 0xcf, 0x36, 0xdd, 0x5f,
+    0x83, 0xcb, 0xa3, 0x05, 0xcc, 0x99, 0x4c, 0x63, 0x01, 0xb1, 0x85, 0x4d, 0x08, 0xa0, 0x6a, 0x1e,
+    0x3d, 0x78, 0xfe, 0x1e, 0x28, 0xfa, 0x25, 0xf0, 0x92, 0xfb, 0x0b, 0x03, 0xce, 0xa5, 0x12, 0xb2,
+    0x1c, 0x23, 0x36, 0x88, 0xb8, 0x99, 0x2c, 0x27, 0x09, 0x67, 0x94, 0x3b, 0x0d, 0xa5, 0x18, 0x9d,
+    0xcc, 0x7b, 0xb0, 0xbc, 0xfb, 0xc1, 0x65, 0x0d, 0xed, 0x51, 0x75, 0x8d, 0xda, 0xb9, 0xfb, 0x85,
+    0x30, 0xb3, 0x4a, 0x48, 0xf1, 0xce, 0x8b, 0xfb, 0x64, 0x17, 0xb9, 0xf9, 0x84, 0xe0, 0x70, 0x12,
+    0xcc, 0xaf, 0xa6, 0x98, 0x52, 0xb9, 0x0d, 0x4c, 0x8a, 0xc3, 0xd9, 0x87, 0x7a, 0x46, 0xd6, 0x99,
+    0xd0, 0x55, 0x31, 0x1d, 0xd1, 0x75, 0xd9, 0xe6, 0xa1, 0xe7, 0x2f, 0xb6, 0x41, 0xb3, 0x92, 0x6d,
+    0xb3, 0xb5, 0x3d, 0x2c, 0xc5, 0x8c, 0xaf, 0xb6, 0x83, 0x96, 0xcd, 0x13, 0x36, 0x07, 0xc4, 0xe6,
+    0x36, 0x1c, 0xce, 0xa9, 0xc4, 0xe6, 0x28, 0x33, 0x25, 0x5a, 0x6c, 0x28, 0x05, 0xfb, 0x41, 0xdd,
+    0xb4, 0x0f, 0x65, 0x35, 0x66, 0xf0, 0x47, 0xca, 0x6a, 0x15, 0x08, 0xae, 0xd7, 0xf7, 0x66, 0x33,
+    0xb5, 0xf2, 0xb3, 0x2a, 0x12, 0xb0, 0xd9, 0x9a, 0xb2, 0x0a, 0x45, 0x9e, 0x5f, 0x30, 0x4a, 0x89,
+    0x49, 0xa0, 0x14, 0x2a, 0x3f, 0xf1, 0x43, 0x65, 0x11, 0xde, 0x91, 0x47, 0x0e, 0xfe, 0x24, 0x0f,
+    0xba, 0x65, 0xe2, 0x4c, 0xbc, 0x18, 0x7e, 0x25, 0x29, 0xf3, 0x66, 0x4e, 0x78, 0x09, 0x73, 0x9a,
+    0x87, 0xb7, 0x40, 0xe5, 0xb4, 0x1d, 0x8c, 0x13, 0x7d, 0xb2, 0xe6, 0x79, 0x3c, 0x0d, 0x97, 0x39,
+    0x7d, 0x64, 0x2b, 0x47, 0x01, 0x3d, 0xdf, 0x26, 0x5e, 0xe7, 0x8d, 0x6e, 0x9d, 0x32, 0xfd, 0x8d,
+    0x78, 0x25, 0x3c, 0x75, 0x46, 0xdd, 0x93, 0x6e, 0x7b, 0xdc, 0xed, 0x5c, 0x38, 0x7f, 0x77, 0xfe,
+    0xfb, 0x3f, 0xff, 0xeb, 0xbf, 0xff, 0xf3, 0xff, 0x39, 0xfd, 0xd6, 0xcf, 0xf0, 0x63, 0x74, 0xd6,
+    0x6a, 0x77, 0xf1, 0x33, 0xfc, 0xdd, 0xed, 0x8f, 0xbb, 0x43, 0xa7, 0xfb, 0x4b, 0xb7, 0x8d, 0xb7,
+    0x92, 0xad, 0x43, 0xe7, 0xe8, 0xa4, 0x77, 0xe6, 0x5a, 0x71, 0xd1, 0xf0, 0xc1, 0xd6, 0x30, 0xd0,
+    0x5f, 0x44, 0xcb, 0x74, 0x43, 0x0f, 0xba, 0xe7, 0xd4, 0x48, 0xbf, 0xef, 0xa0, 0x22, 0x8b, 0x07,
+    0xfd, 0xf4, 0x1a, 0xd9, 0xaa, 0xdb, 0x70, 0xf8, 0x95, 0x4b, 0xcd, 0x6a, 0xcf, 0x42, 0x05, 0x05,
+    0x0f, 0x01, 0xea, 0x83, 0x74, 0x7b, 0xb4, 0x49, 0x29, 0x3f, 0x3f, 0xed, 0x5c, 0x00, 0x6d, 0x1b,
+    0x05, 0x7b, 0x22, 0x7a, 0x42, 0xd5, 0xf7, 0xf1, 0x63, 0x41, 0x4d, 0xcf, 0x3d, 0x21, 0xd1, 0xbe,
+    0x6d, 0xf8, 0xdc, 0x72, 0x23, 0xbf, 0x17, 0x45, 0xc1, 0x03, 0xc0, 0x28, 0x61, 0x53, 0x11, 0x36,
+    0x42, 0x54, 0x4e, 0xdd, 0xed, 0x97, 0xf5, 0x46, 0x7a, 0x80, 0x55, 0xd3, 0xe7, 0x33, 0xe5, 0x7e,
+    0x10, 0xb9, 0x51, 0xe2, 0xd1, 0xe2, 0x27, 0xf6, 0x41, 0x09, 0x0b, 0xd1, 0x7c, 0x8c, 0x2c, 0xf1,
+    0x24, 0x99, 0xc8, 0x6e, 0xf9, 0xb6, 0xaf, 0xfa, 0x8b, 0x9a, 0x41, 0x28, 0x20, 0xcf, 0x8b, 0x5f,
+    0xb5, 0x58, 0x86, 0x9e, 0xbc, 0xd1, 0x5d, 0x5e, 0x2d, 0xb1, 0x29, 0xa2, 0xaa, 0x69, 0x08, 0x5c,
+    0xe9, 0x25, 0xa6, 0xf6, 0x66, 0x5e, 0xfd, 0xad, 0xe5, 0xb0, 0xa6, 0x6a, 0x9d, 0x55, 0x2b, 0x56,
+    0x61, 0x39, 0x0d, 0xc2, 0x84, 0x69, 0xc0, 0x8c, 0x69, 0x1f, 0x37, 0xf4, 0x70, 0xb3, 0xcd, 0x7d,
+    0x6d, 0x2f, 0x37, 0xdb, 0xd6, 0x09, 0x70, 0x16, 0xcf, 0xb1, 0x6c, 0x23, 0x6c, 0xd0, 0xdf, 0x5f,
+    0xb1, 0x35, 0x3a, 0xe2, 0xcb, 0x90, 0x2d, 0xb1, 0x62, 0x95, 0xdb, 0x56, 0x45, 0x25, 0x69, 0x22,
+    0x47, 0xc4, 0x16, 0x02, 0x7a, 0x63, 0x6f, 0xa2, 0x21, 0xe2, 0x73, 0xd5, 0x1d, 0x5c, 0x5d, 0x47,
+    0xee, 0xc8, 0xe7, 0xb6, 0xce, 0xc7, 0xc7, 0xce, 0xe1, 0xc9, 0xa0, 0xfd, 0xbe, 0xdb, 0xd9, 0x73,
+    0xde, 0x77, 0x3f, 0x3a, 0xc2, 0xb1, 0xdb, 0xe9, 0xf5, 0x9d, 0xed, 0xb3, 0xc1, 0xf0, 0x7d, 0xfb,
+    0x78, 0x70, 0xd6, 0x6c, 0x0f, 0xfa, 0x47, 0x6e, 0xa5, 0x8d, 0x5c, 0x78, 0xa1, 0xc5, 0x64, 0x1f,
+    0xbf, 0x4e, 0xd3, 0x28, 0xd9, 0xdb, 0xde, 0x86, 0xa1, 0xb7, 0x80, 0x30, 0x01, 0xee, 0xc0, 0x63,
+    0x6f, 0x9b, 0x61, 0x7c, 0xb5, 0xfd, 0x16, 0x84, 0x90, 0xb9, 0x9f, 0xbe, 0xb8, 0x61, 0x0f, 0x65,
+    0x77, 0x7f, 0xda, 0xb4, 0x05, 0x79, 0xf8, 0x0b, 0x38, 0xc4, 0x9b, 0xb8, 0x58, 0x1e, 0xaa, 0xe4,
+    0xfe, 0x36, 0x09, 0xbc, 0x45, 0xc6, 0xdc, 0xcc, 0x15, 0x21, 0x5b, 0x1d, 0x9c, 0x75, 0xfb, 0xdd,
+    0x8e, 0xa9, 0x5a, 0xf3, 0x70, 0x20, 0x01, 0xb1, 0x16, 0x95, 0xd5, 0x3c, 0xfa, 0x47, 0x05, 0x1d,
+    0x2f, 0xe1, 0xd2, 0x89, 0x07, 0x15, 0xb5, 0x4b, 0x3a, 0x13, 0xe4, 0x1a, 0x18, 0x0a, 0xd8, 0x2c,
+    0x3a, 0xb7, 0x39, 0x29, 0xb2, 0x45, 0xb2, 0x8c, 0x65, 0x6d, 0x0c, 0x5e, 0xab, 0x45, 0x3c, 0x08,
+    0xb0, 0x8d, 0x27, 0x8a, 0x3a, 0x1f, 0xb5, 0xdc, 0x79, 0x7d, 0xe0, 0xec, 0xa0, 0x88, 0x66, 0x46,
+    0xbd, 0x65, 0x5c, 0x26, 0xbf, 0xb3, 0xce, 0x30, 0x16, 0xd0, 0x2b, 0xbb, 0x17, 0x2d, 0x72, 0xaf,
+    0x9c, 0x02, 0x64, 0xd5, 0x6c, 0xe1, 0x38, 0x90, 0x5a, 0x18, 0xc5, 0xe1, 0x94, 0xa1, 0x89, 0xa7,
+    0xc8, 0x85, 0xd4, 0xf0, 0xbb, 0x7c, 0x0a, 0x82, 0xf5, 0x6a, 0xae, 0xf2, 0x6e, 0x6b, 0x34, 0x3a,
+    0x3f, 0xe5, 0x9b, 0xa3, 0x32, 0x99, 0x55, 0x03, 0x59, 0xb6, 0x7a, 0xcf, 0x39, 0x1b, 0x0e, 0xda,
+    0xdd, 0x6e, 0xc7, 0x69, 0xf5, 0x3f, 0x7e, 0x68, 0x7d, 0x74, 0xad, 0x6c, 0xbd, 0x00, 0x98, 0xcc,
+    0x73, 0x58, 0x9f, 0x57, 0x16, 0x1a, 0xa8, 0x33, 0x31, 0x61, 0x37, 0xb2, 0xfb, 0x1f, 0xc8, 0x48,
+    0x28, 0x65, 0xbb, 0xd4, 0x70, 0x4a, 0xfd, 0xb4, 0x35, 0x02, 0x2d, 0xcb, 0x9c, 0x4c, 0x95, 0x60,
+    0x49, 0xbe, 0x67, 0x93, 0xa5, 0x1f, 0xe0, 0xba, 0xa9, 0x54, 0xbd, 0xd2, 0xd6, 0x62, 0x28, 0xd5,
+    0xba, 0x59, 0x79, 0xd1, 0x09, 0xc3, 0xd6, 0x8f, 0xf8, 0x52, 0x68, 0x65, 0xf7, 0xcc, 0x50, 0xe2,
+    0xbd, 0xfe, 0x7c, 0xde, 0x3d, 0xef, 0x3a, 0x18, 0x19, 0xe2, 0x1c, 0xb5, 0x7a, 0x27, 0xc8, 0x46,
+    0xc8, 0xa2, 0xc2, 0x92, 0x69, 0xec, 0x4f, 0x58, 0x37, 0x8e, 0xc3, 0x18, 0x1a, 0x57, 0x78, 0x48,
+    0xda, 0x83, 0x4f, 0x4b, 0x5d, 0x3e, 0x40, 0x42, 0x01, 0xfd, 0xa2, 0xa6, 0x7a, 0x7b, 0xfc, 0x63,
+    0x7d, 0x0f, 0x0a, 0x9e, 0x31, 0x9a, 0x67, 0xc0, 0x7a, 0x9e, 0x09, 0xa2, 0x61, 0x2b, 0x8e, 0xbd,
+    0x07, 0xd0, 0x0b, 0xe8, 0x5f, 0x52, 0x12, 0x12, 0x74, 0x6d, 0xe2, 0xad, 0xf7, 0xb2, 0x7e, 0x2b,
+    0x7d, 0x39, 0xb3, 0x4a, 0xba, 0xc8, 0x02, 0x8a, 0x5f, 0xd4, 0xbd, 0x07, 0xe1, 0x2e, 0x41, 0x96,
+    0xa7, 0xda, 0x49, 0x85, 0x65, 0x25, 0x4c, 0xa5, 0x21, 0x54, 0x53, 0x08, 0x9b, 0x06, 0x2d, 0x60,
+    0x3d, 0x10, 0x88, 0x61, 0x56, 0x54, 0x57, 0xd3, 0x29, 0xe1, 0x1b, 0x5e, 0x56, 0x70, 0x6d, 0x4d,
+    0x0b, 0x27, 0xc0, 0x78, 0xb1, 0xf3, 0x28, 0xa0, 0x28, 0x4e, 0x54, 0xd5, 0x12, 0x2d, 0xce, 0x8c,
+    0xcf, 0x20, 0x24, 0x79, 0x36, 0x0b, 0xc7, 0x16, 0x74, 0x01, 0xd5, 0x9a, 0x70, 0x5e, 0xfb, 0x69,
+    0x6d, 0xfb, 0xd7, 0xf8, 0xed, 0xaf, 0x8b, 0xed, 0x7a, 0x76, 0xd9, 0xca, 0x63, 0x10, 0x8a, 0x52,
+    0x29, 0x46, 0x68, 0xcd, 0x85, 0x95, 0x1a, 0x64, 0x7b, 0x33, 0x60, 0x8b, 0xa2, 0xdc, 0x78, 0x95,
+    0x3a, 0x0e, 0x4a, 0xda, 0x8e, 0x2c, 0xb0, 0x0a, 0x31, 0x50, 0xa9, 0x62, 0x3d, 0x87, 0x49, 0xe2,
+    0xcf, 0xfe, 0xd1, 0x0b, 0x7a, 0x9e, 0xad, 0xc8, 0xee, 0x9d, 0x35, 0xc1, 0x49, 0xe2, 0x6c, 0xd0,
+    0xb4, 0x8c, 0x71, 0xb7, 0x34, 0x6b, 0x63, 0xd9, 0xb2, 0x33, 0xaa, 0x9c, 0x05, 0x64, 0x1c, 0x38,
+    0xbb, 0xaf, 0x72, 0x40, 0xd1, 0xb7, 0x4d, 0xc0, 0xa4, 0x09, 0xe7, 0xa7, 0x5e, 0x54, 0x09, 0xa8,
+    0x53, 0x1e, 0x93, 0xfb, 0x3b, 0x00, 0x0a, 0x0f, 0x36, 0xf1, 0x27, 0xca, 0x27, 0x71, 0x2a, 0xcc,
+    0xf1, 0xff, 0x86, 0x06, 0x10, 0x13, 0x86, 0x0a, 0xca, 0x68, 0x95, 0x3f, 0x9c, 0xb5, 0xbe, 0x77,
+    0xeb, 0xf6, 0x70, 0x49, 0xa4, 0xa2, 0x76, 0x18, 0x84, 0xfc, 0x38, 0xe4, 0x6d, 0x35, 0xca, 0xda,
+    0x73, 0x2d, 0xc1, 0x93, 0x79, 0xab, 0xd7, 0xe4, 0x14, 0x61, 0xce, 0x44, 0x31, 0x97, 0x7b, 0xc9,
+    0xb5, 0xd2, 0xb5, 0x46, 0x88, 0x59, 0x2f, 0x75, 0x5b, 0x4b, 0xd8, 0x90, 0xc4, 0xda, 0x32, 0x1f,
+    0xfc, 0xa5, 0xb3, 0x6b, 0x8f, 0x74, 0xcc, 0x8c, 0x4b, 0x14, 0x38, 0x85, 0x73, 0x10, 0x7b, 0xe4,
+    0x7e, 0x6f, 0x5b, 0x0e, 0x55, 0x54, 0x30, 0xe9, 0x8f, 0xd6, 0x68, 0xd0, 0x2a, 0x0c, 0xa5, 0x1e,
+    0x3e, 0xfd, 0x70, 0x21, 0xc2, 0x2f, 0x8b, 0x11, 0x9c, 0x05, 0x84, 0x7d, 0x4d, 0xf8, 0x6a, 0x03,
+    0x5c, 0x3e, 0x18, 0xd6, 0x3f, 0x66, 0xf7, 0xa4, 0xfe, 0x63, 0xff, 0x3f, 0x89, 0xfe, 0xab, 0xea,
+    0xa3, 0xfa, 0xc1, 0xf0, 0xb4, 0x80, 0x86, 0x20, 0x23, 0x77, 0x6a, 0xa2, 0x13, 0xcb, 0x9c, 0x90,
+    0x58, 0x40, 0xb8, 0xe0, 0xf3, 0x6a, 0x38, 0x9f, 0x1d, 0xfe, 0x2f, 0x01, 0xfe, 0xb1, 0x34, 0x76,
+    0xd4, 0x94, 0xac, 0xf5, 0xaf, 0x52, 0xe3, 0x8e, 0xc9, 0xf1, 0x46, 0x6e, 0x9e, 0x6f, 0xc5, 0xa6,
+    0x1c, 0x03, 0xd7, 0x42, 0x3e, 0xae, 0x80, 0x63, 0xc7, 0x52, 0xb6, 0xa4, 0xa6, 0xf0, 0x83, 0x4a,
+    0x9f, 0xc6, 0x53, 0x74, 0x8c, 0xe4, 0x1d, 0x55, 0xf1, 0x19, 0xfb, 0xb6, 0x69, 0xe0, 0x2f, 0xf6,
+    0xcc, 0x67, 0x0d, 0xd8, 0xca, 0x71, 0xbe, 0x88, 0xb3, 0x6b, 0x60, 0xbc, 0x1d, 0xd9, 0xd7, 0xd9,
+    0xc2, 0x55, 0xfc, 0x4f, 0x47, 0x97, 0x6b, 0x76, 0xaf, 0xa9, 0x67, 0xf0, 0x1b, 0x41, 0x0d, 0xff,
+    0xe4, 0x20, 0x78, 0x65, 0x94, 0xfc, 0x01, 0x4a, 0x9e, 0x1f, 0x28, 0x9c, 0x20, 0xc3, 0x51, 0xca,
+    0xe5, 0x41, 0x7c, 0x53, 0x96, 0xa0, 0xa9, 0xbb, 0x86, 0xc5, 0x3e, 0x39, 0x9b, 0xc2, 0x3f, 0xaf,
+    0x95, 0xae, 0xf0, 0xf7, 0xcb, 0x03, 0xe7, 0x55, 0x51, 0xa1, 0x9d, 0x3c, 0xa4, 0xdc, 0x48, 0x06,
+    0xcc, 0xba, 0x07, 0xf2, 0x0f, 0xb6, 0xe1, 0x10, 0xaa, 0xf9, 0x0d, 0x68, 0xd0, 0x70, 0x76, 0xff,
+    0x68, 0x6c, 0x9c, 0x9f, 0xf4, 0xbd, 0x7e, 0x0d, 0x1b, 0xd6, 0x0b, 0x13, 0xcb, 0x36, 0x97, 0xba,
+    0xe5, 0x73, 0x87, 0x81, 0x52, 0x7f, 0xa1, 0xaa, 0x04, 0x59, 0x8d, 0xd7, 0xce, 0x0f, 0xb4, 0x68,
+    0xfa, 0xf1, 0x06, 0x70, 0xa0, 0xc0, 0x22, 0x70, 0x95, 0x78, 0xb9, 0xdd, 0x2c, 0xfa, 0x79, 0x58,
+    0x2b, 0xf2, 0xcb, 0xc0, 0xe6, 0x25, 0x68, 0xcd, 0xed, 0x6b, 0x2f, 0x6e, 0xc3, 0x16, 0xf0, 0xa9,
+    0x9a, 0x54, 0xf5, 0x68, 0x6c, 0x5e, 0x86, 0x03, 0x45, 0xa9, 0xd3, 0x90, 0xbf, 0xb5, 0xd3, 0xeb,
+    0x13, 0x89, 0x67, 0x0d, 0x67, 0x29, 0xe4, 0x01, 0xbc, 0x7e, 0x69, 0x08, 0xa5, 0x29, 0xc1, 0x1f,
+    0x17, 0x99, 0xe0, 0x27, 0x73, 0xb5, 0x80, 0x04, 0x5c, 0xfb, 0xa4, 0xb9, 0xbb, 0xa1, 0x48, 0xab,
+    0x27, 0xdb, 0xa9, 0x37, 0xf2, 0x0b, 0xba, 0xaa, 0xa0, 0x7e, 0xa1, 0x64, 0xe3, 0xbf, 0xf0, 0xcf,
+    0x6f, 0x72, 0x16, 0xcd, 0xf4, 0x3e, 0x75, 0x9f, 0xd8, 0x87, 0x98, 0x3b, 0xef, 0x82, 0x7a, 0xb8,
+    0xd0, 0xae, 0xc0, 0xe4, 0x18, 0x20, 0xd6, 0x48, 0xc4, 0x31, 0x84, 0x21, 0x15, 0x16, 0xf5, 0xa2,
+    0x2e, 0x8a, 0x72, 0x80, 0x6c, 0x59, 0x90, 0x0f, 0x14, 0xc8, 0x69, 0x4d, 0xff, 0xaa, 0x64, 0x8a,
+    0xc9, 0xf0, 0x5d, 0x31, 0xb7, 0x87, 0x97, 0x8e, 0x90, 0x98, 0x3f, 0xeb, 0x27, 0x3e, 0x7d, 0x05,
+    0x14, 0x53, 0x6f, 0x27, 0xec, 0x18, 0xf9, 0x3c, 0xbb, 0x6d, 0xa0, 0xd0, 0xa1, 0xec, 0x97, 0xee,
+    0x1b, 0xa0, 0x5d, 0xde, 0x4f, 0xbd, 0x08, 0x25, 0x80, 0x62, 0x7f, 0x48, 0x89, 0x13, 0x2f, 0xe1,
+    0xe1, 0xdf, 0x9a, 0xf0, 0x9d, 0xfb, 0x91, 0x18, 0xf4, 0x00, 0xb5, 0x95, 0xbe, 0x7f, 0xbb, 0x4e,
+    0xb0, 0x67, 0xd1, 0x07, 0x7d, 0xd4, 0x58, 0x2a, 0x95, 0x08, 0x3e, 0xb1, 0xe5, 0xfc, 0x50, 0xb7,
+    0xb2, 0x67, 0x9e, 0x60, 0xc1, 0xe0, 0xd0, 0xd8, 0xb2, 0x50, 0x3d, 0xb3, 0x12, 0xe4, 0x5b, 0x84,
+    0x56, 0xb6, 0x9a, 0xec, 0xa6, 0x5e, 0xc2, 0x94, 0x6b, 0x42, 0xa7, 0x61, 0xde, 0xec, 0x58, 0xe6,
+    0x83, 0x22, 0x7e, 0x47, 0xa3, 0xd0, 0x65, 0x92, 0x54, 0xec, 0xdf, 0x8a, 0xbe, 0x9b, 0xd4, 0xd4,
+    0xf0, 0x6a, 0xd2, 0x38, 0xb5, 0xd9, 0x80, 0x8a, 0xf7, 0x34, 0x1e, 0x43, 0xce, 0x63, 0xfc, 0x56,
+    0x00, 0xb3, 0x7c, 0x0c, 0xda, 0xad, 0x13, 0xd7, 0x72, 0xbc, 0x20, 0x00, 0x5e, 0xbc, 0x70, 0xa4,
+    0x51, 0x31, 0x6f, 0xd1, 0x1e, 0xb6, 0xd0, 0xea, 0xa5, 0xb4, 0xc9, 0xae, 0xb1, 0xd4, 0x86, 0x0a,
+    0xae, 0xd3, 0x45, 0x4b, 0x06, 0x0e, 0xb5, 0xaf, 0xf3, 0x33, 0x91, 0x1a, 0x61, 0x5f, 0xd7, 0x6a,
+    0x85, 0x07, 0xb7, 0xe1, 0xdf, 0x8d, 0xf9, 0xa8, 0x8c, 0xc4, 0x5a, 0x85, 0xdb, 0xae, 0x46, 0xc1,
+    0x55, 0x6f, 0xaf, 0xec, 0xa3, 0x9c, 0x91, 0x5e, 0x8a, 0x85, 0x7b, 0x7c, 0x8f, 0x28, 0xa4, 0x66,
+    0xd0, 0x6f, 0x9d, 0x76, 0x9d, 0xc3, 0xe1, 0xc0, 0x6d, 0x18, 0xd3, 0x49, 0x12, 0xa3, 0x25, 0x2d,
+    0x2b, 0xe7, 0x95, 0x9a, 0x81, 0x8b, 0x2f, 0x4b, 0xba, 0x5d, 0x3b, 0x6b, 0xf8, 0x5d, 0x6b, 0x47,
+    0x24, 0x35, 0x2f, 0x67, 0xb0, 0x8a, 0xf9, 0x61, 0x25, 0x8b, 0x5d, 0x97, 0xab, 0x66, 0x19, 0xc9,
+    0xd6, 0x66, 0x86, 0x38, 0x0b, 0xfe, 0x7f, 0x83, 0x9b, 0x6e, 0xc6, 0x0a, 0xb9, 0x9e, 0x5b, 0xca,
+    0x09, 0xff, 0x29, 0xd9, 0x19, 0xad, 0xba, 0x39, 0x4d, 0x6e, 0xed, 0x3c, 0x4d, 0xd2, 0x28, 0x5d,
+    0xe3, 0xe6, 0xa9, 0xde, 0x2a, 0xee, 0x6a, 0x05, 0xab, 0x90, 0x94, 0x52, 0x33, 0xc9, 0x89, 0x1b,
+    0x5b, 0x60, 0x76, 0xe6, 0x07, 0xd5, 0xfb, 0xf5, 0xad, 0x42, 0x61, 0xc8, 0x05, 0x4c, 0x62, 0x97,
+    0x17, 0xcc, 0x69, 0x6e, 0x62, 0xa1, 0x4b, 0x39, 0xc2, 0xa7, 0x3e, 0x4b, 0xef, 0x60, 0x6b, 0xc5,
+    0x50, 0x76, 0x02, 0xa5, 0x25, 0x35, 0x0a, 0x64, 0x46, 0x5d, 0x36, 0xe4, 0xec, 0x7f, 0x1f, 0x42,
+    0xb0, 0xf3, 0xd1, 0x7e, 0xc1, 0x5e, 0x23, 0x36, 0xa1, 0x84, 0x8f, 0xc8, 0x36, 0x58, 0x40, 0xb8,
+    0xab, 0x45, 0xaa, 0x56, 0x25, 0x0c, 0x52, 0xa0, 0xc4, 0xd5, 0x65, 0xd2, 0xd6, 0xad, 0x2e, 0x67,
+    0x22, 0x07, 0x84, 0x55, 0x51, 0x07, 0xbd, 0xa4, 0x16, 0x20, 0x48, 0x02, 0x21, 0x55, 0x19, 0x1e,
+    0x75, 0xd8, 0xf4, 0xad, 0xaa, 0xa5, 0x0b, 0xee, 0xae, 0xdb, 0xac, 0x10, 0xee, 0x6d, 0xf4, 0x85,
+    0x3c, 0x0a, 0xe3, 0x1a, 0xff, 0xa9, 0x85, 0xf3, 0x0b, 0xb4, 0x3a, 0x50, 0xd8, 0x79, 0x3e, 0x57,
+    0xfe, 0x75, 0x6b, 0x1a, 0x7b, 0x18, 0x82, 0xa9, 0x5c, 0xf3, 0xa8, 0xcd, 0x32, 0xbc, 0x2a, 0xb4,
+    0x0b, 0x6f, 0x4a, 0x9a, 0x70, 0xec, 0x2b, 0xd4, 0xa7, 0x4d, 0x77, 0xb5, 0x55, 0xca, 0x4f, 0x08,
+    0x68, 0xd7, 0x96, 0x19, 0xa4, 0x44, 0xa2, 0x5c, 0x15, 0x5c, 0x21, 0xcd, 0xc3, 0x46, 0xc4, 0xb3,
+    0xa9, 0xa9, 0x51, 0xb1, 0xac, 0x2b, 0x24, 0x85, 0x35, 0xc2, 0x2c, 0x84, 0xf3, 0x29, 0x61, 0xe8,
+    0x56, 0x1c, 0xde, 0x51, 0x72, 0x21, 0xfe, 0x6b, 0xe6, 0xcf, 0xbf, 0x7b, 0x83, 0x95, 0xde, 0x6c,
+    0x6d, 0x71, 0x5f, 0xd3, 0xea, 0x1f, 0x7a, 0x5f, 0x1c, 0x1a, 0xdf, 0xbd, 0xe9, 0x9e, 0x9e, 0x8d,
+    0x3f, 0x8a, 0x4a, 0xa6, 0x2b, 0x6b, 0xf1, 0x66, 0xc9, 0x12, 0x78, 0x91, 0xad, 0x29, 0x8b, 0xe2,
+    0x21, 0x77, 0x8b, 0xa2, 0x3d, 0x08, 0xe6, 0x2b, 0x3d, 0xaf, 0x8b, 0x3b, 0x48, 0xf1, 0x0d, 0xd9,
+    0xba, 0x5c, 0x43, 0xbc, 0x50, 0x83, 0x27, 0x0c, 0x44, 0x54, 0xfa, 0x2b, 0x93, 0x5f, 0xa8, 0x0a,
+    0xfd, 0xfd, 0x56, 0xf9, 0x7b, 0x8f, 0x32, 0x06, 0xac, 0x70, 0xfa, 0xd5, 0xe0, 0x4e, 0xa6, 0x74,
+    0x58, 0x04, 0x79, 0x6d, 0x53, 0x68, 0x33, 0x77, 0x53, 0x36, 0xbd, 0x92, 0x33, 0x9b, 0x75, 0xb9,
+    0xb3, 0xf4, 0x97, 0x78, 0x33, 0x5b, 0xdb, 0x92, 0x21, 0x70, 0xf3, 0xb6, 0x08, 0x89, 0x0d, 0x1c,
+    0xa8, 0x55, 0xd4, 0x71, 0x54, 0xdf, 0xf6, 0x37, 0xd9, 0x89, 0x23, 0x3e, 0x7e, 0x35, 0xcf, 0x68,
+    0x0b, 0x9d, 0x96, 0x09, 0x26, 0x2b, 0x29, 0x35, 0x6b, 0xb8, 0x16, 0xad, 0x66, 0xb5, 0xbf, 0x84,
+    0x5a, 0x29, 0xab, 0xd7, 0xda, 0xf4, 0xfa, 0xad, 0x48, 0x34, 0x5f, 0xca, 0x3f, 0x1f, 0x91, 0x0a,
+    0x49, 0x41, 0x90, 0x00, 0xfd, 0x50, 0x13, 0x13, 0x64, 0xc2, 0x55, 0xf6, 0x09, 0xef, 0xdd, 0x49,
+    0x0c, 0x79, 0x8b, 0x33, 0x10, 0xde, 0xc6, 0x59, 0x95, 0xfa, 0xfa, 0x14, 0x8d, 0x50, 0xf9, 0x27,
+    0xa5, 0x69, 0x5a, 0xc9, 0xff, 0x18, 0xba, 0xf4, 0x13, 0xa2, 0xc9, 0x8e, 0x97, 0x7a, 0x94, 0x7a,
+    0x8a, 0x32, 0x4b, 0xe9, 0x99, 0xbd, 0xca, 0xef, 0x02, 0x6c, 0x17, 0x26, 0xea, 0xbd, 0x63, 0x99,
+    0xb9, 0x5f, 0xb9, 0x1b, 0x58, 0xa7, 0xfa, 0x69, 0xab, 0xdd, 0xe0, 0x3e, 0xff, 0xb6, 0xaf, 0x87,
+    0x28, 0xdc, 0x35, 0xec, 0x3d, 0x6a, 0xf7, 0xd5, 0x45, 0x19, 0xb1, 0x4c, 0xb8, 0xad, 0xba, 0x0e,
+    0x65, 0x49, 0x54, 0x72, 0x23, 0x2a, 0xdd, 0x23, 0xdf, 0x5e, 0x56, 0xde, 0x88, 0x16, 0x6e, 0x3c,
+    0xa1, 0x47, 0xf5, 0xd2, 0x13, 0x68, 0xc3, 0x56, 0x63, 0x12, 0xce, 0xc8, 0x0b, 0x38, 0xff, 0x85,
+    0x4c, 0x72, 0x48, 0x29, 0x00, 0xec, 0x17, 0x27, 0x9a, 0x78, 0x4a, 0xad, 0xb0, 0xc4, 0xbc, 0x88,
+    0x40, 0x9e, 0x23, 0x5d, 0xf8, 0x76, 0xf4, 0x4f, 0x6b, 0xdd, 0x1c, 0x09, 0x3b, 0xa6, 0x05, 0x8b,
+    0xea, 0xbc, 0xdf, 0x97, 0x2f, 0xf7, 0x0b, 0xb6, 0x7a, 0xb1, 0x54, 0xfa, 0x5e, 0x6e, 0xa3, 0x8f,
+    0x69, 0x71, 0xdc, 0x8a, 0x61, 0x2e, 0xb9, 0x68, 0x9b, 0xe6, 0x46, 0xe2, 0x58, 0x5c, 0x80, 0xa1,
+    0x0c, 0xde, 0xe1, 0x25, 0x6a, 0x55, 0x5a, 0xad, 0x17, 0xc7, 0x0f, 0x46, 0xa8, 0x5c, 0x09, 0x14,
+    0x44, 0x72, 0x35, 0xf2, 0x9a, 0xb3, 0xc2, 0xf8, 0xb3, 0x43, 0x3e, 0x6e, 0x78, 0x65, 0x0b, 0xf0,
+    0x78, 0x54, 0xc0, 0x8d, 0x93, 0x6c, 0xe2, 0x3f, 0x35, 0xcb, 0x75, 0x0e, 0xd6, 0xae, 0x3b, 0x13,
+    0xf8, 0x7c, 0x63, 0x5c, 0x0b, 0xd1, 0xdc, 0x5e, 0xca, 0x1b, 0x92, 0xb8, 0xc9, 0xff, 0xad, 0x89,
+    0x51, 0x3e, 0xa3, 0x09, 0x8c, 0x79, 0x73, 0x1e, 0xa8, 0x5e, 0x00, 0x6b, 0xae, 0x4e, 0x20, 0x5b,
+    0xa6, 0xbe, 0x8c, 0xfd, 0xb3, 0x8d, 0xc6, 0x09, 0x3b, 0x69, 0x46, 0x21, 0xa6, 0xe9, 0xb5, 0x5c,
+    0xdf, 0xf0, 0xcf, 0x5f, 0xbe, 0xf3, 0x8f, 0x1a, 0x5a, 0xf3, 0xc1, 0xd1, 0xcd, 0xd1, 0xe8, 0x82,
+    0x3e, 0x28, 0x7d, 0x3c, 0x2b, 0xc7, 0x9a, 0xca, 0x0b, 0xfc, 0x8c, 0x90, 0x8c, 0x1b, 0x7c, 0x72,
+    0x51, 0x6d, 0x05, 0x41, 0xad, 0xc2, 0x15, 0x39, 0x0f, 0x07, 0xbe, 0xd8, 0x3c, 0x46, 0x59, 0x8d,
+    0x9a, 0x94, 0x9e, 0xc9, 0x95, 0x7e, 0xc1, 0x5a, 0x5a, 0x3d, 0xf2, 0x0c, 0xce, 0xc7, 0xaf, 0xf0,
+    0x0e, 0xd6, 0x2a, 0x15, 0x9d, 0xb3, 0x44, 0xae, 0xe6, 0x1c, 0x36, 0x18, 0x6a, 0x12, 0xa2, 0x57,
+    0x34, 0xff, 0x8e, 0xf3, 0xf4, 0x17, 0xc2, 0x25, 0x90, 0x1c, 0x36, 0xb5, 0xdc, 0x43, 0xd8, 0xf7,
+    0xd8, 0xd3, 0x12, 0x2b, 0xf2, 0x42, 0x21, 0x98, 0xc1, 0x31, 0x6e, 0xff, 0xd0, 0x4c, 0xbd, 0x2b,
+    0xd2, 0x99, 0x73, 0x19, 0x43, 0xfa, 0x82, 0x89, 0x1e, 0x51, 0x2c, 0xe9, 0xf5, 0xcf, 0xce, 0xc7,
+    0xe4, 0x16, 0x65, 0x7c, 0x18, 0x77, 0x7f, 0x19, 0xb7, 0x86, 0xdd, 0x96, 0x6b, 0xcb, 0x7f, 0x85,
+    0xd9, 0xbd, 0x4f, 0x57, 0xf9, 0x30, 0x66, 0x95, 0x54, 0x59, 0x31, 0x6f, 0x09, 0x28, 0x97, 0xfd,
+    0x30, 0x5d, 0x19, 0x0f, 0xa4, 0x13, 0xa6, 0x69, 0x2d, 0x62, 0xcd, 0x1b, 0x26, 0xbe, 0x77, 0xe9,
+    0xac, 0x2f, 0x38, 0x54, 0xb1, 0x66, 0x14, 0x53, 0x7c, 0x45, 0x87, 0xe7, 0xa5, 0x2d, 0xdc, 0xf8,
+    0xa2, 0x4b, 0x5b, 0x57, 0x0e, 0x5c, 0xe1, 0x3b, 0x5b, 0xe6, 0x14, 0x28, 0x93, 0x0f, 0x6e, 0x9a,
+    0xa0, 0x30, 0x6b, 0x07, 0x0b, 0x97, 0x7f, 0x7f, 0xc1, 0xba, 0x29, 0x14, 0x25, 0x2f, 0x3d, 0xda,
+    0xdd, 0xd9, 0x18, 0x14, 0x66, 0x12, 0xc6, 0xf5, 0xa0, 0xc0, 0xa7, 0x23, 0x03, 0x62, 0x60, 0x31,
+    0xda, 0xe4, 0x30, 0x4f, 0x81, 0x39, 0xb7, 0xfe, 0x72, 0x1e, 0x79, 0x33, 0xfe, 0x49, 0xf3, 0x2e,
+    0xa8, 0x9a, 0xa0, 0x3c, 0xc6, 0x47, 0x82, 0x58, 0x6b, 0xab, 0x73, 0x1a, 0xac, 0xc3, 0x40, 0x9e,
+    0x89, 0x14, 0xe2, 0x94, 0xe5, 0x02, 0xa7, 0xa8, 0x5d, 0x20, 0xe2, 0xdd, 0x84, 0xdb, 0x8a, 0x41,
+    0xb6, 0x3d, 0x8f, 0xdc, 0xbd, 0x8d, 0x80, 0x99, 0xc5, 0x31, 0x64, 0xd1, 0x44, 0x86, 0x9f, 0xbd,
+    0x16, 0x9a, 0x20, 0x2b, 0x6d, 0x6d, 0x15, 0x6f, 0xdb, 0xab, 0xf8, 0x8f, 0xfd, 0x96, 0xdd, 0x38,
+    0xc1, 0x94, 0x65, 0x74, 0x30, 0x6b, 0xfc, 0x97, 0x2e, 0xe4, 0xb5, 0x53, 0x4c, 0x72, 0xb1, 0xe5,
+    0xec, 0xae, 0x5c, 0x9c, 0x7a, 0x68, 0x7c, 0xe5, 0xc5, 0x71, 0x64, 0xda, 0x6c, 0x61, 0x46, 0x38,
+    0x93, 0x36, 0xd5, 0x86, 0x53, 0x3a, 0x1b, 0xeb, 0xf8, 0xce, 0x86, 0x63, 0x6b, 0x61, 0x38, 0xf9,
+    0x50, 0x0d, 0x1d, 0x60, 0xeb, 0x8c, 0x3c, 0xf6, 0x26, 0x1b, 0x8e, 0xad, 0xc7, 0xc1, 0x19, 0x19,
+    0x36, 0x5c, 0xae, 0x93, 0x0e, 0xb9, 0x21, 0xda, 0x2d, 0x08, 0x88, 0xd9, 0x6e, 0x55, 0x7f, 0x1c,
+    0xba, 0xeb, 0xcc, 0xfd, 0xd0, 0x9b, 0xde, 0x50, 0xb6, 0x8c, 0xa7, 0xa2, 0x64, 0x55, 0xa2, 0xa1,
+    0x6f, 0x13, 0x2b, 0x56, 0x08, 0xd2, 0xd2, 0x37, 0x4f, 0x89, 0x1b, 0xdb, 0x00, 0x7b, 0x3b, 0x14,
+    0xbf, 0xb4, 0x21, 0x10, 0x78, 0xd0, 0x93, 0x8d, 0x1d, 0x96, 0x8e, 0xe3, 0x19, 0x43, 0xe8, 0xac,
+    0x9b, 0x98, 0xb4, 0x25, 0x8e, 0x71, 0xdd, 0x09, 0x71, 0xdc, 0xca, 0xa4, 0xb8, 0x8d, 0xa1, 0x70,
+    0xb4, 0xbb, 0x29, 0x22, 0x5f, 0x87, 0x77, 0xc7, 0x2c, 0x88, 0xd6, 0x5a, 0xfb, 0xd1, 0xab, 0x27,
+    0xf4, 0x3e, 0x64, 0x68, 0x6d, 0xd0, 0xdc, 0xc8, 0xab, 0x07, 0xf9, 0x61, 0xc3, 0x41, 0xc4, 0xeb,
+    0x38, 0xeb, 0x75, 0xfe, 0xe3, 0x13, 0x56, 0x90, 0x4b, 0x36, 0x6b, 0x0d, 0xf1, 0xd3, 0x86, 0x43,
+    0x4c, 0xc3, 0xe8, 0x61, 0x23, 0x14, 0x3c, 0xfa, 0xe3, 0x86, 0x23, 0x60, 0x04, 0xdc, 0x66, 0x23,
+    0xfc, 0xef, 0x27, 0x80, 0xa9, 0xcf, 0xee, 0x8e, 0xc2, 0x00, 0xd8, 0xd7, 0x06, 0xb0, 0xfa, 0xf7,
+    0x6f, 0x4f, 0xb0, 0x47, 0xff, 0xb1, 0xe9, 0xb9, 0x12, 0xfb, 0x57, 0x57, 0x2c, 0xe6, 0x77, 0xb4,
+    0xfa, 0xe3, 0x26, 0x2b, 0x68, 0x6f, 0xe7, 0x09, 0x50, 0xb3, 0x0b, 0x8b, 0xc6, 0x20, 0xba, 0x9a,
+    0x07, 0x92, 0xb1, 0x84, 0x00, 0xbf, 0x40, 0x2e, 0x5e, 0xfb, 0xa9, 0xc9, 0xe7, 0x3e, 0xd1, 0x3b,
+    0x33, 0x70, 0x9c, 0x5c, 0xac, 0xc8, 0xe5, 0x6f, 0x0f, 0x85, 0x2c, 0x86, 0x7e, 0xe6, 0xbd, 0xdc,
+    0xeb, 0xdd, 0xac, 0x17, 0xdc, 0x5a, 0xa5, 0x4b, 0x96, 0x1f, 0x3f, 0x5f, 0x25, 0x2c, 0x58, 0x75,
+    0xb0, 0x48, 0xf4, 0x8b, 0x5d, 0x91, 0x35, 0x2f, 0xbf, 0x31, 0xaf, 0xf0, 0xc2, 0x2c, 0x71, 0xee,
+    0xa3, 0x5e, 0x6d, 0xc6, 0x38, 0x13, 0x6b, 0xf5, 0x28, 0x4d, 0xe1, 0xf7, 0x5f, 0xdc, 0x55, 0x3d,
+    0x16, 0xb8, 0x3c, 0x17, 0x9a, 0x12, 0x6a, 0xc1, 0xc3, 0x4b, 0x1d, 0xd0, 0x32, 0xdf, 0x75, 0xc7,
+    0x23, 0xe7, 0xa8, 0x37, 0x1c, 0x8d, 0xdd, 0x75, 0xa5, 0xfc, 0x79, 0x72, 0x45, 0x69, 0xae, 0xcf,
+    0xdf, 0x77, 0x1d, 0x09, 0xc0, 0x6c, 0x54, 0x0c, 0x5e, 0xed, 0x8d, 0xbb, 0xa7, 0xb5, 0x51, 0xfd,
+    0x2d, 0xa6, 0xc0, 0x3e, 0xef, 0x77, 0x06, 0x94, 0x0b, 0x7b, 0xd8, 0x7d, 0x37, 0x84, 0xb1, 0x9a,
+    0x8a, 0x3e, 0xfc, 0x9c, 0x5e, 0x91, 0x89, 0xe7, 0x94, 0x95, 0x5d, 0xd7, 0x75, 0xcd, 0xb7, 0x80,
+    0x60, 0x30, 0x0c, 0x25, 0xb3, 0x0e, 0x27, 0x56, 0xd1, 0x6c, 0x66, 0x01, 0x06, 0x4f, 0xb1, 0x5d,
+    0x62, 0x34, 0xc7, 0x64, 0x19, 0xdc, 0xf0, 0x4d, 0x00, 0x4a, 0xd0, 0x71, 0x0c, 0x0e, 0xeb, 0xeb,
+    0x70, 0x06, 0x82, 0xda, 0xd9, 0x00, 0x40, 0xa5, 0xbb, 0xb9, 0x5c, 0x93, 0xa9, 0x2b, 0xc1, 0x27,
+    0xe2, 0x5c, 0x91, 0x3f, 0x61, 0x0b, 0xf3, 0xc5, 0x62, 0xb2, 0x58, 0x8c, 0x2a, 0xf5, 0xa7, 0x1e,
+    0xee, 0xef, 0x36, 0x86, 0x6a, 0xb8, 0xf2, 0x45, 0xb9, 0x8c, 0x7c, 0xc3, 0xd9, 0xc3, 0x1e, 0x7f,
+    0x0b, 0x87, 0x8b, 0x49, 0xfe, 0xe5, 0x83, 0xc0, 0xb6, 0x64, 0x4f, 0x2c, 0x76, 0xee, 0x45, 0x32,
+    0x8d, 0x22, 0xc7, 0xdd, 0xc7, 0x7a, 0x01, 0xc9, 0x4a, 0x83, 0xb4, 0xc8, 0x74, 0x68, 0x46, 0x89,
+    0xe8, 0xa0, 0xed, 0x76, 0x08, 0xb2, 0xc2, 0x43, 0x8a, 0x43, 0x60, 0xa6, 0x11, 0x88, 0x04, 0xb8,
+    0x86, 0x23, 0xda, 0x79, 0x6a, 0xcd, 0x5f, 0x68, 0x0c, 0xa3, 0xc5, 0xf5, 0xa0, 0x00, 0x94, 0x24,
+    0xde, 0x15, 0xab, 0x97, 0x87, 0xe8, 0x14, 0x35, 0xd1, 0x6f, 0x47, 0x13, 0x80, 0xa3, 0x47, 0x30,
+    0xbb, 0x91, 0x73, 0xda, 0x1a, 0x02, 0x44, 0x9a, 0x6b, 0xd0, 0x83, 0xd2, 0xba, 0xfb, 0x0b, 0x34,
+    0x1e, 0x0f, 0x5b, 0xe3, 0x52, 0x34, 0x15, 0x54, 0x61, 0xa2, 0x29, 0x99, 0xa4, 0xf8, 0x2a, 0x79,
+    0x4e, 0x33, 0x10, 0xec, 0x00, 0x33, 0x17, 0xf8, 0xa8, 0x59, 0xf0, 0xe0, 0xd4, 0x26, 0xa0, 0x4a,
+    0xe2, 0x4b, 0x3a, 0x14, 0x3a, 0x44, 0x78, 0x54, 0x97, 0xed, 0xf8, 0x31, 0x9a, 0x08, 0x8b, 0xa8,
+    0xe3, 0x25, 0xce, 0xff, 0xe9, 0x9d, 0xed, 0x73, 0xab, 0x37, 0xef, 0xca, 0x5f, 0x24, 0x98, 0x31,
+    0x1c, 0xe0, 0x83, 0x6f, 0x05, 0x05, 0x94, 0x56, 0x05, 0x33, 0x13, 0x5c, 0x33, 0xe7, 0x52, 0x24,
+    0x23, 0xb5, 0xf9, 0xfa, 0xaa, 0x73, 0x87, 0x92, 0x97, 0x2f, 0x35, 0x90, 0x11, 0x56, 0xad, 0x0c,
+    0x28, 0x56, 0x0c, 0x69, 0xaa, 0xb9, 0x66, 0x0a, 0x53, 0x4d, 0xa5, 0x9d, 0xac, 0xe6, 0x7a, 0xae,
+    0xd5, 0x80, 0xbb, 0xf0, 0xb2, 0x44, 0x67, 0x70, 0x24, 0x5c, 0x08, 0x45, 0x82, 0x47, 0x07, 0x80,
+    0xae, 0xa0, 0x18, 0x6a, 0x93, 0x99, 0x5b, 0x3c, 0x2e, 0xb2, 0x76, 0xd6, 0x9c, 0x6d, 0xb4, 0x88,
+    0xe6, 0x35, 0xe0, 0x2f, 0x65, 0xe4, 0xcb, 0x2e, 0x2d, 0x04, 0x84, 0x0e, 0x76, 0x5f, 0x54, 0x84,
+    0x74, 0x69, 0x53, 0xb2, 0x48, 0xe5, 0x5e, 0x53, 0xf6, 0x27, 0x62, 0xa0, 0xc8, 0x6f, 0xe6, 0x6f,
+    0x7e, 0x64, 0x4c, 0xd3, 0xea, 0x76, 0x5c, 0x36, 0xb3, 0xcb, 0xaf, 0x36, 0x9b, 0x2a, 0x4d, 0x01,
+    0x53, 0xc6, 0xa3, 0x76, 0x5e, 0xd4, 0x61, 0x31, 0x53, 0x5d, 0xb8, 0x4c, 0xe5, 0x46, 0x37, 0x9c,
+    0x1f, 0x30, 0x1f, 0x14, 0x25, 0x5a, 0x98, 0x03, 0x96, 0xe2, 0xc1, 0xe5, 0x3d, 0x38, 0x13, 0x96,
+    0xde, 0x31, 0x96, 0x13, 0x6d, 0x99, 0xe3, 0x9f, 0x95, 0x74, 0x9c, 0xf6, 0xe0, 0xf4, 0xec, 0xa4,
+    0x3b, 0xee, 0xee, 0x39, 0x16, 0x9e, 0xa3, 0xb9, 0xc2, 0x97, 0xe5, 0xe0, 0xf8, 0x16, 0x69, 0x35,
+    0x08, 0x7d, 0x0a, 0x07, 0xd3, 0x57, 0x13, 0x36, 0x44, 0x34, 0x32, 0x3a, 0xfc, 0xe0, 0xda, 0x36,
+    0xd9, 0x7a, 0xb1, 0xe3, 0x36, 0xb7, 0x2f, 0xc1, 0x97, 0x35, 0x78, 0x60, 0x0a, 0x8c, 0x03, 0x4a,
+    0xe9, 0xd5, 0x84, 0x3f, 0xf5, 0x40, 0x5d, 0xe3, 0x51, 0x51, 0xfd, 0x22, 0xc1, 0x78, 0x52, 0x54,
+    0x0f, 0xc7, 0xb5, 0x9b, 0x28, 0x71, 0xac, 0x2d, 0xe3, 0xc5, 0xd1, 0xd7, 0xce, 0x4f, 0x3b, 0x3b,
+    0xc5, 0x2b, 0x0a, 0x3d, 0x2d, 0x48, 0xf1, 0x75, 0xd3, 0x7c, 0x38, 0xf3, 0x01, 0x53, 0x18, 0xa4,
+    0xfc, 0xb5, 0x44, 0xda, 0xf6, 0xe6, 0x89, 0x4a, 0x16, 0xb6, 0xd7, 0x12, 0x79, 0xb5, 0xa1, 0xbd,
+    0xda, 0x5a, 0x8f, 0x25, 0x96, 0x3d, 0x63, 0x58, 0xf1, 0x52, 0xab, 0x01, 0x77, 0x01, 0xda, 0x4a,
+    0xa0, 0x1b, 0x39, 0x79, 0xcd, 0x93, 0xb7, 0x90, 0x51, 0xc2, 0x54, 0xb1, 0xcc, 0x57, 0x2e, 0x4d,
+    0x9b, 0xf9, 0x42, 0xab, 0x0f, 0xfc, 0xb5, 0x2a, 0x2d, 0xc3, 0xea, 0x5e, 0xf0, 0xea, 0x03, 0x3a,
+    0x31, 0x73, 0x5f, 0x28, 0x8c, 0x84, 0xe7, 0x00, 0x59, 0xbb, 0x27, 0x32, 0xd2, 0xe1, 0xb3, 0xba,
+    0x3f, 0xed, 0x58, 0xf2, 0x67, 0x70, 0xbb, 0xc4, 0xaa, 0x35, 0x5e, 0x43, 0xad, 0x55, 0xcb, 0x33,
+    0x9f, 0x49, 0xfa, 0x6a, 0xe0, 0x53, 0xb2, 0x43, 0x3c, 0x6d, 0x82, 0xeb, 0x74, 0x10, 0xe7, 0x16,
+    0x94, 0x15, 0x5d, 0x7c, 0x9d, 0xdb, 0x94, 0x7a, 0xe9, 0x5d, 0x8a, 0xf5, 0xd1, 0x27, 0xec, 0x7a,
+    0xe6, 0x43, 0xbf, 0x98, 0x52, 0x4f, 0x8d, 0xdc, 0x14, 0x6a, 0x91, 0xbc, 0xb3, 0xee, 0x2e, 0xc4,
+    0x9d, 0x75, 0x93, 0x73, 0x3d, 0xaa, 0x2b, 0x9f, 0x4c, 0x14, 0x32, 0x89, 0xd6, 0x31, 0x49, 0x46,
+    0x7a, 0xd7, 0x0d, 0x67, 0xee, 0xdd, 0xd3, 0x4f, 0x9d, 0x0b, 0x42, 0x8f, 0xca, 0xed, 0x78, 0x36,
+    0x92, 0x72, 0x47, 0xb6, 0x98, 0xaa, 0xc3, 0xd6, 0xb3, 0x78, 0xaa, 0x03, 0xa5, 0x47, 0xe9, 0x53,
+    0x91, 0x65, 0x55, 0xa3, 0x57, 0x77, 0x17, 0x33, 0xe9, 0xc1, 0x2a, 0x27, 0xa9, 0xdc, 0x9f, 0xe3,
+    0x57, 0x8c, 0x75, 0xc6, 0x9b, 0x37, 0x7d, 0x88, 0x66, 0x12, 0xe0, 0x13, 0x9f, 0x3b, 0x0d, 0xec,
+    0xa1, 0x5e, 0xcf, 0x1f, 0x2f, 0x33, 0x57, 0x40, 0x96, 0x82, 0xc5, 0x4c, 0x5e, 0x5b, 0x68, 0x21,
+    0x47, 0xc5, 0x8e, 0x6c, 0x09, 0x93, 0xc8, 0x40, 0xc5, 0x52, 0xcf, 0x38, 0x1a, 0x40, 0xa7, 0xf6,
+    0x56, 0x5d, 0x26, 0x22, 0xb8, 0x8c, 0x6c, 0x89, 0x2c, 0x5d, 0xd9, 0xaa, 0xf8, 0x44, 0x63, 0xe6,
+    0xbe, 0x5d, 0xd9, 0x8e, 0x27, 0x45, 0xd2, 0xfc, 0xdc, 0x68, 0x92, 0xe8, 0xfc, 0x41, 0xe3, 0xe2,
+    0x1f, 0xd2, 0x89, 0xb7, 0x78, 0x45, 0x8a, 0x21, 0x5a, 0x42, 0x2d, 0xc8, 0xd1, 0x02, 0x3b, 0xe0,
+    0x2c, 0x49, 0x74, 0x8b, 0x1d, 0x19, 0x29, 0xef, 0x78, 0x43, 0x79, 0x56, 0x1b, 0x8f, 0x31, 0xd3,
+    0x43, 0x1c, 0x92, 0x95, 0xd1, 0xd8, 0x46, 0xeb, 0xfc, 0x39, 0x66, 0x38, 0xff, 0x4f, 0x07, 0x9d,
+    0xde, 0x51, 0x4f, 0x78, 0x99, 0x0f, 0xbb, 0xad, 0xce, 0x47, 0xd7, 0x92, 0xad, 0x46, 0xb9, 0x0c,
+    0x0d, 0xe3, 0xa9, 0x9e, 0x6f, 0x94, 0x4a, 0xe4, 0x55, 0x2d, 0xf5, 0x5b, 0xf0, 0xdf, 0x97, 0xfa,
+    0xb3, 0xdb, 0xe9, 0x8d, 0xda, 0xad, 0x61, 0x07, 0xb4, 0xed, 0x51, 0xeb, 0x67, 0xd0, 0xe6, 0xda,
+    0xc7, 0xad, 0xfe, 0xbb, 0xee, 0xe8, 0xad, 0x19, 0x81, 0xfc, 0xb8, 0x49, 0x22, 0x1c, 0xeb, 0x25,
+    0xf2, 0xda, 0x59, 0x70, 0x9e, 0x86, 0x5b, 0x74, 0x4d, 0x0e, 0x6d, 0x34, 0x85, 0x23, 0xdb, 0x39,
+    0xc3, 0x65, 0x85, 0x3e, 0x28, 0x4f, 0x37, 0x6a, 0xf9, 0x1e, 0x88, 0x5c, 0xf4, 0x37, 0xb3, 0x65,
+    0x91, 0xf1, 0x66, 0xb6, 0x2c, 0x2e, 0x24, 0x8e, 0x28, 0x3a, 0x14, 0xe0, 0x7e, 0xbd, 0x67, 0x0f,
+    0x35, 0x6d, 0xa7, 0x4a, 0x6f, 0x64, 0x43, 0xf3, 0x36, 0x76, 0x60, 0x16, 0x24, 0x66, 0xc1, 0x68,
+    0xfd, 0x5b, 0xda, 0xc4, 0xbb, 0xa5, 0xf9, 0x54, 0xdf, 0xce, 0x56, 0x4e, 0xf0, 0xde, 0x1c, 0xfe,
+    0x97, 0xf5, 0x87, 0x5f, 0x71, 0x99, 0x5f, 0x36, 0x93, 0x2a, 0x1f, 0x82, 0x27, 0x0e, 0xf7, 0x58,
+    0xb2, 0x51, 0x3d, 0x74, 0xe8, 0xd0, 0xb2, 0xa9, 0x28, 0xbb, 0x6c, 0xe3, 0x1b, 0x4f, 0x41, 0xd6,
+    0xe7, 0x1c, 0x5b, 0x6d, 0xef, 0x94, 0xc1, 0xa9, 0x24, 0x9c, 0x06, 0xb5, 0xf3, 0x29, 0x47, 0xe7,
+    0x86, 0xc1, 0x62, 0xd4, 0x33, 0x56, 0xb4, 0xc6, 0x0b, 0x37, 0x85, 0x73, 0x95, 0x51, 0x85, 0xa8,
+    0x6e, 0xb5, 0xef, 0xe0, 0x18, 0x7b, 0xce, 0xab, 0xf7, 0x87, 0x0e, 0xa5, 0x1b, 0x71, 0xeb, 0x26,
+    0x85, 0x48, 0x72, 0xc8, 0x65, 0x6d, 0xf3, 0xb8, 0xb0, 0xa9, 0x19, 0xc6, 0x8d, 0xc7, 0x06, 0x8e,
+    0x44, 0x65, 0x0a, 0x98, 0x76, 0x1f, 0x7b, 0xa1, 0xe6, 0x9a, 0xd3, 0xc3, 0x94, 0x44, 0xde, 0x73,
+    0x23, 0x6e, 0xe9, 0xb3, 0xc5, 0xbe, 0x89, 0xf6, 0x1c, 0x67, 0x3c, 0x20, 0x30, 0xc3, 0xba, 0xb3,
+    0xe4, 0x88, 0x8f, 0xba, 0x9a, 0x47, 0xa9, 0xb4, 0xdf, 0x98, 0x9b, 0xa1, 0xf7, 0xc8, 0xa1, 0x28,
+    0x3a, 0x1c, 0x38, 0x27, 0x68, 0x73, 0xd4, 0xbb, 0xfc, 0xba, 0x9a, 0xa1, 0xc2, 0xba, 0xf2, 0x27,
+    0x82, 0xd6, 0x62, 0x5e, 0x7c, 0x1b, 0xbf, 0x88, 0xd1, 0x7f, 0x89, 0x5c, 0x90, 0xbd, 0x73, 0x57,
+    0xd9, 0x0c, 0x2b, 0xfd, 0x43, 0xe5, 0x09, 0x0e, 0x14, 0x94, 0x23, 0x32, 0xc9, 0x22, 0x7b, 0x94,
+    0xaf, 0x5c, 0xc6, 0xe0, 0x86, 0x65, 0xac, 0x67, 0x3e, 0xad, 0x85, 0xf8, 0x01, 0x4a, 0xaf, 0x65,
+    0x27, 0x2d, 0x72, 0x86, 0x82, 0x76, 0xf4, 0x44, 0xe2, 0x93, 0x45, 0x0e, 0x7a, 0x47, 0xbb, 0xd7,
+    0x7f, 0x87, 0x46, 0x45, 0xa1, 0x90, 0xda, 0x0e, 0x4b, 0xf3, 0xa0, 0xcc, 0x29, 0xbd, 0x3a, 0x0b,
+    0xdf, 0xd3, 0x1e, 0x8a, 0x37, 0x6c, 0x51, 0xf2, 0x29, 0xf8, 0x5c, 0xb2, 0x2d, 0x10, 0x9a, 0x99,
+    0x96, 0x6b, 0x05, 0xd1, 0x55, 0x39, 0x95, 0x59, 0xd2, 0x3b, 0x96, 0x27, 0xc2, 0xd0, 0x80, 0x95,
+    0x8b, 0xf3, 0x2b, 0x64, 0x8b, 0xec, 0xb3, 0x50, 0x4b, 0x95, 0xb0, 0x5f, 0x9b, 0x14, 0xa1, 0xbf,
+    0x15, 0xa3, 0x32, 0xd5, 0x72, 0xff, 0xcd, 0xca, 0x8e, 0x0c, 0x00, 0xad, 0x9d, 0x31, 0xab, 0x1a,
+    0x5a, 0x36, 0xf3, 0x7b, 0x2e, 0x62, 0xac, 0x73, 0x88, 0x12, 0x5d, 0x49, 0xbe, 0x65, 0x65, 0x9f,
+    0xc2, 0xc4, 0x5e, 0x64, 0xc5, 0x5f, 0xf5, 0xfc, 0x45, 0x6d, 0x4c, 0x22, 0x68, 0xbe, 0xc1, 0x8a,
+    0x57, 0xaf, 0xf8, 0x68, 0xd5, 0x1b, 0x4b, 0x4f, 0x64, 0x6a, 0x64, 0x1e, 0xc7, 0x25, 0x08, 0x54,
+    0xa1, 0x86, 0xa4, 0x79, 0xf0, 0xae, 0x4c, 0x5c, 0x91, 0x54, 0x92, 0xc4, 0xea, 0x93, 0xbc, 0x28,
+    0x6e, 0x69, 0x11, 0x9a, 0xf3, 0x48, 0x9c, 0x23, 0xd9, 0x91, 0x42, 0x91, 0x9c, 0xf3, 0x48, 0x13,
+    0xd4, 0x27, 0xde, 0xf4, 0x66, 0x69, 0xad, 0x39, 0xf1, 0x6e, 0xb4, 0x9a, 0x61, 0xec, 0x5f, 0x61,
+    0xe6, 0x35, 0xa3, 0x6e, 0x0e, 0x7b, 0xde, 0x55, 0x9b, 0x0c, 0xfd, 0x0a, 0xe9, 0x3c, 0xb3, 0xe1,
+    0x2e, 0xa8, 0x2b, 0xc0, 0xbe, 0x38, 0xda, 0xaa, 0x1d, 0xd7, 0xad, 0xcc, 0xc7, 0x1a, 0x73, 0x40,
+    0xb7, 0x55, 0xe5, 0x76, 0x52, 0x09, 0x00, 0x95, 0x0a, 0x9e, 0xd2, 0x4f, 0x0e, 0xa0, 0x62, 0x4f,
+    0x3c, 0xe2, 0x18, 0x51, 0x73, 0x1c, 0x72, 0x46, 0x98, 0x0d, 0xdb, 0x70, 0x38, 0x5e, 0xb9, 0xf8,
+    0xcf, 0x36, 0xf0, 0x57, 0x7f, 0xe1, 0x5a, 0x6e, 0xec, 0xf0, 0xb8, 0x18, 0xc0, 0xfa, 0x2b, 0x2e,
+    0x27, 0x79, 0xa5, 0xb7, 0x61, 0x30, 0x2b, 0x9b, 0xa2, 0x06, 0x40, 0x4a, 0x3b, 0xb7, 0x60, 0x77,
+    0x9b, 0xad, 0x87, 0x1b, 0x26, 0xe5, 0x6c, 0x28, 0x28, 0xc3, 0xdc, 0x4e, 0xdd, 0x02, 0xac, 0x2e,
+    0x60, 0x0c, 0x6b, 0xfe, 0xa2, 0x05, 0x64, 0x7b, 0xb5, 0x6a, 0xf2, 0xda, 0x4a, 0x8b, 0xe1, 0x24,
+    0x72, 0x32, 0x34, 0xff, 0xf4, 0x1a, 0xe3, 0xa5, 0xd0, 0xe6, 0xc3, 0xf9, 0x21, 0x68, 0xe3, 0x94,
+    0xc0, 0x80, 0x73, 0x4c, 0xb7, 0x90, 0x39, 0x43, 0x59, 0x6d, 0xe1, 0x68, 0xfa, 0x6a, 0x78, 0xf3,
+    0xa8, 0xb1, 0x7a, 0x8b, 0x4c, 0x57, 0x7e, 0x62, 0xac, 0x3e, 0xf4, 0x2c, 0x9e, 0x4e, 0x16, 0xba,
+    0x93, 0xa7, 0x85, 0x41, 0x76, 0xe5, 0x87, 0xd2, 0x93, 0xc0, 0xb3, 0xde, 0xc6, 0x2b, 0x40, 0x7a,
+    0xea, 0xd6, 0x3f, 0x7e, 0x7d, 0x2e, 0x61, 0x81, 0xd9, 0x5a, 0x99, 0x29, 0x0b, 0x16, 0x6a, 0xcd,
+    0xb7, 0xed, 0x77, 0xd7, 0x94, 0xec, 0xba, 0x11, 0x5e, 0x47, 0xa3, 0x6e, 0xc4, 0xa9, 0xa1, 0xec,
+    0x48, 0xfe, 0x0a, 0x9a, 0xcc, 0x0a, 0x7b, 0xf5, 0x20, 0xa0, 0x3b, 0x7b, 0xe5, 0xbe, 0x20, 0xd7,
+    0x77, 0x56, 0x34, 0xed, 0xb3, 0x3b, 0xe3, 0xaa, 0x61, 0xb3, 0xa1, 0xd7, 0xb9, 0xed, 0x58, 0xff,
+    0xd2, 0xc2, 0x9c, 0x13, 0xf7, 0x83, 0x52, 0x6f, 0x2d, 0x0a, 0xce, 0x0d, 0x1c, 0x2f, 0x0c, 0x94,
+    0x08, 0x39, 0x40, 0xaa, 0x04, 0x21, 0x2b, 0xe4, 0x54, 0x94, 0x59, 0xf0, 0x59, 0xac, 0xee, 0xc3,
+    0x00, 0x61, 0x31, 0xb6, 0x51, 0xf4, 0x44, 0x38, 0x14, 0xb0, 0x38, 0xad, 0xb9, 0x67, 0xc3, 0xc1,
+    0xcf, 0xbd, 0x4e, 0xd7, 0xe9, 0x77, 0x3f, 0x38, 0x76, 0xd4, 0xa1, 0x3b, 0x40, 0xde, 0xae, 0xe9,
+    0x2f, 0xa6, 0xc1, 0x12, 0x08, 0x85, 0xee, 0xed, 0x11, 0x35, 0x8b, 0x1f, 0xd0, 0x21, 0x42, 0xe9,
+    0xbf, 0x77, 0x72, 0xd2, 0x7d, 0xd7, 0x3a, 0x41, 0x1b, 0xe6, 0xb0, 0xd5, 0x1e, 0x77, 0x87, 0xa3,
+    0xe2, 0x08, 0x1b, 0x52, 0xd0, 0x13, 0x1f, 0x8c, 0x10, 0x53, 0xfd, 0x32, 0x9f, 0xa2, 0x35, 0x8e,
+    0x6d, 0xbe, 0x8f, 0x2b, 0x39, 0x9f, 0x7c, 0x9b, 0xe2, 0x49, 0x0e, 0x3f, 0x79, 0x52, 0xe4, 0x66,
+    0xb2, 0x9c, 0x4e, 0x8d, 0x6b, 0x5e, 0x83, 0xdd, 0x71, 0x9e, 0x20, 0xb8, 0x9c, 0xc4, 0x80, 0x62,
+    0x00, 0x8b, 0xd5, 0x81, 0xb3, 0xc4, 0x5b, 0x5b, 0x02, 0xb7, 0x58, 0x59, 0xbf, 0x38, 0x2d, 0xf5,
+    0x8d, 0x28, 0x4c, 0x4f, 0x63, 0xc5, 0x72, 0x6d, 0x0c, 0x59, 0x31, 0xc9, 0xfa, 0xe7, 0xfd, 0xf7,
+    0xfd, 0xc1, 0x87, 0xbe, 0x5b, 0x3c, 0x23, 0x56, 0x79, 0x2a, 0x1d, 0xb5, 0xce, 0x4f, 0xc6, 0xeb,
+    0xfb, 0x28, 0xe9, 0x7e, 0xb9, 0x1a, 0x29, 0x27, 0xf1, 0x74, 0x15, 0x6a, 0xce, 0x92, 0xd4, 0x52,
+    0xc5, 0x16, 0x1f, 0x70, 0xa1, 0x3b, 0x0d, 0x9d, 0x71, 0x53, 0x29, 0x0d, 0x8f, 0x6a, 0x62, 0x1a,
+    0x82, 0xba, 0xc6, 0x5f, 0x84, 0xe4, 0x8f, 0x05, 0xe7, 0x19, 0x47, 0xe2, 0x69, 0x8e, 0xf1, 0x30,
+    0x5e, 0x33, 0x32, 0x5e, 0x6d, 0x52, 0x0f, 0x87, 0xc1, 0xf9, 0xb0, 0xdd, 0x75, 0x5a, 0xfd, 0x8e,
+    0xd3, 0xe9, 0x8e, 0xc6, 0x4e, 0x6b, 0xd8, 0x85, 0x73, 0x0f, 0x80, 0xdd, 0xe9, 0x0d, 0xe1, 0xd4,
+    0x18, 0x0c, 0x3f, 0xae, 0xe1, 0x16, 0x05, 0xb3, 0x7b, 0xc7, 0xd2, 0xec, 0x3d, 0x50, 0x07, 0x5f,
+    0x6b, 0x54, 0xde, 0x83, 0x4b, 0x32, 0x4d, 0xc1, 0x7c, 0xff, 0x18, 0x67, 0xba, 0xda, 0x7d, 0x54,
+    0x3b, 0x15, 0xb1, 0x89, 0xcd, 0x73, 0x54, 0x1a, 0xf7, 0xd0, 0xe4, 0x6d, 0x7a, 0x8f, 0xaa, 0xef,
+    0xf3, 0xc2, 0x9f, 0x86, 0x97, 0x66, 0x76, 0x90, 0x66, 0xde, 0x5b, 0xd0, 0x05, 0x0e, 0x93, 0x47,
+    0x17, 0x19, 0x4e, 0x64, 0x25, 0x13, 0x52, 0xdb, 0x6c, 0x32, 0x33, 0x04, 0x08, 0xfe, 0x71, 0x61,
+    0x5a, 0xcf, 0xb5, 0x59, 0x95, 0x5b, 0x3c, 0x47, 0x78, 0xac, 0xb7, 0x07, 0x67, 0x1f, 0x57, 0xf0,
+    0x4d, 0xee, 0xfe, 0x6b, 0x78, 0x18, 0xea, 0xd8, 0xa2, 0xf0, 0x47, 0x59, 0xae, 0x9c, 0xf3, 0x6a,
+    0xe6, 0x39, 0x65, 0x2a, 0x38, 0xf4, 0xa6, 0x5e, 0x70, 0x4f, 0x60, 0xac, 0x88, 0xf8, 0x4f, 0x74,
+    0xd3, 0x5c, 0xed, 0xa5, 0xb9, 0x96, 0x93, 0x26, 0xf9, 0xd8, 0xed, 0x71, 0x48, 0x36, 0x50, 0x1a,
+    0xc4, 0x67, 0xc0, 0x05, 0x7d, 0x7d, 0xb1, 0x87, 0xe6, 0x46, 0x0c, 0x1b, 0x40, 0xde, 0x93, 0xac,
+    0x50, 0x34, 0x02, 0xf0, 0xf8, 0xdc, 0x89, 0x53, 0xc2, 0xdc, 0x5d, 0xcd, 0xa9, 0x6d, 0x7c, 0xa7,
+    0x91, 0xf3, 0x8c, 0xaf, 0xc1, 0xbc, 0x11, 0x3b, 0xfe, 0x59, 0x58, 0xb7, 0x1e, 0xf0, 0xf0, 0xbb,
+    0xb3, 0x6e, 0x18, 0xfe, 0x5f, 0x9c, 0xfb, 0x5f, 0x9c, 0xdb, 0xe0, 0xdc, 0xa7, 0x83, 0x9f, 0xbb,
+    0xff, 0x20, 0xce, 0x0d, 0x43, 0xff, 0x0e, 0x8c, 0x1b, 0xa9, 0xee, 0x5f, 0x8c, 0x3b, 0x83, 0xb8,
+    0xc1, 0xb7, 0xf9, 0x33, 0x64, 0xeb, 0xb0, 0xed, 0x32, 0x4f, 0xc7, 0x62, 0xc5, 0x12, 0x5f, 0xc7,
+    0x2f, 0x63, 0xe4, 0x38, 0xf5, 0x7f, 0x1a, 0x19, 0x9c, 0x0c, 0x52, 0xdc, 0x09, 0xcf, 0x74, 0x7c,
+    0x5d, 0xa1, 0x07, 0x5b, 0xbd, 0x16, 0x2d, 0x7a, 0xb0, 0xae, 0x04, 0x93, 0x02, 0x32, 0x3e, 0xd6,
+    0xb9, 0xab, 0x4d, 0x0d, 0xb6, 0xeb, 0xc0, 0xbf, 0xb7, 0x02, 0xfc, 0x14, 0x33, 0xce, 0xe2, 0x8b,
+    0x54, 0xdf, 0xf9, 0x0d, 0x1c, 0x67, 0x9b, 0xe5, 0x01, 0xca, 0xd2, 0x00, 0x95, 0xa2, 0xdc, 0xe8,
+    0xac, 0xf5, 0xa1, 0x9f, 0xe9, 0xa5, 0xdf, 0x42, 0x29, 0x5d, 0x85, 0xf4, 0x34, 0x03, 0x8b, 0xe9,
+    0xf8, 0x9b, 0x60, 0x35, 0xbf, 0x56, 0x40, 0x3f, 0xf7, 0x84, 0x9e, 0xa1, 0xd3, 0xdf, 0x6f, 0xe6,
+    0x11, 0x1e, 0x78, 0x4b, 0x4d, 0x7f, 0x65, 0x87, 0x4b, 0xa9, 0xb7, 0xfa, 0x6a, 0x34, 0xc1, 0x37,
+    0x11, 0x2b, 0x48, 0x25, 0x12, 0xbe, 0xcc, 0x87, 0x5e, 0x6c, 0x3c, 0x64, 0xeb, 0x07, 0xc1, 0x3a,
+    0x0d, 0x61, 0x29, 0x99, 0x8f, 0x01, 0x8c, 0xd5, 0xa4, 0x04, 0x60, 0xf8, 0x50, 0x20, 0xa5, 0x83,
+    0x71, 0xf9, 0xac, 0xb4, 0xe3, 0x05, 0x65, 0x0d, 0x99, 0xcf, 0x35, 0x4f, 0x4c, 0x64, 0x8b, 0x59,
+    0x51, 0x81, 0x50, 0x8c, 0x59, 0xc9, 0xf7, 0xa0, 0xd7, 0xff, 0x13, 0x10, 0xac, 0x3c, 0xe6, 0x6a,
+    0xfe, 0xcb, 0xdd, 0x1c, 0xe5, 0xd5, 0x3e, 0xe8, 0xe9, 0x66, 0x27, 0x2b, 0xc5, 0x20, 0x0b, 0x03,
+    0xe3, 0x70, 0xd5, 0xc2, 0x76, 0x78, 0xe7, 0xcf, 0xb8, 0x97, 0xd9, 0xce, 0x1f, 0x14, 0xff, 0x34,
+    0xf3, 0xc1, 0x85, 0x30, 0x9e, 0x63, 0x8a, 0x1f, 0xe1, 0x81, 0x7a, 0x24, 0x7e, 0xaa, 0xb8, 0x2a,
+    0xab, 0x34, 0xe1, 0x5c, 0x63, 0x0b, 0x7c, 0xfb, 0x17, 0xc6, 0x76, 0x1b, 0xd9, 0x14, 0xea, 0x96,
+    0xce, 0x75, 0xc2, 0xb4, 0x47, 0xe8, 0xe4, 0x91, 0x1b, 0x31, 0xfb, 0x0b, 0xc3, 0xa7, 0x90, 0x0b,
+    0xb1, 0x3a, 0xf9, 0x3c, 0xef, 0xaf, 0x65, 0x0a, 0xa9, 0x5f, 0x4e, 0x4f, 0x8e, 0xd3, 0x34, 0x1a,
+    0x62, 0x40, 0x52, 0x62, 0x0d, 0x42, 0x87, 0xba, 0x4d, 0xbe, 0x3f, 0xcd, 0x70, 0x11, 0xe5, 0xbe,
+    0xee, 0x48, 0x02, 0xd6, 0x21, 0x72, 0x4f, 0x30, 0x0e, 0x66, 0x64, 0x09, 0xfc, 0xc5, 0xf5, 0xba,
+    0x0d, 0xa0, 0x58, 0x8f, 0x36, 0x7f, 0x1b, 0x53, 0x0d, 0xa7, 0x5e, 0xf0, 0xfd, 0xee, 0x0e, 0xf7,
+    0x97, 0xf8, 0x83, 0x25, 0x53, 0xc0, 0xa3, 0x7d, 0x82, 0xa1, 0x8c, 0x80, 0xe1, 0x16, 0x5c, 0x2c,
+    0x52, 0xd2, 0x03, 0xbe, 0xda, 0xd9, 0xe1, 0xd9, 0xc1, 0xe9, 0x01, 0x3d, 0xcc, 0x1e, 0xcb, 0x61,
+    0x54, 0xb6, 0x5c, 0x60, 0x60, 0x74, 0xc0, 0xc9, 0xee, 0x56, 0xd4, 0xc6, 0x87, 0xe6, 0x84, 0x50,
+    0x03, 0x58, 0xc6, 0x61, 0x55, 0xfd, 0x66, 0x94, 0xe4, 0x4a, 0x25, 0x3d, 0x26, 0x88, 0x18, 0x12,
+    0x51, 0xcc, 0xd8, 0x53, 0xe3, 0xb7, 0x24, 0x1d, 0x35, 0x1d, 0x88, 0x95, 0x49, 0x59, 0x89, 0x44,
+    0x3b, 0xdd, 0xcb, 0xa8, 0xe0, 0xd1, 0xd4, 0x21, 0x74, 0xc2, 0xe6, 0xef, 0xaa, 0x9a, 0xb4, 0x5d,
+    0x18, 0x4a, 0x44, 0x20, 0x66, 0xa4, 0x5e, 0x46, 0x91, 0xce, 0x59, 0xeb, 0x23, 0xfa, 0x3b, 0x8c,
+    0x64, 0x4f, 0x6b, 0x71, 0xf6, 0xa2, 0x80, 0xb3, 0xe6, 0xcb, 0xa7, 0xcb, 0x2c, 0xb8, 0x5b, 0xf5,
+    0x39, 0x10, 0x6f, 0x9f, 0x16, 0x5f, 0xf8, 0xd4, 0x5e, 0xff, 0xb5, 0x85, 0x87, 0x6f, 0xf6, 0xee,
+    0x6a, 0xe5, 0xe8, 0x9f, 0x57, 0xbc, 0x34, 0x9a, 0x7f, 0xd1, 0xa2, 0xba, 0xf4, 0xcb, 0x29, 0x23,
+    0x9b, 0x7f, 0xec, 0xdd, 0x19, 0x4e, 0xf9, 0x50, 0x02, 0x5b, 0x18, 0x05, 0xde, 0x94, 0xd5, 0xb6,
+    0x3f, 0xfd, 0x5f, 0x6f, 0xeb, 0xb2, 0xb5, 0x75, 0xb4, 0xb3, 0xf5, 0x1f, 0x17, 0xdb, 0x57, 0x0d,
+    0x72, 0xc8, 0x4f, 0xc3, 0x73, 0x60, 0x55, 0x22, 0xff, 0x37, 0x41, 0x00, 0xa3, 0xc2, 0xc2, 0xcb,
+    0xb4, 0x75, 0x06, 0x20, 0xf0, 0x16, 0xc9, 0x25, 0x46, 0x28, 0xce, 0xe2, 0x30, 0x72, 0xe6, 0xfe,
+    0x6c, 0x0b, 0xf7, 0x73, 0x9f, 0x44, 0x5d, 0x90, 0xca, 0xf0, 0x5d, 0x0d, 0x8a, 0x45, 0xa4, 0xb7,
+    0x53, 0xe8, 0xd9, 0x8e, 0x3b, 0x1f, 0xf6, 0x99, 0x9e, 0xe1, 0x6e, 0x62, 0x47, 0xbd, 0xcb, 0x2d,
+    0xfe, 0x26, 0xf7, 0xdc, 0xbb, 0x81, 0xc3, 0x0e, 0xeb, 0xce, 0xe8, 0x7e, 0xdd, 0x41, 0x2a, 0xa0,
+    0xdf, 0x77, 0xd7, 0x61, 0xc0, 0xf8, 0xf3, 0xb1, 0xde, 0x95, 0xe7, 0x2f, 0x28, 0xa7, 0x57, 0xea,
+    0xf0, 0x47, 0x67, 0x67, 0x4d, 0xf3, 0x4c, 0x55, 0x9c, 0x95, 0x0e, 0x83, 0x70, 0xa2, 0x65, 0x3b,
+    0xd4, 0x5e, 0x9e, 0x5c, 0x3f, 0x04, 0xab, 0xf8, 0x98, 0x91, 0xd4, 0x8a, 0xf1, 0x88, 0x02, 0x9d,
+    0x9e, 0xf9, 0xb7, 0xea, 0xe9, 0x45, 0xfe, 0x29, 0xc8, 0xcb, 0xa0, 0x68, 0x6b, 0x37, 0x2f, 0x83,
+    0x1d, 0xf4, 0x67, 0x5e, 0x4a, 0xac, 0x25, 0x7f, 0xdd, 0x13, 0xbf, 0x20, 0x7c, 0xba, 0x82, 0xe9,
+    0xe4, 0x5f, 0xb2, 0x53, 0xd0, 0x4b, 0xf1, 0xfa, 0x92, 0x27, 0xee, 0xcb, 0x7e, 0xbc, 0x76, 0x7e,
+    0xcc, 0x7e, 0xe8, 0x87, 0x21, 0xf9, 0x58, 0x8b, 0x5a, 0x94, 0x28, 0xc9, 0x12, 0xd1, 0x89, 0x8c,
+    0x4d, 0x0d, 0xfc, 0xc3, 0x4b, 0xac, 0x1d, 0xe7, 0x7b, 0xd9, 0x61, 0xf1, 0x0e, 0x42, 0xe8, 0x68,
+    0x30, 0x87, 0xcf, 0x8f, 0xa6, 0x58, 0x27, 0x00, 0x60, 0x49, 0xca, 0x24, 0x5a, 0x7d, 0x72, 0x69,
+    0x97, 0x5d, 0x4c, 0xc4, 0xef, 0x92, 0x4b, 0xcc, 0x01, 0xd7, 0x88, 0x44, 0x4b, 0x20, 0xfc, 0x2d,
+    0x4b, 0x98, 0x67, 0x06, 0xb0, 0x7a, 0xde, 0x91, 0xc4, 0x18, 0xea, 0x2b, 0xab, 0x60, 0xbb, 0x26,
+    0xe6, 0x9b, 0x93, 0x44, 0xfb, 0x15, 0x27, 0x69, 0xa9, 0x80, 0x4b, 0x4f, 0x87, 0x7e, 0xce, 0x56,
+    0xad, 0xe5, 0xf8, 0xb3, 0x5e, 0x9e, 0xcb, 0x10, 0x36, 0xb9, 0x8d, 0xac, 0x10, 0xf6, 0x6a, 0x24,
+    0xc8, 0x7f, 0x2c, 0xc9, 0x91, 0x59, 0x70, 0x67, 0x10, 0x04, 0x81, 0x89, 0x16, 0x9d, 0x4b, 0xcf,
+    0x47, 0x77, 0xb5, 0x9a, 0xd0, 0x27, 0x23, 0x25, 0x71, 0x6a, 0xdd, 0xb5, 0x89, 0xdb, 0xfa, 0x39,
+    0x68, 0x4e, 0x18, 0x63, 0x8c, 0xd1, 0x93, 0x80, 0x2e, 0x19, 0xe0, 0x5c, 0x24, 0x52, 0xf4, 0xaf,
+    0x80, 0x6b, 0x08, 0xdb, 0x10, 0x52, 0x9d, 0xa0, 0x34, 0x27, 0x01, 0x85, 0x86, 0xe5, 0xe4, 0x1c,
+    0xf9, 0xb0, 0x7b, 0xc6, 0xfb, 0x10, 0xca, 0x0b, 0x5e, 0x85, 0x54, 0x9b, 0x45, 0x3a, 0xc9, 0x13,
+    0x38, 0x71, 0x5a, 0xc9, 0x9e, 0x15, 0xa2, 0x99, 0x0b, 0xd0, 0xd3, 0xc3, 0x22, 0x99, 0x59, 0xe0,
+    0x84, 0x3a, 0xe7, 0x4a, 0x96, 0xbb, 0xb5, 0x0b, 0x47, 0xee, 0xee, 0xce, 0x2a, 0xe9, 0x5e, 0xb8,
+    0x9f, 0xc2, 0x00, 0xdb, 0xbf, 0x6e, 0xd7, 0x7e, 0x9d, 0xbd, 0xac, 0xff, 0xaf, 0xed, 0x26, 0xbb,
+    0x67, 0xd3, 0x8a, 0x71, 0x38, 0x8a, 0xd5, 0xad, 0x2f, 0x89, 0x51, 0x94, 0x44, 0xbd, 0x38, 0xeb,
+    0xf9, 0xa7, 0xdd, 0x0b, 0x73, 0x3e, 0xd9, 0x5f, 0x2a, 0xed, 0x17, 0x87, 0x3d, 0x01, 0x80, 0x6e,
+    0x81, 0x62, 0xe3, 0x5f, 0xfa, 0xf4, 0x8e, 0x29, 0x0c, 0x6b, 0x41, 0xed, 0xcd, 0x52, 0x86, 0x16,
+    0x91, 0x9d, 0xf8, 0xc9, 0xfe, 0x7e, 0x79, 0x76, 0x8d, 0xcf, 0x94, 0xe3, 0xb3, 0xc1, 0x13, 0x7e,
+    0xae, 0x97, 0xea, 0x73, 0x65, 0xba, 0xcf, 0x1c, 0x31, 0xc8, 0xaa, 0xa7, 0x06, 0xe8, 0x58, 0xb1,
+    0xe3, 0xe5, 0x01, 0x1f, 0x5e, 0x0b, 0xb2, 0xb2, 0xa4, 0xde, 0x58, 0x93, 0x08, 0x09, 0xc7, 0xdf,
+    0x33, 0x16, 0xc1, 0x39, 0xe2, 0xa1, 0x07, 0x62, 0x8c, 0xa3, 0x34, 0xe4, 0x09, 0x35, 0x61, 0x41,
+    0x78, 0x57, 0x42, 0x92, 0x7c, 0x83, 0x5f, 0xf3, 0x57, 0xce, 0x72, 0x26, 0x77, 0xc0, 0x77, 0xbe,
+    0xae, 0x86, 0xb5, 0x89, 0x93, 0x26, 0xce, 0x12, 0x3c, 0xf3, 0x9e, 0x36, 0x20, 0xe5, 0x9c, 0x11,
+    0x92, 0x58, 0xc4, 0xc7, 0x7e, 0xc9, 0x1f, 0xf9, 0xe3, 0xab, 0x01, 0x45, 0xbe, 0x41, 0x32, 0x54,
+    0x56, 0x24, 0x35, 0x4c, 0xfe, 0x3c, 0x4e, 0xc6, 0x03, 0x8a, 0x7a, 0xa6, 0xd5, 0x81, 0x57, 0x3b,
+    0x13, 0xbf, 0x5a, 0xce, 0x5f, 0x7b, 0xbe, 0x5f, 0xfd, 0xad, 0x03, 0x4b, 0xba, 0xde, 0x2a, 0xdd,
+    0x38, 0x73, 0xb9, 0x03, 0xa1, 0x9a, 0x6b, 0x4a, 0xfa, 0xdc, 0x57, 0xa8, 0x5d, 0x55, 0x2a, 0x97,
+    0xf9, 0xde, 0x54, 0xa4, 0xfb, 0x3c, 0xd7, 0xd6, 0x91, 0xe7, 0xe1, 0x93, 0xc8, 0x6c, 0x56, 0x57,
+    0x6d, 0x9e, 0x65, 0xf6, 0x4e, 0x6e, 0xb0, 0x94, 0x93, 0x2a, 0x9a, 0xb7, 0x57, 0x9e, 0x03, 0x77,
+    0xb1, 0x0f, 0x72, 0xd4, 0xaa, 0x83, 0xa0, 0x0c, 0xa0, 0x9a, 0x0f, 0x63, 0xa4, 0xf8, 0x2f, 0xce,
+    0x7d, 0xf3, 0xd9, 0x90, 0x24, 0xe0, 0xcf, 0x46, 0x5a, 0xb3, 0xb9, 0x69, 0xf7, 0x24, 0x3e, 0xd2,
+    0x1a, 0xaf, 0x4e, 0xaf, 0x02, 0xbe, 0x25, 0x2c, 0xe6, 0xf6, 0x57, 0x3d, 0x3d, 0x1c, 0x55, 0xd2,
+    0x1a, 0x0b, 0xf3, 0x9d, 0x68, 0x4d, 0x8d, 0xc9, 0x7e, 0x55, 0x68, 0xcd, 0x6b, 0xe0, 0x03, 0x7c,
+    0x86, 0x65, 0x82, 0xc9, 0x8d, 0xc7, 0x7c, 0x01, 0x9f, 0x70, 0x35, 0x17, 0xfc, 0x7d, 0x16, 0x3c,
+    0xc0, 0xd3, 0x87, 0x88, 0xed, 0xd1, 0xe2, 0x68, 0x93, 0x14, 0x27, 0xcd, 0x0c, 0xec, 0xaa, 0x8b,
+    0x67, 0x09, 0xbe, 0xe9, 0x92, 0xff, 0x9c, 0xc5, 0x57, 0x0c, 0xf3, 0xf8, 0x26, 0x35, 0x76, 0x0f,
+    0x3a, 0x10, 0xcc, 0x8e, 0x3f, 0xe4, 0x06, 0x5a, 0x8f, 0x8f, 0x35, 0x8c, 0xa0, 0xd4, 0x84, 0x59,
+    0x1e, 0x77, 0x55, 0x5b, 0x7e, 0xcb, 0x57, 0x6b, 0x61, 0xf0, 0x8a, 0x57, 0x6b, 0xb3, 0x19, 0x57,
+    0x8c, 0xc9, 0xc3, 0x95, 0x90, 0xbd, 0xcb, 0xbe, 0xe8, 0x97, 0x35, 0xf5, 0x11, 0x7f, 0x95, 0x18,
+    0xe5, 0xfe, 0x1a, 0x54, 0xae, 0x37, 0xff, 0x12, 0xfa, 0xa0, 0x1d, 0xff, 0xba, 0xe0, 0xec, 0x09,
+    0xfe, 0x35, 0x5f, 0x3d, 0xd4, 0x1d, 0xec, 0x54, 0xf3, 0x17, 0xcb, 0xd9, 0x07, 0xbe, 0xb5, 0x8d,
+    0x57, 0x5e, 0xc2, 0x2c, 0xb7, 0x5f, 0xc8, 0x55, 0x94, 0x19, 0xdb, 0x70, 0x93, 0x45, 0xce, 0x7d,
+    0xa6, 0x06, 0x35, 0x26, 0x22, 0xf3, 0xee, 0x11, 0x27, 0x9b, 0x34, 0xe4, 0x04, 0xae, 0x3c, 0xcd,
+    0xd2, 0x1e, 0x0c, 0x47, 0xce, 0x60, 0xe8, 0xf4, 0xbb, 0xe3, 0x0f, 0x83, 0xe1, 0x7b, 0xf9, 0xd2,
+    0xbd, 0xce, 0xb9, 0xa0, 0x1f, 0x3b, 0x69, 0xa1, 0x1f, 0x27, 0x7f, 0x9d, 0x4e, 0x3e, 0xe9, 0x84,
+    0xca, 0x31, 0x7a, 0xf4, 0x1c, 0xf2, 0xb7, 0x2f, 0x2c, 0xef, 0xf1, 0xac, 0xfd, 0x34, 0x9f, 0x66,
+    0xc1, 0xb3, 0x3f, 0xa4, 0x29, 0x07, 0xd2, 0x04, 0x16, 0x02, 0xe3, 0x44, 0x16, 0xaf, 0x78, 0x41,
+    0x53, 0xc4, 0x4f, 0x0b, 0xac, 0x5c, 0x27, 0xf6, 0x43, 0x6f, 0x51, 0xfe, 0xc0, 0x9f, 0xac, 0xa1,
+    0xc7, 0x1e, 0x05, 0x78, 0x08, 0xa2, 0x33, 0x9e, 0xd2, 0x41, 0xfe, 0x6a, 0x9a, 0x1a, 0x2d, 0xca,
+    0x6b, 0xda, 0x72, 0xdf, 0xcb, 0xc0, 0xa2, 0xf8, 0x8a, 0x88, 0xc1, 0x42, 0x97, 0x0d, 0xe7, 0x13,
+    0xf5, 0x77, 0x61, 0xa1, 0x75, 0x0b, 0x2b, 0xe4, 0x5d, 0x59, 0x9d, 0xb9, 0x57, 0xe4, 0xd9, 0x57,
+    0x51, 0x60, 0x04, 0xc7, 0xc2, 0x97, 0x6d, 0x7f, 0x42, 0x39, 0xa6, 0xff, 0xb5, 0xf5, 0xff, 0xe3,
+    0xb6, 0xfe, 0x08, 0x38, 0x9f, 0x78, 0x9f, 0xd2, 0xf2, 0x78, 0xb5, 0x78, 0x2e, 0xf1, 0x6c, 0x35,
+    0x02, 0xa8, 0xcf, 0x6a, 0xae, 0x98, 0xbe, 0xd2, 0x69, 0x45, 0x2c, 0xc2, 0xda, 0x4f, 0x6a, 0x2a,
+    0xf1, 0x2b, 0xd2, 0x44, 0x94, 0x3f, 0xf2, 0x88, 0x11, 0x6d, 0x15, 0x20, 0xc0, 0x1c, 0xf7, 0x1a,
+    0xff, 0xbb, 0x5c, 0x06, 0x22, 0x58, 0x61, 0x25, 0x01, 0x94, 0xbd, 0xa4, 0xb7, 0x6f, 0x7d, 0xa7,
+    0x23, 0xeb, 0x59, 0xe6, 0x8d, 0x58, 0xf5, 0x66, 0xc7, 0x37, 0xc3, 0x74, 0x9e, 0x8f, 0xcc, 0x8a,
+    0xe8, 0xe2, 0x39, 0xce, 0xec, 0x45, 0x0f, 0x4b, 0x7a, 0x2b, 0xf1, 0x6d, 0x3d, 0xf2, 0xc8, 0x96,
+    0x84, 0x31, 0xdd, 0x26, 0xe9, 0xe4, 0xef, 0x74, 0x7e, 0x0d, 0xca, 0x11, 0x43, 0x7d, 0x73, 0xda,
+    0x01, 0x74, 0x1f, 0x41, 0x81, 0x16, 0x7f, 0x16, 0x46, 0xc9, 0xe1, 0x32, 0x79, 0xb0, 0xc4, 0x9e,
+    0x4d, 0x63, 0x36, 0x4b, 0x9a, 0xd0, 0xc6, 0xc8, 0xaa, 0x0b, 0x32, 0x09, 0xe0, 0x31, 0x59, 0x9b,
+    0xdf, 0x77, 0x3f, 0x3a, 0xa7, 0xbd, 0xd1, 0x08, 0xef, 0x7f, 0x7a, 0x7d, 0x67, 0xfb, 0x0c, 0xce,
+    0xf2, 0xf6, 0xf1, 0xe0, 0xac, 0xd9, 0x1e, 0xf4, 0x8f, 0xaa, 0x1d, 0x64, 0x04, 0x72, 0xf2, 0xa4,
+    0x3c, 0x67, 0x31, 0x6e, 0x5d, 0xfe, 0x7a, 0x98, 0x1f, 0xa4, 0x2c, 0xce, 0xde, 0x25, 0x2a, 0x79,
+    0x81, 0x48, 0xd9, 0x80, 0xbc, 0x1b, 0xcb, 0xfb, 0x4c, 0xc2, 0x0f, 0xfc, 0x26, 0x43, 0x40, 0xb6,
+    0x48, 0x96, 0x31, 0xd2, 0x62, 0x6b, 0x99, 0x5e, 0xbf, 0x03, 0x52, 0xb2, 0xb4, 0x37, 0x82, 0x60,
+    0xac, 0xf7, 0xa8, 0x12, 0x0a, 0xa3, 0x8f, 0xfd, 0xb6, 0xd3, 0x6e, 0xf5, 0xdb, 0xdd, 0x13, 0xe3,
+    0x1e, 0xb3, 0x3c, 0x5e, 0xf2, 0x51, 0xba, 0xc3, 0x0f, 0x38, 0xfc, 0xd5, 0xa0, 0x13, 0x3e, 0x4b,
+    0xf4, 0xc5, 0x78, 0xd0, 0x18, 0x06, 0x4c, 0x37, 0x54, 0xeb, 0x69, 0x20, 0xfc, 0x1a, 0xf0, 0xb3,
+    0x00, 0xcf, 0x5c, 0xe6, 0x68, 0xdc, 0x1a, 0x8a, 0x3b, 0x57, 0xbd, 0x11, 0x5d, 0x27, 0xa0, 0xd7,
+    0x8d, 0xe1, 0x63, 0x41, 0xaf, 0xc1, 0x32, 0xf3, 0x1d, 0x14, 0xcb, 0x9b, 0x9a, 0x51, 0x31, 0x73,
+    0x93, 0x75, 0xf7, 0x60, 0x95, 0x9c, 0x1b, 0x60, 0x0e, 0x74, 0xd5, 0x6f, 0x49, 0xdd, 0x30, 0xdc,
+    0x2f, 0x1c, 0x55, 0xbb, 0xa9, 0x29, 0x5f, 0x54, 0xb7, 0x2f, 0xd6, 0x44, 0x33, 0x95, 0x66, 0x01,
+    0x03, 0x2a, 0x32, 0x98, 0xc7, 0x30, 0x7a, 0x19, 0x9d, 0x61, 0x58, 0xe6, 0xf8, 0x18, 0x09, 0xe2,
+    0xac, 0xdb, 0xc7, 0x60, 0x62, 0x3d, 0x43, 0x80, 0xe0, 0x3a, 0xe8, 0x67, 0x43, 0x0c, 0xa1, 0x72,
+    0xaf, 0xd5, 0xb4, 0x0c, 0x0a, 0xaa, 0xa8, 0xc5, 0xc4, 0x7e, 0x44, 0x6f, 0x2f, 0x5e, 0xc8, 0x8e,
+    0xb9, 0xd3, 0x48, 0xc9, 0x3e, 0xb6, 0xce, 0xce, 0x4e, 0xb8, 0xcf, 0x20, 0x5f, 0xb3, 0xde, 0x46,
+    0x5b, 0x65, 0x49, 0xef, 0xfc, 0x61, 0x9b, 0xe7, 0xea, 0xd3, 0x5c, 0x15, 0x63, 0x65, 0xae, 0x94,
+    0x5a, 0xf3, 0xb5, 0x06, 0xb2, 0xe0, 0x84, 0x0a, 0x6e, 0xee, 0xea, 0x75, 0x36, 0x18, 0xcb, 0xcc,
+    0x04, 0xb4, 0x34, 0x77, 0xcd, 0x9d, 0x72, 0x3a, 0x83, 0x7e, 0x57, 0xdf, 0x1d, 0x5b, 0xfe, 0x31,
+    0x55, 0x83, 0x02, 0xdc, 0x1b, 0xc0, 0x9c, 0xa4, 0xcc, 0xa1, 0x69, 0x50, 0xbf, 0x07, 0xbb, 0x14,
+    0x97, 0x29, 0xd7, 0x69, 0x1a, 0x25, 0x7b, 0xdb, 0x52, 0x8c, 0x41, 0xda, 0x5e, 0xb0, 0xdb, 0x66,
+    0x18, 0x5f, 0x6d, 0xbf, 0xf5, 0x22, 0xff, 0xc5, 0x2c, 0x38, 0xd8, 0x7d, 0x71, 0xc3, 0x1e, 0xca,
+    0x8c, 0x28, 0xda, 0x54, 0xb5, 0xd4, 0x79, 0x74, 0xbf, 0x4a, 0xd6, 0x78, 0xf7, 0xb7, 0x49, 0xe0,
+    0x2d, 0x6e, 0x94, 0x2b, 0x46, 0xb9, 0x8a, 0x61, 0x77, 0x74, 0x7e, 0x32, 0x1e, 0x39, 0xe3, 0xd6,
+    0xa1, 0x33, 0x00, 0x24, 0xe7, 0x2c, 0xaf, 0x78, 0xda, 0x14, 0x91, 0x9a, 0x6c, 0x06, 0xaa, 0x49,
+    0x29, 0xf3, 0xbc, 0xc8, 0x8e, 0xce, 0xcf, 0xfc, 0x35, 0x9e, 0x3d, 0x67, 0x47, 0x5e, 0x3f, 0x9b,
+    0x98, 0x9b, 0xdf, 0x9f, 0xaa, 0x77, 0xa7, 0xab, 0xc3, 0xea, 0x7d, 0x91, 0x65, 0xa0, 0xf8, 0xd0,
+    0x93, 0x7c, 0xa7, 0x49, 0x9e, 0xbb, 0x15, 0x02, 0xe6, 0xfe, 0x4a, 0x24, 0xe7, 0x9d, 0x21, 0x33,
+    0x04, 0xa6, 0x32, 0xec, 0x75, 0x47, 0x6e, 0x21, 0xbe, 0xd5, 0xee, 0x20, 0xa6, 0x03, 0x40, 0xae,
+    0xde, 0x6e, 0x79, 0x55, 0xb5, 0x71, 0x53, 0xab, 0xdf, 0x5f, 0x87, 0xe6, 0x31, 0x45, 0x70, 0xd9,
+    0xd0, 0x00, 0xfb, 0x86, 0x43, 0xcc, 0x60, 0x8f, 0x86, 0x78, 0x2c, 0x77, 0xa9, 0x29, 0xe1, 0x5b,
+    0x5e, 0x10, 0x84, 0x77, 0x78, 0xf9, 0x15, 0xa5, 0xf6, 0xa7, 0xcf, 0x70, 0xdf, 0x05, 0xc6, 0x61,
+    0x40, 0x1f, 0xd2, 0x14, 0xe2, 0x06, 0xbf, 0xd7, 0x35, 0x4f, 0x00, 0xf9, 0x5a, 0xaa, 0x18, 0xe1,
+    0x98, 0x32, 0xd2, 0xd8, 0xcc, 0xea, 0x3c, 0x80, 0x5d, 0x1d, 0x3b, 0x5b, 0x98, 0x60, 0x24, 0xf2,
+    0x99, 0xab, 0xfd, 0xb2, 0x84, 0xd7, 0x30, 0x81, 0xfc, 0xa9, 0xe2, 0xd2, 0x19, 0xd6, 0xec, 0x8e,
+    0x18, 0x73, 0x98, 0x9e, 0x1f, 0x05, 0x6c, 0x8f, 0x0b, 0x80, 0x0d, 0x6b, 0x25, 0x34, 0x91, 0x25,
+    0x7b, 0xce, 0xa7, 0xcf, 0x62, 0xe3, 0x22, 0x04, 0x24, 0x6c, 0xca, 0x87, 0xb3, 0xd6, 0xd6, 0xa8,
+    0xdb, 0x96, 0xf2, 0xbf, 0x8b, 0xef, 0x78, 0x4c, 0x59, 0x94, 0x52, 0x1a, 0x64, 0x45, 0xd2, 0x83,
+    0xa6, 0xfc, 0xe1, 0x60, 0x20, 0x51, 0x90, 0x6c, 0x53, 0xb2, 0xaf, 0x5e, 0x00, 0x9e, 0x3c, 0x5e,
+    0x14, 0x1d, 0x38, 0x2c, 0xa6, 0x7f, 0x13, 0x90, 0x28, 0x61, 0xd3, 0xaa, 0x81, 0xed, 0xd2, 0x1f,
+    0xf2, 0x3c, 0x7f, 0xcb, 0x7f, 0x7e, 0xda, 0xb9, 0x70, 0xf6, 0x94, 0x6b, 0x52, 0x7b, 0xb2, 0xd3,
+    0xb5, 0xf7, 0x68, 0xbd, 0x1d, 0x79, 0xb4, 0x88, 0x00, 0xc2, 0xf6, 0x98, 0x09, 0x01, 0xda, 0x50,
+    0x78, 0x29, 0x43, 0xdc, 0xc5, 0xfe, 0x2e, 0x5c, 0xd9, 0x29, 0x9b, 0x33, 0xa4, 0xf2, 0x47, 0xe3,
+    0x22, 0xda, 0xf2, 0x15, 0xaf, 0xfe, 0xaa, 0x5e, 0x05, 0x99, 0x50, 0xc5, 0x1b, 0xe2, 0x71, 0x56,
+    0xa4, 0x87, 0xec, 0xb2, 0x86, 0x2a, 0xd9, 0x53, 0xc5, 0xae, 0x86, 0xd5, 0xe3, 0x17, 0xf3, 0x08,
+    0x0b, 0x3a, 0xe8, 0x7b, 0xad, 0x32, 0x91, 0x73, 0x79, 0xc4, 0xae, 0xe6, 0x24, 0x36, 0xfe, 0x51,
+    0xbd, 0x26, 0xab, 0xba, 0x62, 0x4a, 0x7a, 0x62, 0x7d, 0x9a, 0x10, 0xd0, 0xef, 0xec, 0xe9, 0x89,
+    0x62, 0x2a, 0x8e, 0x84, 0x49, 0x10, 0x4e, 0x6c, 0x8a, 0x28, 0x5d, 0x29, 0xe5, 0x8f, 0x7b, 0x9a,
+    0x27, 0x44, 0xc1, 0xee, 0x8d, 0xfd, 0x5c, 0x34, 0xd4, 0x17, 0xc9, 0xa5, 0xf1, 0x5b, 0xf3, 0xa1,
+    0x0e, 0xa7, 0x29, 0x4b, 0xb7, 0x78, 0x42, 0x69, 0xd7, 0xe2, 0x00, 0xbd, 0xc6, 0x79, 0x9e, 0x2c,
+    0x27, 0x73, 0x3f, 0xdd, 0xf0, 0x34, 0xd7, 0xaf, 0x6b, 0x56, 0x78, 0xc8, 0x65, 0x57, 0x35, 0x77,
+    0x6c, 0x52, 0xbc, 0xad, 0xc9, 0x8f, 0xad, 0x4b, 0xf5, 0xaa, 0xde, 0xb8, 0x70, 0x51, 0x2e, 0x5a,
+    0x1a, 0x98, 0x05, 0x07, 0x01, 0xb1, 0x08, 0xb7, 0xa6, 0x61, 0x8c, 0x9c, 0x0c, 0x67, 0xc8, 0x53,
+    0x70, 0x03, 0xe7, 0x73, 0x85, 0xa7, 0xae, 0x0e, 0x8f, 0x2c, 0x7b, 0x14, 0x59, 0x91, 0x44, 0x72,
+    0x35, 0xad, 0x20, 0x4b, 0x78, 0x73, 0x40, 0x26, 0x35, 0x9b, 0x8f, 0x5e, 0xa9, 0x65, 0x58, 0xeb,
+    0xc8, 0xa0, 0xb2, 0x62, 0xd3, 0xcc, 0xa2, 0x58, 0xd6, 0xac, 0xcc, 0xad, 0x55, 0xe2, 0x24, 0x68,
+    0x00, 0x5d, 0x4a, 0xcf, 0x42, 0x4f, 0x89, 0x3a, 0x28, 0xf6, 0x1d, 0x0d, 0x86, 0x56, 0x24, 0x2d,
+    0x57, 0x4c, 0x40, 0x7c, 0x70, 0x6a, 0x87, 0x27, 0xbd, 0x7e, 0xa7, 0xbe, 0x57, 0xda, 0x54, 0x53,
+    0xf8, 0xbf, 0xa2, 0xbc, 0x80, 0x54, 0xa5, 0x10, 0x79, 0x36, 0x34, 0x09, 0x36, 0x5b, 0xe5, 0x84,
+    0xaf, 0xe5, 0x0c, 0xb4, 0x50, 0x34, 0x5a, 0x9c, 0x36, 0x37, 0x41, 0x90, 0xa5, 0x0b, 0xb3, 0xb6,
+    0xa3, 0x7b, 0xae, 0x52, 0x36, 0x0e, 0x6f, 0xd8, 0xc2, 0x94, 0xb5, 0xf1, 0x03, 0x0f, 0x8d, 0x1a,
+    0x76, 0x3b, 0xa3, 0xaf, 0x62, 0x9e, 0x40, 0xdd, 0x5a, 0x79, 0x36, 0x79, 0x53, 0xed, 0xfa, 0x79,
+    0xb5, 0x7a, 0x9d, 0x4d, 0xb8, 0x52, 0x7d, 0xb4, 0x4f, 0xb3, 0xc4, 0x80, 0x60, 0xf6, 0xba, 0x99,
+    0xda, 0x8e, 0x2a, 0x7b, 0x78, 0xd3, 0xd6, 0x5f, 0x2f, 0x5d, 0x4f, 0x63, 0x2f, 0x6a, 0xeb, 0xb9,
+    0x95, 0xd2, 0xa6, 0xaf, 0x4b, 0x5d, 0x5d, 0x0c, 0x27, 0xd5, 0xf5, 0xdc, 0xe3, 0x5f, 0xce, 0xc3,
+    0xf0, 0x76, 0x52, 0x3a, 0xa7, 0x9b, 0x73, 0x4c, 0x49, 0xa6, 0x49, 0xd3, 0x25, 0x09, 0xa6, 0x1f,
+    0xab, 0x74, 0xe9, 0x22, 0xd8, 0x50, 0x43, 0x14, 0x69, 0x3d, 0xc4, 0x3c, 0x2a, 0x6d, 0x03, 0x25,
+    0xea, 0xa3, 0x8d, 0x08, 0x2a, 0x0e, 0xb6, 0x6c, 0x0a, 0xe7, 0x67, 0xe8, 0x9b, 0xf9, 0x4f, 0x75,
+    0xb8, 0x91, 0x20, 0x3a, 0x4d, 0x6e, 0x6d, 0x87, 0x99, 0xb7, 0x24, 0x43, 0xf3, 0x24, 0x0d, 0xbd,
+    0x9a, 0x49, 0xb8, 0xe8, 0xfd, 0x4d, 0xda, 0x91, 0x49, 0xbc, 0x5f, 0x72, 0x5e, 0xd9, 0x0f, 0xab,
+    0x72, 0xf7, 0x02, 0x79, 0xcc, 0x82, 0x8a, 0xcc, 0xa7, 0x80, 0x8f, 0x84, 0x53, 0x0c, 0xd5, 0xed,
+    0xab, 0x6d, 0xec, 0x45, 0xf8, 0x1f, 0x3c, 0xf9, 0xb5, 0x12, 0xb4, 0x27, 0x86, 0xb1, 0xff, 0x37,
+    0x3a, 0xfc, 0xd1, 0xdd, 0xfd, 0xd0, 0x4b, 0xfc, 0x29, 0xb7, 0x7d, 0x20, 0x70, 0xac, 0xd1, 0x54,
+    0x74, 0x66, 0x1a, 0x0f, 0x47, 0xd1, 0xf9, 0x49, 0x87, 0xa7, 0x35, 0x7a, 0x0a, 0x09, 0x74, 0x26,
+    0x7c, 0x30, 0x34, 0x61, 0x8d, 0xb0, 0x42, 0x7e, 0x2a, 0x06, 0x55, 0xe9, 0xa7, 0x83, 0xdd, 0x25,
+    0x8e, 0x78, 0x2c, 0xf5, 0x00, 0x7f, 0xe0, 0xbf, 0x32, 0xec, 0x8a, 0xec, 0x3d, 0xb6, 0x87, 0x8b,
+    0x4d, 0xd7, 0x89, 0x1a, 0xb5, 0x86, 0xe3, 0x9b, 0x5a, 0xcb, 0xb8, 0x0c, 0x7c, 0xdd, 0x55, 0xf9,
+    0x0d, 0x3a, 0x45, 0xcd, 0x3d, 0x1e, 0x8f, 0xcf, 0x1c, 0xc3, 0xa7, 0xa2, 0x2a, 0x09, 0x4d, 0xd9,
+    0xc5, 0x87, 0x0d, 0xb7, 0x2d, 0x94, 0xe4, 0x0c, 0xde, 0xff, 0x8e, 0x27, 0xa9, 0x39, 0xf8, 0x37,
+    0x3a, 0x4d, 0x55, 0xf6, 0x57, 0xf1, 0xcc, 0xf8, 0x57, 0x21, 0x4e, 0xdc, 0xa1, 0x64, 0xb8, 0x29,
+    0x65, 0x51, 0xab, 0xed, 0x25, 0x8c, 0x54, 0x20, 0xac, 0x2f, 0x20, 0x9e, 0x95, 0x44, 0x42, 0x48,
+    0x9d, 0xcd, 0xd8, 0x1e, 0x09, 0xa5, 0xb0, 0xfb, 0x71, 0x0b, 0x5f, 0x6e, 0xa2, 0x3d, 0xca, 0xd0,
+    0x32, 0x6f, 0x2d, 0x70, 0xd3, 0xaa, 0x9f, 0x19, 0x69, 0xa6, 0x1e, 0x6d, 0x40, 0xfb, 0x13, 0x10,
+    0x60, 0x06, 0xb4, 0xbc, 0x5b, 0x33, 0xd8, 0x51, 0x69, 0x61, 0xb8, 0xfe, 0x52, 0x59, 0x33, 0xf6,
+    0x16, 0x78, 0xb4, 0x66, 0x5d, 0xf2, 0x02, 0x20, 0xd4, 0x5a, 0x5e, 0x84, 0x7f, 0xe1, 0xcd, 0xd2,
+    0x34, 0x01, 0x92, 0xb3, 0x15, 0xf3, 0x46, 0x7b, 0x78, 0xa0, 0x62, 0xba, 0xcc, 0xc2, 0xe8, 0xda,
+    0x00, 0x4a, 0x6f, 0x50, 0xb9, 0x38, 0xa3, 0x3b, 0xff, 0x12, 0xa3, 0x86, 0x12, 0xcc, 0xf7, 0x33,
+    0x0d, 0x6f, 0x19, 0xa0, 0xd0, 0x07, 0xff, 0xc8, 0xc7, 0xca, 0xfc, 0x23, 0x3f, 0x36, 0xf5, 0x81,
+    0x78, 0xd3, 0x29, 0xa3, 0x30, 0x27, 0xb5, 0x69, 0x1b, 0x8b, 0xa8, 0x29, 0x7e, 0x2c, 0x6f, 0x3a,
+    0x49, 0x8d, 0x86, 0x87, 0x29, 0x6f, 0x36, 0x49, 0x6d, 0x8d, 0x4a, 0x2f, 0xd4, 0x4a, 0x2f, 0x45,
+    0xf9, 0x30, 0x14, 0x02, 0xdb, 0x30, 0xe3, 0x5d, 0xe9, 0x5b, 0xbd, 0x61, 0x89, 0x96, 0x2d, 0xe3,
+    0x00, 0x1c, 0xb9, 0x28, 0x49, 0x98, 0xbb, 0x39, 0xcb, 0x29, 0xc5, 0xd3, 0x15, 0xc9, 0x29, 0x4b,
+    0x98, 0x88, 0xf2, 0x6e, 0xb9, 0xc8, 0xe4, 0x4a, 0x0f, 0x86, 0xad, 0x7a, 0x95, 0x21, 0x11, 0x49,
+    0x5f, 0x8d, 0x94, 0xa9, 0xd2, 0x47, 0x27, 0xf7, 0x7e, 0x44, 0x7f, 0x89, 0x74, 0xe4, 0xff, 0x8d,
+    0xf1, 0x6c, 0x8c, 0xaa, 0xa0, 0xcf, 0xd3, 0x33, 0xbe, 0x76, 0x76, 0x77, 0x5e, 0xfd, 0x98, 0x19,
+    0xe7, 0xb2, 0x2c, 0xf1, 0x87, 0xee, 0xbe, 0xb5, 0xe6, 0xf7, 0x5a, 0x75, 0xfe, 0x69, 0x9b, 0xca,
+    0x9a, 0x69, 0x78, 0xe4, 0xdf, 0xb3, 0x59, 0x8d, 0x07, 0x9d, 0xbd, 0xaf, 0xea, 0xa0, 0xb4, 0x17,
+    0x6b, 0x57, 0xa7, 0xba, 0x27, 0x92, 0x59, 0xdd, 0x68, 0xf3, 0x8a, 0xda, 0xbc, 0x33, 0xdc, 0xad,
+    0x18, 0xa5, 0xe4, 0x3e, 0x4e, 0xe7, 0x41, 0x2d, 0x31, 0xe2, 0x40, 0x92, 0x3c, 0x0a, 0xe4, 0xc5,
+    0xf6, 0x55, 0xc3, 0x7d, 0xe1, 0xcd, 0xa3, 0x7d, 0x80, 0x6d, 0x56, 0xfa, 0x9a, 0x4a, 0x83, 0x54,
+    0x2b, 0x7c, 0x43, 0x85, 0x57, 0x7a, 0xe1, 0x77, 0x54, 0xf8, 0xd7, 0x65, 0x88, 0xc5, 0x34, 0x81,
+    0x67, 0xff, 0x1f, 0xcb, 0xb4, 0x43, 0xa8, 0x91, 0xdc, 0x00, 0x00,
+};
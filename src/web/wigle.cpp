@@ -11,19 +11,25 @@
 #include "../core/config.h"
 #include "../core/sd_layout.h"
 #include "../core/heap_gates.h"
+#include "../core/heap_trace.h"
 #include "../core/wifi_utils.h"
 #include "../core/network_recon.h"
 #include "../core/sdlog.h"
+#include "../core/membership_file.h"
 #include "../piglet/mood.h"
 
 // Static member initialization
-std::vector<String> WiGLE::uploadedFiles;
-bool WiGLE::listLoaded = false;
 volatile bool WiGLE::busy = false;
 char WiGLE::lastError[64] = "";
 bool WiGLE::batchMode = false;
 
-static const size_t WIGLE_MAX_UPLOADED = 200;
+// Uploaded CSV names (hashed set over the uploaded list)
+static MembershipFile uploadedSet;
+
+static const char* baseNameOf(const char* path) {
+    const char* slash = strrchr(path, '/');
+    return slash ? slash + 1 : path;
+}
 
 // RAII helper for busy flag
 struct BusyScope {
@@ -45,52 +51,19 @@ const char* WiGLE::getLastError() {
 // ============================================================================
 
 bool WiGLE::loadUploadedList() {
-    if (listLoaded) return true;
-
-    uploadedFiles.clear();
-    uploadedFiles.reserve(WIGLE_MAX_UPLOADED);
-
-    const char* uploadedPath = SDLayout::wigleUploadedPath();
-    if (!SD.exists(uploadedPath)) {
-        listLoaded = true;
-        return true;
-    }
-
-    File f = SD.open(uploadedPath, FILE_READ);
-    if (!f) return false;
-
-    while (f.available() && uploadedFiles.size() < WIGLE_MAX_UPLOADED) {
-        String line = f.readStringUntil('\n');
-        line.trim();
-        if (!line.isEmpty() && line.length() < 100) {
-            uploadedFiles.push_back(line);
-        }
-    }
-
-    f.close();
-    listLoaded = true;
-    Serial.printf("[WIGLE] Loaded %d uploaded files from tracking\n", uploadedFiles.size());
+    if (uploadedSet.isLoaded()) return true;
+    if (!uploadedSet.load(SDLayout::wigleUploadedPath())) return false;
+    Serial.printf("[WIGLE] Loaded %u uploaded files from tracking\n", (unsigned int)uploadedSet.size());
     return true;
 }
 
 bool WiGLE::saveUploadedList() {
-    const char* uploadedPath = SDLayout::wigleUploadedPath();
-    File f = SD.open(uploadedPath, FILE_WRITE);
-    if (!f) return false;
-
-    for (const auto& filename : uploadedFiles) {
-        f.println(filename);
-    }
-
-    f.close();
-    return true;
+    return uploadedSet.saveIndex();
 }
 
 void WiGLE::freeUploadedListMemory() {
-    size_t count = uploadedFiles.size();
-    uploadedFiles.clear();
-    uploadedFiles.shrink_to_fit();
-    listLoaded = false;
+    size_t count = uploadedSet.size();
+    uploadedSet.release();
     Serial.printf("[WIGLE] Freed uploaded list: %u entries\n", (unsigned int)count);
 }
 
@@ -107,34 +80,16 @@ bool WiGLE::isUploaded(const char* filename) {
     if (!filename) return false;
     loadUploadedList();
 
-    String fullPath = String(filename);
-    String baseName = getFilenameFromPath(filename);
-
-    for (const auto& f : uploadedFiles) {
-        if (f.equals(fullPath) || f.equals(baseName)) return true;
-    }
-    return false;
+    // Entries are base names; older lists may hold full paths
+    return uploadedSet.contains(filename) || uploadedSet.contains(baseNameOf(filename));
 }
 
 void WiGLE::markAsUploaded(const char* filename) {
     if (!filename) return;
     loadUploadedList();
-    
-    String baseName = getFilenameFromPath(filename);
-    
-    // Check if already in list
-    for (const auto& f : uploadedFiles) {
-        if (f.equals(baseName)) return;
-    }
-    
-    if (uploadedFiles.size() >= WIGLE_MAX_UPLOADED) {
-        // Cap in-memory list to avoid unbounded heap growth.
-        return;
-    }
-    uploadedFiles.push_back(baseName);
-    if (!batchMode) {
-        saveUploadedList();  // Only save immediately if not in batch mode
-    }
+
+    // Appends to the text list; batch mode defers only the sidecar write
+    uploadedSet.add(baseNameOf(filename), !batchMode);
 }
 
 void WiGLE::beginBatchUpload() {
@@ -144,7 +99,7 @@ void WiGLE::beginBatchUpload() {
 void WiGLE::endBatchUpload() {
     if (batchMode) {
         batchMode = false;
-        saveUploadedList();  // Single save at end of batch
+        saveUploadedList();  // Single sidecar write at end of batch
         Serial.println("[WIGLE] Batch upload complete, saved uploaded list");
     }
 }
@@ -153,27 +108,14 @@ void WiGLE::removeFromUploaded(const char* filename) {
     if (!filename) return;
     loadUploadedList();
 
-    String fullPath = String(filename);
-    String baseName = getFilenameFromPath(filename);
-
-    bool changed = false;
-    for (auto it = uploadedFiles.begin(); it != uploadedFiles.end(); ) {
-        if (it->equals(fullPath) || it->equals(baseName)) {
-            it = uploadedFiles.erase(it);
-            changed = true;
-        } else {
-            ++it;
-        }
-    }
-
-    if (changed) {
-        saveUploadedList();
-    }
+    uploadedSet.remove(filename);
+    uploadedSet.remove(baseNameOf(filename));
 }
 
 uint16_t WiGLE::getUploadedCount() {
     loadUploadedList();
-    return uploadedFiles.size();
+    size_t n = uploadedSet.size();
+    return n > 0xFFFF ? 0xFFFF : (uint16_t)n;
 }
 
 // ============================================================================
@@ -248,6 +190,7 @@ bool WiGLE::canSync() {
 }
 
 bool WiGLE::uploadSingleFile(const char* csvPath) {
+    HeapTrace::Scope heapTag(HeapTrace::Tag::Tls);
     if (!csvPath) return false;
     
     Serial.printf("[WIGLE] Uploading: %s\n", csvPath);
@@ -460,6 +403,7 @@ bool WiGLE::uploadSingleFile(const char* csvPath) {
 }
 
 bool WiGLE::fetchStats() {
+    HeapTrace::Scope heapTag(HeapTrace::Tag::Tls);
     Serial.println("[WIGLE] Fetching user stats...");
     
     // Build Basic Auth header
@@ -745,17 +689,8 @@ WigleSyncResult WiGLE::syncFiles(WigleProgressCallback cb) {
         loadUploadedList();
         for (uint8_t i = 0; i < pendingCount; i++) {
             if (successMask[i]) {
-                String baseName = getFilenameFromPath(pendingUploads[i].path);
-                // Check if already in list (avoid duplicates)
-                bool found = false;
-                for (const auto& f : uploadedFiles) {
-                    if (f.equals(baseName)) { found = true; break; }
-                }
-                if (!found) {
-                    if (uploadedFiles.size() < WIGLE_MAX_UPLOADED) {
-                        uploadedFiles.push_back(baseName);
-                    }
-                }
+                // add() skips names already in the list
+                uploadedSet.add(baseNameOf(pendingUploads[i].path), false);
             }
         }
         saveUploadedList();
@@ -62,11 +62,10 @@ public:
     /**
      * @brief Free the uploaded files list from memory.
      *
-     * The uploadedFiles vector can consume heap proportional to the number
-     * of entries tracked.  Before performing TLS operations that require
-     * large contiguous heap blocks, callers may persist the list and then
-     * call this function to clear it.  It resets the lazy load flag so
-     * that the list will be reloaded from disk on the next access.
+     * The uploaded set holds 8 bytes per tracked file.  Before performing
+     * TLS operations that require large contiguous heap blocks, callers may
+     * call this function to free it (pending sidecar writes are flushed).
+     * The set is reloaded from its sidecar on the next access.
      */
     static void freeUploadedListMemory();
     
@@ -89,9 +88,7 @@ public:
     static const char* getLastError();
     
 private:
-    // Uploaded files tracking
-    static std::vector<String> uploadedFiles;
-    static bool listLoaded;  // Guard for lazy loading
+    // Uploaded files tracking lives in wigle.cpp (hashed set, core/membership_file.h)
     static volatile bool busy;
     static char lastError[64];
     static bool batchMode;  // Batch upload mode flag
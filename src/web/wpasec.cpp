@@ -3,8 +3,11 @@
 
 #include "wpasec.h"
 #include "../core/sd_layout.h"
+#include "../core/cracked_index.h"
+#include "../core/membership_file.h"
 #include "../core/config.h"
 #include "../core/heap_gates.h"
+#include "../core/heap_trace.h"
 #include "../core/wifi_utils.h"
 #include "../core/network_recon.h"
 #include "../piglet/mood.h"
@@ -13,37 +16,37 @@
 #include <WiFiClientSecure.h>
 #include <ctype.h>
 #include <esp_heap_caps.h>
+#include <algorithm>
 
 // WPA-SEC API
 static const char* WPASEC_HOST = "wpa-sec.stanev.org";
 static const uint16_t WPASEC_PORT = 443;
 static const char* WPASEC_UPLOAD_PATH = "/";
 static const char* WPASEC_POTFILE_PATH = "/?api&dl=1";
-static const size_t WPASEC_MAX_CACHE_ENTRIES = 500;
 
 // Static member initialization
 bool WPASec::cacheLoaded = false;
 char WPASec::lastError[64] = "";
-std::map<String, WPASec::CacheEntry> WPASec::crackedCache;
-std::map<String, bool> WPASec::uploadedCache;
 volatile bool WPASec::busy = false;
 bool WPASec::batchMode = false;
 
-bool WPASec::isBusy() {
-    return busy;
+// Uploaded list lines may be written with separators or in lowercase
+static bool uploadedKey(const char* line, size_t len, char* out, size_t outLen) {
+    size_t n = 0;
+    for (size_t i = 0; i < len; i++) {
+        char c = line[i];
+        if (c == ':' || c == '-') continue;
+        if (n + 1 >= outLen) return false;
+        out[n++] = (char)toupper((unsigned char)c);
+    }
+    out[n] = '\0';
+    return n > 0;
 }
 
-String WPASec::normalizeBSSID(const char* bssid) {
-    if (!bssid) return "";
-    String out = "";
-    out.reserve(12);
-    for (int i = 0; bssid[i]; i++) {
-        char c = bssid[i];
-        if (c != ':' && c != '-') {
-            out += (char)toupper(c);
-        }
-    }
-    return out;
+static MembershipFile uploadedSet(uploadedKey);
+
+bool WPASec::isBusy() {
+    return busy;
 }
 
 void WPASec::normalizeBSSID_Char(const char* bssid, char* output, size_t outLen) {
@@ -59,86 +62,360 @@ void WPASec::normalizeBSSID_Char(const char* bssid, char* output, size_t outLen)
 }
 
 // ============================================================================
-// Cache Management (disk only)
+// Cracked index (sorted BSSID -> potfile offset, see core/cracked_index.h)
 // ============================================================================
 
-bool WPASec::loadUploadedList() {
-    uploadedCache.clear();
-    const char* uploadedPath = SDLayout::wpasecUploadedPath();
-    if (!SD.exists(uploadedPath)) return true;
+// Entries per sorted run while building (bounded RAM, freed after)
+static const size_t INDEX_RUN_ENTRIES = 256;
+// Entries buffered per run source/sink during a merge pass
+static const size_t INDEX_IO_ENTRIES = 16;
+static const size_t INDEX_CACHE_PAGES = 4;
 
-    File f = SD.open(uploadedPath, FILE_READ);
-    if (!f) {
-        strncpy(lastError, "CANNOT OPEN UPLOADED", sizeof(lastError) - 1);
+static File crackedIndexFile;
+static CrackedIndex::Header crackedIndexHeader = {};
+static CrackedIndex::PageCache<INDEX_CACHE_PAGES> crackedIndexCache;
+static bool crackedIndexReady = false;
+
+// Last failed build, keyed on the potfile it was built from. Lookups don't
+// re-run the external sort until the potfile changes (or a sync rewrites it).
+static bool crackedIndexFailed = false;
+static uint32_t failedPotSize = 0;
+static uint32_t failedPotMtime = 0;
+
+// Buffered reader over entries [pos, end) of a runs file
+struct IndexRunSource {
+    File* f;
+    uint32_t pos;
+    uint32_t end;
+    uint8_t buf[INDEX_IO_ENTRIES * CrackedIndex::kEntryLen];
+    uint16_t bufN;
+    uint16_t bufI;
+
+    IndexRunSource(File* file, uint32_t from, uint32_t to) : f(file), pos(from), end(to), bufN(0), bufI(0) {}
+
+    bool next(CrackedIndex::Entry& e) {
+        if (bufI == bufN) {
+            if (pos >= end) return false;
+            uint32_t n = end - pos;
+            if (n > INDEX_IO_ENTRIES) n = INDEX_IO_ENTRIES;
+            size_t bytes = n * CrackedIndex::kEntryLen;
+            // Both sources share one handle, so seek on every refill
+            if (!f->seek(pos * CrackedIndex::kEntryLen) || f->read(buf, bytes) != bytes) return false;
+            pos += n;
+            bufN = (uint16_t)n;
+            bufI = 0;
+        }
+        CrackedIndex::decodeEntry(buf + bufI * CrackedIndex::kEntryLen, e);
+        bufI++;
+        return true;
+    }
+};
+
+struct IndexSink {
+    File* f;
+    uint8_t buf[INDEX_IO_ENTRIES * CrackedIndex::kEntryLen];
+    uint16_t n;
+
+    explicit IndexSink(File* file) : f(file), n(0) {}
+
+    bool put(const CrackedIndex::Entry& e) {
+        CrackedIndex::encodeEntry(buf + n * CrackedIndex::kEntryLen, e);
+        if (++n == INDEX_IO_ENTRIES) return flush();
+        return true;
+    }
+    bool flush() {
+        size_t bytes = n * CrackedIndex::kEntryLen;
+        n = 0;
+        return bytes == 0 || f->write(buf, bytes) == bytes;
+    }
+};
+
+static void closeCrackedIndex() {
+    if (crackedIndexFile) crackedIndexFile.close();
+    crackedIndexCache.reset();
+    memset(&crackedIndexHeader, 0, sizeof(crackedIndexHeader));
+    crackedIndexReady = false;
+}
+
+// Sort and append one run
+static bool flushIndexRun(File& runs, CrackedIndex::Entry* run, size_t n) {
+    std::sort(run, run + n, CrackedIndex::entryLess);
+    uint8_t rec[CrackedIndex::kEntryLen];
+    for (size_t i = 0; i < n; i++) {
+        CrackedIndex::encodeEntry(rec, run[i]);
+        if (runs.write(rec, sizeof(rec)) != sizeof(rec)) return false;
+    }
+    return true;
+}
+
+// Potfile -> sorted runs of INDEX_RUN_ENTRIES. Returns entries written, -1 on error.
+static long writeIndexRuns(File& pot, File& runs) {
+    CrackedIndex::Entry* run = (CrackedIndex::Entry*)malloc(INDEX_RUN_ENTRIES * sizeof(CrackedIndex::Entry));
+    if (!run) return -1;
+
+    static char line[CrackedIndex::kMaxLineLen + 1];
+    uint8_t chunk[256];
+    size_t lineLen = 0;
+    bool overlong = false;
+    uint32_t lineStart = 0;
+    uint32_t pos = 0;
+    size_t runN = 0;
+    long total = 0;
+    bool ok = true;
+
+    while (ok) {
+        int n = pot.read(chunk, sizeof(chunk));
+        bool eof = n <= 0;
+        for (int i = 0; i < n || (eof && i == 0); i++) {
+            bool endOfLine = eof || chunk[i] == '\n';
+            if (!endOfLine) {
+                if (lineLen < CrackedIndex::kMaxLineLen) line[lineLen++] = (char)chunk[i];
+                else overlong = true;
+                continue;
+            }
+            CrackedIndex::PotLine pl;
+            if (!overlong && lineLen > 0 && CrackedIndex::parsePotLine(line, lineLen, pl)) {
+                memcpy(run[runN].key, pl.key, 6);
+                run[runN].offset = lineStart;
+                if (++runN == INDEX_RUN_ENTRIES) {
+                    ok = flushIndexRun(runs, run, runN);
+                    total += runN;
+                    runN = 0;
+                }
+            }
+            lineLen = 0;
+            overlong = false;
+            lineStart = pos + i + 1;
+            if (eof) break;
+        }
+        if (eof) break;
+        pos += n;
+        yield();
+    }
+    if (ok && runN > 0) {
+        ok = flushIndexRun(runs, run, runN);
+        total += runN;
+    }
+    free(run);
+    return ok ? total : -1;
+}
+
+// One pass: merge neighbouring runs of runLen from src into dst
+static bool mergeIndexPass(const char* srcPath, const char* dstPath, uint32_t runLen, uint32_t total) {
+    File src = SD.open(srcPath, FILE_READ);
+    if (SD.exists(dstPath)) SD.remove(dstPath);
+    File dst = SD.open(dstPath, FILE_WRITE);
+    bool ok = src && dst;
+    IndexSink sink(&dst);
+    for (uint32_t start = 0; ok && start < total; start += 2 * runLen) {
+        uint32_t mid = start + runLen < total ? start + runLen : total;
+        uint32_t end = mid + runLen < total ? mid + runLen : total;
+        IndexRunSource a(&src, start, mid);
+        IndexRunSource b(&src, mid, end);
+        ok = CrackedIndex::mergeRuns(a, b, sink, false) >= 0 && sink.flush();
+        yield();
+    }
+    if (src) src.close();
+    if (dst) dst.close();
+    return ok;
+}
+
+bool WPASec::buildCrackedIndex() {
+    closeCrackedIndex();
+
+    const char* potPath = SDLayout::wpasecResultsPath();
+    const char* indexPath = SDLayout::wpasecIndexPath();
+    char runPathA[64];
+    char runPathB[64];
+    char tmpPath[64];
+    snprintf(runPathA, sizeof(runPathA), "%s.ra", indexPath);
+    snprintf(runPathB, sizeof(runPathB), "%s.rb", indexPath);
+    snprintf(tmpPath, sizeof(tmpPath), "%s.tmp", indexPath);
+
+    File pot = SD.open(potPath, FILE_READ);
+    if (!pot) {
+        strncpy(lastError, "CANNOT OPEN CACHE", sizeof(lastError) - 1);
         lastError[sizeof(lastError) - 1] = '\0';
         return false;
     }
+    CrackedIndex::Header header = {};
+    header.potfileSize = (uint32_t)pot.size();
+    header.potfileMtime = (uint32_t)pot.getLastWrite();
 
-    String line;
-    line.reserve(64);  // Pre-allocate to reduce heap fragmentation
-    while (f.available() && uploadedCache.size() < WPASEC_MAX_CACHE_ENTRIES) {
-        line = f.readStringUntil('\n');  // Reuses existing capacity
-        line.trim();
-        if (!line.isEmpty()) {
-            String key = normalizeBSSID(line.c_str());
-            if (!key.isEmpty()) {
-                uploadedCache[key] = true;
+    if (SD.exists(runPathA)) SD.remove(runPathA);
+    File runs = SD.open(runPathA, FILE_WRITE);
+    long total = runs ? writeIndexRuns(pot, runs) : -1;
+    pot.close();
+    if (runs) runs.close();
+
+    // Two-way merge passes until two runs are left for the final pass
+    const char* src = runPathA;
+    const char* dst = runPathB;
+    uint32_t runLen = INDEX_RUN_ENTRIES;
+    bool ok = total >= 0;
+    while (ok && (uint32_t)total > 2 * runLen) {
+        ok = mergeIndexPass(src, dst, runLen, (uint32_t)total);
+        const char* t = src;
+        src = dst;
+        dst = t;
+        runLen *= 2;
+    }
+
+    // Final pass: dedupe into the index file behind its header
+    if (ok) {
+        File in = SD.open(src, FILE_READ);
+        if (SD.exists(tmpPath)) SD.remove(tmpPath);
+        File out = SD.open(tmpPath, FILE_WRITE);
+        uint8_t hdr[CrackedIndex::kHeaderLen];
+        CrackedIndex::encodeHeader(hdr, header);
+        ok = in && out && out.write(hdr, sizeof(hdr)) == sizeof(hdr);
+        if (ok) {
+            uint32_t mid = runLen < (uint32_t)total ? runLen : (uint32_t)total;
+            IndexRunSource a(&in, 0, mid);
+            IndexRunSource b(&in, mid, (uint32_t)total);
+            IndexSink sink(&out);
+            long written = CrackedIndex::mergeRuns(a, b, sink, true);
+            ok = written >= 0 && sink.flush();
+            if (ok) {
+                header.count = (uint32_t)written;
+                CrackedIndex::encodeHeader(hdr, header);
+                ok = out.seek(0) && out.write(hdr, sizeof(hdr)) == sizeof(hdr);
             }
         }
+        if (in) in.close();
+        if (out) out.close();
     }
 
-    f.close();
+    SD.remove(runPathA);
+    if (SD.exists(runPathB)) SD.remove(runPathB);
+    if (ok) {
+        if (SD.exists(indexPath)) SD.remove(indexPath);
+        ok = SD.rename(tmpPath, indexPath);
+    }
+    if (!ok) {
+        if (SD.exists(tmpPath)) SD.remove(tmpPath);
+        strncpy(lastError, "INDEX BUILD FAILED", sizeof(lastError) - 1);
+        lastError[sizeof(lastError) - 1] = '\0';
+        return false;
+    }
+    Serial.printf("[WPASEC] Cracked index built: %u BSSIDs from %ld lines\n",
+                  (unsigned int)header.count, total);
     return true;
 }
 
-bool WPASec::loadCache() {
-    if (cacheLoaded) return true;
-
-    crackedCache.clear();
-    uploadedCache.clear();
+bool WPASec::openCrackedIndex() {
+    if (crackedIndexReady) return true;
+    closeCrackedIndex();
 
-    const char* cachePath = SDLayout::wpasecResultsPath();
-    if (SD.exists(cachePath)) {
-        File f = SD.open(cachePath, FILE_READ);
-        if (!f) {
+    // No potfile yet: nothing cracked
+    const char* potPath = SDLayout::wpasecResultsPath();
+    if (!SD.exists(potPath)) {
+        crackedIndexReady = true;
+        return true;
+    }
+    uint32_t potSize = 0;
+    uint32_t potMtime = 0;
+    {
+        File pot = SD.open(potPath, FILE_READ);
+        if (!pot) {
             strncpy(lastError, "CANNOT OPEN CACHE", sizeof(lastError) - 1);
             lastError[sizeof(lastError) - 1] = '\0';
             return false;
         }
+        potSize = (uint32_t)pot.size();
+        potMtime = (uint32_t)pot.getLastWrite();
+        pot.close();
+    }
+    if (crackedIndexFailed && potSize == failedPotSize && potMtime == failedPotMtime) {
+        return false;  // lastError still says why
+    }
 
-        // Format: AP_BSSID:CLIENT_BSSID:SSID:password (WPA-SEC potfile format)
-        // AP_BSSID is always 12 hex chars, CLIENT_BSSID is always 12 hex chars
-        // Cap at 500 entries to prevent memory exhaustion
-        String line;
-        line.reserve(128);  // Pre-allocate to reduce heap fragmentation
-        while (f.available() && crackedCache.size() < WPASEC_MAX_CACHE_ENTRIES) {
-            line = f.readStringUntil('\n');  // Reuses existing capacity
-            line.trim();
-            if (line.isEmpty()) continue;
-
-            // WPA-SEC potfile: AP_BSSID:CLIENT_BSSID:SSID:password
-            // Both BSSIDs are exactly 12 hex chars (no colons)
-            // Password can contain colons, so we must find the THIRD colon
-            int firstColon = line.indexOf(':');
-            int secondColon = (firstColon > 0) ? line.indexOf(':', firstColon + 1) : -1;
-            int thirdColon = (secondColon > 0) ? line.indexOf(':', secondColon + 1) : -1;
-
-            // Validate: AP BSSID at pos 0-11 (colon at 12), client BSSID at pos 13-24 (colon at 25)
-            if (firstColon == 12 && secondColon == 25 && thirdColon > secondColon) {
-                String bssid = line.substring(0, firstColon);  // AP BSSID
-                String ssid = line.substring(secondColon + 1, thirdColon);  // SSID between 2nd and 3rd colon
-                String password = line.substring(thirdColon + 1);  // Everything after 3rd colon
-
-                bssid = normalizeBSSID(bssid.c_str());
-
-                CacheEntry entry;
-                entry.ssid = ssid;
-                entry.password = password;
-                crackedCache[bssid] = entry;
-            }
+    // Rebuild when missing, unreadable, or the potfile changed underneath
+    // (the web UI can rewrite it)
+    for (int attempt = 0; attempt < 2; attempt++) {
+        const char* indexPath = SDLayout::wpasecIndexPath();
+        if (SD.exists(indexPath)) {
+            crackedIndexFile = SD.open(indexPath, FILE_READ);
+        }
+        uint8_t hdr[CrackedIndex::kHeaderLen];
+        if (crackedIndexFile &&
+            crackedIndexFile.read(hdr, sizeof(hdr)) == sizeof(hdr) &&
+            CrackedIndex::decodeHeader(hdr, crackedIndexHeader) &&
+            crackedIndexHeader.potfileSize == potSize &&
+            crackedIndexHeader.potfileMtime == potMtime &&
+            crackedIndexFile.size() == CrackedIndex::kHeaderLen +
+                (size_t)crackedIndexHeader.count * CrackedIndex::kEntryLen) {
+            crackedIndexCache.reset();
+            crackedIndexReady = true;
+            crackedIndexFailed = false;
+            return true;
+        }
+        if (crackedIndexFile) crackedIndexFile.close();
+        if (attempt == 0 && !buildCrackedIndex()) break;
+    }
+    closeCrackedIndex();
+    crackedIndexFailed = true;
+    failedPotSize = potSize;
+    failedPotMtime = potMtime;
+    return false;
+}
+
+bool WPASec::findCracked(const char* bssid, uint32_t& offset) {
+    uint8_t key[6];
+    if (!CrackedIndex::parseKey(bssid, key)) return false;
+    if (!openCrackedIndex() || crackedIndexHeader.count == 0) return false;
+    auto readPage = [](uint32_t pageNo, uint8_t* out, size_t maxEntries) -> size_t {
+        uint32_t first = pageNo * CrackedIndex::kPageEntries;
+        if (first >= crackedIndexHeader.count) return 0;
+        uint32_t n = crackedIndexHeader.count - first;
+        if (n > maxEntries) n = maxEntries;
+        size_t bytes = n * CrackedIndex::kEntryLen;
+        if (!crackedIndexFile.seek(CrackedIndex::kHeaderLen + first * CrackedIndex::kEntryLen) ||
+            crackedIndexFile.read(out, bytes) != bytes) {
+            return 0;
         }
+        return n;
+    };
+    CrackedIndex::Entry e;
+    if (!CrackedIndex::find(crackedIndexCache, readPage, crackedIndexHeader.count, key, e)) return false;
+    offset = e.offset;
+    return true;
+}
+
+// Read and split the potfile line an index entry points at
+static bool readPotLine(uint32_t offset, char* line, size_t lineSize, CrackedIndex::PotLine& pl) {
+    File pot = SD.open(SDLayout::wpasecResultsPath(), FILE_READ);
+    if (!pot) return false;
+    bool ok = pot.seek(offset);
+    int n = ok ? pot.read((uint8_t*)line, lineSize - 1) : 0;
+    pot.close();
+    if (n <= 0) return false;
+    line[n] = '\0';
+    char* nl = (char*)memchr(line, '\n', (size_t)n);
+    size_t len = nl ? (size_t)(nl - line) : (size_t)n;
+    return CrackedIndex::parsePotLine(line, len, pl);
+}
 
-        f.close();
+// ============================================================================
+// Cache Management (disk only)
+// ============================================================================
+
+bool WPASec::loadUploadedList() {
+    if (!uploadedSet.load(SDLayout::wpasecUploadedPath())) {
+        strncpy(lastError, "CANNOT OPEN UPLOADED", sizeof(lastError) - 1);
+        lastError[sizeof(lastError) - 1] = '\0';
+        return false;
+    }
+    return true;
+}
+
+bool WPASec::loadCache() {
+    if (cacheLoaded) return true;
+
+    // Cracked results stay on SD; only the index header is read here
+    // (rebuilt first if the potfile changed since it was written)
+    if (!openCrackedIndex()) {
+        return false;
     }
 
     if (!loadUploadedList()) {
@@ -155,40 +432,45 @@ bool WPASec::loadCache() {
 
 bool WPASec::isCracked(const char* bssid) {
     loadCache();
-    String key = normalizeBSSID(bssid);
-    return crackedCache.find(key) != crackedCache.end();
+    uint32_t offset;
+    return findCracked(bssid, offset);
 }
 
 String WPASec::getPassword(const char* bssid) {
     loadCache();
-    String key = normalizeBSSID(bssid);
-    auto it = crackedCache.find(key);
-    if (it != crackedCache.end()) {
-        return it->second.password;
+    uint32_t offset;
+    char line[CrackedIndex::kMaxLineLen + 1];
+    CrackedIndex::PotLine pl;
+    if (findCracked(bssid, offset) && readPotLine(offset, line, sizeof(line), pl)) {
+        line[pl.passwordStart + pl.passwordLen] = '\0';
+        return String(line + pl.passwordStart);
     }
     return "";
 }
 
 String WPASec::getSSID(const char* bssid) {
     loadCache();
-    String key = normalizeBSSID(bssid);
-    auto it = crackedCache.find(key);
-    if (it != crackedCache.end()) {
-        return it->second.ssid;
+    uint32_t offset;
+    char line[CrackedIndex::kMaxLineLen + 1];
+    CrackedIndex::PotLine pl;
+    if (findCracked(bssid, offset) && readPotLine(offset, line, sizeof(line), pl)) {
+        line[pl.ssidStart + pl.ssidLen] = '\0';
+        return String(line + pl.ssidStart);
     }
     return "";
 }
 
 uint16_t WPASec::getCrackedCount() {
     loadCache();
-    return crackedCache.size();
+    return crackedIndexHeader.count > 0xFFFF ? 0xFFFF : (uint16_t)crackedIndexHeader.count;
 }
 
 bool WPASec::isUploaded(const char* bssid) {
     loadCache();
-    String key = normalizeBSSID(bssid);
-    if (crackedCache.find(key) != crackedCache.end()) return true;
-    return uploadedCache.find(key) != uploadedCache.end();
+    if (isCracked(bssid)) return true;
+    char key[32];
+    normalizeBSSID_Char(bssid, key, sizeof(key));
+    return uploadedSet.contains(key);
 }
 
 const char* WPASec::getLastError() {
@@ -196,46 +478,30 @@ const char* WPASec::getLastError() {
 }
 
 void WPASec::freeCacheMemory() {
-    size_t crackedCount = crackedCache.size();
-    size_t uploadedCount = uploadedCache.size();
-    crackedCache.clear();
-    uploadedCache.clear();
+    size_t crackedCount = crackedIndexHeader.count;
+    size_t uploadedCount = uploadedSet.size();
+    closeCrackedIndex();
+    uploadedSet.release();
     cacheLoaded = false;
-    Serial.printf("[WPASEC] Freed cache: %u cracked, %u uploaded\n",
+    Serial.printf("[WPASEC] Freed cache: %u cracked (index closed), %u uploaded\n",
                   (unsigned int)crackedCount, (unsigned int)uploadedCount);
 }
 
 bool WPASec::saveUploadedList() {
-    const char* uploadedPath = SDLayout::wpasecUploadedPath();
-    File f = SD.open(uploadedPath, FILE_WRITE);
-    if (!f) {
+    if (!uploadedSet.saveIndex()) {
         strncpy(lastError, "CANNOT WRITE UPLOADED", sizeof(lastError) - 1);
         lastError[sizeof(lastError) - 1] = '\0';
         return false;
     }
-
-    for (const auto& kv : uploadedCache) {
-        f.println(kv.first);
-    }
-
-    f.close();
     return true;
 }
 
 void WPASec::markAsUploaded(const char* bssid) {
     loadCache();
-    String key = normalizeBSSID(bssid);
-    if (!key.isEmpty()) {
-        if (uploadedCache.find(key) == uploadedCache.end() &&
-            uploadedCache.size() >= WPASEC_MAX_CACHE_ENTRIES) {
-            // Cap in-memory cache to avoid unbounded heap growth.
-            return;
-        }
-        uploadedCache[key] = true;
-        if (!batchMode) {
-            saveUploadedList();  // Only save immediately if not in batch mode
-        }
-    }
+    char key[32];
+    normalizeBSSID_Char(bssid, key, sizeof(key));
+    // Appends to the text list; batch mode defers only the sidecar write
+    uploadedSet.add(key, !batchMode);
 }
 
 void WPASec::beginBatchUpload() {
@@ -245,7 +511,7 @@ void WPASec::beginBatchUpload() {
 void WPASec::endBatchUpload() {
     if (batchMode) {
         batchMode = false;
-        saveUploadedList();  // Single save at end of batch
+        saveUploadedList();  // Single sidecar write at end of batch
         Serial.println("[WPASEC] Batch upload complete, saved uploaded list");
     }
 }
@@ -281,6 +547,7 @@ bool WPASec::canSync() {
 }
 
 bool WPASec::uploadSingleCapture(const char* filepath, const char* bssid) {
+    HeapTrace::Scope heapTag(HeapTrace::Tag::Tls);
     if (!filepath || !bssid) return false;
     
     Serial.printf("[WPASEC] Uploading: %s\n", filepath);
@@ -405,6 +672,7 @@ bool WPASec::uploadSingleCapture(const char* filepath, const char* bssid) {
 }
 
 bool WPASec::downloadPotfile(uint16_t& newCracks) {
+    HeapTrace::Scope heapTag(HeapTrace::Tag::Tls);
     newCracks = 0;
     
     Serial.println("[WPASEC] Downloading potfile...");
@@ -509,6 +777,13 @@ bool WPASec::downloadPotfile(uint16_t& newCracks) {
     
     Serial.printf("[WPASEC] Potfile downloaded: %u entries\n", (unsigned int)lineCount);
     newCracks = lineCount;
+
+    // Re-sort the index now rather than on the next lookup (the potfile
+    // size/mtime check would catch it too, but a same-size rewrite may not
+    // change either when the clock isn't set)
+    cacheLoaded = false;
+    crackedIndexFailed = false;
+    buildCrackedIndex();
     
     return true;
 }
@@ -708,8 +983,9 @@ WPASecSyncResult WPASec::syncCaptures(WPASecProgressCallback cb) {
         loadCache();
         for (uint8_t i = 0; i < pendingCount; i++) {
             if (successMask[i]) {
-                String key = normalizeBSSID(pendingUploads[i].bssid);
-                uploadedCache[key] = true;
+                char key[32];
+                normalizeBSSID_Char(pendingUploads[i].bssid, key, sizeof(key));
+                uploadedSet.add(key, false);
             }
         }
         saveUploadedList();
@@ -742,7 +1018,7 @@ WPASecSyncResult WPASec::syncCaptures(WPASecProgressCallback cb) {
             result.newCracked = newCracks;
             // Reload cache to get cracked count
             loadCache();
-            result.cracked = crackedCache.size();
+            result.cracked = getCrackedCount();
         }
     } else {
         Serial.printf("[WPASEC] Skipping potfile: insufficient heap (%u < %u)\n",
@@ -3,7 +3,6 @@
 #pragma once
 
 #include <Arduino.h>
-#include <map>
 #include "../core/heap_policy.h"
 
 // Upload status for tracking
@@ -59,8 +58,8 @@ public:
     /**
      * @brief Free cached WPA‑SEC results from memory.
      *
-     * This releases the internal cracked and uploaded maps to return heap
-     * space prior to large TLS operations.  After calling this, the cache
+     * This closes the cracked index (dropping its page cache) and releases
+     * the uploaded set to return heap space prior to large TLS operations.  After calling this, the cache
      * will be reloaded from disk on the next lookup or fetch.
      */
     static void freeCacheMemory();
@@ -74,18 +73,16 @@ public:
     static volatile bool busy;
     static bool batchMode;  // Batch upload mode flag
     
-    // Cache: BSSID (no colons, uppercase) -> {ssid, password}
-    struct CacheEntry {
-        String ssid;
-        String password;
-    };
-    static std::map<String, CacheEntry> crackedCache;
-    static std::map<String, bool> uploadedCache;
+    // Cracked results live in the potfile on SD behind a sorted BSSID index
+    // (core/cracked_index.h); uploaded BSSIDs are a hashed set
+    // (core/membership_file.h) over the uploaded list
     
     // Helpers
-    static String normalizeBSSID(const char* bssid);  // Remove colons, uppercase
     static bool loadUploadedList();
     static bool saveUploadedList();
+    static bool openCrackedIndex();                   // Open, rebuilding if stale
+    static bool buildCrackedIndex();                  // External sort of the potfile
+    static bool findCracked(const char* bssid, uint32_t& offset);
     
     // Network helpers (internal)
     static bool uploadSingleCapture(const char* filepath, const char* bssid);
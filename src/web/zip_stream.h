@@ -0,0 +1,338 @@
+// ZipStream - Streaming ZIP archive building blocks
+// Local headers with data descriptors, central directory and end record are
+// built into caller buffers, so an archive can be streamed straight to a
+// socket with constant memory: CRC32 and sizes are only known after the
+// data has gone out, which is exactly what data descriptors are for.
+// Optional fixed-Huffman deflate (small window, ~6KB state) for text files.
+// Header-only, no Arduino dependencies (unit tested on native).
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include "../core/crc32.h"
+
+namespace ZipStream {
+
+static const uint32_t kSigLocal = 0x04034B50;
+static const uint32_t kSigDescriptor = 0x08074B50;
+static const uint32_t kSigCentral = 0x02014B50;
+static const uint32_t kSigEnd = 0x06054B50;
+
+static const uint16_t kMethodStore = 0;
+static const uint16_t kMethodDeflate = 8;
+static const uint16_t kFlagDescriptor = 1 << 3;   // CRC/sizes follow the data
+static const uint16_t kFlagUtf8 = 1 << 11;
+static const uint16_t kVersionNeeded = 20;        // 2.0: deflate + descriptors
+
+static const uint16_t kLocalHeaderLen = 30;
+static const uint16_t kDescriptorLen = 16;
+static const uint16_t kCentralHeaderLen = 46;
+static const uint16_t kEndRecordLen = 22;
+static const uint16_t kMaxEntries = 0xFFFF;       // No ZIP64
+static const uint16_t kMaxNameLen = 255;
+
+inline void put16(uint8_t* p, uint16_t v) {
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+}
+
+inline void put32(uint8_t* p, uint32_t v) {
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+    p[2] = (uint8_t)(v >> 16);
+    p[3] = (uint8_t)(v >> 24);
+}
+
+// CRC-32 lives in core/crc32.h (shared with the capture journal)
+using ::crc32Update;
+
+// MS-DOS date (high 16) + time (low 16). Dates before 1980 clamp to 1980-01-01.
+inline uint32_t dosDateTime(int year, int month, int day, int hour, int minute, int second) {
+    if (year < 1980) {
+        year = 1980; month = 1; day = 1; hour = 0; minute = 0; second = 0;
+    }
+    uint16_t date = (uint16_t)(((year - 1980) << 9) | (month << 5) | day);
+    uint16_t time = (uint16_t)((hour << 11) | (minute << 5) | (second / 2));
+    return ((uint32_t)date << 16) | time;
+}
+
+inline uint32_t localHeaderSize(uint16_t nameLen) { return kLocalHeaderLen + nameLen; }
+inline uint32_t centralHeaderSize(uint16_t nameLen) { return kCentralHeaderLen + nameLen; }
+
+// Bytes a stored entry occupies in the archive (header + data + descriptor)
+inline uint32_t storedEntrySize(uint16_t nameLen, uint32_t size) {
+    return localHeaderSize(nameLen) + size + kDescriptorLen;
+}
+
+// Local file header; CRC and sizes are zero and come in the descriptor.
+// out must hold localHeaderSize(nameLen) bytes.
+inline size_t writeLocalHeader(uint8_t* out, const char* name, uint16_t nameLen,
+                               uint16_t method, uint32_t dosTime) {
+    put32(out, kSigLocal);
+    put16(out + 4, kVersionNeeded);
+    put16(out + 6, kFlagDescriptor | kFlagUtf8);
+    put16(out + 8, method);
+    put32(out + 10, dosTime);
+    put32(out + 14, 0);             // CRC-32
+    put32(out + 18, 0);             // Compressed size
+    put32(out + 22, 0);             // Uncompressed size
+    put16(out + 26, nameLen);
+    put16(out + 28, 0);             // Extra field length
+    memcpy(out + kLocalHeaderLen, name, nameLen);
+    return localHeaderSize(nameLen);
+}
+
+inline size_t writeDataDescriptor(uint8_t* out, uint32_t crc, uint32_t compSize, uint32_t size) {
+    put32(out, kSigDescriptor);
+    put32(out + 4, crc);
+    put32(out + 8, compSize);
+    put32(out + 12, size);
+    return kDescriptorLen;
+}
+
+// out must hold centralHeaderSize(nameLen) bytes
+inline size_t writeCentralHeader(uint8_t* out, const char* name, uint16_t nameLen,
+                                 uint16_t method, uint32_t dosTime, uint32_t crc,
+                                 uint32_t compSize, uint32_t size, uint32_t localOffset) {
+    put32(out, kSigCentral);
+    put16(out + 4, kVersionNeeded); // Version made by (MS-DOS, 2.0)
+    put16(out + 6, kVersionNeeded);
+    put16(out + 8, kFlagDescriptor | kFlagUtf8);
+    put16(out + 10, method);
+    put32(out + 12, dosTime);
+    put32(out + 16, crc);
+    put32(out + 20, compSize);
+    put32(out + 24, size);
+    put16(out + 28, nameLen);
+    put16(out + 30, 0);             // Extra field length
+    put16(out + 32, 0);             // Comment length
+    put16(out + 34, 0);             // Disk number start
+    put16(out + 36, 0);             // Internal attributes
+    put32(out + 38, 0);             // External attributes
+    put32(out + 42, localOffset);
+    memcpy(out + kCentralHeaderLen, name, nameLen);
+    return centralHeaderSize(nameLen);
+}
+
+inline size_t writeEndRecord(uint8_t* out, uint16_t entries, uint32_t cdSize, uint32_t cdOffset) {
+    put32(out, kSigEnd);
+    put16(out + 4, 0);              // This disk
+    put16(out + 6, 0);              // Disk with central directory
+    put16(out + 8, entries);
+    put16(out + 10, entries);
+    put32(out + 12, cdSize);
+    put32(out + 16, cdOffset);
+    put16(out + 20, 0);             // Comment length
+    return kEndRecordLen;
+}
+
+/**
+ * Single-block fixed-Huffman deflate (RFC 1951 BTYPE=01) with greedy LZ77
+ * over a 4KB sliding buffer and a 1K-entry hash head table.
+ *
+ * No dynamic trees and no hash chains: CSV/JSON/log files still shrink
+ * 2-4x, and the whole state fits in ~6.5KB. Output goes through a sink
+ * callback in kOutBufLen pieces; a false return from the sink aborts.
+ */
+class Deflater {
+public:
+    typedef bool (*Sink)(void* ctx, const uint8_t* data, size_t len);
+
+    static const uint16_t kWindow = 2048;         // History kept after a slide
+    static const uint16_t kBufLen = kWindow * 2;
+    static const uint16_t kHashBits = 10;
+    static const uint16_t kHashSize = 1 << kHashBits;
+    static const uint16_t kMinMatch = 3;
+    static const uint16_t kMaxMatch = 258;
+    static const uint16_t kOutBufLen = 512;
+
+    Deflater() : sink(nullptr), sinkCtx(nullptr) { reset(); }
+
+    // Start a new stream (one per ZIP entry)
+    void begin(Sink s, void* ctx) {
+        sink = s;
+        sinkCtx = ctx;
+        reset();
+        putBits(1, 1);                            // BFINAL
+        putBits(1, 2);                            // BTYPE = fixed Huffman
+    }
+
+    bool write(const uint8_t* data, size_t len) {
+        while (len > 0 && !failed) {
+            if (end == kBufLen) slide();
+            size_t room = kBufLen - end;
+            size_t n = len < room ? len : room;
+            memcpy(buf + end, data, n);
+            end = (uint16_t)(end + n);
+            data += n;
+            len -= n;
+            totalIn += (uint32_t)n;
+            compress(false);
+        }
+        return !failed;
+    }
+
+    // Flush the tail, end-of-block code and the last partial byte
+    bool finish() {
+        compress(true);
+        writeLiteralCode(256);
+        if (bitCount > 0) putBits(0, (uint8_t)(8 - bitCount));
+        flushOut();
+        return !failed;
+    }
+
+    uint32_t bytesIn() const { return totalIn; }
+    uint32_t bytesOut() const { return totalOut; }
+
+private:
+    void reset() {
+        memset(head, 0, sizeof(head));
+        pos = 0;
+        end = 0;
+        bitBuf = 0;
+        bitCount = 0;
+        outLen = 0;
+        totalIn = 0;
+        totalOut = 0;
+        failed = false;
+    }
+
+    static uint16_t hash3(const uint8_t* p) {
+        uint32_t v = ((uint32_t)p[0] << 16) | ((uint32_t)p[1] << 8) | p[2];
+        return (uint16_t)((v * 2654435761u) >> (32 - kHashBits));
+    }
+
+    // Drop everything older than kWindow bytes before pos
+    void slide() {
+        uint16_t shift = (pos > kWindow) ? (uint16_t)(pos - kWindow) : 0;
+        if (shift == 0) return;
+        memmove(buf, buf + shift, end - shift);
+        pos = (uint16_t)(pos - shift);
+        end = (uint16_t)(end - shift);
+        for (uint16_t i = 0; i < kHashSize; i++) {
+            head[i] = head[i] > shift ? (uint16_t)(head[i] - shift) : 0;
+        }
+    }
+
+    void compress(bool flush) {
+        while (pos < end && !failed) {
+            uint16_t avail = (uint16_t)(end - pos);
+            if (!flush && avail < kMaxMatch) return;  // Keep lookahead for matching
+
+            uint16_t bestLen = 0;
+            uint16_t bestDist = 0;
+            if (avail >= kMinMatch) {
+                uint16_t h = hash3(buf + pos);
+                uint16_t cand = head[h];
+                head[h] = (uint16_t)(pos + 1);
+                if (cand) {
+                    cand--;
+                    uint16_t maxLen = avail < kMaxMatch ? avail : kMaxMatch;
+                    uint16_t n = 0;
+                    while (n < maxLen && buf[cand + n] == buf[pos + n]) n++;
+                    if (n >= kMinMatch) {
+                        bestLen = n;
+                        bestDist = (uint16_t)(pos - cand);
+                    }
+                }
+            }
+
+            if (bestLen) {
+                writeMatch(bestLen, bestDist);
+                for (uint16_t i = 1; i < bestLen; i++) {
+                    uint16_t p = (uint16_t)(pos + i);
+                    if (p + kMinMatch <= end) head[hash3(buf + p)] = (uint16_t)(p + 1);
+                }
+                pos = (uint16_t)(pos + bestLen);
+            } else {
+                writeLiteralCode(buf[pos]);
+                pos++;
+            }
+        }
+    }
+
+    void putBits(uint32_t value, uint8_t count) {
+        bitBuf |= value << bitCount;
+        bitCount = (uint8_t)(bitCount + count);
+        while (bitCount >= 8) {
+            outBuf[outLen++] = (uint8_t)bitBuf;
+            bitBuf >>= 8;
+            bitCount = (uint8_t)(bitCount - 8);
+            if (outLen == kOutBufLen) flushOut();
+        }
+    }
+
+    // Huffman codes are defined MSB-first; the bit stream is LSB-first
+    void putCode(uint16_t code, uint8_t len) {
+        uint16_t rev = 0;
+        for (uint8_t i = 0; i < len; i++) {
+            rev = (uint16_t)((rev << 1) | (code & 1));
+            code >>= 1;
+        }
+        putBits(rev, len);
+    }
+
+    void writeLiteralCode(uint16_t sym) {
+        if (sym < 144) putCode((uint16_t)(0x30 + sym), 8);
+        else if (sym < 256) putCode((uint16_t)(0x190 + sym - 144), 9);
+        else if (sym < 280) putCode((uint16_t)(sym - 256), 7);
+        else putCode((uint16_t)(0xC0 + sym - 280), 8);
+    }
+
+    void writeMatch(uint16_t len, uint16_t dist) {
+        static const uint16_t kLenBase[29] = {
+            3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+            35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258
+        };
+        static const uint8_t kLenExtra[29] = {
+            0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+            3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0
+        };
+        static const uint16_t kDistBase[30] = {
+            1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+            257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145,
+            8193, 12289, 16385, 24577
+        };
+        static const uint8_t kDistExtra[30] = {
+            0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+            7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13
+        };
+
+        uint8_t lc = 28;
+        while (kLenBase[lc] > len) lc--;
+        writeLiteralCode((uint16_t)(257 + lc));
+        if (kLenExtra[lc]) putBits((uint32_t)(len - kLenBase[lc]), kLenExtra[lc]);
+
+        uint8_t dc = 29;
+        while (kDistBase[dc] > dist) dc--;
+        putCode(dc, 5);
+        if (kDistExtra[dc]) putBits((uint32_t)(dist - kDistBase[dc]), kDistExtra[dc]);
+    }
+
+    void flushOut() {
+        if (outLen == 0 || failed) {
+            outLen = 0;
+            return;
+        }
+        if (!sink || !sink(sinkCtx, outBuf, outLen)) failed = true;
+        totalOut += outLen;
+        outLen = 0;
+    }
+
+    Sink sink;
+    void* sinkCtx;
+    uint8_t buf[kBufLen];
+    uint16_t head[kHashSize];     // Last position + 1 for each hash, 0 = empty
+    uint16_t pos;                 // Next byte to encode
+    uint16_t end;                 // End of buffered input
+    uint32_t bitBuf;
+    uint8_t bitCount;
+    uint8_t outBuf[kOutBufLen];
+    uint16_t outLen;
+    uint32_t totalIn;
+    uint32_t totalOut;
+    bool failed;
+};
+
+}  // namespace ZipStream
@@ -0,0 +1,61 @@
+// Mock heap trace shim for native unit testing
+// The firmware trace build wraps malloc/free at link time (heap_trace.cpp).
+// On the host, code under test calls these instead; they allocate with the
+// C library and feed a HeapLedger exactly like the firmware wrappers do.
+#pragma once
+
+#include <cstdlib>
+#include "../../src/core/heap_ledger.h"
+
+namespace MockHeap {
+
+static const uint16_t kSlots = 1024;
+static HeapLedger::Slot slots[kSlots];
+static HeapLedger::Ledger ledger;
+static HeapLedger::Tag scopeTag = HeapLedger::Tag::Other;
+
+inline void reset(uint16_t n = kSlots) {
+    ledger.attach(slots, n);
+    scopeTag = HeapLedger::Tag::Other;
+}
+
+inline void* traceMalloc(size_t size) {
+    void* p = malloc(size);
+    ledger.record(p, size, scopeTag);
+    return p;
+}
+
+inline void* traceCalloc(size_t n, size_t size) {
+    void* p = calloc(n, size);
+    ledger.record(p, n * size, scopeTag);
+    return p;
+}
+
+inline void* traceRealloc(void* ptr, size_t size) {
+    size_t oldSize = 0;
+    HeapLedger::Tag oldTag = scopeTag;
+    bool tracked = ledger.forget(ptr, &oldSize, &oldTag);
+    void* p = realloc(ptr, size);
+    if (p) {
+        ledger.record(p, size, scopeTag);
+    } else if (tracked && size > 0) {
+        ledger.record(ptr, oldSize, oldTag);   // Failed: old block still live
+    }
+    return p;
+}
+
+inline void traceFree(void* ptr) {
+    ledger.forget(ptr);
+    free(ptr);
+}
+
+// Same nesting rules as HeapTrace::Scope (single task on the host)
+class Scope {
+public:
+    explicit Scope(HeapLedger::Tag tag) : prev(scopeTag) { scopeTag = tag; }
+    ~Scope() { scopeTag = prev; }
+private:
+    HeapLedger::Tag prev;
+};
+
+}  // namespace MockHeap
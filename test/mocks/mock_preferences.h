@@ -2,6 +2,7 @@
 #pragma once
 
 #include <cstdint>
+#include <cstring>
 #include <map>
 #include <string>
 
@@ -99,6 +100,28 @@ public:
         return strlen(value);
     }
     
+    size_t putBytes(const char* key, const void* value, size_t len) {
+        storage[makeKey(key)] = std::string((const char*)value, len);
+        return len;
+    }
+    
+    bool isKey(const char* key) {
+        return storage.find(makeKey(key)) != storage.end();
+    }
+    
+    size_t getBytesLength(const char* key) {
+        auto it = storage.find(makeKey(key));
+        if (it == storage.end()) return 0;
+        return it->second.size();
+    }
+    
+    size_t getBytes(const char* key, void* buf, size_t maxLen) {
+        auto it = storage.find(makeKey(key));
+        if (it == storage.end() || it->second.size() > maxLen) return 0;
+        memcpy(buf, it->second.data(), it->second.size());
+        return it->second.size();
+    }
+    
     // Get methods with defaults
     int8_t getChar(const char* key, int8_t defaultValue = 0) {
         auto it = storage.find(makeKey(key));
@@ -3,7 +3,11 @@
 
 #include <unity.h>
 #include <cstring>
+#include <cstdio>
+#include <chrono>
 #include "../mocks/testable_functions.h"
+#include "../mocks/mock_esp_wifi.h"
+#include "../../src/core/ie_parser.h"
 
 void setUp(void) {
     // No setup needed
@@ -134,6 +138,24 @@ struct BeaconBuilder {
     void addVendorIE(const uint8_t* oui, uint8_t ouiLen) {
         addIE(221, oui, ouiLen);
     }
+    
+    // RSN IE with explicit suite lists and capabilities
+    void addRSNFull(uint8_t pairwiseCount, const uint8_t* akmTypes, uint8_t akmCount, uint16_t caps) {
+        uint8_t rsn[64];
+        uint8_t n = 0;
+        rsn[n++] = 0x01; rsn[n++] = 0x00;                                      // Version
+        rsn[n++] = 0x00; rsn[n++] = 0x0F; rsn[n++] = 0xAC; rsn[n++] = 0x04;    // Group (CCMP)
+        rsn[n++] = pairwiseCount; rsn[n++] = 0x00;
+        for (uint8_t i = 0; i < pairwiseCount; i++) {
+            rsn[n++] = 0x00; rsn[n++] = 0x0F; rsn[n++] = 0xAC; rsn[n++] = (i == 0) ? 0x04 : 0x02;
+        }
+        rsn[n++] = akmCount; rsn[n++] = 0x00;
+        for (uint8_t i = 0; i < akmCount; i++) {
+            rsn[n++] = 0x00; rsn[n++] = 0x0F; rsn[n++] = 0xAC; rsn[n++] = akmTypes[i];
+        }
+        rsn[n++] = caps & 0xFF; rsn[n++] = (caps >> 8) & 0xFF;
+        addIE(48, rsn, n);
+    }
 };
 
 // ============================================================================
@@ -331,6 +353,313 @@ void test_beacon_suspicious_rogue_ap(void) {
     TEST_ASSERT_TRUE(b.len < 50);  // Minimal frame
 }
 
+// ============================================================================
+// IEParser (src/core/ie_parser.h)
+// ============================================================================
+
+void test_ie_iterator_walks_all_ies(void) {
+    BeaconBuilder b;
+    b.addSSID("Walk");
+    b.addSupportedRates(8);
+    b.addDSParameterSet(6);
+    b.addRSN();
+    IEParser::Iterator it(b.buffer, b.len);
+    IEParser::IE ie;
+    uint8_t ids[8];
+    uint8_t count = 0;
+    while (it.next(ie) && count < 8) ids[count++] = ie.id;
+    TEST_ASSERT_EQUAL_UINT8(4, count);
+    TEST_ASSERT_EQUAL_UINT8(0, ids[0]);
+    TEST_ASSERT_EQUAL_UINT8(1, ids[1]);
+    TEST_ASSERT_EQUAL_UINT8(3, ids[2]);
+    TEST_ASSERT_EQUAL_UINT8(48, ids[3]);
+    TEST_ASSERT_FALSE(it.truncated());
+}
+
+void test_ie_iterator_zero_length_last_ie(void) {
+    BeaconBuilder b;
+    b.addSSID("A");
+    b.addHiddenSSID();  // 2-byte IE exactly at end of frame
+    IEParser::Iterator it(b.buffer, b.len);
+    IEParser::IE ie;
+    uint8_t count = 0;
+    while (it.next(ie)) count++;
+    TEST_ASSERT_EQUAL_UINT8(2, count);
+}
+
+void test_ie_iterator_detects_truncation(void) {
+    BeaconBuilder b;
+    b.addSSID("Truncated");
+    b.addRSN();
+    IEParser::Iterator it(b.buffer, b.len - 3);  // Cut into RSN body
+    IEParser::IE ie;
+    uint8_t count = 0;
+    while (it.next(ie)) count++;
+    TEST_ASSERT_EQUAL_UINT8(1, count);
+    TEST_ASSERT_TRUE(it.truncated());
+}
+
+void test_ie_parse_ssid_and_channel(void) {
+    BeaconBuilder b;
+    b.addSSID("HomeNetwork");
+    b.addSupportedRates(8);
+    b.addDSParameterSet(11);
+    IEParser::BeaconInfo info;
+    TEST_ASSERT_TRUE(IEParser::parse(b.buffer, b.len, info));
+    char ssid[33];
+    info.copySSID(ssid);
+    TEST_ASSERT_EQUAL_STRING("HomeNetwork", ssid);
+    TEST_ASSERT_EQUAL_UINT8(11, info.dsChannel);
+    TEST_ASSERT_FALSE(info.hidden);
+    TEST_ASSERT_FALSE(info.rsn.present);
+    TEST_ASSERT_EQUAL(WIFI_AUTH_OPEN, IEParser::authMode(info));
+}
+
+void test_ie_parse_ssid_pointer_is_zero_copy(void) {
+    BeaconBuilder b;
+    b.addSSID("ZeroCopy");
+    IEParser::BeaconInfo info;
+    IEParser::parse(b.buffer, b.len, info);
+    TEST_ASSERT_TRUE(info.ssid == b.buffer + 38);
+    TEST_ASSERT_EQUAL_UINT8(8, info.ssidLen);
+}
+
+void test_ie_parse_hidden_zero_length(void) {
+    BeaconBuilder b;
+    b.addHiddenSSID();
+    b.addDSParameterSet(1);
+    IEParser::BeaconInfo info;
+    IEParser::parse(b.buffer, b.len, info);
+    TEST_ASSERT_TRUE(info.ssidPresent);
+    TEST_ASSERT_TRUE(info.hidden);
+    char ssid[33];
+    info.copySSID(ssid);
+    TEST_ASSERT_EQUAL_STRING("", ssid);
+}
+
+void test_ie_parse_hidden_null_padded(void) {
+    BeaconBuilder b;
+    b.addNullPaddedSSID(8);
+    IEParser::BeaconInfo info;
+    IEParser::parse(b.buffer, b.len, info);
+    TEST_ASSERT_TRUE(info.hidden);
+    TEST_ASSERT_EQUAL_UINT8(8, info.ssidLen);
+}
+
+void test_ie_parse_oversized_ssid_ignored(void) {
+    BeaconBuilder b;
+    uint8_t longSsid[40];
+    memset(longSsid, 'A', sizeof(longSsid));
+    b.addIE(0, longSsid, sizeof(longSsid));
+    IEParser::BeaconInfo info;
+    IEParser::parse(b.buffer, b.len, info);
+    TEST_ASSERT_FALSE(info.ssidPresent);
+}
+
+void test_ie_parse_wpa2_psk(void) {
+    BeaconBuilder b;
+    b.addSSID("WPA2");
+    b.addRSN();
+    IEParser::BeaconInfo info;
+    IEParser::parse(b.buffer, b.len, info);
+    TEST_ASSERT_TRUE(info.rsn.present);
+    TEST_ASSERT_EQUAL_UINT16(1, info.rsn.pairwiseCount);
+    TEST_ASSERT_EQUAL_UINT16(1, info.rsn.akmCount);
+    TEST_ASSERT_TRUE(info.rsn.akmPSK);
+    TEST_ASSERT_FALSE(info.hasPMF());
+    TEST_ASSERT_EQUAL(WIFI_AUTH_WPA2_PSK, IEParser::authMode(info));
+}
+
+void test_ie_parse_wpa1_only(void) {
+    BeaconBuilder b;
+    b.addSSID("Legacy");
+    b.addWPA();
+    IEParser::BeaconInfo info;
+    IEParser::parse(b.buffer, b.len, info);
+    TEST_ASSERT_TRUE(info.hasWPA);
+    TEST_ASSERT_EQUAL(WIFI_AUTH_WPA_PSK, IEParser::authMode(info));
+}
+
+void test_ie_parse_wpa_wpa2_either_order(void) {
+    BeaconBuilder a;
+    a.addWPA();
+    a.addRSN();
+    BeaconBuilder b;
+    b.addRSN();
+    b.addWPA();
+    IEParser::BeaconInfo ia, ib;
+    IEParser::parse(a.buffer, a.len, ia);
+    IEParser::parse(b.buffer, b.len, ib);
+    TEST_ASSERT_EQUAL(WIFI_AUTH_WPA_WPA2_PSK, IEParser::authMode(ia));
+    TEST_ASSERT_EQUAL(WIFI_AUTH_WPA_WPA2_PSK, IEParser::authMode(ib));
+}
+
+void test_ie_parse_wps_not_wpa(void) {
+    BeaconBuilder b;
+    b.addWPS();
+    IEParser::BeaconInfo info;
+    IEParser::parse(b.buffer, b.len, info);
+    TEST_ASSERT_FALSE(info.hasWPA);
+}
+
+void test_ie_rsn_multiple_suites_finds_caps(void) {
+    // 2 pairwise + 2 AKM: old "minimal suites" offset read the wrong bytes
+    BeaconBuilder b;
+    uint8_t akms[] = {IEParser::kAkmPSK, IEParser::kAkmSAE};
+    b.addRSNFull(2, akms, 2, IEParser::kRsnCapMFPC);
+    IEParser::BeaconInfo info;
+    IEParser::parse(b.buffer, b.len, info);
+    TEST_ASSERT_EQUAL_UINT16(2, info.rsn.pairwiseCount);
+    TEST_ASSERT_EQUAL_UINT16(2, info.rsn.akmCount);
+    TEST_ASSERT_TRUE(info.rsn.capsPresent);
+    TEST_ASSERT_TRUE(info.rsn.mfpc);
+    TEST_ASSERT_FALSE(info.rsn.mfpr);
+    TEST_ASSERT_TRUE(info.hasPMF());
+    TEST_ASSERT_EQUAL(WIFI_AUTH_WPA2_WPA3_PSK, IEParser::authMode(info));
+}
+
+void test_ie_rsn_sae_only_pmf_required(void) {
+    BeaconBuilder b;
+    uint8_t akms[] = {IEParser::kAkmSAE};
+    b.addRSNFull(1, akms, 1, IEParser::kRsnCapMFPC | IEParser::kRsnCapMFPR);
+    IEParser::BeaconInfo info;
+    IEParser::parse(b.buffer, b.len, info);
+    TEST_ASSERT_TRUE(info.rsn.mfpr);
+    TEST_ASSERT_TRUE(info.rsn.akmSAE);
+    TEST_ASSERT_FALSE(info.rsn.akmPSK);
+    TEST_ASSERT_EQUAL(WIFI_AUTH_WPA3_PSK, IEParser::authMode(info));
+}
+
+void test_ie_rsn_mfpr_bit_is_bit6(void) {
+    BeaconBuilder b;
+    uint8_t akms[] = {IEParser::kAkmPSK};
+    b.addRSNFull(1, akms, 1, 0x0040);
+    IEParser::BeaconInfo info;
+    IEParser::parse(b.buffer, b.len, info);
+    TEST_ASSERT_TRUE(info.rsn.mfpr);
+    TEST_ASSERT_FALSE(info.rsn.mfpc);
+}
+
+void test_ie_rsn_enterprise(void) {
+    BeaconBuilder b;
+    uint8_t akms[] = {IEParser::kAkm8021X};
+    b.addRSNFull(1, akms, 1, 0);
+    IEParser::BeaconInfo info;
+    IEParser::parse(b.buffer, b.len, info);
+    TEST_ASSERT_TRUE(info.rsn.akm8021X);
+    TEST_ASSERT_EQUAL(WIFI_AUTH_WPA2_ENTERPRISE, IEParser::authMode(info));
+}
+
+void test_ie_rsn_bogus_suite_count_rejected(void) {
+    // Pairwise count claims 50 suites in a 20-byte IE
+    uint8_t rsn[] = {0x01, 0x00, 0x00, 0x0F, 0xAC, 0x04, 0x32, 0x00,
+                     0x00, 0x0F, 0xAC, 0x04, 0x01, 0x00, 0x00, 0x0F,
+                     0xAC, 0x02, 0x80, 0x00};
+    IEParser::RSNInfo r;
+    TEST_ASSERT_FALSE(IEParser::parseRSN(rsn, sizeof(rsn), r));
+    TEST_ASSERT_FALSE(r.capsPresent);
+    TEST_ASSERT_FALSE(r.mfpc);
+
+    // 0x4000 pairwise suites: 8 + 0x10000 wraps to 8 in 16 bits
+    uint8_t wrap[] = {0x01, 0x00, 0x00, 0x0F, 0xAC, 0x04, 0x00, 0x40,
+                      0x01, 0x00, 0x00, 0x0F, 0xAC, 0x02, 0x80, 0x00};
+    TEST_ASSERT_FALSE(IEParser::parseRSN(wrap, sizeof(wrap), r));
+    TEST_ASSERT_FALSE(r.akmPSK);
+    TEST_ASSERT_FALSE(r.capsPresent);
+
+    uint8_t wrapHigh[] = {0x01, 0x00, 0x00, 0x0F, 0xAC, 0x04, 0xFE, 0x3F,
+                          0x01, 0x00, 0x00, 0x0F, 0xAC, 0x02};
+    TEST_ASSERT_FALSE(IEParser::parseRSN(wrapHigh, sizeof(wrapHigh), r));
+}
+
+void test_ie_rsn_version_and_group_only(void) {
+    uint8_t rsn[] = {0x01, 0x00, 0x00, 0x0F, 0xAC, 0x04};
+    IEParser::RSNInfo r;
+    TEST_ASSERT_TRUE(IEParser::parseRSN(rsn, sizeof(rsn), r));
+    TEST_ASSERT_EQUAL_UINT16(1, r.version);
+    TEST_ASSERT_EQUAL_UINT16(0, r.akmCount);
+}
+
+void test_ie_parse_short_frame_rejected(void) {
+    uint8_t frame[20] = {0x80};
+    IEParser::BeaconInfo info;
+    TEST_ASSERT_FALSE(IEParser::parse(frame, sizeof(frame), info));
+    TEST_ASSERT_FALSE(IEParser::parse(nullptr, 100, info));
+}
+
+void test_ie_parse_assoc_request_offset(void) {
+    // Assoc request: 24-byte header + capability(2) + listen interval(2)
+    uint8_t frame[64] = {0};
+    frame[0] = 0x00;
+    uint16_t pos = IEParser::kAssocReqIEOffset;
+    frame[pos++] = 0; frame[pos++] = 4;
+    memcpy(frame + pos, "Assc", 4);
+    pos += 4;
+    IEParser::BeaconInfo info;
+    TEST_ASSERT_TRUE(IEParser::parse(frame, pos, info, IEParser::kAssocReqIEOffset));
+    char ssid[33];
+    info.copySSID(ssid);
+    TEST_ASSERT_EQUAL_STRING("Assc", ssid);
+}
+
+// ============================================================================
+// Throughput benchmark: single pass vs. legacy four-walk parsing
+// ============================================================================
+
+// Legacy: separate SSID, DS, auth and PMF walks (pre-IEParser recon path)
+static uint32_t legacyFourPass(const uint8_t* p, uint16_t len) {
+    uint32_t acc = 0;
+    for (int pass = 0; pass < 4; pass++) {
+        uint16_t offset = 36;
+        while (offset + 2 < len) {
+            uint8_t id = p[offset];
+            uint8_t ieLen = p[offset + 1];
+            if (offset + 2 + ieLen > len) break;
+            if (pass == 0 && id == 0) { acc += ieLen; break; }
+            if (pass == 1 && id == 3 && ieLen == 1) { acc += p[offset + 2]; break; }
+            if (pass == 2 && (id == 0x30 || id == 0xDD)) acc += id;
+            if (pass == 3 && id == 0x30 && ieLen >= 8) acc += p[offset + 10];
+            offset += 2 + ieLen;
+        }
+    }
+    return acc;
+}
+
+void test_ie_benchmark_throughput(void) {
+    BeaconBuilder b;
+    b.addSSID("BenchmarkNetwork");
+    b.addSupportedRates(8);
+    b.addDSParameterSet(6);
+    b.addHTCapabilities();
+    uint8_t akms[] = {IEParser::kAkmPSK, IEParser::kAkmSAE};
+    b.addRSNFull(2, akms, 2, IEParser::kRsnCapMFPC);
+    b.addVHTCapabilities();
+    b.addWPS();
+    b.addWPA();
+
+    const int kIters = 200000;
+    volatile uint32_t sink = 0;
+
+    auto t0 = std::chrono::steady_clock::now();
+    for (int i = 0; i < kIters; i++) {
+        sink += legacyFourPass(b.buffer, b.len);
+    }
+    auto t1 = std::chrono::steady_clock::now();
+    for (int i = 0; i < kIters; i++) {
+        IEParser::BeaconInfo info;
+        IEParser::parse(b.buffer, b.len, info);
+        sink += info.dsChannel + info.rsn.capabilities + (info.hasWPA ? 1 : 0);
+    }
+    auto t2 = std::chrono::steady_clock::now();
+
+    double legacyNs = std::chrono::duration<double, std::nano>(t1 - t0).count() / kIters;
+    double singleNs = std::chrono::duration<double, std::nano>(t2 - t1).count() / kIters;
+    printf("[BENCH] beacon %u bytes: legacy 4-pass=%.1f ns  IEParser=%.1f ns  (%.2f Mframes/s)\n",
+           b.len, legacyNs, singleNs, singleNs > 0 ? 1000.0 / singleNs : 0.0);
+    (void)sink;
+    TEST_ASSERT_TRUE(singleNs > 0);
+}
+
 // ============================================================================
 // Main
 // ============================================================================
@@ -367,5 +696,30 @@ int main(int argc, char **argv) {
     RUN_TEST(test_beacon_open_hotspot);
     RUN_TEST(test_beacon_suspicious_rogue_ap);
     
+    // IEParser
+    RUN_TEST(test_ie_iterator_walks_all_ies);
+    RUN_TEST(test_ie_iterator_zero_length_last_ie);
+    RUN_TEST(test_ie_iterator_detects_truncation);
+    RUN_TEST(test_ie_parse_ssid_and_channel);
+    RUN_TEST(test_ie_parse_ssid_pointer_is_zero_copy);
+    RUN_TEST(test_ie_parse_hidden_zero_length);
+    RUN_TEST(test_ie_parse_hidden_null_padded);
+    RUN_TEST(test_ie_parse_oversized_ssid_ignored);
+    RUN_TEST(test_ie_parse_wpa2_psk);
+    RUN_TEST(test_ie_parse_wpa1_only);
+    RUN_TEST(test_ie_parse_wpa_wpa2_either_order);
+    RUN_TEST(test_ie_parse_wps_not_wpa);
+    RUN_TEST(test_ie_rsn_multiple_suites_finds_caps);
+    RUN_TEST(test_ie_rsn_sae_only_pmf_required);
+    RUN_TEST(test_ie_rsn_mfpr_bit_is_bit6);
+    RUN_TEST(test_ie_rsn_enterprise);
+    RUN_TEST(test_ie_rsn_bogus_suite_count_rejected);
+    RUN_TEST(test_ie_rsn_version_and_group_only);
+    RUN_TEST(test_ie_parse_short_frame_rejected);
+    RUN_TEST(test_ie_parse_assoc_request_offset);
+    
+    // Benchmark
+    RUN_TEST(test_ie_benchmark_throughput);
+    
     return UNITY_END();
 }
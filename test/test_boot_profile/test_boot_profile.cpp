@@ -0,0 +1,198 @@
+// Boot Profile Tests
+// Tests src/core/boot_profile.h (boot timeline records, RTC rollover,
+// remembered SD clock ladder, heap conditioning gate)
+
+#include <unity.h>
+#include <cstring>
+#include "../../src/core/boot_profile.h"
+
+using namespace BootProfile;
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_marksRecordPhasesAndDurations(void) {
+    Timeline t;
+    t.begin(1);
+    t.mark(Phase::Start, 100000);
+    t.mark(Phase::Hardware, 350000);
+    t.mark(Phase::SdConfig, 500500);
+    TEST_ASSERT_EQUAL(3, t.count);
+    TEST_ASSERT_EQUAL_UINT32(100000, t.durationUs(0));
+    TEST_ASSERT_EQUAL_UINT32(250000, t.durationUs(1));
+    TEST_ASSERT_EQUAL_UINT32(150500, t.durationUs(2));
+    TEST_ASSERT_EQUAL_UINT32(0, t.durationUs(3));
+
+    uint32_t at = 0;
+    TEST_ASSERT_TRUE(t.find(Phase::Hardware, at));
+    TEST_ASSERT_EQUAL_UINT32(350000, at);
+    TEST_ASSERT_FALSE(t.find(Phase::Gps, at));
+}
+
+void test_interactiveOnlyOnceReady(void) {
+    Timeline t;
+    t.begin(1);
+    t.mark(Phase::Start, 1000);
+    TEST_ASSERT_EQUAL_UINT32(0, t.interactiveMs());
+    t.mark(Phase::Ready, 3456789);
+    TEST_ASSERT_EQUAL_UINT32(3456, t.interactiveMs());
+}
+
+void test_fullTimelineKeepsReady(void) {
+    Timeline t;
+    t.begin(1);
+    for (uint8_t i = 0; i < kMaxMarks + 5; i++) t.mark(Phase::Gps, i * 1000u);
+    TEST_ASSERT_EQUAL(kMaxMarks, t.count);
+    t.mark(Phase::Ready, 999000);
+    TEST_ASSERT_EQUAL(kMaxMarks, t.count);
+    TEST_ASSERT_EQUAL((int)Phase::Ready, t.phase[kMaxMarks - 1]);
+    TEST_ASSERT_EQUAL_UINT32(999, t.interactiveMs());
+}
+
+void test_rolloverKeepsPreviousAndCounts(void) {
+    Timeline cur;
+    Timeline prev;
+    // Power-on: RTC memory is garbage
+    memset(&cur, 0xA5, sizeof(cur));
+    memset(&prev, 0x5A, sizeof(prev));
+    rollover(cur, prev);
+    TEST_ASSERT_TRUE(cur.valid());
+    TEST_ASSERT_EQUAL(1, cur.bootCount);
+    TEST_ASSERT_EQUAL(0, cur.count);
+    TEST_ASSERT_FALSE(prev.valid());
+
+    // Boot 1 dies after SD_CONFIG; soft reset
+    cur.mark(Phase::Start, 100);
+    cur.mark(Phase::SdConfig, 900000);
+    cur.flags |= FLAG_SD_FIRST_TRY;
+    rollover(cur, prev);
+    TEST_ASSERT_TRUE(prev.valid());
+    TEST_ASSERT_EQUAL(1, prev.bootCount);
+    TEST_ASSERT_EQUAL(2, prev.count);
+    TEST_ASSERT_EQUAL_UINT32(0, prev.interactiveMs());
+    TEST_ASSERT_EQUAL(FLAG_SD_FIRST_TRY, prev.flags);
+    TEST_ASSERT_EQUAL(2, cur.bootCount);
+    TEST_ASSERT_EQUAL(0, cur.count);
+    TEST_ASSERT_EQUAL(0, cur.flags);
+}
+
+void test_ladderStartsAtRememberedClock(void) {
+    uint32_t out[kSdClockCount];
+    uint8_t n = sdLadder(10000000, out);
+    TEST_ASSERT_EQUAL(kSdClockCount, n);
+    TEST_ASSERT_EQUAL_UINT32(10000000, out[0]);
+    TEST_ASSERT_EQUAL_UINT32(25000000, out[1]);
+    TEST_ASSERT_EQUAL_UINT32(20000000, out[2]);
+    TEST_ASSERT_EQUAL_UINT32(8000000, out[3]);
+    TEST_ASSERT_EQUAL_UINT32(1000000, out[5]);
+}
+
+void test_ladderUnknownClockIsFastestFirst(void) {
+    uint32_t out[kSdClockCount];
+    // Nothing remembered, or a value from an older ladder
+    TEST_ASSERT_EQUAL(kSdClockCount, sdLadder(0, out));
+    for (uint8_t i = 0; i < kSdClockCount; i++) TEST_ASSERT_EQUAL_UINT32(kSdClocks[i], out[i]);
+    TEST_ASSERT_EQUAL(kSdClockCount, sdLadder(16000000, out));
+    TEST_ASSERT_EQUAL_UINT32(25000000, out[0]);
+    // Remembered fastest: same as the default order
+    sdLadder(25000000, out);
+    for (uint8_t i = 0; i < kSdClockCount; i++) TEST_ASSERT_EQUAL_UINT32(kSdClocks[i], out[i]);
+}
+
+void test_ladderProbeGoesFirst(void) {
+    uint32_t out[kSdClockCount];
+    TEST_ASSERT_EQUAL(kSdClockCount, sdLadder(4000000, out, 25000000));
+    TEST_ASSERT_EQUAL_UINT32(25000000, out[0]);
+    TEST_ASSERT_EQUAL_UINT32(4000000, out[1]);
+    TEST_ASSERT_EQUAL_UINT32(20000000, out[2]);
+    TEST_ASSERT_EQUAL_UINT32(1000000, out[5]);
+    // Probing the remembered clock is just the normal ladder
+    sdLadder(25000000, out, 25000000);
+    for (uint8_t i = 0; i < kSdClockCount; i++) TEST_ASSERT_EQUAL_UINT32(kSdClocks[i], out[i]);
+}
+
+void test_sdClockFlakyBootDoesNotStick(void) {
+    SdClockMemory m = {25000000, 0, 0};
+    // One bad boot only mounts at 1 MHz: remembered clock stays at 25
+    TEST_ASSERT_TRUE(sdNoteMount(m, 1000000));
+    TEST_ASSERT_EQUAL_UINT32(25000000, m.hz);
+    TEST_ASSERT_EQUAL_UINT32(1000000, m.lowerHz);
+    // Next boot is fine again: nothing left of the bad one
+    TEST_ASSERT_TRUE(sdNoteMount(m, 25000000));
+    TEST_ASSERT_EQUAL_UINT32(25000000, m.hz);
+    TEST_ASSERT_EQUAL_UINT32(0, m.lowerHz);
+    TEST_ASSERT_FALSE(sdNoteMount(m, 25000000));    // Steady state: no NVS write
+
+    // A card that really got slower moves down after two mounts in a row
+    sdNoteMount(m, 10000000);
+    TEST_ASSERT_EQUAL_UINT32(25000000, m.hz);
+    sdNoteMount(m, 10000000);
+    TEST_ASSERT_EQUAL_UINT32(10000000, m.hz);
+    // Faster is taken at once
+    sdNoteMount(m, 20000000);
+    TEST_ASSERT_EQUAL_UINT32(20000000, m.hz);
+}
+
+void test_sdClockReprobesFastest(void) {
+    // First boot ever was flaky and only mounted at 1 MHz
+    SdClockMemory m = {0, 0, 0};
+    sdNoteMount(m, 1000000);
+    TEST_ASSERT_EQUAL_UINT32(1000000, m.hz);
+
+    uint8_t boots = 0;
+    while (sdProbeClock(m) == 0 && boots < 100) {
+        sdNoteMount(m, 1000000);
+        boots++;
+    }
+    TEST_ASSERT_TRUE(boots <= kSdReprobeMounts);
+    TEST_ASSERT_EQUAL_UINT32(25000000, sdProbeClock(m));
+
+    // Probe fails, remembered clock mounts: wait another round
+    sdNoteMount(m, 1000000);
+    TEST_ASSERT_EQUAL_UINT32(1000000, m.hz);
+    TEST_ASSERT_EQUAL_UINT32(0, sdProbeClock(m));
+
+    // Probe succeeds: back at full speed, no more probing
+    while (sdProbeClock(m) == 0) sdNoteMount(m, 1000000);
+    sdNoteMount(m, 25000000);
+    TEST_ASSERT_EQUAL_UINT32(25000000, m.hz);
+    TEST_ASSERT_EQUAL(0, m.mounts);
+    TEST_ASSERT_EQUAL_UINT32(0, sdProbeClock(m));
+}
+
+void test_conditioningGate(void) {
+    TEST_ASSERT_TRUE(needsConditioning(30000, 40000));
+    TEST_ASSERT_FALSE(needsConditioning(40000, 40000));
+    TEST_ASSERT_FALSE(needsConditioning(90000, 40000));
+}
+
+void test_formatMark(void) {
+    Timeline t;
+    t.begin(7);
+    t.mark(Phase::Start, 100000);
+    t.mark(Phase::SdConfig, 242350);
+    char buf[64];
+    formatMark(t, 1, buf, sizeof(buf));
+    TEST_ASSERT_EQUAL_STRING("  SD_CONFIG    +  142.3 ms  @    242.3 ms", buf);
+    TEST_ASSERT_EQUAL(0, formatMark(t, 2, buf, sizeof(buf)));
+    TEST_ASSERT_EQUAL_STRING("READY", phaseName(Phase::Ready));
+    TEST_ASSERT_EQUAL_STRING("?", phaseName(Phase::Count));
+}
+
+int main(void) {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_marksRecordPhasesAndDurations);
+    RUN_TEST(test_interactiveOnlyOnceReady);
+    RUN_TEST(test_fullTimelineKeepsReady);
+    RUN_TEST(test_rolloverKeepsPreviousAndCounts);
+    RUN_TEST(test_ladderStartsAtRememberedClock);
+    RUN_TEST(test_ladderUnknownClockIsFastestFirst);
+    RUN_TEST(test_ladderProbeGoesFirst);
+    RUN_TEST(test_sdClockFlakyBootDoesNotStick);
+    RUN_TEST(test_sdClockReprobesFastest);
+    RUN_TEST(test_conditioningGate);
+    RUN_TEST(test_formatMark);
+
+    return UNITY_END();
+}
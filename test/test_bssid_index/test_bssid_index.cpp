@@ -0,0 +1,306 @@
+// BSSID Index Tests + Lookup Benchmark
+// Tests src/core/bssid_index.h (NetworkRecon BSSID -> slot index)
+// Benchmark compares linear memcmp scan vs hashed lookup at 50/200/1000 entries
+
+#include <unity.h>
+#include <cstdio>
+#include <cstring>
+#include <chrono>
+#include <utility>
+#include <vector>
+#include "../../src/core/bssid_index.h"
+
+void setUp(void) {}
+void tearDown(void) {}
+
+// ============================================================================
+// Helpers
+// ============================================================================
+
+struct FakeNet {
+    uint8_t bssid[6];
+    char ssid[33];
+    int8_t rssi;
+    uint8_t pad[64];  // Roughly DetectedNetwork-sized stride
+};
+
+static std::vector<FakeNet> table;
+
+static const uint8_t* keyAt(uint16_t slot) {
+    return table[slot].bssid;
+}
+
+// Deterministic pseudo-random BSSIDs, realistic OUI clustering
+static void makeBssid(uint32_t i, uint8_t* out) {
+    static const uint8_t ouis[4][3] = {
+        {0x64, 0xEE, 0xB7}, {0x00, 0x1A, 0x2B}, {0xDC, 0xA6, 0x32}, {0xF0, 0x9F, 0xC2}
+    };
+    const uint8_t* oui = ouis[i & 3];
+    uint32_t x = i * 2654435761u;
+    out[0] = oui[0];
+    out[1] = oui[1];
+    out[2] = oui[2];
+    out[3] = (uint8_t)(x >> 24);
+    out[4] = (uint8_t)(x >> 16);
+    out[5] = (uint8_t)i;
+}
+
+static void fillTable(uint32_t n) {
+    table.clear();
+    table.resize(n);
+    for (uint32_t i = 0; i < n; i++) {
+        memset(&table[i], 0, sizeof(FakeNet));
+        makeBssid(i, table[i].bssid);
+    }
+}
+
+static int linearFind(const uint8_t* bssid) {
+    for (size_t i = 0; i < table.size(); i++) {
+        if (memcmp(table[i].bssid, bssid, 6) == 0) return (int)i;
+    }
+    return -1;
+}
+
+// ============================================================================
+// Hash Tests
+// ============================================================================
+
+void test_bssidHash_deterministic(void) {
+    uint8_t a[6] = {0x64, 0xEE, 0xB7, 0x20, 0x82, 0x86};
+    TEST_ASSERT_EQUAL_UINT32(bssidHash(a), bssidHash(a));
+}
+
+void test_bssidHash_lastByteChangesHash(void) {
+    uint8_t a[6] = {0x64, 0xEE, 0xB7, 0x20, 0x82, 0x86};
+    uint8_t b[6] = {0x64, 0xEE, 0xB7, 0x20, 0x82, 0x87};
+    TEST_ASSERT_TRUE(bssidHash(a) != bssidHash(b));
+}
+
+void test_bssidHash_ouiChangesHash(void) {
+    uint8_t a[6] = {0x64, 0xEE, 0xB7, 0x20, 0x82, 0x86};
+    uint8_t b[6] = {0x65, 0xEE, 0xB7, 0x20, 0x82, 0x86};
+    TEST_ASSERT_TRUE(bssidHash(a) != bssidHash(b));
+}
+
+// ============================================================================
+// Index Tests
+// ============================================================================
+
+void test_index_emptyFindsNothing(void) {
+    fillTable(4);
+    BssidIndex<64> idx;
+    TEST_ASSERT_EQUAL_UINT16(0, idx.size());
+    TEST_ASSERT_EQUAL_INT(-1, idx.find(table[0].bssid, keyAt));
+}
+
+void test_index_insertAndFind(void) {
+    fillTable(20);
+    BssidIndex<64> idx;
+    for (uint16_t i = 0; i < 20; i++) {
+        TEST_ASSERT_TRUE(idx.insert(table[i].bssid, i));
+    }
+    TEST_ASSERT_EQUAL_UINT16(20, idx.size());
+    for (uint16_t i = 0; i < 20; i++) {
+        TEST_ASSERT_EQUAL_INT(i, idx.find(table[i].bssid, keyAt));
+    }
+}
+
+void test_index_missReturnsMinusOne(void) {
+    fillTable(20);
+    BssidIndex<64> idx;
+    idx.rebuild(20, keyAt);
+    uint8_t unknown[6] = {0xDE, 0xAD, 0xBE, 0xEF, 0x00, 0x01};
+    TEST_ASSERT_EQUAL_INT(-1, idx.find(unknown, keyAt));
+}
+
+void test_index_rejectsOverLoadLimit(void) {
+    fillTable(40);
+    BssidIndex<64> idx;
+    for (uint16_t i = 0; i < 32; i++) {
+        TEST_ASSERT_TRUE(idx.insert(table[i].bssid, i));
+    }
+    TEST_ASSERT_FALSE(idx.insert(table[32].bssid, 32));
+    TEST_ASSERT_FALSE(idx.rebuild(40, keyAt));
+    TEST_ASSERT_EQUAL_UINT16(0, idx.size());
+}
+
+void test_index_removeKeepsOthersReachable(void) {
+    fillTable(30);
+    BssidIndex<64> idx;
+    idx.rebuild(30, keyAt);
+    // Remove every third entry, the rest must still resolve
+    for (uint16_t i = 0; i < 30; i += 3) {
+        TEST_ASSERT_TRUE(idx.remove(table[i].bssid, i));
+    }
+    TEST_ASSERT_EQUAL_UINT16(20, idx.size());
+    for (uint16_t i = 0; i < 30; i++) {
+        int expected = (i % 3 == 0) ? -1 : (int)i;
+        TEST_ASSERT_EQUAL_INT(expected, idx.find(table[i].bssid, keyAt));
+    }
+}
+
+void test_index_removeAbsentReturnsFalse(void) {
+    fillTable(10);
+    BssidIndex<64> idx;
+    idx.rebuild(5, keyAt);
+    TEST_ASSERT_FALSE(idx.remove(table[7].bssid, 7));
+    TEST_ASSERT_EQUAL_UINT16(5, idx.size());
+}
+
+void test_index_replaceSlot(void) {
+    // Eviction path: slot 3 now holds a different BSSID
+    fillTable(10);
+    BssidIndex<64> idx;
+    idx.rebuild(10, keyAt);
+    uint8_t oldBssid[6];
+    memcpy(oldBssid, table[3].bssid, 6);
+    TEST_ASSERT_TRUE(idx.remove(table[3].bssid, 3));
+    makeBssid(9999, table[3].bssid);
+    TEST_ASSERT_TRUE(idx.insert(table[3].bssid, 3));
+    TEST_ASSERT_EQUAL_INT(3, idx.find(table[3].bssid, keyAt));
+    TEST_ASSERT_EQUAL_INT(-1, idx.find(oldBssid, keyAt));
+}
+
+void test_index_collidingChainWrapsAround(void) {
+    // Tiny table forces probe chains to wrap past the last bucket
+    fillTable(4);
+    BssidIndex<8> idx;
+    TEST_ASSERT_TRUE(idx.rebuild(4, keyAt));
+    for (uint16_t i = 0; i < 4; i++) {
+        TEST_ASSERT_EQUAL_INT(i, idx.find(table[i].bssid, keyAt));
+    }
+    for (uint16_t i = 0; i < 4; i++) {
+        TEST_ASSERT_TRUE(idx.remove(table[i].bssid, i));
+        for (uint16_t j = i + 1; j < 4; j++) {
+            TEST_ASSERT_EQUAL_INT(j, idx.find(table[j].bssid, keyAt));
+        }
+    }
+    TEST_ASSERT_EQUAL_UINT16(0, idx.size());
+}
+
+void test_index_churnMatchesLinearScan(void) {
+    // Random insert/evict churn at recon capacity; index must agree with scan
+    fillTable(200);
+    BssidIndex<512> idx;
+    idx.rebuild(200, keyAt);
+    uint32_t seed = 12345;
+    for (uint32_t round = 0; round < 2000; round++) {
+        seed = seed * 1103515245u + 12345u;
+        uint16_t slot = (uint16_t)((seed >> 16) % 200);
+        idx.remove(table[slot].bssid, slot);
+        makeBssid(1000 + round, table[slot].bssid);
+        idx.insert(table[slot].bssid, slot);
+    }
+    TEST_ASSERT_EQUAL_UINT16(200, idx.size());
+    for (uint16_t i = 0; i < 200; i++) {
+        TEST_ASSERT_EQUAL_INT(linearFind(table[i].bssid), idx.find(table[i].bssid, keyAt));
+    }
+}
+
+void test_index_reorderNeedsInvalidate(void) {
+    // OINK sorts the shared table in place: same size, every slot moved
+    fillTable(100);
+    BssidIndex<512> idx;
+    idx.rebuild(100, keyAt);
+    TEST_ASSERT_FALSE(idx.needsRebuild(100));
+
+    for (size_t i = 0; i < table.size() / 2; i++) {
+        std::swap(table[i], table[table.size() - 1 - i]);
+    }
+    TEST_ASSERT_FALSE(idx.needsRebuild(100));   // Size alone can't tell
+    TEST_ASSERT_EQUAL_INT(-1, idx.find(table[0].bssid, keyAt));
+
+    idx.invalidate();
+    TEST_ASSERT_TRUE(idx.needsRebuild(100));
+    idx.rebuild(100, keyAt);
+    TEST_ASSERT_FALSE(idx.needsRebuild(100));
+    for (uint16_t i = 0; i < 100; i++) {
+        TEST_ASSERT_EQUAL_INT(i, idx.find(table[i].bssid, keyAt));
+    }
+}
+
+void test_index_sizeChangeNeedsRebuild(void) {
+    fillTable(10);
+    BssidIndex<64> idx;
+    idx.rebuild(10, keyAt);
+    TEST_ASSERT_TRUE(idx.needsRebuild(11));
+    TEST_ASSERT_TRUE(idx.needsRebuild(9));
+    idx.clear();
+    TEST_ASSERT_FALSE(idx.needsRebuild(0));
+}
+
+// ============================================================================
+// Benchmark: linear scan vs index at 50/200/1000 entries
+// Half hits, half misses (misses are the common case for new beacons)
+// ============================================================================
+
+template <uint16_t SLOTS>
+static void benchLookup(uint32_t n) {
+    fillTable(n);
+    BssidIndex<SLOTS> idx;
+    TEST_ASSERT_TRUE(idx.rebuild((uint16_t)n, keyAt));
+
+    const uint32_t kQueries = 2048;
+    static uint8_t queries[kQueries][6];
+    for (uint32_t q = 0; q < kQueries; q++) {
+        makeBssid((q & 1) ? (q * 7) % n : 50000 + q, queries[q]);
+    }
+
+    const int kRounds = 50;
+    volatile int sink = 0;
+
+    auto t0 = std::chrono::steady_clock::now();
+    for (int r = 0; r < kRounds; r++) {
+        for (uint32_t q = 0; q < kQueries; q++) sink += linearFind(queries[q]);
+    }
+    auto t1 = std::chrono::steady_clock::now();
+    for (int r = 0; r < kRounds; r++) {
+        for (uint32_t q = 0; q < kQueries; q++) sink += idx.find(queries[q], keyAt);
+    }
+    auto t2 = std::chrono::steady_clock::now();
+
+    double total = (double)kRounds * kQueries;
+    double linearNs = std::chrono::duration<double, std::nano>(t1 - t0).count() / total;
+    double indexNs = std::chrono::duration<double, std::nano>(t2 - t1).count() / total;
+    printf("[BENCH] n=%4u linear=%8.1f ns/lookup  index=%6.1f ns/lookup  speedup=%.1fx\n",
+           n, linearNs, indexNs, indexNs > 0 ? linearNs / indexNs : 0.0);
+
+    // Results must agree
+    for (uint32_t q = 0; q < kQueries; q++) {
+        TEST_ASSERT_EQUAL_INT(linearFind(queries[q]), idx.find(queries[q], keyAt));
+    }
+    (void)sink;
+}
+
+void test_bench_lookup_50(void) { benchLookup<128>(50); }
+void test_bench_lookup_200(void) { benchLookup<512>(200); }
+void test_bench_lookup_1000(void) { benchLookup<2048>(1000); }
+
+int main(void) {
+    UNITY_BEGIN();
+
+    // Hash
+    RUN_TEST(test_bssidHash_deterministic);
+    RUN_TEST(test_bssidHash_lastByteChangesHash);
+    RUN_TEST(test_bssidHash_ouiChangesHash);
+
+    // Index
+    RUN_TEST(test_index_emptyFindsNothing);
+    RUN_TEST(test_index_insertAndFind);
+    RUN_TEST(test_index_missReturnsMinusOne);
+    RUN_TEST(test_index_rejectsOverLoadLimit);
+    RUN_TEST(test_index_removeKeepsOthersReachable);
+    RUN_TEST(test_index_removeAbsentReturnsFalse);
+    RUN_TEST(test_index_replaceSlot);
+    RUN_TEST(test_index_collidingChainWrapsAround);
+    RUN_TEST(test_index_churnMatchesLinearScan);
+    RUN_TEST(test_index_reorderNeedsInvalidate);
+    RUN_TEST(test_index_sizeChangeNeedsRebuild);
+
+    // Benchmark
+    RUN_TEST(test_bench_lookup_50);
+    RUN_TEST(test_bench_lookup_200);
+    RUN_TEST(test_bench_lookup_1000);
+
+    return UNITY_END();
+}
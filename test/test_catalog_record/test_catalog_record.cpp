@@ -0,0 +1,392 @@
+// Capture Catalog Record Tests
+// Tests src/core/catalog_record.h (records, file names, rebuild merge, index)
+
+#include <unity.h>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+#include "../../src/core/catalog_record.h"
+
+using namespace CatalogRecord;
+
+void setUp(void) {}
+void tearDown(void) {}
+
+static const uint8_t BSSID_A[6] = {0x64, 0xEE, 0xB7, 0x20, 0x82, 0x86};
+static const uint8_t BSSID_B[6] = {0x00, 0x11, 0x22, 0x33, 0x44, 0x55};
+
+static Entry makeEntry(const uint8_t* bssid, uint8_t kind, uint32_t mtime, const char* ssid) {
+    Entry e = {};
+    memcpy(e.bssid, bssid, 6);
+    e.kind = kind;
+    e.files = kind == kPmkid ? kFilePmkid22000 : kFileHs22000;
+    e.size = 1234;
+    e.mtime = mtime;
+    strncpy(e.ssid, ssid, kMaxSsid);
+    return e;
+}
+
+// Catalog file image: header + records in append order
+struct Image {
+    std::vector<uint8_t> bytes;
+    Image() {
+        bytes.resize(kFileHeaderLen);
+        encodeFileHeader(bytes.data());
+    }
+    void add(uint8_t op, const Entry& e) {
+        uint8_t rec[kRecordLen];
+        encode(rec, op, e);
+        bytes.insert(bytes.end(), rec, rec + kRecordLen);
+    }
+    // What load() does: fixed stride, bad records skipped, torn tail ignored
+    std::vector<Slot> slots(size_t* bad = nullptr) const {
+        std::vector<Slot> out;
+        size_t badCount = 0;
+        for (size_t off = kFileHeaderLen; off + kRecordLen <= bytes.size(); off += kRecordLen) {
+            uint8_t op;
+            Entry e;
+            if (decode(bytes.data() + off, op, e)) out.push_back(makeSlot(op, e, (uint32_t)off));
+            else badCount++;
+        }
+        if (bad) *bad = badCount;
+        return out;
+    }
+};
+
+// ============================================================================
+// Records
+// ============================================================================
+
+void test_record_roundTrip(void) {
+    Entry e = makeEntry(BSSID_A, kHandshake, 1700000000u, "PorkNet");
+    e.status = kCracked;
+    e.files = kFilePcap | kFileHs22000;
+    uint8_t rec[kRecordLen];
+    encode(rec, kPut, e);
+
+    uint8_t op = 0;
+    Entry out;
+    TEST_ASSERT_TRUE(decode(rec, op, out));
+    TEST_ASSERT_EQUAL_UINT8(kPut, op);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(BSSID_A, out.bssid, 6);
+    TEST_ASSERT_EQUAL_UINT8(kHandshake, out.kind);
+    TEST_ASSERT_EQUAL_UINT8(kCracked, out.status);
+    TEST_ASSERT_EQUAL_UINT8(kFilePcap | kFileHs22000, out.files);
+    TEST_ASSERT_EQUAL_UINT32(1234, out.size);
+    TEST_ASSERT_EQUAL_UINT32(1700000000u, out.mtime);
+    TEST_ASSERT_EQUAL_STRING("PorkNet", out.ssid);
+}
+
+void test_record_maxSsidKept(void) {
+    Entry e = makeEntry(BSSID_A, kPmkid, 1, "");
+    memset(e.ssid, 'x', kMaxSsid);
+    e.ssid[kMaxSsid] = '\0';
+    uint8_t rec[kRecordLen];
+    encode(rec, kPut, e);
+    uint8_t op;
+    Entry out;
+    TEST_ASSERT_TRUE(decode(rec, op, out));
+    TEST_ASSERT_EQUAL(kMaxSsid, strlen(out.ssid));
+}
+
+void test_record_corruptionRejected(void) {
+    Entry e = makeEntry(BSSID_A, kHandshake, 5, "A");
+    uint8_t rec[kRecordLen];
+    uint8_t op;
+    Entry out;
+    for (size_t i = 0; i < kRecordLen; i++) {
+        encode(rec, kPut, e);
+        rec[i] ^= 0x40;
+        TEST_ASSERT_FALSE(decode(rec, op, out));
+    }
+    uint8_t zeros[kRecordLen] = {0};
+    TEST_ASSERT_FALSE(decode(zeros, op, out));
+}
+
+void test_fileHeader_versionChecked(void) {
+    uint8_t h[kFileHeaderLen];
+    encodeFileHeader(h);
+    TEST_ASSERT_TRUE(checkFileHeader(h));
+    h[4]++;
+    TEST_ASSERT_FALSE(checkFileHeader(h));
+    encodeFileHeader(h);
+    h[6]++;
+    TEST_ASSERT_FALSE(checkFileHeader(h));
+}
+
+// ============================================================================
+// File names
+// ============================================================================
+
+void test_parseName_allCaptureFiles(void) {
+    uint8_t bssid[6];
+    uint8_t kind;
+    uint8_t file;
+    TEST_ASSERT_TRUE(parseName("64EEB7208286.pcap", bssid, kind, file));
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(BSSID_A, bssid, 6);
+    TEST_ASSERT_EQUAL_UINT8(kHandshake, kind);
+    TEST_ASSERT_EQUAL_UINT8(kFilePcap, file);
+
+    TEST_ASSERT_TRUE(parseName("/m5porkchop/handshakes/64EEB7208286_hs.22000", bssid, kind, file));
+    TEST_ASSERT_EQUAL_UINT8(kHandshake, kind);
+    TEST_ASSERT_EQUAL_UINT8(kFileHs22000, file);
+
+    TEST_ASSERT_TRUE(parseName("64eeb7208286.22000", bssid, kind, file));
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(BSSID_A, bssid, 6);
+    TEST_ASSERT_EQUAL_UINT8(kPmkid, kind);
+    TEST_ASSERT_EQUAL_UINT8(kFilePmkid22000, file);
+
+    TEST_ASSERT_TRUE(parseName("64EEB7208286.txt", bssid, kind, file));
+    TEST_ASSERT_EQUAL_UINT8(kHandshake, kind);
+    TEST_ASSERT_EQUAL_UINT8(kFileSsid, file);
+
+    TEST_ASSERT_TRUE(parseName("64EEB7208286_pmkid.txt", bssid, kind, file));
+    TEST_ASSERT_EQUAL_UINT8(kPmkid, kind);
+    TEST_ASSERT_EQUAL_UINT8(kFileSsid, file);
+}
+
+void test_parseName_rejectsOthers(void) {
+    uint8_t bssid[6];
+    uint8_t kind;
+    uint8_t file;
+    TEST_ASSERT_FALSE(parseName("capture.pcap", bssid, kind, file));
+    TEST_ASSERT_FALSE(parseName("64EEB720828.pcap", bssid, kind, file));
+    TEST_ASSERT_FALSE(parseName("64EEB7208286.pcapng", bssid, kind, file));
+    TEST_ASSERT_FALSE(parseName("64EEB7208286_hs.22000.bak", bssid, kind, file));
+    TEST_ASSERT_FALSE(parseName("64EEB72082G6.pcap", bssid, kind, file));
+    TEST_ASSERT_FALSE(parseName("", bssid, kind, file));
+    TEST_ASSERT_FALSE(parseName(nullptr, bssid, kind, file));
+}
+
+void test_listedName_prefers22000(void) {
+    char name[32];
+    Entry e = makeEntry(BSSID_A, kHandshake, 1, "");
+    e.files = kFilePcap;
+    listedName(e, name, sizeof(name));
+    TEST_ASSERT_EQUAL_STRING("64EEB7208286.pcap", name);
+    e.files = kFilePcap | kFileHs22000;
+    listedName(e, name, sizeof(name));
+    TEST_ASSERT_EQUAL_STRING("64EEB7208286_hs.22000", name);
+    e.kind = kPmkid;
+    listedName(e, name, sizeof(name));
+    TEST_ASSERT_EQUAL_STRING("64EEB7208286.22000", name);
+}
+
+// ============================================================================
+// Rebuild merge
+// ============================================================================
+
+void test_merge_pcapThen22000And22000ThenPcap(void) {
+    std::vector<Entry> table;
+    // Directory order is arbitrary: either way the 22000 file is listed
+    Entry& a = findOrInsert(table, BSSID_A, kHandshake);
+    mergeFile(a, kFilePcap, 4000, 10);
+    mergeFile(a, kFileHs22000, 600, 20);
+    Entry& b = findOrInsert(table, BSSID_B, kHandshake);
+    mergeFile(b, kFileHs22000, 700, 30);
+    mergeFile(b, kFilePcap, 5000, 40);
+
+    TEST_ASSERT_EQUAL(2, table.size());
+    const Entry& ea = findOrInsert(table, BSSID_A, kHandshake);
+    TEST_ASSERT_EQUAL_UINT8(kFilePcap | kFileHs22000, ea.files);
+    TEST_ASSERT_EQUAL_UINT32(600, ea.size);
+    TEST_ASSERT_EQUAL_UINT32(20, ea.mtime);
+    const Entry& eb = findOrInsert(table, BSSID_B, kHandshake);
+    TEST_ASSERT_EQUAL_UINT32(700, eb.size);
+    TEST_ASSERT_EQUAL_UINT32(30, eb.mtime);
+}
+
+void test_merge_tableStaysSortedAndKeyedByKind(void) {
+    std::vector<Entry> table;
+    uint8_t bssid[6] = {0};
+    for (int i = 200; i >= 0; i -= 3) {
+        bssid[5] = (uint8_t)i;
+        findOrInsert(table, bssid, kPmkid);
+        findOrInsert(table, bssid, kHandshake);
+    }
+    size_t n = table.size();
+    bssid[5] = 200;
+    findOrInsert(table, bssid, kPmkid);   // Existing key: no insert
+    TEST_ASSERT_EQUAL(n, table.size());
+    for (size_t i = 1; i < table.size(); i++) {
+        TEST_ASSERT_TRUE(compareKey(table[i - 1].bssid, table[i - 1].kind,
+                                    table[i].bssid, table[i].kind) < 0);
+    }
+}
+
+// ============================================================================
+// Index
+// ============================================================================
+
+void test_index_newestRecordWinsAndDeleteDrops(void) {
+    Image img;
+    img.add(kPut, makeEntry(BSSID_A, kHandshake, 100, "old"));
+    img.add(kPut, makeEntry(BSSID_B, kHandshake, 200, "b"));
+    img.add(kPut, makeEntry(BSSID_A, kPmkid, 150, "pmk"));
+    Entry a2 = makeEntry(BSSID_A, kHandshake, 300, "new");
+    a2.status = kUploaded;
+    img.add(kPut, a2);
+    img.add(kDelete, makeEntry(BSSID_B, kHandshake, 0, ""));
+
+    std::vector<Slot> slots = img.slots();
+    size_t dead = finalize(slots);
+    TEST_ASSERT_EQUAL(3, dead);
+    TEST_ASSERT_EQUAL(2, slots.size());
+
+    // Newest first
+    TEST_ASSERT_EQUAL_UINT32(300, slots[0].mtime);
+    TEST_ASSERT_EQUAL_UINT8(kUploaded, slots[0].status);
+    TEST_ASSERT_EQUAL_UINT32(kFileHeaderLen + 3 * kRecordLen, slots[0].offset);
+    TEST_ASSERT_EQUAL_UINT8(kPmkid, slots[1].kind);
+
+    uint8_t op;
+    Entry e;
+    TEST_ASSERT_TRUE(decode(img.bytes.data() + slots[0].offset, op, e));
+    TEST_ASSERT_EQUAL_STRING("new", e.ssid);
+}
+
+void test_index_putWithoutFilesIsNotListed(void) {
+    Image img;
+    Entry gone = makeEntry(BSSID_A, kHandshake, 10, "x");
+    img.add(kPut, gone);
+    gone.files = 0;   // File server deleted both files
+    img.add(kPut, gone);
+    std::vector<Slot> slots = img.slots();
+    finalize(slots);
+    TEST_ASSERT_EQUAL(0, slots.size());
+}
+
+void test_index_readdAfterDelete(void) {
+    Image img;
+    img.add(kPut, makeEntry(BSSID_A, kPmkid, 10, "x"));
+    img.add(kDelete, makeEntry(BSSID_A, kPmkid, 0, ""));
+    img.add(kPut, makeEntry(BSSID_A, kPmkid, 20, "y"));
+    std::vector<Slot> slots = img.slots();
+    finalize(slots);
+    TEST_ASSERT_EQUAL(1, slots.size());
+    TEST_ASSERT_EQUAL_UINT32(20, slots[0].mtime);
+}
+
+void test_index_corruptAndTornRecordsSkipped(void) {
+    Image img;
+    img.add(kPut, makeEntry(BSSID_A, kHandshake, 10, "a"));
+    img.add(kPut, makeEntry(BSSID_B, kHandshake, 20, "b"));
+    img.add(kPut, makeEntry(BSSID_A, kPmkid, 30, "c"));
+    img.bytes[kFileHeaderLen + kRecordLen + 30] ^= 0xFF;     // Corrupt B
+    img.bytes.resize(img.bytes.size() - 7);                   // Tear the last one
+
+    size_t bad = 0;
+    std::vector<Slot> slots = img.slots(&bad);
+    TEST_ASSERT_EQUAL(1, bad);
+    finalize(slots);
+    TEST_ASSERT_EQUAL(1, slots.size());
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(BSSID_A, slots[0].bssid, 6);
+    TEST_ASSERT_EQUAL_UINT8(kHandshake, slots[0].kind);
+}
+
+// What load() does for the status marks: fold every record in file order
+static std::vector<StatusMark> foldImage(const Image& img) {
+    std::vector<StatusMark> marks;
+    for (size_t off = kFileHeaderLen; off + kRecordLen <= img.bytes.size(); off += kRecordLen) {
+        uint8_t op;
+        Entry e;
+        if (decode(img.bytes.data() + off, op, e)) foldStatus(marks, op, e);
+    }
+    return marks;
+}
+
+void test_statusMarks_carriedAcrossResave(void) {
+    Image img;
+    Entry a = makeEntry(BSSID_A, kHandshake, 10, "a");
+    img.add(kPut, a);
+    a.status = kCracked;                                   // setStatus()
+    img.add(kPut, a);
+    img.add(kPut, makeEntry(BSSID_A, kPmkid, 20, "a"));      // Other kind
+    Entry b = makeEntry(BSSID_B, kHandshake, 30, "b");
+    b.status = kUploaded;
+    img.add(kPut, b);
+
+    std::vector<StatusMark> marks = foldImage(img);
+    TEST_ASSERT_EQUAL(2, marks.size());                    // Local keys not kept
+    TEST_ASSERT_EQUAL_UINT8(kCracked, markedStatus(marks, BSSID_A, kHandshake));
+    TEST_ASSERT_EQUAL_UINT8(kLocal, markedStatus(marks, BSSID_A, kPmkid));
+    TEST_ASSERT_EQUAL_UINT8(kUploaded, markedStatus(marks, BSSID_B, kHandshake));
+
+    // Deleting the files starts the key over
+    img.add(kDelete, makeEntry(BSSID_A, kHandshake, 0, ""));
+    marks = foldImage(img);
+    TEST_ASSERT_EQUAL(1, marks.size());
+    TEST_ASSERT_EQUAL_UINT8(kLocal, markedStatus(marks, BSSID_A, kHandshake));
+}
+
+void test_statusMarks_appendsMatchFullFold(void) {
+    // Writers fold each record they append; the table must match a reload
+    Image img;
+    std::vector<StatusMark> live;
+    uint8_t bssid[6] = {0x02, 0, 0, 0, 0, 0};
+    uint32_t seed = 7;
+    for (uint32_t i = 0; i < 600; i++) {
+        seed = seed * 1103515245u + 12345u;
+        bssid[5] = (uint8_t)((seed >> 16) % 40);
+        Entry e = makeEntry(bssid, (seed >> 8) & 1 ? kPmkid : kHandshake, i, "n");
+        e.status = (uint8_t)((seed >> 20) % 3);
+        uint8_t op = (seed >> 24) % 5 == 0 ? kDelete : kPut;
+        img.add(op, e);
+        foldStatus(live, op, e);
+    }
+    std::vector<StatusMark> full = foldImage(img);
+    TEST_ASSERT_EQUAL(full.size(), live.size());
+    for (size_t i = 0; i < full.size(); i++) {
+        TEST_ASSERT_EQUAL_UINT8_ARRAY(full[i].bssid, live[i].bssid, 6);
+        TEST_ASSERT_EQUAL_UINT8(full[i].kind, live[i].kind);
+        TEST_ASSERT_EQUAL_UINT8(full[i].status, live[i].status);
+        if (i > 0) {
+            TEST_ASSERT_TRUE(compareKey(full[i - 1].bssid, full[i - 1].kind,
+                                        full[i].bssid, full[i].kind) < 0);
+        }
+    }
+}
+
+void test_index_largeCatalogNoCap(void) {
+    // The directory scan stopped at 100; the catalog lists everything
+    Image img;
+    uint8_t bssid[6] = {0x02, 0, 0, 0, 0, 0};
+    for (uint32_t i = 0; i < 1500; i++) {
+        bssid[4] = (uint8_t)(i >> 8);
+        bssid[5] = (uint8_t)i;
+        img.add(kPut, makeEntry(bssid, i % 3 == 0 ? kPmkid : kHandshake, 1000 + i, "n"));
+    }
+    std::vector<Slot> slots = img.slots();
+    TEST_ASSERT_EQUAL(0, finalize(slots));
+    TEST_ASSERT_EQUAL(1500, slots.size());
+    for (size_t i = 1; i < slots.size(); i++) {
+        TEST_ASSERT_TRUE(slots[i - 1].mtime >= slots[i].mtime);
+    }
+    TEST_ASSERT_TRUE(sizeof(Slot) <= 20);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_record_roundTrip);
+    RUN_TEST(test_record_maxSsidKept);
+    RUN_TEST(test_record_corruptionRejected);
+    RUN_TEST(test_fileHeader_versionChecked);
+
+    RUN_TEST(test_parseName_allCaptureFiles);
+    RUN_TEST(test_parseName_rejectsOthers);
+    RUN_TEST(test_listedName_prefers22000);
+
+    RUN_TEST(test_merge_pcapThen22000And22000ThenPcap);
+    RUN_TEST(test_merge_tableStaysSortedAndKeyedByKind);
+
+    RUN_TEST(test_index_newestRecordWinsAndDeleteDrops);
+    RUN_TEST(test_index_putWithoutFilesIsNotListed);
+    RUN_TEST(test_index_readdAfterDelete);
+    RUN_TEST(test_index_corruptAndTornRecordsSkipped);
+    RUN_TEST(test_index_largeCatalogNoCap);
+    RUN_TEST(test_statusMarks_carriedAcrossResave);
+    RUN_TEST(test_statusMarks_appendsMatchFullFold);
+
+    return UNITY_END();
+}
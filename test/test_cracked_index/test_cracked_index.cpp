@@ -0,0 +1,379 @@
+// Cracked Index Tests
+// Tests src/core/cracked_index.h (format, potfile parsing, external sort, lookup)
+
+#include <unity.h>
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+#include "../../src/core/cracked_index.h"
+
+using namespace CrackedIndex;
+
+void setUp(void) {}
+void tearDown(void) {}
+
+static Entry makeEntry(uint32_t id, uint32_t offset) {
+    Entry e;
+    e.key[0] = 0x64;
+    e.key[1] = 0xEE;
+    e.key[2] = (uint8_t)(id >> 24);
+    e.key[3] = (uint8_t)(id >> 16);
+    e.key[4] = (uint8_t)(id >> 8);
+    e.key[5] = (uint8_t)id;
+    e.offset = offset;
+    return e;
+}
+
+// Source over a vector slice, like a run of the runs file
+struct VecSource {
+    const std::vector<Entry>& v;
+    size_t pos;
+    size_t end;
+    VecSource(const std::vector<Entry>& vec, size_t from, size_t to) : v(vec), pos(from), end(to) {}
+    bool next(Entry& e) {
+        if (pos >= end) return false;
+        e = v[pos++];
+        return true;
+    }
+};
+
+struct VecSink {
+    std::vector<Entry> out;
+    size_t failAfter = (size_t)-1;
+    bool put(const Entry& e) {
+        if (out.size() >= failAfter) return false;
+        out.push_back(e);
+        return true;
+    }
+};
+
+// Index image: what the final merge pass writes (sorted entries, no header)
+struct IndexImage {
+    std::vector<uint8_t> bytes;
+    uint32_t count = 0;
+    size_t reads = 0;
+    explicit IndexImage(const std::vector<Entry>& sorted) {
+        bytes.resize(sorted.size() * kEntryLen);
+        for (size_t i = 0; i < sorted.size(); i++) encodeEntry(bytes.data() + i * kEntryLen, sorted[i]);
+        count = (uint32_t)sorted.size();
+    }
+    size_t operator()(uint32_t pageNo, uint8_t* out, size_t maxEntries) {
+        reads++;
+        uint32_t first = pageNo * kPageEntries;
+        if (first >= count) return 0;
+        size_t n = std::min<size_t>(count - first, maxEntries);
+        memcpy(out, bytes.data() + first * kEntryLen, n * kEntryLen);
+        return n;
+    }
+};
+
+// What WPASec::buildCrackedIndex() does with the runs file, in memory
+static std::vector<Entry> externalSort(const std::vector<Entry>& input, size_t runEntries, long* written) {
+    std::vector<Entry> runs = input;
+    for (size_t i = 0; i < runs.size(); i += runEntries) {
+        std::sort(runs.begin() + i, runs.begin() + std::min(i + runEntries, runs.size()), entryLess);
+    }
+    size_t total = runs.size();
+    size_t runLen = runEntries;
+    while (total > 2 * runLen) {
+        VecSink sink;
+        for (size_t start = 0; start < total; start += 2 * runLen) {
+            size_t mid = std::min(start + runLen, total);
+            size_t end = std::min(mid + runLen, total);
+            VecSource a(runs, start, mid);
+            VecSource b(runs, mid, end);
+            mergeRuns(a, b, sink, false);
+        }
+        runs = sink.out;
+        runLen *= 2;
+    }
+    size_t mid = std::min(runLen, total);
+    VecSource a(runs, 0, mid);
+    VecSource b(runs, mid, total);
+    VecSink sink;
+    *written = mergeRuns(a, b, sink, true);
+    return sink.out;
+}
+
+// ============================================================================
+// Format
+// ============================================================================
+
+void test_header_roundTripAndVersionChecked(void) {
+    uint8_t buf[kHeaderLen];
+    Header h = {1234, 56789, 0x5F5E1000};
+    encodeHeader(buf, h);
+    Header out = {};
+    TEST_ASSERT_TRUE(decodeHeader(buf, out));
+    TEST_ASSERT_EQUAL_UINT32(1234, out.count);
+    TEST_ASSERT_EQUAL_UINT32(56789, out.potfileSize);
+    TEST_ASSERT_EQUAL_UINT32(0x5F5E1000, out.potfileMtime);
+
+    buf[4] = 2;
+    TEST_ASSERT_FALSE(decodeHeader(buf, out));
+    encodeHeader(buf, h);
+    buf[6] = 12;
+    TEST_ASSERT_FALSE(decodeHeader(buf, out));
+    encodeHeader(buf, h);
+    buf[0] = 'X';
+    TEST_ASSERT_FALSE(decodeHeader(buf, out));
+}
+
+void test_entry_roundTripAndOrder(void) {
+    uint8_t buf[kEntryLen];
+    Entry e = makeEntry(0xA1B2C3D4, 0x00ABCDEF);
+    encodeEntry(buf, e);
+    Entry out;
+    decodeEntry(buf, out);
+    TEST_ASSERT_EQUAL_MEMORY(e.key, out.key, 6);
+    TEST_ASSERT_EQUAL_UINT32(0x00ABCDEF, out.offset);
+
+    // Key first, then potfile order
+    TEST_ASSERT_TRUE(entryLess(makeEntry(1, 900), makeEntry(2, 0)));
+    TEST_ASSERT_TRUE(entryLess(makeEntry(2, 10), makeEntry(2, 20)));
+    TEST_ASSERT_FALSE(entryLess(makeEntry(2, 20), makeEntry(2, 20)));
+}
+
+// ============================================================================
+// Parsing
+// ============================================================================
+
+void test_parseKey_formats(void) {
+    const uint8_t expect[6] = {0x64, 0xEE, 0xB7, 0x20, 0x82, 0x86};
+    uint8_t key[6];
+    TEST_ASSERT_TRUE(parseKey("64EEB7208286", key));
+    TEST_ASSERT_EQUAL_MEMORY(expect, key, 6);
+    TEST_ASSERT_TRUE(parseKey("64:ee:b7:20:82:86", key));
+    TEST_ASSERT_EQUAL_MEMORY(expect, key, 6);
+    TEST_ASSERT_TRUE(parseKey("64-EE-B7-20-82-86", key));
+    TEST_ASSERT_EQUAL_MEMORY(expect, key, 6);
+
+    TEST_ASSERT_FALSE(parseKey("64EEB720828", key));
+    TEST_ASSERT_FALSE(parseKey("64EEB72082861", key));
+    TEST_ASSERT_FALSE(parseKey("64EEB720828G", key));
+    TEST_ASSERT_FALSE(parseKey("", key));
+    TEST_ASSERT_FALSE(parseKey(nullptr, key));
+}
+
+void test_parsePotLine_fields(void) {
+    const char* line = "64EEB7208286:AABBCCDDEEFF:HomeNet:hunter22\r\n";
+    PotLine pl;
+    TEST_ASSERT_TRUE(parsePotLine(line, strlen(line), pl));
+    const uint8_t expect[6] = {0x64, 0xEE, 0xB7, 0x20, 0x82, 0x86};
+    TEST_ASSERT_EQUAL_MEMORY(expect, pl.key, 6);
+    TEST_ASSERT_EQUAL_STRING_LEN("HomeNet", line + pl.ssidStart, pl.ssidLen);
+    TEST_ASSERT_EQUAL(7, pl.ssidLen);
+    TEST_ASSERT_EQUAL_STRING_LEN("hunter22", line + pl.passwordStart, pl.passwordLen);
+    TEST_ASSERT_EQUAL(8, pl.passwordLen);
+}
+
+void test_parsePotLine_passwordWithColonsAndLeadingSpace(void) {
+    const char* line = "  64eeb7208286:AABBCCDDEEFF:Cafe:pa:ss:wd  ";
+    PotLine pl;
+    TEST_ASSERT_TRUE(parsePotLine(line, strlen(line), pl));
+    TEST_ASSERT_EQUAL_STRING_LEN("Cafe", line + pl.ssidStart, pl.ssidLen);
+    TEST_ASSERT_EQUAL(4, pl.ssidLen);
+    TEST_ASSERT_EQUAL_STRING_LEN("pa:ss:wd", line + pl.passwordStart, pl.passwordLen);
+    TEST_ASSERT_EQUAL(8, pl.passwordLen);
+
+    // Empty SSID is still a line
+    const char* hidden = "64EEB7208286:AABBCCDDEEFF::secret";
+    TEST_ASSERT_TRUE(parsePotLine(hidden, strlen(hidden), pl));
+    TEST_ASSERT_EQUAL(0, pl.ssidLen);
+}
+
+void test_parsePotLine_rejectsMalformed(void) {
+    PotLine pl;
+    const char* bad[] = {
+        "",
+        "64EEB7208286:SSID:password",             // hashcat 3-field format
+        "64EEB7208286:AABBCCDDEEFF:nossidcolon",  // no third colon
+        "64EEB72082:AABBCCDDEEFFGG:SSID:pw",      // colons in the wrong place
+        "64EEB720828Z:AABBCCDDEEFF:SSID:pw",      // not hex
+    };
+    for (const char* line : bad) {
+        TEST_ASSERT_FALSE_MESSAGE(parsePotLine(line, strlen(line), pl), line);
+    }
+}
+
+// ============================================================================
+// External sort
+// ============================================================================
+
+void test_merge_interleavesSortedRuns(void) {
+    std::vector<Entry> v = {makeEntry(1, 0), makeEntry(4, 10), makeEntry(7, 20),
+                            makeEntry(2, 30), makeEntry(3, 40), makeEntry(9, 50)};
+    VecSource a(v, 0, 3);
+    VecSource b(v, 3, 6);
+    VecSink sink;
+    TEST_ASSERT_EQUAL(6, mergeRuns(a, b, sink, false));
+    const uint32_t order[6] = {1, 2, 3, 4, 7, 9};
+    for (int i = 0; i < 6; i++) TEST_ASSERT_EQUAL_UINT8(order[i], sink.out[i].key[5]);
+}
+
+void test_merge_dedupeKeepsLastPotfileLine(void) {
+    // Same BSSID cracked twice (re-uploaded capture): the later line wins,
+    // which is what overwriting the old map entry did
+    std::vector<Entry> v = {makeEntry(5, 0), makeEntry(5, 300), makeEntry(8, 100),
+                            makeEntry(5, 200), makeEntry(6, 400)};
+    VecSource a(v, 0, 3);
+    VecSource b(v, 3, 5);
+    VecSink sink;
+    TEST_ASSERT_EQUAL(3, mergeRuns(a, b, sink, true));
+    TEST_ASSERT_EQUAL_UINT8(5, sink.out[0].key[5]);
+    TEST_ASSERT_EQUAL_UINT32(300, sink.out[0].offset);
+    TEST_ASSERT_EQUAL_UINT8(6, sink.out[1].key[5]);
+    TEST_ASSERT_EQUAL_UINT8(8, sink.out[2].key[5]);
+}
+
+void test_merge_sinkFailureReported(void) {
+    std::vector<Entry> v = {makeEntry(1, 0), makeEntry(2, 10), makeEntry(3, 20)};
+    VecSource a(v, 0, 2);
+    VecSource b(v, 2, 3);
+    VecSink sink;
+    sink.failAfter = 1;
+    TEST_ASSERT_EQUAL(-1, mergeRuns(a, b, sink, false));
+}
+
+void test_externalSort_manyRunsWithDuplicates(void) {
+    // 5000 lines in potfile order, ~20 runs of 256, every 7th BSSID repeated
+    std::vector<Entry> input;
+    uint32_t offset = 0;
+    for (uint32_t i = 0; i < 5000; i++) {
+        uint32_t id = (i * 2654435761u) % 4000;
+        input.push_back(makeEntry(id, offset));
+        offset += 60;
+    }
+    long written = 0;
+    std::vector<Entry> sorted = externalSort(input, 256, &written);
+
+    std::vector<Entry> expect = input;
+    std::stable_sort(expect.begin(), expect.end(), entryLess);
+    std::vector<Entry> unique;
+    for (size_t i = 0; i < expect.size(); i++) {
+        if (i + 1 == expect.size() || memcmp(expect[i].key, expect[i + 1].key, 6) != 0) {
+            unique.push_back(expect[i]);
+        }
+    }
+    TEST_ASSERT_EQUAL((long)unique.size(), written);
+    TEST_ASSERT_EQUAL(unique.size(), sorted.size());
+    for (size_t i = 0; i < unique.size(); i++) {
+        TEST_ASSERT_EQUAL_MEMORY(unique[i].key, sorted[i].key, 6);
+        TEST_ASSERT_EQUAL_UINT32(unique[i].offset, sorted[i].offset);
+    }
+}
+
+void test_externalSort_smallAndEmpty(void) {
+    long written = -2;
+    std::vector<Entry> none;
+    TEST_ASSERT_EQUAL(0, externalSort(none, 256, &written).size());
+    TEST_ASSERT_EQUAL(0, written);
+
+    std::vector<Entry> three = {makeEntry(3, 0), makeEntry(1, 10), makeEntry(2, 20)};
+    std::vector<Entry> sorted = externalSort(three, 256, &written);
+    TEST_ASSERT_EQUAL(3, written);
+    TEST_ASSERT_EQUAL_UINT8(1, sorted[0].key[5]);
+    TEST_ASSERT_EQUAL_UINT8(3, sorted[2].key[5]);
+}
+
+// ============================================================================
+// Lookup
+// ============================================================================
+
+void test_find_everyKeyAndMisses(void) {
+    std::vector<Entry> sorted;
+    for (uint32_t i = 0; i < 3000; i++) sorted.push_back(makeEntry(i * 2, i * 80));
+    IndexImage image(sorted);
+    PageCache<4> cache;
+    cache.reset();
+
+    Entry out;
+    for (uint32_t i = 0; i < 3000; i++) {
+        TEST_ASSERT_TRUE(find(cache, image, image.count, sorted[i].key, out));
+        TEST_ASSERT_EQUAL_UINT32(i * 80, out.offset);
+        Entry miss = makeEntry(i * 2 + 1, 0);
+        TEST_ASSERT_FALSE(find(cache, image, image.count, miss.key, out));
+    }
+    Entry below = makeEntry(0, 0);
+    below.key[0] = 0x00;
+    TEST_ASSERT_FALSE(find(cache, image, image.count, below.key, out));
+
+    IndexImage empty(std::vector<Entry>{});
+    TEST_ASSERT_FALSE(find(cache, empty, 0, sorted[0].key, out));
+}
+
+void test_pageCache_topOfTreeStaysCached(void) {
+    // 10000 entries = 313 pages, ~9 page reads for a cold lookup
+    std::vector<Entry> sorted;
+    for (uint32_t i = 0; i < 10000; i++) sorted.push_back(makeEntry(i, i));
+    IndexImage image(sorted);
+    PageCache<4> cache;
+    cache.reset();
+
+    Entry out;
+    TEST_ASSERT_TRUE(find(cache, image, image.count, sorted[1234].key, out));
+    size_t coldReads = image.reads;
+    TEST_ASSERT_TRUE(coldReads <= 9);
+
+    // Scattered lookups (a LOOT re-index): the top of the tree never reloads
+    uint32_t before = image.reads;
+    for (uint32_t i = 0; i < 500; i++) {
+        uint32_t id = (i * 2654435761u) % 10000;
+        TEST_ASSERT_TRUE(find(cache, image, image.count, sorted[id].key, out));
+        TEST_ASSERT_EQUAL_UINT32(id, out.offset);
+    }
+    TEST_ASSERT_TRUE((image.reads - before) <= 500 * (coldReads - 2));
+    TEST_ASSERT_TRUE(cache.hits >= 500);
+}
+
+void test_pageCache_evictsDeepestThenOldest(void) {
+    std::vector<Entry> sorted;
+    for (uint32_t i = 0; i < kPageEntries * 8; i++) sorted.push_back(makeEntry(i, i));
+    IndexImage image(sorted);
+    PageCache<2> cache;
+    cache.reset();
+
+    uint16_t n = 0;
+    TEST_ASSERT_NOT_NULL(cache.get(4, n, image, 0));   // root
+    TEST_ASSERT_NOT_NULL(cache.get(2, n, image, 1));
+    TEST_ASSERT_NOT_NULL(cache.get(1, n, image, 2));   // evicts 2, keeps root
+    TEST_ASSERT_EQUAL(3, image.reads);
+    TEST_ASSERT_NOT_NULL(cache.get(4, n, image, 0));
+    TEST_ASSERT_EQUAL(3, image.reads);
+    TEST_ASSERT_NOT_NULL(cache.get(6, n, image, 1));   // evicts 1 (deeper)
+    TEST_ASSERT_NOT_NULL(cache.get(5, n, image, 2));   // evicts 6
+    TEST_ASSERT_NOT_NULL(cache.get(4, n, image, 0));
+    TEST_ASSERT_EQUAL(5, image.reads);
+    TEST_ASSERT_EQUAL(kPageEntries, n);
+
+    // Past the end: nothing cached
+    TEST_ASSERT_NULL(cache.get(100, n, image, 1));
+    TEST_ASSERT_NOT_NULL(cache.get(4, n, image, 0));
+    TEST_ASSERT_EQUAL(6, image.reads);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_header_roundTripAndVersionChecked);
+    RUN_TEST(test_entry_roundTripAndOrder);
+
+    RUN_TEST(test_parseKey_formats);
+    RUN_TEST(test_parsePotLine_fields);
+    RUN_TEST(test_parsePotLine_passwordWithColonsAndLeadingSpace);
+    RUN_TEST(test_parsePotLine_rejectsMalformed);
+
+    RUN_TEST(test_merge_interleavesSortedRuns);
+    RUN_TEST(test_merge_dedupeKeepsLastPotfileLine);
+    RUN_TEST(test_merge_sinkFailureReported);
+    RUN_TEST(test_externalSort_manyRunsWithDuplicates);
+    RUN_TEST(test_externalSort_smallAndEmpty);
+
+    RUN_TEST(test_find_everyKeyAndMisses);
+    RUN_TEST(test_pageCache_topOfTreeStaysCached);
+    RUN_TEST(test_pageCache_evictsDeepestThenOldest);
+
+    return UNITY_END();
+}
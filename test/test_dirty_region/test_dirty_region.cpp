@@ -0,0 +1,215 @@
+// Dirty Region Tests
+// Tests src/core/dirty_region.h (changed-rectangle tracking for sprites)
+
+#include <unity.h>
+#include <cstring>
+#include <vector>
+#include "../../src/core/dirty_region.h"
+
+using namespace DirtyRegion;
+
+void setUp(void) {}
+void tearDown(void) {}
+
+// Main canvas layout: 240 x 107, 60-pixel tiles
+static const int kW = 240;
+static const int kH = 107;
+static const int kTile = 60;
+typedef Tracker<kW, kH, kTile> MainTracker;
+
+struct Collect {
+    std::vector<Rect> rects;
+    void operator()(const Rect& r) { rects.push_back(r); }
+};
+
+static uint8_t frame[kH][kW];
+
+static void fill(uint8_t v) { memset(frame, v, sizeof(frame)); }
+
+// Pixels covered by the rects, for "every change was pushed" checks
+static bool covered(const std::vector<Rect>& rects, int x, int y) {
+    for (const Rect& r : rects) {
+        if (x >= r.x && x < r.x + r.w && y >= r.y && y < r.y + r.h) return true;
+    }
+    return false;
+}
+
+void test_firstScanIsFullFrame(void) {
+    static MainTracker t;
+    fill(0x00);
+    Collect c;
+    TEST_ASSERT_EQUAL(1, t.scan(&frame[0][0], c));
+    TEST_ASSERT_EQUAL(0, c.rects[0].x);
+    TEST_ASSERT_EQUAL(0, c.rects[0].y);
+    TEST_ASSERT_EQUAL(kW, c.rects[0].w);
+    TEST_ASSERT_EQUAL(kH, c.rects[0].h);
+}
+
+void test_unchangedFramePushesNothing(void) {
+    static MainTracker t;
+    fill(0x1C);
+    Collect c;
+    t.scan(&frame[0][0], c);
+    c.rects.clear();
+    // Redrawn with identical content (what every screen does each frame)
+    fill(0x1C);
+    TEST_ASSERT_EQUAL(0, t.scan(&frame[0][0], c));
+    TEST_ASSERT_EQUAL(0, (int)c.rects.size());
+}
+
+void test_singlePixelIsOneTile(void) {
+    static MainTracker t;
+    fill(0);
+    Collect c;
+    t.scan(&frame[0][0], c);
+    c.rects.clear();
+    frame[50][130] = 0xFF;
+    TEST_ASSERT_EQUAL(1, t.scan(&frame[0][0], c));
+    TEST_ASSERT_EQUAL(120, c.rects[0].x);
+    TEST_ASSERT_EQUAL(50, c.rects[0].y);
+    TEST_ASSERT_EQUAL(kTile, c.rects[0].w);
+    TEST_ASSERT_EQUAL(1, c.rects[0].h);
+
+    // Changing it back is a change too
+    c.rects.clear();
+    frame[50][130] = 0;
+    TEST_ASSERT_EQUAL(1, t.scan(&frame[0][0], c));
+}
+
+void test_bandSpansChangedTiles(void) {
+    static MainTracker t;
+    fill(0);
+    Collect c;
+    t.scan(&frame[0][0], c);
+    c.rects.clear();
+    frame[10][5] = 1;       // Tile 0
+    frame[12][200] = 1;     // Tile 3, two rows down: same band
+    TEST_ASSERT_EQUAL(1, t.scan(&frame[0][0], c));
+    TEST_ASSERT_EQUAL(0, c.rects[0].x);
+    TEST_ASSERT_EQUAL(kW, c.rects[0].w);
+    TEST_ASSERT_EQUAL(10, c.rects[0].y);
+    TEST_ASSERT_EQUAL(3, c.rects[0].h);
+}
+
+void test_distantChangesAreSeparateRects(void) {
+    static MainTracker t;
+    fill(0);
+    Collect c;
+    t.scan(&frame[0][0], c);
+    c.rects.clear();
+    frame[0][0] = 7;            // Top bar-ish edge
+    frame[kH - 1][kW - 1] = 7;  // Bottom-right corner
+    TEST_ASSERT_EQUAL(2, t.scan(&frame[0][0], c));
+    TEST_ASSERT_EQUAL(0, c.rects[0].y);
+    TEST_ASSERT_EQUAL(1, c.rects[0].h);
+    TEST_ASSERT_EQUAL(kH - 1, c.rects[1].y);
+    TEST_ASSERT_EQUAL(180, c.rects[1].x);
+    TEST_ASSERT_TRUE(covered(c.rects, 0, 0));
+    TEST_ASSERT_TRUE(covered(c.rects, kW - 1, kH - 1));
+}
+
+void test_mergeGapBoundary(void) {
+    static MainTracker t;
+    fill(0);
+    Collect c;
+    t.scan(&frame[0][0], c);
+
+    // kMergeGap clean rows between changes: one rect
+    c.rects.clear();
+    frame[20][0] = 1;
+    frame[20 + kMergeGap + 1][0] = 1;
+    TEST_ASSERT_EQUAL(1, t.scan(&frame[0][0], c));
+    TEST_ASSERT_EQUAL(kMergeGap + 2, c.rects[0].h);
+
+    // One more clean row: two rects
+    c.rects.clear();
+    frame[40][0] = 1;
+    frame[40 + kMergeGap + 2][0] = 1;
+    TEST_ASSERT_EQUAL(2, t.scan(&frame[0][0], c));
+}
+
+void test_invalidateForcesFullPush(void) {
+    static MainTracker t;
+    fill(3);
+    Collect c;
+    t.scan(&frame[0][0], c);
+    c.rects.clear();
+    // Something drew on the panel behind the tracker's back
+    t.invalidate();
+    TEST_ASSERT_EQUAL(1, t.scan(&frame[0][0], c));
+    TEST_ASSERT_EQUAL(kH, c.rects[0].h);
+    TEST_ASSERT_EQUAL(kW, c.rects[0].w);
+}
+
+void test_hashSeesReorderedBytes(void) {
+    uint8_t a[kTile];
+    uint8_t b[kTile];
+    for (int i = 0; i < kTile; i++) a[i] = b[i] = (uint8_t)i;
+    b[3] = a[4];
+    b[4] = a[3];
+    TEST_ASSERT_TRUE(hashSpan(a, kTile) != hashSpan(b, kTile));
+    // Word swap (same word multiset)
+    for (int i = 0; i < 4; i++) {
+        b[i] = a[4 + i];
+        b[4 + i] = a[i];
+    }
+    TEST_ASSERT_TRUE(hashSpan(a, kTile) != hashSpan(b, kTile));
+}
+
+void test_everyChangeCovered(void) {
+    static MainTracker t;
+    fill(0);
+    Collect c;
+    t.scan(&frame[0][0], c);
+    uint32_t seed = 0x1234567;
+    for (int round = 0; round < 50; round++) {
+        static uint8_t before[kH][kW];
+        memcpy(before, frame, sizeof(frame));
+        int changes = 1 + round % 9;
+        for (int i = 0; i < changes; i++) {
+            seed = seed * 1103515245u + 12345u;
+            int y = (int)((seed >> 8) % kH);
+            int x = (int)((seed >> 20) % kW);
+            frame[y][x] ^= 0x5A;
+        }
+        c.rects.clear();
+        t.scan(&frame[0][0], c);
+        for (int y = 0; y < kH; y++) {
+            for (int x = 0; x < kW; x++) {
+                if (frame[y][x] != before[y][x]) TEST_ASSERT_TRUE(covered(c.rects, x, y));
+            }
+        }
+    }
+}
+
+void test_barSizedTracker(void) {
+    // Top/bottom bars: 240 x 14
+    static Tracker<kW, 14, kTile> bar;
+    static uint8_t px[14][kW];
+    memset(px, 0, sizeof(px));
+    Collect c;
+    TEST_ASSERT_EQUAL(1, bar.scan(&px[0][0], c));
+    TEST_ASSERT_EQUAL(14, c.rects[0].h);
+    c.rects.clear();
+    px[13][239] = 1;
+    TEST_ASSERT_EQUAL(1, bar.scan(&px[0][0], c));
+    TEST_ASSERT_EQUAL(13, c.rects[0].y);
+    TEST_ASSERT_EQUAL(180, c.rects[0].x);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_firstScanIsFullFrame);
+    RUN_TEST(test_unchangedFramePushesNothing);
+    RUN_TEST(test_singlePixelIsOneTile);
+    RUN_TEST(test_bandSpansChangedTiles);
+    RUN_TEST(test_distantChangesAreSeparateRects);
+    RUN_TEST(test_mergeGapBoundary);
+    RUN_TEST(test_invalidateForcesFullPush);
+    RUN_TEST(test_hashSeesReorderedBytes);
+    RUN_TEST(test_everyChangeCovered);
+    RUN_TEST(test_barSizedTracker);
+
+    return UNITY_END();
+}
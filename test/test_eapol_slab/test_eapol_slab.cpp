@@ -0,0 +1,417 @@
+// EAPOL Slab Tests + Layout Comparison
+// Tests src/core/eapol_slab.h (packed M1-M4 storage for CapturedHandshake)
+// Layout tests compare against the old four fixed EAPOLFrame cells
+
+#include <unity.h>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <vector>
+#include "../../src/core/eapol_parser.h"
+#include "../../src/core/eapol_slab.h"
+
+void setUp(void) {}
+void tearDown(void) {}
+
+// ============================================================================
+// Layouts
+// ============================================================================
+
+// Old per-frame cell, copied from oink.h before the slab
+struct LegacyEAPOLFrame {
+    uint8_t data[512];
+    uint8_t fullFrame[300];
+    uint16_t len;
+    uint16_t fullFrameLen;
+    uint8_t messageNum;
+    uint32_t timestamp;
+    int8_t rssi;
+};
+
+// Field order matches CapturedHandshake (oink.h); only frames differ
+template <typename Frames>
+struct HandshakeLayout {
+    uint8_t bssid[6];
+    uint8_t station[6];
+    char ssid[33];
+    Frames frames;
+    uint8_t capturedMask;
+    uint32_t firstSeen;
+    uint32_t lastSeen;
+    bool saved;
+    uint8_t saveAttempts;
+    uint8_t* beaconData;
+    uint16_t beaconLen;
+};
+
+struct LegacyFrames { LegacyEAPOLFrame f[4]; };
+using LegacyHandshake = HandshakeLayout<LegacyFrames>;
+using CompactHandshake = HandshakeLayout<HandshakeFrames>;
+
+// OINK/DNH caps before and after
+static const size_t OLD_OINK_MAX = 50, NEW_OINK_MAX = 200;
+static const size_t OLD_DNH_MAX = 25, NEW_DNH_MAX = 100;
+
+// ============================================================================
+// Helpers
+// ============================================================================
+
+struct Frame {
+    std::vector<uint8_t> bytes;   // Full 802.11 frame
+    uint16_t eapolAt;
+    uint16_t eapolLen;
+    const uint8_t* eapol() const { return bytes.data() + eapolAt; }
+};
+
+// QoS data frame + LLC/SNAP + EAPOL-Key with keyDataLen bytes of key data
+static Frame makeFrame(uint8_t msg, uint16_t keyDataLen, uint8_t seed) {
+    static const uint16_t keyInfo[5] = {0, 0x008A, 0x010A, 0x13CA, 0x030A};
+    Frame f;
+    f.bytes.assign(26 + 8 + EapolParser::kKeyDataOffset + keyDataLen, 0);
+    uint8_t* p = f.bytes.data();
+    p[0] = 0x88;                                  // QoS data
+    p[1] = (msg == 1 || msg == 3) ? 0x02 : 0x01;  // FromDS / ToDS
+    for (int i = 4; i < 22; i++) p[i] = (uint8_t)(seed + i);
+    static const uint8_t llc[8] = {0xAA, 0xAA, 0x03, 0x00, 0x00, 0x00, 0x88, 0x8E};
+    memcpy(p + 26, llc, 8);
+    uint8_t* e = p + 34;
+    uint16_t bodyLen = (uint16_t)(EapolParser::kKeyDataOffset - 4 + keyDataLen);
+    e[0] = 0x02;
+    e[1] = EapolParser::kTypeKey;
+    e[2] = (uint8_t)(bodyLen >> 8);
+    e[3] = (uint8_t)bodyLen;
+    e[4] = EapolParser::kDescriptorRSN;
+    e[5] = (uint8_t)(keyInfo[msg] >> 8);
+    e[6] = (uint8_t)keyInfo[msg];
+    for (int i = 17; i < 49; i++) e[i] = (uint8_t)(seed * 7 + i);     // Nonce
+    if (msg != 1) for (int i = 81; i < 97; i++) e[i] = (uint8_t)(seed ^ i);  // MIC
+    e[97] = (uint8_t)(keyDataLen >> 8);
+    e[98] = (uint8_t)keyDataLen;
+    for (uint16_t i = 0; i < keyDataLen; i++) e[99 + i] = (uint8_t)(seed + i * 3);
+    const uint8_t* eapol = nullptr;
+    TEST_ASSERT_TRUE(EapolParser::locate(p, (uint16_t)f.bytes.size(), eapol, f.eapolLen));
+    TEST_ASSERT_EQUAL_UINT8(msg, EapolParser::keyMessage(eapol, f.eapolLen));
+    f.eapolAt = (uint16_t)(eapol - p);
+    return f;
+}
+
+// Typical WPA2 handshake: M1 with PMKID KDE, M2 with RSN IE, M3 with
+// wrapped RSN IE + GTK, M4 empty
+static Frame typical(uint8_t msg) {
+    static const uint16_t keyData[5] = {0, 22, 22, 56, 0};
+    return makeFrame(msg, keyData[msg], (uint8_t)(msg * 17));
+}
+
+template <uint16_t N>
+static bool storeFrame(EapolSlab<N>& slab, uint8_t msg, const Frame& f, uint32_t ts = 1000) {
+    return slab.store(msg - 1, f.eapol(), f.eapolLen, f.bytes.data(), (uint16_t)f.bytes.size(),
+                      ts, -40);
+}
+
+template <uint16_t N>
+static void assertFrameEquals(const EapolSlab<N>& slab, uint8_t msg, const Frame& f) {
+    EapolFrameView v = slab[msg - 1];
+    TEST_ASSERT_EQUAL_UINT16(f.eapolLen, v.len);
+    TEST_ASSERT_EQUAL_MEMORY(f.eapol(), v.data, f.eapolLen);
+    TEST_ASSERT_EQUAL_UINT16(f.bytes.size(), v.fullFrameLen);
+    TEST_ASSERT_EQUAL_MEMORY(f.bytes.data(), v.fullFrame, f.bytes.size());
+    TEST_ASSERT_EQUAL_UINT8(msg, v.messageNum);
+}
+
+// ============================================================================
+// Layout Tests
+// ============================================================================
+
+void test_layout_compactAtLeast4xSmaller(void) {
+    printf("  legacy handshake: %u bytes, compact: %u bytes (%.1fx)\n",
+           (unsigned)sizeof(LegacyHandshake), (unsigned)sizeof(CompactHandshake),
+           (double)sizeof(LegacyHandshake) / sizeof(CompactHandshake));
+    TEST_ASSERT_TRUE(sizeof(CompactHandshake) * 4 <= sizeof(LegacyHandshake));
+}
+
+void test_layout_raisedCapsFitOldBudget(void) {
+    TEST_ASSERT_TRUE(NEW_OINK_MAX * sizeof(CompactHandshake) <= OLD_OINK_MAX * sizeof(LegacyHandshake));
+    TEST_ASSERT_TRUE(NEW_DNH_MAX * sizeof(CompactHandshake) <= OLD_DNH_MAX * sizeof(LegacyHandshake));
+    TEST_ASSERT_EQUAL_UINT(4, NEW_OINK_MAX / OLD_OINK_MAX);
+    TEST_ASSERT_EQUAL_UINT(4, NEW_DNH_MAX / OLD_DNH_MAX);
+}
+
+void test_layout_singleFrameSlotSmallerThanLegacyCell(void) {
+    printf("  legacy frame cell: %u bytes, EapolFrameSlot: %u bytes\n",
+           (unsigned)sizeof(LegacyEAPOLFrame), (unsigned)sizeof(EapolFrameSlot));
+    TEST_ASSERT_TRUE(sizeof(EapolFrameSlot) < sizeof(LegacyEAPOLFrame));
+}
+
+void test_layout_typicalHandshakeFitsWithFullFrames(void) {
+    HandshakeFrames slab = {};
+    size_t total = 0;
+    for (uint8_t m = 1; m <= 4; m++) {
+        Frame f = typical(m);
+        total += f.bytes.size();
+        TEST_ASSERT_TRUE(storeFrame(slab, m, f));
+    }
+    printf("  typical M1-M4: %u bytes of %u\n", (unsigned)slab.used(), (unsigned)slab.capacity());
+    TEST_ASSERT_EQUAL_UINT8(0x0F, slab.mask());
+    TEST_ASSERT_EQUAL_UINT(total, slab.used());  // EAPOL never stored twice
+    for (uint8_t m = 1; m <= 4; m++) assertFrameEquals(slab, m, typical(m));
+}
+
+// ============================================================================
+// Store / View Tests
+// ============================================================================
+
+void test_empty_zeroInitialized(void) {
+    HandshakeFrames slab = {};
+    TEST_ASSERT_EQUAL_UINT8(0, slab.mask());
+    TEST_ASSERT_EQUAL_UINT16(0, slab.used());
+    for (uint8_t i = 0; i < 4; i++) {
+        TEST_ASSERT_FALSE(slab.has(i));
+        TEST_ASSERT_EQUAL_UINT16(0, slab[i].len);
+        TEST_ASSERT_NULL(slab[i].data);
+    }
+    TEST_ASSERT_FALSE(slab.has(4));
+}
+
+void test_store_sharesEapolWithFullFrame(void) {
+    HandshakeFrames slab = {};
+    Frame m2 = typical(2);
+    TEST_ASSERT_TRUE(storeFrame(slab, 2, m2, 1234));
+    EapolFrameView v = slab[1];
+    TEST_ASSERT_EQUAL_UINT(m2.bytes.size(), slab.used());
+    TEST_ASSERT_TRUE(v.data == v.fullFrame + m2.eapolAt);
+    TEST_ASSERT_EQUAL_UINT32(1234, v.timestamp);
+    TEST_ASSERT_EQUAL_INT8(-40, v.rssi);
+    TEST_ASSERT_EQUAL_UINT8(0x02, slab.mask());
+}
+
+void test_store_eapolOnly(void) {
+    HandshakeFrames slab = {};
+    Frame m1 = typical(1);
+    TEST_ASSERT_TRUE(slab.store(0, m1.eapol(), m1.eapolLen, nullptr, 0, 5, -60));
+    EapolFrameView v = slab[0];
+    TEST_ASSERT_EQUAL_UINT16(m1.eapolLen, v.len);
+    TEST_ASSERT_EQUAL_MEMORY(m1.eapol(), v.data, m1.eapolLen);
+    TEST_ASSERT_NULL(v.fullFrame);
+    TEST_ASSERT_EQUAL_UINT16(0, v.fullFrameLen);
+}
+
+void test_store_truncatedFullFrameKeepsBothCopies(void) {
+    // 320-byte frame: full copy truncated to 300, EAPOL kept whole
+    HandshakeFrames slab = {};
+    Frame m3 = makeFrame(3, 320 - 34 - EapolParser::kKeyDataOffset, 9);
+    TEST_ASSERT_TRUE(storeFrame(slab, 3, m3));
+    EapolFrameView v = slab[2];
+    TEST_ASSERT_EQUAL_UINT16(300, v.fullFrameLen);
+    TEST_ASSERT_EQUAL_MEMORY(m3.bytes.data(), v.fullFrame, 300);
+    TEST_ASSERT_EQUAL_UINT16(m3.eapolLen, v.len);
+    TEST_ASSERT_EQUAL_MEMORY(m3.eapol(), v.data, m3.eapolLen);
+    TEST_ASSERT_EQUAL_UINT(300 + m3.eapolLen, slab.used());
+}
+
+void test_store_clampsEapolTo512(void) {
+    uint8_t big[600];
+    for (int i = 0; i < 600; i++) big[i] = (uint8_t)i;
+    EapolFrameSlot slot = {};
+    TEST_ASSERT_TRUE(slot.store(0, big, sizeof(big), nullptr, 0, 0, 0));
+    TEST_ASSERT_EQUAL_UINT16(512, slot[0].len);
+    TEST_ASSERT_EQUAL_MEMORY(big, slot[0].data, 512);
+}
+
+void test_store_rejectsBadArgs(void) {
+    HandshakeFrames slab = {};
+    Frame m1 = typical(1);
+    TEST_ASSERT_FALSE(slab.store(4, m1.eapol(), m1.eapolLen, nullptr, 0, 0, 0));
+    TEST_ASSERT_FALSE(slab.store(0, nullptr, 10, nullptr, 0, 0, 0));
+    TEST_ASSERT_FALSE(slab.store(0, m1.eapol(), 0, nullptr, 0, 0, 0));
+    TEST_ASSERT_EQUAL_UINT16(0, slab.used());
+}
+
+// ============================================================================
+// Replace / Erase / Eviction Tests
+// ============================================================================
+
+void test_replace_compactsAndKeepsOthers(void) {
+    HandshakeFrames slab = {};
+    for (uint8_t m = 1; m <= 4; m++) storeFrame(slab, m, typical(m));
+    uint16_t before = slab.used();
+
+    // Retransmitted M1 with a new ANonce and no PMKID
+    Frame m1b = makeFrame(1, 0, 99);
+    TEST_ASSERT_TRUE(storeFrame(slab, 1, m1b));
+    TEST_ASSERT_EQUAL_UINT(before - typical(1).bytes.size() + m1b.bytes.size(), slab.used());
+    assertFrameEquals(slab, 1, m1b);
+    for (uint8_t m = 2; m <= 4; m++) assertFrameEquals(slab, m, typical(m));
+}
+
+void test_erase_middleFrame(void) {
+    HandshakeFrames slab = {};
+    for (uint8_t m = 1; m <= 3; m++) storeFrame(slab, m, typical(m));
+    slab.erase(1);
+    TEST_ASSERT_EQUAL_UINT8(0x05, slab.mask());
+    TEST_ASSERT_EQUAL_UINT(typical(1).bytes.size() + typical(3).bytes.size(), slab.used());
+    assertFrameEquals(slab, 1, typical(1));
+    assertFrameEquals(slab, 3, typical(3));
+    slab.erase(1);  // No-op
+    TEST_ASSERT_EQUAL_UINT8(0x05, slab.mask());
+}
+
+void test_overflow_evictsM4First(void) {
+    HandshakeFrames slab = {};
+    storeFrame(slab, 4, typical(4));
+    storeFrame(slab, 2, typical(2));
+    // Large M3 (GTK + IGTK + extra KDEs) that only fits once M4 is gone
+    Frame m3 = makeFrame(3, (uint16_t)(300 - 34 - EapolParser::kKeyDataOffset), 3);
+    storeFrame(slab, 1, typical(1));
+    TEST_ASSERT_TRUE(slab.available() < m3.bytes.size());
+    TEST_ASSERT_TRUE(storeFrame(slab, 3, m3));
+    TEST_ASSERT_EQUAL_UINT8(0x07, slab.mask());
+    assertFrameEquals(slab, 1, typical(1));
+    assertFrameEquals(slab, 2, typical(2));
+    assertFrameEquals(slab, 3, m3);
+}
+
+void test_overflow_dropsFullFrameBeforeFailing(void) {
+    EapolSlab<288> slab = {};
+    Frame m1 = typical(1);
+    Frame m2 = typical(2);
+    TEST_ASSERT_TRUE(storeFrame(slab, 1, m1));
+    TEST_ASSERT_TRUE(storeFrame(slab, 2, m2));  // No room for full frame
+    EapolFrameView v = slab[1];
+    TEST_ASSERT_EQUAL_UINT16(0, v.fullFrameLen);
+    TEST_ASSERT_EQUAL_UINT16(m2.eapolLen, v.len);
+    TEST_ASSERT_EQUAL_MEMORY(m2.eapol(), v.data, m2.eapolLen);
+    // Nothing left for M3 at all
+    TEST_ASSERT_FALSE(storeFrame(slab, 3, typical(3)));
+    TEST_ASSERT_EQUAL_UINT8(0x03, slab.mask());
+}
+
+void test_m4_neverEvictsItself(void) {
+    EapolSlab<288> slab = {};
+    storeFrame(slab, 1, typical(1));
+    Frame big = makeFrame(4, 200, 4);
+    TEST_ASSERT_FALSE(storeFrame(slab, 4, big));
+    TEST_ASSERT_EQUAL_UINT8(0x01, slab.mask());
+}
+
+void test_failedReplaceKeepsOldFrame(void) {
+    EapolSlab<288> slab = {};
+    Frame m1 = typical(1);
+    Frame m2 = typical(2);
+    TEST_ASSERT_TRUE(storeFrame(slab, 1, m1));
+    TEST_ASSERT_TRUE(storeFrame(slab, 2, m2));
+    uint16_t used = slab.used();
+    // Retransmitted M2 with key data too big for the arena even EAPOL-only
+    Frame huge = makeFrame(2, 200, 9);
+    TEST_ASSERT_FALSE(storeFrame(slab, 2, huge));
+    TEST_ASSERT_EQUAL_UINT8(0x03, slab.mask());
+    TEST_ASSERT_EQUAL_UINT16(used, slab.used());
+    EapolFrameView v = slab[1];
+    TEST_ASSERT_EQUAL_UINT16(m2.eapolLen, v.len);
+    TEST_ASSERT_EQUAL_MEMORY(m2.eapol(), v.data, m2.eapolLen);
+    assertFrameEquals(slab, 1, m1);
+}
+
+void test_failedReplaceKeepsM4(void) {
+    EapolSlab<288> slab = {};
+    TEST_ASSERT_TRUE(storeFrame(slab, 4, typical(4)));
+    TEST_ASSERT_TRUE(storeFrame(slab, 1, typical(1)));
+    // Doesn't fit even with M4 evicted: M4 must survive the failed store
+    TEST_ASSERT_FALSE(storeFrame(slab, 1, makeFrame(1, 250, 5)));
+    TEST_ASSERT_EQUAL_UINT8(0x09, slab.mask());
+    assertFrameEquals(slab, 4, typical(4));
+}
+
+// ============================================================================
+// Copy Tests
+// ============================================================================
+
+void test_copyFrom_singleSlotIntoHandshake(void) {
+    EapolFrameSlot slot = {};
+    Frame m2 = typical(2);
+    storeFrame(slot, 2, m2, 777);
+    HandshakeFrames slab = {};
+    TEST_ASSERT_TRUE(slab.copyFrom(slot, 1));
+    assertFrameEquals(slab, 2, m2);
+    TEST_ASSERT_EQUAL_UINT32(777, slab[1].timestamp);
+    TEST_ASSERT_FALSE(slab.copyFrom(slot, 0));  // Not in source
+}
+
+void test_copy_trivialAssignmentKeepsViewsValid(void) {
+    HandshakeFrames a = {};
+    for (uint8_t m = 1; m <= 4; m++) storeFrame(a, m, typical(m));
+    HandshakeFrames b = a;  // vector<CapturedHandshake> copies like this
+    a.clear();
+    TEST_ASSERT_EQUAL_UINT8(0, a.mask());
+    for (uint8_t m = 1; m <= 4; m++) assertFrameEquals(b, m, typical(m));
+}
+
+// ============================================================================
+// Randomized Model Check
+// ============================================================================
+
+void test_random_matchesReferenceModel(void) {
+    std::mt19937 rng(42);
+    HandshakeFrames slab = {};
+    Frame model[4];
+    bool present[4] = {false, false, false, false};
+
+    for (int iter = 0; iter < 5000; iter++) {
+        uint8_t msg = (uint8_t)(1 + rng() % 4);
+        if (rng() % 5 == 0) {
+            slab.erase(msg - 1);
+            present[msg - 1] = false;
+        } else {
+            Frame f = makeFrame(msg, (uint16_t)(rng() % 90), (uint8_t)rng());
+            // Failure keeps the old copy (nothing is touched)
+            if (storeFrame(slab, msg, f)) {
+                present[msg - 1] = true;
+                model[msg - 1] = f;
+            }
+            if (msg != 4 && !slab.has(3)) present[3] = false;  // M4 evicted
+        }
+        uint16_t sum = 0;
+        for (uint8_t i = 0; i < 4; i++) {
+            TEST_ASSERT_EQUAL(present[i], slab.has(i));
+            if (!present[i]) continue;
+            EapolFrameView v = slab[i];
+            TEST_ASSERT_EQUAL_UINT16(model[i].eapolLen, v.len);
+            TEST_ASSERT_EQUAL_MEMORY(model[i].eapol(), v.data, v.len);
+            if (v.fullFrameLen) TEST_ASSERT_EQUAL_MEMORY(model[i].bytes.data(), v.fullFrame, v.fullFrameLen);
+            bool shared = v.fullFrame && v.data > v.fullFrame &&
+                          v.data < v.fullFrame + v.fullFrameLen;
+            sum = (uint16_t)(sum + v.fullFrameLen + (shared ? 0 : v.len));
+        }
+        TEST_ASSERT_EQUAL_UINT16(sum, slab.used());
+    }
+}
+
+int main(void) {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_layout_compactAtLeast4xSmaller);
+    RUN_TEST(test_layout_raisedCapsFitOldBudget);
+    RUN_TEST(test_layout_singleFrameSlotSmallerThanLegacyCell);
+    RUN_TEST(test_layout_typicalHandshakeFitsWithFullFrames);
+
+    RUN_TEST(test_empty_zeroInitialized);
+    RUN_TEST(test_store_sharesEapolWithFullFrame);
+    RUN_TEST(test_store_eapolOnly);
+    RUN_TEST(test_store_truncatedFullFrameKeepsBothCopies);
+    RUN_TEST(test_store_clampsEapolTo512);
+    RUN_TEST(test_store_rejectsBadArgs);
+
+    RUN_TEST(test_replace_compactsAndKeepsOthers);
+    RUN_TEST(test_erase_middleFrame);
+    RUN_TEST(test_overflow_evictsM4First);
+    RUN_TEST(test_overflow_dropsFullFrameBeforeFailing);
+    RUN_TEST(test_m4_neverEvictsItself);
+    RUN_TEST(test_failedReplaceKeepsOldFrame);
+    RUN_TEST(test_failedReplaceKeepsM4);
+
+    RUN_TEST(test_copyFrom_singleSlotIntoHandshake);
+    RUN_TEST(test_copy_trivialAssignmentKeepsViewsValid);
+
+    RUN_TEST(test_random_matchesReferenceModel);
+
+    return UNITY_END();
+}
@@ -0,0 +1,237 @@
+// Heap Ledger Tests
+// Tests src/core/heap_ledger.h (per-tag heap attribution, fragmentation
+// series) through the native malloc shim in mocks/mock_heap_shim.h
+
+#include <unity.h>
+#include <cstring>
+#include <vector>
+#include "../mocks/mock_heap_shim.h"
+
+using namespace HeapLedger;
+using MockHeap::ledger;
+
+void setUp(void) {
+    MockHeap::reset();
+}
+
+void tearDown(void) {}
+
+void test_allocationAttributedToScope(void) {
+    void* ui;
+    void* tls;
+    {
+        MockHeap::Scope s(Tag::Ui);
+        ui = MockHeap::traceMalloc(100);
+        {
+            MockHeap::Scope inner(Tag::Tls);
+            tls = MockHeap::traceMalloc(4000);
+        }
+        // Back to the outer scope
+        void* ui2 = MockHeap::traceMalloc(20);
+        MockHeap::traceFree(ui2);
+    }
+    void* other = MockHeap::traceMalloc(7);
+
+    TEST_ASSERT_EQUAL_UINT32(100, ledger.stats(Tag::Ui).liveBytes);
+    TEST_ASSERT_EQUAL_UINT32(2, ledger.stats(Tag::Ui).allocs);
+    TEST_ASSERT_EQUAL_UINT32(1, ledger.stats(Tag::Ui).frees);
+    TEST_ASSERT_EQUAL_UINT32(4000, ledger.stats(Tag::Tls).liveBytes);
+    TEST_ASSERT_EQUAL_UINT32(7, ledger.stats(Tag::Other).liveBytes);
+    TEST_ASSERT_EQUAL_UINT32(4107, ledger.liveBytes());
+    TEST_ASSERT_EQUAL(3, ledger.blocks());
+
+    MockHeap::traceFree(ui);
+    MockHeap::traceFree(tls);
+    MockHeap::traceFree(other);
+    TEST_ASSERT_EQUAL_UINT32(0, ledger.liveBytes());
+    TEST_ASSERT_EQUAL(0, ledger.blocks());
+}
+
+void test_freeChargesAllocatingTag(void) {
+    void* p;
+    {
+        MockHeap::Scope s(Tag::Recon);
+        p = MockHeap::traceMalloc(64);
+    }
+    // Freed from somewhere else: still comes off RECON
+    {
+        MockHeap::Scope s(Tag::FileServer);
+        size_t size = 0;
+        Tag tag = Tag::Other;
+        TEST_ASSERT_TRUE(ledger.forget(p, &size, &tag));
+        free(p);
+        TEST_ASSERT_EQUAL(64, (int)size);
+        TEST_ASSERT_EQUAL((int)Tag::Recon, (int)tag);
+    }
+    TEST_ASSERT_EQUAL_UINT32(0, ledger.stats(Tag::Recon).liveBytes);
+    TEST_ASSERT_EQUAL_UINT32(0, ledger.stats(Tag::FileServer).allocs);
+}
+
+void test_peakTracksHighWater(void) {
+    MockHeap::Scope s(Tag::Oink);
+    void* a = MockHeap::traceMalloc(1000);
+    void* b = MockHeap::traceMalloc(500);
+    MockHeap::traceFree(a);
+    void* c = MockHeap::traceMalloc(200);
+    TEST_ASSERT_EQUAL_UINT32(700, ledger.stats(Tag::Oink).liveBytes);
+    TEST_ASSERT_EQUAL_UINT32(1500, ledger.stats(Tag::Oink).peakBytes);
+    TEST_ASSERT_EQUAL_UINT32(2, ledger.stats(Tag::Oink).liveBlocks);
+    MockHeap::traceFree(b);
+    MockHeap::traceFree(c);
+}
+
+void test_reallocMovesBytes(void) {
+    MockHeap::Scope s(Tag::Ble);
+    void* p = MockHeap::traceMalloc(16);
+    p = MockHeap::traceRealloc(p, 4096);
+    TEST_ASSERT_NOT_NULL(p);
+    TEST_ASSERT_EQUAL_UINT32(4096, ledger.stats(Tag::Ble).liveBytes);
+    TEST_ASSERT_EQUAL(1, ledger.blocks());
+    // realloc(NULL, n) is malloc
+    void* q = MockHeap::traceRealloc(nullptr, 32);
+    TEST_ASSERT_EQUAL_UINT32(4128, ledger.stats(Tag::Ble).liveBytes);
+    // calloc counts n * size
+    void* r = MockHeap::traceCalloc(10, 12);
+    TEST_ASSERT_EQUAL_UINT32(4248, ledger.stats(Tag::Ble).liveBytes);
+    MockHeap::traceFree(p);
+    MockHeap::traceFree(q);
+    MockHeap::traceFree(r);
+    TEST_ASSERT_EQUAL_UINT32(0, ledger.stats(Tag::Ble).liveBytes);
+    TEST_ASSERT_EQUAL_UINT32(0, ledger.strayFrees());
+}
+
+void test_strayFreeCounted(void) {
+    // Allocated before tracing started
+    void* p = malloc(10);
+    MockHeap::traceFree(p);
+    MockHeap::traceFree(nullptr);
+    TEST_ASSERT_EQUAL_UINT32(1, ledger.strayFrees());
+    TEST_ASSERT_EQUAL_UINT32(0, ledger.liveBytes());
+}
+
+void test_fullTableOverflows(void) {
+    // 16 slots: refuses past 7/8 (14 blocks)
+    MockHeap::reset(16);
+    std::vector<void*> blocks;
+    for (int i = 0; i < 20; i++) blocks.push_back(MockHeap::traceMalloc(8));
+    TEST_ASSERT_EQUAL(14, ledger.blocks());
+    TEST_ASSERT_EQUAL_UINT32(6, ledger.overflowed());
+    TEST_ASSERT_EQUAL_UINT32(20, ledger.stats(Tag::Other).allocs);
+    TEST_ASSERT_EQUAL_UINT32(14 * 8, ledger.liveBytes());
+    for (void* p : blocks) MockHeap::traceFree(p);
+    TEST_ASSERT_EQUAL(0, ledger.blocks());
+    TEST_ASSERT_EQUAL_UINT32(6, ledger.strayFrees());
+    TEST_ASSERT_EQUAL_UINT32(0, ledger.liveBytes());
+}
+
+void test_collidingKeysSurviveDeletes(void) {
+    // Synthetic addresses, all 4-byte aligned, dense enough to form long
+    // probe runs; delete every other one and check the rest are still found
+    static Slot s[256];
+    Ledger l;
+    l.attach(s, 256);
+    const uintptr_t base = 0x3FC90000;
+    for (uintptr_t i = 0; i < 200; i++) {
+        TEST_ASSERT_TRUE(l.record((void*)(base + i * 4), i + 1, Tag::Recon));
+    }
+    for (uintptr_t i = 0; i < 200; i += 2) {
+        TEST_ASSERT_TRUE(l.forget((void*)(base + i * 4)));
+    }
+    for (uintptr_t i = 1; i < 200; i += 2) {
+        size_t size = 0;
+        TEST_ASSERT_TRUE(l.forget((void*)(base + i * 4), &size));
+        TEST_ASSERT_EQUAL((int)(i + 1), (int)size);
+    }
+    TEST_ASSERT_EQUAL(0, l.blocks());
+    TEST_ASSERT_EQUAL_UINT32(0, l.strayFrees());
+    TEST_ASSERT_EQUAL_UINT32(0, l.stats(Tag::Recon).liveBytes);
+}
+
+void test_randomChurnBalances(void) {
+    // Model: every live block's bytes add up per tag after heavy churn
+    std::vector<void*> live;
+    std::vector<size_t> sizes;
+    std::vector<Tag> tagsOf;
+    uint32_t seed = 0xC0FFEE;
+    uint32_t expect[kTagCount] = {0};
+    for (int step = 0; step < 5000; step++) {
+        seed = seed * 1103515245u + 12345u;
+        bool alloc = live.size() < 50 || ((seed >> 16) % 3) != 0;
+        if (alloc && live.size() < 600) {
+            Tag t = (Tag)((seed >> 8) % kTagCount);
+            size_t n = 1 + (seed >> 20) % 300;
+            MockHeap::Scope s(t);
+            live.push_back(MockHeap::traceMalloc(n));
+            sizes.push_back(n);
+            tagsOf.push_back(t);
+            expect[(uint8_t)t] += n;
+        } else if (!live.empty()) {
+            size_t i = (seed >> 4) % live.size();
+            MockHeap::traceFree(live[i]);
+            expect[(uint8_t)tagsOf[i]] -= sizes[i];
+            live[i] = live.back();
+            sizes[i] = sizes.back();
+            tagsOf[i] = tagsOf.back();
+            live.pop_back();
+            sizes.pop_back();
+            tagsOf.pop_back();
+        }
+    }
+    for (uint8_t t = 0; t < kTagCount; t++) {
+        TEST_ASSERT_EQUAL_UINT32(expect[t], ledger.stats((Tag)t).liveBytes);
+    }
+    TEST_ASSERT_EQUAL((int)live.size(), ledger.blocks());
+    TEST_ASSERT_EQUAL_UINT32(0, ledger.strayFrees());
+    for (void* p : live) MockHeap::traceFree(p);
+    TEST_ASSERT_EQUAL(0, ledger.blocks());
+}
+
+void test_fragPermille(void) {
+    Sample whole = {0, 100000, 100000};
+    Sample half = {0, 100000, 50000};
+    Sample shattered = {0, 100000, 1000};
+    Sample empty = {0, 0, 0};
+    TEST_ASSERT_EQUAL(0, fragPermille(whole));
+    TEST_ASSERT_EQUAL(500, fragPermille(half));
+    TEST_ASSERT_EQUAL(990, fragPermille(shattered));
+    TEST_ASSERT_EQUAL(0, fragPermille(empty));
+}
+
+void test_seriesKeepsNewestOldestFirst(void) {
+    Series<4> s;
+    TEST_ASSERT_EQUAL(0, s.size());
+    for (uint32_t i = 1; i <= 6; i++) {
+        Sample x = {i * 5000, 1000 * i, 500 * i};
+        s.push(x);
+    }
+    TEST_ASSERT_EQUAL(4, s.size());
+    TEST_ASSERT_EQUAL_UINT32(15000, s.at(0).ms);
+    TEST_ASSERT_EQUAL_UINT32(30000, s.at(3).ms);
+    s.clear();
+    TEST_ASSERT_EQUAL(0, s.size());
+}
+
+void test_tagNames(void) {
+    TEST_ASSERT_EQUAL_STRING("OTHER", tagName(Tag::Other));
+    TEST_ASSERT_EQUAL_STRING("TLS", tagName(Tag::Tls));
+    TEST_ASSERT_EQUAL_STRING("UI", tagName(Tag::Ui));
+    TEST_ASSERT_EQUAL_STRING("?", tagName(Tag::Count));
+}
+
+int main(void) {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_allocationAttributedToScope);
+    RUN_TEST(test_freeChargesAllocatingTag);
+    RUN_TEST(test_peakTracksHighWater);
+    RUN_TEST(test_reallocMovesBytes);
+    RUN_TEST(test_strayFreeCounted);
+    RUN_TEST(test_fullTableOverflows);
+    RUN_TEST(test_collidingKeysSurviveDeletes);
+    RUN_TEST(test_randomChurnBalances);
+    RUN_TEST(test_fragPermille);
+    RUN_TEST(test_seriesKeepsNewestOldestFirst);
+    RUN_TEST(test_tagNames);
+
+    return UNITY_END();
+}
@@ -0,0 +1,192 @@
+// HTTP Range Tests
+// Tests src/web/http_range.h (resumable /download)
+
+#include <unity.h>
+#include <cstring>
+#include "../../src/web/http_range.h"
+
+using HttpRange::Result;
+
+void setUp(void) {}
+void tearDown(void) {}
+
+static Result parse(const char* h, uint32_t size, uint32_t& s, uint32_t& e) {
+    s = 0xDEAD;
+    e = 0xBEEF;
+    return HttpRange::parse(h, size, s, e);
+}
+
+// ============================================================================
+// Range parsing
+// ============================================================================
+
+void test_range_closed(void) {
+    uint32_t s, e;
+    TEST_ASSERT_TRUE(parse("bytes=0-499", 1000, s, e) == Result::Partial);
+    TEST_ASSERT_EQUAL_UINT32(0, s);
+    TEST_ASSERT_EQUAL_UINT32(499, e);
+}
+
+void test_range_openEndedResume(void) {
+    // What the web UI sends after a dropped transfer
+    uint32_t s, e;
+    TEST_ASSERT_TRUE(parse("bytes=409600-", 409700, s, e) == Result::Partial);
+    TEST_ASSERT_EQUAL_UINT32(409600, s);
+    TEST_ASSERT_EQUAL_UINT32(409699, e);
+}
+
+void test_range_endClampedToSize(void) {
+    uint32_t s, e;
+    TEST_ASSERT_TRUE(parse("bytes=10-5000", 100, s, e) == Result::Partial);
+    TEST_ASSERT_EQUAL_UINT32(10, s);
+    TEST_ASSERT_EQUAL_UINT32(99, e);
+}
+
+void test_range_singleByte(void) {
+    uint32_t s, e;
+    TEST_ASSERT_TRUE(parse("bytes=99-99", 100, s, e) == Result::Partial);
+    TEST_ASSERT_EQUAL_UINT32(99, s);
+    TEST_ASSERT_EQUAL_UINT32(99, e);
+}
+
+void test_range_suffix(void) {
+    uint32_t s, e;
+    TEST_ASSERT_TRUE(parse("bytes=-100", 1000, s, e) == Result::Partial);
+    TEST_ASSERT_EQUAL_UINT32(900, s);
+    TEST_ASSERT_EQUAL_UINT32(999, e);
+
+    // Suffix longer than the file: whole file
+    TEST_ASSERT_TRUE(parse("bytes=-5000", 1000, s, e) == Result::Partial);
+    TEST_ASSERT_EQUAL_UINT32(0, s);
+    TEST_ASSERT_EQUAL_UINT32(999, e);
+}
+
+void test_range_whitespaceTolerated(void) {
+    uint32_t s, e;
+    TEST_ASSERT_TRUE(parse(" bytes= 5-9 ", 100, s, e) == Result::Partial);
+    TEST_ASSERT_EQUAL_UINT32(5, s);
+    TEST_ASSERT_EQUAL_UINT32(9, e);
+}
+
+void test_range_unsatisfiable(void) {
+    uint32_t s, e;
+    TEST_ASSERT_TRUE(parse("bytes=1000-", 1000, s, e) == Result::Unsatisfiable);
+    TEST_ASSERT_TRUE(parse("bytes=2000-3000", 1000, s, e) == Result::Unsatisfiable);
+    TEST_ASSERT_TRUE(parse("bytes=-0", 1000, s, e) == Result::Unsatisfiable);
+    TEST_ASSERT_TRUE(parse("bytes=0-", 0, s, e) == Result::Unsatisfiable);
+}
+
+void test_range_ignoredWhenMalformed(void) {
+    uint32_t s, e;
+    TEST_ASSERT_TRUE(parse(nullptr, 100, s, e) == Result::None);
+    TEST_ASSERT_TRUE(parse("", 100, s, e) == Result::None);
+    TEST_ASSERT_TRUE(parse("items=0-5", 100, s, e) == Result::None);
+    TEST_ASSERT_TRUE(parse("bytes=", 100, s, e) == Result::None);
+    TEST_ASSERT_TRUE(parse("bytes=-", 100, s, e) == Result::None);
+    TEST_ASSERT_TRUE(parse("bytes=abc-", 100, s, e) == Result::None);
+    TEST_ASSERT_TRUE(parse("bytes=9-5", 100, s, e) == Result::None);
+    TEST_ASSERT_TRUE(parse("bytes=5", 100, s, e) == Result::None);
+    TEST_ASSERT_TRUE(parse("bytes=99999999999-", 100, s, e) == Result::None);
+    // Untouched outputs on None
+    TEST_ASSERT_EQUAL_UINT32(0xDEAD, s);
+    TEST_ASSERT_EQUAL_UINT32(0xBEEF, e);
+}
+
+void test_range_multiRangeIgnored(void) {
+    // Single range only; a full 200 is a valid answer
+    uint32_t s, e;
+    TEST_ASSERT_TRUE(parse("bytes=0-9,20-29", 100, s, e) == Result::None);
+}
+
+// ============================================================================
+// HTTP-date
+// ============================================================================
+
+void test_httpDate_epoch(void) {
+    char buf[HttpRange::kHttpDateLen + 1];
+    HttpRange::formatHttpDate(0, buf);
+    TEST_ASSERT_EQUAL_STRING("Thu, 01 Jan 1970 00:00:00 GMT", buf);
+}
+
+void test_httpDate_rfcExample(void) {
+    char buf[HttpRange::kHttpDateLen + 1];
+    HttpRange::formatHttpDate(784111777, buf);
+    TEST_ASSERT_EQUAL_STRING("Sun, 06 Nov 1994 08:49:37 GMT", buf);
+    TEST_ASSERT_EQUAL_UINT32(HttpRange::kHttpDateLen, strlen(buf));
+}
+
+void test_httpDate_leapDayAndFatEpoch(void) {
+    char buf[HttpRange::kHttpDateLen + 1];
+    HttpRange::formatHttpDate(951782400, buf);      // 2000-02-29
+    TEST_ASSERT_EQUAL_STRING("Tue, 29 Feb 2000 00:00:00 GMT", buf);
+    HttpRange::formatHttpDate(315532800, buf);      // FAT timestamps start here
+    TEST_ASSERT_EQUAL_STRING("Tue, 01 Jan 1980 00:00:00 GMT", buf);
+    HttpRange::formatHttpDate(1792195199, buf);
+    TEST_ASSERT_EQUAL_STRING("Fri, 16 Oct 2026 23:59:59 GMT", buf);
+}
+
+// ============================================================================
+// ETag / If-Range
+// ============================================================================
+
+void test_etag_format(void) {
+    char buf[HttpRange::kETagLen + 1];
+    HttpRange::formatETag(128000, 1600000000, buf);
+    TEST_ASSERT_EQUAL_STRING("\"0001f400-5f5e1000\"", buf);
+    TEST_ASSERT_EQUAL_UINT32(HttpRange::kETagLen, strlen(buf));
+}
+
+void test_etag_sizeChangeWithoutClock(void) {
+    // RTC unset: mtime stuck, an append still changes the tag
+    char a[HttpRange::kETagLen + 1];
+    char b[HttpRange::kETagLen + 1];
+    HttpRange::formatETag(1000, 0, a);
+    HttpRange::formatETag(1040, 0, b);
+    TEST_ASSERT_FALSE(HttpRange::ifRangeMatches(a, b));
+}
+
+void test_ifRange_strongMatch(void) {
+    char tag[HttpRange::kETagLen + 1];
+    HttpRange::formatETag(4096, 1792195199, tag);
+    TEST_ASSERT_TRUE(HttpRange::ifRangeMatches(tag, tag));
+    TEST_ASSERT_TRUE(HttpRange::ifRangeMatches(" \"00001000-6ad2ba7f\" ", tag));
+    TEST_ASSERT_FALSE(HttpRange::ifRangeMatches("\"00001000-6ad2ba7e\"", tag));
+    TEST_ASSERT_FALSE(HttpRange::ifRangeMatches("\"00001000-6ad2ba7f\"x", tag));
+}
+
+void test_ifRange_dateAndWeakRejected(void) {
+    char tag[HttpRange::kETagLen + 1];
+    HttpRange::formatETag(4096, 1792195199, tag);
+    TEST_ASSERT_FALSE(HttpRange::ifRangeMatches("Fri, 16 Oct 2026 23:59:59 GMT", tag));
+    TEST_ASSERT_FALSE(HttpRange::ifRangeMatches("W/\"00001000-6ad2ba7f\"", tag));
+    TEST_ASSERT_FALSE(HttpRange::ifRangeMatches("", tag));
+    TEST_ASSERT_FALSE(HttpRange::ifRangeMatches(nullptr, tag));
+}
+
+int main(void) {
+    UNITY_BEGIN();
+
+    // Range
+    RUN_TEST(test_range_closed);
+    RUN_TEST(test_range_openEndedResume);
+    RUN_TEST(test_range_endClampedToSize);
+    RUN_TEST(test_range_singleByte);
+    RUN_TEST(test_range_suffix);
+    RUN_TEST(test_range_whitespaceTolerated);
+    RUN_TEST(test_range_unsatisfiable);
+    RUN_TEST(test_range_ignoredWhenMalformed);
+    RUN_TEST(test_range_multiRangeIgnored);
+
+    // HTTP-date
+    RUN_TEST(test_httpDate_epoch);
+    RUN_TEST(test_httpDate_rfcExample);
+    RUN_TEST(test_httpDate_leapDayAndFatEpoch);
+
+    // ETag / If-Range
+    RUN_TEST(test_etag_format);
+    RUN_TEST(test_etag_sizeChangeWithoutClock);
+    RUN_TEST(test_ifRange_strongMatch);
+    RUN_TEST(test_ifRange_dateAndWeakRejected);
+
+    return UNITY_END();
+}
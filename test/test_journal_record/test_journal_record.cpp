@@ -0,0 +1,329 @@
+// Capture Journal Record Tests
+// Tests src/core/journal_record.h (record encoding + resyncing scanner)
+
+#include <unity.h>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+#include "../../src/core/journal_record.h"
+
+using namespace JournalRecord;
+
+void setUp(void) {}
+void tearDown(void) {}
+
+static const uint8_t BSSID[6] = {0x00, 0x11, 0x22, 0x33, 0x44, 0x55};
+static const uint8_t STA[6] = {0xAA, 0xBB, 0xCC, 0xDD, 0xEE, 0xFF};
+
+static uint8_t rec[kMaxRecord];
+static uint8_t window[2 * kMaxRecord];
+
+// Stream source that hands out at most `chunk` bytes per read
+struct VecReader {
+    const std::vector<uint8_t>* src;
+    size_t pos;
+    size_t chunk;
+    size_t operator()(uint8_t* dst, size_t max) {
+        size_t n = src->size() - pos;
+        if (n > max) n = max;
+        if (n > chunk) n = chunk;
+        memcpy(dst, src->data() + pos, n);
+        pos += n;
+        return n;
+    }
+};
+
+static void append(std::vector<uint8_t>& v, const uint8_t* p, size_t n) {
+    v.insert(v.end(), p, p + n);
+}
+
+// 802.11 header + LLC/SNAP + EAPOL, with EAPOL as the tail
+static void makeFrame(uint8_t* full, uint16_t& fullLen, uint16_t eapolLen, uint8_t seed) {
+    fullLen = (uint16_t)(32 + eapolLen);
+    for (uint16_t i = 0; i < fullLen; i++) full[i] = (uint8_t)(seed + i * 7);
+}
+
+struct Scan {
+    std::vector<Record> recs;
+    std::vector<std::vector<uint8_t>> payloads;
+    uint32_t skipped;
+    uint32_t tail;
+};
+
+static Scan scanAll(const std::vector<uint8_t>& data, size_t chunk = 4096) {
+    Scan s;
+    VecReader r = {&data, 0, chunk};
+    auto sc = makeScanner(window, sizeof(window), r);
+    Record rc;
+    while (sc.next(rc)) {
+        s.payloads.emplace_back(rc.payload, rc.payload + rc.len);
+        s.recs.push_back(rc);
+    }
+    s.skipped = sc.skippedBytes();
+    s.tail = sc.tailBytes();
+    return s;
+}
+
+// ============================================================================
+// Encoding
+// ============================================================================
+
+void test_session_roundTrip(void) {
+    size_t n = encodeSession(rec, sizeof(rec), 0xDEADBEEF, 1700000000);
+    TEST_ASSERT_EQUAL(kHeaderLen + 8, n);
+    TEST_ASSERT_EQUAL_UINT8('P', rec[0]);
+    TEST_ASSERT_EQUAL_UINT8('J', rec[1]);
+
+    std::vector<uint8_t> v;
+    append(v, rec, n);
+    Scan s = scanAll(v);
+    TEST_ASSERT_EQUAL(1, s.recs.size());
+    Record r = s.recs[0];
+    r.payload = s.payloads[0].data();
+    uint32_t id, epoch;
+    TEST_ASSERT_TRUE(decodeSession(r, id, epoch));
+    TEST_ASSERT_EQUAL_HEX32(0xDEADBEEF, id);
+    TEST_ASSERT_EQUAL_UINT32(1700000000, epoch);
+}
+
+void test_eapol_sharedTailStoredOnce(void) {
+    uint8_t full[300];
+    uint16_t fullLen;
+    makeFrame(full, fullLen, 121, 3);
+    const uint8_t* eapol = full + 32;
+
+    size_t n = encodeEapol(rec, sizeof(rec), BSSID, STA, 1, -55, 12345,
+                           eapol, 121, full, fullLen);
+    TEST_ASSERT_EQUAL(kHeaderLen + kEapolFixed + fullLen, n);
+    TEST_ASSERT_EQUAL_UINT8(kFlagShared, rec[3]);
+
+    Record r = {rec[2], rec[3], get16(rec + 4), rec + kHeaderLen};
+    Eapol e;
+    TEST_ASSERT_TRUE(decodeEapol(r, e));
+    TEST_ASSERT_EQUAL_MEMORY(BSSID, e.bssid, 6);
+    TEST_ASSERT_EQUAL_MEMORY(STA, e.station, 6);
+    TEST_ASSERT_EQUAL_UINT8(1, e.msgIdx);
+    TEST_ASSERT_EQUAL_INT8(-55, e.rssi);
+    TEST_ASSERT_EQUAL_UINT32(12345, e.timestamp);
+    TEST_ASSERT_EQUAL_UINT16(121, e.eapolLen);
+    TEST_ASSERT_EQUAL_UINT16(fullLen, e.fullLen);
+    TEST_ASSERT_EQUAL_MEMORY(eapol, e.eapol, 121);
+    TEST_ASSERT_EQUAL_MEMORY(full, e.fullFrame, fullLen);
+}
+
+void test_eapol_withoutFullFrame(void) {
+    uint8_t eapol[99];
+    for (int i = 0; i < 99; i++) eapol[i] = (uint8_t)i;
+    size_t n = encodeEapol(rec, sizeof(rec), BSSID, STA, 0, -70, 1, eapol, 99, nullptr, 200);
+    TEST_ASSERT_EQUAL(kHeaderLen + kEapolFixed + 99, n);
+    TEST_ASSERT_EQUAL_UINT8(0, rec[3]);
+
+    Record r = {rec[2], rec[3], get16(rec + 4), rec + kHeaderLen};
+    Eapol e;
+    TEST_ASSERT_TRUE(decodeEapol(r, e));
+    TEST_ASSERT_NULL(e.fullFrame);
+    TEST_ASSERT_EQUAL_UINT16(0, e.fullLen);
+    TEST_ASSERT_EQUAL_MEMORY(eapol, e.eapol, 99);
+}
+
+void test_eapol_truncatedFullFrameKeepsBoth(void) {
+    // 400-byte EAPOL can't be the tail of a 300-byte clamped frame
+    static uint8_t full[460];
+    for (int i = 0; i < 460; i++) full[i] = (uint8_t)(i * 3);
+    size_t n = encodeEapol(rec, sizeof(rec), BSSID, STA, 2, -60, 7,
+                           full + 60, 400, full, 460);
+    TEST_ASSERT_EQUAL(kHeaderLen + kEapolFixed + 300 + 400, n);
+
+    Record r = {rec[2], rec[3], get16(rec + 4), rec + kHeaderLen};
+    Eapol e;
+    TEST_ASSERT_TRUE(decodeEapol(r, e));
+    TEST_ASSERT_EQUAL_UINT16(300, e.fullLen);
+    TEST_ASSERT_EQUAL_MEMORY(full, e.fullFrame, 300);
+    TEST_ASSERT_EQUAL_MEMORY(full + 60, e.eapol, 400);
+}
+
+void test_eapol_rejectsBadArgs(void) {
+    uint8_t eapol[10] = {1};
+    TEST_ASSERT_EQUAL(0, encodeEapol(rec, sizeof(rec), BSSID, STA, 4, 0, 0, eapol, 10, nullptr, 0));
+    TEST_ASSERT_EQUAL(0, encodeEapol(rec, sizeof(rec), BSSID, STA, 0, 0, 0, nullptr, 10, nullptr, 0));
+    TEST_ASSERT_EQUAL(0, encodeEapol(rec, sizeof(rec), BSSID, STA, 0, 0, 0, eapol, 0, nullptr, 0));
+    TEST_ASSERT_EQUAL(0, encodeEapol(rec, 20, BSSID, STA, 0, 0, 0, eapol, 10, nullptr, 0));
+}
+
+void test_pmkid_ssid_exported_roundTrip(void) {
+    uint8_t pmkid[16];
+    for (int i = 0; i < 16; i++) pmkid[i] = (uint8_t)(0xF0 + i);
+
+    std::vector<uint8_t> v;
+    append(v, rec, encodePmkid(rec, sizeof(rec), BSSID, STA, pmkid, 99, "HomeNet"));
+    append(v, rec, encodeSsid(rec, sizeof(rec), BSSID, "Late SSID"));
+    append(v, rec, encodeExported(rec, sizeof(rec), BSSID, STA, kKindPmkid));
+
+    Scan s = scanAll(v);
+    TEST_ASSERT_EQUAL(3, s.recs.size());
+    for (size_t i = 0; i < s.recs.size(); i++) s.recs[i].payload = s.payloads[i].data();
+
+    Pmkid p;
+    TEST_ASSERT_TRUE(decodePmkid(s.recs[0], p));
+    TEST_ASSERT_EQUAL_MEMORY(pmkid, p.pmkid, 16);
+    TEST_ASSERT_EQUAL_STRING("HomeNet", p.ssid);
+    TEST_ASSERT_EQUAL_UINT32(99, p.timestamp);
+
+    const uint8_t* b;
+    char ssid[33];
+    TEST_ASSERT_TRUE(decodeSsid(s.recs[1], b, ssid));
+    TEST_ASSERT_EQUAL_MEMORY(BSSID, b, 6);
+    TEST_ASSERT_EQUAL_STRING("Late SSID", ssid);
+
+    const uint8_t* st;
+    uint8_t kind;
+    TEST_ASSERT_TRUE(decodeExported(s.recs[2], b, st, kind));
+    TEST_ASSERT_EQUAL_MEMORY(STA, st, 6);
+    TEST_ASSERT_EQUAL_UINT8(kKindPmkid, kind);
+
+    // Decoders refuse the wrong type
+    Eapol e;
+    TEST_ASSERT_FALSE(decodeEapol(s.recs[0], e));
+}
+
+void test_beacon_maxSizeFits(void) {
+    static uint8_t frame[kMaxBeaconLen + 1];
+    memset(frame, 0x5A, sizeof(frame));
+    TEST_ASSERT_EQUAL(0, encodeBeacon(rec, sizeof(rec), BSSID, frame, kMaxBeaconLen + 1));
+    size_t n = encodeBeacon(rec, sizeof(rec), BSSID, frame, kMaxBeaconLen);
+    TEST_ASSERT_EQUAL(kMaxRecord, n);
+
+    std::vector<uint8_t> v;
+    append(v, rec, n);
+    Scan s = scanAll(v);
+    TEST_ASSERT_EQUAL(1, s.recs.size());
+    s.recs[0].payload = s.payloads[0].data();
+    const uint8_t* b;
+    const uint8_t* f;
+    uint16_t len;
+    TEST_ASSERT_TRUE(decodeBeacon(s.recs[0], b, f, len));
+    TEST_ASSERT_EQUAL_UINT16(kMaxBeaconLen, len);
+}
+
+// ============================================================================
+// Scanner recovery
+// ============================================================================
+
+static std::vector<uint8_t> makeJournal(int records) {
+    std::vector<uint8_t> v;
+    append(v, rec, encodeSession(rec, sizeof(rec), 1, 0));
+    uint8_t full[300];
+    uint16_t fullLen;
+    for (int i = 1; i < records; i++) {
+        makeFrame(full, fullLen, (uint16_t)(95 + i % 40), (uint8_t)i);
+        append(v, rec, encodeEapol(rec, sizeof(rec), BSSID, STA, (uint8_t)(i % 4), -50,
+                                   (uint32_t)i, full + 32, (uint16_t)(fullLen - 32), full, fullLen));
+    }
+    return v;
+}
+
+void test_scanner_smallReadsSeeEveryRecord(void) {
+    std::vector<uint8_t> v = makeJournal(200);
+    Scan a = scanAll(v, 4096);
+    Scan b = scanAll(v, 7);
+    TEST_ASSERT_EQUAL(200, a.recs.size());
+    TEST_ASSERT_EQUAL(200, b.recs.size());
+    TEST_ASSERT_EQUAL(0, b.skipped);
+    TEST_ASSERT_EQUAL(0, b.tail);
+    TEST_ASSERT_TRUE(a.payloads == b.payloads);
+}
+
+void test_scanner_tornTailReported(void) {
+    std::vector<uint8_t> v = makeJournal(10);
+    size_t full = v.size();
+    v.resize(full - 40);    // Power cut mid-append
+    Scan s = scanAll(v);
+    TEST_ASSERT_EQUAL(9, s.recs.size());
+    TEST_ASSERT_TRUE(s.tail > 0);
+}
+
+void test_scanner_corruptRecordSkippedOthersKept(void) {
+    std::vector<uint8_t> v = makeJournal(10);
+    // Flip a payload byte in the 4th record (session + 3 EAPOLs before it)
+    Scan clean = scanAll(v);
+    size_t off = 0;
+    for (int i = 0; i < 4; i++) off += kHeaderLen + clean.recs[i].len;
+    v[off + kHeaderLen + 30] ^= 0xFF;
+
+    Scan s = scanAll(v);
+    TEST_ASSERT_EQUAL(9, s.recs.size());
+    TEST_ASSERT_EQUAL(kHeaderLen + clean.recs[4].len, s.skipped);
+    TEST_ASSERT_TRUE(s.payloads[4] == clean.payloads[5]);
+}
+
+void test_scanner_garbageBetweenRecords(void) {
+    std::vector<uint8_t> v;
+    append(v, rec, encodeSession(rec, sizeof(rec), 1, 0));
+    const uint8_t junk[] = {'P', 'J', 0x02, 0x00, 0xFF, 0xFF, 0, 0, 'P', 'x', 0x00};
+    append(v, junk, sizeof(junk));
+    append(v, rec, encodeSsid(rec, sizeof(rec), BSSID, "After"));
+    Scan s = scanAll(v);
+    TEST_ASSERT_EQUAL(2, s.recs.size());
+    TEST_ASSERT_EQUAL(sizeof(junk), s.skipped);
+    TEST_ASSERT_EQUAL_UINT8(kSsid, s.recs[1].type);
+}
+
+void test_scanner_corruptLengthDoesNotHideLaterRecords(void) {
+    std::vector<uint8_t> v = makeJournal(5);
+    // First record claims 1400 bytes - more than remains in the file
+    v[4] = 0x78;
+    v[5] = 0x05;
+    Scan s = scanAll(v);
+    TEST_ASSERT_EQUAL(4, s.recs.size());
+    TEST_ASSERT_EQUAL(0, s.tail);
+}
+
+void test_scanner_emptyStream(void) {
+    std::vector<uint8_t> v;
+    Scan s = scanAll(v);
+    TEST_ASSERT_EQUAL(0, s.recs.size());
+    TEST_ASSERT_EQUAL(0, s.skipped);
+    TEST_ASSERT_EQUAL(0, s.tail);
+}
+
+// ============================================================================
+// Size vs RAM
+// ============================================================================
+
+void test_size_typicalHandshakeUnder800Bytes(void) {
+    // M1-M4 with shared full frames: ~120-byte EAPOL + 32-byte header each
+    uint8_t full[300];
+    uint16_t fullLen;
+    size_t total = 0;
+    const uint16_t eapolLens[4] = {95, 121, 151, 95};
+    for (uint8_t m = 0; m < 4; m++) {
+        makeFrame(full, fullLen, eapolLens[m], m);
+        total += encodeEapol(rec, sizeof(rec), BSSID, STA, m, -50, 0,
+                             full + 32, eapolLens[m], full, fullLen);
+    }
+    printf("    Journal bytes for M1-M4: %zu\n", total);
+    TEST_ASSERT_TRUE(total < 800);   // vs 4 x 812 B fixed RAM cells before the slab
+}
+
+int main(void) {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_session_roundTrip);
+    RUN_TEST(test_eapol_sharedTailStoredOnce);
+    RUN_TEST(test_eapol_withoutFullFrame);
+    RUN_TEST(test_eapol_truncatedFullFrameKeepsBoth);
+    RUN_TEST(test_eapol_rejectsBadArgs);
+    RUN_TEST(test_pmkid_ssid_exported_roundTrip);
+    RUN_TEST(test_beacon_maxSizeFits);
+
+    RUN_TEST(test_scanner_smallReadsSeeEveryRecord);
+    RUN_TEST(test_scanner_tornTailReported);
+    RUN_TEST(test_scanner_corruptRecordSkippedOthersKept);
+    RUN_TEST(test_scanner_garbageBetweenRecords);
+    RUN_TEST(test_scanner_corruptLengthDoesNotHideLaterRecords);
+    RUN_TEST(test_scanner_emptyStream);
+
+    RUN_TEST(test_size_typicalHandshakeUnder800Bytes);
+
+    return UNITY_END();
+}
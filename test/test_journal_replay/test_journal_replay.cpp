@@ -0,0 +1,309 @@
+// Capture Journal Replay Tests
+// Tests src/core/journal_replay.h (what recovery exports and what compaction keeps)
+
+#include <unity.h>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+#include "../../src/core/journal_replay.h"
+
+using namespace JournalRecord;
+using JournalReplay::Replay;
+
+void setUp(void) {}
+void tearDown(void) {}
+
+static const uint8_t STA[6] = {0xAA, 0xBB, 0xCC, 0xDD, 0xEE, 0xFF};
+
+static uint8_t rec[kMaxRecord];
+static uint8_t window[2 * kMaxRecord];
+
+struct VecReader {
+    const std::vector<uint8_t>* src;
+    size_t pos;
+    size_t operator()(uint8_t* dst, size_t max) {
+        size_t n = src->size() - pos;
+        if (n > max) n = max;
+        memcpy(dst, src->data() + pos, n);
+        pos += n;
+        return n;
+    }
+};
+
+static void bssidFor(uint8_t* bssid, uint16_t i) {
+    const uint8_t base[6] = {0x00, 0x11, 0x22, 0x33, 0x00, 0x00};
+    memcpy(bssid, base, 6);
+    bssid[4] = (uint8_t)(i >> 8);
+    bssid[5] = (uint8_t)i;
+}
+
+static void append(std::vector<uint8_t>& j, size_t n) {
+    j.insert(j.end(), rec, rec + n);
+}
+
+static void addSession(std::vector<uint8_t>& j, uint32_t id) {
+    append(j, encodeSession(rec, sizeof(rec), id, 1700000000));
+}
+
+// Frames of one exchange: bit 0-3 of mask for M1-M4
+static void addExchange(std::vector<uint8_t>& j, uint16_t ap, uint8_t mask) {
+    uint8_t bssid[6];
+    bssidFor(bssid, ap);
+    uint8_t full[160];
+    for (uint8_t m = 0; m < 4; m++) {
+        if (!(mask & (1 << m))) continue;
+        for (size_t i = 0; i < sizeof(full); i++) full[i] = (uint8_t)(ap + m + i * 3);
+        append(j, encodeEapol(rec, sizeof(rec), bssid, STA, m, -50, 1000 + m,
+                              full + 32, 128, full, sizeof(full)));
+    }
+}
+
+static void addBeacon(std::vector<uint8_t>& j, uint16_t ap) {
+    uint8_t bssid[6];
+    bssidFor(bssid, ap);
+    uint8_t frame[64];
+    memset(frame, 0x80, sizeof(frame));
+    append(j, encodeBeacon(rec, sizeof(rec), bssid, frame, sizeof(frame)));
+}
+
+static void addSsid(std::vector<uint8_t>& j, uint16_t ap, const char* ssid) {
+    uint8_t bssid[6];
+    bssidFor(bssid, ap);
+    append(j, encodeSsid(rec, sizeof(rec), bssid, ssid));
+}
+
+static void addPmkid(std::vector<uint8_t>& j, uint16_t ap, const char* ssid) {
+    uint8_t bssid[6];
+    bssidFor(bssid, ap);
+    uint8_t pmkid[16];
+    memset(pmkid, 0x5A, sizeof(pmkid));
+    append(j, encodePmkid(rec, sizeof(rec), bssid, STA, pmkid, 2000, ssid));
+}
+
+template <typename Fn>
+static void scan(const std::vector<uint8_t>& j, Fn fn) {
+    VecReader r = {&j, 0};
+    auto sc = makeScanner(window, sizeof(window), r);
+    Record rc;
+    while (sc.next(rc)) fn(rc);
+}
+
+struct Pass {
+    uint32_t handshakes;
+    uint32_t partial;
+    uint32_t pmkids;
+    uint32_t beacons;       // Rebuilt captures that found their beacon
+    bool more;
+    JournalReplay::Counts counts;
+    std::vector<uint8_t> exportedAps;
+};
+
+// One recover(): index, rebuild, "export" (every export succeeds unless
+// exportOk is false), append markers, then compact j in place
+static Pass recoverPass(std::vector<uint8_t>& j, bool exportOk = true) {
+    Pass out = {};
+    Replay replay;
+    scan(j, [&](const Record& r) { replay.index(r); });
+    replay.decide();
+    scan(j, [&](const Record& r) { replay.collect(r, true); });
+    replay.resolve();
+
+    for (auto& h : replay.handshakes()) {
+        replay.finished(h, exportOk);
+        if (!exportOk) continue;
+        if (h.partial) out.partial++;
+        else out.handshakes++;
+        if (!h.beacon.empty()) out.beacons++;
+        out.exportedAps.push_back(h.bssid[5]);
+        append(j, encodeExported(rec, sizeof(rec), h.bssid, h.station, kKindHandshake));
+    }
+    for (auto& p : replay.pmkids()) {
+        replay.finished(p, exportOk);
+        if (!exportOk) continue;
+        out.pmkids++;
+        append(j, encodeExported(rec, sizeof(rec), p.bssid, p.station, kKindPmkid));
+    }
+
+    std::vector<uint8_t> compacted;
+    auto write = [&compacted](const uint8_t* bytes, size_t len) {
+        compacted.insert(compacted.end(), bytes, bytes + len);
+        return true;
+    };
+    scan(j, [&](const Record& r) { replay.compact(r, write); });
+    if (replay.keptRecords() == 0) compacted.clear();
+    j.swap(compacted);
+    out.more = replay.morePending();
+    out.counts = replay.getCounts();
+    return out;
+}
+
+static uint32_t countType(const std::vector<uint8_t>& j, uint8_t type) {
+    uint32_t n = 0;
+    scan(j, [&](const Record& r) { if (r.type == type) n++; });
+    return n;
+}
+
+// ============================================================================
+// Partial handshakes
+// ============================================================================
+
+void test_partialsDoNotStarveCompleteHandshake(void) {
+    std::vector<uint8_t> j;
+    addSession(j, 1);
+    for (uint16_t i = 0; i < 24; i++) addExchange(j, i, 0x01);          // M1 only
+    for (uint16_t i = 24; i < 44; i++) addExchange(j, i, 0x02);         // M2 only
+    addExchange(j, 200, 0x03);                                           // M1+M2
+    addBeacon(j, 200);
+    addSsid(j, 200, "HomeNet");
+    size_t before = j.size();
+
+    Pass p = recoverPass(j);
+    printf("    Journal %zu -> %zu bytes\n", before, j.size());
+
+    TEST_ASSERT_EQUAL(1, p.handshakes);
+    TEST_ASSERT_EQUAL(200, p.exportedAps.back());
+    TEST_ASSERT_EQUAL(1, p.beacons);
+    TEST_ASSERT_EQUAL(20, p.partial);
+    TEST_ASSERT_EQUAL(24, p.counts.droppedM1Only);
+    TEST_ASSERT_EQUAL(0, p.counts.deferred);
+    TEST_ASSERT_FALSE(p.more);
+    TEST_ASSERT_TRUE(j.size() < before);
+    TEST_ASSERT_EQUAL(0, j.size());   // Everything decided: journal removed
+}
+
+void test_partialsRebuiltAfterManyDecidedOnes(void) {
+    // More M1-only exchanges than there are slots still leave room
+    std::vector<uint8_t> j;
+    addSession(j, 1);
+    for (uint16_t i = 0; i < 100; i++) addExchange(j, i, 0x01);
+    addExchange(j, 150, 0x06);   // M2+M3
+
+    Pass p = recoverPass(j);
+    TEST_ASSERT_EQUAL(1, p.handshakes);
+    TEST_ASSERT_EQUAL(100, p.counts.droppedM1Only);
+    TEST_ASSERT_EQUAL(0, j.size());
+}
+
+// ============================================================================
+// Bounded passes
+// ============================================================================
+
+void test_overflowExportsRestOnNextPass(void) {
+    std::vector<uint8_t> j;
+    addSession(j, 7);
+    for (uint16_t i = 0; i < 40; i++) {
+        addExchange(j, i, 0x03);
+        addBeacon(j, i);
+    }
+    size_t before = j.size();
+
+    Pass p1 = recoverPass(j);
+    TEST_ASSERT_EQUAL(JournalReplay::kMaxHandshakes, p1.handshakes);
+    TEST_ASSERT_EQUAL(8, p1.counts.deferred);
+    TEST_ASSERT_TRUE(p1.more);
+    // Compacted anyway: only the 8 left, with their beacons and session
+    TEST_ASSERT_TRUE(j.size() < before / 4);
+    TEST_ASSERT_EQUAL(1, countType(j, kSession));
+    TEST_ASSERT_EQUAL(16, countType(j, kEapol));
+    TEST_ASSERT_EQUAL(8, countType(j, kBeacon));
+
+    Pass p2 = recoverPass(j);
+    TEST_ASSERT_EQUAL(8, p2.handshakes);
+    TEST_ASSERT_EQUAL(8, p2.beacons);
+    TEST_ASSERT_FALSE(p2.more);
+    TEST_ASSERT_EQUAL(0, j.size());
+}
+
+void test_failedExportKeptForRetry(void) {
+    std::vector<uint8_t> j;
+    addSession(j, 3);
+    addExchange(j, 5, 0x0F);
+    addBeacon(j, 5);
+    addSsid(j, 5, "Cafe");
+
+    Pass p1 = recoverPass(j, false);
+    TEST_ASSERT_EQUAL(0, p1.handshakes);
+    TEST_ASSERT_TRUE(p1.more);
+    TEST_ASSERT_EQUAL(4, countType(j, kEapol));
+    TEST_ASSERT_EQUAL(1, countType(j, kBeacon));
+    TEST_ASSERT_EQUAL(1, countType(j, kSsid));
+
+    Pass p2 = recoverPass(j);
+    TEST_ASSERT_EQUAL(1, p2.handshakes);
+    TEST_ASSERT_EQUAL(1, p2.beacons);
+    TEST_ASSERT_EQUAL(0, j.size());
+}
+
+void test_exportMarkerFromLiveSessionSkipsCapture(void) {
+    std::vector<uint8_t> j;
+    addSession(j, 9);
+    addExchange(j, 4, 0x03);
+    uint8_t bssid[6];
+    bssidFor(bssid, 4);
+    append(j, encodeExported(rec, sizeof(rec), bssid, STA, kKindHandshake));
+
+    Pass p = recoverPass(j);
+    TEST_ASSERT_EQUAL(0, p.handshakes);
+    TEST_ASSERT_EQUAL(0, j.size());
+}
+
+void test_sameApInTwoSessionsRebuiltSeparately(void) {
+    std::vector<uint8_t> j;
+    addSession(j, 1);
+    addExchange(j, 8, 0x01);    // M1 of a session that died
+    addSession(j, 2);
+    addExchange(j, 8, 0x02);    // M2 alone must not pair with it
+
+    Pass p = recoverPass(j);
+    TEST_ASSERT_EQUAL(0, p.handshakes);
+    TEST_ASSERT_EQUAL(1, p.partial);
+    TEST_ASSERT_EQUAL(1, p.counts.droppedM1Only);
+}
+
+// ============================================================================
+// PMKIDs
+// ============================================================================
+
+void test_waitingPmkidsKeptWithoutSlots(void) {
+    std::vector<uint8_t> j;
+    addSession(j, 1);
+    for (uint16_t i = 0; i < 70; i++) addPmkid(j, 300 + i, "");
+    addExchange(j, 20, 0x03);
+
+    Pass p1 = recoverPass(j);
+    TEST_ASSERT_EQUAL(1, p1.handshakes);
+    TEST_ASSERT_EQUAL(0, p1.pmkids);
+    TEST_ASSERT_EQUAL(70, p1.counts.waitingPmkids);
+    TEST_ASSERT_FALSE(p1.more);
+    TEST_ASSERT_EQUAL(70, countType(j, kPmkid));
+    TEST_ASSERT_EQUAL(0, countType(j, kEapol));
+
+    // A later session learns the SSIDs: 64 per pass, the rest next time
+    addSession(j, 2);
+    for (uint16_t i = 0; i < 70; i++) addSsid(j, 300 + i, "Hidden");
+    Pass p2 = recoverPass(j);
+    TEST_ASSERT_EQUAL(JournalReplay::kMaxPmkids, p2.pmkids);
+    TEST_ASSERT_TRUE(p2.more);
+    TEST_ASSERT_EQUAL(6, countType(j, kPmkid));
+
+    Pass p3 = recoverPass(j);
+    TEST_ASSERT_EQUAL(6, p3.pmkids);
+    TEST_ASSERT_FALSE(p3.more);
+    TEST_ASSERT_EQUAL(0, j.size());
+}
+
+int main(void) {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_partialsDoNotStarveCompleteHandshake);
+    RUN_TEST(test_partialsRebuiltAfterManyDecidedOnes);
+
+    RUN_TEST(test_overflowExportsRestOnNextPass);
+    RUN_TEST(test_failedExportKeptForRetry);
+    RUN_TEST(test_exportMarkerFromLiveSessionSkipsCapture);
+    RUN_TEST(test_sameApInTwoSessionsRebuiltSeparately);
+
+    RUN_TEST(test_waitingPmkidsKeptWithoutSlots);
+
+    return UNITY_END();
+}
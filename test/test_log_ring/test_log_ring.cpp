@@ -0,0 +1,228 @@
+// Log Ring Tests
+// Tests src/core/log_ring.h (SDLog RAM ring -> SD writer task)
+
+#include <unity.h>
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <thread>
+#include "../../src/core/log_ring.h"
+
+void setUp(void) {}
+void tearDown(void) {}
+
+static std::string drainAll(LogRing& ring) {
+    std::string out;
+    const uint8_t* p = nullptr;
+    uint32_t n;
+    while ((n = ring.peek(p)) > 0) {
+        out.append((const char*)p, n);
+        ring.consume(n);
+    }
+    return out;
+}
+
+static bool appendStr(LogRing& ring, const char* s) {
+    return ring.append(s, (uint32_t)strlen(s));
+}
+
+// ============================================================================
+// Basics
+// ============================================================================
+
+void test_logRing_detachedDropsEverything(void) {
+    LogRing ring;
+    TEST_ASSERT_FALSE(ring.attached());
+    TEST_ASSERT_FALSE(appendStr(ring, "x\n"));
+    TEST_ASSERT_EQUAL_UINT32(1, ring.dropped());
+    const uint8_t* p;
+    TEST_ASSERT_EQUAL_UINT32(0, ring.peek(p));
+}
+
+void test_logRing_linesComeOutInOrder(void) {
+    uint8_t buf[256];
+    LogRing ring;
+    ring.attach(buf, sizeof(buf));
+    TEST_ASSERT_TRUE(appendStr(ring, "[1][A] one\n"));
+    TEST_ASSERT_TRUE(appendStr(ring, "[2][B] two\n"));
+    TEST_ASSERT_EQUAL_UINT32(22, ring.used());
+    TEST_ASSERT_EQUAL_STRING("[1][A] one\n[2][B] two\n", drainAll(ring).c_str());
+    TEST_ASSERT_EQUAL_UINT32(0, ring.used());
+    TEST_ASSERT_EQUAL_UINT32(2, ring.pushed());
+}
+
+void test_logRing_fullDropsWholeLine(void) {
+    uint8_t buf[16];
+    LogRing ring;
+    ring.attach(buf, sizeof(buf));
+    TEST_ASSERT_TRUE(appendStr(ring, "0123456789\n"));   // 11 bytes
+    TEST_ASSERT_FALSE(appendStr(ring, "abcdef\n"));      // 7 > 5 free
+    TEST_ASSERT_TRUE(appendStr(ring, "abcd\n"));         // Exactly fills
+    TEST_ASSERT_EQUAL_UINT32(16, ring.used());
+    TEST_ASSERT_EQUAL_UINT32(1, ring.dropped());
+    // Never a torn line in the output
+    TEST_ASSERT_EQUAL_STRING("0123456789\nabcd\n", drainAll(ring).c_str());
+}
+
+void test_logRing_lineLongerThanRingDropped(void) {
+    uint8_t buf[8];
+    LogRing ring;
+    ring.attach(buf, sizeof(buf));
+    TEST_ASSERT_FALSE(appendStr(ring, "0123456789\n"));
+    TEST_ASSERT_FALSE(ring.append("", 0));
+    TEST_ASSERT_EQUAL_UINT32(2, ring.dropped());
+    TEST_ASSERT_EQUAL_UINT32(0, ring.used());
+}
+
+void test_logRing_wrapSplitsIntoTwoSpans(void) {
+    uint8_t buf[16];
+    LogRing ring;
+    ring.attach(buf, sizeof(buf));
+    appendStr(ring, "0123456789\n");
+    ring.consume(11);
+    TEST_ASSERT_TRUE(appendStr(ring, "ABCDEFGHI\n"));  // 5 before end, 5 after
+
+    const uint8_t* p = nullptr;
+    uint32_t n = ring.peek(p);
+    TEST_ASSERT_EQUAL_UINT32(5, n);
+    TEST_ASSERT_EQUAL_MEMORY("ABCDE", p, 5);
+    ring.consume(n);
+    n = ring.peek(p);
+    TEST_ASSERT_EQUAL_UINT32(5, n);
+    TEST_ASSERT_EQUAL_MEMORY("FGHI\n", p, 5);
+}
+
+void test_logRing_copyOutCrossesWrapWithoutConsuming(void) {
+    uint8_t buf[16];
+    uint8_t out[32];
+    LogRing ring;
+    ring.attach(buf, sizeof(buf));
+    appendStr(ring, "0123456789\n");
+    ring.consume(11);
+    appendStr(ring, "ABCDEFGHI\n");
+    TEST_ASSERT_EQUAL_UINT32(10, ring.copyOut(out, sizeof(out)));
+    TEST_ASSERT_EQUAL_MEMORY("ABCDEFGHI\n", out, 10);
+    TEST_ASSERT_EQUAL_UINT32(10, ring.used());
+    TEST_ASSERT_EQUAL_UINT32(4, ring.copyOut(out, 4));
+    TEST_ASSERT_EQUAL_MEMORY("ABCD", out, 4);
+    ring.consume(4);
+    TEST_ASSERT_EQUAL_STRING("EFGHI\n", drainAll(ring).c_str());
+}
+
+void test_logRing_sizeRoundedToPowerOfTwo(void) {
+    uint8_t buf[100];
+    LogRing ring;
+    ring.attach(buf, sizeof(buf));
+    TEST_ASSERT_EQUAL_UINT32(64, ring.capacity());
+    ring.attach(buf, 64);
+    TEST_ASSERT_EQUAL_UINT32(64, ring.capacity());
+    ring.attach(nullptr, 64);
+    TEST_ASSERT_EQUAL_UINT32(0, ring.capacity());
+}
+
+void test_logRing_highWaterAndReset(void) {
+    uint8_t buf[64];
+    LogRing ring;
+    ring.attach(buf, sizeof(buf));
+    appendStr(ring, "aaaaaaaaaa\n");
+    appendStr(ring, "bbbbbbbbbb\n");
+    drainAll(ring);
+    appendStr(ring, "c\n");
+    TEST_ASSERT_EQUAL_UINT32(22, ring.highWater());
+    ring.reset();
+    TEST_ASSERT_EQUAL_UINT32(0, ring.used());
+    TEST_ASSERT_EQUAL_UINT32(0, ring.highWater());
+    TEST_ASSERT_EQUAL_UINT32(0, ring.pushed());
+}
+
+void test_logRing_countersSurviveWrapOfFreeRunningIndex(void) {
+    // head/tail are free-running; many laps must not confuse used()
+    uint8_t buf[24];
+    LogRing ring;
+    ring.attach(buf, sizeof(buf));
+    char line[16];
+    for (int i = 0; i < 20000; i++) {
+        int n = snprintf(line, sizeof(line), "L%05d\n", i);
+        TEST_ASSERT_TRUE(ring.append(line, (uint32_t)n));
+        std::string got = drainAll(ring);
+        TEST_ASSERT_EQUAL_STRING(line, got.c_str());
+    }
+    TEST_ASSERT_EQUAL_UINT32(0, ring.dropped());
+}
+
+// ============================================================================
+// Concurrency
+// ============================================================================
+
+// Producer logs numbered lines as fast as it can; consumer drains in
+// sector-sized copies like the writer task. Output must be whole lines in
+// order, and every line is either written or counted as dropped.
+void test_logRing_producerConsumerStress(void) {
+    static uint8_t buf[2048];
+    LogRing ring;
+    ring.attach(buf, sizeof(buf));
+    const int kLines = 200000;
+    std::atomic<bool> done{false};
+
+    std::thread producer([&]() {
+        char line[48];
+        for (int i = 0; i < kLines; i++) {
+            int n = snprintf(line, sizeof(line), "[%d][OINK] handshake %d\n", i, i * 7);
+            ring.append(line, (uint32_t)n);
+        }
+        done.store(true);
+    });
+
+    std::string pending;
+    uint8_t sector[512];
+    int lastSeen = -1;
+    uint32_t lines = 0;
+    bool ordered = true;
+    auto consume = [&]() {
+        uint32_t n;
+        while ((n = ring.copyOut(sector, sizeof(sector))) > 0) {
+            pending.append((const char*)sector, n);
+            ring.consume(n);
+        }
+        size_t nl;
+        while ((nl = pending.find('\n')) != std::string::npos) {
+            int idx = -1, val = -1;
+            if (sscanf(pending.c_str(), "[%d][OINK] handshake %d", &idx, &val) != 2 ||
+                idx <= lastSeen || val != idx * 7) {
+                ordered = false;
+            }
+            lastSeen = idx;
+            lines++;
+            pending.erase(0, nl + 1);
+        }
+    };
+    while (!done.load()) consume();
+    producer.join();
+    consume();
+
+    TEST_ASSERT_TRUE(ordered);
+    TEST_ASSERT_TRUE(pending.empty());
+    TEST_ASSERT_EQUAL_UINT32(ring.pushed(), lines);
+    TEST_ASSERT_EQUAL_UINT32((uint32_t)kLines, ring.pushed() + ring.dropped());
+}
+
+int main(void) {
+    UNITY_BEGIN();
+
+    // Basics
+    RUN_TEST(test_logRing_detachedDropsEverything);
+    RUN_TEST(test_logRing_linesComeOutInOrder);
+    RUN_TEST(test_logRing_fullDropsWholeLine);
+    RUN_TEST(test_logRing_lineLongerThanRingDropped);
+    RUN_TEST(test_logRing_wrapSplitsIntoTwoSpans);
+    RUN_TEST(test_logRing_copyOutCrossesWrapWithoutConsuming);
+    RUN_TEST(test_logRing_sizeRoundedToPowerOfTwo);
+    RUN_TEST(test_logRing_highWaterAndReset);
+    RUN_TEST(test_logRing_countersSurviveWrapOfFreeRunningIndex);
+
+    // Concurrency
+    RUN_TEST(test_logRing_producerConsumerStress);
+
+    return UNITY_END();
+}
@@ -0,0 +1,229 @@
+// Membership Set Tests
+// Tests src/core/membership_set.h (hashing, sorted set, sidecar format)
+
+#include <unity.h>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+#include "../../src/core/membership_set.h"
+
+using namespace MembershipSet;
+
+void setUp(void) {}
+void tearDown(void) {}
+
+// What MembershipFile::writeIndex() puts on SD
+static std::vector<uint8_t> sidecarImage(const Set& set, uint32_t textSize, uint32_t textMtime) {
+    std::vector<uint8_t> out(kHeaderLen + set.size() * kHashLen);
+    Header h = {(uint32_t)set.size(), textSize, textMtime};
+    encodeHeader(out.data(), h);
+    for (size_t i = 0; i < set.size(); i++) put64(out.data() + kHeaderLen + i * kHashLen, set.data()[i]);
+    return out;
+}
+
+// What MembershipFile::loadIndex() accepts
+static bool loadSidecar(const std::vector<uint8_t>& img, uint32_t textSize, uint32_t textMtime, Set& set) {
+    Header h;
+    if (img.size() < kHeaderLen || !decodeHeader(img.data(), h)) return false;
+    if (h.textSize != textSize || h.textMtime != textMtime) return false;
+    if (img.size() != kHeaderLen + (size_t)h.count * kHashLen) return false;
+    set.clear();
+    for (uint32_t i = 0; i < h.count; i++) {
+        if (!set.appendSorted(get64(img.data() + kHeaderLen + i * kHashLen))) {
+            set.clear();
+            return false;
+        }
+    }
+    return true;
+}
+
+// ============================================================================
+// Hashing
+// ============================================================================
+
+void test_hash_fnv1aReferenceValues(void) {
+    // Published FNV-1a 64 test vectors - the sidecar depends on these staying put
+    TEST_ASSERT_TRUE(hash("", 0) == 0xCBF29CE484222325ULL);
+    TEST_ASSERT_TRUE(hash("a") == 0xAF63DC4C8601EC8CULL);
+    TEST_ASSERT_TRUE(hash("foobar") == 0x85944171F73967E8ULL);
+    TEST_ASSERT_TRUE(hash(nullptr) == hash("", 0));
+}
+
+void test_hash_lengthBounded(void) {
+    const char* line = "64EEB7208286\r\n";
+    TEST_ASSERT_TRUE(hash(line, 12) == hash("64EEB7208286"));
+    TEST_ASSERT_TRUE(hash("64EEB7208286") != hash("64eeb7208286"));
+}
+
+void test_trim_matchesStringTrim(void) {
+    const char* raw = "  \t64EEB7208286 \r";
+    size_t len = strlen(raw);
+    const char* s = trim(raw, len);
+    TEST_ASSERT_EQUAL(12, len);
+    TEST_ASSERT_EQUAL(0, strncmp(s, "64EEB7208286", 12));
+
+    const char* blank = " \r";
+    len = strlen(blank);
+    trim(blank, len);
+    TEST_ASSERT_EQUAL(0, len);
+}
+
+// ============================================================================
+// Set
+// ============================================================================
+
+void test_set_insertContainsRemove(void) {
+    Set set;
+    TEST_ASSERT_TRUE(set.insert(hash("a.wigle.csv")));
+    TEST_ASSERT_TRUE(set.insert(hash("b.wigle.csv")));
+    TEST_ASSERT_FALSE(set.insert(hash("a.wigle.csv")));
+    TEST_ASSERT_EQUAL(2, set.size());
+    TEST_ASSERT_TRUE(set.contains(hash("a.wigle.csv")));
+    TEST_ASSERT_FALSE(set.contains(hash("c.wigle.csv")));
+
+    TEST_ASSERT_TRUE(set.remove(hash("a.wigle.csv")));
+    TEST_ASSERT_FALSE(set.remove(hash("a.wigle.csv")));
+    TEST_ASSERT_FALSE(set.contains(hash("a.wigle.csv")));
+    TEST_ASSERT_TRUE(set.contains(hash("b.wigle.csv")));
+    TEST_ASSERT_EQUAL(1, set.size());
+}
+
+void test_set_staysSorted(void) {
+    Set set;
+    for (uint32_t i = 0; i < 500; i++) {
+        char key[16];
+        snprintf(key, sizeof(key), "%012X", i * 7919u);
+        set.insert(hash(key));
+    }
+    for (size_t i = 1; i < set.size(); i++) {
+        TEST_ASSERT_TRUE(set.data()[i - 1] < set.data()[i]);
+    }
+}
+
+void test_set_bulkAppendDedupes(void) {
+    // Rebuild from a text list with repeated lines
+    Set set;
+    const char* lines[] = {"B", "A", "C", "A", "B", "A"};
+    for (const char* l : lines) set.append(hash(l));
+    set.finish();
+    TEST_ASSERT_EQUAL(3, set.size());
+    TEST_ASSERT_TRUE(set.contains(hash("A")));
+    TEST_ASSERT_TRUE(set.contains(hash("C")));
+    TEST_ASSERT_FALSE(set.contains(hash("D")));
+    for (size_t i = 1; i < set.size(); i++) {
+        TEST_ASSERT_TRUE(set.data()[i - 1] < set.data()[i]);
+    }
+}
+
+void test_set_noCapAndNoFalsePositives(void) {
+    // Well past the old 200/500/512 caps
+    Set set;
+    char key[32];
+    for (uint32_t i = 0; i < 20000; i++) {
+        snprintf(key, sizeof(key), "%02X%02X%02X%02X%02X%02X",
+                 0x64, 0xEE, (i >> 16) & 0xFF, (i >> 8) & 0xFF, i & 0xFF, 0x01);
+        set.append(hash(key));
+    }
+    set.finish();
+    TEST_ASSERT_EQUAL(20000, set.size());
+    for (uint32_t i = 0; i < 20000; i++) {
+        snprintf(key, sizeof(key), "%02X%02X%02X%02X%02X%02X",
+                 0x64, 0xEE, (i >> 16) & 0xFF, (i >> 8) & 0xFF, i & 0xFF, 0x01);
+        TEST_ASSERT_TRUE(set.contains(hash(key)));
+        snprintf(key, sizeof(key), "%02X%02X%02X%02X%02X%02X",
+                 0x64, 0xEE, (i >> 16) & 0xFF, (i >> 8) & 0xFF, i & 0xFF, 0x02);
+        TEST_ASSERT_FALSE(set.contains(hash(key)));
+    }
+}
+
+void test_set_releaseFreesAndReuses(void) {
+    Set set;
+    for (uint32_t i = 0; i < 100; i++) set.insert(i * 3 + 1);
+    set.release();
+    TEST_ASSERT_EQUAL(0, set.size());
+    TEST_ASSERT_FALSE(set.contains(4));
+    TEST_ASSERT_TRUE(set.insert(4));
+    TEST_ASSERT_TRUE(set.contains(4));
+}
+
+// ============================================================================
+// Sidecar
+// ============================================================================
+
+void test_header_roundTripAndVersionChecked(void) {
+    uint8_t buf[kHeaderLen];
+    Header h = {321, 4567, 0x5F5E1000};
+    encodeHeader(buf, h);
+    Header out = {};
+    TEST_ASSERT_TRUE(decodeHeader(buf, out));
+    TEST_ASSERT_EQUAL_UINT32(321, out.count);
+    TEST_ASSERT_EQUAL_UINT32(4567, out.textSize);
+    TEST_ASSERT_EQUAL_UINT32(0x5F5E1000, out.textMtime);
+
+    buf[4] = 9;
+    TEST_ASSERT_FALSE(decodeHeader(buf, out));
+    encodeHeader(buf, h);
+    buf[1] = 'X';
+    TEST_ASSERT_FALSE(decodeHeader(buf, out));
+}
+
+void test_sidecar_roundTrip(void) {
+    Set set;
+    set.insert(hash("64EEB7208286"));
+    set.insert(hash("001122334455"));
+    set.insert(hash("AABBCCDDEEFF"));
+    std::vector<uint8_t> img = sidecarImage(set, 42, 1000);
+
+    Set loaded;
+    TEST_ASSERT_TRUE(loadSidecar(img, 42, 1000, loaded));
+    TEST_ASSERT_EQUAL(3, loaded.size());
+    TEST_ASSERT_TRUE(loaded.contains(hash("001122334455")));
+    TEST_ASSERT_FALSE(loaded.contains(hash("001122334456")));
+}
+
+void test_sidecar_staleOrDamagedRejected(void) {
+    Set set;
+    for (uint32_t i = 0; i < 10; i++) set.insert(hash(std::to_string(i).c_str()));
+    std::vector<uint8_t> img = sidecarImage(set, 100, 2000);
+    Set loaded;
+
+    // Text list grew or was rewritten since the sidecar was written
+    TEST_ASSERT_FALSE(loadSidecar(img, 114, 2000, loaded));
+    TEST_ASSERT_FALSE(loadSidecar(img, 100, 2002, loaded));
+
+    // Torn write
+    std::vector<uint8_t> torn(img.begin(), img.end() - 3);
+    TEST_ASSERT_FALSE(loadSidecar(torn, 100, 2000, loaded));
+
+    // Out-of-order hashes
+    std::vector<uint8_t> swapped = img;
+    for (int b = 0; b < kHashLen; b++) {
+        std::swap(swapped[kHeaderLen + b], swapped[kHeaderLen + kHashLen + b]);
+    }
+    TEST_ASSERT_FALSE(loadSidecar(swapped, 100, 2000, loaded));
+    TEST_ASSERT_EQUAL(0, loaded.size());
+
+    TEST_ASSERT_TRUE(loadSidecar(img, 100, 2000, loaded));
+    TEST_ASSERT_EQUAL(10, loaded.size());
+}
+
+int main(void) {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_hash_fnv1aReferenceValues);
+    RUN_TEST(test_hash_lengthBounded);
+    RUN_TEST(test_trim_matchesStringTrim);
+
+    RUN_TEST(test_set_insertContainsRemove);
+    RUN_TEST(test_set_staysSorted);
+    RUN_TEST(test_set_bulkAppendDedupes);
+    RUN_TEST(test_set_noCapAndNoFalsePositives);
+    RUN_TEST(test_set_releaseFreesAndReuses);
+
+    RUN_TEST(test_header_roundTripAndVersionChecked);
+    RUN_TEST(test_sidecar_roundTrip);
+    RUN_TEST(test_sidecar_staleOrDamagedRejected);
+
+    return UNITY_END();
+}
@@ -0,0 +1,155 @@
+// Mode Latency Tests
+// Tests src/core/mode_latency.h (transition probes, timing ring, deferred
+// start step queue)
+
+#include <unity.h>
+#include "../../src/core/mode_latency.h"
+
+using namespace ModeLatency;
+
+void setUp(void) {}
+void tearDown(void) {}
+
+static Sample makeSample(uint32_t us, Kind kind, uint8_t mode = 1) {
+    Probe p;
+    p.begin(1000, 100000, 60000);
+    return p.finish(1000 + us, 5, 100000, 60000, mode, kind);
+}
+
+void test_probeDeltas(void) {
+    Probe p;
+    p.begin(0xFFFFFF00u, 150000, 90000);
+    // micros() wrapped; start allocated 20 KB and split the largest block
+    Sample s = p.finish(0x00000100u, 42, 130000, 45000, 3, Kind::Start);
+    TEST_ASSERT_EQUAL_UINT32(0x200, s.us);
+    TEST_ASSERT_EQUAL_INT32(-20000, s.freeDelta);
+    TEST_ASSERT_EQUAL_INT32(-45000, s.largestDelta);
+    TEST_ASSERT_EQUAL(3, s.mode);
+    TEST_ASSERT_EQUAL((int)Kind::Start, (int)s.kind);
+    TEST_ASSERT_EQUAL_UINT32(42, s.atMs);
+
+    // Stop gives heap back
+    p.begin(0, 100000, 40000);
+    s = p.finish(10, 43, 112000, 70000, 3, Kind::Stop);
+    TEST_ASSERT_EQUAL_INT32(12000, s.freeDelta);
+    TEST_ASSERT_EQUAL_INT32(30000, s.largestDelta);
+}
+
+void test_budget(void) {
+    TEST_ASSERT_FALSE(makeSample(kTransitionBudgetUs, Kind::Start).overBudget());
+    TEST_ASSERT_TRUE(makeSample(kTransitionBudgetUs + 1, Kind::Start).overBudget());
+}
+
+void test_ringKeepsNewestOldestFirst(void) {
+    Ring<4> r;
+    TEST_ASSERT_EQUAL(0, r.size());
+    for (uint32_t i = 1; i <= 6; i++) r.push(makeSample(i * 1000, Kind::Stop, (uint8_t)i));
+    TEST_ASSERT_EQUAL(4, r.size());
+    TEST_ASSERT_EQUAL(3, r.at(0).mode);
+    TEST_ASSERT_EQUAL(6, r.at(3).mode);
+}
+
+void test_ringWorstAndOverBudget(void) {
+    Ring<4> r;
+    r.push(makeSample(5000, Kind::Stop));
+    r.push(makeSample(250000, Kind::Start));
+    r.push(makeSample(90000, Kind::Step));
+    r.push(makeSample(180000, Kind::Step));
+    // Worst survives the sample scrolling out
+    for (int i = 0; i < 8; i++) r.push(makeSample(100, Kind::Stop));
+    TEST_ASSERT_EQUAL_UINT32(5000, r.worstUs(Kind::Stop));
+    TEST_ASSERT_EQUAL_UINT32(250000, r.worstUs(Kind::Start));
+    TEST_ASSERT_EQUAL_UINT32(180000, r.worstUs(Kind::Step));
+    TEST_ASSERT_EQUAL_UINT32(2, r.overBudget());
+    r.clear();
+    TEST_ASSERT_EQUAL(0, r.size());
+    TEST_ASSERT_EQUAL_UINT32(0, r.worstUs(Kind::Start));
+    TEST_ASSERT_EQUAL_UINT32(0, r.overBudget());
+}
+
+static int calls[3];
+static int retriesLeft;
+static bool stepA() { calls[0]++; return true; }
+static bool stepSlow() { calls[1]++; return retriesLeft-- <= 0; }
+static bool stepC() { calls[2]++; return true; }
+
+static StepQueue* switchQueue;
+static bool stepSwitchesMode() {
+    // Start failed: mode changed underneath the queue
+    switchQueue->begin(9);
+    switchQueue->add(stepC);
+    return true;
+}
+
+void test_stepsRunInOrderAndRetry(void) {
+    calls[0] = calls[1] = calls[2] = 0;
+    retriesLeft = 2;
+    StepQueue q;
+    q.begin(4);
+    TEST_ASSERT_TRUE(q.add(stepA));
+    TEST_ASSERT_TRUE(q.add(stepSlow));
+    TEST_ASSERT_TRUE(q.add(stepC));
+    TEST_ASSERT_EQUAL(4, q.owner());
+    TEST_ASSERT_EQUAL(3, q.remaining());
+
+    TEST_ASSERT_TRUE(q.runOne());       // A
+    TEST_ASSERT_FALSE(q.runOne());      // slow, not yet
+    TEST_ASSERT_FALSE(q.runOne());
+    TEST_ASSERT_TRUE(q.runOne());       // slow done
+    TEST_ASSERT_EQUAL(1, q.remaining());
+    TEST_ASSERT_EQUAL(0, calls[2]);
+    TEST_ASSERT_TRUE(q.runOne());       // C
+    TEST_ASSERT_FALSE(q.pending());
+    TEST_ASSERT_FALSE(q.runOne());
+    TEST_ASSERT_EQUAL(1, calls[0]);
+    TEST_ASSERT_EQUAL(3, calls[1]);
+    TEST_ASSERT_EQUAL(1, calls[2]);
+}
+
+void test_cancelAndCapacity(void) {
+    StepQueue q;
+    q.begin(1);
+    for (uint8_t i = 0; i < StepQueue::kMaxSteps; i++) TEST_ASSERT_TRUE(q.add(stepA));
+    TEST_ASSERT_FALSE(q.add(stepA));
+    TEST_ASSERT_FALSE(q.add(nullptr));
+    q.cancel();
+    TEST_ASSERT_FALSE(q.pending());
+    TEST_ASSERT_EQUAL(0, q.remaining());
+}
+
+void test_stepReplacingQueueIsNotSkipped(void) {
+    calls[2] = 0;
+    StepQueue q;
+    switchQueue = &q;
+    q.begin(2);
+    q.add(stepSwitchesMode);
+    q.add(stepA);
+    TEST_ASSERT_TRUE(q.runOne());
+    // New mode's first step is still there, old mode's are gone
+    TEST_ASSERT_EQUAL(9, q.owner());
+    TEST_ASSERT_EQUAL(1, q.remaining());
+    TEST_ASSERT_TRUE(q.runOne());
+    TEST_ASSERT_EQUAL(1, calls[2]);
+    TEST_ASSERT_FALSE(q.pending());
+}
+
+void test_kindNames(void) {
+    TEST_ASSERT_EQUAL_STRING("STOP", kindName(Kind::Stop));
+    TEST_ASSERT_EQUAL_STRING("STEP", kindName(Kind::Step));
+    TEST_ASSERT_EQUAL_STRING("?", kindName(Kind::Count));
+}
+
+int main(void) {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_probeDeltas);
+    RUN_TEST(test_budget);
+    RUN_TEST(test_ringKeepsNewestOldestFirst);
+    RUN_TEST(test_ringWorstAndOverBudget);
+    RUN_TEST(test_stepsRunInOrderAndRetry);
+    RUN_TEST(test_cancelAndCapacity);
+    RUN_TEST(test_stepReplacingQueueIsNotSkipped);
+    RUN_TEST(test_kindNames);
+
+    return UNITY_END();
+}
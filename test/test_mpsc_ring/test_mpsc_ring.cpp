@@ -0,0 +1,240 @@
+// MPSC Ring Tests
+// Tests src/core/mpsc_ring.h (callback -> main loop event queue)
+// Stress test runs several producer threads against one consumer
+
+#include <unity.h>
+#include <atomic>
+#include <cstring>
+#include <thread>
+#include <vector>
+#include "../../src/core/mpsc_ring.h"
+
+void setUp(void) {}
+void tearDown(void) {}
+
+struct BigEvent {
+    uint8_t bssid[6];
+    uint16_t seq;
+    uint8_t payload[200];
+};
+
+// ============================================================================
+// Basic FIFO behaviour
+// ============================================================================
+
+void test_ring_startsEmpty(void) {
+    MpscRing<uint32_t, 8> ring;
+    uint32_t v = 0;
+    TEST_ASSERT_TRUE(ring.empty());
+    TEST_ASSERT_EQUAL_UINT16(0, ring.size());
+    TEST_ASSERT_FALSE(ring.pop(v));
+    TEST_ASSERT_EQUAL_UINT16(8, ring.capacity());
+}
+
+void test_ring_fifoOrder(void) {
+    MpscRing<uint32_t, 8> ring;
+    for (uint32_t i = 0; i < 5; i++) {
+        TEST_ASSERT_TRUE(ring.push(i * 10));
+    }
+    TEST_ASSERT_EQUAL_UINT16(5, ring.size());
+    for (uint32_t i = 0; i < 5; i++) {
+        uint32_t v = 0;
+        TEST_ASSERT_TRUE(ring.pop(v));
+        TEST_ASSERT_EQUAL_UINT32(i * 10, v);
+    }
+    TEST_ASSERT_TRUE(ring.empty());
+}
+
+void test_ring_fullDropsAndCounts(void) {
+    MpscRing<uint32_t, 4> ring;
+    for (uint32_t i = 0; i < 4; i++) {
+        TEST_ASSERT_TRUE(ring.push(i));
+    }
+    TEST_ASSERT_FALSE(ring.push(99));
+    TEST_ASSERT_FALSE(ring.push(100));
+    TEST_ASSERT_EQUAL_UINT32(4, ring.pushed());
+    TEST_ASSERT_EQUAL_UINT32(2, ring.dropped());
+
+    // Oldest events survive; nothing was overwritten
+    uint32_t v = 0;
+    TEST_ASSERT_TRUE(ring.pop(v));
+    TEST_ASSERT_EQUAL_UINT32(0, v);
+
+    // Freed cell is reusable
+    TEST_ASSERT_TRUE(ring.push(42));
+    for (uint32_t expect : {1u, 2u, 3u, 42u}) {
+        TEST_ASSERT_TRUE(ring.pop(v));
+        TEST_ASSERT_EQUAL_UINT32(expect, v);
+    }
+    TEST_ASSERT_FALSE(ring.pop(v));
+}
+
+void test_ring_highWaterTracksPeak(void) {
+    MpscRing<uint32_t, 16> ring;
+    uint32_t v;
+    for (uint32_t i = 0; i < 6; i++) ring.push(i);
+    for (uint32_t i = 0; i < 6; i++) ring.pop(v);
+    for (uint32_t i = 0; i < 3; i++) ring.push(i);
+    TEST_ASSERT_EQUAL_UINT16(6, ring.highWater());
+
+    RingStats s = ring.stats();
+    TEST_ASSERT_EQUAL_UINT32(9, s.pushed);
+    TEST_ASSERT_EQUAL_UINT32(0, s.dropped);
+    TEST_ASSERT_EQUAL_UINT16(6, s.highWater);
+    TEST_ASSERT_EQUAL_UINT16(16, s.capacity);
+}
+
+void test_ring_highWaterCapsAtCapacity(void) {
+    MpscRing<uint32_t, 4> ring;
+    for (uint32_t i = 0; i < 10; i++) ring.push(i);
+    TEST_ASSERT_EQUAL_UINT16(4, ring.highWater());
+}
+
+void test_ring_wrapsManyTimes(void) {
+    MpscRing<uint32_t, 4> ring;
+    uint32_t next = 0;
+    for (uint32_t round = 0; round < 1000; round++) {
+        TEST_ASSERT_TRUE(ring.push(round * 2));
+        TEST_ASSERT_TRUE(ring.push(round * 2 + 1));
+        uint32_t v;
+        TEST_ASSERT_TRUE(ring.pop(v));
+        TEST_ASSERT_EQUAL_UINT32(next++, v);
+        TEST_ASSERT_TRUE(ring.pop(v));
+        TEST_ASSERT_EQUAL_UINT32(next++, v);
+    }
+    TEST_ASSERT_TRUE(ring.empty());
+    TEST_ASSERT_EQUAL_UINT32(0, ring.dropped());
+}
+
+void test_ring_resetClearsEverything(void) {
+    MpscRing<uint32_t, 4> ring;
+    for (uint32_t i = 0; i < 6; i++) ring.push(i);
+    ring.reset();
+    uint32_t v;
+    TEST_ASSERT_TRUE(ring.empty());
+    TEST_ASSERT_FALSE(ring.pop(v));
+    TEST_ASSERT_EQUAL_UINT32(0, ring.pushed());
+    TEST_ASSERT_EQUAL_UINT32(0, ring.dropped());
+    TEST_ASSERT_EQUAL_UINT16(0, ring.highWater());
+    TEST_ASSERT_TRUE(ring.push(7));
+    TEST_ASSERT_TRUE(ring.pop(v));
+    TEST_ASSERT_EQUAL_UINT32(7, v);
+}
+
+// ============================================================================
+// In-place emplace / consume
+// ============================================================================
+
+void test_ring_emplaceFillsInPlace(void) {
+    MpscRing<BigEvent, 4> ring;
+    bool ok = ring.emplace([](BigEvent& ev) {
+        memset(ev.bssid, 0xAB, 6);
+        ev.seq = 1234;
+        for (int i = 0; i < 200; i++) ev.payload[i] = (uint8_t)i;
+    });
+    TEST_ASSERT_TRUE(ok);
+
+    bool seen = false;
+    TEST_ASSERT_TRUE(ring.consume([&](const BigEvent& ev) {
+        seen = true;
+        TEST_ASSERT_EQUAL_HEX8(0xAB, ev.bssid[5]);
+        TEST_ASSERT_EQUAL_UINT16(1234, ev.seq);
+        TEST_ASSERT_EQUAL_UINT8(199, ev.payload[199]);
+    }));
+    TEST_ASSERT_TRUE(seen);
+    TEST_ASSERT_FALSE(ring.consume([](const BigEvent&) {}));
+}
+
+void test_ring_emplaceOnFullSkipsFill(void) {
+    MpscRing<uint32_t, 2> ring;
+    ring.push(1);
+    ring.push(2);
+    bool called = false;
+    TEST_ASSERT_FALSE(ring.emplace([&](uint32_t& v) { called = true; v = 3; }));
+    TEST_ASSERT_FALSE(called);
+    TEST_ASSERT_EQUAL_UINT32(1, ring.dropped());
+}
+
+void test_ring_countersOnSeparateCacheLines(void) {
+    // Producer and consumer indices must not share a line
+    TEST_ASSERT_TRUE(alignof(MpscRing<uint8_t, 4>) >= kRingCacheLine);
+    TEST_ASSERT_TRUE(sizeof(MpscRing<uint8_t, 4>) >= 3 * kRingCacheLine);
+}
+
+// ============================================================================
+// Concurrency
+// ============================================================================
+
+// Each producer pushes (id << 24 | seq); consumer checks per-producer order
+// and that accepted + dropped == attempted.
+void test_ring_multiProducerStress(void) {
+    static MpscRing<uint32_t, 64> ring;
+    ring.reset();
+    const uint32_t kProducers = 4;
+    const uint32_t kPerProducer = 50000;
+    std::atomic<uint32_t> accepted[kProducers];
+    std::atomic<uint32_t> done{0};
+    for (auto& a : accepted) a.store(0);
+
+    std::vector<std::thread> threads;
+    for (uint32_t p = 0; p < kProducers; p++) {
+        threads.emplace_back([&, p]() {
+            for (uint32_t i = 0; i < kPerProducer; i++) {
+                uint32_t seq = accepted[p].load(std::memory_order_relaxed);
+                if (ring.push((p << 24) | seq)) {
+                    accepted[p].store(seq + 1, std::memory_order_relaxed);
+                }
+            }
+            done.fetch_add(1);
+        });
+    }
+
+    uint32_t expectSeq[kProducers] = {0};
+    uint32_t received = 0;
+    bool ordered = true;
+    auto drain = [&]() {
+        uint32_t v;
+        while (ring.pop(v)) {
+            uint32_t p = v >> 24;
+            uint32_t seq = v & 0xFFFFFF;
+            if (p >= kProducers || seq != expectSeq[p]) ordered = false;
+            else expectSeq[p]++;
+            received++;
+        }
+    };
+    while (done.load() < kProducers) drain();
+    for (auto& t : threads) t.join();
+    drain();
+
+    uint32_t totalAccepted = 0;
+    for (auto& a : accepted) totalAccepted += a.load();
+
+    TEST_ASSERT_TRUE(ordered);
+    TEST_ASSERT_EQUAL_UINT32(totalAccepted, received);
+    TEST_ASSERT_EQUAL_UINT32(totalAccepted, ring.pushed());
+    TEST_ASSERT_EQUAL_UINT32(kProducers * kPerProducer, ring.pushed() + ring.dropped());
+    TEST_ASSERT_TRUE(ring.highWater() <= 64);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+
+    // FIFO
+    RUN_TEST(test_ring_startsEmpty);
+    RUN_TEST(test_ring_fifoOrder);
+    RUN_TEST(test_ring_fullDropsAndCounts);
+    RUN_TEST(test_ring_highWaterTracksPeak);
+    RUN_TEST(test_ring_highWaterCapsAtCapacity);
+    RUN_TEST(test_ring_wrapsManyTimes);
+    RUN_TEST(test_ring_resetClearsEverything);
+
+    // In place
+    RUN_TEST(test_ring_emplaceFillsInPlace);
+    RUN_TEST(test_ring_emplaceOnFullSkipsFill);
+    RUN_TEST(test_ring_countersOnSeparateCacheLines);
+
+    // Concurrency
+    RUN_TEST(test_ring_multiProducerStress);
+
+    return UNITY_END();
+}
@@ -0,0 +1,337 @@
+// OUI Lookup Tests + Benchmark
+// Tests src/core/oui_lookup.h against the generated src/core/oui_db.h and
+// compares it with the old unsorted linear scan.
+
+#include <unity.h>
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <vector>
+
+#ifndef PROGMEM
+#define PROGMEM
+#endif
+#include "../../src/core/oui_db.h"
+#include "../../src/core/oui_lookup.h"
+
+using OuiLookup::kNoVendor;
+
+void setUp(void) {}
+void tearDown(void) {}
+
+// Same flow as OUI::getVendor() minus the Arduino bits
+static const char* vendorFor(const uint8_t* mac, OuiLookup::LruCache<8>* cache) {
+    if (mac[0] & 0x02) return "RANDOM";
+    uint32_t key = OuiLookup::keyFromMac(mac);
+    uint16_t vendor;
+    if (!cache || !cache->lookup(key, vendor)) {
+        int32_t idx = OuiLookup::find(OUI_DB_KEYS, OUI_DB_COUNT, key);
+        vendor = idx < 0 ? kNoVendor : OUI_DB_VENDOR[idx];
+        if (cache) cache->insert(key, vendor);
+    }
+    return vendor == kNoVendor ? "UNKNOWN" : OUI_DB_NAMES + OUI_DB_NAME_OFF[vendor];
+}
+
+static const char* vendorFor(uint8_t a, uint8_t b, uint8_t c) {
+    const uint8_t mac[6] = {a, b, c, 0x12, 0x34, 0x56};
+    return vendorFor(mac, nullptr);
+}
+
+// ============================================================================
+// Generated table
+// ============================================================================
+
+void test_db_sortedAndNonEmpty(void) {
+    TEST_ASSERT_TRUE(OUI_DB_COUNT > 0);
+    TEST_ASSERT_TRUE(OuiLookup::isSorted(OUI_DB_KEYS, OUI_DB_COUNT));
+}
+
+void test_db_namePoolWellFormed(void) {
+    for (uint32_t i = 0; i < OUI_DB_NAME_COUNT; i++) {
+        const char* name = OUI_DB_NAMES + OUI_DB_NAME_OFF[i];
+        size_t len = strlen(name);
+        TEST_ASSERT_TRUE(len > 0 && len <= 9);
+        if (i > 0) {
+            // Deduplicated and sorted by the generator
+            TEST_ASSERT_TRUE(strcmp(OUI_DB_NAMES + OUI_DB_NAME_OFF[i - 1], name) < 0);
+        }
+    }
+    for (uint32_t i = 0; i < OUI_DB_COUNT; i++) {
+        TEST_ASSERT_TRUE(OUI_DB_VENDOR[i] < OUI_DB_NAME_COUNT);
+    }
+}
+
+void test_db_knownVendors(void) {
+    TEST_ASSERT_EQUAL_STRING("Apple", vendorFor(0x00, 0x03, 0x93));
+    TEST_ASSERT_EQUAL_STRING("Espressif", vendorFor(0x24, 0x0A, 0xC4));
+    TEST_ASSERT_EQUAL_STRING("Espressif", vendorFor(0xFC, 0xF5, 0xC4));
+    TEST_ASSERT_EQUAL_STRING("Amazon", vendorFor(0xFC, 0x65, 0xDE));
+}
+
+void test_db_unknownAndRandom(void) {
+    TEST_ASSERT_EQUAL_STRING("UNKNOWN", vendorFor(0x00, 0x00, 0x01));
+    TEST_ASSERT_EQUAL_STRING("UNKNOWN", vendorFor(0xFC, 0xFF, 0xFF));
+    // Locally administered bit wins even over a listed prefix
+    TEST_ASSERT_EQUAL_STRING("RANDOM", vendorFor(0x02, 0x03, 0x93));
+    TEST_ASSERT_EQUAL_STRING("RANDOM", vendorFor(0xDA, 0xA1, 0x19));
+}
+
+// ============================================================================
+// Binary search
+// ============================================================================
+
+static const uint8_t kSmallKeys[] = {
+    0x00, 0x00, 0x10,
+    0x00, 0x01, 0x00,
+    0x12, 0x34, 0x56,
+    0xFF, 0xFF, 0xFE,
+};
+
+void test_find_hitsEveryEntry(void) {
+    for (uint32_t i = 0; i < 4; i++) {
+        TEST_ASSERT_EQUAL_INT32((int32_t)i, OuiLookup::find(kSmallKeys, 4, OuiLookup::keyAt(kSmallKeys, i)));
+    }
+    for (uint32_t i = 0; i < OUI_DB_COUNT; i++) {
+        TEST_ASSERT_EQUAL_INT32((int32_t)i, OuiLookup::find(OUI_DB_KEYS, OUI_DB_COUNT, OuiLookup::keyAt(OUI_DB_KEYS, i)));
+    }
+}
+
+void test_find_missesBetweenAndOutside(void) {
+    TEST_ASSERT_EQUAL_INT32(-1, OuiLookup::find(kSmallKeys, 4, 0x000000));
+    TEST_ASSERT_EQUAL_INT32(-1, OuiLookup::find(kSmallKeys, 4, 0x000011));
+    TEST_ASSERT_EQUAL_INT32(-1, OuiLookup::find(kSmallKeys, 4, 0x123455));
+    TEST_ASSERT_EQUAL_INT32(-1, OuiLookup::find(kSmallKeys, 4, 0xFFFFFF));
+    TEST_ASSERT_EQUAL_INT32(-1, OuiLookup::find(kSmallKeys, 0, 0x000010));
+}
+
+void test_isSorted_rejectsDuplicatesAndDisorder(void) {
+    static const uint8_t dup[] = {0x00, 0x00, 0x01, 0x00, 0x00, 0x01};
+    static const uint8_t rev[] = {0x00, 0x00, 0x02, 0x00, 0x00, 0x01};
+    TEST_ASSERT_TRUE(OuiLookup::isSorted(kSmallKeys, 4));
+    TEST_ASSERT_FALSE(OuiLookup::isSorted(dup, 2));
+    TEST_ASSERT_FALSE(OuiLookup::isSorted(rev, 2));
+}
+
+// ============================================================================
+// LRU cache
+// ============================================================================
+
+void test_lru_hitAfterInsert(void) {
+    OuiLookup::LruCache<4> cache;
+    uint16_t v = 0;
+    TEST_ASSERT_FALSE(cache.lookup(0x000393, v));
+    cache.insert(0x000393, 7);
+    TEST_ASSERT_TRUE(cache.lookup(0x000393, v));
+    TEST_ASSERT_EQUAL_UINT16(7, v);
+    TEST_ASSERT_EQUAL_UINT32(1, cache.hits());
+    TEST_ASSERT_EQUAL_UINT32(1, cache.misses());
+}
+
+void test_lru_evictsLeastRecentlyUsed(void) {
+    OuiLookup::LruCache<3> cache;
+    uint16_t v;
+    cache.insert(1, 10);
+    cache.insert(2, 20);
+    cache.insert(3, 30);
+    TEST_ASSERT_TRUE(cache.lookup(1, v));   // 1 is now most recent; 2 is oldest
+    cache.insert(4, 40);
+    TEST_ASSERT_EQUAL_UINT8(3, cache.size());
+    TEST_ASSERT_FALSE(cache.lookup(2, v));
+    TEST_ASSERT_TRUE(cache.lookup(1, v));
+    TEST_ASSERT_EQUAL_UINT16(10, v);
+    TEST_ASSERT_TRUE(cache.lookup(3, v));
+    TEST_ASSERT_TRUE(cache.lookup(4, v));
+    TEST_ASSERT_EQUAL_UINT16(40, v);
+}
+
+void test_lru_cachesMisses(void) {
+    OuiLookup::LruCache<8> cache;
+    const uint8_t mac[6] = {0x00, 0x00, 0x01, 0xAA, 0xBB, 0xCC};
+    TEST_ASSERT_EQUAL_STRING("UNKNOWN", vendorFor(mac, &cache));
+    TEST_ASSERT_EQUAL_STRING("UNKNOWN", vendorFor(mac, &cache));
+    TEST_ASSERT_EQUAL_UINT32(1, cache.hits());
+    uint16_t v;
+    TEST_ASSERT_TRUE(cache.lookup(0x000001, v));
+    TEST_ASSERT_EQUAL_UINT16(kNoVendor, v);
+}
+
+void test_lru_cachedAnswersMatchTable(void) {
+    OuiLookup::LruCache<8> cache;
+    std::mt19937 rng(42);
+    for (int i = 0; i < 5000; i++) {
+        uint8_t mac[6];
+        uint32_t pick = rng() % (OUI_DB_COUNT + 16);
+        uint32_t key = pick < OUI_DB_COUNT ? OuiLookup::keyAt(OUI_DB_KEYS, pick) : (rng() & 0xFCFFFF);
+        mac[0] = key >> 16; mac[1] = key >> 8; mac[2] = key;
+        TEST_ASSERT_EQUAL_STRING(vendorFor(mac, nullptr), vendorFor(mac, &cache));
+    }
+}
+
+// ============================================================================
+// Benchmark
+// ============================================================================
+
+// The pre-generator layout: unsorted 3-byte prefix + inline 10-char name,
+// scanned front to back and copied into a static buffer
+struct LegacyEntry {
+    uint8_t oui[3];
+    char vendor[10];
+};
+
+static const char* legacyScan(const std::vector<LegacyEntry>& table, const uint8_t* mac) {
+    static char vendorBuf[10];
+    if (mac[0] & 0x02) return "RANDOM";
+    for (size_t i = 0; i < table.size(); i++) {
+        if (mac[0] == table[i].oui[0] && mac[1] == table[i].oui[1] && mac[2] == table[i].oui[2]) {
+            strncpy(vendorBuf, table[i].vendor, sizeof(vendorBuf) - 1);
+            vendorBuf[sizeof(vendorBuf) - 1] = '\0';
+            return vendorBuf;
+        }
+    }
+    return "UNKNOWN";
+}
+
+// Client monitor traffic: a few dozen devices seen over and over, some
+// unknown vendors and randomized MACs mixed in
+static std::vector<std::array<uint8_t, 6>> clientStream(const uint8_t* keys, uint32_t count, size_t n) {
+    std::mt19937 rng(1234);
+    std::vector<std::array<uint8_t, 6>> devices;
+    for (int i = 0; i < 40; i++) {
+        std::array<uint8_t, 6> mac{};
+        uint32_t key;
+        int kind = i % 5;
+        if (kind < 3) {
+            key = OuiLookup::keyAt(keys, rng() % count);
+        } else if (kind == 3) {
+            key = (rng() & 0xFCFFFF) | 0x010000;  // Probably unlisted, never LAA
+        } else {
+            key = (rng() & 0xFFFFFF) | 0x020000;  // Randomized
+        }
+        mac[0] = key >> 16; mac[1] = key >> 8; mac[2] = key;
+        mac[5] = (uint8_t)i;
+        devices.push_back(mac);
+    }
+    std::vector<std::array<uint8_t, 6>> stream;
+    stream.reserve(n);
+    for (size_t i = 0; i < n; i++) stream.push_back(devices[rng() % devices.size()]);
+    return stream;
+}
+
+template <typename F>
+static double nsPerLookup(const std::vector<std::array<uint8_t, 6>>& stream, int rounds, F fn) {
+    using Clock = std::chrono::steady_clock;
+    volatile uintptr_t sink = 0;
+    auto t0 = Clock::now();
+    for (int r = 0; r < rounds; r++) {
+        for (const auto& mac : stream) sink = sink + (uintptr_t)fn(mac.data());
+    }
+    double ns = (double)std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - t0).count();
+    (void)sink;
+    return ns / ((double)stream.size() * rounds);
+}
+
+static void benchTable(const char* label, const uint8_t* keys, const uint16_t* ids, uint32_t count) {
+    // Legacy table in shuffled order, as the hand-written one was grouped by vendor
+    std::vector<LegacyEntry> legacy(count);
+    for (uint32_t i = 0; i < count; i++) {
+        memcpy(legacy[i].oui, keys + i * 3, 3);
+        snprintf(legacy[i].vendor, sizeof(legacy[i].vendor), "V%u", (unsigned)ids[i]);
+    }
+    std::shuffle(legacy.begin(), legacy.end(), std::mt19937(7));
+
+    auto stream = clientStream(keys, count, 20000);
+    OuiLookup::LruCache<8> cache;
+
+    double linear = nsPerLookup(stream, 5, [&](const uint8_t* mac) { return legacyScan(legacy, mac); });
+    double binary = nsPerLookup(stream, 5, [&](const uint8_t* mac) -> const char* {
+        if (mac[0] & 0x02) return "RANDOM";
+        int32_t idx = OuiLookup::find(keys, count, OuiLookup::keyFromMac(mac));
+        return idx < 0 ? "UNKNOWN" : (const char*)(uintptr_t)ids[idx];
+    });
+    double cached = nsPerLookup(stream, 5, [&](const uint8_t* mac) -> const char* {
+        if (mac[0] & 0x02) return "RANDOM";
+        uint32_t key = OuiLookup::keyFromMac(mac);
+        uint16_t v;
+        if (!cache.lookup(key, v)) {
+            int32_t idx = OuiLookup::find(keys, count, key);
+            v = idx < 0 ? kNoVendor : ids[idx];
+            cache.insert(key, v);
+        }
+        return (const char*)(uintptr_t)v;
+    });
+
+    printf("[OUI] %s (%u prefixes): linear %.1f ns, binary %.1f ns, binary+LRU8 %.1f ns (hit %.0f%%)\n",
+           label, (unsigned)count, linear, binary, cached,
+           100.0 * cache.hits() / (double)(cache.hits() + cache.misses()));
+
+    // Both paths must agree on every lookup in the stream
+    for (const auto& mac : stream) {
+        if (mac[0] & 0x02) continue;
+        const char* old = legacyScan(legacy, mac.data());
+        int32_t idx = OuiLookup::find(keys, count, OuiLookup::keyFromMac(mac.data()));
+        if (idx < 0) {
+            TEST_ASSERT_EQUAL_STRING("UNKNOWN", old);
+        } else {
+            char expect[10];
+            snprintf(expect, sizeof(expect), "V%u", (unsigned)ids[idx]);
+            TEST_ASSERT_EQUAL_STRING(expect, old);
+        }
+    }
+}
+
+void test_bench_generatedTable(void) {
+    benchTable("generated", OUI_DB_KEYS, OUI_DB_VENDOR, OUI_DB_COUNT);
+}
+
+void test_bench_ieeeSizedTable(void) {
+    // Full MA-L registry is ~38k prefixes; synthesise one that size
+    const uint32_t count = 38000;
+    std::mt19937 rng(99);
+    std::vector<uint32_t> all;
+    all.reserve(count * 2);
+    while (all.size() < count * 2) all.push_back(rng() & 0xFCFFFF);
+    std::sort(all.begin(), all.end());
+    all.erase(std::unique(all.begin(), all.end()), all.end());
+    all.resize(count);
+
+    std::vector<uint8_t> keys(count * 3);
+    std::vector<uint16_t> ids(count);
+    for (uint32_t i = 0; i < count; i++) {
+        keys[i * 3] = all[i] >> 16;
+        keys[i * 3 + 1] = all[i] >> 8;
+        keys[i * 3 + 2] = all[i];
+        ids[i] = (uint16_t)(rng() % 20000);
+    }
+    TEST_ASSERT_TRUE(OuiLookup::isSorted(keys.data(), count));
+    benchTable("IEEE-sized", keys.data(), ids.data(), count);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+
+    // Generated table
+    RUN_TEST(test_db_sortedAndNonEmpty);
+    RUN_TEST(test_db_namePoolWellFormed);
+    RUN_TEST(test_db_knownVendors);
+    RUN_TEST(test_db_unknownAndRandom);
+
+    // Binary search
+    RUN_TEST(test_find_hitsEveryEntry);
+    RUN_TEST(test_find_missesBetweenAndOutside);
+    RUN_TEST(test_isSorted_rejectsDuplicatesAndDisorder);
+
+    // LRU cache
+    RUN_TEST(test_lru_hitAfterInsert);
+    RUN_TEST(test_lru_evictsLeastRecentlyUsed);
+    RUN_TEST(test_lru_cachesMisses);
+    RUN_TEST(test_lru_cachedAnswersMatchTable);
+
+    // Benchmark
+    RUN_TEST(test_bench_generatedTable);
+    RUN_TEST(test_bench_ieeeSizedTable);
+
+    return UNITY_END();
+}
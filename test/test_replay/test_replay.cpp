@@ -0,0 +1,1044 @@
+// Capture Replay Harness + Hot-Path Benchmark
+// Reads pcap/pcapng (802.11 or radiotap link type), wraps every frame in a
+// wifi_promiscuous_pkt_t exactly like the driver hands it over (sig_len
+// includes 4 ghost FCS bytes) and replays it at full speed through the
+// recon / OINK / DNH / SPECTRUM callback paths.
+//
+// Each mode callback hands the packet to FrameDispatch (length checks, type
+// routing, IE parsing, EAPOL-Key decoding) and only keeps the bookkeeping
+// for itself. The harness calls the same FrameDispatch functions; its sinks
+// stand in for the mode tables, which pull in M5/SD/WiFi. BssidIndex,
+// MpscRing and the Pcapng writer (used to build the synthetic capture) are
+// the production code too.
+//
+// Replay your own capture:
+//   PORKCHOP_REPLAY_PCAP=/path/to/file.pcapng pio test -e native -f test_replay
+
+#include <unity.h>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#include "../mocks/mock_esp_wifi.h"
+#include "../../src/core/ie_parser.h"
+#include "../../src/core/eapol_parser.h"
+#include "../../src/core/frame_dispatch.h"
+#include "../../src/core/bssid_index.h"
+#include "../../src/core/mpsc_ring.h"
+#include "../../src/core/pcapng.h"
+
+void setUp(void) {}
+void tearDown(void) {}
+
+// ============================================================================
+// Capture reader (pcap + pcapng, LINKTYPE 105 / 127)
+// ============================================================================
+
+static const uint16_t kLinkType80211 = 105;
+static const uint16_t kLinkTypeRadiotap = 127;
+static const uint16_t kMaxFrameLen = 2500;  // Matches the driver's buffer
+
+struct ReplayFrame {
+    std::vector<uint8_t> data;   // 802.11 frame, no FCS
+    int8_t rssi;
+    uint8_t channel;
+};
+
+struct CaptureInfo {
+    uint32_t frames;
+    uint32_t skipped;            // Unsupported link type / oversized / runt
+};
+
+static uint16_t rd16(const uint8_t* p, bool swap) {
+    return swap ? (uint16_t)((p[0] << 8) | p[1]) : (uint16_t)(p[0] | (p[1] << 8));
+}
+
+static uint32_t rd32(const uint8_t* p, bool swap) {
+    return swap ? ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3]
+                : (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static uint16_t freqToChannel(uint16_t mhz) {
+    if (mhz == 2484) return 14;
+    if (mhz >= 2412 && mhz <= 2472) return (uint16_t)((mhz - 2407) / 5);
+    if (mhz >= 5000 && mhz <= 5900) return (uint16_t)((mhz - 5000) / 5);
+    return 0;
+}
+
+// Strip a radiotap header, pulling channel + antenna signal if present.
+// Walks the first present word only (fields 0-5); that covers what the
+// ESP32 and common monitor-mode drivers emit before the signal field.
+static bool stripRadiotap(const uint8_t* p, uint32_t len, ReplayFrame& out) {
+    if (len < 8 || p[0] != 0) return false;
+    uint16_t rtLen = (uint16_t)(p[2] | (p[3] << 8));
+    if (rtLen < 8 || rtLen > len) return false;
+
+    uint32_t present = rd32(p + 4, false);
+    uint32_t off = 8;
+    uint32_t word = present;
+    while ((word & 0x80000000u) && off + 4 <= rtLen) {  // Extended present bitmaps
+        word = rd32(p + off, false);
+        off += 4;
+    }
+
+    bool hasFcs = false;
+    auto align = [&](uint32_t a) { off = (off + a - 1) & ~(a - 1); };
+    if (present & (1u << 0)) { align(8); off += 8; }                      // TSFT
+    if (present & (1u << 1)) { if (off < rtLen) hasFcs = p[off] & 0x10; off += 1; }  // Flags
+    if (present & (1u << 2)) { off += 1; }                                // Rate
+    if (present & (1u << 3)) {                                            // Channel
+        align(2);
+        if (off + 4 <= rtLen) out.channel = (uint8_t)freqToChannel(rd16(p + off, false));
+        off += 4;
+    }
+    if (present & (1u << 4)) { off += 2; }                                // FHSS
+    if (present & (1u << 5)) {                                            // dBm antenna signal
+        if (off < rtLen) out.rssi = (int8_t)p[off];
+    }
+
+    uint32_t frameLen = len - rtLen;
+    if (hasFcs && frameLen >= 4) frameLen -= 4;
+    out.data.assign(p + rtLen, p + rtLen + frameLen);
+    return true;
+}
+
+static void addFrame(uint16_t linkType, const uint8_t* p, uint32_t len,
+                     std::vector<ReplayFrame>& out, CaptureInfo& info) {
+    ReplayFrame f;
+    f.rssi = -60;
+    f.channel = 0;
+    bool ok = false;
+    if (linkType == kLinkTypeRadiotap) {
+        ok = stripRadiotap(p, len, f);
+    } else if (linkType == kLinkType80211) {
+        f.data.assign(p, p + len);
+        ok = true;
+    }
+    if (!ok || f.data.size() < 10 || f.data.size() > kMaxFrameLen) {
+        info.skipped++;
+        return;
+    }
+    out.push_back(std::move(f));
+    info.frames++;
+}
+
+static bool readPcap(const std::vector<uint8_t>& file, std::vector<ReplayFrame>& out, CaptureInfo& info) {
+    if (file.size() < 24) return false;
+    uint32_t magic = rd32(file.data(), false);
+    bool swap;
+    if (magic == 0xA1B2C3D4u || magic == 0xA1B23C4Du) swap = false;
+    else if (magic == 0xD4C3B2A1u || magic == 0x4D3CB2A1u) swap = true;
+    else return false;
+
+    uint16_t linkType = (uint16_t)rd32(file.data() + 20, swap);
+    size_t pos = 24;
+    while (pos + 16 <= file.size()) {
+        uint32_t incl = rd32(file.data() + pos + 8, swap);
+        pos += 16;
+        if (pos + incl > file.size()) return false;  // Truncated record
+        addFrame(linkType, file.data() + pos, incl, out, info);
+        pos += incl;
+    }
+    return true;
+}
+
+static bool readPcapng(const std::vector<uint8_t>& file, std::vector<ReplayFrame>& out, CaptureInfo& info) {
+    std::vector<uint16_t> ifLinkTypes;
+    bool swap = false;
+    size_t pos = 0;
+    while (pos + 12 <= file.size()) {
+        const uint8_t* b = file.data() + pos;
+        uint32_t type = rd32(b, false);
+        if (type == Pcapng::kBlockSHB) {
+            uint32_t bom = rd32(b + 8, false);
+            if (bom == Pcapng::kByteOrderMagic) swap = false;
+            else if (bom == 0x4D3C2B1Au) swap = true;
+            else return false;
+            ifLinkTypes.clear();  // New section, new interface list
+        } else {
+            type = rd32(b, swap);
+        }
+        uint32_t blockLen = rd32(b + 4, swap);
+        if (blockLen < 12 || (blockLen & 3) || pos + blockLen > file.size()) return false;
+
+        if (type == Pcapng::kBlockIDB && blockLen >= 20) {
+            ifLinkTypes.push_back(rd16(b + 8, swap));
+        } else if (type == Pcapng::kBlockEPB && blockLen >= Pcapng::kEPBOverhead) {
+            uint32_t ifId = rd32(b + 8, swap);
+            uint32_t capLen = rd32(b + 20, swap);
+            if (ifId < ifLinkTypes.size() && 28 + capLen <= blockLen) {
+                addFrame(ifLinkTypes[ifId], b + 28, capLen, out, info);
+            } else {
+                info.skipped++;
+            }
+        } else if (type == 3 && blockLen >= 16 && !ifLinkTypes.empty()) {  // Simple Packet Block
+            addFrame(ifLinkTypes[0], b + 12, blockLen - 16, out, info);
+        }
+        pos += blockLen;
+    }
+    return pos == file.size();
+}
+
+static bool readCapture(const std::vector<uint8_t>& file, std::vector<ReplayFrame>& out, CaptureInfo& info) {
+    memset(&info, 0, sizeof(info));
+    out.clear();
+    if (file.size() >= 4 && rd32(file.data(), false) == Pcapng::kBlockSHB) {
+        return readPcapng(file, out, info);
+    }
+    return readPcap(file, out, info);
+}
+
+static bool loadFile(const char* path, std::vector<uint8_t>& out) {
+    FILE* f = fopen(path, "rb");
+    if (!f) return false;
+    uint8_t buf[4096];
+    size_t n;
+    out.clear();
+    while ((n = fread(buf, 1, sizeof(buf), f)) > 0) out.insert(out.end(), buf, buf + n);
+    fclose(f);
+    return true;
+}
+
+// ============================================================================
+// Driver packet wrapping
+// ============================================================================
+
+// One pre-wrapped packet: rx_ctrl + payload, as the promiscuous callback sees it
+struct WrappedPacket {
+    std::vector<uint8_t> buf;
+    wifi_promiscuous_pkt_type_t type;
+
+    const wifi_promiscuous_pkt_t* pkt() const {
+        return reinterpret_cast<const wifi_promiscuous_pkt_t*>(buf.data());
+    }
+};
+
+static wifi_promiscuous_pkt_type_t classify(const uint8_t* frame) {
+    switch ((frame[0] >> 2) & 0x03) {
+        case 0: return WIFI_PKT_MGMT;
+        case 1: return WIFI_PKT_CTRL;
+        case 2: return WIFI_PKT_DATA;
+        default: return WIFI_PKT_MISC;
+    }
+}
+
+static void wrapFrame(const ReplayFrame& f, WrappedPacket& out) {
+    out.buf.assign(sizeof(wifi_promiscuous_pkt_t) + f.data.size() + 4, 0);
+    wifi_promiscuous_pkt_t* pkt = reinterpret_cast<wifi_promiscuous_pkt_t*>(out.buf.data());
+    pkt->rx_ctrl.rssi = f.rssi;
+    pkt->rx_ctrl.channel = f.channel & 0x0F;
+    pkt->rx_ctrl.sig_len = (unsigned)(f.data.size() + 4);  // Driver counts the FCS
+    memcpy(pkt->payload, f.data.data(), f.data.size());
+    out.type = classify(f.data.data());
+}
+
+// ============================================================================
+// Sinks: each mode callback runs FrameDispatch with its own bookkeeping;
+// these keep just enough of it for the counts the tests check
+// ============================================================================
+
+static const uint16_t kMaxNetworks = 200;  // MAX_RECON_NETWORKS
+
+struct ReplayNet {
+    uint8_t bssid[6];
+    char ssid[33];
+    wifi_auth_mode_t authmode;
+    uint8_t channel;
+    int8_t rssi;
+    bool hasPMF;
+    uint16_t beaconCount;
+    uint32_t dataFrames;
+};
+
+// NetworkRecon: new networks queued for update(), known ones updated in place
+struct ReconSink {
+    std::vector<ReplayNet> table;
+    BssidIndex<512> index;
+    MpscRing<ReplayNet, 32> pending;
+
+    void reset() {
+        table.clear();
+        table.reserve(kMaxNetworks);
+        index.clear();
+        pending.reset();
+    }
+
+    int find(const uint8_t* bssid) const {
+        return index.find(bssid, [this](uint16_t slot) { return table[slot].bssid; });
+    }
+
+    void beacon(const FrameDispatch::Beacon& b, int8_t rssi) {
+        int idx = find(b.bssid);
+        if (idx >= 0) {
+            ReplayNet& n = table[idx];
+            n.rssi = rssi;
+            if (!b.probeResponse) n.beaconCount++;
+            if (n.ssid[0] == 0 && b.info.ssidPresent && !b.info.hidden) b.info.copySSID(n.ssid);
+            return;
+        }
+        if (b.probeResponse) return;   // Recon only reveals SSIDs of known APs
+        pending.emplace([&](ReplayNet& n) {
+            memcpy(n.bssid, b.bssid, 6);
+            b.info.copySSID(n.ssid);
+            n.authmode = IEParser::authMode(b.info);
+            n.channel = b.info.dsChannel;
+            n.rssi = rssi;
+            n.hasPMF = b.info.hasPMF();
+            n.beaconCount = 1;
+            n.dataFrames = 0;
+        });
+    }
+
+    void ssidSeen(const uint8_t* bssid, const IEParser::BeaconInfo& info) {
+        int idx = find(bssid);
+        if (idx >= 0 && table[idx].ssid[0] == 0) info.copySSID(table[idx].ssid);
+    }
+
+    void dataActivity(const uint8_t* bssid, const uint8_t* client, int8_t rssi) {
+        (void)client;
+        (void)rssi;
+        int idx = find(bssid);
+        if (idx >= 0) table[idx].dataFrames++;
+    }
+
+    void callback(const wifi_promiscuous_pkt_t* pkt, wifi_promiscuous_pkt_type_t type) {
+        FrameDispatch::recon(pkt, type, *this);
+    }
+
+    void update() {
+        ReplayNet n;
+        while (pending.pop(n)) {
+            if (find(n.bssid) >= 0 || table.size() >= kMaxNetworks) continue;
+            table.push_back(n);
+            index.insert(n.bssid, (uint16_t)(table.size() - 1));
+        }
+    }
+};
+
+struct ReplayHandshake {
+    uint8_t bssid[6];
+    uint8_t station[6];
+    uint8_t mask;
+    bool complete() const {
+        return ((mask & 0x03) == 0x03) || ((mask & 0x06) == 0x06);  // M1+M2 or M2+M3
+    }
+};
+
+struct ReplayPmkid {
+    uint8_t bssid[6];
+    uint8_t station[6];
+    uint8_t pmkid[16];
+};
+
+template <typename T>
+static int findPair(const std::vector<T>& v, const uint8_t* bssid, const uint8_t* station) {
+    for (size_t i = 0; i < v.size(); i++) {
+        if (memcmp(v[i].bssid, bssid, 6) == 0 && memcmp(v[i].station, station, 6) == 0) {
+            return (int)i;
+        }
+    }
+    return -1;
+}
+
+static void recordFrame(std::vector<ReplayHandshake>& hs, const FrameDispatch::EapolKey& k) {
+    int idx = findPair(hs, k.bssid, k.station);
+    if (idx < 0) {
+        ReplayHandshake h = {};
+        memcpy(h.bssid, k.bssid, 6);
+        memcpy(h.station, k.station, 6);
+        hs.push_back(h);
+        idx = (int)hs.size() - 1;
+    }
+    hs[idx].mask |= (uint8_t)(1 << (k.messageNum - 1));
+}
+
+static void recordPmkid(std::vector<ReplayPmkid>& pmkids, const uint8_t* bssid,
+                        const uint8_t* station, const uint8_t* pmkid) {
+    if (findPair(pmkids, bssid, station) >= 0) return;
+    ReplayPmkid p;
+    memcpy(p.bssid, bssid, 6);
+    memcpy(p.station, station, 6);
+    memcpy(p.pmkid, pmkid, 16);
+    pmkids.push_back(p);
+}
+
+// OINK: PMKIDs and frames recorded straight from the callback
+struct OinkSink {
+    std::vector<ReplayHandshake> handshakes;
+    std::vector<ReplayPmkid> pmkids;
+    uint32_t beacons;
+
+    void reset() { handshakes.clear(); pmkids.clear(); beacons = 0; }
+
+    void beacon(const uint8_t* frame, uint16_t len, int8_t rssi) {
+        (void)frame;
+        (void)len;
+        (void)rssi;
+        beacons++;
+    }
+    void client(const uint8_t* bssid, const uint8_t* clientMac, int8_t rssi) {
+        (void)bssid;
+        (void)clientMac;
+        (void)rssi;
+    }
+    void eapol(const FrameDispatch::EapolKey& k, const uint8_t* frame, uint16_t len, int8_t rssi) {
+        (void)frame;
+        (void)len;
+        (void)rssi;
+        if (k.pmkid) recordPmkid(pmkids, k.bssid, k.station, k.pmkid);
+        recordFrame(handshakes, k);
+    }
+
+    void callback(const wifi_promiscuous_pkt_t* pkt, wifi_promiscuous_pkt_type_t type) {
+        FrameDispatch::oink(pkt, type, *this);
+    }
+    void update() {}
+};
+
+// DNH: PMKIDs queued through the event ring for update()
+struct DnhSink {
+    std::vector<ReplayHandshake> handshakes;
+    std::vector<ReplayPmkid> pmkids;
+    MpscRing<ReplayPmkid, 8> pendingPmkids;
+
+    void reset() { handshakes.clear(); pmkids.clear(); pendingPmkids.reset(); }
+
+    void beacon(const FrameDispatch::Beacon& b, int8_t rssi) {
+        (void)b;
+        (void)rssi;
+    }
+    void eapol(const FrameDispatch::EapolKey& k, const uint8_t* frame, uint16_t len, int8_t rssi) {
+        (void)frame;
+        (void)len;
+        (void)rssi;
+        if (k.pmkid) {
+            pendingPmkids.emplace([&](ReplayPmkid& p) {
+                memcpy(p.bssid, k.bssid, 6);
+                memcpy(p.station, k.station, 6);
+                memcpy(p.pmkid, k.pmkid, 16);
+            });
+        }
+        recordFrame(handshakes, k);
+    }
+
+    void callback(const wifi_promiscuous_pkt_t* pkt, wifi_promiscuous_pkt_type_t type) {
+        FrameDispatch::dnh(pkt, type, *this);
+    }
+    void update() {
+        ReplayPmkid p;
+        while (pendingPmkids.pop(p)) recordPmkid(pmkids, p.bssid, p.station, p.pmkid);
+    }
+};
+
+// SPECTRUM: per-channel activity + its own network table
+struct SpectrumSink {
+    std::vector<ReplayNet> nets;
+    BssidIndex<512> index;
+    uint32_t channelHits[15];
+
+    void reset() {
+        nets.clear();
+        index.clear();
+        memset(channelHits, 0, sizeof(channelHits));
+    }
+
+    void activity(uint8_t channel, int8_t rssi) {
+        (void)rssi;
+        if (channel >= 1 && channel <= 14) channelHits[channel]++;
+    }
+    void data(const uint8_t* frame, uint16_t len, int8_t rssi) {
+        (void)frame;
+        (void)len;
+        (void)rssi;
+    }
+    void beacon(const FrameDispatch::Beacon& b, uint8_t channel, bool channelTrusted, int8_t rssi) {
+        (void)channelTrusted;
+        int idx = index.find(b.bssid, [this](uint16_t slot) { return nets[slot].bssid; });
+        if (idx >= 0) {
+            nets[idx].rssi = rssi;
+            nets[idx].beaconCount++;
+            return;
+        }
+        if (nets.size() >= kMaxNetworks) return;
+        ReplayNet n = {};
+        memcpy(n.bssid, b.bssid, 6);
+        b.info.copySSID(n.ssid);
+        n.authmode = IEParser::authMode(b.info);
+        n.hasPMF = b.info.hasPMF();
+        n.channel = channel;
+        nets.push_back(n);
+        index.insert(b.bssid, (uint16_t)(nets.size() - 1));
+    }
+
+    void callback(const wifi_promiscuous_pkt_t* pkt, wifi_promiscuous_pkt_type_t type) {
+        FrameDispatch::spectrum(pkt, type, pkt->rx_ctrl.channel, *this);
+    }
+    void update() {}
+};
+
+// ============================================================================
+// Replay engine
+// ============================================================================
+
+enum { H_RECON = 0, H_OINK, H_DNH, H_SPECTRUM, H_COUNT };
+static const char* kHandlerNames[H_COUNT] = { "recon", "oink", "dnh", "spectrum" };
+
+struct ReplayStats {
+    uint32_t frames;
+    uint32_t networks;
+    uint32_t handshakesOink;
+    uint32_t completeOink;
+    uint32_t pmkidsOink;
+    uint32_t completeDnh;
+    uint32_t pmkidsDnh;
+    uint32_t spectrumNets;
+    uint32_t reconDropped;
+    double handlerNs[H_COUNT];
+    double totalNs;
+};
+
+static ReconSink recon;
+static OinkSink oink;
+static DnhSink dnh;
+static SpectrumSink spectrum;
+
+// Main loop runs update() every kUpdateEvery frames (~1 ms of busy air)
+static const uint32_t kUpdateEvery = 32;
+
+static void replay(const std::vector<WrappedPacket>& pkts, uint32_t iterations, ReplayStats& st) {
+    using Clock = std::chrono::steady_clock;
+    memset(&st, 0, sizeof(st));
+    uint64_t ns[H_COUNT] = {0};
+    Clock::time_point total0 = Clock::now();
+
+    for (uint32_t it = 0; it < iterations; it++) {
+        recon.reset();
+        oink.reset();
+        dnh.reset();
+        spectrum.reset();
+        uint32_t n = 0;
+        for (const WrappedPacket& w : pkts) {
+            const wifi_promiscuous_pkt_t* pkt = w.pkt();
+            Clock::time_point t0 = Clock::now();
+            recon.callback(pkt, w.type);
+            Clock::time_point t1 = Clock::now();
+            oink.callback(pkt, w.type);
+            Clock::time_point t2 = Clock::now();
+            dnh.callback(pkt, w.type);
+            Clock::time_point t3 = Clock::now();
+            spectrum.callback(pkt, w.type);
+            Clock::time_point t4 = Clock::now();
+            ns[H_RECON] += std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count();
+            ns[H_OINK] += std::chrono::duration_cast<std::chrono::nanoseconds>(t2 - t1).count();
+            ns[H_DNH] += std::chrono::duration_cast<std::chrono::nanoseconds>(t3 - t2).count();
+            ns[H_SPECTRUM] += std::chrono::duration_cast<std::chrono::nanoseconds>(t4 - t3).count();
+
+            if (++n % kUpdateEvery == 0) {
+                recon.update();
+                oink.update();
+                dnh.update();
+                spectrum.update();
+            }
+        }
+        recon.update();
+        oink.update();
+        dnh.update();
+        spectrum.update();
+        st.frames += n;
+    }
+
+    st.totalNs = (double)std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - total0).count();
+    for (int h = 0; h < H_COUNT; h++) st.handlerNs[h] = (double)ns[h];
+
+    st.networks = (uint32_t)recon.table.size();
+    st.reconDropped = recon.pending.dropped();
+    st.handshakesOink = (uint32_t)oink.handshakes.size();
+    for (const auto& h : oink.handshakes) st.completeOink += h.complete() ? 1 : 0;
+    st.pmkidsOink = (uint32_t)oink.pmkids.size();
+    for (const auto& h : dnh.handshakes) st.completeDnh += h.complete() ? 1 : 0;
+    st.pmkidsDnh = (uint32_t)dnh.pmkids.size();
+    st.spectrumNets = (uint32_t)spectrum.nets.size();
+}
+
+static void printStats(const char* label, const ReplayStats& st) {
+    double secs = st.totalNs / 1e9;
+    printf("[REPLAY] %s: %u frames in %.1f ms = %.0f frames/s\n", label,
+           (unsigned)st.frames, st.totalNs / 1e6, secs > 0 ? st.frames / secs : 0.0);
+    printf("[REPLAY]   networks=%u (queue drops %u) spectrum=%u\n",
+           (unsigned)st.networks, (unsigned)st.reconDropped, (unsigned)st.spectrumNets);
+    printf("[REPLAY]   oink: handshakes=%u complete=%u pmkids=%u | dnh: complete=%u pmkids=%u\n",
+           (unsigned)st.handshakesOink, (unsigned)st.completeOink, (unsigned)st.pmkidsOink,
+           (unsigned)st.completeDnh, (unsigned)st.pmkidsDnh);
+    for (int h = 0; h < H_COUNT; h++) {
+        printf("[REPLAY]   %-8s %7.1f ns/frame\n", kHandlerNames[h],
+               st.frames ? st.handlerNs[h] / st.frames : 0.0);
+    }
+}
+
+// ============================================================================
+// Synthetic capture
+// ============================================================================
+
+enum SecKind { SEC_OPEN, SEC_WPA2, SEC_WPA3, SEC_WPA1 };
+
+static void makeMac(uint8_t* out, uint8_t kind, uint32_t i) {
+    out[0] = kind == 0 ? 0x64 : 0x3C;   // AP vs station OUI
+    out[1] = kind == 0 ? 0xEE : 0x22;
+    out[2] = kind == 0 ? 0xB7 : 0xFB;
+    out[3] = (uint8_t)(i >> 16);
+    out[4] = (uint8_t)(i >> 8);
+    out[5] = (uint8_t)i;
+}
+
+static std::vector<uint8_t> buildBeacon(const uint8_t* bssid, const char* ssid, uint8_t channel,
+                                        SecKind sec, bool probeResp) {
+    std::vector<uint8_t> f(36, 0);
+    f[0] = probeResp ? 0x50 : 0x80;
+    memset(&f[4], 0xFF, 6);
+    memcpy(&f[10], bssid, 6);
+    memcpy(&f[16], bssid, 6);
+    f[32] = 0x64;                       // Beacon interval 100 TU
+    f[34] = sec == SEC_OPEN ? 0x01 : 0x11;  // ESS (+ privacy)
+    uint8_t ssidLen = (uint8_t)strlen(ssid);
+    f.push_back(0); f.push_back(ssidLen);
+    f.insert(f.end(), ssid, ssid + ssidLen);
+    const uint8_t rates[] = { 1, 8, 0x82, 0x84, 0x8B, 0x96, 0x0C, 0x12, 0x18, 0x24 };
+    f.insert(f.end(), rates, rates + sizeof(rates));
+    f.push_back(3); f.push_back(1); f.push_back(channel);
+    if (sec == SEC_WPA2 || sec == SEC_WPA3) {
+        uint8_t akm = sec == SEC_WPA3 ? IEParser::kAkmSAE : IEParser::kAkmPSK;
+        uint8_t caps = sec == SEC_WPA3 ? 0xC0 : 0x00;  // MFPR|MFPC for WPA3
+        const uint8_t rsn[] = { 48, 20, 1, 0, 0x00, 0x0F, 0xAC, 4, 1, 0, 0x00, 0x0F, 0xAC, 4,
+                                1, 0, 0x00, 0x0F, 0xAC, akm, caps, 0 };
+        f.insert(f.end(), rsn, rsn + sizeof(rsn));
+    } else if (sec == SEC_WPA1) {
+        const uint8_t wpa[] = { 221, 22, 0x00, 0x50, 0xF2, 1, 1, 0, 0x00, 0x50, 0xF2, 2,
+                                1, 0, 0x00, 0x50, 0xF2, 2, 1, 0, 0x00, 0x50, 0xF2, 2 };
+        f.insert(f.end(), wpa, wpa + sizeof(wpa));
+    }
+    return f;
+}
+
+static const uint16_t kKeyInfoM1 = 0x008A;   // Pairwise | Ack, HMAC-SHA1/AES
+static const uint16_t kKeyInfoM2 = 0x010A;   // Pairwise | MIC
+static const uint16_t kKeyInfoM3 = 0x13CA;   // Pairwise | Install | Ack | MIC | Secure | Encrypted
+static const uint16_t kKeyInfoM4 = 0x030A;   // Pairwise | MIC | Secure
+
+static std::vector<uint8_t> buildEapolKey(const uint8_t* bssid, const uint8_t* station,
+                                          uint8_t messageNum, bool qos, bool htc,
+                                          const uint8_t* pmkid = nullptr,
+                                          uint8_t descriptor = EapolParser::kDescriptorRSN) {
+    static const uint16_t kInfo[5] = { 0, kKeyInfoM1, kKeyInfoM2, kKeyInfoM3, kKeyInfoM4 };
+    bool fromAp = (messageNum == 1 || messageNum == 3);
+    std::vector<uint8_t> f(24, 0);
+    f[0] = qos ? 0x88 : 0x08;
+    f[1] = (uint8_t)((fromAp ? 0x02 : 0x01) | (qos && htc ? 0x80 : 0x00));
+    memcpy(&f[4], fromAp ? station : bssid, 6);    // RA
+    memcpy(&f[10], fromAp ? bssid : station, 6);   // TA
+    memcpy(&f[16], bssid, 6);
+    if (qos) { f.push_back(0); f.push_back(0); }
+    if (qos && htc) f.insert(f.end(), 4, 0);
+    const uint8_t llc[] = { 0xAA, 0xAA, 0x03, 0x00, 0x00, 0x00, 0x88, 0x8E };
+    f.insert(f.end(), llc, llc + sizeof(llc));
+
+    uint16_t keyDataLen = pmkid ? EapolParser::kPmkidKdeLen : (messageNum == 2 || messageNum == 3 ? 22 : 0);
+    std::vector<uint8_t> e(EapolParser::kKeyDataOffset + keyDataLen, 0);
+    e[0] = 2;                                       // 802.1X-2004
+    e[1] = EapolParser::kTypeKey;
+    uint16_t bodyLen = (uint16_t)(e.size() - 4);
+    e[2] = (uint8_t)(bodyLen >> 8);
+    e[3] = (uint8_t)bodyLen;
+    e[4] = descriptor;
+    e[5] = (uint8_t)(kInfo[messageNum] >> 8);
+    e[6] = (uint8_t)kInfo[messageNum];
+    e[8] = 16;                                      // Key length
+    e[16] = messageNum;                             // Replay counter
+    for (int i = 0; i < 32; i++) e[17 + i] = (uint8_t)(messageNum * 31 + i);  // Nonce
+    if (messageNum != 1) for (int i = 0; i < 16; i++) e[81 + i] = (uint8_t)(0xA0 + i);  // MIC
+    e[97] = (uint8_t)(keyDataLen >> 8);
+    e[98] = (uint8_t)keyDataLen;
+    if (pmkid) {
+        const uint8_t kde[] = { 0xDD, 0x14, 0x00, 0x0F, 0xAC, 0x04 };
+        memcpy(&e[99], kde, sizeof(kde));
+        memcpy(&e[105], pmkid, 16);
+    } else if (keyDataLen) {
+        e[99] = 0x30;                               // RSN IE stub
+        e[100] = 20;
+    }
+    f.insert(f.end(), e.begin(), e.end());
+    return f;
+}
+
+static std::vector<uint8_t> buildDataNoise(const uint8_t* bssid, const uint8_t* station, uint32_t seq) {
+    std::vector<uint8_t> f(24, 0);
+    f[0] = 0x88;
+    f[1] = (seq & 1) ? 0x41 : 0x42;                 // Protected, alternating direction
+    memcpy(&f[4], (seq & 1) ? bssid : station, 6);
+    memcpy(&f[10], (seq & 1) ? station : bssid, 6);
+    memcpy(&f[16], bssid, 6);
+    f.push_back(0); f.push_back(0);
+    f.insert(f.end(), 8, 0x00);                     // CCMP header
+    for (uint32_t i = 0; i < 80 + (seq % 1200); i++) f.push_back((uint8_t)(seq * 7 + i));
+    return f;
+}
+
+// Expected results of the synthetic capture
+static const uint32_t kSynthAPs = 60;
+static const uint32_t kSynthHandshakes = 10;        // Full M1-M4 exchanges
+static const uint32_t kSynthPmkids = 4;             // Valid RSN PMKIDs
+static const uint32_t kSynthBeaconRounds = 20;
+
+struct SynthFrame {
+    std::vector<uint8_t> data;
+    int8_t rssi;
+    uint8_t channel;
+};
+
+static std::vector<SynthFrame> buildScenario() {
+    std::vector<SynthFrame> out;
+    uint8_t ap[6], sta[6];
+    auto add = [&](std::vector<uint8_t> f, int8_t rssi, uint8_t ch) {
+        out.push_back({ std::move(f), rssi, ch });
+    };
+
+    for (uint32_t round = 0; round < kSynthBeaconRounds; round++) {
+        for (uint32_t a = 0; a < kSynthAPs; a++) {
+            makeMac(ap, 0, a);
+            char ssid[33];
+            snprintf(ssid, sizeof(ssid), "PORK_NET_%02u", (unsigned)a);
+            uint8_t ch = (uint8_t)(1 + (a % 11));
+            SecKind sec = (SecKind)(a % 4);
+            add(buildBeacon(ap, ssid, ch, sec, false), (int8_t)(-40 - (int)(a % 50)), ch);
+            if (round == 0 && a % 3 == 0) add(buildBeacon(ap, ssid, ch, sec, true), -55, ch);
+
+            // Background traffic between beacons
+            makeMac(sta, 1, a);
+            for (uint32_t d = 0; d < 2; d++) {
+                add(buildDataNoise(ap, sta, round * 131 + a * 7 + d), -62, ch);
+            }
+        }
+
+        // Handshakes spread across the run, mixing QoS/HTC framing
+        if (round < kSynthHandshakes) {
+            makeMac(ap, 0, round * 2 + 1);          // WPA2 APs (a % 4 == 1)
+            makeMac(sta, 1, 1000 + round);
+            uint8_t ch = (uint8_t)(1 + ((round * 2 + 1) % 11));
+            bool qos = round % 2 == 0;
+            bool htc = round % 4 == 0;
+            for (uint8_t m = 1; m <= 4; m++) add(buildEapolKey(ap, sta, m, qos, htc), -58, ch);
+        }
+    }
+
+    // PMKID-bearing M1s from APs that never complete a handshake
+    for (uint32_t p = 0; p < kSynthPmkids; p++) {
+        makeMac(ap, 0, 40 + p * 4 + 1);
+        makeMac(sta, 1, 2000 + p);
+        uint8_t pmkid[16];
+        for (int i = 0; i < 16; i++) pmkid[i] = (uint8_t)(p * 16 + i + 1);
+        add(buildEapolKey(ap, sta, 1, p % 2 == 0, false, pmkid), -61, 6);
+    }
+
+    // Decoys: all-zero PMKID, WPA1 descriptor, and an M1 without a pair
+    uint8_t zero[16] = {0};
+    uint8_t junk[16];
+    memset(junk, 0x5A, sizeof(junk));
+    makeMac(ap, 0, 57);
+    makeMac(sta, 1, 3000);
+    add(buildEapolKey(ap, sta, 1, false, false, zero), -70, 3);
+    makeMac(sta, 1, 3001);
+    add(buildEapolKey(ap, sta, 1, false, false, junk, 0xFE), -70, 3);
+    return out;
+}
+
+static std::vector<uint8_t> writePcapng(const std::vector<SynthFrame>& frames) {
+    std::vector<uint8_t> file(256);
+    size_t used = Pcapng::writeSHB(file.data(), file.size());
+    used += Pcapng::writeIDB(file.data() + used, file.size() - used);
+    file.resize(used);
+    uint64_t ts = 1700000000ULL * 1000000ULL;
+    for (const SynthFrame& f : frames) {
+        uint32_t need = Pcapng::epbSize((uint16_t)f.data.size());
+        size_t at = file.size();
+        file.resize(at + need);
+        Pcapng::writeEPB(file.data() + at, need, ts, f.rssi, f.channel,
+                         f.data.data(), (uint16_t)f.data.size(), (uint16_t)f.data.size());
+        ts += 250;
+    }
+    return file;
+}
+
+static void putLE32(std::vector<uint8_t>& v, uint32_t x) {
+    for (int i = 0; i < 4; i++) v.push_back((uint8_t)(x >> (8 * i)));
+}
+
+// Classic pcap, LINKTYPE_IEEE802_11 (no radiotap), as exported by airodump
+static std::vector<uint8_t> writePcap(const std::vector<SynthFrame>& frames) {
+    std::vector<uint8_t> file;
+    putLE32(file, 0xA1B2C3D4u);
+    file.push_back(2); file.push_back(0); file.push_back(4); file.push_back(0);
+    putLE32(file, 0);
+    putLE32(file, 0);
+    putLE32(file, 65535);
+    putLE32(file, kLinkType80211);
+    uint32_t sec = 1700000000u;
+    for (const SynthFrame& f : frames) {
+        putLE32(file, sec);
+        putLE32(file, 0);
+        putLE32(file, (uint32_t)f.data.size());
+        putLE32(file, (uint32_t)f.data.size());
+        file.insert(file.end(), f.data.begin(), f.data.end());
+    }
+    return file;
+}
+
+static std::vector<WrappedPacket> wrapAll(const std::vector<ReplayFrame>& frames) {
+    std::vector<WrappedPacket> pkts(frames.size());
+    for (size_t i = 0; i < frames.size(); i++) wrapFrame(frames[i], pkts[i]);
+    return pkts;
+}
+
+// ============================================================================
+// Reader tests
+// ============================================================================
+
+void test_reader_pcapngRoundTrip(void) {
+    std::vector<SynthFrame> src = buildScenario();
+    std::vector<uint8_t> file = writePcapng(src);
+    std::vector<ReplayFrame> frames;
+    CaptureInfo info;
+    TEST_ASSERT_TRUE(readCapture(file, frames, info));
+    TEST_ASSERT_EQUAL_UINT32(src.size(), info.frames);
+    TEST_ASSERT_EQUAL_UINT32(0, info.skipped);
+    for (size_t i = 0; i < src.size(); i++) {
+        TEST_ASSERT_EQUAL_UINT32(src[i].data.size(), frames[i].data.size());
+        TEST_ASSERT_EQUAL_MEMORY(src[i].data.data(), frames[i].data.data(), src[i].data.size());
+        TEST_ASSERT_EQUAL_INT8(src[i].rssi, frames[i].rssi);
+        TEST_ASSERT_EQUAL_UINT8(src[i].channel, frames[i].channel);
+    }
+}
+
+void test_reader_classicPcapMatchesPcapng(void) {
+    std::vector<SynthFrame> src = buildScenario();
+    std::vector<ReplayFrame> a, b;
+    CaptureInfo ia, ib;
+    TEST_ASSERT_TRUE(readCapture(writePcapng(src), a, ia));
+    TEST_ASSERT_TRUE(readCapture(writePcap(src), b, ib));
+    TEST_ASSERT_EQUAL_UINT32(ia.frames, ib.frames);
+    for (size_t i = 0; i < a.size(); i++) {
+        TEST_ASSERT_TRUE(a[i].data == b[i].data);
+    }
+}
+
+void test_reader_rejectsGarbage(void) {
+    std::vector<uint8_t> junk(64, 0x42);
+    std::vector<ReplayFrame> frames;
+    CaptureInfo info;
+    TEST_ASSERT_FALSE(readCapture(junk, frames, info));
+
+    // Truncated pcapng block
+    std::vector<uint8_t> file = writePcapng(buildScenario());
+    file.resize(file.size() - 10);
+    TEST_ASSERT_FALSE(readCapture(file, frames, info));
+}
+
+void test_wrap_addsGhostBytesAndType(void) {
+    uint8_t bssid[6] = {0x64, 0xEE, 0xB7, 0, 0, 1};
+    uint8_t sta[6] = {0x3C, 0x22, 0xFB, 0, 0, 1};
+    ReplayFrame beacon = { buildBeacon(bssid, "X", 6, SEC_WPA2, false), -42, 6 };
+    ReplayFrame data = { buildEapolKey(bssid, sta, 2, true, false), -50, 6 };
+    WrappedPacket w;
+    wrapFrame(beacon, w);
+    TEST_ASSERT_EQUAL_INT(WIFI_PKT_MGMT, w.type);
+    TEST_ASSERT_EQUAL_UINT32(beacon.data.size() + 4, w.pkt()->rx_ctrl.sig_len);
+    TEST_ASSERT_EQUAL_INT(-42, w.pkt()->rx_ctrl.rssi);
+    TEST_ASSERT_EQUAL_MEMORY(beacon.data.data(), w.pkt()->payload, beacon.data.size());
+    wrapFrame(data, w);
+    TEST_ASSERT_EQUAL_INT(WIFI_PKT_DATA, w.type);
+}
+
+// ============================================================================
+// EAPOL parser checks (the cases the replay counts depend on)
+// ============================================================================
+
+void test_eapol_messageNumbers(void) {
+    TEST_ASSERT_EQUAL_UINT8(1, EapolParser::messageNumber(kKeyInfoM1));
+    TEST_ASSERT_EQUAL_UINT8(2, EapolParser::messageNumber(kKeyInfoM2));
+    TEST_ASSERT_EQUAL_UINT8(3, EapolParser::messageNumber(kKeyInfoM3));
+    TEST_ASSERT_EQUAL_UINT8(4, EapolParser::messageNumber(kKeyInfoM4));
+    TEST_ASSERT_EQUAL_UINT8(0, EapolParser::messageNumber(0x0008));  // No ack, no MIC
+}
+
+void test_eapol_locateHandlesQosHtcAndAddr4(void) {
+    uint8_t bssid[6] = {0x64, 0xEE, 0xB7, 0, 0, 2};
+    uint8_t sta[6] = {0x3C, 0x22, 0xFB, 0, 0, 2};
+    const uint8_t* eapol = nullptr;
+    uint16_t eapolLen = 0;
+    for (int variant = 0; variant < 3; variant++) {
+        std::vector<uint8_t> f = buildEapolKey(bssid, sta, 3, variant >= 1, variant == 2);
+        TEST_ASSERT_TRUE(EapolParser::locate(f.data(), (uint16_t)f.size(), eapol, eapolLen));
+        TEST_ASSERT_EQUAL_UINT8(3, EapolParser::keyMessage(eapol, eapolLen));
+    }
+
+    // 4-address frame: header grows by 6
+    std::vector<uint8_t> f = buildEapolKey(bssid, sta, 2, false, false);
+    f[1] = 0x03;
+    f.insert(f.begin() + 24, 6, 0x11);
+    TEST_ASSERT_TRUE(EapolParser::locate(f.data(), (uint16_t)f.size(), eapol, eapolLen));
+    TEST_ASSERT_EQUAL_UINT8(2, EapolParser::keyMessage(eapol, eapolLen));
+
+    // Plain data frame is not EAPOL
+    std::vector<uint8_t> noise = buildDataNoise(bssid, sta, 1);
+    TEST_ASSERT_FALSE(EapolParser::locate(noise.data(), (uint16_t)noise.size(), eapol, eapolLen));
+}
+
+void test_eapol_pmkidExactly22ByteKeyData(void) {
+    // Standard M1 key data is exactly one 22-byte KDE
+    uint8_t bssid[6] = {0x64, 0xEE, 0xB7, 0, 0, 3};
+    uint8_t sta[6] = {0x3C, 0x22, 0xFB, 0, 0, 3};
+    uint8_t pmkid[16];
+    for (int i = 0; i < 16; i++) pmkid[i] = (uint8_t)(0xC0 + i);
+    std::vector<uint8_t> f = buildEapolKey(bssid, sta, 1, false, false, pmkid);
+    const uint8_t* eapol = nullptr;
+    uint16_t eapolLen = 0;
+    TEST_ASSERT_TRUE(EapolParser::locate(f.data(), (uint16_t)f.size(), eapol, eapolLen));
+    TEST_ASSERT_EQUAL_UINT16(EapolParser::kKeyDataOffset + 22, eapolLen);
+    const uint8_t* found = EapolParser::findPMKID(eapol, eapolLen);
+    TEST_ASSERT_NOT_NULL(found);
+    TEST_ASSERT_EQUAL_MEMORY(pmkid, found, 16);
+}
+
+void test_eapol_pmkidRejectsZeroWpa1AndTruncated(void) {
+    uint8_t bssid[6] = {0x64, 0xEE, 0xB7, 0, 0, 4};
+    uint8_t sta[6] = {0x3C, 0x22, 0xFB, 0, 0, 4};
+    uint8_t zero[16] = {0};
+    uint8_t junk[16];
+    memset(junk, 0x5A, sizeof(junk));
+    const uint8_t* eapol = nullptr;
+    uint16_t eapolLen = 0;
+
+    std::vector<uint8_t> f = buildEapolKey(bssid, sta, 1, false, false, zero);
+    EapolParser::locate(f.data(), (uint16_t)f.size(), eapol, eapolLen);
+    TEST_ASSERT_NULL(EapolParser::findPMKID(eapol, eapolLen));
+
+    f = buildEapolKey(bssid, sta, 1, false, false, junk, 0xFE);
+    EapolParser::locate(f.data(), (uint16_t)f.size(), eapol, eapolLen);
+    TEST_ASSERT_NULL(EapolParser::findPMKID(eapol, eapolLen));
+
+    f = buildEapolKey(bssid, sta, 1, false, false, junk);
+    EapolParser::locate(f.data(), (uint16_t)f.size(), eapol, eapolLen);
+    TEST_ASSERT_NULL(EapolParser::findPMKID(eapol, (uint16_t)(eapolLen - 1)));
+}
+
+// ============================================================================
+// Replay regression gate
+// ============================================================================
+
+static std::vector<WrappedPacket> synthPackets() {
+    std::vector<ReplayFrame> frames;
+    CaptureInfo info;
+    readCapture(writePcapng(buildScenario()), frames, info);
+    return wrapAll(frames);
+}
+
+void test_replay_syntheticCounts(void) {
+    std::vector<WrappedPacket> pkts = synthPackets();
+    ReplayStats st;
+    replay(pkts, 1, st);
+
+    TEST_ASSERT_EQUAL_UINT32(pkts.size(), st.frames);
+    TEST_ASSERT_EQUAL_UINT32(kSynthAPs, st.networks);
+    TEST_ASSERT_EQUAL_UINT32(0, st.reconDropped);
+    TEST_ASSERT_EQUAL_UINT32(kSynthAPs, st.spectrumNets);
+    TEST_ASSERT_EQUAL_UINT32(kSynthHandshakes, st.completeOink);
+    TEST_ASSERT_EQUAL_UINT32(kSynthHandshakes, st.completeDnh);
+    TEST_ASSERT_EQUAL_UINT32(kSynthPmkids, st.pmkidsOink);
+    TEST_ASSERT_EQUAL_UINT32(kSynthPmkids, st.pmkidsDnh);
+    // Handshakes + PMKID M1s + 2 decoy M1s each open an entry
+    TEST_ASSERT_EQUAL_UINT32(kSynthHandshakes + kSynthPmkids + 2, st.handshakesOink);
+}
+
+void test_replay_networkDetailsFromParser(void) {
+    std::vector<WrappedPacket> pkts = synthPackets();
+    ReplayStats st;
+    replay(pkts, 1, st);
+
+    uint8_t bssid[6];
+    for (uint32_t a = 0; a < 4; a++) {
+        makeMac(bssid, 0, a);
+        int idx = recon.find(bssid);
+        TEST_ASSERT_TRUE(idx >= 0);
+        const ReplayNet& n = recon.table[idx];
+        char expect[33];
+        snprintf(expect, sizeof(expect), "PORK_NET_%02u", (unsigned)a);
+        TEST_ASSERT_EQUAL_STRING(expect, n.ssid);
+        TEST_ASSERT_EQUAL_UINT8(1 + a, n.channel);
+        // Beacons seen before update() drains the add queue aren't counted
+        TEST_ASSERT_TRUE(n.beaconCount >= kSynthBeaconRounds - 1);
+    }
+    makeMac(bssid, 0, 0);
+    TEST_ASSERT_EQUAL_INT(WIFI_AUTH_OPEN, recon.table[recon.find(bssid)].authmode);
+    makeMac(bssid, 0, 1);
+    TEST_ASSERT_EQUAL_INT(WIFI_AUTH_WPA2_PSK, recon.table[recon.find(bssid)].authmode);
+    makeMac(bssid, 0, 2);
+    TEST_ASSERT_EQUAL_INT(WIFI_AUTH_WPA3_PSK, recon.table[recon.find(bssid)].authmode);
+    TEST_ASSERT_TRUE(recon.table[recon.find(bssid)].hasPMF);
+    makeMac(bssid, 0, 3);
+    TEST_ASSERT_EQUAL_INT(WIFI_AUTH_WPA_PSK, recon.table[recon.find(bssid)].authmode);
+}
+
+// ============================================================================
+// Benchmark
+// ============================================================================
+
+void test_bench_replaySynthetic(void) {
+    std::vector<WrappedPacket> pkts = synthPackets();
+    ReplayStats st;
+    replay(pkts, 50, st);
+    printStats("synthetic x50", st);
+    TEST_ASSERT_EQUAL_UINT32(pkts.size() * 50, st.frames);
+}
+
+void test_bench_replayExternalCapture(void) {
+    const char* path = getenv("PORKCHOP_REPLAY_PCAP");
+    if (!path || !path[0]) {
+        TEST_IGNORE_MESSAGE("PORKCHOP_REPLAY_PCAP not set");
+    }
+    std::vector<uint8_t> file;
+    TEST_ASSERT_TRUE_MESSAGE(loadFile(path, file), "cannot open PORKCHOP_REPLAY_PCAP");
+    std::vector<ReplayFrame> frames;
+    CaptureInfo info;
+    TEST_ASSERT_TRUE_MESSAGE(readCapture(file, frames, info), "not a pcap/pcapng file");
+    printf("[REPLAY] %s: %u frames, %u skipped\n", path, (unsigned)info.frames, (unsigned)info.skipped);
+
+    std::vector<WrappedPacket> pkts = wrapAll(frames);
+    ReplayStats st;
+    replay(pkts, 1, st);
+    printStats("capture", st);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+
+    // Reader
+    RUN_TEST(test_reader_pcapngRoundTrip);
+    RUN_TEST(test_reader_classicPcapMatchesPcapng);
+    RUN_TEST(test_reader_rejectsGarbage);
+    RUN_TEST(test_wrap_addsGhostBytesAndType);
+
+    // EAPOL parser
+    RUN_TEST(test_eapol_messageNumbers);
+    RUN_TEST(test_eapol_locateHandlesQosHtcAndAddr4);
+    RUN_TEST(test_eapol_pmkidExactly22ByteKeyData);
+    RUN_TEST(test_eapol_pmkidRejectsZeroWpa1AndTruncated);
+
+    // Replay
+    RUN_TEST(test_replay_syntheticCounts);
+    RUN_TEST(test_replay_networkDetailsFromParser);
+
+    // Benchmark
+    RUN_TEST(test_bench_replaySynthetic);
+    RUN_TEST(test_bench_replayExternalCapture);
+
+    return UNITY_END();
+}
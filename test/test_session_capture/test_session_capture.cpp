@@ -0,0 +1,350 @@
+// Session Capture Tests
+// Tests src/core/pcapng.h (block/radiotap encoding, EAPOL filter) and
+// src/core/frame_ring.h (callback -> writer byte ring)
+
+#include <unity.h>
+#include <cstring>
+#include <vector>
+#include "../../src/core/pcapng.h"
+#include "../../src/core/frame_ring.h"
+
+void setUp(void) {}
+void tearDown(void) {}
+
+// ============================================================================
+// Helpers
+// ============================================================================
+
+static uint16_t rd16(const uint8_t* p) { return (uint16_t)(p[0] | (p[1] << 8)); }
+static uint32_t rd32(const uint8_t* p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+// QoS data frame carrying an EAPOL LLC/SNAP header
+static uint16_t buildEapolFrame(uint8_t* out, bool qos, bool htc, bool fourAddr) {
+    memset(out, 0, 64);
+    out[0] = qos ? 0x88 : 0x08;
+    out[1] = (fourAddr ? 0x03 : 0x02) | (htc ? 0x80 : 0x00);
+    uint16_t off = 24;
+    if (fourAddr) off += 6;
+    if (qos) off += 2;
+    if (qos && htc) off += 4;
+    const uint8_t llc[8] = {0xAA, 0xAA, 0x03, 0x00, 0x00, 0x00, 0x88, 0x8E};
+    memcpy(out + off, llc, 8);
+    out[off + 8] = 0x02;  // EAPOL version
+    out[off + 9] = 0x03;  // Key
+    return (uint16_t)(off + 12);
+}
+
+// ============================================================================
+// PCAPNG Encoding
+// ============================================================================
+
+void test_pcapng_shb_layout(void) {
+    uint8_t buf[64];
+    size_t n = Pcapng::writeSHB(buf, sizeof(buf));
+    TEST_ASSERT_EQUAL_UINT32(48, n);  // 28 + opt hdr(4) + "M5PORKCHOP"(10 -> 12) + end(4)
+    TEST_ASSERT_EQUAL_HEX32(Pcapng::kBlockSHB, rd32(buf));
+    TEST_ASSERT_EQUAL_UINT32(n, rd32(buf + 4));
+    TEST_ASSERT_EQUAL_HEX32(Pcapng::kByteOrderMagic, rd32(buf + 8));
+    TEST_ASSERT_EQUAL_UINT16(1, rd16(buf + 12));
+    TEST_ASSERT_EQUAL_UINT16(0, rd16(buf + 14));
+    TEST_ASSERT_EQUAL_HEX32(0xFFFFFFFF, rd32(buf + 16));
+    TEST_ASSERT_EQUAL_UINT16(4, rd16(buf + 24));   // shb_userappl
+    TEST_ASSERT_EQUAL_UINT16(10, rd16(buf + 26));
+    TEST_ASSERT_EQUAL_MEMORY("M5PORKCHOP", buf + 28, 10);
+    TEST_ASSERT_EQUAL_UINT32(0, rd32(buf + 40));  // opt_endofopt
+    TEST_ASSERT_EQUAL_UINT32(n, rd32(buf + n - 4));
+}
+
+void test_pcapng_shb_withoutAppl(void) {
+    uint8_t buf[32];
+    TEST_ASSERT_EQUAL_UINT32(28, Pcapng::writeSHB(buf, sizeof(buf), nullptr));
+    TEST_ASSERT_EQUAL_UINT32(28, rd32(buf + 24));
+}
+
+void test_pcapng_shb_tooSmall(void) {
+    uint8_t buf[16];
+    TEST_ASSERT_EQUAL_UINT32(0, Pcapng::writeSHB(buf, sizeof(buf)));
+}
+
+void test_pcapng_idb_radiotap(void) {
+    uint8_t buf[20];
+    TEST_ASSERT_EQUAL_UINT32(20, Pcapng::writeIDB(buf, sizeof(buf)));
+    TEST_ASSERT_EQUAL_HEX32(Pcapng::kBlockIDB, rd32(buf));
+    TEST_ASSERT_EQUAL_UINT16(127, rd16(buf + 8));
+    TEST_ASSERT_EQUAL_UINT32(65535, rd32(buf + 12));
+    TEST_ASSERT_EQUAL_UINT32(20, rd32(buf + 16));
+}
+
+void test_pcapng_channelToFreq(void) {
+    TEST_ASSERT_EQUAL_UINT16(2412, Pcapng::channelToFreq(1));
+    TEST_ASSERT_EQUAL_UINT16(2437, Pcapng::channelToFreq(6));
+    TEST_ASSERT_EQUAL_UINT16(2472, Pcapng::channelToFreq(13));
+    TEST_ASSERT_EQUAL_UINT16(2484, Pcapng::channelToFreq(14));
+    TEST_ASSERT_EQUAL_UINT16(0, Pcapng::channelToFreq(0));
+    TEST_ASSERT_EQUAL_UINT16(0, Pcapng::channelToFreq(36));
+}
+
+void test_pcapng_epb_radiotapCarriesRssiAndChannel(void) {
+    uint8_t frame[37];
+    for (int i = 0; i < 37; i++) frame[i] = (uint8_t)i;
+    uint8_t buf[128];
+    uint64_t ts = 0x0000000123456789ULL;
+    size_t n = Pcapng::writeEPB(buf, sizeof(buf), ts, -67, 11, frame, 37, 37);
+
+    // 32 overhead + pad4(16 + 37) = 32 + 56
+    TEST_ASSERT_EQUAL_UINT32(88, n);
+    TEST_ASSERT_EQUAL_UINT32(Pcapng::epbSize(37), n);
+    TEST_ASSERT_EQUAL_HEX32(Pcapng::kBlockEPB, rd32(buf));
+    TEST_ASSERT_EQUAL_UINT32(n, rd32(buf + 4));
+    TEST_ASSERT_EQUAL_UINT32(0, rd32(buf + 8));
+    TEST_ASSERT_EQUAL_HEX32(0x00000001, rd32(buf + 12));
+    TEST_ASSERT_EQUAL_HEX32(0x23456789, rd32(buf + 16));
+    TEST_ASSERT_EQUAL_UINT32(16 + 37, rd32(buf + 20));
+    TEST_ASSERT_EQUAL_UINT32(16 + 37, rd32(buf + 24));
+
+    const uint8_t* rt = buf + 28;
+    TEST_ASSERT_EQUAL_UINT8(0, rt[0]);
+    TEST_ASSERT_EQUAL_UINT16(16, rd16(rt + 2));
+    TEST_ASSERT_EQUAL_HEX32(0x28, rd32(rt + 4));
+    TEST_ASSERT_EQUAL_UINT16(2462, rd16(rt + 8));
+    TEST_ASSERT_EQUAL_HEX16(0x0080, rd16(rt + 10));
+    TEST_ASSERT_EQUAL_INT8(-67, (int8_t)rt[12]);
+
+    TEST_ASSERT_EQUAL_MEMORY(frame, buf + 44, 37);
+    TEST_ASSERT_EQUAL_UINT8(0, buf[44 + 37]);  // Padding zeroed
+    TEST_ASSERT_EQUAL_UINT32(n, rd32(buf + n - 4));
+}
+
+void test_pcapng_epb_snappedFrameKeepsOrigLen(void) {
+    uint8_t frame[24] = {0x80};
+    uint8_t buf[96];
+    size_t n = Pcapng::writeEPB(buf, sizeof(buf), 0, -40, 1, frame, 24, 1500);
+    TEST_ASSERT_EQUAL_UINT32(Pcapng::epbSize(24), n);
+    TEST_ASSERT_EQUAL_UINT32(16 + 24, rd32(buf + 20));
+    TEST_ASSERT_EQUAL_UINT32(16 + 1500, rd32(buf + 24));
+}
+
+void test_pcapng_epb_tooSmall(void) {
+    uint8_t frame[100] = {0};
+    uint8_t buf[64];
+    TEST_ASSERT_EQUAL_UINT32(0, Pcapng::writeEPB(buf, sizeof(buf), 0, -40, 1, frame, 100, 100));
+}
+
+void test_pcapng_eapol_plainData(void) {
+    uint8_t f[64];
+    uint16_t len = buildEapolFrame(f, false, false, false);
+    TEST_ASSERT_TRUE(Pcapng::isEapolFrame(f, len));
+}
+
+void test_pcapng_eapol_qosHtcFourAddr(void) {
+    uint8_t f[64];
+    TEST_ASSERT_TRUE(Pcapng::isEapolFrame(f, buildEapolFrame(f, true, false, false)));
+    TEST_ASSERT_TRUE(Pcapng::isEapolFrame(f, buildEapolFrame(f, true, true, false)));
+    TEST_ASSERT_TRUE(Pcapng::isEapolFrame(f, buildEapolFrame(f, true, true, true)));
+}
+
+void test_pcapng_eapol_rejectsOthers(void) {
+    uint8_t f[64];
+    uint16_t len = buildEapolFrame(f, true, false, false);
+    f[len - 12 + 7] = 0x00;  // Ethertype 0x8800, not EAPOL
+    TEST_ASSERT_FALSE(Pcapng::isEapolFrame(f, len));
+
+    uint8_t beacon[64] = {0x80, 0x00};
+    TEST_ASSERT_FALSE(Pcapng::isEapolFrame(beacon, sizeof(beacon)));
+
+    len = buildEapolFrame(f, false, false, false);
+    TEST_ASSERT_FALSE(Pcapng::isEapolFrame(f, 30));  // LLC cut off
+    TEST_ASSERT_FALSE(Pcapng::isEapolFrame(nullptr, len));
+}
+
+// ============================================================================
+// FrameRing
+// ============================================================================
+
+static uint8_t ringMem[1024];
+
+static void fillFrame(uint8_t* f, uint16_t len, uint8_t seed) {
+    for (uint16_t i = 0; i < len; i++) f[i] = (uint8_t)(seed + i);
+}
+
+void test_ring_unattachedDrops(void) {
+    FrameRing r;
+    uint8_t f[24] = {0};
+    TEST_ASSERT_FALSE(r.push(0, -50, 1, f, 24, 24));
+    TEST_ASSERT_EQUAL_UINT32(1, r.dropped());
+    FrameRecordHeader h;
+    const uint8_t* p;
+    TEST_ASSERT_FALSE(r.peek(h, p));
+}
+
+void test_ring_pushPeekPop(void) {
+    FrameRing r;
+    r.attach(ringMem, sizeof(ringMem));
+    uint8_t f[50];
+    fillFrame(f, 50, 7);
+    TEST_ASSERT_TRUE(r.push(0x1122334455ULL, -72, 6, f, 50, 60));
+    TEST_ASSERT_EQUAL_UINT32(FrameRing::recordSize(50), r.used());
+
+    FrameRecordHeader h;
+    const uint8_t* p = nullptr;
+    TEST_ASSERT_TRUE(r.peek(h, p));
+    TEST_ASSERT_EQUAL_UINT16(50, h.len);
+    TEST_ASSERT_EQUAL_UINT16(60, h.origLen);
+    TEST_ASSERT_EQUAL_INT8(-72, h.rssi);
+    TEST_ASSERT_EQUAL_UINT8(6, h.channel);
+    TEST_ASSERT_TRUE(h.timestampUs() == 0x1122334455ULL);
+    TEST_ASSERT_EQUAL_MEMORY(f, p, 50);
+    r.pop(h);
+    TEST_ASSERT_TRUE(r.empty());
+    TEST_ASSERT_FALSE(r.peek(h, p));
+}
+
+void test_ring_fullDropsAndCounts(void) {
+    FrameRing r;
+    r.attach(ringMem, 256);
+    uint8_t f[48] = {0};
+    // 64-byte records: three fit (one slot stays free to tell full from empty)
+    int accepted = 0;
+    for (int i = 0; i < 6; i++) {
+        if (r.push(i, -50, 1, f, 48, 48)) accepted++;
+    }
+    TEST_ASSERT_EQUAL_INT(3, accepted);
+    TEST_ASSERT_EQUAL_UINT32(3, r.dropped());
+    TEST_ASSERT_EQUAL_UINT32(3, r.pushed());
+    TEST_ASSERT_EQUAL_UINT32(192, r.highWater());
+}
+
+void test_ring_wrapWithMarker(void) {
+    FrameRing r;
+    r.attach(ringMem, 256);
+    uint8_t f[200];
+    FrameRecordHeader h;
+    const uint8_t* p;
+
+    // Advance to offset 160, leaving 96 bytes before the end
+    for (int i = 0; i < 2; i++) {
+        fillFrame(f, 64, (uint8_t)i);
+        TEST_ASSERT_TRUE(r.push(i, -50, 1, f, 64, 64));
+        TEST_ASSERT_TRUE(r.peek(h, p));
+        r.pop(h);
+    }
+    // 120-byte record can't fit in 96 -> marker + wrap to 0
+    fillFrame(f, 104, 0x40);
+    TEST_ASSERT_TRUE(r.push(9, -60, 11, f, 104, 104));
+    TEST_ASSERT_TRUE(r.peek(h, p));
+    TEST_ASSERT_EQUAL_UINT16(104, h.len);
+    TEST_ASSERT_EQUAL_UINT8(11, h.channel);
+    TEST_ASSERT_TRUE(p == ringMem + FrameRing::kHeaderLen);
+    TEST_ASSERT_EQUAL_MEMORY(f, p, 104);
+    r.pop(h);
+    TEST_ASSERT_TRUE(r.empty());
+}
+
+void test_ring_wrapWithoutRoomForMarker(void) {
+    FrameRing r;
+    r.attach(ringMem, 256);
+    uint8_t f[256] = {0};
+    FrameRecordHeader h;
+    const uint8_t* p;
+
+    // One record ending 8 bytes short of the end (less than a header)
+    TEST_ASSERT_TRUE(r.push(1, -50, 1, f, 232, 232));  // 248 bytes
+    TEST_ASSERT_TRUE(r.peek(h, p));
+    r.pop(h);
+    fillFrame(f, 20, 3);
+    TEST_ASSERT_TRUE(r.push(2, -50, 3, f, 20, 20));
+    TEST_ASSERT_TRUE(r.peek(h, p));
+    TEST_ASSERT_TRUE(h.timestampUs() == 2);
+    TEST_ASSERT_TRUE(p == ringMem + FrameRing::kHeaderLen);
+    TEST_ASSERT_EQUAL_MEMORY(f, p, 20);
+    r.pop(h);
+    TEST_ASSERT_TRUE(r.empty());
+}
+
+void test_ring_exactFillToEnd(void) {
+    FrameRing r;
+    r.attach(ringMem, 256);
+    uint8_t f[128] = {0};
+    FrameRecordHeader h;
+    const uint8_t* p;
+
+    TEST_ASSERT_TRUE(r.push(1, -50, 1, f, 112, 112));  // 128 bytes
+    TEST_ASSERT_TRUE(r.peek(h, p));
+    r.pop(h);
+    // Exactly fills [128, 256): head returns to 0 while tail is at 128
+    TEST_ASSERT_TRUE(r.push(2, -50, 1, f, 112, 112));
+    TEST_ASSERT_EQUAL_UINT32(128, r.used());
+    TEST_ASSERT_TRUE(r.peek(h, p));
+    TEST_ASSERT_TRUE(h.timestampUs() == 2);
+    r.pop(h);
+    TEST_ASSERT_TRUE(r.empty());
+}
+
+void test_ring_fifoOrderUnderChurn(void) {
+    // Mixed frame sizes, producer running ahead of consumer in bursts
+    FrameRing r;
+    r.attach(ringMem, sizeof(ringMem));
+    uint8_t f[300];
+    uint32_t nextPush = 0;
+    uint32_t nextPop = 0;
+    uint32_t seed = 99;
+    std::vector<uint16_t> lens;
+
+    for (int round = 0; round < 400; round++) {
+        seed = seed * 1103515245u + 12345u;
+        int burst = 1 + (int)((seed >> 16) % 5);
+        for (int i = 0; i < burst; i++) {
+            uint16_t len = (uint16_t)(24 + ((seed >> (i + 3)) % 250));
+            fillFrame(f, len, (uint8_t)nextPush);
+            if (r.push(nextPush, -50, (uint8_t)(nextPush % 13 + 1), f, len, len)) {
+                lens.push_back(len);
+                nextPush++;
+            } else {
+                break;
+            }
+        }
+        int drain = 1 + (int)((seed >> 20) % 4);
+        FrameRecordHeader h;
+        const uint8_t* p;
+        for (int i = 0; i < drain && r.peek(h, p); i++) {
+            TEST_ASSERT_TRUE(h.timestampUs() == nextPop);
+            TEST_ASSERT_EQUAL_UINT16(lens[nextPop], h.len);
+            fillFrame(f, h.len, (uint8_t)nextPop);
+            TEST_ASSERT_EQUAL_MEMORY(f, p, h.len);
+            r.pop(h);
+            nextPop++;
+        }
+    }
+    TEST_ASSERT_TRUE(nextPop > 100);
+    TEST_ASSERT_TRUE(r.highWater() <= r.capacity());
+}
+
+int main(void) {
+    UNITY_BEGIN();
+
+    // PCAPNG
+    RUN_TEST(test_pcapng_shb_layout);
+    RUN_TEST(test_pcapng_shb_withoutAppl);
+    RUN_TEST(test_pcapng_shb_tooSmall);
+    RUN_TEST(test_pcapng_idb_radiotap);
+    RUN_TEST(test_pcapng_channelToFreq);
+    RUN_TEST(test_pcapng_epb_radiotapCarriesRssiAndChannel);
+    RUN_TEST(test_pcapng_epb_snappedFrameKeepsOrigLen);
+    RUN_TEST(test_pcapng_epb_tooSmall);
+    RUN_TEST(test_pcapng_eapol_plainData);
+    RUN_TEST(test_pcapng_eapol_qosHtcFourAddr);
+    RUN_TEST(test_pcapng_eapol_rejectsOthers);
+
+    // FrameRing
+    RUN_TEST(test_ring_unattachedDrops);
+    RUN_TEST(test_ring_pushPeekPop);
+    RUN_TEST(test_ring_fullDropsAndCounts);
+    RUN_TEST(test_ring_wrapWithMarker);
+    RUN_TEST(test_ring_wrapWithoutRoomForMarker);
+    RUN_TEST(test_ring_exactFillToEnd);
+    RUN_TEST(test_ring_fifoOrderUnderChurn);
+
+    return UNITY_END();
+}
@@ -0,0 +1,309 @@
+// Spectrum Lobe Tests
+// Tests src/core/spectrum_lobe.h (lobe templates, int8 accumulation,
+// waterfall dithering) plus a frame-cost benchmark against the float path
+
+#include <unity.h>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include "../../src/core/spectrum_lobe.h"
+
+using namespace SpectrumLobe;
+
+void setUp(void) {}
+void tearDown(void) {}
+
+// SpectrumMode layout
+static const int kCols = 218;
+static const float kWidthMHz = 60.0f;
+static const int8_t kFloorDb = -92;
+static const int kRows = 22;
+
+// Pre-template SpectrumMode::updateSpectrumBuffers() inner loop
+static void legacyAccumulate(float centerMHz, float leftMHz, int8_t rssi, int8_t* cols) {
+    for (int x = 0; x < kCols; x++) {
+        float freq = leftMHz + (float)x * kWidthMHz / kCols;
+        float amp = sincAmplitude(freq - centerMHz);
+        if (amp < 0.05f) continue;
+        int8_t v = kFloorDb + (int8_t)((rssi - kFloorDb) * amp);
+        if (v > cols[x]) cols[x] = v;
+    }
+}
+
+// Pre-blit SpectrumMode::drawWaterfall() per-pixel test
+static bool legacyLit(uint8_t intensity, int x, int row) {
+    if (intensity <= 20) return false;
+    if (intensity > 200) return true;
+    if (intensity > 150) return ((x + row) % 2) == 0;
+    if (intensity > 100) return ((x % 2) == 0) && ((row % 2) == 0);
+    if (intensity > 50) return ((x % 3) == 0) && ((row % 2) == 0);
+    return ((x % 4) == 0) && ((row % 3) == 0);
+}
+
+// Stand-in for canvas.drawPixel(): an out-of-line call with a clip test
+__attribute__((noinline)) static void plotPixel(uint8_t* fb, int x, int y, uint8_t ink) {
+    if (x < 0 || x >= 240 || y < 0 || y >= kRows) return;
+    fb[y * 240 + x] = ink;
+}
+
+static Template& shape() {
+    static Template t;
+    if (!t.matches(kWidthMHz, kCols)) t.build(kWidthMHz, kCols);
+    return t;
+}
+
+// ============================================================================
+// Template
+// ============================================================================
+
+void test_template_peakAndSymmetry(void) {
+    const Template& t = shape();
+    Placement pl = t.place(100 * kSubPx);       // Whole-pixel center at column 100
+    TEST_ASSERT_EQUAL_UINT8(kOne, pl.at(100));
+    for (int i = 1; i < kMaxHalf; i++) {
+        TEST_ASSERT_EQUAL_UINT8(pl.at(100 - i), pl.at(100 + i));
+    }
+    // Past +-22 MHz (~80 columns) nothing
+    TEST_ASSERT_EQUAL_UINT8(0, pl.at(100 + 85));
+    TEST_ASSERT_EQUAL_UINT8(0, pl.at(100 - 85));
+    TEST_ASSERT_EQUAL_UINT8(0, pl.at(100 + kMaxHalf + 1));
+}
+
+void test_template_matchesFloatShape(void) {
+    const Template& t = shape();
+    float left = 2407.0f;
+    for (float c = 2400.0f; c <= 2480.0f; c += 0.37f) {
+        Placement pl = t.place(t.centerQ(c, left));
+        for (int x = 0; x < kCols; x++) {
+            float freq = left + (float)x * kWidthMHz / kCols;
+            float ref = sincAmplitude(freq - c) * kOne;
+            // Quarter-pixel center: at most ~0.07 MHz off on the steepest slope
+            TEST_ASSERT_TRUE(fabsf(ref - pl.at(x)) <= 6.0f);
+        }
+    }
+}
+
+void test_template_rebuiltPerZoom(void) {
+    Template t;
+    TEST_ASSERT_FALSE(t.matches(kWidthMHz, kCols));
+    t.build(kWidthMHz, kCols);
+    TEST_ASSERT_TRUE(t.matches(kWidthMHz, kCols));
+    TEST_ASSERT_FALSE(t.matches(40.0f, kCols));
+
+    // Narrower view: the same 11 MHz null lands further from center
+    Placement wide = t.place(100 * kSubPx);
+    int wideNull = 1;
+    while (wide.at(100 + wideNull) > 0) wideNull++;
+    t.build(50.0f, kCols);
+    Placement narrow = t.place(100 * kSubPx);
+    int narrowNull = 1;
+    while (narrow.at(100 + narrowNull) > 0) narrowNull++;
+    TEST_ASSERT_EQUAL_INT(40, wideNull);      // 11 MHz * 218 / 60
+    TEST_ASSERT_EQUAL_INT(48, narrowNull);    // 11 MHz * 218 / 50
+}
+
+void test_template_subPixelPhases(void) {
+    const Template& t = shape();
+    // Centers a quarter pixel apart give different samples next to center
+    Placement a = t.place(400);
+    Placement b = t.place(401);
+    TEST_ASSERT_EQUAL_INT(a.first, b.first);
+    TEST_ASSERT_TRUE(a.at(110) != b.at(110));
+    // Negative centers (lobe centered left of the view) round down
+    Placement neg = t.place(-3);
+    TEST_ASSERT_EQUAL_INT(-1 - kMaxHalf, neg.first);
+}
+
+// ============================================================================
+// Accumulation
+// ============================================================================
+
+void test_accumulate_matchesFloatPath(void) {
+    const Template& t = shape();
+    float left = 2437.0f - kWidthMHz / 2;
+    int8_t fast[kCols];
+    int8_t ref[kCols];
+    for (int i = 0; i < kCols; i++) fast[i] = ref[i] = kFloorDb + (int8_t)(i % 5) - 2;
+
+    const float centers[] = {2412.0f, 2417.3f, 2437.0f, 2441.9f, 2462.0f, 2484.0f};
+    const int8_t rssis[] = {-40, -71, -30, -88, -55, -63};
+    for (int n = 0; n < 6; n++) {
+        accumulate(t.place(t.centerQ(centers[n], left)), kFloorDb, rssis[n], fast, kCols);
+        legacyAccumulate(centers[n], left, rssis[n], ref);
+    }
+    for (int x = 0; x < kCols; x++) {
+        TEST_ASSERT_INT_WITHIN(2, ref[x], fast[x]);
+    }
+}
+
+void test_accumulate_clipsAtEdges(void) {
+    const Template& t = shape();
+    int8_t buf[kCols + 8];
+    memset(buf, 0x5A, sizeof(buf));
+    int8_t* cols = buf + 4;
+    for (int i = 0; i < kCols; i++) cols[i] = kFloorDb;
+
+    // Lobes hanging off both sides and one entirely off screen
+    accumulate(t.place(-20 * kSubPx), kFloorDb, -30, cols, kCols);
+    accumulate(t.place((kCols + 20) * kSubPx), kFloorDb, -30, cols, kCols);
+    accumulate(t.place((kCols + 400) * kSubPx), kFloorDb, -30, cols, kCols);
+    for (int i = 0; i < 4; i++) {
+        TEST_ASSERT_EQUAL_INT8(0x5A, buf[i]);
+        TEST_ASSERT_EQUAL_INT8(0x5A, buf[4 + kCols + i]);
+    }
+    TEST_ASSERT_TRUE(cols[0] > kFloorDb);
+    TEST_ASSERT_TRUE(cols[kCols - 1] > kFloorDb);
+}
+
+void test_accumulate_nullsKeepNoise(void) {
+    const Template& t = shape();
+    int8_t cols[kCols];
+    for (int i = 0; i < kCols; i++) cols[i] = -94;
+    Placement pl = t.place(109 * kSubPx);
+    accumulate(pl, kFloorDb, -35, cols, kCols);
+    for (int x = 0; x < kCols; x++) {
+        // Below 5% the lobe doesn't touch the noise (not even to the floor)
+        if (pl.at(x) < kSkipQ) TEST_ASSERT_EQUAL_INT8(-94, cols[x]);
+        else TEST_ASSERT_TRUE(cols[x] >= kFloorDb);
+    }
+    TEST_ASSERT_EQUAL_INT8(-35, cols[109]);
+
+    // At or below the floor: nothing
+    int8_t before = cols[50];
+    accumulate(pl, kFloorDb, kFloorDb, cols, kCols);
+    TEST_ASSERT_EQUAL_INT8(before, cols[50]);
+}
+
+void test_sin8_tracksSinf(void) {
+    for (int p = 0; p < 256; p++) {
+        float ref = 127.0f * sinf((float)p * 6.2831853f / 256.0f);
+        TEST_ASSERT_TRUE(fabsf(ref - sin8((uint8_t)p)) <= 1.0f);
+    }
+    TEST_ASSERT_EQUAL_INT(0, sin8(0));
+    TEST_ASSERT_EQUAL_INT(127, sin8(64));
+    TEST_ASSERT_EQUAL_INT(-127, sin8(192));
+}
+
+// ============================================================================
+// Waterfall
+// ============================================================================
+
+void test_dither_levelThresholds(void) {
+    TEST_ASSERT_EQUAL_UINT8(0, ditherLevel(0));
+    TEST_ASSERT_EQUAL_UINT8(0, ditherLevel(20));
+    TEST_ASSERT_EQUAL_UINT8(1, ditherLevel(21));
+    TEST_ASSERT_EQUAL_UINT8(1, ditherLevel(50));
+    TEST_ASSERT_EQUAL_UINT8(2, ditherLevel(51));
+    TEST_ASSERT_EQUAL_UINT8(3, ditherLevel(101));
+    TEST_ASSERT_EQUAL_UINT8(4, ditherLevel(151));
+    TEST_ASSERT_EQUAL_UINT8(4, ditherLevel(200));
+    TEST_ASSERT_EQUAL_UINT8(5, ditherLevel(201));
+    TEST_ASSERT_EQUAL_UINT8(5, ditherLevel(255));
+}
+
+void test_blitRow_matchesPerPixelDither(void) {
+    uint8_t intensity[kCols];
+    uint8_t levels[kCols];
+    for (int x = 0; x < kCols; x++) {
+        intensity[x] = (uint8_t)((x * 37 + 11) & 0xFF);
+        levels[x] = ditherLevel(intensity[x]);
+    }
+    for (int row = 0; row < kRows; row++) {
+        uint8_t px[kCols];
+        memset(px, 0x11, sizeof(px));
+        blitRow(px, levels, kCols, row, 0xFF);
+        for (int x = 0; x < kCols; x++) {
+            // Unlit pixels keep what was drawn under the waterfall
+            TEST_ASSERT_EQUAL_UINT8(legacyLit(intensity[x], x, row) ? 0xFF : 0x11, px[x]);
+        }
+    }
+}
+
+// ============================================================================
+// Frame cost vs. network count
+// ============================================================================
+
+void test_bench_frameCost(void) {
+    const Template& t = shape();
+    const float left = 2407.0f;
+    const int kFrames = 2000;
+    static uint8_t levels[kRows][kCols];
+    static uint8_t canvas[kRows][240];
+    for (int r = 0; r < kRows; r++) {
+        for (int x = 0; x < kCols; x++) levels[r][x] = ditherLevel((uint8_t)((x * 7 + r * 13) & 0xFF));
+    }
+
+    volatile int sink = 0;
+    const int counts[] = {8, 16, 32, 64};
+    for (int c : counts) {
+        int8_t cols[kCols];
+        auto t0 = std::chrono::steady_clock::now();
+        for (int f = 0; f < kFrames; f++) {
+            memset(cols, kFloorDb, sizeof(cols));
+            for (int n = 0; n < c; n++) {
+                legacyAccumulate(2412.0f + (float)((n * 5 + f) % 60), left, (int8_t)(-40 - n % 50), cols);
+            }
+            sink += cols[f % kCols];
+        }
+        auto t1 = std::chrono::steady_clock::now();
+        for (int f = 0; f < kFrames; f++) {
+            memset(cols, kFloorDb, sizeof(cols));
+            for (int n = 0; n < c; n++) {
+                float center = 2412.0f + (float)((n * 5 + f) % 60);
+                accumulate(t.place(t.centerQ(center, left)), kFloorDb, (int8_t)(-40 - n % 50), cols, kCols);
+            }
+            sink += cols[f % kCols];
+        }
+        auto t2 = std::chrono::steady_clock::now();
+        double legacyUs = std::chrono::duration<double, std::micro>(t1 - t0).count() / kFrames;
+        double fastUs = std::chrono::duration<double, std::micro>(t2 - t1).count() / kFrames;
+        printf("[BENCH] %2d networks: float fill=%.2f us  template fill=%.2f us  (%.1fx)\n",
+               c, legacyUs, fastUs, fastUs > 0 ? legacyUs / fastUs : 0.0);
+        TEST_ASSERT_TRUE(fastUs > 0);
+    }
+
+    auto t0 = std::chrono::steady_clock::now();
+    for (int f = 0; f < kFrames; f++) {
+        for (int r = 0; r < kRows; r++) {
+            for (int x = 0; x < kCols; x++) {
+                static const uint8_t kMid[6] = {0, 35, 75, 125, 175, 230};
+                if (legacyLit(kMid[levels[r][x]], x, r)) plotPixel(&canvas[0][0], 20 + x, r, 0xFF);
+            }
+        }
+        sink += canvas[f % kRows][100];
+    }
+    auto t1 = std::chrono::steady_clock::now();
+    for (int f = 0; f < kFrames; f++) {
+        for (int r = 0; r < kRows; r++) blitRow(&canvas[r][20], levels[r], kCols, r, 0xFF);
+        sink += canvas[f % kRows][100];
+    }
+    auto t2 = std::chrono::steady_clock::now();
+    double legacyUs = std::chrono::duration<double, std::micro>(t1 - t0).count() / kFrames;
+    double fastUs = std::chrono::duration<double, std::micro>(t2 - t1).count() / kFrames;
+    printf("[BENCH] waterfall %dx%d: per-pixel=%.2f us  row blit=%.2f us\n",
+           kCols, kRows, legacyUs, fastUs);
+    (void)sink;
+    TEST_ASSERT_TRUE(fastUs > 0);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_template_peakAndSymmetry);
+    RUN_TEST(test_template_matchesFloatShape);
+    RUN_TEST(test_template_rebuiltPerZoom);
+    RUN_TEST(test_template_subPixelPhases);
+
+    RUN_TEST(test_accumulate_matchesFloatPath);
+    RUN_TEST(test_accumulate_clipsAtEdges);
+    RUN_TEST(test_accumulate_nullsKeepNoise);
+    RUN_TEST(test_sin8_tracksSinf);
+
+    RUN_TEST(test_dither_levelThresholds);
+    RUN_TEST(test_blitRow_matchesPerPixelDither);
+
+    RUN_TEST(test_bench_frameCost);
+
+    return UNITY_END();
+}
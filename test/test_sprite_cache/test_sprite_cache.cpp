@@ -0,0 +1,349 @@
+// Sprite Cache Tests
+// Tests src/core/sprite_cache.h (1-bpp bitmaps, variant keys, LRU slot
+// budget, run-length blit) and benchmarks an avatar frame drawn glyph by
+// glyph at text size 3 against the cached bitmap blit
+
+#include <unity.h>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+#include "../../src/core/sprite_cache.h"
+
+using namespace SpriteCache;
+
+void setUp(void) {}
+void tearDown(void) {}
+
+// ---------------------------------------------------------------------------
+// Host stand-ins for the canvas and the 6x8 text font
+// ---------------------------------------------------------------------------
+
+static const int kScreenW = 240;
+static const int kScreenH = 107;
+
+struct Framebuffer {
+    uint16_t px[kScreenW * kScreenH];
+    uint32_t calls;
+
+    void clear() {
+        memset(px, 0, sizeof(px));
+        calls = 0;
+    }
+
+    void fillRect(int x, int y, int w, int h, uint16_t c) {
+        calls++;
+        for (int yy = y; yy < y + h; yy++) {
+            if (yy < 0 || yy >= kScreenH) continue;
+            for (int xx = x; xx < x + w; xx++) {
+                if (xx >= 0 && xx < kScreenW) px[yy * kScreenW + xx] = c;
+            }
+        }
+    }
+
+    void operator()(int x, int y, int w, int h) { fillRect(x, y, w, h, color); }
+
+    uint16_t color;
+};
+
+// 5x7 glyph in a 6x8 cell, one byte per column (bit 0 = top row). Content
+// is arbitrary but fixed per character, with a blank column and row.
+static uint8_t glyphColumn(char c, int col) {
+    if (c == ' ' || col >= 5) return 0;
+    uint32_t h = (uint8_t)c * 2654435761u + col * 40503u;
+    return (uint8_t)((h >> 13) & 0x7F);
+}
+
+// What the GFX text path does per frame: every lit font pixel of every
+// glyph becomes a size x size rect
+static void drawTextGlyphs(Framebuffer& fb, const char* s, int x, int y, int size, uint16_t c) {
+    for (; *s; s++, x += 6 * size) {
+        for (int col = 0; col < 6; col++) {
+            uint8_t bits = glyphColumn(*s, col);
+            for (int row = 0; row < 8; row++) {
+                if (bits & (1 << row)) fb.fillRect(x + col * size, y + row * size, size, size, c);
+            }
+        }
+    }
+}
+
+// Same font into a 1-bpp bitmap (what the raster sprite does on a miss)
+static void rasterText(uint8_t* bits, uint16_t w, uint16_t h, const char* s, int x, int y, int size) {
+    for (; *s; s++, x += 6 * size) {
+        for (int col = 0; col < 6; col++) {
+            uint8_t colBits = glyphColumn(*s, col);
+            for (int row = 0; row < 8; row++) {
+                if (!(colBits & (1 << row))) continue;
+                for (int dy = 0; dy < size; dy++) {
+                    for (int dx = 0; dx < size; dx++) {
+                        int px = x + col * size + dx;
+                        int py = y + row * size + dy;
+                        if (px >= 0 && px < w && py >= 0 && py < h) setPixel(bits, w, px, py);
+                    }
+                }
+            }
+        }
+    }
+}
+
+// Pig frame geometry (matches src/piglet/sprites.h)
+static const int kCharW = 18;
+static const int kLineH = 22;
+static const uint16_t kPigW = 8 * kCharW;
+static const uint16_t kPigH = 2 * kLineH + 24;
+
+static void rasterPig(uint8_t* bits, const char* const lines[3], bool tailLeft) {
+    rasterText(bits, kPigW, kPigH, lines[0], kCharW, 0, 3);
+    rasterText(bits, kPigW, kPigH, lines[1], kCharW, kLineH, 3);
+    rasterText(bits, kPigW, kPigH, lines[2], tailLeft ? 0 : kCharW, 2 * kLineH, 3);
+}
+
+static void drawPigGlyphs(Framebuffer& fb, const char* const lines[3], bool tailLeft, int x, int y, uint16_t c) {
+    drawTextGlyphs(fb, lines[0], x, y, 3, c);
+    drawTextGlyphs(fb, lines[1], x, y + kLineH, 3, c);
+    drawTextGlyphs(fb, lines[2], tailLeft ? x - kCharW : x, y + 2 * kLineH, 3, c);
+}
+
+// ---------------------------------------------------------------------------
+
+void test_bitmapLayout(void) {
+    TEST_ASSERT_EQUAL(1, strideBytes(1));
+    TEST_ASSERT_EQUAL(2, strideBytes(9));
+    TEST_ASSERT_EQUAL(18, strideBytes(144));
+    TEST_ASSERT_EQUAL(1224, bitmapBytes(144, 68));
+
+    uint8_t bits[4] = {0};
+    setPixel(bits, 16, 0, 0);
+    setPixel(bits, 16, 9, 1);
+    TEST_ASSERT_EQUAL_HEX8(0x80, bits[0]);  // MSB = leftmost
+    TEST_ASSERT_EQUAL_HEX8(0x40, bits[3]);
+    TEST_ASSERT_TRUE(getPixel(bits, 16, 9, 1));
+    TEST_ASSERT_FALSE(getPixel(bits, 16, 8, 1));
+}
+
+void test_keysSeparateVariants(void) {
+    uint32_t base = avatarKey(1, true, false, 0, true);
+    TEST_ASSERT_TRUE(base != avatarKey(2, true, false, 0, true));
+    TEST_ASSERT_TRUE(base != avatarKey(1, false, false, 0, true));
+    TEST_ASSERT_TRUE(base != avatarKey(1, true, true, 0, true));
+    TEST_ASSERT_TRUE(base != avatarKey(1, true, false, 2, true));
+    TEST_ASSERT_TRUE(avatarKey(1, true, false, 1, true) != avatarKey(1, true, false, 3, true));
+    TEST_ASSERT_TRUE(base != avatarKey(1, true, false, 0, false));
+    TEST_ASSERT_EQUAL_UINT32(base, avatarKey(1, true, false, 0, true));
+
+    TEST_ASSERT_EQUAL_UINT32(textKey(Kind::Grass, "/\\/\\"), textKey(Kind::Grass, "/\\/\\"));
+    TEST_ASSERT_TRUE(textKey(Kind::Grass, "/\\/\\") != textKey(Kind::Grass, "\\/\\/"));
+    TEST_ASSERT_TRUE(textKey(Kind::Grass, "  .-.") != textKey(Kind::Clouds, "  .-."));
+}
+
+void test_cacheHitMissAndZeroedSlots(void) {
+    static uint8_t storage[4 * 100];
+    Cache c;
+    TEST_ASSERT_FALSE(c.ready());
+    TEST_ASSERT_NULL(c.insert(1));
+    TEST_ASSERT_EQUAL(3, c.attach(storage, 350, 100));  // Budget, not buffer size
+
+    TEST_ASSERT_NULL(c.find(7));
+    uint8_t* s = c.insert(7);
+    TEST_ASSERT_NOT_NULL(s);
+    memset(s, 0xAB, 100);
+    TEST_ASSERT_EQUAL_PTR(s, c.find(7));
+    // Re-inserting a key reuses (and clears) its slot
+    TEST_ASSERT_EQUAL_PTR(s, c.insert(7));
+    TEST_ASSERT_EQUAL_HEX8(0, s[50]);
+
+    Stats st = c.getStats();
+    TEST_ASSERT_EQUAL_UINT32(1, st.hits);
+    TEST_ASSERT_EQUAL_UINT32(1, st.misses);
+    TEST_ASSERT_EQUAL(3, st.slots);
+    TEST_ASSERT_EQUAL(100, st.slotBytes);
+
+    // Slots never overlap each other or the storage bound
+    uint8_t* a = c.insert(8);
+    uint8_t* b = c.insert(9);
+    TEST_ASSERT_TRUE(a != s && b != s && a != b);
+    TEST_ASSERT_TRUE(a + 100 <= storage + 300 && b + 100 <= storage + 300);
+}
+
+void test_lruEvictsLeastRecentlyUsed(void) {
+    static uint8_t storage[3 * 16];
+    Cache c;
+    c.attach(storage, sizeof(storage), 16);
+    uint8_t* s1 = c.insert(1);
+    c.insert(2);
+    c.insert(3);
+    c.find(1);                  // 2 is now the oldest
+    uint8_t* s4 = c.insert(4);
+    TEST_ASSERT_NULL(c.find(2));
+    TEST_ASSERT_EQUAL_PTR(s1, c.find(1));
+    TEST_ASSERT_NOT_NULL(c.find(3));
+    TEST_ASSERT_NOT_NULL(s4);
+    TEST_ASSERT_EQUAL(3, c.entries());
+    TEST_ASSERT_EQUAL_UINT32(1, c.getStats().evictions);
+
+    c.clear();
+    TEST_ASSERT_EQUAL(0, c.entries());
+    TEST_ASSERT_NULL(c.find(1));
+}
+
+void test_budgetCappedAtMaxSlots(void) {
+    static uint8_t storage[64 * 8];
+    Cache c;
+    TEST_ASSERT_EQUAL(Cache::kMaxSlots, c.attach(storage, sizeof(storage), 8));
+    TEST_ASSERT_EQUAL(0, c.attach(storage, 7, 8));
+    TEST_ASSERT_FALSE(c.ready());
+}
+
+struct RunLog {
+    int n;
+    int x[16], y[16], len[16], rows[16];
+    RunLog() : n(0) {}
+    void operator()(int rx, int ry, int rlen, int rh) {
+        if (n < 16) { x[n] = rx; y[n] = ry; len[n] = rlen; rows[n] = rh; }
+        n++;
+    }
+};
+
+void test_blitRunsAndClip(void) {
+    // 20x4: rows 0-1 = pixels 2..11 (crosses a byte), rows 2-3 = 0 and 19
+    uint8_t bits[3 * 4] = {0};
+    for (int y = 0; y < 2; y++) {
+        for (int x = 2; x < 12; x++) setPixel(bits, 20, x, y);
+    }
+    for (int y = 2; y < 4; y++) {
+        setPixel(bits, 20, 0, y);
+        setPixel(bits, 20, 19, y);
+    }
+
+    RunLog log;
+    TEST_ASSERT_EQUAL_UINT32(3, blitRuns(bits, 20, 4, 100, 50, 240, 135, log));
+    TEST_ASSERT_EQUAL(102, log.x[0]);
+    TEST_ASSERT_EQUAL(50, log.y[0]);
+    TEST_ASSERT_EQUAL(10, log.len[0]);
+    TEST_ASSERT_EQUAL(2, log.rows[0]);      // Identical rows share one rect
+    TEST_ASSERT_EQUAL(100, log.x[1]);
+    TEST_ASSERT_EQUAL(52, log.y[1]);
+    TEST_ASSERT_EQUAL(1, log.len[1]);
+    TEST_ASSERT_EQUAL(119, log.x[2]);
+
+    // Left edge and bottom clipped (pig mid-walk near x=0, jump at bottom)
+    RunLog clipped;
+    blitRuns(bits, 20, 4, -5, 10, 240, 11, clipped);
+    TEST_ASSERT_EQUAL(1, clipped.n);
+    TEST_ASSERT_EQUAL(0, clipped.x[0]);
+    TEST_ASSERT_EQUAL(7, clipped.len[0]);
+    TEST_ASSERT_EQUAL(1, clipped.rows[0]);
+
+    // Top clipped into the middle of a merged band
+    RunLog top;
+    blitRuns(bits, 20, 4, 0, -3, 240, 135, top);
+    TEST_ASSERT_EQUAL(2, top.n);
+    TEST_ASSERT_EQUAL(0, top.y[0]);
+    TEST_ASSERT_EQUAL(1, top.rows[0]);
+}
+
+// Both sides use the host font stand-in, so this checks slot geometry and
+// blitRuns() against glyph-by-glyph drawing. The LGFX 1-bit raster itself
+// is compared with drawString on the device when the cache is first set up
+// (PigSprites rasterMatchesDrawString).
+void test_cachedPigMatchesGlyphDrawing(void) {
+    static Framebuffer direct;
+    static Framebuffer cached;
+    static uint8_t slot[1224];
+    const char* lines[3] = { " ?  ? ", "(o 0O)", "z(    )" };
+
+    for (int tail = 0; tail < 2; tail++) {
+        direct.clear();
+        cached.clear();
+        memset(slot, 0, sizeof(slot));
+        drawPigGlyphs(direct, lines, tail != 0, 20, 19, 0xFFE0);
+        rasterPig(slot, lines, tail != 0);
+        cached.color = 0xFFE0;
+        blitRuns(slot, kPigW, kPigH, 20 - kCharW, 19, kScreenW, kScreenH, cached);
+        TEST_ASSERT_EQUAL(0, memcmp(direct.px, cached.px, sizeof(direct.px)));
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Benchmark: idle-screen frame (pig + grass) drawn glyph by glyph vs blitted
+// from the cache. Same pixels either way; the draw-call count is what costs
+// on the device (each call is a clipped rect into the canvas).
+// ---------------------------------------------------------------------------
+
+void test_bench_frameCost(void) {
+    using Clock = std::chrono::steady_clock;
+    const uint32_t kFrames = 3000;
+    static Framebuffer fb;
+    static uint8_t storage[8 * 1224 + 3 * 480];
+    Cache pig;
+    Cache strip;
+    pig.attach(storage, 8 * 1224, 1224);
+    strip.attach(storage + 8 * 1224, 3 * 480, 480);
+
+    const char* faces[2] = { "(o 00)", "(- 00)" };   // Open eye, blink
+    const char* grass = "/\\//\\/\\\\//\\/\\//\\\\/\\/\\//\\";
+
+    fb.clear();
+    auto t0 = Clock::now();
+    for (uint32_t f = 0; f < kFrames; f++) {
+        const char* lines[3] = { " ?  ? ", faces[(f % 40) == 0], "z(    )" };
+        drawPigGlyphs(fb, lines, true, 20, 23, 0xFFFF);
+        drawTextGlyphs(fb, grass, 0, 91, 2, 0xFFFF);
+    }
+    auto t1 = Clock::now();
+    uint32_t glyphCalls = fb.calls / kFrames;
+
+    fb.clear();
+    fb.color = 0xFFFF;
+    auto t2 = Clock::now();
+    for (uint32_t f = 0; f < kFrames; f++) {
+        bool blink = (f % 40) == 0;
+        const char* lines[3] = { " ?  ? ", faces[blink], "z(    )" };
+        uint32_t key = avatarKey(0, true, blink, 0, true);
+        const uint8_t* bits = pig.find(key);
+        if (!bits) {
+            uint8_t* slot = pig.insert(key);
+            rasterPig(slot, lines, true);
+            bits = slot;
+        }
+        blitRuns(bits, kPigW, kPigH, 20 - kCharW, 23, kScreenW, kScreenH, fb);
+
+        uint32_t gk = textKey(Kind::Grass, grass);
+        const uint8_t* g = strip.find(gk);
+        if (!g) {
+            uint8_t* slot = strip.insert(gk);
+            rasterText(slot, 240, 16, grass, 0, 0, 2);
+            g = slot;
+        }
+        blitRuns(g, 240, 16, 0, 91, kScreenW, kScreenH, fb);
+    }
+    auto t3 = Clock::now();
+    uint32_t blitCalls = fb.calls / kFrames;
+
+    double glyphUs = std::chrono::duration<double, std::micro>(t1 - t0).count() / kFrames;
+    double blitUs = std::chrono::duration<double, std::micro>(t3 - t2).count() / kFrames;
+    printf("[BENCH] idle frame: glyphs %6.2f us (%u rects)  cached %6.2f us (%u rects)  "
+           "speedup=%.1fx, %u rasterisations\n",
+           glyphUs, (unsigned)glyphCalls, blitUs, (unsigned)blitCalls,
+           blitUs > 0 ? glyphUs / blitUs : 0.0,
+           (unsigned)(pig.getStats().misses + strip.getStats().misses));
+
+    // Two pig variants + one grass strip, rasterised once each
+    TEST_ASSERT_EQUAL_UINT32(3, pig.getStats().misses + strip.getStats().misses);
+    TEST_ASSERT_TRUE(blitCalls < glyphCalls);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_bitmapLayout);
+    RUN_TEST(test_keysSeparateVariants);
+    RUN_TEST(test_cacheHitMissAndZeroedSlots);
+    RUN_TEST(test_lruEvictsLeastRecentlyUsed);
+    RUN_TEST(test_budgetCappedAtMaxSlots);
+    RUN_TEST(test_blitRunsAndClip);
+    RUN_TEST(test_cachedPigMatchesGlyphDrawing);
+    RUN_TEST(test_bench_frameCost);
+
+    return UNITY_END();
+}
@@ -0,0 +1,197 @@
+// Wardrive Rows Tests
+// Tests src/core/wardrive_rows.h (row formatting, sector-aligned batching)
+
+#include <unity.h>
+#include <cstring>
+#include <string>
+#include <vector>
+#include "../../src/core/wardrive_rows.h"
+
+using namespace WardriveRows;
+
+void setUp(void) {}
+void tearDown(void) {}
+
+static const uint8_t kBssid[6] = {0x64, 0xEE, 0xB7, 0x20, 0x82, 0x86};
+
+// Records every write the buffer issues, like File::write() on SD
+struct MockSink {
+    std::string file;
+    std::vector<size_t> writeEnds;  // File offset after each write
+    bool fail = false;
+
+    bool operator()(const uint8_t* data, size_t len) {
+        if (fail) return false;
+        file.append((const char*)data, len);
+        writeEnds.push_back(file.size());
+        return true;
+    }
+};
+
+// ============================================================================
+// Formatting
+// ============================================================================
+
+void test_csvField_escapesAndStrips(void) {
+    char out[72];
+    TEST_ASSERT_EQUAL(12, csvField(out, sizeof(out), "say \"hi\""));
+    TEST_ASSERT_EQUAL_STRING("\"say \"\"hi\"\"\"", out);
+
+    csvField(out, sizeof(out), "a\nb\rc\td");
+    TEST_ASSERT_EQUAL_STRING("\"abcd\"", out);
+
+    csvField(out, sizeof(out), "");
+    TEST_ASSERT_EQUAL_STRING("\"\"", out);
+}
+
+void test_csvField_capsAt32Bytes(void) {
+    char out[72];
+    csvField(out, sizeof(out), "0123456789012345678901234567890123456789");
+    TEST_ASSERT_EQUAL_STRING("\"01234567890123456789012345678901\"", out);
+
+    // Worst case: 32 quotes double to 64 and still fit the row field
+    char quotes[33];
+    memset(quotes, '"', 32);
+    quotes[32] = '\0';
+    TEST_ASSERT_EQUAL(66, csvField(out, sizeof(out), quotes));
+}
+
+void test_csvRow_matchesOldOutput(void) {
+    char row[kMaxRow];
+    size_t len = formatCsvRow(row, sizeof(row), kBssid, "Pork,Net", -67, 6, "WPA2",
+                              51.5074, -0.1278, 35.0, 123456UL);
+    TEST_ASSERT_EQUAL_STRING("64:EE:B7:20:82:86,\"Pork,Net\",-67,6,WPA2,51.507400,-0.127800,35.0,123456\n", row);
+    TEST_ASSERT_EQUAL(strlen(row), len);
+}
+
+void test_wigleRow_matchesOldOutput(void) {
+    char row[kMaxRow];
+    size_t len = formatWigleRow(row, sizeof(row), kBssid, "Oink", "[WPA2-PSK-CCMP][ESS]",
+                                "2026-10-16 12:34:56", 11, 2462, -80,
+                                40.7128, -74.0060, 10.0, 0.0);
+    TEST_ASSERT_EQUAL_STRING("64:EE:B7:20:82:86,\"Oink\",[WPA2-PSK-CCMP][ESS],2026-10-16 12:34:56,11,2462,-80,"
+                             "40.712800,-74.006000,10.0,10.0,,,WIFI\r\n", row);
+    TEST_ASSERT_EQUAL(strlen(row), len);
+
+    formatWigleRow(row, sizeof(row), kBssid, "Oink", "[ESS]", "x", 1, 2412, -50, 0, 0, 0, 4.5);
+    TEST_ASSERT_NOT_NULL(strstr(row, ",4.5,,,WIFI\r\n"));
+}
+
+void test_rows_worstCaseFits(void) {
+    char quotes[33];
+    memset(quotes, '"', 32);
+    quotes[32] = '\0';
+    char row[kMaxRow];
+    TEST_ASSERT_TRUE(formatWigleRow(row, sizeof(row), kBssid, quotes, "[WPA2-EAP-CCMP][WPA3-SAE-CCMP][ESS]",
+                                    "2099-12-31 23:59:59", 165, 5825, -100,
+                                    -89.999999, -179.999999, -12345.6, 99999.9) > 0);
+    TEST_ASSERT_TRUE(formatCsvRow(row, sizeof(row), kBssid, quotes, -100, 165, "WPA2/WPA3",
+                                  -89.999999, -179.999999, -12345.6, 4294967295UL) > 0);
+}
+
+// ============================================================================
+// SectorBuffer
+// ============================================================================
+
+void test_buffer_holdsRowsUntilFull(void) {
+    SectorBuffer<2048> buf;
+    MockSink sink;
+    buf.reset(0);
+    const char row[] = "64:EE:B7:20:82:86,\"x\",-1,1,OPEN,0.000000,0.000000,0.0,1\n";
+    for (int i = 0; i < 20; i++) TEST_ASSERT_TRUE(buf.append(row, sizeof(row) - 1, sink));
+    TEST_ASSERT_EQUAL(0, sink.writeEnds.size());
+    TEST_ASSERT_EQUAL(20 * (sizeof(row) - 1), buf.pending());
+    TEST_ASSERT_EQUAL_UINT32(20 * (sizeof(row) - 1), buf.size());
+}
+
+void test_buffer_writesWholeSectors(void) {
+    SectorBuffer<2048> buf;
+    MockSink sink;
+    buf.reset(0);
+    std::string expect;
+    char row[kMaxRow];
+    for (int i = 0; i < 2000; i++) {
+        size_t len = formatCsvRow(row, sizeof(row), kBssid, "net", -(i % 90), 1 + i % 13, "WPA2",
+                                  i * 0.001, -i * 0.001, i, (unsigned long)i);
+        TEST_ASSERT_TRUE(buf.append(row, len, sink));
+        expect.append(row, len);
+    }
+    TEST_ASSERT_TRUE(sink.writeEnds.size() > 10);
+    for (size_t end : sink.writeEnds) TEST_ASSERT_EQUAL(0, end % kSector);
+    TEST_ASSERT_EQUAL_UINT32(expect.size(), buf.size());
+
+    TEST_ASSERT_TRUE(buf.flushAll(sink));
+    TEST_ASSERT_EQUAL(0, buf.pending());
+    TEST_ASSERT_TRUE(sink.file == expect);
+}
+
+void test_buffer_realignsAfterPartialFlush(void) {
+    // A timer flush leaves the file mid-sector; the next batch ends on a boundary again
+    SectorBuffer<1024> buf;
+    MockSink sink;
+    buf.reset(0);
+    char row[100];
+    memset(row, 'r', sizeof(row));
+    buf.append(row, 100, sink);
+    TEST_ASSERT_TRUE(buf.flushAll(sink));
+    TEST_ASSERT_EQUAL(100, sink.file.size());
+
+    sink.writeEnds.clear();
+    for (int i = 0; i < 30; i++) TEST_ASSERT_TRUE(buf.append(row, 100, sink));
+    TEST_ASSERT_TRUE(sink.writeEnds.size() > 0);
+    for (size_t end : sink.writeEnds) TEST_ASSERT_EQUAL(0, end % kSector);
+    buf.flushAll(sink);
+    TEST_ASSERT_EQUAL(3100, sink.file.size());
+}
+
+void test_buffer_sizeIncludesExistingFile(void) {
+    SectorBuffer<1024> buf;
+    MockSink sink;
+    buf.reset(700);
+    buf.append("0123456789", 10, sink);
+    TEST_ASSERT_EQUAL_UINT32(710, buf.size());
+
+    // Alignment is by file offset, not by buffer offset
+    char fill[400];
+    memset(fill, 'f', sizeof(fill));
+    for (int i = 0; i < 4; i++) buf.append(fill, sizeof(fill), sink);
+    TEST_ASSERT_TRUE(sink.writeEnds.size() > 0);
+    for (size_t end : sink.writeEnds) TEST_ASSERT_EQUAL(0, (700 + end) % kSector);
+    TEST_ASSERT_EQUAL_UINT32(2310, buf.size());
+}
+
+void test_buffer_sinkFailureReported(void) {
+    SectorBuffer<1024> buf;
+    MockSink sink;
+    buf.reset(0);
+    char row[200];
+    memset(row, 'x', sizeof(row));
+    for (int i = 0; i < 5; i++) TEST_ASSERT_TRUE(buf.append(row, sizeof(row), sink));
+    sink.fail = true;
+    TEST_ASSERT_FALSE(buf.append(row, sizeof(row), sink));
+    TEST_ASSERT_FALSE(buf.flushAll(sink));
+    TEST_ASSERT_EQUAL(1000, buf.pending());
+
+    // Oversized input is refused outright
+    sink.fail = false;
+    char big[kMaxRow * 4];
+    TEST_ASSERT_FALSE(buf.append(big, sizeof(big), sink));
+}
+
+int main(void) {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_csvField_escapesAndStrips);
+    RUN_TEST(test_csvField_capsAt32Bytes);
+    RUN_TEST(test_csvRow_matchesOldOutput);
+    RUN_TEST(test_wigleRow_matchesOldOutput);
+    RUN_TEST(test_rows_worstCaseFits);
+
+    RUN_TEST(test_buffer_holdsRowsUntilFull);
+    RUN_TEST(test_buffer_writesWholeSectors);
+    RUN_TEST(test_buffer_realignsAfterPartialFlush);
+    RUN_TEST(test_buffer_sizeIncludesExistingFile);
+    RUN_TEST(test_buffer_sinkFailureReported);
+
+    return UNITY_END();
+}
@@ -0,0 +1,310 @@
+// Wardrive Sightings Tests
+// Tests src/core/wardrive_sightings.h (fix interpolation, best-RSSI table)
+
+#include <unity.h>
+#include <cstring>
+#include <vector>
+#include "../../src/core/wardrive_sightings.h"
+
+using namespace WardriveSightings;
+
+void setUp(void) {}
+void tearDown(void) {}
+
+static const uint32_t kGap = 5000;
+
+static Fix makeFix(uint32_t ms, double lat, double lon, float alt = 10.0f, uint32_t time = 12000000) {
+    Fix f;
+    f.ms = ms;
+    f.latE7 = toE7(lat);
+    f.lonE7 = toE7(lon);
+    f.alt = alt;
+    f.accuracy = 5.0f;
+    f.date = 161026;
+    f.time = time;
+    return f;
+}
+
+static Sighting makeSighting(const uint8_t* bssid, int8_t rssi, uint32_t ms, const char* ssid = "PorkNet",
+                             bool first = false) {
+    Sighting s;
+    s.first = first;
+    s.bssid = bssid;
+    s.ssid = ssid;
+    s.auth = 3;
+    s.channel = 6;
+    s.rssi = rssi;
+    s.ms = ms;
+    return s;
+}
+
+// Collects emitted rows, like WarhogMode::writeSighting()
+struct Rows {
+    std::vector<Entry> out;
+    void operator()(const Entry& e) { out.push_back(e); }
+};
+
+static void mac(int i, uint8_t* out) {
+    const uint8_t base[6] = {0x64, 0xEE, 0xB7, 0x00, 0x00, 0x00};
+    memcpy(out, base, 6);
+    out[4] = (uint8_t)(i >> 8);
+    out[5] = (uint8_t)i;
+}
+
+// ============================================================================
+// Fixes
+// ============================================================================
+
+void test_e7_roundTrip(void) {
+    TEST_ASSERT_EQUAL_INT32(515074000, toE7(51.5074));
+    TEST_ASSERT_EQUAL_INT32(-1278000, toE7(-0.1278));
+    TEST_ASSERT_EQUAL_INT32(1799999999, toE7(179.9999999));
+    TEST_ASSERT_TRUE(fromE7(toE7(-33.8688197)) > -33.86882 && fromE7(toE7(-33.8688197)) < -33.86881);
+}
+
+void test_interpolate_linearBetweenFixes(void) {
+    Fix a = makeFix(1000, 40.0, -74.0, 10.0f);
+    Fix b = makeFix(2000, 40.0001, -74.0002, 20.0f);
+    Fix m = interpolate(a, b, 1250, kGap);
+    TEST_ASSERT_EQUAL_UINT32(1250, m.ms);
+    TEST_ASSERT_EQUAL_INT32(toE7(40.000025), m.latE7);
+    TEST_ASSERT_EQUAL_INT32(toE7(-74.00005), m.lonE7);
+    TEST_ASSERT_TRUE(m.alt > 12.49f && m.alt < 12.51f);
+    TEST_ASSERT_EQUAL_UINT32(a.time, m.time);  // Nearer fix's timestamp
+}
+
+void test_interpolate_outsideOrTooFarUsesNearer(void) {
+    Fix a = makeFix(1000, 40.0, -74.0);
+    Fix b = makeFix(2000, 41.0, -75.0);
+    TEST_ASSERT_EQUAL_INT32(a.latE7, interpolate(a, b, 900, kGap).latE7);
+    TEST_ASSERT_EQUAL_INT32(b.latE7, interpolate(a, b, 2100, kGap).latE7);
+
+    // Fixes 10s apart (signal dropout): no straight line across the gap
+    Fix c = makeFix(11000, 41.0, -75.0);
+    TEST_ASSERT_EQUAL_INT32(a.latE7, interpolate(a, c, 3000, kGap).latE7);
+    TEST_ASSERT_EQUAL_INT32(c.latE7, interpolate(a, c, 9000, kGap).latE7);
+}
+
+void test_interpolate_survivesMillisWrap(void) {
+    Fix a = makeFix(0xFFFFFE00u, 10.0, 10.0);
+    Fix b = makeFix(0x00000200u, 10.001, 10.0);     // 1024 ms later, after wrap
+    Fix m = interpolate(a, b, 0x00000000u, kGap);
+    TEST_ASSERT_EQUAL_INT32(toE7(10.0005), m.latE7);
+}
+
+// ============================================================================
+// BestTable
+// ============================================================================
+
+void test_table_needsLiveFix(void) {
+    Entry slots[8];
+    BestTable t;
+    Rows rows;
+    uint8_t b[6];
+    mac(1, b);
+    t.attach(slots, 8, false, kGap);
+
+    TEST_ASSERT_FALSE(t.observe(makeSighting(b, -60, 100), 100, rows));
+    TEST_ASSERT_EQUAL(0, t.size());
+
+    t.onFix(makeFix(1000, 40.0, -74.0));
+    TEST_ASSERT_TRUE(t.observe(makeSighting(b, -60, 1100), 1100, rows));
+    TEST_ASSERT_EQUAL(1, t.size());
+
+    // Fix went stale (GPS lost): nothing new is geotagged
+    uint8_t c[6];
+    mac(2, c);
+    TEST_ASSERT_FALSE(t.observe(makeSighting(c, -50, 7000), 7000, rows));
+    TEST_ASSERT_EQUAL(1, t.size());
+}
+
+void test_table_keepsStrongestPosition(void) {
+    Entry slots[8];
+    BestTable t;
+    Rows rows;
+    uint8_t b[6];
+    mac(1, b);
+    t.attach(slots, 8, false, kGap);
+
+    t.onFix(makeFix(1000, 40.0000, -74.0));
+    TEST_ASSERT_TRUE(t.observe(makeSighting(b, -80, 1100), 1100, rows));
+    t.onFix(makeFix(2000, 40.0010, -74.0));
+    TEST_ASSERT_TRUE(t.observe(makeSighting(b, -55, 2100), 2100, rows));   // Closest approach
+    t.onFix(makeFix(3000, 40.0020, -74.0));
+    TEST_ASSERT_FALSE(t.observe(makeSighting(b, -70, 3100), 3100, rows));
+    TEST_ASSERT_FALSE(t.observe(makeSighting(b, -55, 3200), 3200, rows));  // Ties keep the first
+
+    t.emitAll(rows);
+    TEST_ASSERT_EQUAL(1, rows.out.size());
+    TEST_ASSERT_EQUAL_INT8(-55, rows.out[0].rssi);
+    TEST_ASSERT_EQUAL_INT32(toE7(40.0010), rows.out[0].pos.latE7);
+    TEST_ASSERT_EQUAL_UINT32(2100, rows.out[0].bestMs);
+    TEST_ASSERT_EQUAL_STRING("PorkNet", rows.out[0].ssid);
+    TEST_ASSERT_EQUAL(0, t.size());
+}
+
+void test_table_interpolatesAtNextFix(void) {
+    Entry slots[8];
+    BestTable t;
+    Rows rows;
+    uint8_t b[6];
+    mac(1, b);
+    t.attach(slots, 8, true, kGap);
+
+    t.onFix(makeFix(1000, 40.0000, -74.0000));
+    t.observe(makeSighting(b, -50, 1750), 1750, rows);
+    t.onFix(makeFix(2000, 40.0004, -74.0008));
+    t.emitAll(rows);
+
+    TEST_ASSERT_EQUAL(1, rows.out.size());
+    TEST_ASSERT_EQUAL_INT32(toE7(40.0003), rows.out[0].pos.latE7);
+    TEST_ASSERT_EQUAL_INT32(toE7(-74.0006), rows.out[0].pos.lonE7);
+    TEST_ASSERT_FALSE(rows.out[0].pending);
+}
+
+void test_table_pendingFlushedWithLastFix(void) {
+    // Stop before the next fix: the sighting keeps the fix it arrived under
+    Entry slots[4];
+    BestTable t;
+    Rows rows;
+    uint8_t b[6];
+    mac(1, b);
+    t.attach(slots, 4, true, kGap);
+    t.onFix(makeFix(1000, 40.0, -74.0));
+    t.observe(makeSighting(b, -50, 1500), 1500, rows);
+    t.emitAll(rows);
+    TEST_ASSERT_EQUAL(1, rows.out.size());
+    TEST_ASSERT_EQUAL_INT32(toE7(40.0), rows.out[0].pos.latE7);
+}
+
+void test_table_emitsQuietAps(void) {
+    Entry slots[8];
+    BestTable t;
+    Rows rows;
+    uint8_t a[6], b[6];
+    mac(1, a);
+    mac(2, b);
+    t.attach(slots, 8, false, kGap);
+    t.onFix(makeFix(1000, 40.0, -74.0));
+    t.observe(makeSighting(a, -60, 1000), 1000, rows);
+    t.observe(makeSighting(b, -60, 1000), 1000, rows);
+
+    // b keeps beaconing (weaker) - still in range, not written
+    t.onFix(makeFix(12000, 40.0, -74.0));
+    t.observe(makeSighting(b, -85, 12000), 12000, rows);
+    TEST_ASSERT_EQUAL(0, t.emitQuiet(15000, 15000, rows));
+    TEST_ASSERT_EQUAL(1, t.emitQuiet(16000, 15000, rows));
+    TEST_ASSERT_EQUAL_HEX8(1, rows.out[0].bssid[5]);
+    TEST_ASSERT_EQUAL(1, t.size());
+
+    // A later pass past a is a fresh entry
+    t.onFix(makeFix(20000, 40.1, -74.0));
+    TEST_ASSERT_TRUE(t.observe(makeSighting(a, -90, 20000), 20000, rows));
+    TEST_ASSERT_EQUAL(2, t.size());
+}
+
+void test_table_fullEvictsQuietest(void) {
+    Entry slots[4];
+    BestTable t;
+    Rows rows;
+    uint8_t b[6];
+    t.attach(slots, 4, false, kGap);
+    t.onFix(makeFix(1000, 40.0, -74.0));
+    for (int i = 0; i < 4; i++) {
+        mac(i, b);
+        t.observe(makeSighting(b, -60, 1000 + i * 100), 1000 + i * 100, rows);
+    }
+    // Refresh AP 0 so AP 1 is the longest quiet
+    mac(0, b);
+    t.observe(makeSighting(b, -70, 1500), 1500, rows);
+
+    mac(9, b);
+    TEST_ASSERT_TRUE(t.observe(makeSighting(b, -60, 1600), 1600, rows));
+    TEST_ASSERT_EQUAL(1, rows.out.size());
+    TEST_ASSERT_EQUAL_HEX8(1, rows.out[0].bssid[5]);
+    TEST_ASSERT_EQUAL(4, t.size());
+}
+
+void test_table_hiddenSsidKeepsRevealedName(void) {
+    Entry slots[4];
+    BestTable t;
+    Rows rows;
+    uint8_t b[6];
+    mac(1, b);
+    t.attach(slots, 4, false, kGap);
+    t.onFix(makeFix(1000, 40.0, -74.0));
+    t.observe(makeSighting(b, -70, 1000, "Revealed"), 1000, rows);
+    t.observe(makeSighting(b, -40, 1100, ""), 1100, rows);
+    t.emitAll(rows);
+    TEST_ASSERT_EQUAL_STRING("Revealed", rows.out[0].ssid);
+    TEST_ASSERT_EQUAL_INT8(-40, rows.out[0].rssi);
+}
+
+void test_table_firstFlagOnlyOnFirstRow(void) {
+    Entry slots[2];
+    BestTable t;
+    Rows rows;
+    uint8_t a[6], b[6], c[6];
+    mac(1, a);
+    mac(2, b);
+    mac(3, c);
+    t.attach(slots, 2, false, kGap);
+    t.onFix(makeFix(1000, 40.0, -74.0));
+
+    // First sighting opens the entry; a stronger repeat keeps the flag
+    t.observe(makeSighting(a, -70, 1000, "A", true), 1000, rows);
+    t.observe(makeSighting(a, -50, 1100, "A"), 1100, rows);
+    t.emitQuiet(20000, 15000, rows);
+    TEST_ASSERT_EQUAL(1, rows.out.size());
+    TEST_ASSERT_TRUE(rows.out[0].first);
+
+    // Parked next to it: every later pass is a row, none of them first
+    t.onFix(makeFix(21000, 40.0, -74.0));
+    t.observe(makeSighting(a, -50, 21000, "A"), 21000, rows);
+    t.emitQuiet(40000, 15000, rows);
+    TEST_ASSERT_EQUAL(2, rows.out.size());
+    TEST_ASSERT_FALSE(rows.out[1].first);
+
+    // Evicted and re-added: the re-add isn't first either
+    t.onFix(makeFix(41000, 40.0, -74.0));
+    t.observe(makeSighting(b, -60, 41000, "B", true), 41000, rows);
+    t.observe(makeSighting(c, -60, 41100, "C", true), 41100, rows);
+    t.observe(makeSighting(a, -60, 41200, "A"), 41200, rows);    // Evicts b
+    t.observe(makeSighting(b, -60, 41300, "B"), 41300, rows);    // Evicts c
+    t.emitAll(rows);
+    int firsts = 0;
+    for (size_t i = 0; i < rows.out.size(); i++) firsts += rows.out[i].first ? 1 : 0;
+    TEST_ASSERT_EQUAL(6, rows.out.size());
+    TEST_ASSERT_EQUAL(3, firsts);   // One each for a, b, c
+}
+
+void test_table_detachedIsInert(void) {
+    BestTable t;
+    Rows rows;
+    uint8_t b[6];
+    mac(1, b);
+    t.onFix(makeFix(1000, 40.0, -74.0));
+    TEST_ASSERT_FALSE(t.observe(makeSighting(b, -60, 1000), 1000, rows));
+    TEST_ASSERT_EQUAL(0, t.emitAll(rows));
+}
+
+int main(void) {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_e7_roundTrip);
+    RUN_TEST(test_interpolate_linearBetweenFixes);
+    RUN_TEST(test_interpolate_outsideOrTooFarUsesNearer);
+    RUN_TEST(test_interpolate_survivesMillisWrap);
+
+    RUN_TEST(test_table_needsLiveFix);
+    RUN_TEST(test_table_keepsStrongestPosition);
+    RUN_TEST(test_table_interpolatesAtNextFix);
+    RUN_TEST(test_table_pendingFlushedWithLastFix);
+    RUN_TEST(test_table_emitsQuietAps);
+    RUN_TEST(test_table_fullEvictsQuietest);
+    RUN_TEST(test_table_hiddenSsidKeepsRevealedName);
+    RUN_TEST(test_table_firstFlagOnlyOnFirstRow);
+    RUN_TEST(test_table_detachedIsInert);
+
+    return UNITY_END();
+}
@@ -0,0 +1,239 @@
+// XP Store Tests
+// Tests src/core/xp_store.h (versioned CRC blob, upgrade/downgrade, save
+// coalescing, blob round trip and per-field key migration via the NVS mock)
+
+#include <unity.h>
+#include <cstring>
+#include "../mocks/mock_preferences.h"
+#include "../../src/core/xp_store.h"
+
+using namespace XPStore;
+
+void setUp(void) {
+    Preferences::clearAll();
+}
+void tearDown(void) {}
+
+// Stand-ins for PorkXPData: V2 appends fields to V1
+struct PayloadV1 {
+    uint32_t totalXP;
+    uint32_t networks;
+    uint16_t sessions;
+    uint8_t level;
+    bool wep;
+};
+
+struct PayloadV2 {
+    uint32_t totalXP;
+    uint32_t networks;
+    uint16_t sessions;
+    uint8_t level;
+    bool wep;
+    uint32_t unlockables;
+    uint32_t mercy;
+};
+
+static PayloadV2 makeV2() {
+    PayloadV2 p;
+    memset(&p, 0, sizeof(p));
+    p.totalXP = 123456;
+    p.networks = 789;
+    p.sessions = 42;
+    p.level = 17;
+    p.wep = true;
+    p.unlockables = 0x5;
+    p.mercy = 3;
+    return p;
+}
+
+void test_roundTrip(void) {
+    PayloadV2 in = makeV2();
+    uint8_t blob[128];
+    size_t n = encode(&in, sizeof(in), blob, sizeof(blob));
+    TEST_ASSERT_EQUAL(blobSize(sizeof(in)), n);
+
+    PayloadV2 out;
+    memset(&out, 0xEE, sizeof(out));
+    TEST_ASSERT_EQUAL((int)Status::Ok, (int)decode(blob, n, &out, sizeof(out)));
+    TEST_ASSERT_EQUAL(0, memcmp(&in, &out, sizeof(in)));
+
+    // Too small a buffer writes nothing
+    TEST_ASSERT_EQUAL(0, encode(&in, sizeof(in), blob, blobSize(sizeof(in)) - 1));
+}
+
+void test_corruptionRejectedAndPayloadUntouched(void) {
+    PayloadV2 in = makeV2();
+    uint8_t blob[128];
+    size_t n = encode(&in, sizeof(in), blob, sizeof(blob));
+    PayloadV2 out;
+    memset(&out, 0xEE, sizeof(out));
+
+    blob[kHeaderSize + 2] ^= 0x01;
+    TEST_ASSERT_EQUAL((int)Status::BadCrc, (int)decode(blob, n, &out, sizeof(out)));
+    blob[kHeaderSize + 2] ^= 0x01;
+
+    // Truncated write
+    TEST_ASSERT_EQUAL((int)Status::BadSize, (int)decode(blob, n - 1, &out, sizeof(out)));
+    TEST_ASSERT_EQUAL((int)Status::Missing, (int)decode(blob, kHeaderSize - 1, &out, sizeof(out)));
+
+    blob[0] ^= 0xFF;
+    TEST_ASSERT_EQUAL((int)Status::BadMagic, (int)decode(blob, n, &out, sizeof(out)));
+
+    for (size_t i = 0; i < sizeof(out); i++) {
+        TEST_ASSERT_EQUAL_HEX8(0xEE, ((uint8_t*)&out)[i]);
+    }
+    TEST_ASSERT_FALSE(usable(Status::BadCrc));
+    TEST_ASSERT_EQUAL_STRING("BAD_CRC", statusName(Status::BadCrc));
+}
+
+void test_olderBlobUpgradesWithZeroedTail(void) {
+    PayloadV1 old;
+    memset(&old, 0, sizeof(old));
+    old.totalXP = 5000;
+    old.sessions = 9;
+    uint8_t blob[128];
+    size_t n = encode(&old, sizeof(old), blob, sizeof(blob));
+
+    PayloadV2 out;
+    memset(&out, 0xEE, sizeof(out));
+    Status st = decode(blob, n, &out, sizeof(out));
+    TEST_ASSERT_EQUAL((int)Status::Upgraded, (int)st);
+    TEST_ASSERT_TRUE(usable(st));
+    TEST_ASSERT_EQUAL_UINT32(5000, out.totalXP);
+    TEST_ASSERT_EQUAL(9, out.sessions);
+    TEST_ASSERT_EQUAL_UINT32(0, out.unlockables);
+    TEST_ASSERT_EQUAL_UINT32(0, out.mercy);
+}
+
+void test_newerBlobLoadsPrefix(void) {
+    PayloadV2 in = makeV2();
+    uint8_t blob[128];
+    size_t n = encode(&in, sizeof(in), blob, sizeof(blob));
+
+    PayloadV1 out;
+    TEST_ASSERT_EQUAL((int)Status::Ok, (int)decode(blob, n, &out, sizeof(out)));
+    TEST_ASSERT_EQUAL_UINT32(123456, out.totalXP);
+    TEST_ASSERT_EQUAL(17, out.level);
+}
+
+void test_policyCoalescesBursts(void) {
+    SavePolicy p;
+    TEST_ASSERT_FALSE(p.due(0));
+
+    // First request after a quiet spell goes straight out
+    p.markDirty();
+    TEST_ASSERT_TRUE(p.due(1000));
+    p.saved(1000, true);
+
+    // Burst of level-up/achievement saves inside the window
+    for (uint32_t t = 1100; t < 1000 + kMinSaveIntervalMs; t += 500) {
+        p.markDirty();
+        TEST_ASSERT_FALSE(p.due(t));
+    }
+    TEST_ASSERT_TRUE(p.isDirty());
+    TEST_ASSERT_TRUE(p.due(1000 + kMinSaveIntervalMs));
+    p.saved(1000 + kMinSaveIntervalMs, true);
+    TEST_ASSERT_FALSE(p.isDirty());
+
+    TEST_ASSERT_EQUAL_UINT32(2, p.writeCount());
+    TEST_ASSERT_TRUE(p.requestCount() > 20);
+}
+
+void test_policyRetriesFailedWrite(void) {
+    SavePolicy p;
+    p.markDirty();
+    p.failed(0xFFFFF000u);
+    TEST_ASSERT_TRUE(p.isDirty());
+    TEST_ASSERT_FALSE(p.due(0xFFFFF000u + 10));
+    // Interval measured across the millis() wrap
+    TEST_ASSERT_TRUE(p.due(0xFFFFF000u + kMinSaveIntervalMs));
+    p.saved(5, false);
+    TEST_ASSERT_EQUAL_UINT32(0, p.writeCount());
+}
+
+void test_blobThroughPreferences(void) {
+    Preferences prefs;
+    prefs.begin("porkxp", false);
+    PayloadV2 out;
+    TEST_ASSERT_EQUAL((int)Status::Missing, (int)readBlob(prefs, &out, sizeof(out)));
+
+    PayloadV2 in = makeV2();
+    TEST_ASSERT_TRUE(writeBlob(prefs, &in, sizeof(in)));
+    prefs.end();
+
+    // Other namespaces don't see it
+    prefs.begin("porkchop", true);
+    TEST_ASSERT_FALSE(prefs.isKey(kBlobKey));
+    prefs.end();
+
+    prefs.begin("porkxp", true);
+    TEST_ASSERT_EQUAL(blobSize(sizeof(in)), prefs.getBytesLength(kBlobKey));
+    memset(&out, 0, sizeof(out));
+    TEST_ASSERT_EQUAL((int)Status::Ok, (int)readBlob(prefs, &out, sizeof(out)));
+    TEST_ASSERT_EQUAL(0, memcmp(&in, &out, sizeof(in)));
+    prefs.end();
+}
+
+void test_migrateFromPerFieldKeys(void) {
+    static const char* const kLegacy[] = { "totalxp", "networks", "sessions", "wep" };
+    Preferences prefs;
+
+    // Pre-blob firmware layout
+    prefs.begin("porkxp", false);
+    prefs.putUInt("totalxp", 98765);
+    prefs.putUInt("networks", 321);
+    prefs.putUShort("sessions", 12);
+    prefs.putBool("wep", true);
+    prefs.end();
+
+    // Boot on the new firmware: no blob, fall back to the fields
+    prefs.begin("porkxp", false);
+    PayloadV1 data;
+    memset(&data, 0, sizeof(data));
+    TEST_ASSERT_EQUAL((int)Status::Missing, (int)readBlob(prefs, &data, sizeof(data)));
+    TEST_ASSERT_TRUE(prefs.isKey("totalxp"));
+    data.totalXP = prefs.getUInt("totalxp", 0);
+    data.networks = prefs.getUInt("networks", 0);
+    data.sessions = prefs.getUShort("sessions", 0);
+    data.wep = prefs.getBool("wep", false);
+
+    // First commit writes the blob, then drops the old keys
+    TEST_ASSERT_TRUE(writeBlob(prefs, &data, sizeof(data)));
+    for (size_t i = 0; i < sizeof(kLegacy) / sizeof(kLegacy[0]); i++) prefs.remove(kLegacy[i]);
+    prefs.end();
+
+    prefs.begin("porkxp", true);
+    TEST_ASSERT_FALSE(prefs.isKey("totalxp"));
+    PayloadV1 reloaded;
+    memset(&reloaded, 0, sizeof(reloaded));
+    TEST_ASSERT_EQUAL((int)Status::Ok, (int)readBlob(prefs, &reloaded, sizeof(reloaded)));
+    TEST_ASSERT_EQUAL_UINT32(98765, reloaded.totalXP);
+    TEST_ASSERT_EQUAL_UINT32(321, reloaded.networks);
+    TEST_ASSERT_EQUAL(12, reloaded.sessions);
+    TEST_ASSERT_TRUE(reloaded.wep);
+    prefs.end();
+}
+
+void test_unchangedPayloadSameCrc(void) {
+    PayloadV2 a = makeV2();
+    PayloadV2 b = makeV2();
+    TEST_ASSERT_EQUAL_UINT32(payloadCrc(&a, sizeof(a)), payloadCrc(&b, sizeof(b)));
+    b.totalXP++;
+    TEST_ASSERT_TRUE(payloadCrc(&a, sizeof(a)) != payloadCrc(&b, sizeof(b)));
+}
+
+int main(void) {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_roundTrip);
+    RUN_TEST(test_corruptionRejectedAndPayloadUntouched);
+    RUN_TEST(test_olderBlobUpgradesWithZeroedTail);
+    RUN_TEST(test_newerBlobLoadsPrefix);
+    RUN_TEST(test_policyCoalescesBursts);
+    RUN_TEST(test_policyRetriesFailedWrite);
+    RUN_TEST(test_blobThroughPreferences);
+    RUN_TEST(test_migrateFromPerFieldKeys);
+    RUN_TEST(test_unchangedPayloadSameCrc);
+
+    return UNITY_END();
+}
@@ -0,0 +1,392 @@
+// ZipStream Tests
+// Tests src/web/zip_stream.h (streaming ZIP download of directories)
+// Deflate output is checked with a minimal fixed-Huffman inflater below
+
+#include <unity.h>
+#include <cstring>
+#include <string>
+#include <vector>
+#include "../../src/web/zip_stream.h"
+
+using namespace ZipStream;
+
+void setUp(void) {}
+void tearDown(void) {}
+
+static uint32_t rd16(const uint8_t* p) { return p[0] | (p[1] << 8); }
+static uint32_t rd32(const uint8_t* p) { return rd16(p) | (rd16(p + 2) << 16); }
+
+// ============================================================================
+// Minimal inflater (stored + fixed Huffman only - all the Deflater emits)
+// ============================================================================
+
+struct BitReader {
+    const uint8_t* data;
+    size_t len;
+    size_t bitPos;
+    bool overrun;
+
+    uint32_t bits(int n) {
+        uint32_t v = 0;
+        for (int i = 0; i < n; i++) {
+            if ((bitPos >> 3) >= len) { overrun = true; return 0; }
+            v |= (uint32_t)((data[bitPos >> 3] >> (bitPos & 7)) & 1) << i;
+            bitPos++;
+        }
+        return v;
+    }
+
+    // Huffman codes are packed MSB-first
+    uint32_t code(int n) {
+        uint32_t v = 0;
+        for (int i = 0; i < n; i++) v = (v << 1) | bits(1);
+        return v;
+    }
+};
+
+static int decodeFixedLiteral(BitReader& br) {
+    uint32_t c = br.code(7);
+    if (c <= 0x17) return 256 + c;                          // 256-279
+    c = (c << 1) | br.bits(1);
+    if (c >= 0x30 && c <= 0xBF) return c - 0x30;            // 0-143
+    if (c >= 0xC0 && c <= 0xC7) return 280 + (c - 0xC0);    // 280-287
+    c = (c << 1) | br.bits(1);
+    return 144 + (c - 0x190);                               // 144-255
+}
+
+static bool inflateFixed(const std::vector<uint8_t>& in, std::vector<uint8_t>& out) {
+    static const uint16_t lenBase[29] = {3,4,5,6,7,8,9,10,11,13,15,17,19,23,27,31,
+                                         35,43,51,59,67,83,99,115,131,163,195,227,258};
+    static const uint8_t lenExtra[29] = {0,0,0,0,0,0,0,0,1,1,1,1,2,2,2,2,
+                                         3,3,3,3,4,4,4,4,5,5,5,5,0};
+    static const uint16_t distBase[30] = {1,2,3,4,5,7,9,13,17,25,33,49,65,97,129,193,
+                                          257,385,513,769,1025,1537,2049,3073,4097,6145,
+                                          8193,12289,16385,24577};
+    static const uint8_t distExtra[30] = {0,0,0,0,1,1,2,2,3,3,4,4,5,5,6,6,
+                                          7,7,8,8,9,9,10,10,11,11,12,12,13,13};
+    BitReader br = {in.data(), in.size(), 0, false};
+    bool last = false;
+    while (!last) {
+        last = br.bits(1);
+        uint32_t type = br.bits(2);
+        if (type != 1) return false;
+        for (;;) {
+            int sym = decodeFixedLiteral(br);
+            if (br.overrun) return false;
+            if (sym < 256) { out.push_back((uint8_t)sym); continue; }
+            if (sym == 256) break;
+            sym -= 257;
+            if (sym >= 29) return false;
+            uint32_t len = lenBase[sym] + br.bits(lenExtra[sym]);
+            uint32_t dc = br.code(5);
+            if (dc >= 30) return false;
+            uint32_t dist = distBase[dc] + br.bits(distExtra[dc]);
+            if (dist > out.size()) return false;
+            size_t from = out.size() - dist;
+            for (uint32_t i = 0; i < len; i++) out.push_back(out[from + i]);
+        }
+    }
+    return !br.overrun;
+}
+
+static bool vectorSink(void* ctx, const uint8_t* data, size_t len) {
+    std::vector<uint8_t>* v = static_cast<std::vector<uint8_t>*>(ctx);
+    v->insert(v->end(), data, data + len);
+    return true;
+}
+
+static std::vector<uint8_t> deflateAll(const std::vector<uint8_t>& input, size_t chunk) {
+    static Deflater d;  // ~7KB, keep off the stack
+    std::vector<uint8_t> out;
+    d.begin(vectorSink, &out);
+    for (size_t off = 0; off < input.size(); off += chunk) {
+        size_t n = input.size() - off < chunk ? input.size() - off : chunk;
+        d.write(input.data() + off, n);
+    }
+    d.finish();
+    return out;
+}
+
+static std::vector<uint8_t> csvLike(size_t rows) {
+    std::string s = "MAC,SSID,AuthMode,FirstSeen,Channel,RSSI,Lat,Lon,Alt,Acc,Type\n";
+    char line[160];
+    for (size_t i = 0; i < rows; i++) {
+        snprintf(line, sizeof(line),
+                 "AA:BB:CC:%02X:%02X:%02X,Net_%u,[WPA2-PSK-CCMP][ESS],2026-10-16 12:%02u:%02u,%u,-%u,"
+                 "52.%06u,4.%06u,12.0,5.0,WIFI\n",
+                 (unsigned)(i >> 16) & 0xFF, (unsigned)(i >> 8) & 0xFF, (unsigned)i & 0xFF,
+                 (unsigned)(i % 40), (unsigned)(i / 60 % 60), (unsigned)(i % 60),
+                 (unsigned)(1 + i % 13), (unsigned)(40 + i % 50),
+                 (unsigned)(370000 + i * 7), (unsigned)(890000 + i * 3));
+        s += line;
+    }
+    return std::vector<uint8_t>(s.begin(), s.end());
+}
+
+// ============================================================================
+// CRC32
+// ============================================================================
+
+void test_crc32_knownVectors(void) {
+    TEST_ASSERT_EQUAL_HEX32(0x00000000, crc32Update(0, nullptr, 0));
+    const char* check = "123456789";
+    TEST_ASSERT_EQUAL_HEX32(0xCBF43926, crc32Update(0, (const uint8_t*)check, 9));
+    const char* fox = "The quick brown fox jumps over the lazy dog";
+    TEST_ASSERT_EQUAL_HEX32(0x414FA339, crc32Update(0, (const uint8_t*)fox, strlen(fox)));
+}
+
+void test_crc32_incrementalMatchesOneShot(void) {
+    std::vector<uint8_t> data = csvLike(200);
+    uint32_t whole = crc32Update(0, data.data(), data.size());
+    uint32_t crc = 0;
+    for (size_t off = 0; off < data.size(); off += 1024) {
+        size_t n = data.size() - off < 1024 ? data.size() - off : 1024;
+        crc = crc32Update(crc, data.data() + off, n);
+    }
+    TEST_ASSERT_EQUAL_HEX32(whole, crc);
+}
+
+// ============================================================================
+// Record layout
+// ============================================================================
+
+void test_dosDateTime_packsFields(void) {
+    uint32_t dt = dosDateTime(2026, 10, 16, 13, 45, 58);
+    TEST_ASSERT_EQUAL_UINT32(((2026 - 1980) << 9) | (10 << 5) | 16, dt >> 16);
+    TEST_ASSERT_EQUAL_UINT32((13 << 11) | (45 << 5) | 29, dt & 0xFFFF);
+}
+
+void test_dosDateTime_clampsBefore1980(void) {
+    // Unset RTC (epoch 1970) must not underflow the year field
+    uint32_t dt = dosDateTime(1970, 1, 1, 0, 0, 0);
+    TEST_ASSERT_EQUAL_UINT32((1 << 5) | 1, dt >> 16);
+    TEST_ASSERT_EQUAL_UINT32(0, dt & 0xFFFF);
+}
+
+void test_localHeader_layout(void) {
+    uint8_t buf[64];
+    const char* name = "wardriving/a.csv";
+    size_t n = writeLocalHeader(buf, name, (uint16_t)strlen(name), kMethodDeflate, 0x12345678);
+    TEST_ASSERT_EQUAL_UINT32(30 + strlen(name), n);
+    TEST_ASSERT_EQUAL_HEX32(kSigLocal, rd32(buf));
+    TEST_ASSERT_EQUAL_UINT32(20, rd16(buf + 4));
+    TEST_ASSERT_EQUAL_HEX16(kFlagDescriptor | kFlagUtf8, rd16(buf + 6));
+    TEST_ASSERT_EQUAL_UINT32(8, rd16(buf + 8));
+    TEST_ASSERT_EQUAL_HEX32(0x12345678, rd32(buf + 10));
+    TEST_ASSERT_EQUAL_UINT32(0, rd32(buf + 14));
+    TEST_ASSERT_EQUAL_UINT32(0, rd32(buf + 18));
+    TEST_ASSERT_EQUAL_UINT32(0, rd32(buf + 22));
+    TEST_ASSERT_EQUAL_UINT32(strlen(name), rd16(buf + 26));
+    TEST_ASSERT_EQUAL_UINT32(0, rd16(buf + 28));
+    TEST_ASSERT_EQUAL_MEMORY(name, buf + 30, strlen(name));
+}
+
+void test_descriptorAndEnd_layout(void) {
+    uint8_t buf[32];
+    TEST_ASSERT_EQUAL_UINT32(16, writeDataDescriptor(buf, 0xCBF43926, 100, 200));
+    TEST_ASSERT_EQUAL_HEX32(kSigDescriptor, rd32(buf));
+    TEST_ASSERT_EQUAL_HEX32(0xCBF43926, rd32(buf + 4));
+    TEST_ASSERT_EQUAL_UINT32(100, rd32(buf + 8));
+    TEST_ASSERT_EQUAL_UINT32(200, rd32(buf + 12));
+
+    TEST_ASSERT_EQUAL_UINT32(22, writeEndRecord(buf, 3, 150, 4000));
+    TEST_ASSERT_EQUAL_HEX32(kSigEnd, rd32(buf));
+    TEST_ASSERT_EQUAL_UINT32(3, rd16(buf + 8));
+    TEST_ASSERT_EQUAL_UINT32(3, rd16(buf + 10));
+    TEST_ASSERT_EQUAL_UINT32(150, rd32(buf + 12));
+    TEST_ASSERT_EQUAL_UINT32(4000, rd32(buf + 16));
+    TEST_ASSERT_EQUAL_UINT32(0, rd16(buf + 20));
+}
+
+void test_centralHeader_layout(void) {
+    uint8_t buf[64];
+    const char* name = "x.pcap";
+    size_t n = writeCentralHeader(buf, name, 6, kMethodStore, 0xAABBCCDD, 0x11223344, 500, 500, 1234);
+    TEST_ASSERT_EQUAL_UINT32(46 + 6, n);
+    TEST_ASSERT_EQUAL_HEX32(kSigCentral, rd32(buf));
+    TEST_ASSERT_EQUAL_UINT32(0, rd16(buf + 10));
+    TEST_ASSERT_EQUAL_HEX32(0xAABBCCDD, rd32(buf + 12));
+    TEST_ASSERT_EQUAL_HEX32(0x11223344, rd32(buf + 16));
+    TEST_ASSERT_EQUAL_UINT32(500, rd32(buf + 20));
+    TEST_ASSERT_EQUAL_UINT32(500, rd32(buf + 24));
+    TEST_ASSERT_EQUAL_UINT32(6, rd16(buf + 28));
+    TEST_ASSERT_EQUAL_UINT32(1234, rd32(buf + 42));
+    TEST_ASSERT_EQUAL_MEMORY(name, buf + 46, 6);
+}
+
+// Build a stored two-file archive the way the file server does and walk it
+// back from the end record, checking every offset the server precomputes.
+void test_storedArchive_offsetsAndLength(void) {
+    const char* names[2] = {"a.txt", "sub/b.bin"};
+    std::vector<uint8_t> bodies[2] = {
+        std::vector<uint8_t>(1500, 'a'),
+        std::vector<uint8_t>(10, 0x5A)
+    };
+
+    uint32_t expectLen = 0;
+    uint32_t cdSize = 0;
+    for (int i = 0; i < 2; i++) {
+        uint16_t nl = (uint16_t)strlen(names[i]);
+        expectLen += storedEntrySize(nl, (uint32_t)bodies[i].size());
+        cdSize += centralHeaderSize(nl);
+    }
+    expectLen += cdSize + kEndRecordLen;
+
+    std::vector<uint8_t> zip;
+    uint8_t hdr[kCentralHeaderLen + kMaxNameLen];
+    uint32_t offsets[2], crcs[2];
+    for (int i = 0; i < 2; i++) {
+        uint16_t nl = (uint16_t)strlen(names[i]);
+        offsets[i] = (uint32_t)zip.size();
+        size_t n = writeLocalHeader(hdr, names[i], nl, kMethodStore, 0);
+        zip.insert(zip.end(), hdr, hdr + n);
+        zip.insert(zip.end(), bodies[i].begin(), bodies[i].end());
+        crcs[i] = crc32Update(0, bodies[i].data(), bodies[i].size());
+        n = writeDataDescriptor(hdr, crcs[i], (uint32_t)bodies[i].size(), (uint32_t)bodies[i].size());
+        zip.insert(zip.end(), hdr, hdr + n);
+    }
+    uint32_t cdOffset = (uint32_t)zip.size();
+    for (int i = 0; i < 2; i++) {
+        uint16_t nl = (uint16_t)strlen(names[i]);
+        size_t n = writeCentralHeader(hdr, names[i], nl, kMethodStore, 0, crcs[i],
+                                      (uint32_t)bodies[i].size(), (uint32_t)bodies[i].size(), offsets[i]);
+        zip.insert(zip.end(), hdr, hdr + n);
+    }
+    size_t n = writeEndRecord(hdr, 2, cdSize, cdOffset);
+    zip.insert(zip.end(), hdr, hdr + n);
+
+    TEST_ASSERT_EQUAL_UINT32(expectLen, zip.size());
+
+    const uint8_t* end = zip.data() + zip.size() - kEndRecordLen;
+    TEST_ASSERT_EQUAL_HEX32(kSigEnd, rd32(end));
+    TEST_ASSERT_EQUAL_UINT32(cdSize, rd32(end + 12));
+    const uint8_t* cd = zip.data() + rd32(end + 16);
+    for (int i = 0; i < 2; i++) {
+        TEST_ASSERT_EQUAL_HEX32(kSigCentral, rd32(cd));
+        uint32_t nl = rd16(cd + 28);
+        const uint8_t* local = zip.data() + rd32(cd + 42);
+        TEST_ASSERT_EQUAL_HEX32(kSigLocal, rd32(local));
+        TEST_ASSERT_EQUAL_MEMORY(local + 30, cd + 46, nl);
+        const uint8_t* data = local + 30 + nl;
+        TEST_ASSERT_EQUAL_MEMORY(bodies[i].data(), data, bodies[i].size());
+        TEST_ASSERT_EQUAL_HEX32(rd32(cd + 16), crc32Update(0, data, bodies[i].size()));
+        const uint8_t* desc = data + bodies[i].size();
+        TEST_ASSERT_EQUAL_HEX32(kSigDescriptor, rd32(desc));
+        TEST_ASSERT_EQUAL_HEX32(crcs[i], rd32(desc + 4));
+        cd += 46 + nl;
+    }
+}
+
+// ============================================================================
+// Deflate
+// ============================================================================
+
+void test_deflate_emptyInput(void) {
+    std::vector<uint8_t> in;
+    std::vector<uint8_t> z = deflateAll(in, 1024);
+    TEST_ASSERT_TRUE(z.size() > 0 && z.size() <= 2);
+    std::vector<uint8_t> out;
+    TEST_ASSERT_TRUE(inflateFixed(z, out));
+    TEST_ASSERT_EQUAL_UINT32(0, out.size());
+}
+
+void test_deflate_roundTripText(void) {
+    std::vector<uint8_t> in = csvLike(2000);   // ~200KB, many window slides
+    std::vector<uint8_t> z = deflateAll(in, 1024);
+    std::vector<uint8_t> out;
+    TEST_ASSERT_TRUE(inflateFixed(z, out));
+    TEST_ASSERT_EQUAL_UINT32(in.size(), out.size());
+    TEST_ASSERT_TRUE(in == out);
+    // Wardriving CSV is the main reason deflate is offered at all
+    TEST_ASSERT_TRUE_MESSAGE(z.size() * 2 < in.size(), "CSV should compress at least 2x");
+}
+
+void test_deflate_roundTripBinary(void) {
+    // Pseudo-random bytes exercise 9-bit literals and few matches
+    std::vector<uint8_t> in(50000);
+    uint32_t x = 0x12345678;
+    for (auto& b : in) {
+        x ^= x << 13; x ^= x >> 17; x ^= x << 5;
+        b = (uint8_t)x;
+    }
+    std::vector<uint8_t> z = deflateAll(in, 700);
+    std::vector<uint8_t> out;
+    TEST_ASSERT_TRUE(inflateFixed(z, out));
+    TEST_ASSERT_TRUE(in == out);
+    // Fixed Huffman worst case is 9 bits per byte
+    TEST_ASSERT_TRUE(z.size() <= in.size() * 9 / 8 + 16);
+}
+
+void test_deflate_longRunsUseMaxMatch(void) {
+    std::vector<uint8_t> in(100000, 0);
+    std::vector<uint8_t> z = deflateAll(in, 1024);
+    std::vector<uint8_t> out;
+    TEST_ASSERT_TRUE(inflateFixed(z, out));
+    TEST_ASSERT_TRUE(in == out);
+    TEST_ASSERT_TRUE(z.size() < 1000);
+}
+
+void test_deflate_chunkingDoesNotChangeOutput(void) {
+    std::vector<uint8_t> in = csvLike(300);
+    std::vector<uint8_t> a = deflateAll(in, 1);
+    std::vector<uint8_t> b = deflateAll(in, 1024);
+    std::vector<uint8_t> c = deflateAll(in, in.size());
+    TEST_ASSERT_TRUE(a == b);
+    TEST_ASSERT_TRUE(b == c);
+}
+
+void test_deflate_countsBytes(void) {
+    static Deflater d;
+    std::vector<uint8_t> out;
+    std::vector<uint8_t> in = csvLike(50);
+    d.begin(vectorSink, &out);
+    d.write(in.data(), in.size());
+    d.finish();
+    TEST_ASSERT_EQUAL_UINT32(in.size(), d.bytesIn());
+    TEST_ASSERT_EQUAL_UINT32(out.size(), d.bytesOut());
+}
+
+static bool failingSink(void* ctx, const uint8_t*, size_t) {
+    int* calls = static_cast<int*>(ctx);
+    (*calls)++;
+    return false;
+}
+
+void test_deflate_sinkFailureAborts(void) {
+    static Deflater d;
+    int calls = 0;
+    std::vector<uint8_t> in(20000);
+    for (size_t i = 0; i < in.size(); i++) in[i] = (uint8_t)(i * 131 + (i >> 7));
+    d.begin(failingSink, &calls);
+    bool ok = d.write(in.data(), in.size());
+    ok = d.finish() && ok;
+    TEST_ASSERT_FALSE(ok);
+    TEST_ASSERT_EQUAL_INT(1, calls);   // No retries after the client went away
+}
+
+int main(void) {
+    UNITY_BEGIN();
+
+    // CRC32
+    RUN_TEST(test_crc32_knownVectors);
+    RUN_TEST(test_crc32_incrementalMatchesOneShot);
+
+    // Records
+    RUN_TEST(test_dosDateTime_packsFields);
+    RUN_TEST(test_dosDateTime_clampsBefore1980);
+    RUN_TEST(test_localHeader_layout);
+    RUN_TEST(test_descriptorAndEnd_layout);
+    RUN_TEST(test_centralHeader_layout);
+    RUN_TEST(test_storedArchive_offsetsAndLength);
+
+    // Deflate
+    RUN_TEST(test_deflate_emptyInput);
+    RUN_TEST(test_deflate_roundTripText);
+    RUN_TEST(test_deflate_roundTripBinary);
+    RUN_TEST(test_deflate_longRunsUseMaxMatch);
+    RUN_TEST(test_deflate_chunkingDoesNotChangeOutput);
+    RUN_TEST(test_deflate_countsBytes);
+    RUN_TEST(test_deflate_sinkFailureAborts);
+
+    return UNITY_END();
+}